@@ -0,0 +1,86 @@
+/////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright agent 2026
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/intrusive for documentation.
+//
+/////////////////////////////////////////////////////////////////////////////
+//[doc_compact_set_code
+#include <boost/intrusive/compact_set.hpp>
+#include <boost/intrusive/set_hook.hpp>
+#include <vector>
+#include <functional>
+#include <cassert>
+
+using namespace boost::intrusive;
+
+class MyClass : public compact_set_base_hook<>
+{
+   int int_;
+
+   public:
+   //This is a member hook
+   compact_set_member_hook<> member_hook_;
+
+   MyClass(int i)
+      :  int_(i)
+      {}
+   friend bool operator< (const MyClass &a, const MyClass &b)
+      {  return a.int_ < b.int_;  }
+   friend bool operator> (const MyClass &a, const MyClass &b)
+      {  return a.int_ > b.int_;  }
+};
+
+//Define a compact_set using the base hook that will store values in reverse order
+typedef compact_set< MyClass, compare<std::greater<MyClass> > >     BaseSet;
+
+//Define a compact_set using the member hook
+typedef member_hook<MyClass, compact_set_member_hook<>, &MyClass::member_hook_> MemberOption;
+typedef compact_set< MyClass, MemberOption>   MemberSet;
+
+int main()
+{
+   typedef std::vector<MyClass>::iterator VectIt;
+
+   //Create several MyClass objects, each one with a different value
+   std::vector<MyClass> values;
+   for(int i = 0; i < 100; ++i)  values.push_back(MyClass(i));
+
+   BaseSet baseset;
+   MemberSet memberset;
+
+   //Hooks store only two links: no parent pointer is needed
+   assert(sizeof(compact_set_base_hook<>) == 2*sizeof(void*));
+   assert(sizeof(compact_set_base_hook<>) < sizeof(set_base_hook<>));
+
+   //Now insert them in the sets
+   for(VectIt it(values.begin()), itend(values.end()); it != itend; ++it){
+      baseset.insert(*it);
+      memberset.insert(*it);
+   }
+
+   //Now test compact_sets
+   {
+      BaseSet::reverse_iterator rbit(baseset.rbegin());
+      MemberSet::iterator mit(memberset.begin());
+      VectIt it(values.begin()), itend(values.end());
+
+      //Test the objects inserted in the base hook compact_set
+      for(; it != itend; ++it, ++rbit)
+         if(&*rbit != &*it)   return 1;
+
+      //Test the objects inserted in the member hook compact_set
+      for(it = values.begin(); it != itend; ++it, ++mit)
+         if(&*mit != &*it) return 1;
+   }
+
+   //Iterators are a single pointer, so iterator_to works as usual
+   if(memberset.iterator_to(values[50]) != memberset.find(values[50]))
+      return 1;
+   return 0;
+}
+//]
@@ -0,0 +1,69 @@
+/////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright agent 2026
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/intrusive for documentation.
+//
+/////////////////////////////////////////////////////////////////////////////
+//[doc_frozen_set
+#include <boost/intrusive/set.hpp>
+#include <boost/intrusive/frozen_set.hpp>
+#include <vector>
+#include <cassert>
+
+using namespace boost::intrusive;
+
+class my_class : public set_base_hook<>
+{
+   public:
+   explicit my_class(int i = 0) : int_(i) {}
+
+   int int_;
+};
+
+struct key_of_my_class
+{
+   typedef int type;
+   const int &operator()(const my_class &v) const {  return v.int_;  }
+};
+
+typedef set<my_class, key_of_value<key_of_my_class> > my_class_set;
+
+//A snapshot that copies the keys into its array
+typedef frozen_set<my_class_set, true> frozen_t;
+
+int main()
+{
+   std::vector<my_class> values;
+   for(int i = 0; i < 100; ++i)  values.push_back(my_class(i*2));
+
+   my_class_set s(values.begin(), values.end());
+
+   //The user provides the array of the snapshot
+   std::vector<frozen_t::entry_type> entries(s.size());
+   frozen_t f(s, entries.data(), entries.size());
+
+   //Lookups return iterators of the set
+   my_class_set::iterator it = f.lower_bound(51);
+   assert(it != s.end() && it->int_ == 52);
+   assert(f.find(51) == s.end());
+   assert(++f.find(52) == s.find(54));
+
+   //Replace an element: the snapshot only rewrites one position
+   my_class replacement(52);
+   s.replace_node(s.iterator_to(values[26]), replacement);
+   assert(f.refresh() == 1u);
+   assert(&*f.find(52) == &replacement);
+
+   //Erasing elements changes the size: the snapshot is rebuilt
+   s.erase(0);
+   f.refresh();
+   assert(f.lower_bound(0)->int_ == 2);
+   s.clear();
+   return 0;
+}
+//]
@@ -0,0 +1,77 @@
+/////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright agent 2026
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/intrusive for documentation.
+//
+/////////////////////////////////////////////////////////////////////////////
+//[doc_relocate
+#include <boost/intrusive/set.hpp>
+#include <vector>
+#include <cassert>
+
+using namespace boost::intrusive;
+
+//A class that can be inserted in an intrusive set
+class my_class : public set_base_hook<>
+{
+   public:
+   explicit my_class(int i = 0) : int_(i) {}
+
+   friend bool operator<(const my_class &a, const my_class &b)
+   {  return a.int_ < b.int_;   }
+
+   int int_;
+};
+
+typedef set<my_class> my_class_set;
+
+//Moves each visited element to the next free position of a preallocated arena
+struct arena_relocator
+{
+   explicit arena_relocator(std::vector<my_class> &arena) : arena_(arena) {}
+
+   my_class *operator()(my_class &old)
+   {
+      arena_.push_back(old);
+      return &arena_.back();
+   }
+
+   std::vector<my_class> &arena_;
+};
+
+//Frees the old storage of relocated elements
+struct delete_disposer
+{
+   void operator()(my_class *delete_this)
+   {  delete delete_this;  }
+};
+
+int main()
+{
+   const int MaxElem = 100;
+   my_class_set s;
+
+   //Elements allocated one by one and inserted in any order
+   for(int i = 0; i < MaxElem; ++i)
+      s.insert(*new my_class((i*37) % MaxElem));
+
+   //Compact all the elements in a single block, in order
+   std::vector<my_class> arena;
+   arena.reserve(MaxElem);
+   s.relocate(arena_relocator(arena), delete_disposer());
+
+   //Now an in-order traversal visits consecutive memory positions
+   std::size_t pos = 0;
+   for(my_class_set::iterator it(s.begin()), itend(s.end()); it != itend; ++it, ++pos)
+      assert(&*it == &arena[pos]);
+
+   //The set must be emptied before the arena is destroyed
+   s.clear();
+   return 0;
+}
+//]
@@ -0,0 +1,80 @@
+/////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright agent 2026
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/intrusive for documentation.
+//
+/////////////////////////////////////////////////////////////////////////////
+//[doc_xor_list_code
+#include <boost/intrusive/xor_list.hpp>
+#include <boost/intrusive/list_hook.hpp>
+#include <vector>
+#include <cassert>
+
+using namespace boost::intrusive;
+
+class MyClass : public xor_list_base_hook<>
+{
+   int int_;
+
+   public:
+   //This is a member hook
+   xor_list_member_hook<> member_hook_;
+
+   MyClass(int i)
+      :  int_(i)
+      {}
+   int get() const
+      {  return int_;  }
+};
+
+//Define a xor_list using the base hook
+typedef xor_list<MyClass>  BaseList;
+
+//Define a xor_list using the member hook
+typedef member_hook<MyClass, xor_list_member_hook<>, &MyClass::member_hook_> MemberOption;
+typedef xor_list<MyClass, MemberOption> MemberList;
+
+int main()
+{
+   typedef std::vector<MyClass>::iterator VectIt;
+
+   //Create several MyClass objects, each one with a different value
+   std::vector<MyClass> values;
+   for(int i = 0; i < 100; ++i)  values.push_back(MyClass(i));
+
+   //Hooks store a single link field: half the size of list hooks
+   assert(sizeof(xor_list_base_hook<>) == sizeof(void*));
+   assert(sizeof(xor_list_base_hook<>) < sizeof(list_base_hook<>));
+
+   BaseList baselist, baselist2;
+   MemberList memberlist;
+
+   //Insert objects at both ends
+   for(VectIt it(values.begin()), itend(values.end()); it != itend; ++it){
+      baselist.push_front(*it);
+      memberlist.push_back(*it);
+   }
+
+   //Lists can be traversed from either end
+   {
+      BaseList::reverse_iterator rbit(baselist.rbegin());
+      MemberList::iterator mit(memberlist.begin());
+      VectIt it(values.begin()), itend(values.end());
+
+      for(; it != itend; ++it, ++rbit, ++mit)
+         if(&*rbit != &*it || &*mit != &*it)   return 1;
+   }
+
+   //Reversing and splicing whole lists are constant-time operations
+   baselist.reverse();
+   baselist2.splice(baselist2.end(), baselist);
+   if(!baselist.empty() || &baselist2.front() != &values.front())
+      return 1;
+   return 0;
+}
+//]
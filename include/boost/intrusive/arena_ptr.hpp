@@ -0,0 +1,350 @@
+/////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright agent 2026
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/intrusive for documentation.
+//
+/////////////////////////////////////////////////////////////////////////////
+
+#ifndef BOOST_INTRUSIVE_ARENA_PTR_HPP
+#define BOOST_INTRUSIVE_ARENA_PTR_HPP
+
+#include <boost/intrusive/detail/config_begin.hpp>
+#include <boost/intrusive/intrusive_fwd.hpp>
+#include <boost/intrusive/detail/mpl.hpp>
+#include <boost/intrusive/detail/assert.hpp>
+#include <boost/intrusive/detail/array_initializer.hpp> //max_align
+#include <boost/intrusive/pointer_plus_bits.hpp>
+#include <boost/move/adl_move_swap.hpp>
+#include <boost/cstdint.hpp>  //boost::uint32_t
+
+#if defined(BOOST_HAS_PRAGMA_ONCE)
+#  pragma once
+#endif
+
+namespace boost {
+namespace intrusive {
+
+/// @cond
+
+namespace detail {
+
+template<class Tag>
+struct arena_ptr_base_holder
+{
+   //Registered base minus arena_ptr's null gap, so that
+   //decoding a pointer is a single addition
+   static uintptr_t biased_base;
+};
+
+template<class Tag>
+uintptr_t arena_ptr_base_holder<Tag>::biased_base = 0u;
+
+}  //namespace detail {
+
+/// @endcond
+
+//! arena_ptr is a 32 bit pointer that can be used as \c void_pointer<> in
+//! [*Boost.Intrusive] hooks to halve the size of the hooks on 64 bit systems.
+//!
+//! An arena_ptr stores the distance in bytes between the pointed object and
+//! a base address shared by all arena pointers with the same \c Tag. The base
+//! is registered with \c set_arena_base and every object that is addressed through
+//! an arena_ptr (values, nodes and also containers, as headers are nodes, and
+//! bucket arrays) must be placed in the 4GiB window that starts at that base.
+//!
+//! The stored offset is biased by the maximum fundamental alignment, so a zero offset
+//! represents a null pointer and the lower bits of the offset are free to embed
+//! extra bits through \c pointer_plus_bits.
+//!
+//! Arena pointers are cheap to copy and compare (a single 32 bit integer) and
+//! can be dereferenced adding the offset to the base address.
+template<class T, class Tag>
+class arena_ptr
+{
+   /// @cond
+   typedef arena_ptr<T, Tag>                                   self_t;
+   typedef detail::arena_ptr_base_holder<Tag>                  holder_t;
+   typedef typename detail::remove_cv<T>::type                 unqualified_t;
+
+   void unspecified_bool_type_func() const {}
+   typedef void (self_t::*unspecified_bool_type)() const;
+   /// @endcond
+
+   public:
+   typedef T                                                   element_type;
+   typedef T *                                                 pointer;
+   typedef typename detail::unvoid_ref<T>::type                reference;
+   typedef std::ptrdiff_t                                      difference_type;
+   typedef boost::uint32_t                                     offset_type;
+
+   //! The distance in bytes between the registered base and an object
+   //! stored in offset 0: the alignment of fundamental types.
+   static const std::size_t null_gap = detail::alignment_of<detail::max_align>::value;
+
+   //! <b>Effects</b>: Registers the base address of the arena for all the arena pointers
+   //!   with the same \c Tag.
+   //!
+   //! <b>Requires</b>: base must be aligned to \c null_gap. No arena pointer
+   //!   with the same \c Tag can be alive when the base is changed.
+   //!
+   //! <b>Throws</b>: Nothing.
+   static void set_arena_base(const volatile void *base) BOOST_NOEXCEPT
+   {
+      BOOST_INTRUSIVE_INVARIANT_ASSERT(0 == (uintptr_t(base) & (null_gap - 1u)));
+      holder_t::biased_base = uintptr_t(base) - null_gap;
+   }
+
+   //! <b>Returns</b>: The base address registered for \c Tag.
+   //!
+   //! <b>Throws</b>: Nothing.
+   static void *arena_base() BOOST_NOEXCEPT
+   {  return reinterpret_cast<void*>(holder_t::biased_base + null_gap);  }
+
+   //! <b>Effects</b>: Constructs a null pointer.
+   //!
+   //! <b>Throws</b>: Nothing.
+   BOOST_INTRUSIVE_FORCEINLINE arena_ptr() BOOST_NOEXCEPT
+      :  m_off(0u)
+   {}
+
+   //! <b>Requires</b>: p is null or points to an object placed in the arena.
+   //!
+   //! <b>Effects</b>: Constructs a pointer to the object pointed by p.
+   //!
+   //! <b>Throws</b>: Nothing.
+   BOOST_INTRUSIVE_FORCEINLINE arena_ptr(T *p) BOOST_NOEXCEPT
+      :  m_off(self_t::encode(p))
+   {}
+
+   BOOST_INTRUSIVE_FORCEINLINE arena_ptr(const arena_ptr &other) BOOST_NOEXCEPT
+      :  m_off(other.m_off)
+   {}
+
+   //! <b>Effects</b>: Constructs a pointer from an arena pointer to a type
+   //!   convertible to T.
+   //!
+   //! <b>Throws</b>: Nothing.
+   template<class U>
+   BOOST_INTRUSIVE_FORCEINLINE arena_ptr( const arena_ptr<U, Tag> &other
+            , typename detail::enable_if_convertible<U*, T*>::type* = 0) BOOST_NOEXCEPT
+      :  m_off(self_t::convert_offset(other, detail::bool_<self_t::template is_same_address<U>::value>()))
+   {}
+
+   BOOST_INTRUSIVE_FORCEINLINE arena_ptr& operator=(const arena_ptr &other) BOOST_NOEXCEPT
+   {  m_off = other.m_off;  return *this;  }
+
+   template<class U>
+   BOOST_INTRUSIVE_FORCEINLINE typename detail::enable_if_convertible<U*, T*, arena_ptr&>::type
+      operator=(const arena_ptr<U, Tag> &other) BOOST_NOEXCEPT
+   {
+      m_off = self_t::convert_offset(other, detail::bool_<self_t::template is_same_address<U>::value>());
+      return *this;
+   }
+
+   //! <b>Returns</b>: A pointer to r.
+   //!
+   //! <b>Throws</b>: Nothing.
+   BOOST_INTRUSIVE_FORCEINLINE static arena_ptr pointer_to(reference r) BOOST_NOEXCEPT
+   {  return from_offset(self_t::encode_non_null(&r));  }
+
+   template<class U>
+   BOOST_INTRUSIVE_FORCEINLINE static arena_ptr static_cast_from(const arena_ptr<U, Tag> &uptr) BOOST_NOEXCEPT
+   {
+      const bool same_address = is_same_address<U>::value
+         || detail::is_same<typename detail::remove_cv<U>::type, void>::value;
+      return priv_static_cast_from(uptr, detail::bool_<same_address>());
+   }
+
+   template<class U>
+   BOOST_INTRUSIVE_FORCEINLINE static arena_ptr const_cast_from(const arena_ptr<U, Tag> &uptr) BOOST_NOEXCEPT
+   {  return from_offset(uptr.get_offset());  }
+
+   template<class U>
+   static arena_ptr dynamic_cast_from(const arena_ptr<U, Tag> &uptr) BOOST_NOEXCEPT
+   {  return arena_ptr(dynamic_cast<T*>(uptr.get()));  }
+
+   //! <b>Returns</b>: A pointer whose stored offset is off.
+   //!
+   //! <b>Throws</b>: Nothing.
+   BOOST_INTRUSIVE_FORCEINLINE static arena_ptr from_offset(offset_type off) BOOST_NOEXCEPT
+   {  arena_ptr p;  p.m_off = off;  return p;  }
+
+   //! <b>Returns</b>: The stored (biased) offset. Zero for a null pointer.
+   //!
+   //! <b>Throws</b>: Nothing.
+   BOOST_INTRUSIVE_FORCEINLINE offset_type get_offset() const BOOST_NOEXCEPT
+   {  return m_off;  }
+
+   //! <b>Effects</b>: Sets the stored (biased) offset.
+   //!
+   //! <b>Throws</b>: Nothing.
+   BOOST_INTRUSIVE_FORCEINLINE void set_offset(offset_type off) BOOST_NOEXCEPT
+   {  m_off = off;  }
+
+   //! <b>Returns</b>: The raw pointer, null if this is a null pointer.
+   //!
+   //! <b>Throws</b>: Nothing.
+   BOOST_INTRUSIVE_FORCEINLINE pointer get() const BOOST_NOEXCEPT
+   {  return m_off ? this->operator->() : pointer();  }
+
+   //! <b>Requires</b>: this is not a null pointer.
+   //!
+   //! <b>Returns</b>: The raw pointer.
+   //!
+   //! <b>Throws</b>: Nothing.
+   BOOST_INTRUSIVE_FORCEINLINE pointer operator->() const BOOST_NOEXCEPT
+   {  return reinterpret_cast<pointer>(holder_t::biased_base + m_off);  }
+
+   BOOST_INTRUSIVE_FORCEINLINE reference operator*() const BOOST_NOEXCEPT
+   {  return *this->operator->();  }
+
+   BOOST_INTRUSIVE_FORCEINLINE reference operator[](std::ptrdiff_t idx) const BOOST_NOEXCEPT
+   {  return this->operator->()[idx];  }
+
+   BOOST_INTRUSIVE_FORCEINLINE arena_ptr operator+(std::ptrdiff_t n) const BOOST_NOEXCEPT
+   {  return from_offset(offset_type(m_off + offset_type(n*std::ptrdiff_t(sizeof(T)))));  }
+
+   BOOST_INTRUSIVE_FORCEINLINE arena_ptr operator-(std::ptrdiff_t n) const BOOST_NOEXCEPT
+   {  return from_offset(offset_type(m_off - offset_type(n*std::ptrdiff_t(sizeof(T)))));  }
+
+   BOOST_INTRUSIVE_FORCEINLINE arena_ptr &operator+=(std::ptrdiff_t n) BOOST_NOEXCEPT
+   {  m_off = offset_type(m_off + offset_type(n*std::ptrdiff_t(sizeof(T))));  return *this;  }
+
+   BOOST_INTRUSIVE_FORCEINLINE arena_ptr &operator-=(std::ptrdiff_t n) BOOST_NOEXCEPT
+   {  m_off = offset_type(m_off - offset_type(n*std::ptrdiff_t(sizeof(T))));  return *this;  }
+
+   BOOST_INTRUSIVE_FORCEINLINE arena_ptr& operator++() BOOST_NOEXCEPT
+   {  m_off = offset_type(m_off + sizeof(T));  return *this;  }
+
+   BOOST_INTRUSIVE_FORCEINLINE arena_ptr operator++(int) BOOST_NOEXCEPT
+   {  arena_ptr tmp(*this);  ++*this;  return tmp;  }
+
+   BOOST_INTRUSIVE_FORCEINLINE arena_ptr& operator--() BOOST_NOEXCEPT
+   {  m_off = offset_type(m_off - sizeof(T));  return *this;  }
+
+   BOOST_INTRUSIVE_FORCEINLINE arena_ptr operator--(int) BOOST_NOEXCEPT
+   {  arena_ptr tmp(*this);  --*this;  return tmp;  }
+
+   BOOST_INTRUSIVE_FORCEINLINE friend std::ptrdiff_t operator-(const arena_ptr &l, const arena_ptr &r) BOOST_NOEXCEPT
+   {  return l.operator->() - r.operator->();  }
+
+   BOOST_INTRUSIVE_FORCEINLINE operator unspecified_bool_type() const BOOST_NOEXCEPT
+   {  return m_off ? &self_t::unspecified_bool_type_func : 0;  }
+
+   BOOST_INTRUSIVE_FORCEINLINE bool operator!() const BOOST_NOEXCEPT
+   {  return !m_off;  }
+
+   //The arena is contiguous so offsets preserve the order of addresses
+   BOOST_INTRUSIVE_FORCEINLINE friend bool operator==(const arena_ptr &l, const arena_ptr &r) BOOST_NOEXCEPT
+   {  return l.m_off == r.m_off;  }
+
+   BOOST_INTRUSIVE_FORCEINLINE friend bool operator!=(const arena_ptr &l, const arena_ptr &r) BOOST_NOEXCEPT
+   {  return l.m_off != r.m_off;  }
+
+   BOOST_INTRUSIVE_FORCEINLINE friend bool operator<(const arena_ptr &l, const arena_ptr &r) BOOST_NOEXCEPT
+   {  return l.m_off < r.m_off;  }
+
+   BOOST_INTRUSIVE_FORCEINLINE friend bool operator<=(const arena_ptr &l, const arena_ptr &r) BOOST_NOEXCEPT
+   {  return l.m_off <= r.m_off;  }
+
+   BOOST_INTRUSIVE_FORCEINLINE friend bool operator>(const arena_ptr &l, const arena_ptr &r) BOOST_NOEXCEPT
+   {  return l.m_off > r.m_off;  }
+
+   BOOST_INTRUSIVE_FORCEINLINE friend bool operator>=(const arena_ptr &l, const arena_ptr &r) BOOST_NOEXCEPT
+   {  return l.m_off >= r.m_off;  }
+
+   BOOST_INTRUSIVE_FORCEINLINE friend void swap(arena_ptr &l, arena_ptr &r) BOOST_NOEXCEPT
+   {  ::boost::adl_move_swap(l.m_off, r.m_off);  }
+
+   /// @cond
+   private:
+   template<class, class> friend class arena_ptr;
+
+   //Conversions between these types never adjust the address
+   template<class U>
+   struct is_same_address
+   {
+      static const bool value =
+         detail::is_same<typename detail::remove_cv<U>::type, unqualified_t>::value ||
+         detail::is_same<unqualified_t, void>::value;
+   };
+
+   BOOST_INTRUSIVE_FORCEINLINE static offset_type encode(T *p) BOOST_NOEXCEPT
+   {  return p ? encode_non_null(p) : offset_type(0u);  }
+
+   BOOST_INTRUSIVE_FORCEINLINE static offset_type encode_non_null(T *p) BOOST_NOEXCEPT
+   {
+      const uintptr_t off = uintptr_t(p) - holder_t::biased_base;
+      //The object must be placed in the arena
+      BOOST_INTRUSIVE_INVARIANT_ASSERT(off >= null_gap && off <= uintptr_t(offset_type(-1)));
+      return offset_type(off);
+   }
+
+   template<class U>
+   BOOST_INTRUSIVE_FORCEINLINE static offset_type convert_offset(const arena_ptr<U, Tag> &other, detail::true_) BOOST_NOEXCEPT
+   {  return other.m_off;  }
+
+   template<class U>
+   BOOST_INTRUSIVE_FORCEINLINE static offset_type convert_offset(const arena_ptr<U, Tag> &other, detail::false_) BOOST_NOEXCEPT
+   {  return encode(other.get());  }
+
+   template<class U>
+   BOOST_INTRUSIVE_FORCEINLINE static arena_ptr priv_static_cast_from(const arena_ptr<U, Tag> &uptr, detail::true_) BOOST_NOEXCEPT
+   {  return from_offset(uptr.m_off);  }
+
+   template<class U>
+   BOOST_INTRUSIVE_FORCEINLINE static arena_ptr priv_static_cast_from(const arena_ptr<U, Tag> &uptr, detail::false_) BOOST_NOEXCEPT
+   {  return arena_ptr(static_cast<T*>(uptr.get()));  }
+
+   offset_type m_off;
+   /// @endcond
+};
+
+//!This is a specialization for arena pointers. The offset keeps
+//!the alignment of the pointed objects, up to the alignment of the base.
+template<class Tag, std::size_t Alignment>
+struct max_pointer_plus_bits<arena_ptr<void, Tag>, Alignment>
+{
+   static const std::size_t value = detail::ls_zeros
+      < (Alignment < arena_ptr<void, Tag>::null_gap ? Alignment : arena_ptr<void, Tag>::null_gap) >::value;
+};
+
+//!This is the specialization to embed extra bits of information
+//!in an arena pointer. The extra bits are stored in the lower bits of the offset.
+template<class T, class Tag, std::size_t NumBits>
+struct pointer_plus_bits<arena_ptr<T, Tag>, NumBits>
+{
+   typedef arena_ptr<T, Tag>                    pointer;
+   typedef typename pointer::offset_type        offset_type;
+   static const offset_type Mask = offset_type((offset_type(1u) << NumBits) - 1u);
+
+   BOOST_INTRUSIVE_FORCEINLINE static pointer get_pointer(const pointer &n) BOOST_NOEXCEPT
+   {  return pointer::from_offset(offset_type(n.get_offset() & offset_type(~Mask)));  }
+
+   BOOST_INTRUSIVE_FORCEINLINE static void set_pointer(pointer &n, const pointer &p) BOOST_NOEXCEPT
+   {
+      BOOST_INTRUSIVE_INVARIANT_ASSERT(0 == (p.get_offset() & Mask));
+      n.set_offset(offset_type(p.get_offset() | (n.get_offset() & Mask)));
+   }
+
+   BOOST_INTRUSIVE_FORCEINLINE static std::size_t get_bits(const pointer &n) BOOST_NOEXCEPT
+   {  return std::size_t(n.get_offset() & Mask);  }
+
+   BOOST_INTRUSIVE_FORCEINLINE static void set_bits(pointer &n, std::size_t c) BOOST_NOEXCEPT
+   {
+      BOOST_INTRUSIVE_INVARIANT_ASSERT(c <= Mask);
+      n.set_offset(offset_type((n.get_offset() & offset_type(~Mask)) | offset_type(c)));
+   }
+};
+
+} //namespace intrusive
+} //namespace boost
+
+#include <boost/intrusive/detail/config_end.hpp>
+
+#endif //BOOST_INTRUSIVE_ARENA_PTR_HPP
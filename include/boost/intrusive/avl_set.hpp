@@ -194,6 +194,10 @@ class avl_set_impl
    template <class Cloner, class Disposer>
    void clone_from(const avl_set_impl &src, Cloner cloner, Disposer disposer);
 
+   //! @copydoc ::boost::intrusive::avltree::clone_from(const avltree&,Cloner,Disposer,Executor)
+   template <class Cloner, class Disposer, class Executor>
+   void clone_from(const avl_set_impl &src, Cloner cloner, Disposer disposer, Executor executor);
+
    #else
 
    using tree_type::clone_from;
@@ -292,6 +296,18 @@ class avl_set_impl
    template<class Disposer>
    void clear_and_dispose(Disposer disposer) BOOST_NOEXCEPT;
 
+   //! @copydoc ::boost::intrusive::avltree::clear_and_dispose_some
+   template<class Disposer>
+   bool clear_and_dispose_some(Disposer disposer, size_type max_nodes) BOOST_NOEXCEPT;
+
+   //! @copydoc ::boost::intrusive::avltree::partition(size_type,OutputIterator)
+   template<class OutputIterator>
+   OutputIterator partition(size_type k, OutputIterator out);
+
+   //! @copydoc ::boost::intrusive::avltree::partition(size_type,OutputIterator)const
+   template<class OutputIterator>
+   OutputIterator partition(size_type k, OutputIterator out) const;
+
    #endif   //   #ifdef BOOST_INTRUSIVE_DOXYGEN_INVOKED
 
    //! @copydoc ::boost::intrusive::avltree::count(const key_type &)const
@@ -319,6 +335,20 @@ class avl_set_impl
    template<class KeyType, class KeyTypeKeyCompare>
    const_iterator lower_bound(const KeyType& key, KeyTypeKeyCompare comp) const;
 
+   //! @copydoc ::boost::intrusive::avltree::lower_bound_from(const_iterator,const key_type &)
+   iterator lower_bound_from(const_iterator finger, const key_type &key);
+
+   //! @copydoc ::boost::intrusive::avltree::lower_bound_from(const_iterator,const key_type &)const
+   const_iterator lower_bound_from(const_iterator finger, const key_type &key) const;
+
+   //! @copydoc ::boost::intrusive::avltree::lower_bound_from(const_iterator,const KeyType&,KeyTypeKeyCompare)
+   template<class KeyType, class KeyTypeKeyCompare>
+   iterator lower_bound_from(const_iterator finger, const KeyType &key, KeyTypeKeyCompare comp);
+
+   //! @copydoc ::boost::intrusive::avltree::lower_bound_from(const_iterator,const KeyType&,KeyTypeKeyCompare)const
+   template<class KeyType, class KeyTypeKeyCompare>
+   const_iterator lower_bound_from(const_iterator finger, const KeyType &key, KeyTypeKeyCompare comp) const;
+
    //! @copydoc ::boost::intrusive::avltree::upper_bound(const key_type &)
    iterator upper_bound(const key_type &key);
 
@@ -410,6 +440,22 @@ class avl_set_impl
    //! @copydoc ::boost::intrusive::avltree::replace_node
    void replace_node(iterator replace_this, reference with_this) BOOST_NOEXCEPT;
 
+   //! @copydoc ::boost::intrusive::avltree::relocate(Relocator,Disposer)
+   template <class Relocator, class Disposer>
+   void relocate(Relocator relocator, Disposer disposer);
+
+   //! @copydoc ::boost::intrusive::avltree::relocate(Relocator)
+   template <class Relocator>
+   void relocate(Relocator relocator);
+
+   //! @copydoc ::boost::intrusive::avltree::erase_if(Pred)
+   template<class Pred>
+   size_type erase_if(Pred pred);
+
+   //! @copydoc ::boost::intrusive::avltree::erase_and_dispose_if(Pred,Disposer)
+   template<class Pred, class Disposer>
+   size_type erase_and_dispose_if(Pred pred, Disposer disposer);
+
    //! @copydoc ::boost::intrusive::avltree::remove_node
    void remove_node(reference value) BOOST_NOEXCEPT;
 
@@ -484,7 +530,9 @@ struct make_avl_set
          , typename packed_options::compare
          , typename packed_options::size_type
          , packed_options::constant_time_size
-         , typename packed_options::header_holder_type
+         , typename detail::get_epoch_header_holder
+            < packed_options::modification_epoch
+            , typename packed_options::header_holder_type>::type
          > implementation_defined;
    /// @endcond
    typedef implementation_defined type;
@@ -554,6 +602,10 @@ class avl_set
    inline void clone_from(BOOST_RV_REF(avl_set) src, Cloner cloner, Disposer disposer)
    {  Base::clone_from(BOOST_MOVE_BASE(Base, src), cloner, disposer);  }
 
+   template <class Cloner, class Disposer, class Executor>
+   inline void clone_from(const avl_set &src, Cloner cloner, Disposer disposer, Executor executor)
+   {  Base::clone_from(src, cloner, disposer, executor);  }
+
    BOOST_INTRUSIVE_NO_DANGLING
    inline static avl_set &container_from_end_iterator(iterator end_iterator) BOOST_NOEXCEPT
    {  return static_cast<avl_set &>(Base::container_from_end_iterator(end_iterator));   }
@@ -735,6 +787,10 @@ class avl_multiset_impl
    template <class Cloner, class Disposer>
    void clone_from(const avl_multiset_impl &src, Cloner cloner, Disposer disposer);
 
+   //! @copydoc ::boost::intrusive::avltree::clone_from(const avltree&,Cloner,Disposer,Executor)
+   template <class Cloner, class Disposer, class Executor>
+   void clone_from(const avl_multiset_impl &src, Cloner cloner, Disposer disposer, Executor executor);
+
    #else
 
    using tree_type::clone_from;
@@ -805,6 +861,18 @@ class avl_multiset_impl
    template<class Disposer>
    void clear_and_dispose(Disposer disposer) BOOST_NOEXCEPT;
 
+   //! @copydoc ::boost::intrusive::avltree::clear_and_dispose_some
+   template<class Disposer>
+   bool clear_and_dispose_some(Disposer disposer, size_type max_nodes) BOOST_NOEXCEPT;
+
+   //! @copydoc ::boost::intrusive::avltree::partition(size_type,OutputIterator)
+   template<class OutputIterator>
+   OutputIterator partition(size_type k, OutputIterator out);
+
+   //! @copydoc ::boost::intrusive::avltree::partition(size_type,OutputIterator)const
+   template<class OutputIterator>
+   OutputIterator partition(size_type k, OutputIterator out) const;
+
    //! @copydoc ::boost::intrusive::avltree::count(const key_type &)const
    size_type count(const key_type &key) const;
 
@@ -826,6 +894,20 @@ class avl_multiset_impl
    template<class KeyType, class KeyTypeKeyCompare>
    const_iterator lower_bound(const KeyType& key, KeyTypeKeyCompare comp) const;
 
+   //! @copydoc ::boost::intrusive::avltree::lower_bound_from(const_iterator,const key_type &)
+   iterator lower_bound_from(const_iterator finger, const key_type &key);
+
+   //! @copydoc ::boost::intrusive::avltree::lower_bound_from(const_iterator,const key_type &)const
+   const_iterator lower_bound_from(const_iterator finger, const key_type &key) const;
+
+   //! @copydoc ::boost::intrusive::avltree::lower_bound_from(const_iterator,const KeyType&,KeyTypeKeyCompare)
+   template<class KeyType, class KeyTypeKeyCompare>
+   iterator lower_bound_from(const_iterator finger, const KeyType &key, KeyTypeKeyCompare comp);
+
+   //! @copydoc ::boost::intrusive::avltree::lower_bound_from(const_iterator,const KeyType&,KeyTypeKeyCompare)const
+   template<class KeyType, class KeyTypeKeyCompare>
+   const_iterator lower_bound_from(const_iterator finger, const KeyType &key, KeyTypeKeyCompare comp) const;
+
    //! @copydoc ::boost::intrusive::avltree::upper_bound(const key_type &)
    iterator upper_bound(const key_type &key);
 
@@ -909,6 +991,22 @@ class avl_multiset_impl
    //! @copydoc ::boost::intrusive::avltree::replace_node
    void replace_node(iterator replace_this, reference with_this) BOOST_NOEXCEPT;
 
+   //! @copydoc ::boost::intrusive::avltree::relocate(Relocator,Disposer)
+   template <class Relocator, class Disposer>
+   void relocate(Relocator relocator, Disposer disposer);
+
+   //! @copydoc ::boost::intrusive::avltree::relocate(Relocator)
+   template <class Relocator>
+   void relocate(Relocator relocator);
+
+   //! @copydoc ::boost::intrusive::avltree::erase_if(Pred)
+   template<class Pred>
+   size_type erase_if(Pred pred);
+
+   //! @copydoc ::boost::intrusive::avltree::erase_and_dispose_if(Pred,Disposer)
+   template<class Pred, class Disposer>
+   size_type erase_and_dispose_if(Pred pred, Disposer disposer);
+
    //! @copydoc ::boost::intrusive::avltree::remove_node
    void remove_node(reference value) BOOST_NOEXCEPT;
 
@@ -982,7 +1080,9 @@ struct make_avl_multiset
          , typename packed_options::compare
          , typename packed_options::size_type
          , packed_options::constant_time_size
-         , typename packed_options::header_holder_type
+         , typename detail::get_epoch_header_holder
+            < packed_options::modification_epoch
+            , typename packed_options::header_holder_type>::type
          > implementation_defined;
    /// @endcond
    typedef implementation_defined type;
@@ -1053,6 +1153,10 @@ class avl_multiset
    inline void clone_from(BOOST_RV_REF(avl_multiset) src, Cloner cloner, Disposer disposer)
    {  Base::clone_from(BOOST_MOVE_BASE(Base, src), cloner, disposer);  }
 
+   template <class Cloner, class Disposer, class Executor>
+   inline void clone_from(const avl_multiset &src, Cloner cloner, Disposer disposer, Executor executor)
+   {  Base::clone_from(src, cloner, disposer, executor);  }
+
    BOOST_INTRUSIVE_NO_DANGLING
    inline static avl_multiset &container_from_end_iterator(iterator end_iterator) BOOST_NOEXCEPT
    {  return static_cast<avl_multiset &>(Base::container_from_end_iterator(end_iterator));   }
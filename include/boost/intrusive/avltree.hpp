@@ -227,6 +227,10 @@ class avltree_impl
    template <class Cloner, class Disposer>
    void clone_from(const avltree_impl &src, Cloner cloner, Disposer disposer);
 
+   //! @copydoc ::boost::intrusive::bstree::clone_from(const bstree&,Cloner,Disposer,Executor)
+   template <class Cloner, class Disposer, class Executor>
+   void clone_from(const avltree_impl &src, Cloner cloner, Disposer disposer, Executor executor);
+
    #else //BOOST_INTRUSIVE_DOXYGEN_INVOKED
 
    using tree_type::clone_from;
@@ -327,6 +331,18 @@ class avltree_impl
    template<class Disposer>
    void clear_and_dispose(Disposer disposer) BOOST_NOEXCEPT;
 
+   //! @copydoc ::boost::intrusive::bstree::clear_and_dispose_some
+   template<class Disposer>
+   bool clear_and_dispose_some(Disposer disposer, size_type max_nodes) BOOST_NOEXCEPT;
+
+   //! @copydoc ::boost::intrusive::bstree::partition(size_type,OutputIterator)
+   template<class OutputIterator>
+   OutputIterator partition(size_type k, OutputIterator out);
+
+   //! @copydoc ::boost::intrusive::bstree::partition(size_type,OutputIterator)const
+   template<class OutputIterator>
+   OutputIterator partition(size_type k, OutputIterator out) const;
+
    //! @copydoc ::boost::intrusive::bstree::count(const key_type &ke)const
    size_type count(const key_type &key) const;
 
@@ -348,6 +364,20 @@ class avltree_impl
    template<class KeyType, class KeyTypeKeyCompare>
    const_iterator lower_bound(const KeyType& key, KeyTypeKeyCompare comp) const;
 
+   //! @copydoc ::boost::intrusive::bstree::lower_bound_from(const_iterator,const key_type &)
+   iterator lower_bound_from(const_iterator finger, const key_type &key);
+
+   //! @copydoc ::boost::intrusive::bstree::lower_bound_from(const_iterator,const key_type &)const
+   const_iterator lower_bound_from(const_iterator finger, const key_type &key) const;
+
+   //! @copydoc ::boost::intrusive::bstree::lower_bound_from(const_iterator,const KeyType&,KeyTypeKeyCompare)
+   template<class KeyType, class KeyTypeKeyCompare>
+   iterator lower_bound_from(const_iterator finger, const KeyType &key, KeyTypeKeyCompare comp);
+
+   //! @copydoc ::boost::intrusive::bstree::lower_bound_from(const_iterator,const KeyType&,KeyTypeKeyCompare)const
+   template<class KeyType, class KeyTypeKeyCompare>
+   const_iterator lower_bound_from(const_iterator finger, const KeyType &key, KeyTypeKeyCompare comp) const;
+
    //! @copydoc ::boost::intrusive::bstree::upper_bound(const key_type &key)
    iterator upper_bound(const key_type &key);
 
@@ -431,6 +461,22 @@ class avltree_impl
    //! @copydoc ::boost::intrusive::bstree::replace_node
    void replace_node(iterator replace_this, reference with_this) BOOST_NOEXCEPT;
 
+   //! @copydoc ::boost::intrusive::bstree::relocate(Relocator,Disposer)
+   template <class Relocator, class Disposer>
+   void relocate(Relocator relocator, Disposer disposer);
+
+   //! @copydoc ::boost::intrusive::bstree::relocate(Relocator)
+   template <class Relocator>
+   void relocate(Relocator relocator);
+
+   //! @copydoc ::boost::intrusive::bstree::erase_if(Pred)
+   template<class Pred>
+   size_type erase_if(Pred pred);
+
+   //! @copydoc ::boost::intrusive::bstree::erase_and_dispose_if(Pred,Disposer)
+   template<class Pred, class Disposer>
+   size_type erase_and_dispose_if(Pred pred, Disposer disposer);
+
    //! @copydoc ::boost::intrusive::bstree::remove_node
    void remove_node(reference value) BOOST_NOEXCEPT;
 
@@ -489,7 +535,9 @@ struct make_avltree
          , typename packed_options::compare
          , typename packed_options::size_type
          , packed_options::constant_time_size
-         , typename packed_options::header_holder_type
+         , typename detail::get_epoch_header_holder
+            < packed_options::modification_epoch
+            , typename packed_options::header_holder_type>::type
          > implementation_defined;
    /// @endcond
    typedef implementation_defined type;
@@ -563,6 +611,10 @@ class avltree
    inline void clone_from(BOOST_RV_REF(avltree) src, Cloner cloner, Disposer disposer)
    {  Base::clone_from(BOOST_MOVE_BASE(Base, src), cloner, disposer);  }
 
+   template <class Cloner, class Disposer, class Executor>
+   inline void clone_from(const avltree &src, Cloner cloner, Disposer disposer, Executor executor)
+   {  Base::clone_from(src, cloner, disposer, executor);  }
+
    BOOST_INTRUSIVE_NO_DANGLING
    inline static avltree &container_from_end_iterator(iterator end_iterator) BOOST_NOEXCEPT
    {  return static_cast<avltree &>(Base::container_from_end_iterator(end_iterator));   }
@@ -273,6 +273,34 @@ class avltree_algorithms
       return z;
    }
 
+   //! <b>Requires</b>: header must be the header of a tree, [b, e) a range of nodes of
+   //!   that tree and "disposer" an object function taking a node_ptr parameter that
+   //!   shouldn't throw.
+   //!
+   //! <b>Effects</b>: Splits the tree before b and before e and joins the nodes placed
+   //!   before b with e and the nodes placed after e, detaching [b, e) from the tree as a
+   //!   subtree. Then calls <tt>void disposer::operator()(node_ptr)</tt> for every
+   //!   node of the detached range.
+   //!
+   //! <b>Returns</b>: The number of erased nodes.
+   //!
+   //! <b>Complexity</b>: Logarithmic to the size of the tree plus linear to the number
+   //!   of erased nodes. The tree is rebalanced by the joins of the split, instead of
+   //!   once per erased node.
+   //!
+   //! <b>Throws</b>: Nothing.
+   template<class Disposer>
+   static std::size_t erase_range_and_dispose(node_ptr header, node_ptr b, node_ptr e, Disposer disposer) BOOST_NOEXCEPT
+   {
+      avltree_joiner j;
+      return bstree_algo::erase_range_and_dispose(header, b, e, j, disposer);
+   }
+
+   //! @copydoc ::boost::intrusive::bstree_algorithms::erase_if_and_dispose(node_ptr,NodePred,Disposer)
+   template<class NodePred, class Disposer>
+   static std::size_t erase_if_and_dispose(node_ptr header, NodePred pred, Disposer disposer)
+   {  return bstree_algo::erase_if_and_dispose(header, pred, disposer, avltree_rebuilder());  }
+
    //! @copydoc ::boost::intrusive::bstree_algorithms::transfer_unique
    template<class NodePtrCompare>
    static bool transfer_unique
@@ -307,6 +335,16 @@ class avltree_algorithms
       bstree_algo::clone(source_header, target_header, new_cloner, disposer);
    }
 
+   //! @copydoc ::boost::intrusive::bstree_algorithms::clone(const_node_ptr,node_ptr,Cloner,Disposer,Executor,std::size_t)
+   template <class Cloner, class Disposer, class Executor>
+   static void clone
+      ( const_node_ptr source_header, node_ptr target_header, Cloner cloner, Disposer disposer
+      , Executor executor, std::size_t fork_levels)
+   {
+      avltree_node_cloner<NodeTraits, Cloner> new_cloner(cloner);
+      bstree_algo::clone(source_header, target_header, new_cloner, disposer, executor, fork_levels);
+   }
+
    #ifdef BOOST_INTRUSIVE_DOXYGEN_INVOKED
    //! @copydoc ::boost::intrusive::bstree_algorithms::clear_and_dispose(node_ptr,Disposer)
    template<class Disposer>
@@ -605,6 +643,133 @@ class avltree_algorithms
       }
    }
 
+   //x is the root of a subtree whose height has grown by one: updates the balance factors
+   //of its ancestors and rotates them when needed. Unlike in an insertion, the balance of x can
+   //be zero, so a single rotation does not stop the growth. Returns true if the tree has grown.
+   static bool rebalance_after_growth(node_ptr header, node_ptr x) BOOST_NOEXCEPT
+   {
+      for(node_ptr root = NodeTraits::get_parent(header); x != root; root = NodeTraits::get_parent(header)){
+         const node_ptr x_parent(NodeTraits::get_parent(x));
+         const bool x_is_leftchild(x == NodeTraits::get_left(x_parent));
+         const balance x_side = x_is_leftchild ? NodeTraits::negative() : NodeTraits::positive();
+         const balance x_parent_balance = NodeTraits::get_balance(x_parent);
+         if(x_parent_balance == NodeTraits::zero()){
+            NodeTraits::set_balance(x_parent, x_side);
+            x = x_parent;
+         }
+         else if(x_parent_balance != x_side){
+            NodeTraits::set_balance(x_parent, NodeTraits::zero());
+            return false;
+         }
+         else{
+            const balance x_balance = NodeTraits::get_balance(x);
+            if(x_balance != x_side && x_balance != NodeTraits::zero()){
+               if(x_is_leftchild)
+                  avl_rotate_left_right(x_parent, x, header);
+               else
+                  avl_rotate_right_left(x_parent, x, header);
+               return false;
+            }
+            if(x_is_leftchild)
+               avl_rotate_right(x_parent, x, header);
+            else
+               avl_rotate_left(x_parent, x, header);
+            //x is now the root of the subtree, which only grows if x was balanced
+            if(x_balance == x_side)
+               return false;
+         }
+      }
+      return true;
+   }
+
+   //Erases nodes and sets the balance factors of rebuilt trees
+   struct avltree_rebuilder
+   {
+      static void erase(node_ptr header, node_ptr z)
+      {  avltree_algorithms::erase(header, z);  }
+
+      static void rebuilt(node_ptr root, std::size_t)
+      {  balance_subtree(root);  }
+
+      //Returns the height of the subtree
+      static std::size_t balance_subtree(node_ptr n)
+      {
+         if(!n)
+            return 0u;
+         const std::size_t hl = balance_subtree(NodeTraits::get_left(n));
+         const std::size_t hr = balance_subtree(NodeTraits::get_right(n));
+         NodeTraits::set_balance
+            (n, hl < hr ? NodeTraits::positive() : hr < hl ? NodeTraits::negative() : NodeTraits::zero());
+         return (hl < hr ? hr : hl) + 1u;
+      }
+   };
+
+   //Joins avl subtrees, heights count the nodes of the longest path from the root
+   struct avltree_joiner
+   {
+      static std::size_t height(node_ptr n)
+      {
+         std::size_t h = 0u;
+         for(; n; ++h)
+            n = NodeTraits::get_balance(n) == NodeTraits::positive() ? NodeTraits::get_right(n) : NodeTraits::get_left(n);
+         return h;
+      }
+
+      static std::size_t child_height(node_ptr p, std::size_t hp, bool left)
+      {
+         const balance other_side = left ? NodeTraits::positive() : NodeTraits::negative();
+         return hp - (NodeTraits::get_balance(p) == other_side ? 2u : 1u);
+      }
+
+      static std::size_t parent_height(node_ptr p, std::size_t hc, bool c_is_left)
+      {
+         const balance other_side = c_is_left ? NodeTraits::positive() : NodeTraits::negative();
+         return hc + (NodeTraits::get_balance(p) == other_side ? 2u : 1u);
+      }
+
+      static void make_root(node_ptr)
+      {}
+
+      static node_ptr join(node_ptr header, node_ptr l, std::size_t hl, node_ptr x, node_ptr r, std::size_t hr, std::size_t &h)
+      {
+         if(hl <= hr + 1u && hr <= hl + 1u){
+            bstree_algo::link_children(x, l, r);
+            NodeTraits::set_balance
+               (x, hl < hr ? NodeTraits::positive() : hr < hl ? NodeTraits::negative() : NodeTraits::zero());
+            h = (hl < hr ? hr : hl) + 1u;
+            return x;
+         }
+         //Descend through the inner spine of the taller subtree until a node whose
+         //height differs at most by one from the shorter subtree is found, replace it
+         //with x and rebalance the ancestors of x, as the subtree has grown
+         const bool left_taller = hr < hl;
+         const node_ptr t(left_taller ? l : r);
+         const std::size_t hs = left_taller ? hr : hl;
+         const balance taller_side = left_taller ? NodeTraits::negative() : NodeTraits::positive();
+         std::size_t hc = left_taller ? hl : hr;
+         node_ptr p = node_ptr(), c(t);
+         while(hc > hs + 1u){
+            hc -= NodeTraits::get_balance(c) == taller_side ? 2u : 1u;
+            p = c;
+            c = left_taller ? NodeTraits::get_right(c) : NodeTraits::get_left(c);
+         }
+         if(left_taller){
+            bstree_algo::link_children(x, c, r);
+            NodeTraits::set_right(p, x);
+         }
+         else{
+            bstree_algo::link_children(x, l, c);
+            NodeTraits::set_left(p, x);
+         }
+         NodeTraits::set_balance(x, hc == hs ? NodeTraits::zero() : taller_side);
+         NodeTraits::set_parent(x, p);
+         NodeTraits::set_parent(header, t);
+         NodeTraits::set_parent(t, header);
+         h = (left_taller ? hl : hr) + std::size_t(rebalance_after_growth(header, x));
+         return NodeTraits::get_parent(header);
+      }
+   };
+
    static void left_right_balancing(node_ptr a, node_ptr b, node_ptr c) BOOST_NOEXCEPT
    {
       // balancing...
@@ -191,6 +191,10 @@ class bs_set_impl
    template <class Cloner, class Disposer>
    void clone_from(const bs_set_impl &src, Cloner cloner, Disposer disposer);
 
+   //! @copydoc ::boost::intrusive::bstree::clone_from(const bstree&,Cloner,Disposer,Executor)
+   template <class Cloner, class Disposer, class Executor>
+   void clone_from(const bs_set_impl &src, Cloner cloner, Disposer disposer, Executor executor);
+
    #else
 
    using tree_type::clone_from;
@@ -289,6 +293,18 @@ class bs_set_impl
    template<class Disposer>
    void clear_and_dispose(Disposer disposer) BOOST_NOEXCEPT;
 
+   //! @copydoc ::boost::intrusive::bstree::clear_and_dispose_some
+   template<class Disposer>
+   bool clear_and_dispose_some(Disposer disposer, size_type max_nodes) BOOST_NOEXCEPT;
+
+   //! @copydoc ::boost::intrusive::bstree::partition(size_type,OutputIterator)
+   template<class OutputIterator>
+   OutputIterator partition(size_type k, OutputIterator out);
+
+   //! @copydoc ::boost::intrusive::bstree::partition(size_type,OutputIterator)const
+   template<class OutputIterator>
+   OutputIterator partition(size_type k, OutputIterator out) const;
+
    #endif   //   #ifdef BOOST_INTRUSIVE_DOXYGEN_INVOKED
 
    //! @copydoc ::boost::intrusive::bstree::count(const key_type &)const
@@ -316,6 +332,20 @@ class bs_set_impl
    template<class KeyType, class KeyTypeKeyCompare>
    const_iterator lower_bound(const KeyType& key, KeyTypeKeyCompare comp) const;
 
+   //! @copydoc ::boost::intrusive::bstree::lower_bound_from(const_iterator,const key_type &)
+   iterator lower_bound_from(const_iterator finger, const key_type &key);
+
+   //! @copydoc ::boost::intrusive::bstree::lower_bound_from(const_iterator,const key_type &)const
+   const_iterator lower_bound_from(const_iterator finger, const key_type &key) const;
+
+   //! @copydoc ::boost::intrusive::bstree::lower_bound_from(const_iterator,const KeyType&,KeyTypeKeyCompare)
+   template<class KeyType, class KeyTypeKeyCompare>
+   iterator lower_bound_from(const_iterator finger, const KeyType &key, KeyTypeKeyCompare comp);
+
+   //! @copydoc ::boost::intrusive::bstree::lower_bound_from(const_iterator,const KeyType&,KeyTypeKeyCompare)const
+   template<class KeyType, class KeyTypeKeyCompare>
+   const_iterator lower_bound_from(const_iterator finger, const KeyType &key, KeyTypeKeyCompare comp) const;
+
    //! @copydoc ::boost::intrusive::bstree::upper_bound(const key_type &)
    iterator upper_bound(const key_type &key);
 
@@ -407,6 +437,22 @@ class bs_set_impl
    //! @copydoc ::boost::intrusive::bstree::replace_node
    void replace_node(iterator replace_this, reference with_this) BOOST_NOEXCEPT;
 
+   //! @copydoc ::boost::intrusive::bstree::relocate(Relocator,Disposer)
+   template <class Relocator, class Disposer>
+   void relocate(Relocator relocator, Disposer disposer);
+
+   //! @copydoc ::boost::intrusive::bstree::relocate(Relocator)
+   template <class Relocator>
+   void relocate(Relocator relocator);
+
+   //! @copydoc ::boost::intrusive::bstree::erase_if(Pred)
+   template<class Pred>
+   size_type erase_if(Pred pred);
+
+   //! @copydoc ::boost::intrusive::bstree::erase_and_dispose_if(Pred,Disposer)
+   template<class Pred, class Disposer>
+   size_type erase_and_dispose_if(Pred pred, Disposer disposer);
+
    //! @copydoc ::boost::intrusive::bstree::remove_node
    void remove_node(reference value) BOOST_NOEXCEPT;
 
@@ -481,7 +527,9 @@ struct make_bs_set
          , typename packed_options::compare
          , typename packed_options::size_type
          , packed_options::constant_time_size
-         , typename packed_options::header_holder_type
+         , typename detail::get_epoch_header_holder
+            < packed_options::modification_epoch
+            , typename packed_options::header_holder_type>::type
          > implementation_defined;
    /// @endcond
    typedef implementation_defined type;
@@ -551,6 +599,10 @@ class bs_set
    inline void clone_from(BOOST_RV_REF(bs_set) src, Cloner cloner, Disposer disposer)
    {  Base::clone_from(BOOST_MOVE_BASE(Base, src), cloner, disposer);  }
 
+   template <class Cloner, class Disposer, class Executor>
+   inline void clone_from(const bs_set &src, Cloner cloner, Disposer disposer, Executor executor)
+   {  Base::clone_from(src, cloner, disposer, executor);  }
+
    BOOST_INTRUSIVE_NO_DANGLING
    inline static bs_set &container_from_end_iterator(iterator end_iterator) BOOST_NOEXCEPT
    {  return static_cast<bs_set &>(Base::container_from_end_iterator(end_iterator));   }
@@ -731,6 +783,10 @@ class bs_multiset_impl
    template <class Cloner, class Disposer>
    void clone_from(const bs_multiset_impl &src, Cloner cloner, Disposer disposer);
 
+   //! @copydoc ::boost::intrusive::bstree::clone_from(const bstree&,Cloner,Disposer,Executor)
+   template <class Cloner, class Disposer, class Executor>
+   void clone_from(const bs_multiset_impl &src, Cloner cloner, Disposer disposer, Executor executor);
+
    #else
 
    using tree_type::clone_from;
@@ -801,6 +857,18 @@ class bs_multiset_impl
    template<class Disposer>
    void clear_and_dispose(Disposer disposer) BOOST_NOEXCEPT;
 
+   //! @copydoc ::boost::intrusive::bstree::clear_and_dispose_some
+   template<class Disposer>
+   bool clear_and_dispose_some(Disposer disposer, size_type max_nodes) BOOST_NOEXCEPT;
+
+   //! @copydoc ::boost::intrusive::bstree::partition(size_type,OutputIterator)
+   template<class OutputIterator>
+   OutputIterator partition(size_type k, OutputIterator out);
+
+   //! @copydoc ::boost::intrusive::bstree::partition(size_type,OutputIterator)const
+   template<class OutputIterator>
+   OutputIterator partition(size_type k, OutputIterator out) const;
+
    //! @copydoc ::boost::intrusive::bstree::count(const key_type &)const
    size_type count(const key_type &key) const;
 
@@ -822,6 +890,20 @@ class bs_multiset_impl
    template<class KeyType, class KeyTypeKeyCompare>
    const_iterator lower_bound(const KeyType& key, KeyTypeKeyCompare comp) const;
 
+   //! @copydoc ::boost::intrusive::bstree::lower_bound_from(const_iterator,const key_type &)
+   iterator lower_bound_from(const_iterator finger, const key_type &key);
+
+   //! @copydoc ::boost::intrusive::bstree::lower_bound_from(const_iterator,const key_type &)const
+   const_iterator lower_bound_from(const_iterator finger, const key_type &key) const;
+
+   //! @copydoc ::boost::intrusive::bstree::lower_bound_from(const_iterator,const KeyType&,KeyTypeKeyCompare)
+   template<class KeyType, class KeyTypeKeyCompare>
+   iterator lower_bound_from(const_iterator finger, const KeyType &key, KeyTypeKeyCompare comp);
+
+   //! @copydoc ::boost::intrusive::bstree::lower_bound_from(const_iterator,const KeyType&,KeyTypeKeyCompare)const
+   template<class KeyType, class KeyTypeKeyCompare>
+   const_iterator lower_bound_from(const_iterator finger, const KeyType &key, KeyTypeKeyCompare comp) const;
+
    //! @copydoc ::boost::intrusive::bstree::upper_bound(const key_type &)
    iterator upper_bound(const key_type &key);
 
@@ -905,6 +987,22 @@ class bs_multiset_impl
    //! @copydoc ::boost::intrusive::bstree::replace_node
    void replace_node(iterator replace_this, reference with_this) BOOST_NOEXCEPT;
 
+   //! @copydoc ::boost::intrusive::bstree::relocate(Relocator,Disposer)
+   template <class Relocator, class Disposer>
+   void relocate(Relocator relocator, Disposer disposer);
+
+   //! @copydoc ::boost::intrusive::bstree::relocate(Relocator)
+   template <class Relocator>
+   void relocate(Relocator relocator);
+
+   //! @copydoc ::boost::intrusive::bstree::erase_if(Pred)
+   template<class Pred>
+   size_type erase_if(Pred pred);
+
+   //! @copydoc ::boost::intrusive::bstree::erase_and_dispose_if(Pred,Disposer)
+   template<class Pred, class Disposer>
+   size_type erase_and_dispose_if(Pred pred, Disposer disposer);
+
    //! @copydoc ::boost::intrusive::bstree::remove_node
    void remove_node(reference value) BOOST_NOEXCEPT;
 
@@ -978,7 +1076,9 @@ struct make_bs_multiset
          , typename packed_options::compare
          , typename packed_options::size_type
          , packed_options::constant_time_size
-         , typename packed_options::header_holder_type
+         , typename detail::get_epoch_header_holder
+            < packed_options::modification_epoch
+            , typename packed_options::header_holder_type>::type
          > implementation_defined;
    /// @endcond
    typedef implementation_defined type;
@@ -1049,6 +1149,10 @@ class bs_multiset
    inline void clone_from(BOOST_RV_REF(bs_multiset) src, Cloner cloner, Disposer disposer)
    {  Base::clone_from(BOOST_MOVE_BASE(Base, src), cloner, disposer);  }
 
+   template <class Cloner, class Disposer, class Executor>
+   inline void clone_from(const bs_multiset &src, Cloner cloner, Disposer disposer, Executor executor)
+   {  Base::clone_from(src, cloner, disposer, executor);  }
+
    BOOST_INTRUSIVE_NO_DANGLING
    inline static bs_multiset &container_from_end_iterator(iterator end_iterator) BOOST_NOEXCEPT
    {  return static_cast<bs_multiset &>(Base::container_from_end_iterator(end_iterator));   }
@@ -73,6 +73,7 @@ struct bstree_defaults
    static const bool floating_point = true;  //For sgtree
    typedef void priority;  //For treap
    typedef void header_holder_type;
+   static const bool modification_epoch = false;
 };
 
 template<class ValueTraits, algo_types AlgoType, typename HeaderHolder>
@@ -101,16 +102,39 @@ struct bstbase3
    static const bool stateful_value_traits = detail::is_stateful_value_traits<value_traits>::value;
    static const bool has_container_from_iterator =
         detail::is_same< header_holder_type, detail::default_header_holder< node_traits > >::value;
+   static const bool modification_epoch = detail::has_modification_epoch<HeaderHolder>::value;
 
-   struct holder_t : public ValueTraits
+   template<bool ModificationEpoch, class Dummy = void>
+   struct holder_type : public ValueTraits
    {
-      inline explicit holder_t(const ValueTraits &vtraits)
+      inline BOOST_INTRUSIVE_CXX20_CONSTEXPR explicit holder_type(const ValueTraits &vtraits)
          : ValueTraits(vtraits)
       {}
+
+      inline BOOST_INTRUSIVE_CXX20_CONSTEXPR void increment_epoch()
+      {}
+
+      header_holder_type root;
+   };
+
+   template<class Dummy>
+   struct holder_type<true, Dummy> : public ValueTraits
+   {
+      inline BOOST_INTRUSIVE_CXX20_CONSTEXPR explicit holder_type(const ValueTraits &vtraits)
+         : ValueTraits(vtraits), epoch()
+      {}
+
+      inline BOOST_INTRUSIVE_CXX20_CONSTEXPR void increment_epoch()
+      {  ++epoch;  }
+
       header_holder_type root;
-   } holder;
+      std::size_t epoch;
+   };
 
-   static bstbase3 &get_tree_base_from_end_iterator(const const_iterator &end_iterator)
+   typedef holder_type<modification_epoch> holder_t;
+   holder_t holder;
+
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR static bstbase3 &get_tree_base_from_end_iterator(const const_iterator &end_iterator)
    {
       BOOST_INTRUSIVE_STATIC_ASSERT(has_container_from_iterator);
       node_ptr p = end_iterator.pointed_node();
@@ -120,77 +144,81 @@ struct bstbase3
       return *base;
    }
 
-   inline bstbase3(const ValueTraits &vtraits)
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR bstbase3(const ValueTraits &vtraits)
       : holder(vtraits)
    {
       node_algorithms::init_header(this->header_ptr());
    }
 
-   inline node_ptr header_ptr()
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR node_ptr header_ptr()
    { return holder.root.get_node(); }
 
-   inline const_node_ptr header_ptr() const
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR const_node_ptr header_ptr() const
    { return holder.root.get_node(); }
 
-   inline const value_traits &get_value_traits() const
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR const value_traits &get_value_traits() const
    {  return this->holder;  }
 
-   inline value_traits &get_value_traits()
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR value_traits &get_value_traits()
    {  return this->holder;  }
 
    typedef typename boost::intrusive::value_traits_pointers
       <ValueTraits>::const_value_traits_ptr const_value_traits_ptr;
 
-   inline const_value_traits_ptr priv_value_traits_ptr() const
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR const_value_traits_ptr priv_value_traits_ptr() const
    {  return pointer_traits<const_value_traits_ptr>::pointer_to(this->get_value_traits());  }
 
-   inline iterator begin() BOOST_NOEXCEPT
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR iterator begin() BOOST_NOEXCEPT
    {  return iterator(node_algorithms::begin_node(this->header_ptr()), this->priv_value_traits_ptr());   }
 
-   inline const_iterator begin() const BOOST_NOEXCEPT
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR const_iterator begin() const BOOST_NOEXCEPT
    {  return cbegin();   }
 
-   inline const_iterator cbegin() const BOOST_NOEXCEPT
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR const_iterator cbegin() const BOOST_NOEXCEPT
    {  return const_iterator(node_algorithms::begin_node(this->header_ptr()), this->priv_value_traits_ptr());   }
 
-   inline iterator end() BOOST_NOEXCEPT
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR iterator end() BOOST_NOEXCEPT
    {  return iterator(node_algorithms::end_node(this->header_ptr()), this->priv_value_traits_ptr());   }
 
-   inline const_iterator end() const BOOST_NOEXCEPT
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR const_iterator end() const BOOST_NOEXCEPT
    {  return cend();  }
 
-   inline const_iterator cend() const BOOST_NOEXCEPT
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR const_iterator cend() const BOOST_NOEXCEPT
    {  return const_iterator(node_algorithms::end_node(this->header_ptr()), this->priv_value_traits_ptr());   }
 
-   inline iterator root()
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR iterator root()
    {  return iterator(node_algorithms::root_node(this->header_ptr()), this->priv_value_traits_ptr());   }
 
-   inline const_iterator root() const
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR const_iterator root() const
    {  return croot();   }
 
-   inline const_iterator croot() const
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR const_iterator croot() const
    {  return const_iterator(node_algorithms::root_node(this->header_ptr()), this->priv_value_traits_ptr());   }
 
-   inline reverse_iterator rbegin()
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR reverse_iterator rbegin()
    {  return reverse_iterator(end());  }
 
-   inline const_reverse_iterator rbegin() const
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR const_reverse_iterator rbegin() const
    {  return const_reverse_iterator(end());  }
 
-   inline const_reverse_iterator crbegin() const
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR const_reverse_iterator crbegin() const
    {  return const_reverse_iterator(end());  }
 
-   inline reverse_iterator rend()
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR reverse_iterator rend()
    {  return reverse_iterator(begin());   }
 
-   inline const_reverse_iterator rend() const
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR const_reverse_iterator rend() const
    {  return const_reverse_iterator(begin());   }
 
-   inline const_reverse_iterator crend() const
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR const_reverse_iterator crend() const
    {  return const_reverse_iterator(begin());   }
 
-   void replace_node(iterator replace_this, reference with_this)
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR void increment_epoch() BOOST_NOEXCEPT
+   {  holder.increment_epoch();  }
+
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR void replace_node(iterator replace_this, reference with_this)
    {
+      this->increment_epoch();
       node_algorithms::replace_node( get_value_traits().to_node_ptr(*replace_this)
                                    , this->header_ptr()
                                    , get_value_traits().to_node_ptr(with_this));
@@ -198,31 +226,31 @@ struct bstbase3
          node_algorithms::init(replace_this.pointed_node());
    }
 
-   inline void rebalance() BOOST_NOEXCEPT
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR void rebalance() BOOST_NOEXCEPT
    {  node_algorithms::rebalance(this->header_ptr()); }
 
-   iterator rebalance_subtree(iterator r) BOOST_NOEXCEPT
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR iterator rebalance_subtree(iterator r) BOOST_NOEXCEPT
    {  return iterator(node_algorithms::rebalance_subtree(r.pointed_node()), this->priv_value_traits_ptr()); }
 
-   static iterator s_iterator_to(reference value) BOOST_NOEXCEPT
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR static iterator s_iterator_to(reference value) BOOST_NOEXCEPT
    {
       BOOST_INTRUSIVE_STATIC_ASSERT((!stateful_value_traits));
       return iterator (value_traits::to_node_ptr(value), const_value_traits_ptr());
    }
 
-   static const_iterator s_iterator_to(const_reference value) BOOST_NOEXCEPT
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR static const_iterator s_iterator_to(const_reference value) BOOST_NOEXCEPT
    {
       BOOST_INTRUSIVE_STATIC_ASSERT((!stateful_value_traits));
       return const_iterator (value_traits::to_node_ptr(*pointer_traits<pointer>::const_cast_from(pointer_traits<const_pointer>::pointer_to(value))), const_value_traits_ptr());
    }
 
-   iterator iterator_to(reference value) BOOST_NOEXCEPT
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR iterator iterator_to(reference value) BOOST_NOEXCEPT
    {  return iterator (this->get_value_traits().to_node_ptr(value), this->priv_value_traits_ptr()); }
 
-   const_iterator iterator_to(const_reference value) const BOOST_NOEXCEPT
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR const_iterator iterator_to(const_reference value) const BOOST_NOEXCEPT
    {  return const_iterator (this->get_value_traits().to_node_ptr(*pointer_traits<pointer>::const_cast_from(pointer_traits<const_pointer>::pointer_to(value))), this->priv_value_traits_ptr()); }
 
-   inline static void init_node(reference value)
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR static void init_node(reference value)
    { node_algorithms::init(value_traits::to_node_ptr(value)); }
 
 };
@@ -296,14 +324,14 @@ struct bstbase2
    typedef typename treeheader_t::node_ptr                           node_ptr;
    typedef typename treeheader_t::const_node_ptr                     const_node_ptr;
 
-   bstbase2(const key_compare &comp, const ValueTraits &vtraits)
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR bstbase2(const key_compare &comp, const ValueTraits &vtraits)
       : detail::ebo_functor_holder<value_compare>(value_compare(comp)), treeheader_t(vtraits)
    {}
 
-   const value_compare &get_comp() const
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR const value_compare &get_comp() const
    {  return this->get();  }
 
-   value_compare &get_comp()
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR value_compare &get_comp()
    {  return this->get();  }
 
    typedef BOOST_INTRUSIVE_IMPDEF(typename value_traits::pointer)                               pointer;
@@ -313,49 +341,70 @@ struct bstbase2
    typedef BOOST_INTRUSIVE_IMPDEF(typename pointer_traits<const_pointer>::difference_type)      difference_type;
    typedef typename node_algorithms::insert_commit_data insert_commit_data;
 
-   inline value_compare value_comp() const
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR value_compare value_comp() const
    {  return this->get_comp();   }
 
-   inline key_compare key_comp() const
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR key_compare key_comp() const
    {  return this->get_comp().key_comp();   }
 
    //lower_bound
-   inline iterator lower_bound(const key_type &key)
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR iterator lower_bound(const key_type &key)
    {  return this->lower_bound(key, this->key_comp());   }
 
-   inline const_iterator lower_bound(const key_type &key) const
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR const_iterator lower_bound(const key_type &key) const
    {  return this->lower_bound(key, this->key_comp());   }
 
    template<class KeyType, class KeyTypeKeyCompare>
-   iterator lower_bound(const KeyType &key, KeyTypeKeyCompare comp)
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR iterator lower_bound(const KeyType &key, KeyTypeKeyCompare comp)
    {
       return iterator(node_algorithms::lower_bound
          (this->header_ptr(), key, this->key_node_comp(comp)), this->priv_value_traits_ptr());
    }
 
    template<class KeyType, class KeyTypeKeyCompare>
-   const_iterator lower_bound(const KeyType &key, KeyTypeKeyCompare comp) const
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR const_iterator lower_bound(const KeyType &key, KeyTypeKeyCompare comp) const
    {
       return const_iterator(node_algorithms::lower_bound
          (this->header_ptr(), key, this->key_node_comp(comp)), this->priv_value_traits_ptr());
    }
 
+   //lower_bound_from
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR iterator lower_bound_from(const_iterator finger, const key_type &key)
+   {  return this->lower_bound_from(finger, key, this->key_comp());   }
+
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR const_iterator lower_bound_from(const_iterator finger, const key_type &key) const
+   {  return this->lower_bound_from(finger, key, this->key_comp());   }
+
+   template<class KeyType, class KeyTypeKeyCompare>
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR iterator lower_bound_from(const_iterator finger, const KeyType &key, KeyTypeKeyCompare comp)
+   {
+      return iterator(node_algorithms::lower_bound_from
+         (this->header_ptr(), finger.pointed_node(), key, this->key_node_comp(comp)), this->priv_value_traits_ptr());
+   }
+
+   template<class KeyType, class KeyTypeKeyCompare>
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR const_iterator lower_bound_from(const_iterator finger, const KeyType &key, KeyTypeKeyCompare comp) const
+   {
+      return const_iterator(node_algorithms::lower_bound_from
+         (this->header_ptr(), finger.pointed_node(), key, this->key_node_comp(comp)), this->priv_value_traits_ptr());
+   }
+
    //upper_bound
-   inline iterator upper_bound(const key_type &key)
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR iterator upper_bound(const key_type &key)
    {  return this->upper_bound(key, this->key_comp());   }
 
    template<class KeyType, class KeyTypeKeyCompare>
-   iterator upper_bound(const KeyType &key, KeyTypeKeyCompare comp)
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR iterator upper_bound(const KeyType &key, KeyTypeKeyCompare comp)
    {
       return iterator(node_algorithms::upper_bound
          (this->header_ptr(), key, this->key_node_comp(comp)), this->priv_value_traits_ptr());
    }
 
-   inline const_iterator upper_bound(const key_type &key) const
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR const_iterator upper_bound(const key_type &key) const
    {  return this->upper_bound(key, this->key_comp());   }
 
    template<class KeyType, class KeyTypeKeyCompare>
-   const_iterator upper_bound(const KeyType &key, KeyTypeKeyCompare comp) const
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR const_iterator upper_bound(const KeyType &key, KeyTypeKeyCompare comp) const
    {
       return const_iterator(node_algorithms::upper_bound
          (this->header_ptr(), key, this->key_node_comp(comp)), this->priv_value_traits_ptr());
@@ -366,38 +415,38 @@ struct bstbase2
    {  typedef detail::key_nodeptr_comp<KeyTypeKeyCompare, value_traits, key_of_value> type;  };
 
    template<class KeyTypeKeyCompare>
-   inline typename key_node_comp_ret<KeyTypeKeyCompare>::type key_node_comp(KeyTypeKeyCompare comp) const
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR typename key_node_comp_ret<KeyTypeKeyCompare>::type key_node_comp(KeyTypeKeyCompare comp) const
    {
       return detail::key_nodeptr_comp<KeyTypeKeyCompare, value_traits, key_of_value>(comp, &this->get_value_traits());
    }
 
    //find
-   inline iterator find(const key_type &key)
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR iterator find(const key_type &key)
    {  return this->find(key, this->key_comp()); }
 
    template<class KeyType, class KeyTypeKeyCompare>
-   iterator find(const KeyType &key, KeyTypeKeyCompare comp)
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR iterator find(const KeyType &key, KeyTypeKeyCompare comp)
    {
       return iterator
          (node_algorithms::find(this->header_ptr(), key, this->key_node_comp(comp)), this->priv_value_traits_ptr());
    }
 
-   inline const_iterator find(const key_type &key) const
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR const_iterator find(const key_type &key) const
    {  return this->find(key, this->key_comp()); }
 
    template<class KeyType, class KeyTypeKeyCompare>
-   const_iterator find(const KeyType &key, KeyTypeKeyCompare comp) const
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR const_iterator find(const KeyType &key, KeyTypeKeyCompare comp) const
    {
       return const_iterator
          (node_algorithms::find(this->header_ptr(), key, this->key_node_comp(comp)), this->priv_value_traits_ptr());
    }
 
    //equal_range
-   inline std::pair<iterator,iterator> equal_range(const key_type &key)
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR std::pair<iterator,iterator> equal_range(const key_type &key)
    {  return this->equal_range(key, this->key_comp());   }
 
    template<class KeyType, class KeyTypeKeyCompare>
-   std::pair<iterator,iterator> equal_range(const KeyType &key, KeyTypeKeyCompare comp)
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR std::pair<iterator,iterator> equal_range(const KeyType &key, KeyTypeKeyCompare comp)
    {
       std::pair<node_ptr, node_ptr> ret = 
          node_algorithms::equal_range(this->header_ptr(), key, this->key_node_comp(comp));
@@ -405,7 +454,7 @@ struct bstbase2
                                           , iterator(ret.second, this->priv_value_traits_ptr()));
    }
 
-   inline std::pair<const_iterator, const_iterator>
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR std::pair<const_iterator, const_iterator>
       equal_range(const key_type &key) const
    {  return this->equal_range(key, this->key_comp());   }
 
@@ -420,11 +469,11 @@ struct bstbase2
    }
 
    //lower_bound_range
-   inline std::pair<iterator,iterator> lower_bound_range(const key_type &key)
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR std::pair<iterator,iterator> lower_bound_range(const key_type &key)
    {  return this->lower_bound_range(key, this->key_comp());   }
 
    template<class KeyType, class KeyTypeKeyCompare>
-   std::pair<iterator,iterator> lower_bound_range(const KeyType &key, KeyTypeKeyCompare comp)
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR std::pair<iterator,iterator> lower_bound_range(const KeyType &key, KeyTypeKeyCompare comp)
    {
       std::pair<node_ptr, node_ptr> ret =
          node_algorithms::lower_bound_range(this->header_ptr(), key, this->key_node_comp(comp));
@@ -432,7 +481,7 @@ struct bstbase2
                                           , iterator(ret.second, this->priv_value_traits_ptr()));
    }
 
-   inline std::pair<const_iterator, const_iterator>
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR std::pair<const_iterator, const_iterator>
       lower_bound_range(const key_type &key) const
    {  return this->lower_bound_range(key, this->key_comp());   }
 
@@ -447,7 +496,7 @@ struct bstbase2
    }
 
    //bounded_range
-   inline std::pair<iterator,iterator> bounded_range
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR std::pair<iterator,iterator> bounded_range
       (const key_type &lower_key, const key_type &upper_key, bool left_closed, bool right_closed)
    {  return this->bounded_range(lower_key, upper_key, this->key_comp(), left_closed, right_closed);   }
 
@@ -462,7 +511,7 @@ struct bstbase2
                                           , iterator(ret.second, this->priv_value_traits_ptr()));
    }
 
-   inline std::pair<const_iterator,const_iterator> bounded_range
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR std::pair<const_iterator,const_iterator> bounded_range
       (const key_type &lower_key, const key_type &upper_key, bool left_closed, bool right_closed) const
    {  return this->bounded_range(lower_key, upper_key, this->key_comp(), left_closed, right_closed);   }
 
@@ -478,16 +527,16 @@ struct bstbase2
    }
 
    //insert_unique_check
-   inline std::pair<iterator, bool> insert_unique_check
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR std::pair<iterator, bool> insert_unique_check
       (const key_type &key, insert_commit_data &commit_data)
    {  return this->insert_unique_check(key, this->key_comp(), commit_data);   }
 
-   inline std::pair<iterator, bool> insert_unique_check
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR std::pair<iterator, bool> insert_unique_check
       (const_iterator hint, const key_type &key, insert_commit_data &commit_data)
    {  return this->insert_unique_check(hint, key, this->key_comp(), commit_data);   }
 
    template<class KeyType, class KeyTypeKeyCompare>
-   BOOST_INTRUSIVE_DOC1ST(std::pair<iterator BOOST_INTRUSIVE_I bool>
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR BOOST_INTRUSIVE_DOC1ST(std::pair<iterator BOOST_INTRUSIVE_I bool>
       , typename detail::disable_if_convertible
          <KeyType BOOST_INTRUSIVE_I const_iterator BOOST_INTRUSIVE_I 
          std::pair<iterator BOOST_INTRUSIVE_I bool> >::type)
@@ -527,7 +576,7 @@ struct bstbase_hack
    typedef typename get_algo
       <AlgoType, node_traits>::type                algo_type;
 
-   inline bstbase_hack(const key_compare & comp, const ValueTraits &vtraits)
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR bstbase_hack(const key_compare & comp, const ValueTraits &vtraits)
       : base_type(comp, vtraits)
    {
       this->sz_traits().set_size(size_type(0));
@@ -535,10 +584,10 @@ struct bstbase_hack
 
    typedef detail::size_holder<ConstantTimeSize, SizeType>     size_traits;
 
-   inline size_traits &sz_traits()
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR size_traits &sz_traits()
    {  return static_cast<size_traits &>(*this);  }
 
-   inline const size_traits &sz_traits() const
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR const size_traits &sz_traits() const
    {  return static_cast<const size_traits &>(*this);  }
 };
 
@@ -550,13 +599,13 @@ struct bstbase_hack<ValueTraits, VoidOrKeyOfValue, VoidOrKeyComp, false, SizeTyp
    typedef bstbase2< ValueTraits, VoidOrKeyOfValue, VoidOrKeyComp, AlgoType, HeaderHolder> base_type;
    typedef typename base_type::value_compare       value_compare;
    typedef typename base_type::key_compare         key_compare;
-   inline bstbase_hack(const key_compare & comp, const ValueTraits &vtraits)
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR bstbase_hack(const key_compare & comp, const ValueTraits &vtraits)
       : base_type(comp, vtraits)
    {}
 
    typedef detail::size_holder<false, SizeType>     size_traits;
 
-   inline size_traits sz_traits() const
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR size_traits sz_traits() const
    {  return size_traits();  }
 };
 
@@ -578,13 +627,13 @@ struct bstbase
       <AlgoType, node_traits>::type                node_algorithms;
    typedef SizeType                                size_type;
 
-   inline bstbase(const key_compare & comp, const ValueTraits &vtraits)
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR bstbase(const key_compare & comp, const ValueTraits &vtraits)
       : base_type(comp, vtraits)
    {}
 
    //Detach all inserted nodes. This will add exception safety to bstree_impl
    //constructors inserting elements.
-   ~bstbase()
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR ~bstbase()
    #if defined(BOOST_INTRUSIVE_CONCEPTS_BASED_OVERLOADING)
       requires (ValueTraits::link_mode != normal_link)
    #endif
@@ -620,8 +669,8 @@ struct bstbase
 //!
 //! The container supports the following options:
 //! \c base_hook<>/member_hook<>/value_traits<>,
-//! \c constant_time_size<>, \c size_type<> and
-//! \c compare<>.
+//! \c constant_time_size<>, \c size_type<>,
+//! \c compare<> and \c modification_epoch<>.
 #if defined(BOOST_INTRUSIVE_DOXYGEN_INVOKED)
 template<class T, class ...Options>
 #else
@@ -678,6 +727,9 @@ class bstree_impl
 
    protected:
 
+   //Ranges longer than this are detached from the tree splitting and joining
+   //the tree instead of being erased node by node
+   static const size_type range_erase_split_threshold = 8u;
 
    /// @endcond
 
@@ -692,7 +744,7 @@ class bstree_impl
    //! <b>Throws</b>: If value_traits::node_traits::node
    //!   constructor throws (this does not happen with predefined Boost.Intrusive hooks)
    //!   or the copy constructor of the key_compare object throws. Basic guarantee.
-   bstree_impl()
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR bstree_impl()
       :  data_type(key_compare(), value_traits())
    {}
 
@@ -703,7 +755,7 @@ class bstree_impl
    //! <b>Throws</b>: If value_traits::node_traits::node
    //!   constructor throws (this does not happen with predefined Boost.Intrusive hooks)
    //!   or the copy constructor of the key_compare object throws. Basic guarantee.
-   explicit bstree_impl( const key_compare &cmp, const value_traits &v_traits = value_traits())
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR explicit bstree_impl( const key_compare &cmp, const value_traits &v_traits = value_traits())
       :  data_type(cmp, v_traits)
    {}
 
@@ -720,7 +772,7 @@ class bstree_impl
    //!   constructor throws (this does not happen with predefined Boost.Intrusive hooks)
    //!   or the copy constructor/operator() of the key_compare object throws. Basic guarantee.
    template<class Iterator>
-   bstree_impl( bool unique, Iterator b, Iterator e
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR bstree_impl( bool unique, Iterator b, Iterator e
               , const key_compare &cmp     = key_compare()
               , const value_traits &v_traits = value_traits())
       : data_type(cmp, v_traits)
@@ -741,7 +793,7 @@ class bstree_impl
    //! <b>Throws</b>: If value_traits::node_traits::node's
    //!   move constructor throws (this does not happen with predefined Boost.Intrusive hooks)
    //!   or the move constructor of the comparison objet throws.
-   bstree_impl(BOOST_RV_REF(bstree_impl) x)
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR bstree_impl(BOOST_RV_REF(bstree_impl) x)
       : data_type(::boost::move(x.get_comp()), ::boost::move(x.get_value_traits()))
    {
       this->swap(x);
@@ -749,7 +801,7 @@ class bstree_impl
 
    //! <b>Effects</b>: Equivalent to swap
    //!
-   inline bstree_impl& operator=(BOOST_RV_REF(bstree_impl) x)
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR bstree_impl& operator=(BOOST_RV_REF(bstree_impl) x)
    {  this->swap(x); return *this;  }
 
    #ifdef BOOST_INTRUSIVE_DOXYGEN_INVOKED
@@ -760,7 +812,7 @@ class bstree_impl
    //! <b>Complexity</b>: Linear to elements contained in *this.
    //!
    //! <b>Throws</b>: Nothing.
-   ~bstree_impl()
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR ~bstree_impl()
    {}
 
    //! <b>Effects</b>: Returns an iterator pointing to the beginning of the container.
@@ -885,7 +937,7 @@ class bstree_impl
    //!
    //! <b>Complexity</b>: Constant.
    BOOST_INTRUSIVE_NO_DANGLING
-   static bstree_impl& container_from_end_iterator(iterator end_iterator) BOOST_NOEXCEPT
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR static bstree_impl& container_from_end_iterator(iterator end_iterator) BOOST_NOEXCEPT
    {
       return static_cast<bstree_impl&>
                (data_type::get_tree_base_from_end_iterator(end_iterator));
@@ -900,7 +952,7 @@ class bstree_impl
    //!
    //! <b>Complexity</b>: Constant.
    BOOST_INTRUSIVE_NO_DANGLING
-   static const bstree_impl & container_from_end_iterator(const_iterator end_iterator) BOOST_NOEXCEPT
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR static const bstree_impl & container_from_end_iterator(const_iterator end_iterator) BOOST_NOEXCEPT
    {
       return static_cast<bstree_impl&>
                (data_type::get_tree_base_from_end_iterator(end_iterator));
@@ -915,7 +967,7 @@ class bstree_impl
    //!
    //! <b>Complexity</b>: Logarithmic.
    BOOST_INTRUSIVE_NO_DANGLING
-   static bstree_impl & container_from_iterator(iterator it) BOOST_NOEXCEPT
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR static bstree_impl & container_from_iterator(iterator it) BOOST_NOEXCEPT
    {  return container_from_end_iterator(it.end_iterator_from_it());   }
 
    //! <b>Precondition</b>: it must be a valid end const_iterator
@@ -927,7 +979,7 @@ class bstree_impl
    //!
    //! <b>Complexity</b>: Logarithmic.
    BOOST_INTRUSIVE_NO_DANGLING
-   static const bstree_impl & container_from_iterator(const_iterator it) BOOST_NOEXCEPT
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR static const bstree_impl & container_from_iterator(const_iterator it) BOOST_NOEXCEPT
    {  return container_from_end_iterator(it.end_iterator_from_it());   }
 
    #ifdef BOOST_INTRUSIVE_DOXYGEN_INVOKED
@@ -953,7 +1005,7 @@ class bstree_impl
    //! <b>Complexity</b>: Constant.
    //!
    //! <b>Throws</b>: Nothing.
-   bool empty() const BOOST_NOEXCEPT
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR bool empty() const BOOST_NOEXCEPT
    {
       BOOST_IF_CONSTEXPR(constant_time_size){
          return !this->data_type::sz_traits().get_size();
@@ -969,7 +1021,7 @@ class bstree_impl
    //!   if constant-time size option is disabled. Constant time otherwise.
    //!
    //! <b>Throws</b>: Nothing.
-   size_type size() const BOOST_NOEXCEPT
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR size_type size() const BOOST_NOEXCEPT
    {
       BOOST_IF_CONSTEXPR(constant_time_size)
          return this->sz_traits().get_size();
@@ -978,18 +1030,36 @@ class bstree_impl
       }
    }
 
+   //! <b>Requires</b>: The container was defined with the \c modification_epoch<true> option.
+   //!
+   //! <b>Effects</b>: Returns a counter incremented by every member function that inserts,
+   //!   erases, replaces or relocates elements, or that swaps or merges the container.
+   //!   Elements unlinked by the static remove_node function or by auto-unlink hooks
+   //!   don't change it.
+   //!
+   //! <b>Complexity</b>: Constant.
+   //!
+   //! <b>Throws</b>: Nothing.
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR std::size_t epoch() const BOOST_NOEXCEPT
+   {
+      BOOST_INTRUSIVE_STATIC_ASSERT((data_type::modification_epoch));
+      return this->holder.epoch;
+   }
+
    //! <b>Effects</b>: Swaps the contents of two containers.
    //!
    //! <b>Complexity</b>: Constant.
    //!
    //! <b>Throws</b>: If the comparison functor's swap call throws.
-   void swap(bstree_impl& other)
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR void swap(bstree_impl& other)
    {
       //This can throw
       ::boost::adl_move_swap(this->get_comp(), other.get_comp());
       //These can't throw
       node_algorithms::swap_tree(this->header_ptr(), node_ptr(other.header_ptr()));
       this->sz_traits().swap(other.sz_traits());
+      this->increment_epoch();
+      other.increment_epoch();
    }
 
    //! <b>Requires</b>: Disposer::operator()(pointer) shouldn't throw.
@@ -1007,7 +1077,7 @@ class bstree_impl
    //!
    //! <b>Throws</b>: If cloner throws or predicate copy assignment throws. Basic guarantee.
    template <class Cloner, class Disposer>
-   void clone_from(const bstree_impl &src, Cloner cloner, Disposer disposer)
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR void clone_from(const bstree_impl &src, Cloner cloner, Disposer disposer)
    {
       this->clear_and_dispose(disposer);
       if(!src.empty()){
@@ -1019,6 +1089,44 @@ class bstree_impl
             ,detail::node_cloner <Cloner,    value_traits, AlgoType>(cloner,   &this->get_value_traits())
             ,detail::node_disposer<Disposer, value_traits, AlgoType>(disposer, &this->get_value_traits()));
          this->sz_traits().set_size(src.sz_traits().get_size());
+         this->increment_epoch();
+         this->get_comp() = src.get_comp();
+         rollback.release();
+      }
+   }
+
+   //! <b>Requires</b>: Disposer::operator()(pointer) shouldn't throw.
+   //!   Cloner should yield to nodes equivalent to the original nodes.
+   //!   Cloner and Disposer must be safe to call concurrently and Executor must
+   //!   model the executor concept described in sequential_executor.
+   //!
+   //! <b>Effects</b>: Same as clone_from(src, cloner, disposer), but the subtrees below
+   //!   the top levels of the tree are cloned in parallel by up to 16 tasks
+   //!   run through <tt>executor(task1, task2)</tt>. Only trees with more than some thousands
+   //!   of elements are split.
+   //!
+   //!   If cloner throws, all cloned elements are unlinked and disposed
+   //!   calling Disposer::operator()(pointer).
+   //!
+   //! <b>Complexity</b>: Linear to erased plus inserted elements.
+   //!
+   //! <b>Throws</b>: If cloner, the executor or predicate copy assignment throw. Basic guarantee.
+   template <class Cloner, class Disposer, class Executor>
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR void clone_from(const bstree_impl &src, Cloner cloner, Disposer disposer, Executor executor)
+   {
+      this->clear_and_dispose(disposer);
+      if(!src.empty()){
+         detail::exception_disposer<bstree_impl, Disposer>
+            rollback(*this, disposer);
+         node_algorithms::clone
+            (src.header_ptr()
+            ,this->header_ptr()
+            ,detail::node_cloner <Cloner,    value_traits, AlgoType>(cloner,   &this->get_value_traits())
+            ,detail::node_disposer<Disposer, value_traits, AlgoType>(disposer, &this->get_value_traits())
+            ,executor
+            ,priv_fork_levels(src));
+         this->sz_traits().set_size(src.sz_traits().get_size());
+         this->increment_epoch();
          this->get_comp() = src.get_comp();
          rollback.release();
       }
@@ -1042,7 +1150,7 @@ class bstree_impl
    //! <b>Note</b>: This version can modify the source container, useful to implement
    //!    move semantics.
    template <class Cloner, class Disposer>
-   void clone_from(BOOST_RV_REF(bstree_impl) src, Cloner cloner, Disposer disposer)
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR void clone_from(BOOST_RV_REF(bstree_impl) src, Cloner cloner, Disposer disposer)
    {
       this->clear_and_dispose(disposer);
       if(!src.empty()){
@@ -1054,11 +1162,59 @@ class bstree_impl
             ,detail::node_cloner <Cloner,    value_traits, AlgoType, false>(cloner,   &this->get_value_traits())
             ,detail::node_disposer<Disposer, value_traits, AlgoType>(disposer, &this->get_value_traits()));
          this->sz_traits().set_size(src.sz_traits().get_size());
+         this->increment_epoch();
          this->get_comp() = src.get_comp();
          rollback.release();
       }
    }
 
+   //! <b>Requires</b>: Relocator::operator()(reference) must return a pointer to a new
+   //!   object equivalent to the passed one, whose hook is not linked in any container,
+   //!   or a pointer to the passed object if it must stay in place.
+   //!   Disposer::operator()(pointer) shouldn't throw.
+   //!
+   //! <b>Effects</b>: Visits the elements in order calling Relocator::operator()(reference)
+   //!   for each one and puts the returned object in the position of the visited one,
+   //!   rewiring the links of the tree. Disposer::operator()(pointer) is then called
+   //!   for each replaced object.
+   //!
+   //!   As the relocator is called in order, a relocator that obtains new storage
+   //!   sequentially (e.g. from a bump allocator or a fresh arena) lays out
+   //!   the elements in traversal order, so that later in-order scans access
+   //!   memory sequentially.
+   //!
+   //! <b>Complexity</b>: Linear to the number of elements. No comparison or rebalancing is performed.
+   //!
+   //! <b>Throws</b>: If relocator throws. Basic guarantee: elements
+   //!   already relocated stay in their new storage.
+   //!
+   //! <b>Note</b>: Invalidates the iterators to replaced elements.
+   template <class Relocator, class Disposer>
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR void relocate(Relocator relocator, Disposer disposer)
+   {
+      this->increment_epoch();
+      const node_ptr header = this->header_ptr();
+      node_ptr p = node_algorithms::begin_node(header);
+      while(p != header){
+         const node_ptr new_node = this->get_value_traits().to_node_ptr
+            (*relocator(*this->get_value_traits().to_value_ptr(p)));
+         if(new_node != p){
+            BOOST_INTRUSIVE_SAFE_HOOK_DEFAULT_ASSERT(!safemode_or_autounlink || node_algorithms::unique(new_node));
+            node_algorithms::replace_node(p, header, new_node);
+            BOOST_IF_CONSTEXPR(safemode_or_autounlink)
+               node_algorithms::init(p);
+            disposer(this->get_value_traits().to_value_ptr(p));
+         }
+         p = node_algorithms::next_node(new_node);
+      }
+   }
+
+   //! <b>Effects</b>: Same as relocate(relocator, disposer) with a disposer that does nothing:
+   //!   replaced objects are left unlinked, so they can be destroyed afterwards.
+   template <class Relocator>
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR void relocate(Relocator relocator)
+   {  this->relocate(relocator, detail::null_disposer());  }
+
    //! <b>Requires</b>: value must be an lvalue
    //!
    //! <b>Effects</b>: Inserts value into the container before the upper bound.
@@ -1070,13 +1226,14 @@ class bstree_impl
    //!
    //! <b>Note</b>: Does not affect the validity of iterators and references.
    //!   No copy-constructors are called.
-   iterator insert_equal(reference value)
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR iterator insert_equal(reference value)
    {
       node_ptr to_insert(this->get_value_traits().to_node_ptr(value));
       BOOST_INTRUSIVE_SAFE_HOOK_DEFAULT_ASSERT(!safemode_or_autounlink || node_algorithms::unique(to_insert));
       iterator ret(node_algorithms::insert_equal_upper_bound
          (this->header_ptr(), to_insert, this->key_node_comp(this->key_comp())), this->priv_value_traits_ptr());
       this->sz_traits().increment();
+      this->increment_epoch();
       return ret;
    }
 
@@ -1094,13 +1251,14 @@ class bstree_impl
    //!
    //! <b>Note</b>: Does not affect the validity of iterators and references.
    //!   No copy-constructors are called.
-   iterator insert_equal(const_iterator hint, reference value)
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR iterator insert_equal(const_iterator hint, reference value)
    {
       node_ptr to_insert(this->get_value_traits().to_node_ptr(value));
       BOOST_INTRUSIVE_SAFE_HOOK_DEFAULT_ASSERT(!safemode_or_autounlink || node_algorithms::unique(to_insert));
       iterator ret(node_algorithms::insert_equal
          (this->header_ptr(), hint.pointed_node(), to_insert, this->key_node_comp(this->key_comp())), this->priv_value_traits_ptr());
       this->sz_traits().increment();
+      this->increment_epoch();
       return ret;
    }
 
@@ -1119,7 +1277,7 @@ class bstree_impl
    //! <b>Note</b>: Does not affect the validity of iterators and references.
    //!   No copy-constructors are called.
    template<class Iterator>
-   void insert_equal(Iterator b, Iterator e)
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR void insert_equal(Iterator b, Iterator e)
    {
       iterator iend(this->end());
       for (; b != e; ++b)
@@ -1138,7 +1296,7 @@ class bstree_impl
    //!
    //! <b>Note</b>: Does not affect the validity of iterators and references.
    //!   No copy-constructors are called.
-   std::pair<iterator, bool> insert_unique(reference value)
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR std::pair<iterator, bool> insert_unique(reference value)
    {
       insert_commit_data commit_data;
       std::pair<node_ptr, bool> ret =
@@ -1164,7 +1322,7 @@ class bstree_impl
    //!
    //! <b>Note</b>: Does not affect the validity of iterators and references.
    //!   No copy-constructors are called.
-   iterator insert_unique(const_iterator hint, reference value)
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR iterator insert_unique(const_iterator hint, reference value)
    {
       insert_commit_data commit_data;
       std::pair<node_ptr, bool> ret =
@@ -1188,7 +1346,7 @@ class bstree_impl
    //! <b>Note</b>: Does not affect the validity of iterators and references.
    //!   No copy-constructors are called.
    template<class Iterator>
-   void insert_unique(Iterator b, Iterator e)
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR void insert_unique(Iterator b, Iterator e)
    {
       if(this->empty()){
          iterator iend(this->end());
@@ -1323,7 +1481,7 @@ class bstree_impl
    //! <b>Notes</b>: This function has only sense if a "insert_check" has been
    //!   previously executed to fill "commit_data". No value should be inserted or
    //!   erased between the "insert_check" and "insert_commit" calls.
-   iterator insert_unique_commit(reference value, const insert_commit_data &commit_data) BOOST_NOEXCEPT
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR iterator insert_unique_commit(reference value, const insert_commit_data &commit_data) BOOST_NOEXCEPT
    {
       node_ptr to_insert(this->get_value_traits().to_node_ptr(value));
       BOOST_INTRUSIVE_SAFE_HOOK_DEFAULT_ASSERT(!safemode_or_autounlink || node_algorithms::unique(to_insert));
@@ -1343,6 +1501,7 @@ class bstree_impl
       node_algorithms::insert_unique_commit
                (this->header_ptr(), to_insert, commit_data);
       this->sz_traits().increment();
+      this->increment_epoch();
       return iterator(to_insert, this->priv_value_traits_ptr());
    }
 
@@ -1360,11 +1519,12 @@ class bstree_impl
    //! the successor of "value" container ordering invariant will be broken.
    //! This is a low-level function to be used only for performance reasons
    //! by advanced users.
-   iterator insert_before(const_iterator pos, reference value) BOOST_NOEXCEPT
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR iterator insert_before(const_iterator pos, reference value) BOOST_NOEXCEPT
    {
       node_ptr to_insert(this->get_value_traits().to_node_ptr(value));
       BOOST_INTRUSIVE_SAFE_HOOK_DEFAULT_ASSERT(!safemode_or_autounlink || node_algorithms::unique(to_insert));
       this->sz_traits().increment();
+      this->increment_epoch();
       return iterator(node_algorithms::insert_before
          (this->header_ptr(), pos.pointed_node(), to_insert), this->priv_value_traits_ptr());
    }
@@ -1383,11 +1543,12 @@ class bstree_impl
    //!   This function is slightly more efficient than using "insert_before".
    //!   This is a low-level function to be used only for performance reasons
    //!   by advanced users.
-   void push_back(reference value) BOOST_NOEXCEPT
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR void push_back(reference value) BOOST_NOEXCEPT
    {
       node_ptr to_insert(this->get_value_traits().to_node_ptr(value));
       BOOST_INTRUSIVE_SAFE_HOOK_DEFAULT_ASSERT(!safemode_or_autounlink || node_algorithms::unique(to_insert));
       this->sz_traits().increment();
+      this->increment_epoch();
       node_algorithms::push_back(this->header_ptr(), to_insert);
    }
 
@@ -1405,11 +1566,12 @@ class bstree_impl
    //!   This function is slightly more efficient than using "insert_before".
    //!   This is a low-level function to be used only for performance reasons
    //!   by advanced users.
-   void push_front(reference value) BOOST_NOEXCEPT
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR void push_front(reference value) BOOST_NOEXCEPT
    {
       node_ptr to_insert(this->get_value_traits().to_node_ptr(value));
       BOOST_INTRUSIVE_SAFE_HOOK_DEFAULT_ASSERT(!safemode_or_autounlink || node_algorithms::unique(to_insert));
       this->sz_traits().increment();
+      this->increment_epoch();
       node_algorithms::push_front(this->header_ptr(), to_insert);
    }
 
@@ -1421,7 +1583,7 @@ class bstree_impl
    //!
    //! <b>Note</b>: Invalidates the iterators (but not the references)
    //!    to the erased elements. No destructors are called.
-   iterator erase(const_iterator i) BOOST_NOEXCEPT
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR iterator erase(const_iterator i) BOOST_NOEXCEPT
    {
       const_iterator ret(i);
       ++ret;
@@ -1429,6 +1591,7 @@ class bstree_impl
       BOOST_INTRUSIVE_SAFE_HOOK_DEFAULT_ASSERT(!safemode_or_autounlink || !node_algorithms::unique(to_erase));
       node_algorithms::erase(this->header_ptr(), to_erase);
       this->sz_traits().decrement();
+      this->increment_epoch();
       BOOST_IF_CONSTEXPR(safemode_or_autounlink)
          node_algorithms::init(to_erase);
       return ret.unconst();
@@ -1443,7 +1606,7 @@ class bstree_impl
    //!
    //! <b>Note</b>: Invalidates the iterators (but not the references)
    //!    to the erased elements. No destructors are called.
-   iterator erase(const_iterator b, const_iterator e) BOOST_NOEXCEPT
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR iterator erase(const_iterator b, const_iterator e) BOOST_NOEXCEPT
    {  size_type n;   return this->private_erase(b, e, n);   }
 
    //! <b>Effects</b>: Erases all the elements with the given value.
@@ -1456,7 +1619,7 @@ class bstree_impl
    //!
    //! <b>Note</b>: Invalidates the iterators (but not the references)
    //!    to the erased elements. No destructors are called.
-   size_type erase(const key_type &key) BOOST_NOEXCEPT
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR size_type erase(const key_type &key) BOOST_NOEXCEPT
    {  return this->erase(key, this->key_comp());   }
 
    //! <b>Requires</b>: key is a value such that `*this` is partitioned with respect to
@@ -1475,7 +1638,7 @@ class bstree_impl
    //! <b>Note</b>: Invalidates the iterators (but not the references)
    //!    to the erased elements. No destructors are called.
    template<class KeyType, class KeyTypeKeyCompare>
-   BOOST_INTRUSIVE_DOC1ST(size_type
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR BOOST_INTRUSIVE_DOC1ST(size_type
       , typename detail::disable_if_convertible<KeyTypeKeyCompare BOOST_INTRUSIVE_I const_iterator BOOST_INTRUSIVE_I size_type>::type)
       erase(const KeyType& key, KeyTypeKeyCompare comp)
    {
@@ -1497,7 +1660,7 @@ class bstree_impl
    //! <b>Note</b>: Invalidates the iterators
    //!    to the erased elements.
    template<class Disposer>
-   iterator erase_and_dispose(const_iterator i, Disposer disposer) BOOST_NOEXCEPT
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR iterator erase_and_dispose(const_iterator i, Disposer disposer) BOOST_NOEXCEPT
    {
       node_ptr to_erase(i.pointed_node());
       iterator ret(this->erase(i));
@@ -1519,7 +1682,7 @@ class bstree_impl
    //! <b>Note</b>: Invalidates the iterators (but not the references)
    //!    to the erased elements. No destructors are called.
    template<class Disposer>
-   size_type erase_and_dispose(const key_type &key, Disposer disposer)
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR size_type erase_and_dispose(const key_type &key, Disposer disposer)
    {
       std::pair<iterator,iterator> p = this->equal_range(key);
       size_type n;
@@ -1540,7 +1703,7 @@ class bstree_impl
    //! <b>Note</b>: Invalidates the iterators
    //!    to the erased elements.
    template<class Disposer>
-   iterator erase_and_dispose(const_iterator b, const_iterator e, Disposer disposer) BOOST_NOEXCEPT
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR iterator erase_and_dispose(const_iterator b, const_iterator e, Disposer disposer) BOOST_NOEXCEPT
    {  size_type n;   return this->private_erase(b, e, n, disposer);   }
 
    //! <b>Requires</b>: key is a value such that `*this` is partitioned with respect to
@@ -1562,7 +1725,7 @@ class bstree_impl
    //! <b>Note</b>: Invalidates the iterators
    //!    to the erased elements.
    template<class KeyType, class KeyTypeKeyCompare, class Disposer>
-   BOOST_INTRUSIVE_DOC1ST(size_type
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR BOOST_INTRUSIVE_DOC1ST(size_type
       , typename detail::disable_if_convertible<KeyTypeKeyCompare BOOST_INTRUSIVE_I const_iterator BOOST_INTRUSIVE_I size_type>::type)
       erase_and_dispose(const KeyType& key, KeyTypeKeyCompare comp, Disposer disposer)
    {
@@ -1572,6 +1735,61 @@ class bstree_impl
       return n;
    }
 
+   //! <b>Effects</b>: Erases all the elements for which pred returns true.
+   //!   No destructors are called.
+   //!
+   //! <b>Returns</b>: The number of erased elements.
+   //!
+   //! <b>Complexity</b>: Linear. Elements are erased one by one while most visited
+   //!   elements are kept. When erased elements outnumber kept ones, the tree is
+   //!   flattened, the rest of the elements are filtered and the tree is rebuilt
+   //!   balanced in a single pass instead of rebalancing it on each erasure.
+   //!
+   //! <b>Throws</b>: If pred throws. Basic guarantee.
+   //!
+   //! <b>Note</b>: Invalidates the iterators (but not the references)
+   //!    to the erased elements.
+   template<class Pred>
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR size_type erase_if(Pred pred)
+   {  return this->erase_and_dispose_if(pred, detail::null_disposer());   }
+
+   //! <b>Requires</b>: Disposer::operator()(pointer) shouldn't throw.
+   //!
+   //! <b>Effects</b>: Erases all the elements for which pred returns true.
+   //!   Disposer::operator()(pointer) is called for the removed elements.
+   //!
+   //! <b>Returns</b>: The number of erased elements.
+   //!
+   //! <b>Complexity</b>: Linear. Elements are erased one by one while most visited
+   //!   elements are kept. When erased elements outnumber kept ones, the tree is
+   //!   flattened, the rest of the elements are filtered and the tree is rebuilt
+   //!   balanced in a single pass instead of rebalancing it on each erasure.
+   //!
+   //! <b>Throws</b>: If pred throws. Basic guarantee.
+   //!
+   //! <b>Note</b>: Invalidates the iterators
+   //!    to the erased elements.
+   template<class Pred, class Disposer>
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR size_type erase_and_dispose_if(Pred pred, Disposer disposer)
+   {
+      size_type n = 0;
+      BOOST_INTRUSIVE_TRY{
+         n = (size_type)node_algorithms::erase_if_and_dispose
+            ( this->header_ptr()
+            , detail::key_nodeptr_comp<Pred, value_traits>(pred, &this->get_value_traits())
+            , detail::node_disposer<Disposer, value_traits, AlgoType>(disposer, &this->get_value_traits()));
+      }
+      BOOST_INTRUSIVE_CATCH(...){
+         this->sz_traits().set_size(size_type(node_algorithms::size(this->header_ptr())));
+         this->increment_epoch();
+         BOOST_INTRUSIVE_RETHROW;
+      }
+      BOOST_INTRUSIVE_CATCH_END
+      this->sz_traits().decrease(n);
+      this->increment_epoch();
+      return n;
+   }
+
    //! <b>Effects</b>: Erases all of the elements.
    //!
    //! <b>Complexity</b>: Linear to the number of elements on the container.
@@ -1581,7 +1799,7 @@ class bstree_impl
    //!
    //! <b>Note</b>: Invalidates the iterators (but not the references)
    //!    to the erased elements. No destructors are called.
-   void clear() BOOST_NOEXCEPT
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR void clear() BOOST_NOEXCEPT
    {
       BOOST_IF_CONSTEXPR(safemode_or_autounlink){
          this->clear_and_dispose(detail::null_disposer());
@@ -1589,6 +1807,7 @@ class bstree_impl
       else{
          node_algorithms::init_header(this->header_ptr());
          this->sz_traits().set_size(0);
+         this->increment_epoch();
       }
    }
 
@@ -1602,12 +1821,104 @@ class bstree_impl
    //! <b>Note</b>: Invalidates the iterators (but not the references)
    //!    to the erased elements. Calls N times to disposer functor.
    template<class Disposer>
-   void clear_and_dispose(Disposer disposer) BOOST_NOEXCEPT
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR void clear_and_dispose(Disposer disposer) BOOST_NOEXCEPT
    {
       node_algorithms::clear_and_dispose(this->header_ptr()
          , detail::node_disposer<Disposer, value_traits, AlgoType>(disposer, &this->get_value_traits()));
       node_algorithms::init_header(this->header_ptr());
       this->sz_traits().set_size(0);
+      this->increment_epoch();
+   }
+
+   //! <b>Requires</b>: Disposer::operator()(pointer) shouldn't throw.
+   //!
+   //! <b>Effects</b>: Erases up to max_nodes elements calling disposer(p) for
+   //!   each of them, starting from the first element. The destruction of a big
+   //!   container can be split in several calls, each one doing bounded work.
+   //!
+   //! <b>Returns</b>: true if the container is empty after the call.
+   //!
+   //! <b>Complexity</b>: Amortized linear to max_nodes.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Note</b>: Invalidates the iterators (but not the references)
+   //!    to the erased elements. Until the container is empty, the tree is not
+   //!    rebalanced and the container can only be passed to clear_and_dispose_some,
+   //!    clear, clear_and_dispose or destroyed.
+   template<class Disposer>
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR bool clear_and_dispose_some(Disposer disposer, size_type max_nodes) BOOST_NOEXCEPT
+   {
+      BOOST_IF_CONSTEXPR(constant_time_size){
+         //Nothing will remain, the whole tree can be disposed faster
+         if(max_nodes >= this->sz_traits().get_size()){
+            this->clear_and_dispose(disposer);
+            return true;
+         }
+      }
+      const size_type n = (size_type)node_algorithms::clear_and_dispose_some
+         ( this->header_ptr()
+         , detail::node_disposer<Disposer, value_traits, AlgoType>(disposer, &this->get_value_traits())
+         , (std::size_t)max_nodes);
+      this->sz_traits().decrease(n);
+      this->increment_epoch();
+      return this->empty();
+   }
+
+   //! <b>Effects</b>: Splits the container in k consecutive ranges of roughly equal size and
+   //!   writes them in order to out as <tt>std::pair<iterator, iterator></tt> objects.
+   //!   The ranges cover the container and some of them can be empty. Disjoint ranges can
+   //!   be traversed concurrently, so that the elements can be scanned in parallel.
+   //!
+   //! <b>Returns</b>: The output iterator past the last written range.
+   //!
+   //! <b>Complexity</b>: Linear to k multiplied by the height of the tree.
+   //!
+   //! <b>Throws</b>: If writing to out throws.
+   //!
+   //! <b>Note</b>: Trees don't store the size of their subtrees, so boundaries are estimated
+   //!   from the structure of the tree: sizes are exact for complete trees and close for
+   //!   balanced trees, but they can be very different for unbalanced splay or binary search trees.
+   template<class OutputIterator>
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR OutputIterator partition(size_type k, OutputIterator out)
+   {
+      iterator b(this->begin());
+      for(size_type i = 1u; i <= k; ++i){
+         const iterator e(i == k ? this->end() : iterator
+            (node_algorithms::partition_point(this->header_ptr(), i, k), this->priv_value_traits_ptr()));
+         *out = std::pair<iterator, iterator>(b, e);
+         ++out;
+         b = e;
+      }
+      return out;
+   }
+
+   //! <b>Effects</b>: Splits the container in k consecutive ranges of roughly equal size and
+   //!   writes them in order to out as <tt>std::pair<const_iterator, const_iterator></tt> objects.
+   //!   The ranges cover the container and some of them can be empty. Disjoint ranges can
+   //!   be traversed concurrently, so that the elements can be scanned in parallel.
+   //!
+   //! <b>Returns</b>: The output iterator past the last written range.
+   //!
+   //! <b>Complexity</b>: Linear to k multiplied by the height of the tree.
+   //!
+   //! <b>Throws</b>: If writing to out throws.
+   //!
+   //! <b>Note</b>: Trees don't store the size of their subtrees, so boundaries are estimated
+   //!   from the structure of the tree: sizes are exact for complete trees and close for
+   //!   balanced trees, but they can be very different for unbalanced splay or binary search trees.
+   template<class OutputIterator>
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR OutputIterator partition(size_type k, OutputIterator out) const
+   {
+      const_iterator b(this->cbegin());
+      for(size_type i = 1u; i <= k; ++i){
+         const const_iterator e(i == k ? this->cend() : const_iterator
+            (node_algorithms::partition_point(this->header_ptr(), i, k), this->priv_value_traits_ptr()));
+         *out = std::pair<const_iterator, const_iterator>(b, e);
+         ++out;
+         b = e;
+      }
+      return out;
    }
 
    //! <b>Effects</b>: Returns the number of contained elements with the given value
@@ -1616,7 +1927,7 @@ class bstree_impl
    //!   to number of objects with the given value.
    //!
    //! <b>Throws</b>: If `key_compare` throws.
-   size_type count(const key_type &key) const
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR size_type count(const key_type &key) const
    {  return size_type(this->count(key, this->key_comp()));   }
 
    //! <b>Requires</b>: key is a value such that `*this` is partitioned with respect to
@@ -1630,7 +1941,7 @@ class bstree_impl
    //!
    //! <b>Throws</b>: If `comp` throws.
    template<class KeyType, class KeyTypeKeyCompare>
-   size_type count(const KeyType &key, KeyTypeKeyCompare comp) const
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR size_type count(const KeyType &key, KeyTypeKeyCompare comp) const
    {
       std::pair<const_iterator, const_iterator> ret = this->equal_range(key, comp);
       size_type n = 0;
@@ -1642,11 +1953,11 @@ class bstree_impl
 
    //Add non-const overloads to theoretically const members
    //as some algorithms have different behavior when non-const versions are used (like splay trees).
-   size_type count(const key_type &key)
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR size_type count(const key_type &key)
    {  return size_type(this->count(key, this->key_comp()));   }
 
    template<class KeyType, class KeyTypeKeyCompare>
-   size_type count(const KeyType &key, KeyTypeKeyCompare comp)
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR size_type count(const KeyType &key, KeyTypeKeyCompare comp)
    {
       std::pair<const_iterator, const_iterator> ret = this->equal_range(key, comp);
       size_type n = 0;
@@ -1680,6 +1991,32 @@ class bstree_impl
    template<class KeyType, class KeyTypeKeyCompare>
    const_iterator lower_bound(const KeyType &key, KeyTypeKeyCompare comp) const;
 
+   //! <b>Requires</b>: finger must be a valid iterator of *this and all the elements
+   //!   before finger must have a key less than k.
+   //!
+   //! <b>Effects</b>: Returns an iterator to the first element whose
+   //!   key is not less than k or end() if that element does not exist.
+   //!   The search starts from finger, climbing towards the root only as much as needed,
+   //!   so searching forward through a sequence of increasing keys is cheaper than
+   //!   searching from the root for each key.
+   //!
+   //! <b>Complexity</b>: Logarithmic to the distance between finger and the returned
+   //!   element in balanced trees.
+   //!
+   //! <b>Throws</b>: If `key_compare` throws.
+   iterator lower_bound_from(const_iterator finger, const key_type &key);
+
+   //! @copydoc ::boost::intrusive::bstree::lower_bound_from(const_iterator,const key_type &)
+   const_iterator lower_bound_from(const_iterator finger, const key_type &key) const;
+
+   //! @copydoc ::boost::intrusive::bstree::lower_bound_from(const_iterator,const key_type &)
+   template<class KeyType, class KeyTypeKeyCompare>
+   iterator lower_bound_from(const_iterator finger, const KeyType &key, KeyTypeKeyCompare comp);
+
+   //! @copydoc ::boost::intrusive::bstree::lower_bound_from(const_iterator,const KeyType&,KeyTypeKeyCompare)
+   template<class KeyType, class KeyTypeKeyCompare>
+   const_iterator lower_bound_from(const_iterator finger, const KeyType &key, KeyTypeKeyCompare comp) const;
+
    //! <b>Effects</b>: Returns an iterator to the first element whose
    //!   key is greater than k or end() if that element does not exist.
    //!
@@ -1908,13 +2245,14 @@ class bstree_impl
    //!   only be used for more unlink_leftmost_without_rebalance calls.
    //!   This function is normally used to achieve a step by step
    //!   controlled destruction of the container.
-   pointer unlink_leftmost_without_rebalance() BOOST_NOEXCEPT
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR pointer unlink_leftmost_without_rebalance() BOOST_NOEXCEPT
    {
       node_ptr to_be_disposed(node_algorithms::unlink_leftmost_without_rebalance
                            (this->header_ptr()));
       if(!to_be_disposed)
          return 0;
       this->sz_traits().decrement();
+      this->increment_epoch();
       BOOST_IF_CONSTEXPR(safemode_or_autounlink)//If this is commented does not work with normal_link
          node_algorithms::init(to_be_disposed);
       return this->get_value_traits().to_value_ptr(to_be_disposed);
@@ -1970,7 +2308,9 @@ class bstree_impl
    //! If the user calls
    //! this function with a constant time size container or stateful comparison
    //! functor a compilation error will be issued.
-   static void remove_node(reference value) BOOST_NOEXCEPT
+   //!
+   //! The modification epoch of the container is not updated.
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR static void remove_node(reference value) BOOST_NOEXCEPT
    {
       BOOST_INTRUSIVE_STATIC_ASSERT((!constant_time_size));
       node_ptr to_remove(value_traits::to_node_ptr(value));
@@ -1998,7 +2338,7 @@ class bstree_impl
    template<class T, class ...Options2> void merge_unique(bstree<T, Options2...> &);
    #else
    template<class Compare2>
-   void merge_unique(bstree_impl
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR void merge_unique(bstree_impl
       <ValueTraits, VoidOrKeyOfValue, Compare2, SizeType, ConstantTimeSize, AlgoType, HeaderHolder> &source)
    #endif
    {
@@ -2012,6 +2352,8 @@ class bstree_impl
          if( node_algorithms::transfer_unique(this->header_ptr(), this->key_node_comp(this->key_comp()), source.header_ptr(), p) ){
             source.sz_traits().decrement();
             this->sz_traits().increment();
+            source.increment_epoch();
+            this->increment_epoch();
          }
       }
    }
@@ -2034,7 +2376,7 @@ class bstree_impl
    template<class T, class ...Options2> void merge_equal(bstree<T, Options2...> &);
    #else
    template<class Compare2>
-   void merge_equal(bstree_impl
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR void merge_equal(bstree_impl
       <ValueTraits, VoidOrKeyOfValue, Compare2, SizeType, ConstantTimeSize, AlgoType, HeaderHolder> &source)
    #endif
    {
@@ -2048,6 +2390,8 @@ class bstree_impl
          node_algorithms::transfer_equal(this->header_ptr(), this->key_node_comp(this->key_comp()), source.header_ptr(), p);
          source.sz_traits().decrement();
          this->sz_traits().increment();
+         source.increment_epoch();
+         this->increment_epoch();
       }
    }
 
@@ -2058,7 +2402,7 @@ class bstree_impl
    //! <b>Note</b>: The method might not have effect when asserts are turned off (e.g., with NDEBUG).
    //!   Experimental function, interface might change in future versions.
    template <class ExtraChecker>
-   void check(ExtraChecker extra_checker) const
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR void check(ExtraChecker extra_checker) const
    {
       typedef detail::key_nodeptr_comp<key_compare, value_traits, key_of_value> nodeptr_comp_t;
       nodeptr_comp_t nodeptr_comp(this->key_comp(), &this->get_value_traits());
@@ -2074,12 +2418,12 @@ class bstree_impl
    //!
    //! <b>Note</b>: The method has no effect when asserts are turned off (e.g., with NDEBUG).
    //!   Experimental function, interface might change in future versions.
-   void check() const
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR void check() const
    {
       check(detail::empty_node_checker<ValueTraits>());
    }
 
-   friend bool operator==(const bstree_impl &x, const bstree_impl &y)
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR friend bool operator==(const bstree_impl &x, const bstree_impl &y)
    {
       BOOST_IF_CONSTEXPR(constant_time_size)
       if(x.size() != y.size()){
@@ -2088,39 +2432,56 @@ class bstree_impl
       return boost::intrusive::algo_equal(x.cbegin(), x.cend(), y.cbegin(), y.cend());
    }
 
-   friend bool operator!=(const bstree_impl &x, const bstree_impl &y)
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR friend bool operator!=(const bstree_impl &x, const bstree_impl &y)
    {  return !(x == y); }
 
-   friend bool operator<(const bstree_impl &x, const bstree_impl &y)
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR friend bool operator<(const bstree_impl &x, const bstree_impl &y)
    {  return ::boost::intrusive::algo_lexicographical_compare(x.begin(), x.end(), y.begin(), y.end());  }
 
-   friend bool operator>(const bstree_impl &x, const bstree_impl &y)
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR friend bool operator>(const bstree_impl &x, const bstree_impl &y)
    {  return y < x;  }
 
-   friend bool operator<=(const bstree_impl &x, const bstree_impl &y)
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR friend bool operator<=(const bstree_impl &x, const bstree_impl &y)
    {  return !(x > y);  }
 
-   friend bool operator>=(const bstree_impl &x, const bstree_impl &y)
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR friend bool operator>=(const bstree_impl &x, const bstree_impl &y)
    {  return !(x < y);  }
 
-   friend void swap(bstree_impl &x, bstree_impl &y)
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR friend void swap(bstree_impl &x, bstree_impl &y)
    {  x.swap(y);  }
 
    /// @cond
    private:
    template<class Disposer>
-   iterator private_erase(const_iterator b, const_iterator e, size_type &n, Disposer disposer)
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR iterator private_erase(const_iterator b, const_iterator e, size_type &n, Disposer disposer)
    {
-      for(n = 0; b != e; ++n)
-        this->erase_and_dispose(b++, disposer);
-      return b.unconst();
+      for(n = 0; b != e; ++n){
+         if(n == range_erase_split_threshold){
+            const size_type erased = (size_type)node_algorithms::erase_range_and_dispose
+               ( this->header_ptr(), b.pointed_node(), e.pointed_node()
+               , detail::node_disposer<Disposer, value_traits, AlgoType>(disposer, &this->get_value_traits()));
+            this->sz_traits().decrease(erased);
+            this->increment_epoch();
+            n += erased;
+            break;
+         }
+         this->erase_and_dispose(b++, disposer);
+      }
+      return e.unconst();
    }
 
-   iterator private_erase(const_iterator b, const_iterator e, size_type &n)
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR iterator private_erase(const_iterator b, const_iterator e, size_type &n)
+   {  return this->private_erase(b, e, n, detail::null_disposer());  }
+
+   //Top levels cloned in parallel: each task clones at least ~1024 nodes of a balanced
+   //tree and there are 16 tasks at most. Trees whose size is unknown are always split.
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR static std::size_t priv_fork_levels(const bstree_impl &src)
    {
-      for(n = 0; b != e; ++n)
-        this->erase(b++);
-      return b.unconst();
+      std::size_t sz = constant_time_size ? std::size_t(src.sz_traits().get_size()) : std::size_t(-1);
+      std::size_t levels = 0u;
+      while(levels != 4u && (sz >>= 1u) >= 1024u)
+         ++levels;
+      return levels;
    }
    /// @endcond
 };
@@ -2156,7 +2517,9 @@ struct make_bstree
          , typename packed_options::size_type
          , packed_options::constant_time_size
          , BsTreeAlgorithms
-         , typename packed_options::header_holder_type
+         , typename detail::get_epoch_header_holder
+            < packed_options::modification_epoch
+            , typename packed_options::header_holder_type>::type
          > implementation_defined;
    /// @endcond
    typedef implementation_defined type;
@@ -2198,50 +2561,54 @@ class bstree
    //Assert if passed value traits are compatible with the type
    BOOST_INTRUSIVE_STATIC_ASSERT((detail::is_same<typename value_traits::value_type, T>::value));
 
-   inline bstree()
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR bstree()
       :  Base()
    {}
 
-   inline explicit bstree( const key_compare &cmp, const value_traits &v_traits = value_traits())
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR explicit bstree( const key_compare &cmp, const value_traits &v_traits = value_traits())
       :  Base(cmp, v_traits)
    {}
 
    template<class Iterator>
-   inline bstree( bool unique, Iterator b, Iterator e
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR bstree( bool unique, Iterator b, Iterator e
          , const key_compare &cmp = key_compare()
          , const value_traits &v_traits = value_traits())
       :  Base(unique, b, e, cmp, v_traits)
    {}
 
-   inline bstree(BOOST_RV_REF(bstree) x)
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR bstree(BOOST_RV_REF(bstree) x)
       :  Base(BOOST_MOVE_BASE(Base, x))
    {}
 
-   inline bstree& operator=(BOOST_RV_REF(bstree) x)
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR bstree& operator=(BOOST_RV_REF(bstree) x)
    {  return static_cast<bstree &>(this->Base::operator=(BOOST_MOVE_BASE(Base, x)));  }
 
    template <class Cloner, class Disposer>
-   inline void clone_from(const bstree &src, Cloner cloner, Disposer disposer)
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR void clone_from(const bstree &src, Cloner cloner, Disposer disposer)
    {  Base::clone_from(src, cloner, disposer);  }
 
    template <class Cloner, class Disposer>
-   inline void clone_from(BOOST_RV_REF(bstree) src, Cloner cloner, Disposer disposer)
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR void clone_from(BOOST_RV_REF(bstree) src, Cloner cloner, Disposer disposer)
    {  Base::clone_from(BOOST_MOVE_BASE(Base, src), cloner, disposer);  }
 
+   template <class Cloner, class Disposer, class Executor>
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR void clone_from(const bstree &src, Cloner cloner, Disposer disposer, Executor executor)
+   {  Base::clone_from(src, cloner, disposer, executor);  }
+
    BOOST_INTRUSIVE_NO_DANGLING
-   inline static bstree &container_from_end_iterator(iterator end_iterator) BOOST_NOEXCEPT
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR static bstree &container_from_end_iterator(iterator end_iterator) BOOST_NOEXCEPT
    {  return static_cast<bstree &>(Base::container_from_end_iterator(end_iterator));   }
 
    BOOST_INTRUSIVE_NO_DANGLING
-   inline static const bstree &container_from_end_iterator(const_iterator end_iterator) BOOST_NOEXCEPT
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR static const bstree &container_from_end_iterator(const_iterator end_iterator) BOOST_NOEXCEPT
    {  return static_cast<const bstree &>(Base::container_from_end_iterator(end_iterator));   }
 
    BOOST_INTRUSIVE_NO_DANGLING
-   inline static bstree &container_from_iterator(iterator it) BOOST_NOEXCEPT
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR static bstree &container_from_iterator(iterator it) BOOST_NOEXCEPT
    {  return static_cast<bstree &>(Base::container_from_iterator(it));   }
 
    BOOST_INTRUSIVE_NO_DANGLING
-   inline static const bstree &container_from_iterator(const_iterator it) BOOST_NOEXCEPT
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR static const bstree &container_from_iterator(const_iterator it) BOOST_NOEXCEPT
    {  return static_cast<const bstree &>(Base::container_from_iterator(it));   }
 };
 
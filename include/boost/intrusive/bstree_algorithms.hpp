@@ -22,6 +22,8 @@
 #include <boost/intrusive/detail/uncast.hpp>
 #include <boost/intrusive/detail/math.hpp>
 #include <boost/intrusive/detail/algo_type.hpp>
+#include <boost/intrusive/detail/key_nodeptr_comp.hpp>
+#include <boost/move/detail/to_raw_pointer.hpp>
 
 #include <boost/intrusive/detail/minimal_pair_header.hpp>
 
@@ -38,7 +40,7 @@ namespace intrusive {
 template <class NodePtr>
 struct insert_commit_data_t
 {
-   inline insert_commit_data_t()
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR insert_commit_data_t()
       : link_left(false), node()
    {}
    bool     link_left;
@@ -67,7 +69,7 @@ struct bstree_node_checker
    struct return_type
       : public base_checker_t::return_type
    {
-      inline return_type()
+      inline BOOST_INTRUSIVE_CXX20_CONSTEXPR return_type()
          : min_key_node_ptr(const_node_ptr()), max_key_node_ptr(const_node_ptr()), node_count(0)
       {}
 
@@ -76,7 +78,7 @@ struct bstree_node_checker
       size_t   node_count;
    };
 
-   inline bstree_node_checker(const NodePtrCompare& comp, ExtraChecker extra_checker)
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR bstree_node_checker(const NodePtrCompare& comp, ExtraChecker extra_checker)
       : base_checker_t(extra_checker), comp_(comp)
    {}
 
@@ -186,14 +188,14 @@ class bstree_algorithms : public bstree_algorithms_base<NodeTraits>
    template<class Disposer>
    struct dispose_subtree_disposer
    {
-      inline dispose_subtree_disposer(Disposer &disp, node_ptr subtree)
+      inline BOOST_INTRUSIVE_CXX20_CONSTEXPR dispose_subtree_disposer(Disposer &disp, node_ptr subtree)
          : disposer_(&disp), subtree_(subtree)
       {}
 
-      inline void release()
+      inline BOOST_INTRUSIVE_CXX20_CONSTEXPR void release()
       {  disposer_ = 0;  }
 
-      inline ~dispose_subtree_disposer()
+      inline BOOST_INTRUSIVE_CXX20_CONSTEXPR ~dispose_subtree_disposer()
       {
          if(disposer_){
             dispose_subtree(subtree_, *disposer_);
@@ -213,7 +215,7 @@ class bstree_algorithms : public bstree_algorithms_base<NodeTraits>
    //! <b>Complexity</b>: Constant time.
    //!
    //! <b>Throws</b>: Nothing.
-   inline static node_ptr begin_node(const_node_ptr header) BOOST_NOEXCEPT
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR static node_ptr begin_node(const_node_ptr header) BOOST_NOEXCEPT
    {  return node_traits::get_left(header);   }
 
    //! <b>Requires</b>: 'header' is the header node of a tree.
@@ -223,7 +225,7 @@ class bstree_algorithms : public bstree_algorithms_base<NodeTraits>
    //! <b>Complexity</b>: Constant time.
    //!
    //! <b>Throws</b>: Nothing.
-   inline static node_ptr end_node(const_node_ptr header) BOOST_NOEXCEPT
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR static node_ptr end_node(const_node_ptr header) BOOST_NOEXCEPT
    {  return detail::uncast(header);   }
 
    //! <b>Requires</b>: 'header' is the header node of a tree.
@@ -233,7 +235,7 @@ class bstree_algorithms : public bstree_algorithms_base<NodeTraits>
    //! <b>Complexity</b>: Constant time.
    //!
    //! <b>Throws</b>: Nothing.
-   inline static node_ptr root_node(const_node_ptr header) BOOST_NOEXCEPT
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR static node_ptr root_node(const_node_ptr header) BOOST_NOEXCEPT
    {
       node_ptr p = node_traits::get_parent(header);
       return p ? p : detail::uncast(header);
@@ -247,7 +249,7 @@ class bstree_algorithms : public bstree_algorithms_base<NodeTraits>
    //! <b>Complexity</b>: Constant time.
    //!
    //! <b>Throws</b>: Nothing.
-   inline static bool unique(const_node_ptr n) BOOST_NOEXCEPT
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR static bool unique(const_node_ptr n) BOOST_NOEXCEPT
    { return !NodeTraits::get_parent(n); }
 
    #if defined(BOOST_INTRUSIVE_DOXYGEN_INVOKED)
@@ -276,7 +278,7 @@ class bstree_algorithms : public bstree_algorithms_base<NodeTraits>
    //!   node1 and node2 are not equivalent according to the ordering rules.
    //!
    //!Experimental function
-   static void swap_nodes(node_ptr node1, node_ptr node2) BOOST_NOEXCEPT
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR static void swap_nodes(node_ptr node1, node_ptr node2) BOOST_NOEXCEPT
    {
       if(node1 == node2)
          return;
@@ -300,7 +302,7 @@ class bstree_algorithms : public bstree_algorithms_base<NodeTraits>
    //!   node1 and node2 are not equivalent according to the ordering rules.
    //!
    //!Experimental function
-   static void swap_nodes(node_ptr node1, node_ptr header1, node_ptr node2, node_ptr header2) BOOST_NOEXCEPT
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR static void swap_nodes(node_ptr node1, node_ptr header1, node_ptr node2, node_ptr header2) BOOST_NOEXCEPT
    {
       if(node1 == node2)
          return;
@@ -456,7 +458,7 @@ class bstree_algorithms : public bstree_algorithms_base<NodeTraits>
    //!   new_node is not equivalent to node_to_be_replaced according to the
    //!   ordering rules. This function is faster than erasing and inserting
    //!   the node, since no rebalancing and comparison is needed. Experimental function
-   inline static void replace_node(node_ptr node_to_be_replaced, node_ptr new_node) BOOST_NOEXCEPT
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR static void replace_node(node_ptr node_to_be_replaced, node_ptr new_node) BOOST_NOEXCEPT
    {
       replace_node(node_to_be_replaced, base_type::get_header(node_to_be_replaced), new_node);
    }
@@ -475,7 +477,7 @@ class bstree_algorithms : public bstree_algorithms_base<NodeTraits>
    //!   new_node is not equivalent to node_to_be_replaced according to the
    //!   ordering rules. This function is faster than erasing and inserting
    //!   the node, since no rebalancing or comparison is needed. Experimental function
-   static void replace_node(node_ptr node_to_be_replaced, node_ptr header, node_ptr new_node) BOOST_NOEXCEPT
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR static void replace_node(node_ptr node_to_be_replaced, node_ptr header, node_ptr new_node) BOOST_NOEXCEPT
    {
       BOOST_ASSERT(node_to_be_replaced != new_node);
 
@@ -564,7 +566,7 @@ class bstree_algorithms : public bstree_algorithms_base<NodeTraits>
    //! <b>Throws</b>: Nothing.
    //!
    //! <b>Nodes</b>: If node is inserted in a tree, this function corrupts the tree.
-   static void init(node_ptr n) BOOST_NOEXCEPT
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR static void init(node_ptr n) BOOST_NOEXCEPT
    {
       NodeTraits::set_parent(n, node_ptr());
       NodeTraits::set_left(n, node_ptr());
@@ -576,7 +578,7 @@ class bstree_algorithms : public bstree_algorithms_base<NodeTraits>
    //! <b>Complexity</b>: Constant.
    //!
    //! <b>Throws</b>: Nothing.
-   static bool inited(const_node_ptr n)
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR static bool inited(const_node_ptr n)
    {
       return !NodeTraits::get_parent(n) &&
              !NodeTraits::get_left(n)   &&
@@ -593,7 +595,7 @@ class bstree_algorithms : public bstree_algorithms_base<NodeTraits>
    //! <b>Throws</b>: Nothing.
    //!
    //! <b>Nodes</b>: If header is inserted in a tree, this function corrupts the tree.
-   static void init_header(node_ptr header) BOOST_NOEXCEPT
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR static void init_header(node_ptr header) BOOST_NOEXCEPT
    {
       NodeTraits::set_parent(header, node_ptr());
       NodeTraits::set_left(header, header);
@@ -612,7 +614,7 @@ class bstree_algorithms : public bstree_algorithms_base<NodeTraits>
    //!
    //! <b>Throws</b>: Nothing.
    template<class Disposer>
-   static void clear_and_dispose(node_ptr header, Disposer disposer) BOOST_NOEXCEPT
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR static void clear_and_dispose(node_ptr header, Disposer disposer) BOOST_NOEXCEPT
    {
       node_ptr source_root = NodeTraits::get_parent(header);
       if(!source_root)
@@ -634,7 +636,7 @@ class bstree_algorithms : public bstree_algorithms_base<NodeTraits>
    //!   only be used for more unlink_leftmost_without_rebalance calls.
    //!   This function is normally used to achieve a step by step
    //!   controlled destruction of the tree.
-   static node_ptr unlink_leftmost_without_rebalance(node_ptr header) BOOST_NOEXCEPT
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR static node_ptr unlink_leftmost_without_rebalance(node_ptr header) BOOST_NOEXCEPT
    {
       node_ptr leftmost = NodeTraits::get_left(header);
       if (leftmost == header)
@@ -650,7 +652,7 @@ class bstree_algorithms : public bstree_algorithms_base<NodeTraits>
          if (is_root)
             NodeTraits::set_parent(header, leftmost_right);
          else
-            NodeTraits::set_left(NodeTraits::get_parent(header), leftmost_right);
+            NodeTraits::set_left(leftmost_parent, leftmost_right);
       }
       else if (is_root){
          NodeTraits::set_parent(header, node_ptr());
@@ -664,6 +666,75 @@ class bstree_algorithms : public bstree_algorithms_base<NodeTraits>
       return leftmost;
    }
 
+   //! <b>Requires</b>: header is the header of a tree.
+   //!
+   //! <b>Effects</b>: Unlinks and disposes up to max_nodes nodes of the tree, starting
+   //!   from the leftmost node. Disposes all nodes if there are no more than max_nodes.
+   //!
+   //! <b>Returns</b>: The number of disposed nodes.
+   //!
+   //! <b>Complexity</b>: Amortized linear to max_nodes.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Notes</b>: The remaining nodes still form a search tree, but not a balanced one:
+   //!   like unlink_leftmost_without_rebalance, it's intended to split the destruction
+   //!   of a tree in several steps and the tree can only be used for more destruction calls.
+   template<class Disposer>
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR static std::size_t clear_and_dispose_some(node_ptr header, Disposer disposer, std::size_t max_nodes) BOOST_NOEXCEPT
+   {
+      std::size_t n = 0;
+      for(; n != max_nodes; ++n){
+         const node_ptr x(unlink_leftmost_without_rebalance(header));
+         if(!x)
+            break;
+         init(x);
+         disposer(x);
+      }
+      return n;
+   }
+
+   //! <b>Requires</b>: header is the header of a tree, 0 < i < k.
+   //!
+   //! <b>Effects</b>: Estimates the first node of the i-th of k consecutive ranges of nodes
+   //!   of roughly equal size, descending from the root and assuming that the two subtrees of each
+   //!   node hold the same number of nodes. Estimates are exact for complete trees and
+   //!   good for balanced trees. Nodes returned for increasing i values are never decreasing.
+   //!
+   //! <b>Returns</b>: The estimated first node of the range, the header if the range is empty
+   //!   and placed at the end of the tree.
+   //!
+   //! <b>Complexity</b>: Linear to the height of the tree.
+   //!
+   //! <b>Throws</b>: Nothing.
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR static node_ptr partition_point(const_node_ptr header, std::size_t i, std::size_t k) BOOST_NOEXCEPT
+   {
+      node_ptr x = NodeTraits::get_parent(header);
+      if(!x)
+         return detail::uncast(header);
+      //Estimated positions are scaled to [0, width)
+      const std::size_t width  = std::size_t(-1)/2u;
+      const std::size_t target = (width/k)*i;
+      std::size_t lo = 0u, hi = width;
+      while(true){
+         const std::size_t mid = lo + (hi - lo)/2u;
+         if(target <= mid){
+            const node_ptr l = NodeTraits::get_left(x);
+            if(!l)
+               return x;
+            hi = mid;
+            x = l;
+         }
+         else{
+            const node_ptr r = NodeTraits::get_right(x);
+            if(!r)
+               return base_type::next_node(x);
+            lo = mid;
+            x = r;
+         }
+      }
+   }
+
    //! <b>Requires</b>: 'header' the header of the tree.
    //!
    //! <b>Effects</b>: Returns the number of nodes of the tree.
@@ -671,7 +742,7 @@ class bstree_algorithms : public bstree_algorithms_base<NodeTraits>
    //! <b>Complexity</b>: Linear time.
    //!
    //! <b>Throws</b>: Nothing.
-   static std::size_t size(const_node_ptr header) BOOST_NOEXCEPT
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR static std::size_t size(const_node_ptr header) BOOST_NOEXCEPT
    {
       node_ptr beg(begin_node(header));
       node_ptr end(end_node(header));
@@ -689,7 +760,7 @@ class bstree_algorithms : public bstree_algorithms_base<NodeTraits>
    //! <b>Complexity</b>: Constant.
    //!
    //! <b>Throws</b>: Nothing.
-   static void swap_tree(node_ptr header1, node_ptr header2) BOOST_NOEXCEPT
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR static void swap_tree(node_ptr header1, node_ptr header2) BOOST_NOEXCEPT
    {
       if(header1 == header2)
          return;
@@ -752,7 +823,7 @@ class bstree_algorithms : public bstree_algorithms_base<NodeTraits>
    //!
    //! <b>Throws</b>: If "comp" throws.
    template<class KeyType, class KeyNodePtrCompare>
-   static node_ptr find
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR static node_ptr find
       (const_node_ptr header, const KeyType &key, KeyNodePtrCompare comp)
    {
       node_ptr end = detail::uncast(header);
@@ -782,7 +853,7 @@ class bstree_algorithms : public bstree_algorithms_base<NodeTraits>
    //!
    //! <b>Note</b>: Experimental function, the interface might change.
    template< class KeyType, class KeyNodePtrCompare>
-   static std::pair<node_ptr, node_ptr> bounded_range
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR static std::pair<node_ptr, node_ptr> bounded_range
       ( const_node_ptr header
       , const KeyType &lower_key
       , const KeyType &upper_key
@@ -849,7 +920,7 @@ class bstree_algorithms : public bstree_algorithms_base<NodeTraits>
    //!
    //! <b>Throws</b>: If "comp" throws.
    template<class KeyType, class KeyNodePtrCompare>
-   static std::size_t count
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR static std::size_t count
       (const_node_ptr header, const KeyType &key, KeyNodePtrCompare comp)
    {
       std::pair<node_ptr, node_ptr> ret = equal_range(header, key, comp);
@@ -875,7 +946,7 @@ class bstree_algorithms : public bstree_algorithms_base<NodeTraits>
    //!
    //! <b>Throws</b>: If "comp" throws.
    template<class KeyType, class KeyNodePtrCompare>
-   inline static std::pair<node_ptr, node_ptr> equal_range
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR static std::pair<node_ptr, node_ptr> equal_range
       (const_node_ptr header, const KeyType &key, KeyNodePtrCompare comp)
    {
       return bounded_range(header, key, key, comp, true, true);
@@ -895,7 +966,7 @@ class bstree_algorithms : public bstree_algorithms_base<NodeTraits>
    //!
    //! <b>Throws</b>: If "comp" throws.
    template<class KeyType, class KeyNodePtrCompare>
-   static std::pair<node_ptr, node_ptr> lower_bound_range
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR static std::pair<node_ptr, node_ptr> lower_bound_range
       (const_node_ptr header, const KeyType &key, KeyNodePtrCompare comp)
    {
       node_ptr const lb(lower_bound(header, key, comp));
@@ -919,12 +990,45 @@ class bstree_algorithms : public bstree_algorithms_base<NodeTraits>
    //!
    //! <b>Throws</b>: If "comp" throws.
    template<class KeyType, class KeyNodePtrCompare>
-   inline static node_ptr lower_bound
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR static node_ptr lower_bound
       (const_node_ptr header, const KeyType &key, KeyNodePtrCompare comp)
    {
       return lower_bound_loop(NodeTraits::get_parent(header), detail::uncast(header), key, comp);
    }
 
+   //! <b>Requires</b>: "header" must be the header node of a tree and "finger"
+   //!   a node of that tree or "header". All the elements before "finger" must be less than "key".
+   //!   KeyNodePtrCompare is a function object that induces a strict weak
+   //!   ordering compatible with the strict weak ordering used to create the
+   //!   the tree. KeyNodePtrCompare can compare KeyType with tree's node_ptrs.
+   //!
+   //! <b>Effects</b>: Returns a node_ptr to the first element that is
+   //!   not less than "key" according to "comp" or "header" if that element does
+   //!   not exist. The search climbs from "finger" until it reaches an ancestor that
+   //!   is not less than "key" and then descends from the last climbed node.
+   //!
+   //! <b>Complexity</b>: Logarithmic to the distance between "finger" and the
+   //!   returned node in balanced trees. Linear to the height of the tree in the worst case.
+   //!
+   //! <b>Throws</b>: If "comp" throws.
+   template<class KeyType, class KeyNodePtrCompare>
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR static node_ptr lower_bound_from
+      (const_node_ptr header, node_ptr finger, const KeyType &key, KeyNodePtrCompare comp)
+   {
+      node_ptr const h(detail::uncast(header));
+      if(finger == h || !comp(finger, key))
+         return finger;
+      //The subtree of x holds all the elements between finger and the lower bound,
+      //and p, the successor of that subtree, is not less than key.
+      node_ptr x(finger);
+      node_ptr p(NodeTraits::get_parent(x));
+      while(p != h && !(x == NodeTraits::get_left(p) && !comp(p, key))){
+         x = p;
+         p = NodeTraits::get_parent(x);
+      }
+      return lower_bound_loop(x, p, key, comp);
+   }
+
    //! <b>Requires</b>: "header" must be the header node of a tree.
    //!   KeyNodePtrCompare is a function object that induces a strict weak
    //!   ordering compatible with the strict weak ordering used to create the
@@ -937,7 +1041,7 @@ class bstree_algorithms : public bstree_algorithms_base<NodeTraits>
    //!
    //! <b>Throws</b>: If "comp" throws.
    template<class KeyType, class KeyNodePtrCompare>
-   inline static node_ptr upper_bound
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR static node_ptr upper_bound
       (const_node_ptr header, const KeyType &key, KeyNodePtrCompare comp)
    {
       return upper_bound_loop(NodeTraits::get_parent(header), detail::uncast(header), key, comp);
@@ -960,7 +1064,7 @@ class bstree_algorithms : public bstree_algorithms_base<NodeTraits>
    //! <b>Notes</b>: This function has only sense if a "insert_unique_check" has been
    //!   previously executed to fill "commit_data". No value should be inserted or
    //!   erased between the "insert_check" and "insert_commit" calls.
-   inline static void insert_unique_commit
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR static void insert_unique_commit
       (node_ptr header, node_ptr new_value, const insert_commit_data &commit_data) BOOST_NOEXCEPT
    {  return insert_commit(header, new_value, commit_data); }
 
@@ -999,7 +1103,7 @@ class bstree_algorithms : public bstree_algorithms_base<NodeTraits>
    //!   "commit_data" remains valid for a subsequent "insert_unique_commit" only
    //!   if no more objects are inserted or erased from the set.
    template<class KeyType, class KeyNodePtrCompare>
-   static std::pair<node_ptr, bool> insert_unique_check
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR static std::pair<node_ptr, bool> insert_unique_check
       (const_node_ptr header, const KeyType &key
       ,KeyNodePtrCompare comp, insert_commit_data &commit_data
          #ifndef BOOST_INTRUSIVE_DOXYGEN_INVOKED
@@ -1077,7 +1181,7 @@ class bstree_algorithms : public bstree_algorithms_base<NodeTraits>
    //!   "commit_data" remains valid for a subsequent "insert_unique_commit" only
    //!   if no more objects are inserted or erased from the set.
    template<class KeyType, class KeyNodePtrCompare>
-   static std::pair<node_ptr, bool> insert_unique_check
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR static std::pair<node_ptr, bool> insert_unique_check
       (const_node_ptr header, node_ptr hint, const KeyType &key
       ,KeyNodePtrCompare comp, insert_commit_data &commit_data
          #ifndef BOOST_INTRUSIVE_DOXYGEN_INVOKED
@@ -1117,7 +1221,7 @@ class bstree_algorithms : public bstree_algorithms_base<NodeTraits>
    //!
    //! <b>Throws</b>: If "comp" throws.
    template<class NodePtrCompare>
-   static node_ptr insert_equal
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR static node_ptr insert_equal
       (node_ptr h, node_ptr hint, node_ptr new_node, NodePtrCompare comp
          #ifndef BOOST_INTRUSIVE_DOXYGEN_INVOKED
          , std::size_t *pdepth = 0
@@ -1143,7 +1247,7 @@ class bstree_algorithms : public bstree_algorithms_base<NodeTraits>
    //!
    //! <b>Throws</b>: If "comp" throws.
    template<class NodePtrCompare>
-   static node_ptr insert_equal_upper_bound
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR static node_ptr insert_equal_upper_bound
       (node_ptr h, node_ptr new_node, NodePtrCompare comp
          #ifndef BOOST_INTRUSIVE_DOXYGEN_INVOKED
          , std::size_t *pdepth = 0
@@ -1169,7 +1273,7 @@ class bstree_algorithms : public bstree_algorithms_base<NodeTraits>
    //!
    //! <b>Throws</b>: If "comp" throws.
    template<class NodePtrCompare>
-   static node_ptr insert_equal_lower_bound
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR static node_ptr insert_equal_lower_bound
       (node_ptr h, node_ptr new_node, NodePtrCompare comp
          #ifndef BOOST_INTRUSIVE_DOXYGEN_INVOKED
          , std::size_t *pdepth = 0
@@ -1196,7 +1300,7 @@ class bstree_algorithms : public bstree_algorithms_base<NodeTraits>
    //!
    //! <b>Note</b>: If "pos" is not the successor of the newly inserted "new_node"
    //! tree invariants might be broken.
-   static node_ptr insert_before
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR static node_ptr insert_before
       (node_ptr header, node_ptr pos, node_ptr new_node
          #ifndef BOOST_INTRUSIVE_DOXYGEN_INVOKED
          , std::size_t *pdepth = 0
@@ -1222,7 +1326,7 @@ class bstree_algorithms : public bstree_algorithms_base<NodeTraits>
    //! <b>Note</b>: If "new_node" is less than the greatest inserted key
    //! tree invariants are broken. This function is slightly faster than
    //! using "insert_before".
-   static void push_back
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR static void push_back
       (node_ptr header, node_ptr new_node
          #ifndef BOOST_INTRUSIVE_DOXYGEN_INVOKED
          , std::size_t *pdepth = 0
@@ -1247,7 +1351,7 @@ class bstree_algorithms : public bstree_algorithms_base<NodeTraits>
    //! <b>Note</b>: If "new_node" is greater than the lowest inserted key
    //! tree invariants are broken. This function is slightly faster than
    //! using "insert_before".
-   static void push_front
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR static void push_front
       (node_ptr header, node_ptr new_node
          #ifndef BOOST_INTRUSIVE_DOXYGEN_INVOKED
          , std::size_t *pdepth = 0
@@ -1268,7 +1372,7 @@ class bstree_algorithms : public bstree_algorithms_base<NodeTraits>
    //! <b>Complexity</b>: Logarithmic to the number of nodes in the tree.
    //!
    //! <b>Throws</b>: Nothing.
-   static std::size_t depth(const_node_ptr n) BOOST_NOEXCEPT
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR static std::size_t depth(const_node_ptr n) BOOST_NOEXCEPT
    {
       std::size_t depth = 0;
       node_ptr p_parent;
@@ -1297,7 +1401,7 @@ class bstree_algorithms : public bstree_algorithms_base<NodeTraits>
    //!
    //! <b>Throws</b>: If cloner functor throws. If this happens target nodes are disposed.
    template <class Cloner, class Disposer>
-   static void clone
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR static void clone
       (const_node_ptr source_header, node_ptr target_header, Cloner cloner, Disposer disposer)
    {
       if(!unique(target_header)){
@@ -1306,7 +1410,7 @@ class bstree_algorithms : public bstree_algorithms_base<NodeTraits>
 
       node_ptr leftmost, rightmost;
       node_ptr new_root = clone_subtree
-         (source_header, target_header, cloner, disposer, leftmost, rightmost);
+         (NodeTraits::get_parent(source_header), target_header, cloner, disposer, leftmost, rightmost);
 
       //Now update header node
       NodeTraits::set_parent(target_header, new_root);
@@ -1314,6 +1418,43 @@ class bstree_algorithms : public bstree_algorithms_base<NodeTraits>
       NodeTraits::set_right (target_header, rightmost);
    }
 
+   //! <b>Requires</b>: "cloner" must be a function
+   //!   object taking a node_ptr and returning a new cloned node of it. "disposer" must
+   //!   take a node_ptr and shouldn't throw. Both must be safe to call concurrently.
+   //!   "executor" must model the executor concept described in sequential_executor.
+   //!
+   //! <b>Effects</b>: Same as clone(source_header, target_header, cloner, disposer), but
+   //!   the subtrees placed below the "fork_levels" top levels of the source tree are
+   //!   cloned by up to 2^fork_levels tasks run through <tt>executor(task1, task2)</tt>.
+   //!   If "cloner" throws, all cloned target nodes are disposed using
+   //!   <tt>void disposer(node_ptr)</tt> and the target tree is left empty.
+   //!
+   //! <b>Complexity</b>: Linear to the number of element of the source tree plus the
+   //!   number of elements of tree target tree when calling this function.
+   //!
+   //! <b>Throws</b>: If cloner functor or the executor throw. If this happens target nodes are disposed.
+   template <class Cloner, class Disposer, class Executor>
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR static void clone
+      ( const_node_ptr source_header, node_ptr target_header, Cloner cloner, Disposer disposer
+      , Executor executor, std::size_t fork_levels)
+   {
+      if(!unique(target_header)){
+         clear_and_dispose(target_header, disposer);
+      }
+
+      const node_ptr source_root = NodeTraits::get_parent(source_header);
+      if(source_root){
+         node_ptr leftmost, rightmost;
+         node_ptr new_root = clone_subtree_forked
+            (source_root, target_header, cloner, disposer, executor, fork_levels, leftmost, rightmost);
+
+         //Now update header node
+         NodeTraits::set_parent(target_header, new_root);
+         NodeTraits::set_left  (target_header, leftmost);
+         NodeTraits::set_right (target_header, rightmost);
+      }
+   }
+
    //! <b>Requires</b>: header must be the header of a tree, z a node
    //!    of that tree and z != header.
    //!
@@ -1322,7 +1463,7 @@ class bstree_algorithms : public bstree_algorithms_base<NodeTraits>
    //! <b>Complexity</b>: Amortized constant time.
    //!
    //! <b>Throws</b>: Nothing.
-   inline static void erase(node_ptr header, node_ptr z) BOOST_NOEXCEPT
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR static void erase(node_ptr header, node_ptr z) BOOST_NOEXCEPT
    {
       data_for_rebalance ignored;
       erase(header, z, ignored);
@@ -1341,7 +1482,7 @@ class bstree_algorithms : public bstree_algorithms_base<NodeTraits>
    //!
    //! <b>Throws</b>: If the comparison throws.
    template<class NodePtrCompare>
-   inline static bool transfer_unique
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR static bool transfer_unique
       (node_ptr header1, NodePtrCompare comp, node_ptr header2, node_ptr z)
    {
       data_for_rebalance ignored;
@@ -1358,7 +1499,7 @@ class bstree_algorithms : public bstree_algorithms_base<NodeTraits>
    //!
    //! <b>Throws</b>: If the comparison throws.
    template<class NodePtrCompare>
-   inline static void transfer_equal
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR static void transfer_equal
       (node_ptr header1, NodePtrCompare comp, node_ptr header2, node_ptr z)
    {
       data_for_rebalance ignored;
@@ -1372,7 +1513,7 @@ class bstree_algorithms : public bstree_algorithms_base<NodeTraits>
    //! <b>Complexity</b>: Average complexity is constant time.
    //!
    //! <b>Throws</b>: Nothing.
-   static void unlink(node_ptr n) BOOST_NOEXCEPT
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR static void unlink(node_ptr n) BOOST_NOEXCEPT
    {
       node_ptr x = NodeTraits::get_parent(n);
       if(x){
@@ -1382,6 +1523,47 @@ class bstree_algorithms : public bstree_algorithms_base<NodeTraits>
       }
    }
 
+   //! <b>Requires</b>: header must be the header of a tree, [b, e) a range of nodes of
+   //!   that tree and "disposer" an object function taking a node_ptr parameter that
+   //!   shouldn't throw.
+   //!
+   //! <b>Effects</b>: Splits the tree before b and before e and joins the nodes placed
+   //!   before b with e and the nodes placed after e, detaching [b, e) from the tree as a
+   //!   subtree. Then calls <tt>void disposer::operator()(node_ptr)</tt> for every
+   //!   node of the detached range. No rebalancing is performed.
+   //!
+   //! <b>Returns</b>: The number of erased nodes.
+   //!
+   //! <b>Complexity</b>: Linear to the height of the tree plus the number of erased nodes.
+   //!
+   //! <b>Throws</b>: Nothing.
+   template<class Disposer>
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR static std::size_t erase_range_and_dispose(node_ptr header, node_ptr b, node_ptr e, Disposer disposer) BOOST_NOEXCEPT
+   {
+      subtree_joiner j;
+      return erase_range_and_dispose(header, b, e, j, disposer);
+   }
+
+   //! <b>Requires</b>: header must be the header of a tree, "pred" an object function
+   //!   taking a node_ptr parameter and "disposer" an object function taking a node_ptr
+   //!   parameter that shouldn't throw.
+   //!
+   //! <b>Effects</b>: Erases the nodes for which pred returns true, in order, calling
+   //!   <tt>void disposer::operator()(node_ptr)</tt> for them. Nodes are erased one by one
+   //!   while most visited nodes are kept. When erased nodes outnumber kept nodes,
+   //!   the tree is flattened to a vine, the rest of the nodes are filtered
+   //!   and the tree is rebuilt balanced from the remaining nodes.
+   //!
+   //! <b>Returns</b>: The number of erased nodes.
+   //!
+   //! <b>Complexity</b>: Linear.
+   //!
+   //! <b>Throws</b>: If "pred" throws. Basic guarantee: the tree keeps the nodes
+   //!   not erased before the exception.
+   template<class NodePred, class Disposer>
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR static std::size_t erase_if_and_dispose(node_ptr header, NodePred pred, Disposer disposer)
+   {  return erase_if_and_dispose(header, pred, disposer, subtree_rebuilder());  }
+
    //! <b>Requires</b>: header must be the header of a tree.
    //!
    //! <b>Effects</b>: Rebalances the tree.
@@ -1389,7 +1571,7 @@ class bstree_algorithms : public bstree_algorithms_base<NodeTraits>
    //! <b>Throws</b>: Nothing.
    //!
    //! <b>Complexity</b>: Linear.
-   static void rebalance(node_ptr header) BOOST_NOEXCEPT
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR static void rebalance(node_ptr header) BOOST_NOEXCEPT
    {
       node_ptr root = NodeTraits::get_parent(header);
       if(root){
@@ -1406,7 +1588,7 @@ class bstree_algorithms : public bstree_algorithms_base<NodeTraits>
    //! <b>Throws</b>: Nothing.
    //!
    //! <b>Complexity</b>: Linear.
-   static node_ptr rebalance_subtree(node_ptr old_root) BOOST_NOEXCEPT
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR static node_ptr rebalance_subtree(node_ptr old_root) BOOST_NOEXCEPT
    {
       //Taken from:
       //"Tree rebalancing in optimal time and space"
@@ -1455,7 +1637,7 @@ class bstree_algorithms : public bstree_algorithms_base<NodeTraits>
    //! <b>Note</b>: The method might not have effect when asserts are turned off (e.g., with NDEBUG).
    //!   Experimental function, interface might change in future versions.
    template<class Checker>
-   static void check(const_node_ptr header, Checker checker, typename Checker::return_type& checker_return)
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR static void check(const_node_ptr header, Checker checker, typename Checker::return_type& checker_return)
    {
       const_node_ptr root_node_ptr = NodeTraits::get_parent(header);
       if (!root_node_ptr){
@@ -1480,8 +1662,218 @@ class bstree_algorithms : public bstree_algorithms_base<NodeTraits>
 
    protected:
 
+   //Joins subtrees of a tree without balancing information: the
+   //subtrees are just linked as the children of the joining node
+   struct subtree_joiner
+   {
+      BOOST_INTRUSIVE_CXX20_CONSTEXPR static std::size_t height(node_ptr)
+      {  return 0u;  }
+
+      BOOST_INTRUSIVE_CXX20_CONSTEXPR static std::size_t child_height(node_ptr, std::size_t, bool)
+      {  return 0u;  }
+
+      BOOST_INTRUSIVE_CXX20_CONSTEXPR static std::size_t parent_height(node_ptr, std::size_t, bool)
+      {  return 0u;  }
+
+      BOOST_INTRUSIVE_CXX20_CONSTEXPR static void make_root(node_ptr)
+      {}
+
+      BOOST_INTRUSIVE_CXX20_CONSTEXPR static node_ptr join(node_ptr, node_ptr l, std::size_t, node_ptr x, node_ptr r, std::size_t, std::size_t &h)
+      {
+         h = 0u;
+         link_children(x, l, r);
+         return x;
+      }
+   };
+
+   template<class Disposer>
+   struct counting_disposer
+   {
+      counting_disposer(Disposer &disposer, std::size_t &n)
+         : disposer_(&disposer), n_(&n)
+      {}
+
+      void operator()(node_ptr p)
+      {
+         ++*n_;
+         (*disposer_)(p);
+      }
+
+      Disposer *disposer_;
+      std::size_t *n_;
+   };
+
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR static void link_children(node_ptr x, node_ptr l, node_ptr r) BOOST_NOEXCEPT
+   {
+      NodeTraits::set_left(x, l);
+      NodeTraits::set_right(x, r);
+      if(l)
+         NodeTraits::set_parent(l, x);
+      if(r)
+         NodeTraits::set_parent(r, x);
+   }
+
+   //Splits the tree rooted at the node whose parent is "header" in the nodes placed before x
+   //(l, with height hl) and the nodes placed after x (r, with height hr). The subtrees
+   //found in the path from x to the root are joined bottom-up with l or r.
+   //The header is used by the joiner as a temporary header of the joined subtrees.
+   template<class Joiner>
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR static void split_subtree
+      (node_ptr header, node_ptr x, Joiner &j, node_ptr &l, std::size_t &hl, node_ptr &r, std::size_t &hr) BOOST_NOEXCEPT
+   {
+      std::size_t hc = j.height(x);
+      l  = NodeTraits::get_left(x);
+      r  = NodeTraits::get_right(x);
+      hl = j.child_height(x, hc, true);
+      hr = j.child_height(x, hc, false);
+      node_ptr c(x), p(NodeTraits::get_parent(x));
+      while(p != header){
+         const node_ptr p_parent(NodeTraits::get_parent(p));
+         const bool c_is_left = NodeTraits::get_left(p) == c;
+         const std::size_t hp = j.parent_height(p, hc, c_is_left);
+         const std::size_t hs = j.child_height(p, hp, !c_is_left);
+         if(c_is_left){
+            const node_ptr s(NodeTraits::get_right(p));
+            r = j.join(header, r, hr, p, s, hs, hr);
+         }
+         else{
+            const node_ptr s(NodeTraits::get_left(p));
+            l = j.join(header, s, hs, p, l, hl, hl);
+         }
+         c  = p;
+         hc = hp;
+         p  = p_parent;
+      }
+   }
+
+   template<class Joiner, class Disposer>
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR static std::size_t erase_range_and_dispose
+      (node_ptr header, node_ptr b, node_ptr e, Joiner &j, Disposer disposer) BOOST_NOEXCEPT
+   {
+      if(b == e)
+         return 0u;
+      node_ptr l, r, m;
+      std::size_t hl, hr;
+      split_subtree(header, b, j, l, hl, m, hr);
+      if(e != header){
+         //e is placed after b: split the nodes placed after b before e
+         //and join the remaining parts with e
+         NodeTraits::set_parent(m, header);
+         std::size_t hm;
+         split_subtree(header, e, j, m, hm, r, hr);
+         l = j.join(header, l, hl, e, r, hr, hl);
+      }
+      j.make_root(l);
+      NodeTraits::set_parent(header, l);
+      if(l){
+         NodeTraits::set_parent(l, header);
+         NodeTraits::set_left(header, base_type::minimum(l));
+         NodeTraits::set_right(header, base_type::maximum(l));
+      }
+      else{
+         NodeTraits::set_left(header, header);
+         NodeTraits::set_right(header, header);
+      }
+      //b and the nodes placed between b and e form the detached subtree
+      NodeTraits::set_left(b, node_ptr());
+      NodeTraits::set_right(b, m);
+      std::size_t n = 0u;
+      dispose_subtree(b, counting_disposer<Disposer>(disposer, n));
+      return n;
+   }
+
+   //Erases nodes and sets the balancing information of rebuilt trees
+   //for trees without balancing information
+   struct subtree_rebuilder
+   {
+      BOOST_INTRUSIVE_CXX20_CONSTEXPR static void erase(node_ptr header, node_ptr z)
+      {  bstree_algorithms::erase(header, z);  }
+
+      BOOST_INTRUSIVE_CXX20_CONSTEXPR static void rebuilt(node_ptr, std::size_t)
+      {}
+   };
+
+   //Links the vine hanging from the right link of the header and formed
+   //by "size" nodes as a balanced tree of the header, on destruction
+   template<class Rebuilder>
+   struct vine_rebuilder
+   {
+      vine_rebuilder(node_ptr header, std::size_t &size)
+         : header_(header), size_(&size)
+      {}
+
+      ~vine_rebuilder()
+      {
+         const std::size_t size = *size_;
+         if(!size){
+            init_header(header_);
+            return;
+         }
+         vine_to_subtree(header_, size);
+         const node_ptr root(NodeTraits::get_right(header_));
+         NodeTraits::set_parent(header_, root);
+         NodeTraits::set_left(header_, base_type::minimum(root));
+         NodeTraits::set_right(header_, base_type::maximum(root));
+         Rebuilder::rebuilt(root, size);
+      }
+
+      const node_ptr header_;
+      std::size_t *size_;
+   };
+
+   template<class NodePred, class Disposer, class Rebuilder>
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR static std::size_t erase_if_and_dispose(node_ptr header, NodePred pred, Disposer disposer, Rebuilder)
+   {
+      std::size_t erased = 0u, kept = 0u;
+      for(node_ptr n = begin_node(header); n != header; ){
+         const node_ptr next(base_type::next_node(n));
+         if(pred(n)){
+            if(erased > kept && erased >= min_erased_to_rebuild){
+               return erased + erase_if_and_rebuild<Rebuilder>(header, n, pred, disposer);
+            }
+            Rebuilder::erase(header, n);
+            disposer(n);
+            ++erased;
+         }
+         else{
+            ++kept;
+         }
+         n = next;
+      }
+      return erased;
+   }
+
+   static const std::size_t min_erased_to_rebuild = 16u;
+
+   //Flattens the tree to a vine, erases "first" and the nodes placed after "first"
+   //for which pred returns true and rebuilds a balanced tree
+   template<class Rebuilder, class NodePred, class Disposer>
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR static std::size_t erase_if_and_rebuild(node_ptr header, node_ptr first, NodePred &pred, Disposer &disposer)
+   {
+      NodeTraits::set_right(header, NodeTraits::get_parent(header));
+      std::size_t size, erased = 0u;
+      subtree_to_vine(header, size);
+      vine_rebuilder<Rebuilder> rebuilder(header, size);
+      bool filter = false;
+      for(node_ptr prev(header), x(NodeTraits::get_right(header)); x; ){
+         const node_ptr x_next(NodeTraits::get_right(x));
+         if(x == first || (filter && pred(x))){
+            filter = true;
+            NodeTraits::set_right(prev, x_next);
+            --size;
+            ++erased;
+            disposer(x);
+         }
+         else{
+            prev = x;
+         }
+         x = x_next;
+      }
+      return erased;
+   }
+
    template<class NodePtrCompare>
-   static bool transfer_unique
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR static bool transfer_unique
       (node_ptr header1, NodePtrCompare comp, node_ptr header2, node_ptr z, data_for_rebalance &info)
    {
       insert_commit_data commit_data;
@@ -1494,7 +1886,7 @@ class bstree_algorithms : public bstree_algorithms_base<NodeTraits>
    }
 
    template<class NodePtrCompare>
-   static void transfer_equal
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR static void transfer_equal
       (node_ptr header1, NodePtrCompare comp, node_ptr header2, node_ptr z, data_for_rebalance &info)
    {
       insert_commit_data commit_data;
@@ -1503,7 +1895,7 @@ class bstree_algorithms : public bstree_algorithms_base<NodeTraits>
       insert_commit(header1, z, commit_data);
    }
 
-   static void erase(node_ptr header, node_ptr z, data_for_rebalance &info)
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR static void erase(node_ptr header, node_ptr z, data_for_rebalance &info)
    {
       node_ptr y(z);
       node_ptr x;
@@ -1592,7 +1984,7 @@ class bstree_algorithms : public bstree_algorithms_base<NodeTraits>
    //! <b>Complexity</b>: Linear time.
    //!
    //! <b>Throws</b>: Nothing.
-   static std::size_t subtree_size(const_node_ptr subtree) BOOST_NOEXCEPT
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR static std::size_t subtree_size(const_node_ptr subtree) BOOST_NOEXCEPT
    {
       std::size_t count = 0;
       if (subtree){
@@ -1635,7 +2027,7 @@ class bstree_algorithms : public bstree_algorithms_base<NodeTraits>
    //! <b>Complexity</b>: Constant.
    //!
    //! <b>Throws</b>: Nothing.
-   inline static bool is_left_child(node_ptr p) BOOST_NOEXCEPT
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR static bool is_left_child(node_ptr p) BOOST_NOEXCEPT
    {  return NodeTraits::get_left(NodeTraits::get_parent(p)) == p;  }
 
    //! <b>Requires</b>: p is a node of a tree.
@@ -1645,10 +2037,10 @@ class bstree_algorithms : public bstree_algorithms_base<NodeTraits>
    //! <b>Complexity</b>: Constant.
    //!
    //! <b>Throws</b>: Nothing.
-   inline static bool is_right_child(node_ptr p) BOOST_NOEXCEPT
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR static bool is_right_child(node_ptr p) BOOST_NOEXCEPT
    {  return NodeTraits::get_right(NodeTraits::get_parent(p)) == p;  }
 
-   static void insert_before_check
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR static void insert_before_check
       (node_ptr header, node_ptr pos
       , insert_commit_data &commit_data
          #ifndef BOOST_INTRUSIVE_DOXYGEN_INVOKED
@@ -1667,7 +2059,7 @@ class bstree_algorithms : public bstree_algorithms_base<NodeTraits>
       }
    }
 
-   static void push_back_check
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR static void push_back_check
       (node_ptr header, insert_commit_data &commit_data
          #ifndef BOOST_INTRUSIVE_DOXYGEN_INVOKED
          , std::size_t *pdepth = 0
@@ -1682,7 +2074,7 @@ class bstree_algorithms : public bstree_algorithms_base<NodeTraits>
       commit_data.node = prev;
    }
 
-   static void push_front_check
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR static void push_front_check
       (node_ptr header, insert_commit_data &commit_data
          #ifndef BOOST_INTRUSIVE_DOXYGEN_INVOKED
          , std::size_t *pdepth = 0
@@ -1698,7 +2090,7 @@ class bstree_algorithms : public bstree_algorithms_base<NodeTraits>
    }
 
    template<class NodePtrCompare>
-   static void insert_equal_check
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR static void insert_equal_check
       (node_ptr header, node_ptr hint, node_ptr new_node, NodePtrCompare comp
       , insert_commit_data &commit_data
       /// @cond
@@ -1727,7 +2119,7 @@ class bstree_algorithms : public bstree_algorithms_base<NodeTraits>
    }
 
    template<class NodePtrCompare>
-   static void insert_equal_upper_bound_check
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR static void insert_equal_upper_bound_check
       (node_ptr h, node_ptr new_node, NodePtrCompare comp, insert_commit_data & commit_data, std::size_t *pdepth = 0)
    {
       std::size_t depth = 0;
@@ -1746,7 +2138,7 @@ class bstree_algorithms : public bstree_algorithms_base<NodeTraits>
    }
 
    template<class NodePtrCompare>
-   static void insert_equal_lower_bound_check
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR static void insert_equal_lower_bound_check
       (node_ptr h, node_ptr new_node, NodePtrCompare comp, insert_commit_data & commit_data, std::size_t *pdepth = 0)
    {
       std::size_t depth = 0;
@@ -1764,7 +2156,7 @@ class bstree_algorithms : public bstree_algorithms_base<NodeTraits>
       commit_data.node = y;
    }
 
-   static void insert_commit
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR static void insert_commit
       (node_ptr header, node_ptr new_node, const insert_commit_data &commit_data) BOOST_NOEXCEPT
    {
       //Check if commit_data has not been initialized by a insert_unique_check call.
@@ -1791,7 +2183,7 @@ class bstree_algorithms : public bstree_algorithms_base<NodeTraits>
    }
 
    //Fix header and own's parent data when replacing x with own, providing own's old data with parent
-   static void set_child(node_ptr header, node_ptr new_child, node_ptr new_parent, const bool link_left) BOOST_NOEXCEPT
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR static void set_child(node_ptr header, node_ptr new_child, node_ptr new_parent, const bool link_left) BOOST_NOEXCEPT
    {
       if(new_parent == header)
          NodeTraits::set_parent(header, new_child);
@@ -1802,7 +2194,7 @@ class bstree_algorithms : public bstree_algorithms_base<NodeTraits>
    }
 
    // rotate p to left (no header and p's parent fixup)
-   static void rotate_left_no_parent_fix(node_ptr p, node_ptr p_right) BOOST_NOEXCEPT
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR static void rotate_left_no_parent_fix(node_ptr p, node_ptr p_right) BOOST_NOEXCEPT
    {
       node_ptr p_right_left(NodeTraits::get_left(p_right));
       NodeTraits::set_right(p, p_right_left);
@@ -1814,7 +2206,7 @@ class bstree_algorithms : public bstree_algorithms_base<NodeTraits>
    }
 
    // rotate p to left (with header and p's parent fixup)
-   static void rotate_left(node_ptr p, node_ptr p_right, node_ptr p_parent, node_ptr header) BOOST_NOEXCEPT
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR static void rotate_left(node_ptr p, node_ptr p_right, node_ptr p_parent, node_ptr header) BOOST_NOEXCEPT
    {
       const bool p_was_left(NodeTraits::get_left(p_parent) == p);
       rotate_left_no_parent_fix(p, p_right);
@@ -1823,7 +2215,7 @@ class bstree_algorithms : public bstree_algorithms_base<NodeTraits>
    }
 
    // rotate p to right (no header and p's parent fixup)
-   static void rotate_right_no_parent_fix(node_ptr p, node_ptr p_left) BOOST_NOEXCEPT
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR static void rotate_right_no_parent_fix(node_ptr p, node_ptr p_left) BOOST_NOEXCEPT
    {
       node_ptr p_left_right(NodeTraits::get_right(p_left));
       NodeTraits::set_left(p, p_left_right);
@@ -1835,7 +2227,7 @@ class bstree_algorithms : public bstree_algorithms_base<NodeTraits>
    }
 
    // rotate p to right (with header and p's parent fixup)
-   static void rotate_right(node_ptr p, node_ptr p_left, node_ptr p_parent, node_ptr header) BOOST_NOEXCEPT
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR static void rotate_right(node_ptr p, node_ptr p_left, node_ptr p_parent, node_ptr header) BOOST_NOEXCEPT
    {
       const bool p_was_left(NodeTraits::get_left(p_parent) == p);
       rotate_right_no_parent_fix(p, p_left);
@@ -1845,7 +2237,7 @@ class bstree_algorithms : public bstree_algorithms_base<NodeTraits>
 
    private:
 
-   static void subtree_to_vine(node_ptr vine_tail, std::size_t &size) BOOST_NOEXCEPT
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR static void subtree_to_vine(node_ptr vine_tail, std::size_t &size) BOOST_NOEXCEPT
    {
       //Inspired by LibAVL:
       //It uses a clever optimization for trees with parent pointers.
@@ -1872,7 +2264,7 @@ class bstree_algorithms : public bstree_algorithms_base<NodeTraits>
       size = len;
    }
 
-   static void compress_subtree(node_ptr scanner, std::size_t count) BOOST_NOEXCEPT
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR static void compress_subtree(node_ptr scanner, std::size_t count) BOOST_NOEXCEPT
    {
       while(count--){   //compress "count" spine nodes in the tree with pseudo-root scanner
          node_ptr child = NodeTraits::get_right(scanner);
@@ -1889,7 +2281,7 @@ class bstree_algorithms : public bstree_algorithms_base<NodeTraits>
       }
    }
 
-   static void vine_to_subtree(node_ptr super_root, std::size_t count) BOOST_NOEXCEPT
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR static void vine_to_subtree(node_ptr super_root, std::size_t count) BOOST_NOEXCEPT
    {
       const std::size_t one_szt = 1u;
       std::size_t leaf_nodes = count + one_szt - std::size_t(one_szt << detail::floor_log2(count + one_szt));
@@ -1916,7 +2308,7 @@ class bstree_algorithms : public bstree_algorithms_base<NodeTraits>
    //! <b>Complexity</b>: Logarithmic.
    //!
    //! <b>Throws</b>: Nothing.
-   static node_ptr get_root(node_ptr n) BOOST_NOEXCEPT
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR static node_ptr get_root(node_ptr n) BOOST_NOEXCEPT
    {
       BOOST_INTRUSIVE_INVARIANT_ASSERT((!inited(n)));
       node_ptr x = NodeTraits::get_parent(n);
@@ -1932,14 +2324,13 @@ class bstree_algorithms : public bstree_algorithms_base<NodeTraits>
    }
 
    template <class Cloner, class Disposer>
-   static node_ptr clone_subtree
-      (const_node_ptr source_parent, node_ptr target_parent
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR static node_ptr clone_subtree
+      (node_ptr source_root, node_ptr target_parent
       , Cloner cloner, Disposer disposer
       , node_ptr &leftmost_out, node_ptr &rightmost_out
       )
    {
       node_ptr target_sub_root = target_parent;
-      node_ptr source_root = NodeTraits::get_parent(source_parent);
       if(!source_root){
          leftmost_out = rightmost_out = source_root;
       }
@@ -2007,8 +2398,83 @@ class bstree_algorithms : public bstree_algorithms_base<NodeTraits>
       return target_sub_root;
    }
 
+   //Clones the subtree rooted at source_root. Results are written through
+   //pointers as executors are allowed to copy the task.
+   template <class Cloner, class Disposer, class Executor>
+   struct subtree_clone_task
+   {
+      subtree_clone_task( node_ptr source_root, node_ptr target_parent, Cloner cloner, Disposer disposer
+                        , Executor &executor, std::size_t fork_levels
+                        , node_ptr &root_out, node_ptr &leftmost_out, node_ptr &rightmost_out)
+         : source_root_(source_root), target_parent_(target_parent), cloner_(cloner), disposer_(disposer)
+         , executor_(&executor), fork_levels_(fork_levels)
+         , root_out_(&root_out), leftmost_out_(&leftmost_out), rightmost_out_(&rightmost_out)
+      {}
+
+      void operator()()
+      {
+         if(source_root_){
+            *root_out_ = clone_subtree_forked
+               ( source_root_, target_parent_, cloner_, disposer_, *executor_, fork_levels_
+               , *leftmost_out_, *rightmost_out_);
+         }
+      }
+
+      node_ptr source_root_;
+      node_ptr target_parent_;
+      Cloner cloner_;
+      Disposer disposer_;
+      Executor *executor_;
+      std::size_t fork_levels_;
+      node_ptr *root_out_;
+      node_ptr *leftmost_out_;
+      node_ptr *rightmost_out_;
+   };
+
+   template <class Cloner, class Disposer, class Executor>
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR static node_ptr clone_subtree_forked
+      ( node_ptr source_root, node_ptr target_parent
+      , Cloner &cloner, Disposer &disposer, Executor &executor, std::size_t fork_levels
+      , node_ptr &leftmost_out, node_ptr &rightmost_out)
+   {
+      if(!fork_levels){
+         return clone_subtree(source_root, target_parent, cloner, disposer, leftmost_out, rightmost_out);
+      }
+      const node_ptr target_sub_root = cloner(source_root);
+      NodeTraits::set_left(target_sub_root, node_ptr());
+      NodeTraits::set_right(target_sub_root, node_ptr());
+      NodeTraits::set_parent(target_sub_root, target_parent);
+      dispose_subtree_disposer<Disposer> rollback(disposer, target_sub_root);
+
+      //Children are linked when both tasks have finished, so tasks don't write the same node
+      node_ptr left = node_ptr(), right = node_ptr();
+      node_ptr left_leftmost, left_rightmost, right_leftmost, right_rightmost;
+      subtree_clone_task<Cloner, Disposer, Executor> left_task
+         ( NodeTraits::get_left(source_root), target_sub_root, cloner, disposer, executor, fork_levels - 1u
+         , left, left_leftmost, left_rightmost);
+      subtree_clone_task<Cloner, Disposer, Executor> right_task
+         ( NodeTraits::get_right(source_root), target_sub_root, cloner, disposer, executor, fork_levels - 1u
+         , right, right_leftmost, right_rightmost);
+      BOOST_INTRUSIVE_TRY{
+         executor(left_task, right_task);
+      }
+      BOOST_INTRUSIVE_CATCH(...){
+         //A failed task has already disposed its own nodes
+         dispose_subtree(left, disposer);
+         dispose_subtree(right, disposer);
+         BOOST_INTRUSIVE_RETHROW;
+      }
+      BOOST_INTRUSIVE_CATCH_END
+      NodeTraits::set_left(target_sub_root, left);
+      NodeTraits::set_right(target_sub_root, right);
+      rollback.release();
+      leftmost_out  = left  ? left_leftmost   : target_sub_root;
+      rightmost_out = right ? right_rightmost : target_sub_root;
+      return target_sub_root;
+   }
+
    template<class Disposer>
-   static void dispose_subtree(node_ptr x, Disposer disposer) BOOST_NOEXCEPT
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR static void dispose_subtree(node_ptr x, Disposer disposer) BOOST_NOEXCEPT
    {
       while (x){
          node_ptr save(NodeTraits::get_left(x));
@@ -2027,8 +2493,16 @@ class bstree_algorithms : public bstree_algorithms_base<NodeTraits>
    }
 
    template<class KeyType, class KeyNodePtrCompare>
-   static node_ptr lower_bound_loop
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR static node_ptr lower_bound_loop
       (node_ptr x, node_ptr y, const KeyType &key, KeyNodePtrCompare comp)
+   {
+      return lower_bound_loop(x, y, key, comp
+         , detail::bool_<detail::is_branchless_nodeptr_comp<KeyNodePtrCompare>::value>());
+   }
+
+   template<class KeyType, class KeyNodePtrCompare>
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR static node_ptr lower_bound_loop
+      (node_ptr x, node_ptr y, const KeyType &key, KeyNodePtrCompare comp, detail::false_)
    {
       while(x){
          if(comp(x, key)){
@@ -2042,9 +2516,38 @@ class bstree_algorithms : public bstree_algorithms_base<NodeTraits>
       return y;
    }
 
+   //Cheap comparisons: both children are loaded (and prefetched) before the comparison
+   //result is known and the next node is selected with conditional moves, so that
+   //the descent does not suffer branch mispredictions with random keys.
    template<class KeyType, class KeyNodePtrCompare>
-   static node_ptr upper_bound_loop
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR static node_ptr lower_bound_loop
+      (node_ptr x, node_ptr y, const KeyType &key, KeyNodePtrCompare comp, detail::true_)
+   {
+      while(x){
+         const node_ptr l = NodeTraits::get_left(x);
+         const node_ptr r = NodeTraits::get_right(x);
+         BOOST_INTRUSIVE_PREFETCH(boost::movelib::to_raw_pointer(l));
+         BOOST_INTRUSIVE_PREFETCH(boost::movelib::to_raw_pointer(r));
+         const node_ptr children[2] = { l, r };
+         const node_ptr bounds[2] = { x, y };
+         const std::size_t go_right = std::size_t(comp(x, key));
+         y = bounds[go_right];
+         x = children[go_right];
+      }
+      return y;
+   }
+
+   template<class KeyType, class KeyNodePtrCompare>
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR static node_ptr upper_bound_loop
       (node_ptr x, node_ptr y, const KeyType &key, KeyNodePtrCompare comp)
+   {
+      return upper_bound_loop(x, y, key, comp
+         , detail::bool_<detail::is_branchless_nodeptr_comp<KeyNodePtrCompare>::value>());
+   }
+
+   template<class KeyType, class KeyNodePtrCompare>
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR static node_ptr upper_bound_loop
+      (node_ptr x, node_ptr y, const KeyType &key, KeyNodePtrCompare comp, detail::false_)
    {
       while(x){
          if(comp(key, x)){
@@ -2058,8 +2561,26 @@ class bstree_algorithms : public bstree_algorithms_base<NodeTraits>
       return y;
    }
 
+   template<class KeyType, class KeyNodePtrCompare>
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR static node_ptr upper_bound_loop
+      (node_ptr x, node_ptr y, const KeyType &key, KeyNodePtrCompare comp, detail::true_)
+   {
+      while(x){
+         const node_ptr l = NodeTraits::get_left(x);
+         const node_ptr r = NodeTraits::get_right(x);
+         BOOST_INTRUSIVE_PREFETCH(boost::movelib::to_raw_pointer(l));
+         BOOST_INTRUSIVE_PREFETCH(boost::movelib::to_raw_pointer(r));
+         const node_ptr children[2] = { r, l };
+         const node_ptr bounds[2] = { y, x };
+         const std::size_t go_left = std::size_t(comp(key, x));
+         y = bounds[go_left];
+         x = children[go_left];
+      }
+      return y;
+   }
+
    template<class Checker>
-   static void check_subtree(const_node_ptr n, Checker checker, typename Checker::return_type& check_return)
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR static void check_subtree(const_node_ptr n, Checker checker, typename Checker::return_type& check_return)
    {
       const_node_ptr left = NodeTraits::get_left(n);
       const_node_ptr right = NodeTraits::get_right(n);
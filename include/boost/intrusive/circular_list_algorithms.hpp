@@ -67,7 +67,7 @@ class circular_list_algorithms
    //! <b>Complexity</b>: Constant
    //!
    //! <b>Throws</b>: Nothing.
-   static void init(node_ptr this_node) BOOST_NOEXCEPT
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR static void init(node_ptr this_node) BOOST_NOEXCEPT
    {
       const node_ptr null_node = node_ptr();
       NodeTraits::set_next(this_node, null_node);
@@ -80,7 +80,7 @@ class circular_list_algorithms
    //! <b>Complexity</b>: Constant
    //!
    //! <b>Throws</b>: Nothing.
-   inline static bool inited(const_node_ptr this_node) BOOST_NOEXCEPT
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR static bool inited(const_node_ptr this_node) BOOST_NOEXCEPT
    {  return !NodeTraits::get_next(this_node); }
 
    //! <b>Effects</b>: Constructs an empty list, making this_node the only
@@ -91,7 +91,7 @@ class circular_list_algorithms
    //! <b>Complexity</b>: Constant
    //!
    //! <b>Throws</b>: Nothing.
-   static void init_header(node_ptr this_node) BOOST_NOEXCEPT
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR static void init_header(node_ptr this_node) BOOST_NOEXCEPT
    {
       NodeTraits::set_next(this_node, this_node);
       NodeTraits::set_previous(this_node, this_node);
@@ -102,7 +102,7 @@ class circular_list_algorithms
    //! <b>Complexity</b>: Constant
    //!
    //! <b>Throws</b>: Nothing.
-   inline static bool is_empty(const_node_ptr this_node) BOOST_NOEXCEPT
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR static bool is_empty(const_node_ptr this_node) BOOST_NOEXCEPT
    {
       return NodeTraits::get_next(this_node) == this_node;
    }
@@ -115,7 +115,7 @@ class circular_list_algorithms
    //! <b>Complexity</b>: Constant
    //!
    //! <b>Throws</b>: Nothing.
-   static bool unique(const_node_ptr this_node) BOOST_NOEXCEPT
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR static bool unique(const_node_ptr this_node) BOOST_NOEXCEPT
    {
       node_ptr next = NodeTraits::get_next(this_node);
       return !next || next == this_node;
@@ -129,7 +129,7 @@ class circular_list_algorithms
    //! <b>Complexity</b>: Linear
    //!
    //! <b>Throws</b>: Nothing.
-   static std::size_t count(const_node_ptr this_node) BOOST_NOEXCEPT
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR static std::size_t count(const_node_ptr this_node) BOOST_NOEXCEPT
    {
       std::size_t result = 0;
       const_node_ptr p = this_node;
@@ -147,7 +147,7 @@ class circular_list_algorithms
    //! <b>Complexity</b>: Constant
    //!
    //! <b>Throws</b>: Nothing.
-   static node_ptr unlink(node_ptr this_node) BOOST_NOEXCEPT
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR static node_ptr unlink(node_ptr this_node) BOOST_NOEXCEPT
    {
       node_ptr next(NodeTraits::get_next(this_node));
       node_ptr prev(NodeTraits::get_previous(this_node));
@@ -163,7 +163,7 @@ class circular_list_algorithms
    //! <b>Complexity</b>: Constant
    //!
    //! <b>Throws</b>: Nothing.
-   static void unlink(node_ptr b, node_ptr e) BOOST_NOEXCEPT
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR static void unlink(node_ptr b, node_ptr e) BOOST_NOEXCEPT
    {
       if (b != e) {
          node_ptr prevb(NodeTraits::get_previous(b));
@@ -179,7 +179,7 @@ class circular_list_algorithms
    //! <b>Complexity</b>: Constant
    //!
    //! <b>Throws</b>: Nothing.
-   static void link_before(node_ptr nxt_node, node_ptr this_node) BOOST_NOEXCEPT
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR static void link_before(node_ptr nxt_node, node_ptr this_node) BOOST_NOEXCEPT
    {
       node_ptr prev(NodeTraits::get_previous(nxt_node));
       NodeTraits::set_previous(this_node, prev);
@@ -198,7 +198,7 @@ class circular_list_algorithms
    //! <b>Complexity</b>: Constant
    //!
    //! <b>Throws</b>: Nothing.
-   static void link_after(node_ptr prev_node, node_ptr this_node) BOOST_NOEXCEPT
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR static void link_after(node_ptr prev_node, node_ptr this_node) BOOST_NOEXCEPT
    {
       node_ptr next(NodeTraits::get_next(prev_node));
       NodeTraits::set_previous(this_node, prev_node);
@@ -220,7 +220,7 @@ class circular_list_algorithms
    //! <b>Complexity</b>: Constant
    //!
    //! <b>Throws</b>: Nothing.
-   static void swap_nodes(node_ptr this_node, node_ptr other_node) BOOST_NOEXCEPT
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR static void swap_nodes(node_ptr this_node, node_ptr other_node) BOOST_NOEXCEPT
    {
       if (other_node == this_node)
          return;
@@ -261,7 +261,7 @@ class circular_list_algorithms
    //! <b>Complexity</b>: Constant
    //!
    //! <b>Throws</b>: Nothing.
-   static void transfer(node_ptr p, node_ptr b, node_ptr e) BOOST_NOEXCEPT
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR static void transfer(node_ptr p, node_ptr b, node_ptr e) BOOST_NOEXCEPT
    {
       if (b != e && p != b && p != e) {
          node_ptr prev_p(NodeTraits::get_previous(p));
@@ -286,7 +286,7 @@ class circular_list_algorithms
    //! <b>Complexity</b>: Constant
    //!
    //! <b>Throws</b>: Nothing.
-   static void transfer(node_ptr p, node_ptr i) BOOST_NOEXCEPT
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR static void transfer(node_ptr p, node_ptr i) BOOST_NOEXCEPT
    {
       node_ptr n(NodeTraits::get_next(i));
       if(n != p && i != p){
@@ -307,7 +307,7 @@ class circular_list_algorithms
    //! <b>Throws</b>: Nothing.
    //!
    //! <b>Complexity</b>: This function is linear time.
-   static void reverse(node_ptr p) BOOST_NOEXCEPT
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR static void reverse(node_ptr p) BOOST_NOEXCEPT
    {
       node_ptr f(NodeTraits::get_next(p));
       node_ptr i(NodeTraits::get_next(f)), e(p);
@@ -325,7 +325,7 @@ class circular_list_algorithms
    //! <b>Throws</b>: Nothing.
    //!
    //! <b>Complexity</b>: Linear to the number of moved positions.
-   static void move_backwards(node_ptr p, std::size_t n) BOOST_NOEXCEPT
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR static void move_backwards(node_ptr p, std::size_t n) BOOST_NOEXCEPT
    {
       //Null shift, nothing to do
       if(!n) return;
@@ -345,7 +345,7 @@ class circular_list_algorithms
    //! <b>Throws</b>: Nothing.
    //!
    //! <b>Complexity</b>: Linear to the number of moved positions.
-   static void move_forward(node_ptr p, std::size_t n) BOOST_NOEXCEPT
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR static void move_forward(node_ptr p, std::size_t n) BOOST_NOEXCEPT
    {
       //Null shift, nothing to do
       if(!n)   return;
@@ -368,7 +368,7 @@ class circular_list_algorithms
    //! <b>Complexity</b>: Linear
    //!
    //! <b>Throws</b>: Nothing.
-   static std::size_t distance(const_node_ptr f, const_node_ptr l) BOOST_NOEXCEPT
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR static std::size_t distance(const_node_ptr f, const_node_ptr l) BOOST_NOEXCEPT
    {
       std::size_t result = 0;
       while(f != l){
@@ -386,7 +386,7 @@ class circular_list_algorithms
    };
 
    template<class Pred>
-   static void stable_partition(node_ptr beg, node_ptr end, Pred pred, stable_partition_info &info)
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR static void stable_partition(node_ptr beg, node_ptr end, Pred pred, stable_partition_info &info)
    {
       node_ptr bcur = node_traits::get_previous(beg);
       node_ptr cur  = beg;
@@ -443,14 +443,14 @@ class circular_list_algorithms
    }
 
    private:
-   static void swap_prev(node_ptr this_node, node_ptr other_node) BOOST_NOEXCEPT
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR static void swap_prev(node_ptr this_node, node_ptr other_node) BOOST_NOEXCEPT
    {
       node_ptr temp(NodeTraits::get_previous(this_node));
       NodeTraits::set_previous(this_node, NodeTraits::get_previous(other_node));
       NodeTraits::set_previous(other_node, temp);
    }
 
-   static void swap_next(node_ptr this_node, node_ptr other_node) BOOST_NOEXCEPT
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR static void swap_next(node_ptr this_node, node_ptr other_node) BOOST_NOEXCEPT
    {
       node_ptr temp(NodeTraits::get_next(this_node));
       NodeTraits::set_next(this_node, NodeTraits::get_next(other_node));
@@ -146,7 +146,7 @@ class circular_slist_algorithms
    //! <b>Complexity</b>: Constant
    //!
    //! <b>Throws</b>: Nothing.
-   inline static void init_header(node_ptr this_node) BOOST_NOEXCEPT
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR static void init_header(node_ptr this_node) BOOST_NOEXCEPT
    {  NodeTraits::set_next(this_node, this_node);  }
 
    //! <b>Requires</b>: 'p' is the first node of a list.
@@ -156,7 +156,7 @@ class circular_slist_algorithms
    //! <b>Complexity</b>: Constant time.
    //!
    //! <b>Throws</b>: Nothing.
-   inline static node_ptr end_node(const_node_ptr p) BOOST_NOEXCEPT
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR static node_ptr end_node(const_node_ptr p) BOOST_NOEXCEPT
    {  return detail::uncast(p);   }
 
    //! <b>Effects</b>: Returns true if this_node_points to an empty list.
@@ -164,7 +164,7 @@ class circular_slist_algorithms
    //! <b>Complexity</b>: Constant
    //!
    //! <b>Throws</b>: Nothing.
-   inline static bool is_empty(const_node_ptr this_node) BOOST_NOEXCEPT
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR static bool is_empty(const_node_ptr this_node) BOOST_NOEXCEPT
    {  return NodeTraits::get_next(this_node) == this_node;  }
 
    //! <b>Effects</b>: Returns true if this_node points to a sentinel node.
@@ -172,7 +172,7 @@ class circular_slist_algorithms
    //! <b>Complexity</b>: Constant
    //!
    //! <b>Throws</b>: Nothing.
-   inline static bool is_sentinel(const_node_ptr this_node) BOOST_NOEXCEPT
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR static bool is_sentinel(const_node_ptr this_node) BOOST_NOEXCEPT
    {  return NodeTraits::get_next(this_node) == node_ptr();  }
 
    //! <b>Effects</b>: Marks this node as a "sentinel" node, a special state that is different from "empty",
@@ -181,7 +181,7 @@ class circular_slist_algorithms
    //! <b>Complexity</b>: Constant
    //!
    //! <b>Throws</b>: Nothing.
-   inline static void set_sentinel(node_ptr this_node) BOOST_NOEXCEPT
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR static void set_sentinel(node_ptr this_node) BOOST_NOEXCEPT
    {  NodeTraits::set_next(this_node, node_ptr());   }
 
    //! <b>Requires</b>: this_node and prev_init_node must be in the same circular list.
@@ -193,7 +193,7 @@ class circular_slist_algorithms
    //! <b>Complexity</b>: Linear to the number of elements between prev_init_node and this_node.
    //!
    //! <b>Throws</b>: Nothing.
-   inline static node_ptr get_previous_node(node_ptr prev_init_node, node_ptr this_node) BOOST_NOEXCEPT
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR static node_ptr get_previous_node(node_ptr prev_init_node, node_ptr this_node) BOOST_NOEXCEPT
    {  return base_t::get_previous_node(prev_init_node, this_node);   }
 
    //! <b>Requires</b>: this_node must be in a circular list or be an empty circular list.
@@ -203,7 +203,7 @@ class circular_slist_algorithms
    //! <b>Complexity</b>: Linear to the number of elements in the circular list.
    //!
    //! <b>Throws</b>: Nothing.
-   inline static node_ptr get_previous_node(node_ptr this_node) BOOST_NOEXCEPT
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR static node_ptr get_previous_node(node_ptr this_node) BOOST_NOEXCEPT
    {  return base_t::get_previous_node(this_node, this_node); }
 
    //! <b>Requires</b>: this_node must be in a circular list or be an empty circular list.
@@ -213,7 +213,7 @@ class circular_slist_algorithms
    //! <b>Complexity</b>: Linear to the number of elements in the circular list.
    //!
    //! <b>Throws</b>: Nothing.
-   inline static node_ptr get_previous_previous_node(node_ptr this_node) BOOST_NOEXCEPT
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR static node_ptr get_previous_previous_node(node_ptr this_node) BOOST_NOEXCEPT
    {  return get_previous_previous_node(this_node, this_node); }
 
    //! <b>Requires</b>: this_node and p must be in the same circular list.
@@ -225,7 +225,7 @@ class circular_slist_algorithms
    //! <b>Complexity</b>: Linear to the number of elements in the circular list.
    //!
    //! <b>Throws</b>: Nothing.
-   static node_ptr get_previous_previous_node(node_ptr p, node_ptr this_node) BOOST_NOEXCEPT
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR static node_ptr get_previous_previous_node(node_ptr p, node_ptr this_node) BOOST_NOEXCEPT
    {
       node_ptr p_next = NodeTraits::get_next(p);
       node_ptr p_next_next = NodeTraits::get_next(p_next);
@@ -245,7 +245,7 @@ class circular_slist_algorithms
    //! <b>Complexity</b>: Linear
    //!
    //! <b>Throws</b>: Nothing.
-   static std::size_t count(const_node_ptr this_node) BOOST_NOEXCEPT
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR static std::size_t count(const_node_ptr this_node) BOOST_NOEXCEPT
    {
       std::size_t result = 0;
       const_node_ptr p = this_node;
@@ -263,7 +263,7 @@ class circular_slist_algorithms
    //! <b>Complexity</b>: Linear to the number of elements in the circular list
    //!
    //! <b>Throws</b>: Nothing.
-   static void unlink(node_ptr this_node) BOOST_NOEXCEPT
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR static void unlink(node_ptr this_node) BOOST_NOEXCEPT
    {
       if(NodeTraits::get_next(this_node))
          base_t::unlink_after(get_previous_node(this_node));
@@ -276,7 +276,7 @@ class circular_slist_algorithms
    //! <b>Complexity</b>: Linear to the number of elements in the circular list.
    //!
    //! <b>Throws</b>: Nothing.
-   inline static void link_before (node_ptr nxt_node, node_ptr this_node) BOOST_NOEXCEPT
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR static void link_before (node_ptr nxt_node, node_ptr this_node) BOOST_NOEXCEPT
    {  base_t::link_after(get_previous_node(nxt_node), this_node);   }
 
    //! <b>Requires</b>: this_node and other_node must be nodes inserted
@@ -289,7 +289,7 @@ class circular_slist_algorithms
    //! <b>Complexity</b>: Linear to number of elements of both lists
    //!
    //! <b>Throws</b>: Nothing.
-   static void swap_nodes(node_ptr this_node, node_ptr other_node) BOOST_NOEXCEPT
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR static void swap_nodes(node_ptr this_node, node_ptr other_node) BOOST_NOEXCEPT
    {
       if (other_node == this_node)
          return;
@@ -315,7 +315,7 @@ class circular_slist_algorithms
    //! <b>Throws</b>: Nothing.
    //!
    //! <b>Complexity</b>: This function is linear to the contained elements.
-   static void reverse(node_ptr p) BOOST_NOEXCEPT
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR static void reverse(node_ptr p) BOOST_NOEXCEPT
    {
       node_ptr i = NodeTraits::get_next(p), e(p);
       for (;;) {
@@ -334,7 +334,7 @@ class circular_slist_algorithms
    //! <b>Throws</b>: Nothing.
    //!
    //! <b>Complexity</b>: Linear to the number of elements plus the number moved positions.
-   static node_ptr move_backwards(node_ptr p, std::size_t n) BOOST_NOEXCEPT
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR static node_ptr move_backwards(node_ptr p, std::size_t n) BOOST_NOEXCEPT
    {
       //Null shift, nothing to do
       if(!n) return node_ptr();
@@ -386,7 +386,7 @@ class circular_slist_algorithms
    //! <b>Throws</b>: Nothing.
    //!
    //! <b>Complexity</b>: Linear to the number of elements plus the number moved positions.
-   static node_ptr move_forward(node_ptr p, std::size_t n) BOOST_NOEXCEPT
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR static node_ptr move_forward(node_ptr p, std::size_t n) BOOST_NOEXCEPT
    {
       //Null shift, nothing to do
       if(!n) return node_ptr();
@@ -434,7 +434,7 @@ class circular_slist_algorithms
    //! <b>Complexity</b>: Linear
    //!
    //! <b>Throws</b>: Nothing.
-   static void transfer_after(node_ptr p, node_ptr other) BOOST_NOEXCEPT
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR static void transfer_after(node_ptr p, node_ptr other) BOOST_NOEXCEPT
    {
       node_ptr other_last((get_previous_node)(other));
       base_t::transfer_after(p, other, other_last);
@@ -453,7 +453,7 @@ class circular_slist_algorithms
    //!
    //! <b>Throws</b>: Nothing.
    template<class Disposer>
-   inline static std::size_t detach_and_dispose(node_ptr p, Disposer disposer) BOOST_NOEXCEPT
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR static std::size_t detach_and_dispose(node_ptr p, Disposer disposer) BOOST_NOEXCEPT
    {  return base_t::unlink_after_and_dispose(p, p, disposer);   }
 };
 
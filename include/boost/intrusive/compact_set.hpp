@@ -0,0 +1,1246 @@
+/////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright agent 2026
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/intrusive for documentation.
+//
+/////////////////////////////////////////////////////////////////////////////
+#ifndef BOOST_INTRUSIVE_COMPACT_SET_HPP
+#define BOOST_INTRUSIVE_COMPACT_SET_HPP
+
+#include <boost/intrusive/detail/config_begin.hpp>
+#include <boost/intrusive/intrusive_fwd.hpp>
+
+#include <boost/intrusive/detail/assert.hpp>
+#include <boost/intrusive/compact_set_hook.hpp>
+#include <boost/intrusive/threaded_rbtree_algorithms.hpp>
+#include <boost/intrusive/bstree.hpp>
+#include <boost/intrusive/detail/threaded_tree_iterator.hpp>
+#include <boost/intrusive/detail/ebo_functor_holder.hpp>
+#include <boost/intrusive/detail/mpl.hpp>
+#include <boost/intrusive/pointer_traits.hpp>
+#include <boost/intrusive/detail/is_stateful_value_traits.hpp>
+#include <boost/intrusive/detail/default_header_holder.hpp>
+#include <boost/intrusive/detail/reverse_iterator.hpp>
+#include <boost/intrusive/detail/node_cloner_disposer.hpp>
+#include <boost/intrusive/detail/key_nodeptr_comp.hpp>
+#include <boost/intrusive/detail/simple_disposers.hpp>
+#include <boost/intrusive/detail/size_holder.hpp>
+#include <boost/intrusive/detail/get_value_traits.hpp>
+#include <boost/intrusive/link_mode.hpp>
+#include <boost/intrusive/parent_from_member.hpp>
+#include <boost/move/utility_core.hpp>
+#include <boost/move/adl_move_swap.hpp>
+
+#include <boost/intrusive/detail/minimal_pair_header.hpp>
+#include <cstddef>   //size_t...
+
+#if defined(BOOST_HAS_PRAGMA_ONCE)
+#  pragma once
+#endif
+
+namespace boost {
+namespace intrusive {
+
+/// @cond
+
+struct default_compact_set_hook_applier
+{  template <class T> struct apply{ typedef typename T::default_threaded_rbtree_hook type;  };  };
+
+template<>
+struct is_default_hook_tag<default_compact_set_hook_applier>
+{  static const bool value = true;  };
+
+struct compact_set_defaults
+{
+   typedef default_compact_set_hook_applier proto_value_traits;
+   static const bool constant_time_size = true;
+   typedef std::size_t size_type;
+   typedef void compare;
+   typedef void key_of_value;
+   typedef void header_holder_type;
+};
+
+/// @endcond
+
+//! The class template compact_set is an intrusive container that mimics the
+//! lookup and iteration interface of std::set using a red-black tree
+//! whose nodes store only two links.
+//!
+//! The hook (see \c compact_set_base_hook and \c compact_set_member_hook) has no
+//! parent link: child links that would be null are "threads" to the in-order neighbours,
+//! so iterators are plain node pointers, they are stable and traversal needs no
+//! parent links. Insertion and erasure keep the search path in a small local stack.
+//!
+//! This memory saving has some costs compared to \c set:
+//!  - Keys must be unique (there is no multiset counterpart).
+//!  - \c begin() is logarithmic instead of constant.
+//!  - Erasure by iterator or reference is logarithmic and calls the ordering predicate,
+//!    as the path to the root is found searching the node.
+//!  - \c auto_unlink hooks are not supported.
+//!
+//! The template parameter \c T is the type to be managed by the container.
+//! The user can specify additional options and if no options are provided
+//! default options are used.
+//!
+//! The container supports the following options:
+//! \c base_hook<>/member_hook<>/value_traits<>,
+//! \c constant_time_size<>, \c size_type<>,
+//! \c compare<> and \c key_of_value<>.
+#if defined(BOOST_INTRUSIVE_DOXYGEN_INVOKED)
+template<class T, class ...Options>
+#else
+template<class ValueTraits, class VoidOrKeyOfValue, class VoidOrKeyComp, class SizeType, bool ConstantTimeSize, typename HeaderHolder>
+#endif
+class compact_set_impl
+{
+   /// @cond
+   typedef bst_key_types< typename ValueTraits::pointer
+                        , VoidOrKeyOfValue
+                        , VoidOrKeyComp>                             key_types;
+   /// @endcond
+
+   public:
+   typedef ValueTraits                                               value_traits;
+   typedef typename value_traits::pointer                            pointer;
+   typedef typename value_traits::const_pointer                      const_pointer;
+   typedef typename pointer_traits<pointer>::element_type            value_type;
+   typedef typename key_types::key_type                              key_type;
+   typedef typename key_types::key_of_value                          key_of_value;
+   typedef typename key_types::key_compare                           key_compare;
+   typedef typename key_types::value_compare                         value_compare;
+   typedef typename pointer_traits<pointer>::reference               reference;
+   typedef typename pointer_traits<const_pointer>::reference         const_reference;
+   typedef typename pointer_traits<pointer>::difference_type         difference_type;
+   typedef SizeType                                                  size_type;
+   typedef threaded_tree_iterator<value_traits, false>               iterator;
+   typedef threaded_tree_iterator<value_traits, true>                const_iterator;
+   typedef boost::intrusive::reverse_iterator<iterator>              reverse_iterator;
+   typedef boost::intrusive::reverse_iterator<const_iterator>        const_reverse_iterator;
+   typedef typename value_traits::node_traits                        node_traits;
+   typedef typename node_traits::node                                node;
+   typedef typename node_traits::node_ptr                            node_ptr;
+   typedef typename node_traits::const_node_ptr                      const_node_ptr;
+   typedef threaded_rbtree_algorithms<node_traits>                   node_algorithms;
+   typedef typename detail::get_header_holder_type
+      < value_traits, HeaderHolder >::type                           header_holder_type;
+
+   static const bool constant_time_size = ConstantTimeSize;
+   static const bool stateful_value_traits = detail::is_stateful_value_traits<value_traits>::value;
+   static const bool has_container_from_iterator =
+        detail::is_same< header_holder_type, detail::default_header_holder< node_traits > >::value;
+
+   /// @cond
+   private:
+   typedef detail::size_holder<constant_time_size, size_type>        size_traits;
+   typedef detail::key_nodeptr_comp
+      <key_compare, value_traits, key_of_value>                      node_comp_t;
+
+   //noncopyable
+   BOOST_MOVABLE_BUT_NOT_COPYABLE(compact_set_impl)
+
+   static const bool safemode_or_autounlink = is_safe_autounlink<value_traits::link_mode>::value;
+
+   //Nodes can't be unlinked without the ordering predicate of the container
+   BOOST_INTRUSIVE_STATIC_ASSERT(((int)value_traits::link_mode != (int)auto_unlink));
+
+   inline node_ptr header_ptr()
+   { return data_.root_plus_size_.m_header.get_node(); }
+
+   inline const_node_ptr header_ptr() const
+   { return data_.root_plus_size_.m_header.get_node(); }
+
+   struct root_plus_size : public size_traits
+   {
+      header_holder_type m_header;
+   };
+
+   struct data_t
+      //Put the (possibly empty) functor in the first position to get EBO in MSVC
+      : public detail::ebo_functor_holder<value_compare>
+      , public value_traits
+   {
+      typedef typename compact_set_impl::value_traits value_traits;
+      inline data_t(const key_compare &comp, const value_traits &val_traits)
+         :  detail::ebo_functor_holder<value_compare>(value_compare(comp)), value_traits(val_traits)
+      {}
+
+      root_plus_size root_plus_size_;
+   } data_;
+
+   inline size_traits &priv_size_traits() BOOST_NOEXCEPT
+   {  return data_.root_plus_size_;  }
+
+   inline const size_traits &priv_size_traits() const BOOST_NOEXCEPT
+   {  return data_.root_plus_size_;  }
+
+   inline const value_traits &priv_value_traits() const BOOST_NOEXCEPT
+   {  return data_;  }
+
+   inline value_traits &priv_value_traits() BOOST_NOEXCEPT
+   {  return data_;  }
+
+   inline const value_compare &priv_comp() const BOOST_NOEXCEPT
+   {  return static_cast<const detail::ebo_functor_holder<value_compare>&>(data_).get();  }
+
+   inline value_compare &priv_comp() BOOST_NOEXCEPT
+   {  return static_cast<detail::ebo_functor_holder<value_compare>&>(data_).get();  }
+
+   typedef typename boost::intrusive::value_traits_pointers
+      <ValueTraits>::const_value_traits_ptr const_value_traits_ptr;
+
+   inline const_value_traits_ptr priv_value_traits_ptr() const BOOST_NOEXCEPT
+   {  return pointer_traits<const_value_traits_ptr>::pointer_to(this->priv_value_traits());  }
+
+   template<class KeyTypeKeyCompare>
+   struct key_node_comp_ret
+   {  typedef detail::key_nodeptr_comp<KeyTypeKeyCompare, value_traits, key_of_value> type;  };
+
+   template<class KeyTypeKeyCompare>
+   inline typename key_node_comp_ret<KeyTypeKeyCompare>::type key_node_comp(KeyTypeKeyCompare comp) const
+   {
+      return detail::key_nodeptr_comp<KeyTypeKeyCompare, value_traits, key_of_value>(comp, &this->priv_value_traits());
+   }
+
+   inline node_comp_t priv_node_comp() const
+   {  return this->key_node_comp(this->key_comp());  }
+
+   void priv_init()
+   {
+      this->priv_size_traits().set_size(size_type(0));
+      node_algorithms::init_header(this->header_ptr());
+   }
+
+   /// @endcond
+
+   public:
+
+   //! <b>Effects</b>: Constructs an empty container.
+   //!
+   //! <b>Complexity</b>: Constant.
+   //!
+   //! <b>Throws</b>: If value_traits::node_traits::node
+   //!   constructor throws (this does not happen with predefined Boost.Intrusive hooks)
+   //!   or the copy constructor of the key_compare object throws.
+   compact_set_impl()
+      :  data_(key_compare(), value_traits())
+   {  this->priv_init();  }
+
+   //! <b>Effects</b>: Constructs an empty container with given comparison and traits.
+   //!
+   //! <b>Complexity</b>: Constant.
+   //!
+   //! <b>Throws</b>: If value_traits::node_traits::node
+   //!   constructor throws (this does not happen with predefined Boost.Intrusive hooks)
+   //!   or the copy constructor of the key_compare object throws.
+   explicit compact_set_impl( const key_compare &cmp, const value_traits &v_traits = value_traits())
+      :  data_(cmp, v_traits)
+   {  this->priv_init();  }
+
+   //! <b>Requires</b>: Dereferencing iterator must yield an lvalue of type value_type.
+   //!   cmp must be a comparison function that induces a strict weak ordering.
+   //!
+   //! <b>Effects</b>: Constructs an empty container and inserts elements from
+   //!   [b, e).
+   //!
+   //! <b>Complexity</b>: N*log(N), where N is the distance between first and last.
+   //!
+   //! <b>Throws</b>: If value_traits::node_traits::node
+   //!   constructor throws (this does not happen with predefined Boost.Intrusive hooks)
+   //!   or the copy constructor/operator() of the key_compare object throws. Basic guarantee.
+   template<class Iterator>
+   compact_set_impl( Iterator b, Iterator e
+                   , const key_compare &cmp     = key_compare()
+                   , const value_traits &v_traits = value_traits())
+      :  data_(cmp, v_traits)
+   {
+      this->priv_init();
+      this->insert(b, e);
+   }
+
+   //! <b>Effects</b>: Constructs a container moving resources from another container.
+   //!   Internal comparison object and value traits are move constructed and
+   //!   nodes belonging to x (except the node representing the "end") are linked to *this.
+   //!
+   //! <b>Complexity</b>: Logarithmic.
+   //!
+   //! <b>Throws</b>: If value_traits::node_traits::node's
+   //!   move constructor throws (this does not happen with predefined Boost.Intrusive hooks)
+   //!   or the move constructor of the comparison objet throws.
+   compact_set_impl(BOOST_RV_REF(compact_set_impl) x)
+      :  data_(x.key_comp(), x.priv_value_traits())
+   {
+      this->priv_init();
+      this->swap(x);
+   }
+
+   //! <b>Effects</b>: Equivalent to swap
+   //!
+   inline compact_set_impl& operator=(BOOST_RV_REF(compact_set_impl) x)
+   {  this->swap(x); return *this;  }
+
+   //! <b>Effects</b>: Detaches all elements from this. The objects in the set
+   //!   are not deleted (i.e. no destructors are called), but the nodes according to
+   //!   the value_traits template parameter are reinitialized and thus can be reused.
+   //!
+   //! <b>Complexity</b>: Linear to elements contained in *this.
+   //!
+   //! <b>Throws</b>: Nothing.
+   ~compact_set_impl()
+   {
+      BOOST_IF_CONSTEXPR(safemode_or_autounlink){
+         this->clear();
+      }
+   }
+
+   //! <b>Effects</b>: Returns an iterator pointing to the beginning of the container.
+   //!
+   //! <b>Complexity</b>: Logarithmic.
+   //!
+   //! <b>Throws</b>: Nothing.
+   inline iterator begin() BOOST_NOEXCEPT
+   {  return iterator(node_algorithms::begin_node(this->header_ptr()), this->priv_value_traits_ptr());   }
+
+   //! <b>Effects</b>: Returns a const_iterator pointing to the beginning of the container.
+   //!
+   //! <b>Complexity</b>: Logarithmic.
+   //!
+   //! <b>Throws</b>: Nothing.
+   inline const_iterator begin() const BOOST_NOEXCEPT
+   {  return this->cbegin();   }
+
+   //! <b>Effects</b>: Returns a const_iterator pointing to the beginning of the container.
+   //!
+   //! <b>Complexity</b>: Logarithmic.
+   //!
+   //! <b>Throws</b>: Nothing.
+   inline const_iterator cbegin() const BOOST_NOEXCEPT
+   {  return const_iterator(node_algorithms::begin_node(this->header_ptr()), this->priv_value_traits_ptr());   }
+
+   //! <b>Effects</b>: Returns an iterator pointing to the end of the container.
+   //!
+   //! <b>Complexity</b>: Constant.
+   //!
+   //! <b>Throws</b>: Nothing.
+   inline iterator end() BOOST_NOEXCEPT
+   {  return iterator(node_algorithms::end_node(this->header_ptr()), this->priv_value_traits_ptr());   }
+
+   //! <b>Effects</b>: Returns a const_iterator pointing to the end of the container.
+   //!
+   //! <b>Complexity</b>: Constant.
+   //!
+   //! <b>Throws</b>: Nothing.
+   inline const_iterator end() const BOOST_NOEXCEPT
+   {  return this->cend();  }
+
+   //! <b>Effects</b>: Returns a const_iterator pointing to the end of the container.
+   //!
+   //! <b>Complexity</b>: Constant.
+   //!
+   //! <b>Throws</b>: Nothing.
+   inline const_iterator cend() const BOOST_NOEXCEPT
+   {  return const_iterator(node_algorithms::end_node(this->header_ptr()), this->priv_value_traits_ptr());   }
+
+   //! <b>Effects</b>: Returns a reverse_iterator pointing to the beginning of the
+   //!    reversed container.
+   //!
+   //! <b>Complexity</b>: Constant.
+   //!
+   //! <b>Throws</b>: Nothing.
+   inline reverse_iterator rbegin() BOOST_NOEXCEPT
+   {  return reverse_iterator(this->end());  }
+
+   //! <b>Effects</b>: Returns a const_reverse_iterator pointing to the beginning
+   //!    of the reversed container.
+   //!
+   //! <b>Complexity</b>: Constant.
+   //!
+   //! <b>Throws</b>: Nothing.
+   inline const_reverse_iterator rbegin() const BOOST_NOEXCEPT
+   {  return const_reverse_iterator(this->end());  }
+
+   //! <b>Effects</b>: Returns a const_reverse_iterator pointing to the beginning
+   //!    of the reversed container.
+   //!
+   //! <b>Complexity</b>: Constant.
+   //!
+   //! <b>Throws</b>: Nothing.
+   inline const_reverse_iterator crbegin() const BOOST_NOEXCEPT
+   {  return const_reverse_iterator(this->end());  }
+
+   //! <b>Effects</b>: Returns a reverse_iterator pointing to the end
+   //!    of the reversed container.
+   //!
+   //! <b>Complexity</b>: Logarithmic.
+   //!
+   //! <b>Throws</b>: Nothing.
+   inline reverse_iterator rend() BOOST_NOEXCEPT
+   {  return reverse_iterator(this->begin());   }
+
+   //! <b>Effects</b>: Returns a const_reverse_iterator pointing to the end
+   //!    of the reversed container.
+   //!
+   //! <b>Complexity</b>: Logarithmic.
+   //!
+   //! <b>Throws</b>: Nothing.
+   inline const_reverse_iterator rend() const BOOST_NOEXCEPT
+   {  return const_reverse_iterator(this->begin());   }
+
+   //! <b>Effects</b>: Returns a const_reverse_iterator pointing to the end
+   //!    of the reversed container.
+   //!
+   //! <b>Complexity</b>: Logarithmic.
+   //!
+   //! <b>Throws</b>: Nothing.
+   inline const_reverse_iterator crend() const BOOST_NOEXCEPT
+   {  return const_reverse_iterator(this->begin());   }
+
+   //! <b>Precondition</b>: end_iterator must be a valid end iterator
+   //!   of the container.
+   //!
+   //! <b>Effects</b>: Returns a reference to the container associated to the end iterator
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   BOOST_INTRUSIVE_NO_DANGLING
+   inline static compact_set_impl &container_from_end_iterator(iterator end_iterator) BOOST_NOEXCEPT
+   {  return priv_container_from_end_iterator(end_iterator);   }
+
+   //! <b>Precondition</b>: end_iterator must be a valid end const_iterator
+   //!   of the container.
+   //!
+   //! <b>Effects</b>: Returns a const reference to the container associated to the end iterator
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   BOOST_INTRUSIVE_NO_DANGLING
+   inline static const compact_set_impl &container_from_end_iterator(const_iterator end_iterator) BOOST_NOEXCEPT
+   {  return priv_container_from_end_iterator(end_iterator);   }
+
+   //! <b>Effects</b>: Returns the key_compare object used by the container.
+   //!
+   //! <b>Complexity</b>: Constant.
+   //!
+   //! <b>Throws</b>: If key_compare copy-constructor throws.
+   inline key_compare key_comp() const
+   {  return this->priv_comp().key_comp();   }
+
+   //! <b>Effects</b>: Returns the value_compare object used by the container.
+   //!
+   //! <b>Complexity</b>: Constant.
+   //!
+   //! <b>Throws</b>: If value_compare copy-constructor throws.
+   inline value_compare value_comp() const
+   {  return this->priv_comp();   }
+
+   //! <b>Effects</b>: Returns true if the container is empty.
+   //!
+   //! <b>Complexity</b>: Constant.
+   //!
+   //! <b>Throws</b>: Nothing.
+   inline bool empty() const BOOST_NOEXCEPT
+   {  return !node_algorithms::get_root(this->header_ptr());  }
+
+   //! <b>Effects</b>: Returns the number of elements stored in the container.
+   //!
+   //! <b>Complexity</b>: Linear to elements contained in *this
+   //!   if constant-time size option is disabled. Constant time otherwise.
+   //!
+   //! <b>Throws</b>: Nothing.
+   size_type size() const BOOST_NOEXCEPT
+   {
+      BOOST_IF_CONSTEXPR(constant_time_size)
+         return this->priv_size_traits().get_size();
+      else{
+         return (size_type)node_algorithms::size(this->header_ptr());
+      }
+   }
+
+   //! <b>Effects</b>: Swaps the contents of two containers.
+   //!
+   //! <b>Complexity</b>: Logarithmic, as the threads of the first and
+   //!   last elements are updated.
+   //!
+   //! <b>Throws</b>: If the comparison functor's swap call throws.
+   void swap(compact_set_impl& other)
+   {
+      //This can throw
+      ::boost::adl_move_swap(this->priv_comp(), other.priv_comp());
+      //These can't throw
+      node_algorithms::swap_tree(this->header_ptr(), other.header_ptr());
+      this->priv_size_traits().swap(other.priv_size_traits());
+   }
+
+   //! <b>Requires</b>: Disposer::operator()(pointer) shouldn't throw.
+   //!   Cloner should yield to nodes equivalent to the original nodes.
+   //!
+   //! <b>Effects</b>: Erases all the elements from *this
+   //!   calling Disposer::operator()(pointer), clones all the
+   //!   elements from src calling Cloner::operator()(const_reference )
+   //!   and inserts them on *this. Copies the predicate from the source container.
+   //!
+   //!   If cloner throws, all cloned elements are unlinked and disposed
+   //!   calling Disposer::operator()(pointer).
+   //!
+   //! <b>Complexity</b>: Linear to erased plus inserted elements.
+   //!
+   //! <b>Throws</b>: If cloner throws or predicate copy assignment throws. Basic guarantee.
+   template <class Cloner, class Disposer>
+   void clone_from(const compact_set_impl &src, Cloner cloner, Disposer disposer)
+   {
+      this->clear_and_dispose(disposer);
+      if(!src.empty()){
+         node_algorithms::clone
+            (src.header_ptr()
+            ,this->header_ptr()
+            ,detail::node_cloner <Cloner,    value_traits, ThreadedRbTreeAlgorithms>(cloner,   &this->priv_value_traits())
+            ,detail::node_disposer<Disposer, value_traits, ThreadedRbTreeAlgorithms>(disposer, &this->priv_value_traits()));
+         this->priv_size_traits().set_size(src.priv_size_traits().get_size());
+         this->priv_comp() = src.priv_comp();
+      }
+   }
+
+   //! <b>Requires</b>: Disposer::operator()(pointer) shouldn't throw.
+   //!   Cloner should yield to nodes equivalent to the original nodes.
+   //!
+   //! <b>Effects</b>: Erases all the elements from *this
+   //!   calling Disposer::operator()(pointer), clones all the
+   //!   elements from src calling Cloner::operator()(reference)
+   //!   and inserts them on *this. Copies the predicate from the source container.
+   //!
+   //!   If cloner throws, all cloned elements are unlinked and disposed
+   //!   calling Disposer::operator()(pointer).
+   //!
+   //! <b>Complexity</b>: Linear to erased plus inserted elements.
+   //!
+   //! <b>Throws</b>: If cloner throws or predicate copy assignment throws. Basic guarantee.
+   //!
+   //! <b>Note</b>: This version can modify the source container, useful to implement
+   //!    move semantics.
+   template <class Cloner, class Disposer>
+   void clone_from(BOOST_RV_REF(compact_set_impl) src, Cloner cloner, Disposer disposer)
+   {
+      this->clear_and_dispose(disposer);
+      if(!src.empty()){
+         node_algorithms::clone
+            (src.header_ptr()
+            ,this->header_ptr()
+            ,detail::node_cloner <Cloner,    value_traits, ThreadedRbTreeAlgorithms, false>(cloner,   &this->priv_value_traits())
+            ,detail::node_disposer<Disposer, value_traits, ThreadedRbTreeAlgorithms>(disposer, &this->priv_value_traits()));
+         this->priv_size_traits().set_size(src.priv_size_traits().get_size());
+         this->priv_comp() = src.priv_comp();
+      }
+   }
+
+   //! <b>Requires</b>: value must be an lvalue
+   //!
+   //! <b>Effects</b>: Inserts value into the container if the value
+   //!   is not already present.
+   //!
+   //! <b>Complexity</b>: Logarithmic.
+   //!
+   //! <b>Throws</b>: If the internal key_compare ordering function throws. Strong guarantee.
+   //!
+   //! <b>Note</b>: Does not affect the validity of iterators and references.
+   //!   No copy-constructors are called.
+   std::pair<iterator, bool> insert(reference value)
+   {
+      node_ptr to_insert(this->priv_value_traits().to_node_ptr(value));
+      BOOST_INTRUSIVE_SAFE_HOOK_DEFAULT_ASSERT(!safemode_or_autounlink || node_algorithms::unique(to_insert));
+      std::pair<node_ptr, bool> ret = node_algorithms::insert_unique
+         (this->header_ptr(), to_insert, this->priv_node_comp());
+      this->priv_size_traits().increase(size_type(ret.second));
+      return std::pair<iterator, bool>(iterator(ret.first, this->priv_value_traits_ptr()), ret.second);
+   }
+
+   //! <b>Requires</b>: value must be an lvalue
+   //!
+   //! <b>Effects</b>: Tries to insert x into the container. The hint is ignored, as
+   //!   the search path must be recorded from the root.
+   //!
+   //! <b>Complexity</b>: Logarithmic.
+   //!
+   //! <b>Throws</b>: If the internal key_compare ordering function throws. Strong guarantee.
+   //!
+   //! <b>Note</b>: Does not affect the validity of iterators and references.
+   //!   No copy-constructors are called.
+   inline iterator insert(const_iterator, reference value)
+   {  return this->insert(value).first;  }
+
+   //! <b>Requires</b>: Dereferencing iterator must yield an lvalue
+   //!   of type value_type.
+   //!
+   //! <b>Effects</b>: Tries to insert each element of a range into the container.
+   //!
+   //! <b>Complexity</b>: N log(size() + N), where N is the distance between b and e.
+   //!
+   //! <b>Throws</b>: If the internal key_compare ordering function throws. Basic guarantee.
+   //!
+   //! <b>Note</b>: Does not affect the validity of iterators and references.
+   //!   No copy-constructors are called.
+   template<class Iterator>
+   void insert(Iterator b, Iterator e)
+   {
+      for (; b != e; ++b)
+         this->insert(*b);
+   }
+
+   //! <b>Effects</b>: Erases the element pointed to by i.
+   //!
+   //! <b>Complexity</b>: Logarithmic. The position of the element is searched
+   //!   from the root using the ordering predicate.
+   //!
+   //! <b>Returns</b>: An iterator to the element after the erased element.
+   //!
+   //! <b>Throws</b>: If the internal key_compare ordering function throws.
+   //!
+   //! <b>Note</b>: Invalidates the iterators (but not the references)
+   //!    to the erased elements. No destructors are called.
+   iterator erase(const_iterator i)
+   {
+      const_iterator ret(i);
+      ++ret;
+      node_ptr to_erase(i.pointed_node());
+      BOOST_INTRUSIVE_SAFE_HOOK_DEFAULT_ASSERT(!safemode_or_autounlink || !node_algorithms::unique(to_erase));
+      node_algorithms::erase(this->header_ptr(), to_erase, this->priv_node_comp());
+      this->priv_size_traits().decrement();
+      BOOST_IF_CONSTEXPR(safemode_or_autounlink)
+         node_algorithms::init(to_erase);
+      return ret.unconst();
+   }
+
+   //! <b>Effects</b>: Erases the range pointed to by b end e.
+   //!
+   //! <b>Complexity</b>: Average complexity for erase range is at most
+   //!   O(log(size() + N)), where N is the number of elements in the range.
+   //!
+   //! <b>Returns</b>: An iterator to the element after the erased elements.
+   //!
+   //! <b>Throws</b>: If the internal key_compare ordering function throws.
+   //!
+   //! <b>Note</b>: Invalidates the iterators (but not the references)
+   //!    to the erased elements. No destructors are called.
+   iterator erase(const_iterator b, const_iterator e)
+   {
+      while(b != e)
+         b = this->erase(b);
+      return b.unconst();
+   }
+
+   //! <b>Effects</b>: Erases the element with the given key.
+   //!
+   //! <b>Returns</b>: The number of erased elements (0 or 1).
+   //!
+   //! <b>Complexity</b>: Logarithmic.
+   //!
+   //! <b>Throws</b>: If the internal key_compare ordering function throws.
+   //!
+   //! <b>Note</b>: Invalidates the iterators (but not the references)
+   //!    to the erased elements. No destructors are called.
+   inline size_type erase(const key_type &key)
+   {  return this->erase(key, this->key_comp());   }
+
+   //! <b>Requires</b>: key is a value such that `*this` is partitioned with respect to
+   //!   comp(nk, key) and !comp(key, nk), with comp(nk, key) implying !comp(key, nk),
+   //!   with nk the key_type of a value_type inserted into `*this`.
+   //!
+   //! <b>Effects</b>: Erases the element with the given key.
+   //!
+   //! <b>Returns</b>: The number of erased elements (0 or 1).
+   //!
+   //! <b>Complexity</b>: Logarithmic.
+   //!
+   //! <b>Throws</b>: If comp or the internal key_compare ordering function throws.
+   //!
+   //! <b>Note</b>: Invalidates the iterators (but not the references)
+   //!    to the erased elements. No destructors are called.
+   template<class KeyType, class KeyTypeKeyCompare>
+   BOOST_INTRUSIVE_DOC1ST(size_type
+      , typename detail::disable_if_convertible<KeyTypeKeyCompare BOOST_INTRUSIVE_I const_iterator BOOST_INTRUSIVE_I size_type>::type)
+      erase(const KeyType& key, KeyTypeKeyCompare comp)
+   {
+      const_iterator it(this->find(key, comp));
+      if(it == this->cend())
+         return size_type(0);
+      this->erase(it);
+      return size_type(1);
+   }
+
+   //! <b>Requires</b>: Disposer::operator()(pointer) shouldn't throw.
+   //!
+   //! <b>Effects</b>: Erases the element pointed to by i.
+   //!   Disposer::operator()(pointer) is called for the removed element.
+   //!
+   //! <b>Complexity</b>: Logarithmic.
+   //!
+   //! <b>Returns</b>: An iterator to the element after the erased element.
+   //!
+   //! <b>Throws</b>: If the internal key_compare ordering function throws.
+   //!
+   //! <b>Note</b>: Invalidates the iterators
+   //!    to the erased elements.
+   template<class Disposer>
+   iterator erase_and_dispose(const_iterator i, Disposer disposer)
+   {
+      node_ptr to_erase(i.pointed_node());
+      iterator ret(this->erase(i));
+      disposer(this->priv_value_traits().to_value_ptr(to_erase));
+      return ret;
+   }
+
+   //! <b>Requires</b>: Disposer::operator()(pointer) shouldn't throw.
+   //!
+   //! <b>Effects</b>: Erases the range pointed to by b end e.
+   //!   Disposer::operator()(pointer) is called for the removed elements.
+   //!
+   //! <b>Complexity</b>: Average complexity for erase range is at most
+   //!   O(log(size() + N)), where N is the number of elements in the range.
+   //!
+   //! <b>Returns</b>: An iterator to the element after the erased elements.
+   //!
+   //! <b>Throws</b>: If the internal key_compare ordering function throws.
+   //!
+   //! <b>Note</b>: Invalidates the iterators
+   //!    to the erased elements.
+   template<class Disposer>
+   iterator erase_and_dispose(const_iterator b, const_iterator e, Disposer disposer)
+   {
+      while(b != e)
+         b = this->erase_and_dispose(b, disposer);
+      return b.unconst();
+   }
+
+   //! <b>Requires</b>: Disposer::operator()(pointer) shouldn't throw.
+   //!
+   //! <b>Effects</b>: Erases the element with the given key.
+   //!   Disposer::operator()(pointer) is called for the removed element.
+   //!
+   //! <b>Returns</b>: The number of erased elements (0 or 1).
+   //!
+   //! <b>Complexity</b>: Logarithmic.
+   //!
+   //! <b>Throws</b>: If the internal key_compare ordering function throws.
+   //!
+   //! <b>Note</b>: Invalidates the iterators
+   //!    to the erased elements.
+   template<class Disposer>
+   inline size_type erase_and_dispose(const key_type &key, Disposer disposer)
+   {  return this->erase_and_dispose(key, this->key_comp(), disposer);   }
+
+   //! <b>Requires</b>: key is a value such that `*this` is partitioned with respect to
+   //!   comp(nk, key) and !comp(key, nk), with comp(nk, key) implying !comp(key, nk),
+   //!   with nk the key_type of a value_type inserted into `*this`.
+   //!
+   //!   Disposer::operator()(pointer) shouldn't throw.
+   //!
+   //! <b>Effects</b>: Erases the element with the given key.
+   //!   Disposer::operator()(pointer) is called for the removed element.
+   //!
+   //! <b>Returns</b>: The number of erased elements (0 or 1).
+   //!
+   //! <b>Complexity</b>: Logarithmic.
+   //!
+   //! <b>Throws</b>: If comp or the internal key_compare ordering function throws.
+   //!
+   //! <b>Note</b>: Invalidates the iterators
+   //!    to the erased elements.
+   template<class KeyType, class KeyTypeKeyCompare, class Disposer>
+   BOOST_INTRUSIVE_DOC1ST(size_type
+      , typename detail::disable_if_convertible<KeyTypeKeyCompare BOOST_INTRUSIVE_I const_iterator BOOST_INTRUSIVE_I size_type>::type)
+      erase_and_dispose(const KeyType& key, KeyTypeKeyCompare comp, Disposer disposer)
+   {
+      const_iterator it(this->find(key, comp));
+      if(it == this->cend())
+         return size_type(0);
+      this->erase_and_dispose(it, disposer);
+      return size_type(1);
+   }
+
+   //! <b>Effects</b>: Erases all of the elements.
+   //!
+   //! <b>Complexity</b>: Linear to the number of elements on the container
+   //!   if it's a safe-mode hook. Constant time otherwise.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Note</b>: Invalidates the iterators (but not the references)
+   //!    to the erased elements. No destructors are called.
+   void clear() BOOST_NOEXCEPT
+   {
+      BOOST_IF_CONSTEXPR(safemode_or_autounlink){
+         this->clear_and_dispose(detail::null_disposer());
+      }
+      else{
+         this->priv_init();
+      }
+   }
+
+   //! <b>Requires</b>: Disposer::operator()(pointer) shouldn't throw.
+   //!
+   //! <b>Effects</b>: Erases all of the elements calling disposer(p) for
+   //!   each node to be erased.
+   //!
+   //! <b>Complexity</b>: Linear to the number of elements on the container.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Note</b>: Invalidates the iterators (but not the references)
+   //!    to the erased elements. Calls N times to disposer functor.
+   template<class Disposer>
+   void clear_and_dispose(Disposer disposer) BOOST_NOEXCEPT
+   {
+      node_algorithms::clear_and_dispose(this->header_ptr()
+         , detail::node_disposer<Disposer, value_traits, ThreadedRbTreeAlgorithms>(disposer, &this->priv_value_traits()));
+      this->priv_size_traits().set_size(size_type(0));
+   }
+
+   //! <b>Effects</b>: Returns the number of contained elements with the given value
+   //!
+   //! <b>Complexity</b>: Logarithmic.
+   //!
+   //! <b>Throws</b>: If `key_compare` throws.
+   inline size_type count(const key_type &key) const
+   {  return size_type(this->find(key) != this->cend());  }
+
+   //! <b>Requires</b>: key is a value such that `*this` is partitioned with respect to
+   //!   comp(nk, key) and !comp(key, nk), with comp(nk, key) implying !comp(key, nk),
+   //!   with nk the key_type of a value_type inserted into `*this`.
+   //!
+   //! <b>Effects</b>: Returns the number of contained elements with the given key
+   //!
+   //! <b>Complexity</b>: Logarithmic.
+   //!
+   //! <b>Throws</b>: If `comp` throws.
+   template<class KeyType, class KeyTypeKeyCompare>
+   inline size_type count(const KeyType &key, KeyTypeKeyCompare comp) const
+   {  return size_type(this->find(key, comp) != this->cend());  }
+
+   //! <b>Effects</b>: Returns true if an element with the given key exists.
+   //!
+   //! <b>Complexity</b>: Logarithmic.
+   //!
+   //! <b>Throws</b>: If `key_compare` throws.
+   inline bool contains(const key_type &key) const
+   {  return this->find(key) != this->cend();  }
+
+   //! <b>Requires</b>: key is a value such that `*this` is partitioned with respect to
+   //!   comp(nk, key) and !comp(key, nk), with comp(nk, key) implying !comp(key, nk),
+   //!   with nk the key_type of a value_type inserted into `*this`.
+   //!
+   //! <b>Effects</b>: Returns true if an element with the given key exists.
+   //!
+   //! <b>Complexity</b>: Logarithmic.
+   //!
+   //! <b>Throws</b>: If `comp` throws.
+   template<class KeyType, class KeyTypeKeyCompare>
+   inline bool contains(const KeyType &key, KeyTypeKeyCompare comp) const
+   {  return this->find(key, comp) != this->cend();  }
+
+   //! <b>Effects</b>: Returns an iterator to the first element whose
+   //!   key is not less than k or end() if that element does not exist.
+   //!
+   //! <b>Complexity</b>: Logarithmic.
+   //!
+   //! <b>Throws</b>: If `key_compare` throws.
+   inline iterator lower_bound(const key_type &key)
+   {  return this->lower_bound(key, this->key_comp());   }
+
+   //! <b>Effects</b>: Returns a const iterator to the first element whose
+   //!   key is not less than k or end() if that element does not exist.
+   //!
+   //! <b>Complexity</b>: Logarithmic.
+   //!
+   //! <b>Throws</b>: If `key_compare` throws.
+   inline const_iterator lower_bound(const key_type &key) const
+   {  return this->lower_bound(key, this->key_comp());   }
+
+   //! <b>Requires</b>: key is a value such that `*this` is partitioned with respect to
+   //!   comp(nk, key), with nk the key_type of a value_type inserted into `*this`.
+   //!
+   //! <b>Effects</b>: Returns an iterator to the first element whose
+   //!   key is not less than k or end() if that element does not exist.
+   //!
+   //! <b>Complexity</b>: Logarithmic.
+   //!
+   //! <b>Throws</b>: If `comp` throws.
+   template<class KeyType, class KeyTypeKeyCompare>
+   iterator lower_bound(const KeyType &key, KeyTypeKeyCompare comp)
+   {
+      return iterator(node_algorithms::lower_bound
+         (this->header_ptr(), key, this->key_node_comp(comp)), this->priv_value_traits_ptr());
+   }
+
+   //! @copydoc ::boost::intrusive::compact_set_impl::lower_bound(const KeyType&,KeyTypeKeyCompare)
+   template<class KeyType, class KeyTypeKeyCompare>
+   const_iterator lower_bound(const KeyType &key, KeyTypeKeyCompare comp) const
+   {
+      return const_iterator(node_algorithms::lower_bound
+         (this->header_ptr(), key, this->key_node_comp(comp)), this->priv_value_traits_ptr());
+   }
+
+   //! <b>Effects</b>: Returns an iterator to the first element whose
+   //!   key is greater than k or end() if that element does not exist.
+   //!
+   //! <b>Complexity</b>: Logarithmic.
+   //!
+   //! <b>Throws</b>: If `key_compare` throws.
+   inline iterator upper_bound(const key_type &key)
+   {  return this->upper_bound(key, this->key_comp());   }
+
+   //! <b>Effects</b>: Returns a const iterator to the first element whose
+   //!   key is greater than k or end() if that element does not exist.
+   //!
+   //! <b>Complexity</b>: Logarithmic.
+   //!
+   //! <b>Throws</b>: If `key_compare` throws.
+   inline const_iterator upper_bound(const key_type &key) const
+   {  return this->upper_bound(key, this->key_comp());   }
+
+   //! <b>Requires</b>: key is a value such that `*this` is partitioned with respect to
+   //!   !comp(key, nk), with nk the key_type of a value_type inserted into `*this`.
+   //!
+   //! <b>Effects</b>: Returns an iterator to the first element whose
+   //!   key is greater than k according to comp or end() if that element
+   //!   does not exist.
+   //!
+   //! <b>Complexity</b>: Logarithmic.
+   //!
+   //! <b>Throws</b>: If `comp` throws.
+   template<class KeyType, class KeyTypeKeyCompare>
+   iterator upper_bound(const KeyType &key, KeyTypeKeyCompare comp)
+   {
+      return iterator(node_algorithms::upper_bound
+         (this->header_ptr(), key, this->key_node_comp(comp)), this->priv_value_traits_ptr());
+   }
+
+   //! @copydoc ::boost::intrusive::compact_set_impl::upper_bound(const KeyType&,KeyTypeKeyCompare)
+   template<class KeyType, class KeyTypeKeyCompare>
+   const_iterator upper_bound(const KeyType &key, KeyTypeKeyCompare comp) const
+   {
+      return const_iterator(node_algorithms::upper_bound
+         (this->header_ptr(), key, this->key_node_comp(comp)), this->priv_value_traits_ptr());
+   }
+
+   //! <b>Effects</b>: Finds an iterator to the first element whose key is
+   //!   k or end() if that element does not exist.
+   //!
+   //! <b>Complexity</b>: Logarithmic.
+   //!
+   //! <b>Throws</b>: If `key_compare` throws.
+   inline iterator find(const key_type &key)
+   {  return this->find(key, this->key_comp()); }
+
+   //! <b>Effects</b>: Finds a const_iterator to the first element whose key is
+   //!   k or end() if that element does not exist.
+   //!
+   //! <b>Complexity</b>: Logarithmic.
+   //!
+   //! <b>Throws</b>: If `key_compare` throws.
+   inline const_iterator find(const key_type &key) const
+   {  return this->find(key, this->key_comp()); }
+
+   //! <b>Requires</b>: key is a value such that `*this` is partitioned with respect to
+   //!   comp(nk, key) and !comp(key, nk), with comp(nk, key) implying !comp(key, nk),
+   //!   with nk the key_type of a value_type inserted into `*this`.
+   //!
+   //! <b>Effects</b>: Finds an iterator to the first element whose key is
+   //!   k or end() if that element does not exist.
+   //!
+   //! <b>Complexity</b>: Logarithmic.
+   //!
+   //! <b>Throws</b>: If `comp` throws.
+   template<class KeyType, class KeyTypeKeyCompare>
+   iterator find(const KeyType &key, KeyTypeKeyCompare comp)
+   {
+      return iterator
+         (node_algorithms::find(this->header_ptr(), key, this->key_node_comp(comp)), this->priv_value_traits_ptr());
+   }
+
+   //! @copydoc ::boost::intrusive::compact_set_impl::find(const KeyType&,KeyTypeKeyCompare)
+   template<class KeyType, class KeyTypeKeyCompare>
+   const_iterator find(const KeyType &key, KeyTypeKeyCompare comp) const
+   {
+      return const_iterator
+         (node_algorithms::find(this->header_ptr(), key, this->key_node_comp(comp)), this->priv_value_traits_ptr());
+   }
+
+   //! <b>Effects</b>: Finds a range containing all elements whose key is k or
+   //!   an empty range that indicates the position where those elements would be
+   //!   if there is no elements with key k.
+   //!
+   //! <b>Complexity</b>: Logarithmic.
+   //!
+   //! <b>Throws</b>: If `key_compare` throws.
+   inline std::pair<iterator,iterator> equal_range(const key_type &key)
+   {  return this->equal_range(key, this->key_comp());   }
+
+   //! <b>Effects</b>: Finds a range containing all elements whose key is k or
+   //!   an empty range that indicates the position where those elements would be
+   //!   if there is no elements with key k.
+   //!
+   //! <b>Complexity</b>: Logarithmic.
+   //!
+   //! <b>Throws</b>: If `key_compare` throws.
+   inline std::pair<const_iterator, const_iterator> equal_range(const key_type &key) const
+   {  return this->equal_range(key, this->key_comp());   }
+
+   //! <b>Requires</b>: key is a value such that `*this` is partitioned with respect to
+   //!   comp(nk, key) and !comp(key, nk), with comp(nk, key) implying !comp(key, nk),
+   //!   with nk the key_type of a value_type inserted into `*this`.
+   //!
+   //! <b>Effects</b>: Finds a range containing all elements whose key is k or
+   //!   an empty range that indicates the position where those elements would be
+   //!   if there is no elements with key k.
+   //!
+   //! <b>Complexity</b>: Logarithmic.
+   //!
+   //! <b>Throws</b>: If `comp` throws.
+   template<class KeyType, class KeyTypeKeyCompare>
+   std::pair<iterator,iterator> equal_range(const KeyType &key, KeyTypeKeyCompare comp)
+   {
+      iterator lb(this->lower_bound(key, comp));
+      iterator ub(lb);
+      if(ub != this->end() && !this->key_node_comp(comp)(key, ub.pointed_node()))
+         ++ub;
+      return std::pair<iterator,iterator>(lb, ub);
+   }
+
+   //! @copydoc ::boost::intrusive::compact_set_impl::equal_range(const KeyType&,KeyTypeKeyCompare)
+   template<class KeyType, class KeyTypeKeyCompare>
+   std::pair<const_iterator, const_iterator> equal_range(const KeyType &key, KeyTypeKeyCompare comp) const
+   {
+      const_iterator lb(this->lower_bound(key, comp));
+      const_iterator ub(lb);
+      if(ub != this->cend() && !this->key_node_comp(comp)(key, ub.pointed_node()))
+         ++ub;
+      return std::pair<const_iterator, const_iterator>(lb, ub);
+   }
+
+   //! <b>Requires</b>: value must be an lvalue and shall be in a compact_set of
+   //!   appropriate type. Otherwise the behavior is undefined.
+   //!
+   //! <b>Effects</b>: Returns: a valid iterator i belonging to the compact_set
+   //!   that points to the value
+   //!
+   //! <b>Complexity</b>: Constant.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Note</b>: This static function is available only if the <i>value traits</i>
+   //!   is stateless.
+   static iterator s_iterator_to(reference value) BOOST_NOEXCEPT
+   {
+      BOOST_INTRUSIVE_STATIC_ASSERT((!stateful_value_traits));
+      return iterator (value_traits::to_node_ptr(value), const_value_traits_ptr());
+   }
+
+   //! <b>Requires</b>: value must be an lvalue and shall be in a compact_set of
+   //!   appropriate type. Otherwise the behavior is undefined.
+   //!
+   //! <b>Effects</b>: Returns: a valid const_iterator i belonging to the
+   //!   compact_set that points to the value
+   //!
+   //! <b>Complexity</b>: Constant.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Note</b>: This static function is available only if the <i>value traits</i>
+   //!   is stateless.
+   static const_iterator s_iterator_to(const_reference value) BOOST_NOEXCEPT
+   {
+      BOOST_INTRUSIVE_STATIC_ASSERT((!stateful_value_traits));
+      return const_iterator (value_traits::to_node_ptr(*pointer_traits<pointer>::const_cast_from(pointer_traits<const_pointer>::pointer_to(value))), const_value_traits_ptr());
+   }
+
+   //! <b>Requires</b>: value must be an lvalue and shall be in a compact_set of
+   //!   appropriate type. Otherwise the behavior is undefined.
+   //!
+   //! <b>Effects</b>: Returns: a valid iterator i belonging to the compact_set
+   //!   that points to the value
+   //!
+   //! <b>Complexity</b>: Constant.
+   //!
+   //! <b>Throws</b>: Nothing.
+   iterator iterator_to(reference value) BOOST_NOEXCEPT
+   {  return iterator (this->priv_value_traits().to_node_ptr(value), this->priv_value_traits_ptr()); }
+
+   //! <b>Requires</b>: value must be an lvalue and shall be in a compact_set of
+   //!   appropriate type. Otherwise the behavior is undefined.
+   //!
+   //! <b>Effects</b>: Returns: a valid const_iterator i belonging to the
+   //!   compact_set that points to the value
+   //!
+   //! <b>Complexity</b>: Constant.
+   //!
+   //! <b>Throws</b>: Nothing.
+   const_iterator iterator_to(const_reference value) const BOOST_NOEXCEPT
+   {  return const_iterator (this->priv_value_traits().to_node_ptr(*pointer_traits<pointer>::const_cast_from(pointer_traits<const_pointer>::pointer_to(value))), this->priv_value_traits_ptr()); }
+
+   //! <b>Requires</b>: value shall not be in a container.
+   //!
+   //! <b>Effects</b>: init_node puts the hook of a value in a well-known default
+   //!   state.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant time.
+   //!
+   //! <b>Note</b>: This function puts the hook in the well-known default state
+   //!   used by auto_unlink and safe hooks.
+   inline static void init_node(reference value) BOOST_NOEXCEPT
+   { node_algorithms::init(value_traits::to_node_ptr(value)); }
+
+   //! <b>Effects</b>: Asserts the integrity of the container: ordering,
+   //!   threads, red-black invariants and the stored size.
+   //!
+   //! <b>Complexity</b>: Linear time.
+   //!
+   //! <b>Note</b>: The method has no effect when asserts are turned off (e.g., with NDEBUG).
+   //!   Only for debugging purposes.
+   void check() const
+   {
+      const std::size_t n = node_algorithms::check(this->header_ptr(), this->priv_node_comp());
+      BOOST_INTRUSIVE_INVARIANT_ASSERT(!constant_time_size || n == this->size());
+      (void)n;
+   }
+
+   /// @cond
+   private:
+   static compact_set_impl &priv_container_from_end_iterator(const const_iterator &end_iterator) BOOST_NOEXCEPT
+   {
+      BOOST_INTRUSIVE_STATIC_ASSERT((has_container_from_iterator));
+      node_ptr p = end_iterator.pointed_node();
+      header_holder_type* h = header_holder_type::get_holder(p);
+      root_plus_size* r = detail::parent_from_member
+         < root_plus_size, header_holder_type>(h, &root_plus_size::m_header);
+      data_t *d = detail::parent_from_member<data_t, root_plus_size>
+         ( r, &data_t::root_plus_size_);
+      compact_set_impl *s  = detail::parent_from_member<compact_set_impl, data_t>(d, &compact_set_impl::data_);
+      return *s;
+   }
+   /// @endcond
+};
+
+//! Helper metafunction to define a \c compact_set that yields to the same type when the
+//! same options (either explicitly or implicitly) are used.
+#if defined(BOOST_INTRUSIVE_DOXYGEN_INVOKED) || defined(BOOST_INTRUSIVE_VARIADIC_TEMPLATES)
+template<class T, class ...Options>
+#else
+template<class T, class O1 = void, class O2 = void
+                , class O3 = void, class O4 = void
+                , class O5 = void, class O6 = void>
+#endif
+struct make_compact_set
+{
+   /// @cond
+   typedef typename pack_options
+      < compact_set_defaults,
+      #if !defined(BOOST_INTRUSIVE_VARIADIC_TEMPLATES)
+      O1, O2, O3, O4, O5, O6
+      #else
+      Options...
+      #endif
+      >::type packed_options;
+
+   typedef typename detail::get_value_traits
+      <T, typename packed_options::proto_value_traits>::type value_traits;
+
+   typedef compact_set_impl
+         < value_traits
+         , typename packed_options::key_of_value
+         , typename packed_options::compare
+         , typename packed_options::size_type
+         , packed_options::constant_time_size
+         , typename packed_options::header_holder_type
+         > implementation_defined;
+   /// @endcond
+   typedef implementation_defined type;
+};
+
+#ifndef BOOST_INTRUSIVE_DOXYGEN_INVOKED
+#if !defined(BOOST_INTRUSIVE_VARIADIC_TEMPLATES)
+template<class T, class O1, class O2, class O3, class O4, class O5, class O6>
+#else
+template<class T, class ...Options>
+#endif
+class compact_set
+   :  public make_compact_set<T,
+   #if !defined(BOOST_INTRUSIVE_VARIADIC_TEMPLATES)
+   O1, O2, O3, O4, O5, O6
+   #else
+   Options...
+   #endif
+   >::type
+{
+   typedef typename make_compact_set
+      <T,
+      #if !defined(BOOST_INTRUSIVE_VARIADIC_TEMPLATES)
+      O1, O2, O3, O4, O5, O6
+      #else
+      Options...
+      #endif
+      >::type   Base;
+
+   BOOST_MOVABLE_BUT_NOT_COPYABLE(compact_set)
+   public:
+   typedef typename Base::key_compare        key_compare;
+   typedef typename Base::value_traits       value_traits;
+   typedef typename Base::iterator           iterator;
+   typedef typename Base::const_iterator     const_iterator;
+
+   //Assert if passed value traits are compatible with the type
+   BOOST_INTRUSIVE_STATIC_ASSERT((detail::is_same<typename value_traits::value_type, T>::value));
+
+   inline compact_set()
+      :  Base()
+   {}
+
+   inline explicit compact_set( const key_compare &cmp, const value_traits &v_traits = value_traits())
+      :  Base(cmp, v_traits)
+   {}
+
+   template<class Iterator>
+   inline compact_set( Iterator b, Iterator e
+      , const key_compare &cmp = key_compare()
+      , const value_traits &v_traits = value_traits())
+      :  Base(b, e, cmp, v_traits)
+   {}
+
+   inline compact_set(BOOST_RV_REF(compact_set) x)
+      :  Base(BOOST_MOVE_BASE(Base, x))
+   {}
+
+   inline compact_set& operator=(BOOST_RV_REF(compact_set) x)
+   {  return static_cast<compact_set &>(this->Base::operator=(BOOST_MOVE_BASE(Base, x)));  }
+
+   template <class Cloner, class Disposer>
+   inline void clone_from(const compact_set &src, Cloner cloner, Disposer disposer)
+   {  Base::clone_from(src, cloner, disposer);  }
+
+   template <class Cloner, class Disposer>
+   inline void clone_from(BOOST_RV_REF(compact_set) src, Cloner cloner, Disposer disposer)
+   {  Base::clone_from(BOOST_MOVE_BASE(Base, src), cloner, disposer);  }
+
+   BOOST_INTRUSIVE_NO_DANGLING
+   inline static compact_set &container_from_end_iterator(iterator end_iterator) BOOST_NOEXCEPT
+   {  return static_cast<compact_set &>(Base::container_from_end_iterator(end_iterator));   }
+
+   BOOST_INTRUSIVE_NO_DANGLING
+   inline static const compact_set &container_from_end_iterator(const_iterator end_iterator) BOOST_NOEXCEPT
+   {  return static_cast<const compact_set &>(Base::container_from_end_iterator(end_iterator));   }
+};
+
+#endif
+
+} //namespace intrusive
+} //namespace boost
+
+#include <boost/intrusive/detail/config_end.hpp>
+
+#endif //BOOST_INTRUSIVE_COMPACT_SET_HPP
@@ -38,6 +38,10 @@ enum algo_types
    TreapAlgorithms,
    UnorderedAlgorithms,
    UnorderedCircularSlistAlgorithms,
+   ThreadedRbTreeAlgorithms,
+   XorListAlgorithms,
+   GroupTreeAlgorithms,
+   OrderListAlgorithms,
    AnyAlgorithm
 };
 
@@ -0,0 +1,87 @@
+/////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright agent 2026
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/intrusive for documentation.
+//
+/////////////////////////////////////////////////////////////////////////////
+
+#ifndef BOOST_INTRUSIVE_DETAIL_ATOMIC_SLIST_LINK_HPP
+#define BOOST_INTRUSIVE_DETAIL_ATOMIC_SLIST_LINK_HPP
+
+#ifndef BOOST_CONFIG_HPP
+#  include <boost/config.hpp>
+#endif
+
+#if defined(BOOST_HAS_PRAGMA_ONCE)
+#  pragma once
+#endif
+
+#include <boost/intrusive/detail/slist_node.hpp>
+#include <atomic>
+
+#if defined(__cpp_lib_atomic_ref) && (__cpp_lib_atomic_ref >= 201806L)
+#  define BOOST_INTRUSIVE_HAS_ATOMIC_REF
+#elif !defined(__GNUC__) && !defined(__clang__)
+#  error "Boost.Intrusive: atomic access to slist hooks needs std::atomic_ref or GCC atomic builtins"
+#endif
+
+namespace boost {
+namespace intrusive {
+namespace detail {
+
+//Atomic access to the link of an slist node (slist_node_traits<void*>::node) that is shared
+//between threads. Other threads might concurrently read the link, so it must not be
+//accessed through the non-atomic slist_node_traits functions.
+struct atomic_slist_link
+{
+   typedef slist_node_traits<void*>    node_traits;
+   typedef node_traits::node           node;
+   typedef node_traits::node_ptr       node_ptr;
+
+   static node_ptr load_relaxed(const node *n) BOOST_NOEXCEPT
+   {
+      #if defined(BOOST_INTRUSIVE_HAS_ATOMIC_REF)
+      return std::atomic_ref<node_ptr>(const_cast<node_ptr&>(n->next_)).load(std::memory_order_relaxed);
+      #else
+      return __atomic_load_n(&n->next_, __ATOMIC_RELAXED);
+      #endif
+   }
+
+   static node_ptr load_acquire(const node *n) BOOST_NOEXCEPT
+   {
+      #if defined(BOOST_INTRUSIVE_HAS_ATOMIC_REF)
+      return std::atomic_ref<node_ptr>(const_cast<node_ptr&>(n->next_)).load(std::memory_order_acquire);
+      #else
+      return __atomic_load_n(&n->next_, __ATOMIC_ACQUIRE);
+      #endif
+   }
+
+   static void store_relaxed(node *n, node_ptr next) BOOST_NOEXCEPT
+   {
+      #if defined(BOOST_INTRUSIVE_HAS_ATOMIC_REF)
+      std::atomic_ref<node_ptr>(n->next_).store(next, std::memory_order_relaxed);
+      #else
+      __atomic_store_n(&n->next_, next, __ATOMIC_RELAXED);
+      #endif
+   }
+
+   static void store_release(node *n, node_ptr next) BOOST_NOEXCEPT
+   {
+      #if defined(BOOST_INTRUSIVE_HAS_ATOMIC_REF)
+      std::atomic_ref<node_ptr>(n->next_).store(next, std::memory_order_release);
+      #else
+      __atomic_store_n(&n->next_, next, __ATOMIC_RELEASE);
+      #endif
+   }
+};
+
+} //namespace detail
+} //namespace intrusive
+} //namespace boost
+
+#endif //BOOST_INTRUSIVE_DETAIL_ATOMIC_SLIST_LINK_HPP
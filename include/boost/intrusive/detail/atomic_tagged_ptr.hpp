@@ -0,0 +1,132 @@
+/////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright agent 2026
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/intrusive for documentation.
+//
+/////////////////////////////////////////////////////////////////////////////
+
+#ifndef BOOST_INTRUSIVE_DETAIL_ATOMIC_TAGGED_PTR_HPP
+#define BOOST_INTRUSIVE_DETAIL_ATOMIC_TAGGED_PTR_HPP
+
+#ifndef BOOST_CONFIG_HPP
+#  include <boost/config.hpp>
+#endif
+
+#if defined(BOOST_HAS_PRAGMA_ONCE)
+#  pragma once
+#endif
+
+#include <boost/intrusive/detail/assert.hpp>
+#include <boost/cstdint.hpp>
+#include <atomic>
+#include <cstddef>
+
+//On x86-64 user space addresses fit in the lower 48 bits with 4-level paging, so the tag
+//is stored in the upper 16 bits and the tagged pointer is updated with an ordinary
+//compare_exchange. With 5-level paging (LA57) the kernel can map user memory above 2^47
+//(e.g. if mmap is given such a hint), so programs that might place elements there must
+//define BOOST_INTRUSIVE_DISABLE_TAGGED_PTR_COMPRESSION. Elsewhere the pointer and the tag
+//are two words updated with a double-width compare_exchange.
+#if !defined(BOOST_INTRUSIVE_DISABLE_TAGGED_PTR_COMPRESSION) && (defined(__x86_64__) || defined(_M_X64))
+#  define BOOST_INTRUSIVE_TAGGED_PTR_COMPRESSION
+#endif
+
+namespace boost {
+namespace intrusive {
+namespace detail {
+
+//An atomic pointer plus a tag that is incremented by every successful compare_exchange,
+//so that a compare_exchange fails if the pointer was replaced and stored again since it
+//was loaded (the ABA problem).
+template<class T>
+class atomic_tagged_ptr
+{
+   #if defined(BOOST_INTRUSIVE_TAGGED_PTR_COMPRESSION)
+   typedef boost::uint64_t tagged_type;
+   static const unsigned tag_shift = 48u;
+   #else
+   struct BOOST_ALIGNMENT(2*sizeof(void*)) tagged_type
+   {
+      T *ptr_;
+      std::size_t tag_;
+   };
+   #endif
+
+   atomic_tagged_ptr(const atomic_tagged_ptr &);
+   atomic_tagged_ptr &operator=(const atomic_tagged_ptr &);
+
+   public:
+   struct value_type
+   {
+      T *ptr;
+      std::size_t tag;
+   };
+
+   explicit atomic_tagged_ptr(T *p)
+      : v_(pack(p, 0u))
+   {}
+
+   value_type load(std::memory_order order) const
+   {  return unpack(v_.load(order));  }
+
+   //Stores desired with the tag of expected plus one if the stored value is expected.
+   //Otherwise loads the stored value in expected.
+   bool compare_exchange_weak
+      (value_type &expected, T *desired, std::memory_order success, std::memory_order failure)
+   {
+      tagged_type e(pack(expected.ptr, expected.tag));
+      if(v_.compare_exchange_weak(e, pack(desired, expected.tag + 1u), success, failure))
+         return true;
+      expected = unpack(e);
+      return false;
+   }
+
+   bool is_lock_free() const
+   {  return v_.is_lock_free();  }
+
+   private:
+   #if defined(BOOST_INTRUSIVE_TAGGED_PTR_COMPRESSION)
+   static tagged_type pack(T *p, std::size_t tag)
+   {
+      //The address must fit in the bits not used by the tag
+      BOOST_INTRUSIVE_INVARIANT_ASSERT((tagged_type(reinterpret_cast<std::size_t>(p)) >> tag_shift) == 0u);
+      return (tagged_type(reinterpret_cast<std::size_t>(p)) & ((tagged_type(1u) << tag_shift) - 1u))
+           | (tagged_type(tag) << tag_shift);
+   }
+
+   static value_type unpack(tagged_type t)
+   {
+      const value_type v =
+         { reinterpret_cast<T*>(std::size_t(t & ((tagged_type(1u) << tag_shift) - 1u)))
+         , std::size_t(t >> tag_shift) };
+      return v;
+   }
+   #else
+   static tagged_type pack(T *p, std::size_t tag)
+   {
+      tagged_type t;
+      t.ptr_ = p;
+      t.tag_ = tag;
+      return t;
+   }
+
+   static value_type unpack(const tagged_type &t)
+   {
+      const value_type v = { t.ptr_, t.tag_ };
+      return v;
+   }
+   #endif
+
+   std::atomic<tagged_type> v_;
+};
+
+} //namespace detail
+} //namespace intrusive
+} //namespace boost
+
+#endif //BOOST_INTRUSIVE_DETAIL_ATOMIC_TAGGED_PTR_HPP
@@ -42,7 +42,7 @@ class bstree_algorithms_base
    //! <b>Complexity</b>: Average constant time.
    //!
    //! <b>Throws</b>: Nothing.
-   static node_ptr next_node(node_ptr n) BOOST_NOEXCEPT
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR static node_ptr next_node(node_ptr n) BOOST_NOEXCEPT
    {
       node_ptr const n_right(NodeTraits::get_right(n));
       if(n_right){
@@ -65,7 +65,7 @@ class bstree_algorithms_base
    //! <b>Complexity</b>: Average constant time.
    //!
    //! <b>Throws</b>: Nothing.
-   static node_ptr prev_node(node_ptr n) BOOST_NOEXCEPT
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR static node_ptr prev_node(node_ptr n) BOOST_NOEXCEPT
    {
       if(is_header(n)){
          return NodeTraits::get_right(n);
@@ -91,7 +91,7 @@ class bstree_algorithms_base
    //! <b>Complexity</b>: Logarithmic to the size of the subtree.
    //!
    //! <b>Throws</b>: Nothing.
-   static node_ptr minimum(node_ptr n)
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR static node_ptr minimum(node_ptr n)
    {
       for(node_ptr p_left = NodeTraits::get_left(n)
          ;p_left
@@ -108,7 +108,7 @@ class bstree_algorithms_base
    //! <b>Complexity</b>: Logarithmic to the size of the subtree.
    //!
    //! <b>Throws</b>: Nothing.
-   static node_ptr maximum(node_ptr n)
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR static node_ptr maximum(node_ptr n)
    {
       for(node_ptr p_right = NodeTraits::get_right(n)
          ;p_right
@@ -125,7 +125,7 @@ class bstree_algorithms_base
    //! <b>Complexity</b>: Constant.
    //!
    //! <b>Throws</b>: Nothing.
-   static bool is_header(const_node_ptr p) BOOST_NOEXCEPT
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR static bool is_header(const_node_ptr p) BOOST_NOEXCEPT
    {
       node_ptr p_left (NodeTraits::get_left(p));
       node_ptr p_right(NodeTraits::get_right(p));
@@ -149,7 +149,7 @@ class bstree_algorithms_base
    //! <b>Complexity</b>: Logarithmic.
    //!
    //! <b>Throws</b>: Nothing.
-   static node_ptr get_header(const_node_ptr n)
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR static node_ptr get_header(const_node_ptr n)
    {
       node_ptr nn(detail::uncast(n));
       node_ptr p(NodeTraits::get_parent(n));
@@ -40,7 +40,7 @@ class common_slist_algorithms
    typedef typename NodeTraits::const_node_ptr  const_node_ptr;
    typedef NodeTraits                           node_traits;
 
-   static node_ptr get_previous_node(node_ptr p, node_ptr this_node)
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR static node_ptr get_previous_node(node_ptr p, node_ptr this_node)
    {
       for( node_ptr p_next
          ; this_node != (p_next = NodeTraits::get_next(p))
@@ -52,41 +52,41 @@ class common_slist_algorithms
       return p;
    }
 
-   inline static void init(node_ptr this_node) BOOST_NOEXCEPT
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR static void init(node_ptr this_node) BOOST_NOEXCEPT
    {  NodeTraits::set_next(this_node, node_ptr());  }
 
-   static bool unique(const_node_ptr this_node) BOOST_NOEXCEPT
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR static bool unique(const_node_ptr this_node) BOOST_NOEXCEPT
    {
       node_ptr next = NodeTraits::get_next(this_node);
       return !next || next == this_node;
    }
 
-   inline static bool inited(const_node_ptr this_node) BOOST_NOEXCEPT
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR static bool inited(const_node_ptr this_node) BOOST_NOEXCEPT
    {  return !NodeTraits::get_next(this_node); }
 
-   inline static void unlink_after(node_ptr prev_node) BOOST_NOEXCEPT
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR static void unlink_after(node_ptr prev_node) BOOST_NOEXCEPT
    {
       const_node_ptr this_node(NodeTraits::get_next(prev_node));
       NodeTraits::set_next(prev_node, NodeTraits::get_next(this_node));
    }
 
-   inline static void unlink_after(node_ptr prev_node, node_ptr last_node) BOOST_NOEXCEPT
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR static void unlink_after(node_ptr prev_node, node_ptr last_node) BOOST_NOEXCEPT
    {  NodeTraits::set_next(prev_node, last_node);  }
 
-   static void link_after(node_ptr prev_node, node_ptr this_node) BOOST_NOEXCEPT
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR static void link_after(node_ptr prev_node, node_ptr this_node) BOOST_NOEXCEPT
    {
       NodeTraits::set_next(this_node, NodeTraits::get_next(prev_node));
       NodeTraits::set_next(prev_node, this_node);
    }
 
-   static void incorporate_after(node_ptr bp, node_ptr b, node_ptr be) BOOST_NOEXCEPT
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR static void incorporate_after(node_ptr bp, node_ptr b, node_ptr be) BOOST_NOEXCEPT
    {
       node_ptr p(NodeTraits::get_next(bp));
       NodeTraits::set_next(bp, b);
       NodeTraits::set_next(be, p);
    }
 
-   static void transfer_after(node_ptr bp, node_ptr bb, node_ptr be) BOOST_NOEXCEPT
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR static void transfer_after(node_ptr bp, node_ptr bb, node_ptr be) BOOST_NOEXCEPT
    {
       if (bp != bb && bp != be && bb != be) {
          node_ptr next_b = NodeTraits::get_next(bb);
@@ -107,7 +107,7 @@ class common_slist_algorithms
    };
 
    template<class Pred>
-   static void stable_partition(node_ptr before_beg, node_ptr end, Pred pred, stable_partition_info &info)
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR static void stable_partition(node_ptr before_beg, node_ptr end, Pred pred, stable_partition_info &info)
    {
       node_ptr bcur = before_beg;
       node_ptr cur  = node_traits::get_next(bcur);
@@ -167,7 +167,7 @@ class common_slist_algorithms
    //! <b>Complexity</b>: Linear
    //!
    //! <b>Throws</b>: Nothing.
-   static std::size_t distance(const_node_ptr f, const_node_ptr l) BOOST_NOEXCEPT
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR static std::size_t distance(const_node_ptr f, const_node_ptr l) BOOST_NOEXCEPT
    {
       const_node_ptr i(f);
       std::size_t result = 0;
@@ -191,7 +191,7 @@ class common_slist_algorithms
    //!
    //! <b>Throws</b>: Nothing.
    template<class Disposer>
-   static std::size_t unlink_after_and_dispose(node_ptr bb, node_ptr e, Disposer disposer) BOOST_NOEXCEPT
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR static std::size_t unlink_after_and_dispose(node_ptr bb, node_ptr e, Disposer disposer) BOOST_NOEXCEPT
    {
       std::size_t n = 0u;
       node_ptr i = node_traits::get_next(bb);
@@ -216,7 +216,7 @@ class common_slist_algorithms
    //!
    //! <b>Throws</b>: Nothing.
    template<class Disposer>
-   inline static void unlink_after_and_dispose(node_ptr bb, Disposer disposer) BOOST_NOEXCEPT
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR static void unlink_after_and_dispose(node_ptr bb, Disposer disposer) BOOST_NOEXCEPT
    {
       node_ptr i = node_traits::get_next(bb);
       node_traits::set_next(bb, node_traits::get_next(i));
@@ -234,7 +234,7 @@ class common_slist_algorithms
    //!
    //! <b>Throws</b>: Nothing.
    template<class Disposer>
-   static std::size_t detach_and_dispose(node_ptr p, Disposer disposer) BOOST_NOEXCEPT
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR static std::size_t detach_and_dispose(node_ptr p, Disposer disposer) BOOST_NOEXCEPT
    {
       std::size_t n = 0;
       node_ptr i = node_traits::get_next(p);
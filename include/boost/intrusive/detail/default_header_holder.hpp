@@ -38,16 +38,16 @@ struct default_header_holder : public NodeTraits::node
    typedef typename node_traits::node_ptr node_ptr;
    typedef typename node_traits::const_node_ptr const_node_ptr;
 
-   default_header_holder() : node() {}
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR default_header_holder() : node() {}
 
-   inline const_node_ptr get_node() const
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR const_node_ptr get_node() const
    { return pointer_traits< const_node_ptr >::pointer_to(*static_cast< const node* >(this)); }
 
-   inline node_ptr get_node()
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR node_ptr get_node()
    { return pointer_traits< node_ptr >::pointer_to(*static_cast< node* >(this)); }
 
    // (unsafe) downcast used to implement container-from-iterator
-   inline static default_header_holder* get_holder(node_ptr p)
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR static default_header_holder* get_holder(node_ptr p)
    { return static_cast< default_header_holder* >(boost::movelib::to_raw_pointer(p)); }
 };
 
@@ -63,6 +63,40 @@ struct get_header_holder_type< ValueTraits, void >
    typedef default_header_holder< typename ValueTraits::node_traits > type;
 };
 
+// tag marking the header holder of a tree that counts its modifications (modification_epoch<true>)
+template < typename HeaderHolder >
+struct epoch_header_holder
+{};
+
+template < typename ValueTraits, typename HeaderHolder >
+struct get_header_holder_type< ValueTraits, epoch_header_holder<HeaderHolder> >
+   : get_header_holder_type< ValueTraits, HeaderHolder >
+{};
+
+template < bool ModificationEpoch, typename HeaderHolder >
+struct get_epoch_header_holder
+{
+   typedef HeaderHolder type;
+};
+
+template < typename HeaderHolder >
+struct get_epoch_header_holder< true, HeaderHolder >
+{
+   typedef epoch_header_holder<HeaderHolder> type;
+};
+
+template < typename HeaderHolder >
+struct has_modification_epoch
+{
+   static const bool value = false;
+};
+
+template < typename HeaderHolder >
+struct has_modification_epoch< epoch_header_holder<HeaderHolder> >
+{
+   static const bool value = true;
+};
+
 } //namespace detail
 } //namespace intrusive
 } //namespace boost
@@ -38,58 +38,58 @@ class ebo_functor_holder
    public:
    typedef T functor_type;
 
-   inline ebo_functor_holder()
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR ebo_functor_holder()
       : T()
    {}
 
-   inline explicit ebo_functor_holder(const T &t)
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR explicit ebo_functor_holder(const T &t)
       : T(t)
    {}
 
-   inline explicit ebo_functor_holder(BOOST_RV_REF(T) t)
-      : T(::boost::move(t))
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR explicit ebo_functor_holder(BOOST_RV_REF(T) t)
+      : T(static_cast<BOOST_RV_REF(T)>(t))
    {}
 
    template<class Arg1, class Arg2>
-   inline ebo_functor_holder(BOOST_FWD_REF(Arg1) arg1, BOOST_FWD_REF(Arg2) arg2)
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR ebo_functor_holder(BOOST_FWD_REF(Arg1) arg1, BOOST_FWD_REF(Arg2) arg2)
       : T(::boost::forward<Arg1>(arg1), ::boost::forward<Arg2>(arg2))
    {}
 
-   inline ebo_functor_holder(const ebo_functor_holder &x)
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR ebo_functor_holder(const ebo_functor_holder &x)
       : T(static_cast<const T&>(x))
    {}
 
-   inline ebo_functor_holder(BOOST_RV_REF(ebo_functor_holder) x)
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR ebo_functor_holder(BOOST_RV_REF(ebo_functor_holder) x)
       : T(BOOST_MOVE_BASE(T, x))
    {}
 
-   inline ebo_functor_holder& operator=(BOOST_COPY_ASSIGN_REF(ebo_functor_holder) x)
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR ebo_functor_holder& operator=(BOOST_COPY_ASSIGN_REF(ebo_functor_holder) x)
    {
       const ebo_functor_holder&r = x;
       this->get() = r;
       return *this;
    }
 
-   inline ebo_functor_holder& operator=(BOOST_RV_REF(ebo_functor_holder) x)
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR ebo_functor_holder& operator=(BOOST_RV_REF(ebo_functor_holder) x)
    {
       this->get() = ::boost::move(x.get());
       return *this;
    }
 
-   inline ebo_functor_holder& operator=(const T &t)
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR ebo_functor_holder& operator=(const T &t)
    {
       this->get() = t;
       return *this;
    }
 
-   inline ebo_functor_holder& operator=(BOOST_RV_REF(T) t)
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR ebo_functor_holder& operator=(BOOST_RV_REF(T) t)
    {
       this->get() = ::boost::move(t);
       return *this;
    }
 
-   inline T&       get(){return *this;}
-   inline const T& get()const{return *this;}
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR T&       get(){return *this;}
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR const T& get()const{return *this;}
 };
 
 template<typename T, typename Tag>
@@ -100,41 +100,41 @@ class ebo_functor_holder<T *, Tag>
    public:
    typedef T functor_type;
 
-   inline ebo_functor_holder()
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR ebo_functor_holder()
       : t_()
    {}
 
-   inline explicit ebo_functor_holder(T * t)
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR explicit ebo_functor_holder(T * t)
       : t_(t)
    {}
 
-   inline ebo_functor_holder(const ebo_functor_holder &x)
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR ebo_functor_holder(const ebo_functor_holder &x)
       : t_(x.t_)
    {}
 
-   inline ebo_functor_holder(BOOST_RV_REF(ebo_functor_holder) x)
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR ebo_functor_holder(BOOST_RV_REF(ebo_functor_holder) x)
       : t_(x.t_)
    {}
 
-   inline ebo_functor_holder& operator=(BOOST_COPY_ASSIGN_REF(ebo_functor_holder) x)
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR ebo_functor_holder& operator=(BOOST_COPY_ASSIGN_REF(ebo_functor_holder) x)
    {
       this->t_ = x.t_;
       return *this;
    }
 
-   inline ebo_functor_holder& operator=(BOOST_RV_REF(ebo_functor_holder) x)
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR ebo_functor_holder& operator=(BOOST_RV_REF(ebo_functor_holder) x)
    {
       this->t_ = ::boost::move(x.t_);
       return *this;
    }
 
-   inline ebo_functor_holder& operator=(T * t)
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR ebo_functor_holder& operator=(T * t)
    {
       this->t_ = t;
       return *this;
    }
 
-   inline T&       get(){return *t_;}
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR T&       get(){return *t_;}
 
    private:
    T * t_;
@@ -40,7 +40,7 @@ struct link_dispatch
 {};
 
 template<class Hook>
-inline void destructor_impl(Hook &hook, detail::link_dispatch<safe_link>)
+inline BOOST_INTRUSIVE_CXX20_CONSTEXPR void destructor_impl(Hook &hook, detail::link_dispatch<safe_link>)
 {  //If this assertion raises, you might have destroyed an object
    //while it was still inserted in a container that is alive.
    //If so, remove the object from the container before destroying it.
@@ -48,11 +48,11 @@ inline void destructor_impl(Hook &hook, detail::link_dispatch<safe_link>)
 }
 
 template<class Hook>
-inline void destructor_impl(Hook &hook, detail::link_dispatch<auto_unlink>)
+inline BOOST_INTRUSIVE_CXX20_CONSTEXPR void destructor_impl(Hook &hook, detail::link_dispatch<auto_unlink>)
 {  hook.unlink();  }
 
 template<class Hook>
-inline void destructor_impl(Hook &, detail::link_dispatch<normal_link>)
+inline BOOST_INTRUSIVE_CXX20_CONSTEXPR void destructor_impl(Hook &, detail::link_dispatch<normal_link>)
 {}
 
 }  //namespace detail {
@@ -66,6 +66,9 @@ enum base_hook_type
 ,  AvlTreeBaseHookId
 ,  BsTreeBaseHookId
 ,  TreapTreeBaseHookId
+,  ThreadedRbTreeBaseHookId
+,  XorListBaseHookId
+,  GroupTreeBaseHookId
 ,  AnyBaseHookId
 };
 
@@ -97,6 +100,18 @@ template <class HookTags>
 struct hook_tags_definer<HookTags, BsTreeBaseHookId>
 {  typedef HookTags default_bstree_hook;  };
 
+template <class HookTags>
+struct hook_tags_definer<HookTags, ThreadedRbTreeBaseHookId>
+{  typedef HookTags default_threaded_rbtree_hook;  };
+
+template <class HookTags>
+struct hook_tags_definer<HookTags, XorListBaseHookId>
+{  typedef HookTags default_xor_list_hook;  };
+
+template <class HookTags>
+struct hook_tags_definer<HookTags, GroupTreeBaseHookId>
+{  typedef HookTags default_group_tree_hook;  };
+
 template <class HookTags>
 struct hook_tags_definer<HookTags, AnyBaseHookId>
 {  typedef HookTags default_any_hook;  };
@@ -153,6 +168,11 @@ class generic_hook
    typedef typename node_algorithms::node             node;
    typedef typename node_algorithms::node_ptr         node_ptr;
    typedef typename node_algorithms::const_node_ptr   const_node_ptr;
+   typedef typename detail::if_c
+      < detail::is_same<Tag, member_tag>::value
+      , typename NodeTraits::node
+      , node_holder<typename NodeTraits::node, Tag, BaseHookType>
+      >::type                                         node_base;
 
    public:
 
@@ -160,23 +180,32 @@ class generic_hook
       < NodeTraits
       , Tag, LinkMode, BaseHookType>                  hooktags;
 
-   inline node_ptr this_ptr() BOOST_NOEXCEPT
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR node_ptr this_ptr() BOOST_NOEXCEPT
    {  return pointer_traits<node_ptr>::pointer_to(static_cast<node&>(*this)); }
 
-   inline const_node_ptr this_ptr() const BOOST_NOEXCEPT
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR const_node_ptr this_ptr() const BOOST_NOEXCEPT
    {  return pointer_traits<const_node_ptr>::pointer_to(static_cast<const node&>(*this)); }
 
+   //Safe-mode and auto-unlink hooks value-initialize the node so that all its members
+   //(e.g. the color of a red-black tree node) are initialized in constant evaluation.
+   //The node of normal_link hooks is left uninitialized.
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR void priv_init() BOOST_NOEXCEPT
+   {
+      BOOST_IF_CONSTEXPR(hooktags::safemode_or_autounlink){
+         static_cast<node_base&>(*this) = node_base();
+         node_algorithms::init(this->this_ptr());
+      }
+   }
+
    public:
    /// @endcond
 
-   inline generic_hook() BOOST_NOEXCEPT
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR generic_hook() BOOST_NOEXCEPT
    #if defined(BOOST_INTRUSIVE_CONCEPTS_BASED_OVERLOADING)
       requires (LinkMode != normal_link)
    #endif
    {
-      BOOST_IF_CONSTEXPR(hooktags::safemode_or_autounlink){
-         node_algorithms::init(this->this_ptr());
-      }
+      this->priv_init();
    }
 
    #if !defined(BOOST_INTRUSIVE_DOXYGEN_INVOKED) && defined(BOOST_INTRUSIVE_CONCEPTS_BASED_OVERLOADING)
@@ -184,17 +213,15 @@ class generic_hook
    generic_hook() requires (LinkMode == normal_link) = default;
    #endif
 
-   inline generic_hook(const generic_hook& ) BOOST_NOEXCEPT
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR generic_hook(const generic_hook& ) BOOST_NOEXCEPT
    {
-      BOOST_IF_CONSTEXPR(hooktags::safemode_or_autounlink){
-         node_algorithms::init(this->this_ptr());
-      }
+      this->priv_init();
    }
 
-   inline generic_hook& operator=(const generic_hook& ) BOOST_NOEXCEPT
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR generic_hook& operator=(const generic_hook& ) BOOST_NOEXCEPT
    {  return *this;  }
 
-   inline ~generic_hook()
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR ~generic_hook()
    #if defined(BOOST_INTRUSIVE_CONCEPTS_BASED_OVERLOADING)
       requires (LinkMode != normal_link)
    #endif
@@ -208,20 +235,20 @@ class generic_hook
    ~generic_hook() requires (LinkMode == normal_link) = default;
    #endif
 
-   inline void swap_nodes(generic_hook &other) BOOST_NOEXCEPT
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR void swap_nodes(generic_hook &other) BOOST_NOEXCEPT
    {
       node_algorithms::swap_nodes
          (this->this_ptr(), other.this_ptr());
    }
 
-   inline bool is_linked() const BOOST_NOEXCEPT
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR bool is_linked() const BOOST_NOEXCEPT
    {
       //is_linked() can be only used in safe-mode or auto-unlink
       BOOST_INTRUSIVE_STATIC_ASSERT(( hooktags::safemode_or_autounlink ));
       return !node_algorithms::unique(this->this_ptr());
    }
 
-   inline void unlink() BOOST_NOEXCEPT
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR void unlink() BOOST_NOEXCEPT
    {
       BOOST_INTRUSIVE_STATIC_ASSERT(( (int)hooktags::link_mode == (int)auto_unlink ));
       node_ptr n(this->this_ptr());
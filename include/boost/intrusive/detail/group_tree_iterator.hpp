@@ -0,0 +1,164 @@
+/////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright agent 2026
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/intrusive for documentation.
+//
+/////////////////////////////////////////////////////////////////////////////
+
+#ifndef BOOST_INTRUSIVE_GROUP_TREE_ITERATOR_HPP
+#define BOOST_INTRUSIVE_GROUP_TREE_ITERATOR_HPP
+
+#ifndef BOOST_CONFIG_HPP
+#  include <boost/config.hpp>
+#endif
+
+#if defined(BOOST_HAS_PRAGMA_ONCE)
+#  pragma once
+#endif
+
+#include <boost/intrusive/detail/workaround.hpp>
+#include <boost/intrusive/detail/std_fwd.hpp>
+#include <boost/intrusive/detail/iiterator.hpp>
+#include <boost/intrusive/detail/mpl.hpp>
+#include <boost/intrusive/detail/bstree_algorithms_base.hpp>
+
+namespace boost {
+namespace intrusive {
+
+// group_tree_iterator provides some basic functions for a
+// node oriented bidirectional iterator over a tree whose nodes lead
+// a circular list of nodes with equivalent keys (see group_tree_node_traits).
+// Leaders (and the header) have a non-null parent link, the rest of
+// the group has a null parent link and a non-null group link:
+template<class ValueTraits, bool IsConst>
+class group_tree_iterator
+{
+   private:
+   typedef iiterator
+      <ValueTraits, IsConst, std::bidirectional_iterator_tag> types_t;
+
+   static const bool stateful_value_traits =                types_t::stateful_value_traits;
+
+   typedef ValueTraits                                      value_traits;
+   typedef typename types_t::node_traits                    node_traits;
+
+   typedef typename types_t::node                           node;
+   typedef typename types_t::node_ptr                       node_ptr;
+   typedef typename types_t::const_value_traits_ptr         const_value_traits_ptr;
+   typedef bstree_algorithms_base<node_traits>              node_algorithms;
+   class nat;
+   typedef typename
+      detail::if_c< IsConst
+                  , group_tree_iterator<value_traits, false>
+                  , nat>::type                              nonconst_iterator;
+
+   public:
+   typedef typename types_t::iterator_type::difference_type    difference_type;
+   typedef typename types_t::iterator_type::value_type         value_type;
+   typedef typename types_t::iterator_type::pointer            pointer;
+   typedef typename types_t::iterator_type::reference          reference;
+   typedef typename types_t::iterator_type::iterator_category  iterator_category;
+
+   inline group_tree_iterator()
+   {}
+
+   inline explicit group_tree_iterator(node_ptr nodeptr, const_value_traits_ptr traits_ptr)
+      : members_(nodeptr, traits_ptr)
+   {}
+
+   inline group_tree_iterator(const group_tree_iterator &other)
+      :  members_(other.pointed_node(), other.get_value_traits())
+   {}
+
+   inline group_tree_iterator(const nonconst_iterator &other)
+      :  members_(other.pointed_node(), other.get_value_traits())
+   {}
+
+   inline group_tree_iterator &operator=(const group_tree_iterator &other)
+   {  members_ = other.members_;  return *this;  }
+
+   inline node_ptr pointed_node() const
+   { return members_.nodeptr_; }
+
+   inline group_tree_iterator &operator=(node_ptr nodeptr)
+   {  members_.nodeptr_ = nodeptr;  return *this;  }
+
+   inline const_value_traits_ptr get_value_traits() const
+   {  return members_.get_ptr(); }
+
+   public:
+   inline group_tree_iterator& operator++()
+   {
+      members_.nodeptr_ = next_node(members_.nodeptr_);
+      return static_cast<group_tree_iterator&> (*this);
+   }
+
+   inline group_tree_iterator operator++(int)
+   {
+      group_tree_iterator result (*this);
+      members_.nodeptr_ = next_node(members_.nodeptr_);
+      return result;
+   }
+
+   inline group_tree_iterator& operator--()
+   {
+      members_.nodeptr_ = prev_node(members_.nodeptr_);
+      return static_cast<group_tree_iterator&> (*this);
+   }
+
+   inline group_tree_iterator operator--(int)
+   {
+      group_tree_iterator result (*this);
+      members_.nodeptr_ = prev_node(members_.nodeptr_);
+      return result;
+   }
+
+   //Elements of a group are visited from the leader following the group links,
+   //the last element of the group is followed by the next leader of the tree.
+   static node_ptr next_node(node_ptr n)
+   {
+      const node_ptr nxt(node_traits::get_next(n));
+      return node_traits::get_parent(nxt) ? node_algorithms::next_node(nxt) : nxt;
+   }
+
+   static node_ptr prev_node(node_ptr n)
+   {
+      return (node_traits::get_parent(n) || !node_traits::get_next(n))
+         ? node_traits::get_previous(node_algorithms::prev_node(n))
+         : node_traits::get_previous(n);
+   }
+
+   inline friend bool operator== (const group_tree_iterator& l, const group_tree_iterator& r)
+   {  return l.pointed_node() == r.pointed_node();   }
+
+   inline friend bool operator!= (const group_tree_iterator& l, const group_tree_iterator& r)
+   {  return !(l == r); }
+
+   inline reference operator*() const
+   {  return *operator->();   }
+
+   inline pointer operator->() const
+   { return this->operator_arrow(detail::bool_<stateful_value_traits>()); }
+
+   inline group_tree_iterator<ValueTraits, false> unconst() const
+   {  return group_tree_iterator<ValueTraits, false>(this->pointed_node(), this->get_value_traits());   }
+
+   private:
+   inline pointer operator_arrow(detail::false_) const
+   { return ValueTraits::to_value_ptr(members_.nodeptr_); }
+
+   inline pointer operator_arrow(detail::true_) const
+   { return this->get_value_traits()->to_value_ptr(members_.nodeptr_); }
+
+   iiterator_members<node_ptr, const_value_traits_ptr, stateful_value_traits> members_;
+};
+
+} //namespace intrusive
+} //namespace boost
+
+#endif //BOOST_INTRUSIVE_GROUP_TREE_ITERATOR_HPP
@@ -0,0 +1,181 @@
+/////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright agent 2026
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/intrusive for documentation.
+//
+/////////////////////////////////////////////////////////////////////////////
+
+#ifndef BOOST_INTRUSIVE_GROUP_TREE_NODE_HPP
+#define BOOST_INTRUSIVE_GROUP_TREE_NODE_HPP
+
+#ifndef BOOST_CONFIG_HPP
+#  include <boost/config.hpp>
+#endif
+
+#if defined(BOOST_HAS_PRAGMA_ONCE)
+#  pragma once
+#endif
+
+#include <boost/intrusive/intrusive_fwd.hpp>
+#include <boost/intrusive/detail/workaround.hpp>
+#include <boost/intrusive/detail/algo_type.hpp>
+#include <boost/intrusive/pointer_rebind.hpp>
+
+namespace boost {
+namespace intrusive {
+
+// group_tree_node_traits can be used with rbtree_algorithms and avltree_algorithms
+// and supplies a group_tree_node holding the three tree links, the color or balance
+// of the node and two more links that form a circular list with the
+// elements that have a key equivalent to the key of the node.
+//
+// Only the first element of each group (the leader) is linked in the tree.
+// The rest of elements of the group have a null parent link.
+
+template<class VoidPointer>
+struct group_tree_node
+{
+   typedef group_tree_node<VoidPointer>                              node;
+   typedef typename pointer_rebind<VoidPointer, node >::type         node_ptr;
+   typedef typename pointer_rebind<VoidPointer, const node >::type   const_node_ptr;
+
+   enum color { red_t, black_t };
+   enum balance { negative_t, zero_t, positive_t };
+
+   node_ptr parent_, left_, right_, next_, prev_;
+   unsigned char state_;
+};
+
+template<class VoidPointer>
+struct group_tree_node_traits
+{
+   typedef group_tree_node<VoidPointer>   node;
+   typedef typename node::node_ptr        node_ptr;
+   typedef typename node::const_node_ptr  const_node_ptr;
+   typedef typename node::color           color;
+   typedef typename node::balance         balance;
+
+   BOOST_INTRUSIVE_FORCEINLINE static node_ptr get_parent(const_node_ptr n)
+   {  return n->parent_;  }
+
+   BOOST_INTRUSIVE_FORCEINLINE static node_ptr get_parent(node_ptr n)
+   {  return n->parent_;  }
+
+   BOOST_INTRUSIVE_FORCEINLINE static void set_parent(node_ptr n, node_ptr p)
+   {  n->parent_ = p;  }
+
+   BOOST_INTRUSIVE_FORCEINLINE static node_ptr get_left(const_node_ptr n)
+   {  return n->left_;  }
+
+   BOOST_INTRUSIVE_FORCEINLINE static node_ptr get_left(node_ptr n)
+   {  return n->left_;  }
+
+   BOOST_INTRUSIVE_FORCEINLINE static void set_left(node_ptr n, node_ptr l)
+   {  n->left_ = l;  }
+
+   BOOST_INTRUSIVE_FORCEINLINE static node_ptr get_right(const_node_ptr n)
+   {  return n->right_;  }
+
+   BOOST_INTRUSIVE_FORCEINLINE static node_ptr get_right(node_ptr n)
+   {  return n->right_;  }
+
+   BOOST_INTRUSIVE_FORCEINLINE static void set_right(node_ptr n, node_ptr r)
+   {  n->right_ = r;  }
+
+   //Group links
+   BOOST_INTRUSIVE_FORCEINLINE static node_ptr get_next(const_node_ptr n)
+   {  return n->next_;  }
+
+   BOOST_INTRUSIVE_FORCEINLINE static node_ptr get_next(node_ptr n)
+   {  return n->next_;  }
+
+   BOOST_INTRUSIVE_FORCEINLINE static void set_next(node_ptr n, node_ptr next)
+   {  n->next_ = next;  }
+
+   BOOST_INTRUSIVE_FORCEINLINE static node_ptr get_previous(const_node_ptr n)
+   {  return n->prev_;  }
+
+   BOOST_INTRUSIVE_FORCEINLINE static node_ptr get_previous(node_ptr n)
+   {  return n->prev_;  }
+
+   BOOST_INTRUSIVE_FORCEINLINE static void set_previous(node_ptr n, node_ptr prev)
+   {  n->prev_ = prev;  }
+
+   //Red-black tree interface
+   BOOST_INTRUSIVE_FORCEINLINE static color get_color(const_node_ptr n)
+   {  return static_cast<color>(n->state_);  }
+
+   BOOST_INTRUSIVE_FORCEINLINE static void set_color(node_ptr n, color c)
+   {  n->state_ = static_cast<unsigned char>(c);  }
+
+   BOOST_INTRUSIVE_FORCEINLINE static color black()
+   {  return node::black_t;  }
+
+   BOOST_INTRUSIVE_FORCEINLINE static color red()
+   {  return node::red_t;  }
+
+   //AVL tree interface
+   BOOST_INTRUSIVE_FORCEINLINE static balance get_balance(const_node_ptr n)
+   {  return static_cast<balance>(n->state_);  }
+
+   BOOST_INTRUSIVE_FORCEINLINE static void set_balance(node_ptr n, balance b)
+   {  n->state_ = static_cast<unsigned char>(b);  }
+
+   BOOST_INTRUSIVE_FORCEINLINE static balance negative()
+   {  return node::negative_t;  }
+
+   BOOST_INTRUSIVE_FORCEINLINE static balance zero()
+   {  return node::zero_t;  }
+
+   BOOST_INTRUSIVE_FORCEINLINE static balance positive()
+   {  return node::positive_t;  }
+};
+
+namespace detail {
+
+// Algorithms used by group tree hooks to initialize and test nodes.
+// A node is unlinked when both its parent link and its group link are null.
+template<class NodeTraits>
+struct group_tree_hook_algorithms
+{
+   typedef typename NodeTraits::node            node;
+   typedef typename NodeTraits::node_ptr        node_ptr;
+   typedef typename NodeTraits::const_node_ptr  const_node_ptr;
+
+   BOOST_INTRUSIVE_FORCEINLINE static void init(node_ptr n) BOOST_NOEXCEPT
+   {
+      NodeTraits::set_parent(n, node_ptr());
+      NodeTraits::set_left(n, node_ptr());
+      NodeTraits::set_right(n, node_ptr());
+      NodeTraits::set_next(n, node_ptr());
+      NodeTraits::set_previous(n, node_ptr());
+   }
+
+   BOOST_INTRUSIVE_FORCEINLINE static bool inited(const_node_ptr n) BOOST_NOEXCEPT
+   {  return !NodeTraits::get_parent(n) && !NodeTraits::get_next(n);  }
+
+   BOOST_INTRUSIVE_FORCEINLINE static bool unique(const_node_ptr n) BOOST_NOEXCEPT
+   {  return inited(n);  }
+};
+
+}  //namespace detail {
+
+/// @cond
+
+template<class NodeTraits>
+struct get_algo<GroupTreeAlgorithms, NodeTraits>
+{
+   typedef detail::group_tree_hook_algorithms<NodeTraits> type;
+};
+
+/// @endcond
+
+} //namespace intrusive
+} //namespace boost
+
+#endif //BOOST_INTRUSIVE_GROUP_TREE_NODE_HPP
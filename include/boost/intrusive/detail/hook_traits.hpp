@@ -57,26 +57,26 @@ struct bhtraits_base
    typedef node&                                                     node_reference;
    typedef const node &                                              const_node_reference;
 
-   inline static pointer to_value_ptr(node_ptr n)
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR static pointer to_value_ptr(node_ptr n)
    {
       return pointer_traits<pointer>::
          static_cast_from(pointer_traits<node_holder_ptr>::static_cast_from(n));
    }
 
-   inline static const_pointer to_value_ptr(const_node_ptr n)
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR static const_pointer to_value_ptr(const_node_ptr n)
    {
       return pointer_traits<const_pointer>::
          static_cast_from(pointer_traits<const_node_holder_ptr>::static_cast_from(n));
    }
 
-   inline static node_ptr to_node_ptr(reference value)
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR static node_ptr to_node_ptr(reference value)
    {
       node_ptr p = pointer_traits<node_ptr>::pointer_to
          (static_cast<node_reference>(static_cast<node_holder_reference>(value)));
       return p;
    }
 
-   inline static const_node_ptr to_node_ptr(const_reference value)
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR static const_node_ptr to_node_ptr(const_reference value)
    {
       const_node_ptr p = pointer_traits<const_node_ptr>::pointer_to
          (static_cast<const_node_reference>(static_cast<const_node_holder_reference>(value)));
@@ -116,26 +116,26 @@ struct mhtraits
 
    static const link_mode_type link_mode = Hook::hooktags::link_mode;
 
-   inline static node_ptr to_node_ptr(reference value)
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR static node_ptr to_node_ptr(reference value)
    {
       return pointer_traits<node_ptr>::pointer_to
          (static_cast<node_reference>(static_cast<hook_reference>(value.*P)));
    }
 
-   inline static const_node_ptr to_node_ptr(const_reference value)
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR static const_node_ptr to_node_ptr(const_reference value)
    {
       return pointer_traits<const_node_ptr>::pointer_to
          (static_cast<const_node_reference>(static_cast<const_hook_reference>(value.*P)));
    }
 
-   inline static pointer to_value_ptr(node_ptr n)
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR static pointer to_value_ptr(node_ptr n)
    {
       return pointer_traits<pointer>::pointer_to
          (*detail::parent_from_member<T, Hook>
             (static_cast<Hook*>(boost::movelib::to_raw_pointer(n)), P));
    }
 
-   inline static const_pointer to_value_ptr(const_node_ptr n)
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR static const_pointer to_value_ptr(const_node_ptr n)
    {
       return pointer_traits<const_pointer>::pointer_to
          (*detail::parent_from_member<T, Hook>
@@ -164,23 +164,23 @@ struct fhtraits
    typedef const value_type &                                        const_reference;
    static const link_mode_type link_mode = hook_type::hooktags::link_mode;
 
-   inline static node_ptr to_node_ptr(reference value)
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR static node_ptr to_node_ptr(reference value)
    {  return static_cast<node*>(boost::movelib::to_raw_pointer(Functor::to_hook_ptr(value)));  }
 
-   inline static const_node_ptr to_node_ptr(const_reference value)
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR static const_node_ptr to_node_ptr(const_reference value)
    {  return static_cast<const node*>(boost::movelib::to_raw_pointer(Functor::to_hook_ptr(value)));  }
 
-   inline static pointer to_value_ptr(node_ptr n)
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR static pointer to_value_ptr(node_ptr n)
    {  return Functor::to_value_ptr(to_hook_ptr(n));  }
 
-   inline static const_pointer to_value_ptr(const_node_ptr n)
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR static const_pointer to_value_ptr(const_node_ptr n)
    {  return Functor::to_value_ptr(to_hook_ptr(n));  }
 
    private:
-   inline static hook_ptr to_hook_ptr(node_ptr n)
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR static hook_ptr to_hook_ptr(node_ptr n)
    {  return hook_ptr(&*static_cast<hook_type*>(&*n));  }
 
-   inline static const_hook_ptr to_hook_ptr(const_node_ptr n)
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR static const_hook_ptr to_hook_ptr(const_node_ptr n)
    {  return const_hook_ptr(&*static_cast<const hook_type*>(&*n));  }
 };
 
@@ -84,15 +84,15 @@ template<class NodePtr, class StoredPointer, bool StatefulValueTraits = true>
 struct iiterator_members
 {
 
-   inline iiterator_members()
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR iiterator_members()
       : nodeptr_()//Value initialization to achieve "null iterators" (N3644)
    {}
 
-   inline iiterator_members(const NodePtr &n_ptr, const StoredPointer &data)
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR iiterator_members(const NodePtr &n_ptr, const StoredPointer &data)
       :  nodeptr_(n_ptr), ptr_(data)
    {}
 
-   inline StoredPointer get_ptr() const
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR StoredPointer get_ptr() const
    {  return ptr_;  }
 
    NodePtr nodeptr_;
@@ -102,15 +102,15 @@ struct iiterator_members
 template<class NodePtr, class StoredPointer>
 struct iiterator_members<NodePtr, StoredPointer, false>
 {
-   inline iiterator_members()
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR iiterator_members()
       : nodeptr_()//Value initialization to achieve "null iterators" (N3644)
    {}
 
-   inline iiterator_members(const NodePtr &n_ptr, const StoredPointer &)
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR iiterator_members(const NodePtr &n_ptr, const StoredPointer &)
       : nodeptr_(n_ptr)
    {}
 
-   inline StoredPointer get_ptr() const
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR StoredPointer get_ptr() const
    {  return StoredPointer();  }
 
    NodePtr nodeptr_;
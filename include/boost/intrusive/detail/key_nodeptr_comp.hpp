@@ -22,6 +22,7 @@
 #endif
 
 #include <boost/intrusive/detail/mpl.hpp>
+#include <boost/intrusive/detail/std_fwd.hpp>
 #include <boost/intrusive/detail/tree_value_compare.hpp>
 
 
@@ -77,46 +78,61 @@ public:
       static const bool value = same_type || is_convertible<P1, const_node_ptr>::value;
    };
 
-   inline base_t base() const
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR base_t base() const
    {  return static_cast<const base_t&>(*this); }
 
-   inline key_nodeptr_comp(KeyTypeKeyCompare kcomp, const ValueTraits *traits)
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR key_nodeptr_comp(KeyTypeKeyCompare kcomp, const ValueTraits *traits)
       :  base_t(kcomp), traits_(traits)
    {}
 
    //pred(pnode)
    template<class T1>
-   inline bool operator()(const T1 &t1, typename enable_if_c< is_same_or_nodeptr_convertible<T1>::value, sfinae_type* >::type = 0) const
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR bool operator()(const T1 &t1, typename enable_if_c< is_same_or_nodeptr_convertible<T1>::value, sfinae_type* >::type = 0) const
    {  return base().get()(key_of_value()(*traits_->to_value_ptr(t1)));  }
 
    //operator() 2 arg
    //pred(pnode, pnode)
    template<class T1, class T2>
-   inline bool operator()
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR bool operator()
       (const T1 &t1, const T2 &t2, typename enable_if_c< is_same_or_nodeptr_convertible<T1>::value && is_same_or_nodeptr_convertible<T2>::value, sfinae_type* >::type = 0) const
    {  return base()(*traits_->to_value_ptr(t1), *traits_->to_value_ptr(t2));  }
 
    //pred(pnode, key)
    template<class T1, class T2>
-   inline bool operator()
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR bool operator()
       (const T1 &t1, const T2 &t2, typename enable_if_c< is_same_or_nodeptr_convertible<T1>::value && !is_same_or_nodeptr_convertible<T2>::value, sfinae_type* >::type = 0) const
    {  return base()(*traits_->to_value_ptr(t1), t2);  }
 
    //pred(key, pnode)
    template<class T1, class T2>
-   inline bool operator()
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR bool operator()
       (const T1 &t1, const T2 &t2, typename enable_if_c< !is_same_or_nodeptr_convertible<T1>::value && is_same_or_nodeptr_convertible<T2>::value, sfinae_type* >::type = 0) const
    {  return base()(t1, *traits_->to_value_ptr(t2));  }
 
    //pred(key, key)
    template<class T1, class T2>
-   inline bool operator()
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR bool operator()
       (const T1 &t1, const T2 &t2, typename enable_if_c< !is_same_or_nodeptr_convertible<T1>::value && !is_same_or_nodeptr_convertible<T2>::value, sfinae_type* >::type = 0) const
    {  return base()(t1, t2);  }
 
    const ValueTraits *const traits_;
 };
 
+//Tree descents can select the next child without branching when comparing
+//a node with a key is cheap and has no side effects: arithmetic keys
+//compared with std::less.
+template<class KeyNodePtrCompare>
+struct is_branchless_nodeptr_comp
+{
+   static const bool value = false;
+};
+
+template<class T, class ValueTraits, class KeyOfValue>
+struct is_branchless_nodeptr_comp< key_nodeptr_comp< ::std::less<T>, ValueTraits, KeyOfValue> >
+{
+   static const bool value = is_integral<T>::value || is_floating_point<T>::value;
+};
+
 }  //namespace detail{
 }  //namespace intrusive{
 }  //namespace boost{
@@ -0,0 +1,297 @@
+/////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright agent 2026
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/intrusive for documentation.
+//
+/////////////////////////////////////////////////////////////////////////////
+
+#ifndef BOOST_INTRUSIVE_DETAIL_KEY_SORT_ALGORITHMS_HPP
+#define BOOST_INTRUSIVE_DETAIL_KEY_SORT_ALGORITHMS_HPP
+
+#ifndef BOOST_CONFIG_HPP
+#  include <boost/config.hpp>
+#endif
+
+#if defined(BOOST_HAS_PRAGMA_ONCE)
+#  pragma once
+#endif
+
+#include <boost/intrusive/detail/workaround.hpp>
+#include <boost/intrusive/detail/mpl.hpp>
+#include <boost/intrusive/detail/math.hpp>
+#include <cstddef>
+#include <climits>
+
+namespace boost {
+namespace intrusive {
+namespace detail {
+
+//Maps integral keys to unsigned integers with the same order
+template<class Key>
+struct radix_key
+{
+   static const std::size_t bits = sizeof(Key)*CHAR_BIT;
+
+   inline static ::boost::ulong_long_type get(Key k)
+   {
+      ::boost::ulong_long_type u = (::boost::ulong_long_type)k;
+      BOOST_IF_CONSTEXPR(bits < sizeof(::boost::ulong_long_type)*CHAR_BIT)
+         u &= (::boost::ulong_long_type(1u) << (bits % (sizeof(::boost::ulong_long_type)*CHAR_BIT))) - 1u;
+      BOOST_IF_CONSTEXPR(!is_unsigned<Key>::value)
+         u ^= ::boost::ulong_long_type(1u) << (bits - 1u);
+      return u;
+   }
+};
+
+//Compares the keys of the values owning two nodes with operator< and
+//obtains the radix key of a node if keys are integral
+template<class KeyOfValue, class ValueTraits>
+struct key_nodeptr_less
+{
+   typedef typename ValueTraits::node_traits::const_node_ptr   const_node_ptr;
+   typedef typename KeyOfValue::type                           key_type;
+
+   inline key_nodeptr_less(KeyOfValue key_of_value, const ValueTraits &traits)
+      : key_of_value_(key_of_value), traits_(traits)
+   {}
+
+   inline bool operator()(const_node_ptr a, const_node_ptr b) const
+   {  return key_of_value_(*traits_.to_value_ptr(a)) < key_of_value_(*traits_.to_value_ptr(b));  }
+
+   inline ::boost::ulong_long_type radix(const_node_ptr n) const
+   {  return radix_key<key_type>::get(key_of_value_(*traits_.to_value_ptr(n)));  }
+
+   KeyOfValue key_of_value_;
+   const ValueTraits &traits_;
+};
+
+//Stable sorts of chains of nodes linked with NodeTraits::get_next using the keys of the
+//nodes: a radix sort that relinks nodes in 256 bucket chains per byte for integral keys
+//and a natural merge sort, that merges consecutive ordered runs, for nearly sorted chains
+//or other keys. No memory is allocated. If LinkPrevious is true, links to previous
+//nodes are also updated.
+template<class NodeTraits, bool LinkPrevious>
+struct key_sort_algorithms
+{
+   typedef typename NodeTraits::node_ptr        node_ptr;
+   typedef typename NodeTraits::const_node_ptr  const_node_ptr;
+
+   //Sorts the chain of at least two nodes that follows header and ends in e using the keys
+   //compared by less. Links header to the new first node and the new last node, stored
+   //in "last", to e. If less throws, all the nodes remain linked between header
+   //and e in an unspecified order and "last" is the last one.
+   template<class KeyNodePtrLess>
+   static void sort(node_ptr header, node_ptr e, KeyNodePtrLess less, node_ptr &last)
+   {
+      typedef typename KeyNodePtrLess::key_type key_type;
+      sort(header, e, less, last, detail::bool_<is_integral<key_type>::value>());
+   }
+
+   private:
+   inline static void link(node_ptr prev, node_ptr n)
+   {
+      NodeTraits::set_next(prev, n);
+      set_previous(n, prev, detail::bool_<LinkPrevious>());
+   }
+
+   inline static void set_previous(node_ptr, node_ptr, detail::false_)
+   {}
+
+   inline static void set_previous(node_ptr n, node_ptr prev, detail::true_)
+   {  NodeTraits::set_previous(n, prev);  }
+
+   //Called after relinking all the nodes between header and e when less throws
+   static void link_last(node_ptr header, node_ptr e, node_ptr &last)
+   {
+      last = header;
+      for(node_ptr n = NodeTraits::get_next(header); n != e; n = NodeTraits::get_next(n))
+         last = n;
+      link(last, e);
+   }
+
+   template<class KeyNodePtrLess>
+   static void sort(node_ptr header, node_ptr e, KeyNodePtrLess &less, node_ptr &last, detail::false_)
+   {  natural_merge_sort(header, e, less, last);  }
+
+   template<class KeyNodePtrLess>
+   static void sort(node_ptr header, node_ptr e, KeyNodePtrLess &less, node_ptr &last, detail::true_)
+   {
+      //Count the ordered runs and the bytes in which keys differ
+      const node_ptr first = NodeTraits::get_next(header);
+      ::boost::ulong_long_type diff = 0;
+      std::size_t runs = 1;
+      BOOST_INTRUSIVE_TRY{
+         const ::boost::ulong_long_type k0 = less.radix(first);
+         last = first;
+         for(node_ptr p = NodeTraits::get_next(first); p != e; p = NodeTraits::get_next(p)){
+            diff |= less.radix(p) ^ k0;
+            runs += std::size_t(less(p, last));
+            last = p;
+         }
+      }
+      BOOST_INTRUSIVE_CATCH(...){
+         link_last(header, e, last);
+         BOOST_INTRUSIVE_RETHROW;
+      }
+      BOOST_INTRUSIVE_CATCH_END
+      std::size_t passes = 0;
+      for(::boost::ulong_long_type d = diff; d; d >>= CHAR_BIT)
+         passes += std::size_t((d & 0xFFu) != 0);
+      //Merging the runs needs ceil(log2(runs)) passes
+      if(runs == 1u)
+         return;
+      else if(detail::floor_log2(runs - 1u) < passes)
+         return natural_merge_sort(header, e, less, last);
+
+      node_ptr heads[256];
+      node_ptr tails[256];
+      for(std::size_t shift = 0; diff; diff >>= CHAR_BIT, shift += CHAR_BIT){
+         if(!(diff & 0xFFu))
+            continue;
+         for(std::size_t i = 0; i != 256u; ++i)
+            heads[i] = node_ptr();
+         node_ptr p = NodeTraits::get_next(header);
+         BOOST_INTRUSIVE_TRY{
+            while(p != e){
+               const node_ptr next = NodeTraits::get_next(p);
+               const std::size_t d = std::size_t((less.radix(p) >> shift) & 0xFFu);
+               if(heads[d] != node_ptr())
+                  link(tails[d], p);
+               else
+                  heads[d] = p;
+               tails[d] = p;
+               p = next;
+            }
+         }
+         BOOST_INTRUSIVE_CATCH(...){
+            //Nodes not distributed yet follow the buckets
+            link(link_buckets(header, heads, tails), p);
+            link_last(header, e, last);
+            BOOST_INTRUSIVE_RETHROW;
+         }
+         BOOST_INTRUSIVE_CATCH_END
+         last = link_buckets(header, heads, tails);
+         link(last, e);
+      }
+   }
+
+   //Links the non-empty buckets after header, returning the last node
+   static node_ptr link_buckets(node_ptr header, const node_ptr *heads, const node_ptr *tails)
+   {
+      node_ptr last = header;
+      for(std::size_t i = 0; i != 256u; ++i){
+         if(heads[i] != node_ptr()){
+            link(last, heads[i]);
+            last = tails[i];
+         }
+      }
+      return last;
+   }
+
+   //Returns the last node of the ordered run that starts at first
+   template<class KeyNodePtrLess>
+   static node_ptr run_last(node_ptr first, node_ptr e, KeyNodePtrLess &less)
+   {
+      for(node_ptr next = NodeTraits::get_next(first); next != e && !less(next, first); next = NodeTraits::get_next(first))
+         first = next;
+      return first;
+   }
+
+   //Merges the chains [a, a_last] and [b, b_last], both ended by e, in the chain [m_first, m_last],
+   //initially empty. Nodes are moved one by one, so that if less throws, the merged
+   //chain and the rest of both chains can be relinked.
+   template<class KeyNodePtrLess>
+   static void merge( node_ptr &a, node_ptr a_last, node_ptr &b, node_ptr b_last, node_ptr e
+                    , KeyNodePtrLess &less, node_ptr &m_first, node_ptr &m_last)
+   {
+      while(a != e && b != e){
+         node_ptr &n = less(b, a) ? b : a;
+         if(m_first != node_ptr())
+            link(m_last, n);
+         else
+            m_first = n;
+         m_last = n;
+         n = NodeTraits::get_next(n);
+      }
+      if(a != e){
+         link(m_last, a);
+         m_last = a_last;
+         a = e;
+      }
+      else{
+         link(m_last, b);
+         m_last = b_last;
+         b = e;
+      }
+   }
+
+   template<class KeyNodePtrLess>
+   static void natural_merge_sort(node_ptr header, node_ptr e, KeyNodePtrLess &less, node_ptr &last)
+   {
+      //Each pass merges pairs of consecutive runs until a single run remains
+      std::size_t runs;
+      do{
+         runs = 0;
+         node_ptr p = NodeTraits::get_next(header);
+         node_ptr out_last = header;
+         node_ptr a = e, a_last = e, b = e, b_last = e, m_first = node_ptr(), m_last = node_ptr();
+         BOOST_INTRUSIVE_TRY{
+            while(p != e){
+               a_last = run_last(p, e, less);
+               a = p;
+               p = NodeTraits::get_next(a_last);
+               if(p != e){
+                  b_last = run_last(p, e, less);
+                  b = p;
+                  p = NodeTraits::get_next(b_last);
+                  link(a_last, e);
+                  link(b_last, e);
+                  merge(a, a_last, b, b_last, e, less, m_first, m_last);
+                  link(out_last, m_first);
+                  out_last = m_last;
+                  m_first = node_ptr();
+               }
+               else{
+                  link(out_last, a);
+                  out_last = a_last;
+                  a = e;
+               }
+               ++runs;
+            }
+         }
+         BOOST_INTRUSIVE_CATCH(...){
+            //Links the merged runs, the merged part and the rest of the runs
+            //being merged and the nodes not visited yet
+            if(m_first != node_ptr()){
+               link(out_last, m_first);
+               out_last = m_last;
+            }
+            if(a != e){
+               link(out_last, a);
+               out_last = a_last;
+            }
+            if(b != e){
+               link(out_last, b);
+               out_last = b_last;
+            }
+            link(out_last, p);
+            link_last(header, e, last);
+            BOOST_INTRUSIVE_RETHROW;
+         }
+         BOOST_INTRUSIVE_CATCH_END
+         link(out_last, e);
+         last = out_last;
+      } while(runs > 1u);
+   }
+};
+
+}  //namespace detail {
+}  //namespace intrusive {
+}  //namespace boost {
+
+#endif //BOOST_INTRUSIVE_DETAIL_KEY_SORT_ALGORITHMS_HPP
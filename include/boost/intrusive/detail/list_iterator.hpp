@@ -60,81 +60,81 @@ class list_iterator
    typedef typename types_t::iterator_type::reference          reference;
    typedef typename types_t::iterator_type::iterator_category  iterator_category;
 
-   inline list_iterator()
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR list_iterator()
    {}
 
-   inline explicit list_iterator(node_ptr nodeptr, const_value_traits_ptr traits_ptr)
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR explicit list_iterator(node_ptr nodeptr, const_value_traits_ptr traits_ptr)
       : members_(nodeptr, traits_ptr)
    {}
 
-   inline list_iterator(const list_iterator &other)
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR list_iterator(const list_iterator &other)
       :  members_(other.pointed_node(), other.get_value_traits())
    {}
 
-   inline list_iterator(const nonconst_iterator &other)
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR list_iterator(const nonconst_iterator &other)
       :  members_(other.pointed_node(), other.get_value_traits())
    {}
 
-   inline list_iterator &operator=(const list_iterator &other)
-   {  members_.nodeptr_ = other.members_.nodeptr_;  return *this;  }
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR list_iterator &operator=(const list_iterator &other)
+   {  members_ = other.members_;  return *this;  }
 
-   inline node_ptr pointed_node() const
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR node_ptr pointed_node() const
    { return members_.nodeptr_; }
 
-   inline list_iterator &operator=(node_ptr nodeptr)
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR list_iterator &operator=(node_ptr nodeptr)
    {  members_.nodeptr_ = nodeptr;  return *this;  }
 
-   inline const_value_traits_ptr get_value_traits() const
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR const_value_traits_ptr get_value_traits() const
    {  return members_.get_ptr(); }
 
    public:
-   inline list_iterator& operator++()
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR list_iterator& operator++()
    {
       node_ptr p = node_traits::get_next(members_.nodeptr_);
       members_.nodeptr_ = p;
       return static_cast<list_iterator&> (*this);
    }
 
-   inline list_iterator operator++(int)
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR list_iterator operator++(int)
    {
       list_iterator result (*this);
       members_.nodeptr_ = node_traits::get_next(members_.nodeptr_);
       return result;
    }
 
-   inline list_iterator& operator--()
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR list_iterator& operator--()
    {
       members_.nodeptr_ = node_traits::get_previous(members_.nodeptr_);
       return static_cast<list_iterator&> (*this);
    }
 
-   inline list_iterator operator--(int)
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR list_iterator operator--(int)
    {
       list_iterator result (*this);
       members_.nodeptr_ = node_traits::get_previous(members_.nodeptr_);
       return result;
    }
 
-   inline friend bool operator== (const list_iterator& l, const list_iterator& r)
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR friend bool operator== (const list_iterator& l, const list_iterator& r)
    {  return l.pointed_node() == r.pointed_node();   }
 
-   inline friend bool operator!= (const list_iterator& l, const list_iterator& r)
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR friend bool operator!= (const list_iterator& l, const list_iterator& r)
    {  return !(l == r); }
 
-   inline reference operator*() const
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR reference operator*() const
    {  return *operator->();   }
 
-   inline pointer operator->() const
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR pointer operator->() const
    { return this->operator_arrow(detail::bool_<stateful_value_traits>()); }
 
-   inline list_iterator<ValueTraits, false> unconst() const
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR list_iterator<ValueTraits, false> unconst() const
    {  return list_iterator<ValueTraits, false>(this->pointed_node(), this->get_value_traits());   }
 
    private:
-   inline pointer operator_arrow(detail::false_) const
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR pointer operator_arrow(detail::false_) const
    { return ValueTraits::to_value_ptr(members_.nodeptr_); }
 
-   inline pointer operator_arrow(detail::true_) const
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR pointer operator_arrow(detail::true_) const
    { return this->get_value_traits()->to_value_ptr(members_.nodeptr_); }
 
    iiterator_members<node_ptr, const_value_traits_ptr, stateful_value_traits> members_;
@@ -24,6 +24,8 @@
 
 #include <boost/intrusive/detail/workaround.hpp>
 #include <boost/intrusive/pointer_rebind.hpp>
+#include <boost/intrusive/detail/mpl.hpp>
+#include <cstddef>
 
 namespace boost {
 namespace intrusive {
@@ -47,25 +49,81 @@ struct list_node_traits
    typedef typename node::node_ptr     node_ptr;
    typedef typename pointer_rebind<VoidPointer, const node>::type   const_node_ptr;
 
-   BOOST_INTRUSIVE_FORCEINLINE static node_ptr get_previous(const_node_ptr n)
+   BOOST_INTRUSIVE_FORCEINLINE BOOST_INTRUSIVE_CXX20_CONSTEXPR static node_ptr get_previous(const_node_ptr n)
    {  return n->prev_;  }
 
-   BOOST_INTRUSIVE_FORCEINLINE static node_ptr get_previous(node_ptr n)
+   BOOST_INTRUSIVE_FORCEINLINE BOOST_INTRUSIVE_CXX20_CONSTEXPR static node_ptr get_previous(node_ptr n)
    {  return n->prev_;  }
 
-   BOOST_INTRUSIVE_FORCEINLINE static void set_previous(node_ptr n, node_ptr prev)
+   BOOST_INTRUSIVE_FORCEINLINE BOOST_INTRUSIVE_CXX20_CONSTEXPR static void set_previous(node_ptr n, node_ptr prev)
    {  n->prev_ = prev;  }
 
-   BOOST_INTRUSIVE_FORCEINLINE static node_ptr get_next(const_node_ptr n)
+   BOOST_INTRUSIVE_FORCEINLINE BOOST_INTRUSIVE_CXX20_CONSTEXPR static node_ptr get_next(const_node_ptr n)
    {  return n->next_;  }
 
-   BOOST_INTRUSIVE_FORCEINLINE static node_ptr get_next(node_ptr n)
+   BOOST_INTRUSIVE_FORCEINLINE BOOST_INTRUSIVE_CXX20_CONSTEXPR static node_ptr get_next(node_ptr n)
    {  return n->next_;  }
 
-   BOOST_INTRUSIVE_FORCEINLINE static void set_next(node_ptr n, node_ptr next)
+   BOOST_INTRUSIVE_FORCEINLINE BOOST_INTRUSIVE_CXX20_CONSTEXPR static void set_next(node_ptr n, node_ptr next)
    {  n->next_ = next;  }
 };
 
+// order_list_node_traits can be used with order_list_algorithms and supplies
+// a list node that also stores the order label of the element
+
+template<class VoidPointer>
+struct order_list_node
+{
+   typedef typename pointer_rebind<VoidPointer, order_list_node>::type  node_ptr;
+   node_ptr next_;
+   node_ptr prev_;
+   std::size_t label_;
+};
+
+template<class VoidPointer>
+struct order_list_node_traits
+{
+   typedef order_list_node<VoidPointer>   node;
+   typedef typename node::node_ptr        node_ptr;
+   typedef typename pointer_rebind<VoidPointer, const node>::type   const_node_ptr;
+
+   static const bool order_labels = true;
+
+   BOOST_INTRUSIVE_FORCEINLINE BOOST_INTRUSIVE_CXX20_CONSTEXPR static node_ptr get_previous(const_node_ptr n)
+   {  return n->prev_;  }
+
+   BOOST_INTRUSIVE_FORCEINLINE BOOST_INTRUSIVE_CXX20_CONSTEXPR static node_ptr get_previous(node_ptr n)
+   {  return n->prev_;  }
+
+   BOOST_INTRUSIVE_FORCEINLINE BOOST_INTRUSIVE_CXX20_CONSTEXPR static void set_previous(node_ptr n, node_ptr prev)
+   {  n->prev_ = prev;  }
+
+   BOOST_INTRUSIVE_FORCEINLINE BOOST_INTRUSIVE_CXX20_CONSTEXPR static node_ptr get_next(const_node_ptr n)
+   {  return n->next_;  }
+
+   BOOST_INTRUSIVE_FORCEINLINE BOOST_INTRUSIVE_CXX20_CONSTEXPR static node_ptr get_next(node_ptr n)
+   {  return n->next_;  }
+
+   BOOST_INTRUSIVE_FORCEINLINE BOOST_INTRUSIVE_CXX20_CONSTEXPR static void set_next(node_ptr n, node_ptr next)
+   {  n->next_ = next;  }
+
+   BOOST_INTRUSIVE_FORCEINLINE BOOST_INTRUSIVE_CXX20_CONSTEXPR static std::size_t get_label(const_node_ptr n)
+   {  return n->label_;  }
+
+   BOOST_INTRUSIVE_FORCEINLINE BOOST_INTRUSIVE_CXX20_CONSTEXPR static void set_label(node_ptr n, std::size_t label)
+   {  n->label_ = label;  }
+};
+
+template<class VoidPointer, bool OrderLabels>
+struct get_list_node_traits
+{
+   typedef typename detail::if_c
+      < OrderLabels
+      , order_list_node_traits<VoidPointer>
+      , list_node_traits<VoidPointer>
+      >::type type;
+};
+
 } //namespace intrusive
 } //namespace boost
 
@@ -23,8 +23,12 @@
 #endif
 
 #include <boost/intrusive/detail/config_begin.hpp>
+#include <boost/intrusive/detail/workaround.hpp>
 #include <boost/move/detail/type_traits.hpp>
 #include <cstddef>
+#if defined(BOOST_INTRUSIVE_HAS_CXX20_CONSTEXPR)
+#  include <memory>
+#endif
 
 namespace boost {
 namespace intrusive {
@@ -49,10 +53,24 @@ using boost::move_detail::is_convertible;
 using boost::move_detail::if_c;
 using boost::move_detail::if_;
 using boost::move_detail::is_const;
-using boost::move_detail::identity;
 using boost::move_detail::alignment_of;
 using boost::move_detail::is_empty;
+#if defined(BOOST_INTRUSIVE_HAS_CXX20_CONSTEXPR)
+//std::addressof can be used in constant expressions
+using ::std::addressof;
+#else
 using boost::move_detail::addressof;
+#endif
+
+//Like boost::move_detail::identity, but usable in constant expressions
+template <class T>
+struct identity
+{
+   typedef T type;
+   typedef typename boost::move_detail::add_const_lvalue_reference<T>::type reference;
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR reference operator()(reference t) const
+   {  return t;   }
+};
 using boost::move_detail::integral_constant;
 using boost::move_detail::enable_if_convertible;
 using boost::move_detail::disable_if_convertible;
@@ -59,7 +59,7 @@ struct node_cloner
    {}
 
    // tree-based containers use this method, which is proxy-reference friendly
-   inline node_ptr operator()(node_ptr p)
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR node_ptr operator()(node_ptr p)
    {
       reference_type v = *traits_->to_value_ptr(p);
       node_ptr n = traits_->to_node_ptr(*base_t::get()(v));
@@ -85,11 +85,11 @@ struct node_disposer
    static const bool safemode_or_autounlink =
       is_safe_autounlink<value_traits::link_mode>::value;
 
-   inline node_disposer(F f, const ValueTraits *cont)
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR node_disposer(F f, const ValueTraits *cont)
       :  base_t(f), traits_(cont)
    {}
 
-   inline void operator()(node_ptr p)
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR void operator()(node_ptr p)
    {
       BOOST_IF_CONSTEXPR(safemode_or_autounlink)
          node_algorithms::init(p);
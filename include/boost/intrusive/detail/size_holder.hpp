@@ -33,25 +33,25 @@ struct size_holder
    static const bool constant_time_size = ConstantSize;
    typedef SizeType  size_type;
 
-   inline SizeType get_size() const
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR SizeType get_size() const
    {  return size_;  }
 
-   inline void set_size(SizeType size)
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR void set_size(SizeType size)
    {  size_ = size; }
 
-   inline void decrement()
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR void decrement()
    {  --size_; }
 
-   inline void increment()
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR void increment()
    {  ++size_; }
 
-   inline void increase(SizeType n)
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR void increase(SizeType n)
    {  size_ += n; }
 
-   inline void decrease(SizeType n)
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR void decrease(SizeType n)
    {  size_ -= n; }
 
-   inline void swap(size_holder &other)
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR void swap(size_holder &other)
    {  SizeType tmp(size_); size_ = other.size_; other.size_ = tmp; }
 
    SizeType size_;
@@ -63,25 +63,25 @@ struct size_holder<false, SizeType, Tag>
    static const bool constant_time_size = false;
    typedef SizeType  size_type;
 
-   inline size_type get_size() const
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR size_type get_size() const
    {  return 0;  }
 
-   inline void set_size(size_type)
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR void set_size(size_type)
    {}
 
-   inline void decrement()
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR void decrement()
    {}
 
-   inline void increment()
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR void increment()
    {}
 
-   inline void increase(SizeType)
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR void increase(SizeType)
    {}
 
-   inline void decrease(SizeType)
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR void decrease(SizeType)
    {}
 
-   inline void swap(size_holder){}
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR void swap(size_holder){}
 };
 
 }  //namespace detail{
@@ -62,75 +62,75 @@ class slist_iterator
    typedef typename types_t::iterator_type::reference          reference;
    typedef typename types_t::iterator_type::iterator_category  iterator_category;
 
-   inline slist_iterator()
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR slist_iterator()
    {}
 
-   inline slist_iterator(node_ptr nodeptr, const_value_traits_ptr traits_ptr)
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR slist_iterator(node_ptr nodeptr, const_value_traits_ptr traits_ptr)
       : members_(nodeptr, traits_ptr)
    {}
 
-   inline explicit slist_iterator(node_ptr nodeptr)
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR explicit slist_iterator(node_ptr nodeptr)
       : members_(nodeptr, const_value_traits_ptr())
    {  BOOST_INTRUSIVE_STATIC_ASSERT((stateful_value_traits == false));  }
 
-   inline slist_iterator(const slist_iterator &other)
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR slist_iterator(const slist_iterator &other)
       :  members_(other.pointed_node(), other.get_value_traits())
    {}
 
-   inline slist_iterator(const nonconst_iterator &other)
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR slist_iterator(const nonconst_iterator &other)
       :  members_(other.pointed_node(), other.get_value_traits())
    {}
 
-   inline slist_iterator &operator=(const slist_iterator &other)
-   {  members_.nodeptr_ = other.members_.nodeptr_;  return *this;  }
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR slist_iterator &operator=(const slist_iterator &other)
+   {  members_ = other.members_;  return *this;  }
 
-   inline node_ptr pointed_node() const
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR node_ptr pointed_node() const
    { return members_.nodeptr_; }
 
-   inline slist_iterator &operator=(node_ptr n)
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR slist_iterator &operator=(node_ptr n)
    {  members_.nodeptr_ = n;  return static_cast<slist_iterator&>(*this);  }
 
-   inline const_value_traits_ptr get_value_traits() const
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR const_value_traits_ptr get_value_traits() const
    {  return members_.get_ptr(); }
 
-   inline bool operator!() const
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR bool operator!() const
    {  return !members_.nodeptr_; }
 
    public:
-   inline slist_iterator& operator++()
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR slist_iterator& operator++()
    {
       members_.nodeptr_ = node_traits::get_next(members_.nodeptr_);
       return static_cast<slist_iterator&> (*this);
    }
 
-   inline slist_iterator operator++(int)
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR slist_iterator operator++(int)
    {
       slist_iterator result (*this);
       members_.nodeptr_ = node_traits::get_next(members_.nodeptr_);
       return result;
    }
 
-   inline friend bool operator== (const slist_iterator& l, const slist_iterator& r)
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR friend bool operator== (const slist_iterator& l, const slist_iterator& r)
    {  return l.pointed_node() == r.pointed_node();   }
 
-   inline friend bool operator!= (const slist_iterator& l, const slist_iterator& r)
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR friend bool operator!= (const slist_iterator& l, const slist_iterator& r)
    {  return l.pointed_node() != r.pointed_node();   }
 
-   inline reference operator*() const
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR reference operator*() const
    {  return *operator->();   }
 
-   inline pointer operator->() const
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR pointer operator->() const
    { return this->operator_arrow(detail::bool_<stateful_value_traits>()); }
 
-   inline slist_iterator<ValueTraits, false> unconst() const
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR slist_iterator<ValueTraits, false> unconst() const
    {  return slist_iterator<ValueTraits, false>(this->pointed_node(), this->get_value_traits());   }
 
    private:
 
-   inline pointer operator_arrow(detail::false_) const
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR pointer operator_arrow(detail::false_) const
    { return ValueTraits::to_value_ptr(members_.nodeptr_); }
 
-   inline pointer operator_arrow(detail::true_) const
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR pointer operator_arrow(detail::true_) const
    { return this->get_value_traits()->to_value_ptr(members_.nodeptr_); }
 
    iiterator_members<node_ptr, const_value_traits_ptr, stateful_value_traits> members_;
@@ -46,13 +46,13 @@ struct slist_node_traits
    typedef typename node::node_ptr  node_ptr;
    typedef typename pointer_rebind<VoidPointer, const node>::type    const_node_ptr;
 
-   BOOST_INTRUSIVE_FORCEINLINE static node_ptr get_next(const_node_ptr n)
+   BOOST_INTRUSIVE_FORCEINLINE BOOST_INTRUSIVE_CXX20_CONSTEXPR static node_ptr get_next(const_node_ptr n)
    {  return n->next_;  }
 
-   BOOST_INTRUSIVE_FORCEINLINE static node_ptr get_next(node_ptr n)
+   BOOST_INTRUSIVE_FORCEINLINE BOOST_INTRUSIVE_CXX20_CONSTEXPR static node_ptr get_next(node_ptr n)
    {  return n->next_;  }
 
-   BOOST_INTRUSIVE_FORCEINLINE static void set_next(node_ptr n, node_ptr next)
+   BOOST_INTRUSIVE_FORCEINLINE BOOST_INTRUSIVE_CXX20_CONSTEXPR static void set_next(node_ptr n, node_ptr next)
    {  n->next_ = next;  }
 };
 
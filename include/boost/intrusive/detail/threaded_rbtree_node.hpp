@@ -0,0 +1,206 @@
+/////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright agent 2026.
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/intrusive for documentation.
+//
+/////////////////////////////////////////////////////////////////////////////
+
+#ifndef BOOST_INTRUSIVE_THREADED_RBTREE_NODE_HPP
+#define BOOST_INTRUSIVE_THREADED_RBTREE_NODE_HPP
+
+#ifndef BOOST_CONFIG_HPP
+#  include <boost/config.hpp>
+#endif
+
+#if defined(BOOST_HAS_PRAGMA_ONCE)
+#  pragma once
+#endif
+
+#include <boost/intrusive/detail/config_begin.hpp>
+#include <boost/intrusive/detail/workaround.hpp>
+#include <boost/intrusive/pointer_rebind.hpp>
+#include <boost/intrusive/pointer_plus_bits.hpp>
+#include <boost/intrusive/detail/mpl.hpp>
+
+namespace boost {
+namespace intrusive {
+
+/////////////////////////////////////////////////////////////////////////////
+//                                                                         //
+//        Generic node_traits for threaded (parent-free) rbtree nodes      //
+//                                                                         //
+/////////////////////////////////////////////////////////////////////////////
+
+//This is the compact representation: 2 pointers. The "thread" flags
+//and the color are embedded in the low bits of the links:
+//left_: bit 0 -> left link is a thread, bit 1 -> color
+//right_: bit 0 -> right link is a thread
+template<class VoidPointer>
+struct compact_threaded_rbtree_node
+{
+   typedef compact_threaded_rbtree_node<VoidPointer> node;
+   typedef typename pointer_rebind<VoidPointer, node >::type         node_ptr;
+   typedef typename pointer_rebind<VoidPointer, const node >::type   const_node_ptr;
+   enum color { red_t, black_t };
+   node_ptr left_, right_;
+};
+
+//This is the normal representation: 2 pointers + thread flags + enum
+template<class VoidPointer>
+struct threaded_rbtree_node
+{
+   typedef threaded_rbtree_node<VoidPointer> node;
+   typedef typename pointer_rebind<VoidPointer, node >::type         node_ptr;
+   typedef typename pointer_rebind<VoidPointer, const node >::type   const_node_ptr;
+   enum color { red_t, black_t };
+   node_ptr left_, right_;
+   bool left_thread_, right_thread_;
+   color color_;
+};
+
+//This is the default node traits implementation
+//using a node with 2 generic pointers plus flags
+template<class VoidPointer>
+struct default_threaded_rbtree_node_traits_impl
+{
+   typedef threaded_rbtree_node<VoidPointer> node;
+   typedef typename node::node_ptr        node_ptr;
+   typedef typename node::const_node_ptr  const_node_ptr;
+
+   typedef typename node::color color;
+
+   BOOST_INTRUSIVE_FORCEINLINE static node_ptr get_left(const_node_ptr n)
+   {  return n->left_;  }
+
+   BOOST_INTRUSIVE_FORCEINLINE static node_ptr get_left(node_ptr n)
+   {  return n->left_;  }
+
+   BOOST_INTRUSIVE_FORCEINLINE static void set_left(node_ptr n, node_ptr l)
+   {  n->left_ = l;  }
+
+   BOOST_INTRUSIVE_FORCEINLINE static node_ptr get_right(const_node_ptr n)
+   {  return n->right_;  }
+
+   BOOST_INTRUSIVE_FORCEINLINE static node_ptr get_right(node_ptr n)
+   {  return n->right_;  }
+
+   BOOST_INTRUSIVE_FORCEINLINE static void set_right(node_ptr n, node_ptr r)
+   {  n->right_ = r;  }
+
+   BOOST_INTRUSIVE_FORCEINLINE static bool get_left_thread(const_node_ptr n)
+   {  return n->left_thread_;  }
+
+   BOOST_INTRUSIVE_FORCEINLINE static void set_left_thread(node_ptr n, bool t)
+   {  n->left_thread_ = t;  }
+
+   BOOST_INTRUSIVE_FORCEINLINE static bool get_right_thread(const_node_ptr n)
+   {  return n->right_thread_;  }
+
+   BOOST_INTRUSIVE_FORCEINLINE static void set_right_thread(node_ptr n, bool t)
+   {  n->right_thread_ = t;  }
+
+   BOOST_INTRUSIVE_FORCEINLINE static color get_color(const_node_ptr n)
+   {  return n->color_;  }
+
+   BOOST_INTRUSIVE_FORCEINLINE static void set_color(node_ptr n, color c)
+   {  n->color_ = c;  }
+
+   BOOST_INTRUSIVE_FORCEINLINE static color black()
+   {  return node::black_t;  }
+
+   BOOST_INTRUSIVE_FORCEINLINE static color red()
+   {  return node::red_t;  }
+};
+
+//This is the compact node traits implementation
+//using a node with 2 generic pointers
+template<class VoidPointer>
+struct compact_threaded_rbtree_node_traits_impl
+{
+   typedef compact_threaded_rbtree_node<VoidPointer> node;
+   typedef typename node::node_ptr        node_ptr;
+   typedef typename node::const_node_ptr  const_node_ptr;
+
+   typedef pointer_plus_bits<node_ptr, 2> left_ptr_bits;
+   typedef pointer_plus_bits<node_ptr, 1> right_ptr_bits;
+
+   typedef typename node::color color;
+
+   BOOST_INTRUSIVE_FORCEINLINE static node_ptr get_left(const_node_ptr n)
+   {  return left_ptr_bits::get_pointer(n->left_);  }
+
+   BOOST_INTRUSIVE_FORCEINLINE static node_ptr get_left(node_ptr n)
+   {  return left_ptr_bits::get_pointer(n->left_);  }
+
+   BOOST_INTRUSIVE_FORCEINLINE static void set_left(node_ptr n, node_ptr l)
+   {  left_ptr_bits::set_pointer(n->left_, l);  }
+
+   BOOST_INTRUSIVE_FORCEINLINE static node_ptr get_right(const_node_ptr n)
+   {  return right_ptr_bits::get_pointer(n->right_);  }
+
+   BOOST_INTRUSIVE_FORCEINLINE static node_ptr get_right(node_ptr n)
+   {  return right_ptr_bits::get_pointer(n->right_);  }
+
+   BOOST_INTRUSIVE_FORCEINLINE static void set_right(node_ptr n, node_ptr r)
+   {  right_ptr_bits::set_pointer(n->right_, r);  }
+
+   BOOST_INTRUSIVE_FORCEINLINE static bool get_left_thread(const_node_ptr n)
+   {  return (left_ptr_bits::get_bits(n->left_) & 1u) != 0;  }
+
+   BOOST_INTRUSIVE_FORCEINLINE static void set_left_thread(node_ptr n, bool t)
+   {  left_ptr_bits::set_bits(n->left_, (left_ptr_bits::get_bits(n->left_) & 2u) | std::size_t(t));  }
+
+   BOOST_INTRUSIVE_FORCEINLINE static bool get_right_thread(const_node_ptr n)
+   {  return right_ptr_bits::get_bits(n->right_) != 0;  }
+
+   BOOST_INTRUSIVE_FORCEINLINE static void set_right_thread(node_ptr n, bool t)
+   {  right_ptr_bits::set_bits(n->right_, std::size_t(t));  }
+
+   BOOST_INTRUSIVE_FORCEINLINE static color get_color(const_node_ptr n)
+   {  return (color)(left_ptr_bits::get_bits(n->left_) >> 1u);  }
+
+   BOOST_INTRUSIVE_FORCEINLINE static void set_color(node_ptr n, color c)
+   {  left_ptr_bits::set_bits(n->left_, (left_ptr_bits::get_bits(n->left_) & 1u) | (std::size_t(c != 0) << 1u));  }
+
+   BOOST_INTRUSIVE_FORCEINLINE static color black()
+   {  return node::black_t;  }
+
+   BOOST_INTRUSIVE_FORCEINLINE static color red()
+   {  return node::red_t;  }
+};
+
+//Dispatches the implementation based on the boolean
+template<class VoidPointer, bool Compact>
+struct threaded_rbtree_node_traits_dispatch
+   :  public default_threaded_rbtree_node_traits_impl<VoidPointer>
+{};
+
+template<class VoidPointer>
+struct threaded_rbtree_node_traits_dispatch<VoidPointer, true>
+   :  public compact_threaded_rbtree_node_traits_impl<VoidPointer>
+{};
+
+//Inherit from threaded_rbtree_node_traits_dispatch depending on the embedding capabilities.
+//Two bits are needed in the left link (thread + color) and one in the right link (thread).
+template<class VoidPointer>
+struct threaded_rbtree_node_traits
+   :  public threaded_rbtree_node_traits_dispatch
+         < VoidPointer
+         ,  (max_pointer_plus_bits
+            < VoidPointer
+            , detail::alignment_of<compact_threaded_rbtree_node<VoidPointer> >::value
+            >::value >= 2)
+         >
+{};
+
+} //namespace intrusive
+} //namespace boost
+
+#include <boost/intrusive/detail/config_end.hpp>
+
+#endif //BOOST_INTRUSIVE_THREADED_RBTREE_NODE_HPP
@@ -0,0 +1,148 @@
+/////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright agent 2026
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/intrusive for documentation.
+//
+/////////////////////////////////////////////////////////////////////////////
+
+#ifndef BOOST_INTRUSIVE_THREADED_TREE_ITERATOR_HPP
+#define BOOST_INTRUSIVE_THREADED_TREE_ITERATOR_HPP
+
+#ifndef BOOST_CONFIG_HPP
+#  include <boost/config.hpp>
+#endif
+
+#if defined(BOOST_HAS_PRAGMA_ONCE)
+#  pragma once
+#endif
+
+#include <boost/intrusive/detail/workaround.hpp>
+#include <boost/intrusive/detail/std_fwd.hpp>
+#include <boost/intrusive/detail/iiterator.hpp>
+#include <boost/intrusive/detail/mpl.hpp>
+#include <boost/intrusive/threaded_rbtree_algorithms.hpp>
+
+namespace boost {
+namespace intrusive {
+
+// threaded_tree_iterator provides some basic functions for a
+// node oriented bidirectional iterator over a threaded tree.
+// As threads link each node with its in-order neighbours, the iterator
+// is just a node pointer and needs no parent links or explicit stack:
+template<class ValueTraits, bool IsConst>
+class threaded_tree_iterator
+{
+   private:
+   typedef iiterator
+      <ValueTraits, IsConst, std::bidirectional_iterator_tag> types_t;
+
+   static const bool stateful_value_traits =                types_t::stateful_value_traits;
+
+   typedef ValueTraits                                      value_traits;
+   typedef typename types_t::node_traits                    node_traits;
+
+   typedef typename types_t::node                           node;
+   typedef typename types_t::node_ptr                       node_ptr;
+   typedef typename types_t::const_value_traits_ptr         const_value_traits_ptr;
+   typedef threaded_rbtree_algorithms<node_traits>          node_algorithms;
+   class nat;
+   typedef typename
+      detail::if_c< IsConst
+                  , threaded_tree_iterator<value_traits, false>
+                  , nat>::type                              nonconst_iterator;
+
+   public:
+   typedef typename types_t::iterator_type::difference_type    difference_type;
+   typedef typename types_t::iterator_type::value_type         value_type;
+   typedef typename types_t::iterator_type::pointer            pointer;
+   typedef typename types_t::iterator_type::reference          reference;
+   typedef typename types_t::iterator_type::iterator_category  iterator_category;
+
+   inline threaded_tree_iterator()
+   {}
+
+   inline explicit threaded_tree_iterator(node_ptr nodeptr, const_value_traits_ptr traits_ptr)
+      : members_(nodeptr, traits_ptr)
+   {}
+
+   inline threaded_tree_iterator(const threaded_tree_iterator &other)
+      :  members_(other.pointed_node(), other.get_value_traits())
+   {}
+
+   inline threaded_tree_iterator(const nonconst_iterator &other)
+      :  members_(other.pointed_node(), other.get_value_traits())
+   {}
+
+   inline threaded_tree_iterator &operator=(const threaded_tree_iterator &other)
+   {  members_ = other.members_;  return *this;  }
+
+   inline node_ptr pointed_node() const
+   { return members_.nodeptr_; }
+
+   inline threaded_tree_iterator &operator=(node_ptr nodeptr)
+   {  members_.nodeptr_ = nodeptr;  return *this;  }
+
+   inline const_value_traits_ptr get_value_traits() const
+   {  return members_.get_ptr(); }
+
+   public:
+   inline threaded_tree_iterator& operator++()
+   {
+      members_.nodeptr_ = node_algorithms::next_node(members_.nodeptr_);
+      return static_cast<threaded_tree_iterator&> (*this);
+   }
+
+   inline threaded_tree_iterator operator++(int)
+   {
+      threaded_tree_iterator result (*this);
+      members_.nodeptr_ = node_algorithms::next_node(members_.nodeptr_);
+      return result;
+   }
+
+   inline threaded_tree_iterator& operator--()
+   {
+      members_.nodeptr_ = node_algorithms::prev_node(members_.nodeptr_);
+      return static_cast<threaded_tree_iterator&> (*this);
+   }
+
+   inline threaded_tree_iterator operator--(int)
+   {
+      threaded_tree_iterator result (*this);
+      members_.nodeptr_ = node_algorithms::prev_node(members_.nodeptr_);
+      return result;
+   }
+
+   inline friend bool operator== (const threaded_tree_iterator& l, const threaded_tree_iterator& r)
+   {  return l.pointed_node() == r.pointed_node();   }
+
+   inline friend bool operator!= (const threaded_tree_iterator& l, const threaded_tree_iterator& r)
+   {  return !(l == r); }
+
+   inline reference operator*() const
+   {  return *operator->();   }
+
+   inline pointer operator->() const
+   { return this->operator_arrow(detail::bool_<stateful_value_traits>()); }
+
+   inline threaded_tree_iterator<ValueTraits, false> unconst() const
+   {  return threaded_tree_iterator<ValueTraits, false>(this->pointed_node(), this->get_value_traits());   }
+
+   private:
+   inline pointer operator_arrow(detail::false_) const
+   { return ValueTraits::to_value_ptr(members_.nodeptr_); }
+
+   inline pointer operator_arrow(detail::true_) const
+   { return this->get_value_traits()->to_value_ptr(members_.nodeptr_); }
+
+   iiterator_members<node_ptr, const_value_traits_ptr, stateful_value_traits> members_;
+};
+
+} //namespace intrusive
+} //namespace boost
+
+#endif //BOOST_INTRUSIVE_THREADED_TREE_ITERATOR_HPP
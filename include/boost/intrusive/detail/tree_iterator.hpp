@@ -53,7 +53,7 @@ class tree_iterator
 
    static const bool stateful_value_traits = types_t::stateful_value_traits;
 
-   void unspecified_bool_type_func() const {}
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR void unspecified_bool_type_func() const {}
    typedef void (tree_iterator::*unspecified_bool_type)() const;
    class nat;
    typedef typename
@@ -68,109 +68,109 @@ class tree_iterator
    typedef typename types_t::iterator_type::reference          reference;
    typedef typename types_t::iterator_type::iterator_category  iterator_category;
 
-   inline tree_iterator()
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR tree_iterator()
    {}
 
-   inline explicit tree_iterator(node_ptr nodeptr, const_value_traits_ptr traits_ptr)
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR explicit tree_iterator(node_ptr nodeptr, const_value_traits_ptr traits_ptr)
       : members_(nodeptr, traits_ptr)
    {}
 
-   inline tree_iterator(const tree_iterator &other)
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR tree_iterator(const tree_iterator &other)
       :  members_(other.pointed_node(), other.get_value_traits())
    {}
 
-   inline tree_iterator(const nonconst_iterator &other)
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR tree_iterator(const nonconst_iterator &other)
       :  members_(other.pointed_node(), other.get_value_traits())
    {}
 
-   inline tree_iterator &operator=(const tree_iterator &other)
-   {  members_.nodeptr_ = other.members_.nodeptr_;  return *this;  }
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR tree_iterator &operator=(const tree_iterator &other)
+   {  members_ = other.members_;  return *this;  }
 
-   inline tree_iterator &operator=(node_ptr nodeptr)
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR tree_iterator &operator=(node_ptr nodeptr)
    {  members_.nodeptr_ = nodeptr;  return *this;  }
 
-   inline node_ptr pointed_node() const
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR node_ptr pointed_node() const
    { return members_.nodeptr_; }
 
    public:
-   inline tree_iterator& operator++()
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR tree_iterator& operator++()
    {
       members_.nodeptr_ = node_algorithms::next_node(members_.nodeptr_);
       return *this;
    }
 
-   tree_iterator operator++(int)
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR tree_iterator operator++(int)
    {
       tree_iterator result (*this);
       members_.nodeptr_ = node_algorithms::next_node(members_.nodeptr_);
       return result;
    }
 
-   inline tree_iterator& operator--()
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR tree_iterator& operator--()
    {
       members_.nodeptr_ = node_algorithms::prev_node(members_.nodeptr_);
       return *this;
    }
 
-   tree_iterator operator--(int)
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR tree_iterator operator--(int)
    {
       tree_iterator result (*this);
       members_.nodeptr_ = node_algorithms::prev_node(members_.nodeptr_);
       return result;
    }
 
-   inline tree_iterator&  go_left()
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR tree_iterator&  go_left()
    {
       members_.nodeptr_ = node_traits::get_left(members_.nodeptr_);
       return *this;
    }
 
-   inline tree_iterator&  go_right()
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR tree_iterator&  go_right()
    {
       members_.nodeptr_ = node_traits::get_right(members_.nodeptr_);
       return *this;
    }
 
-   inline tree_iterator&  go_parent()
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR tree_iterator&  go_parent()
    {
       members_.nodeptr_ = node_traits::get_parent(members_.nodeptr_);
       return *this;
    }
 
-   inline operator unspecified_bool_type() const
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR operator unspecified_bool_type() const
    {  return members_.nodeptr_ ? &tree_iterator::unspecified_bool_type_func : 0;   }
 
-   inline bool operator! () const
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR bool operator! () const
    {  return !members_.nodeptr_;   }
 
-   inline friend bool operator== (const tree_iterator& l, const tree_iterator& r)
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR friend bool operator== (const tree_iterator& l, const tree_iterator& r)
    { return l.pointed_node() == r.pointed_node(); }
 
-   inline friend bool operator!= (const tree_iterator& l, const tree_iterator& r)
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR friend bool operator!= (const tree_iterator& l, const tree_iterator& r)
    {  return !(l == r);   }
 
-   inline reference operator*() const
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR reference operator*() const
    {  return *operator->();   }
 
-   inline pointer operator->() const
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR pointer operator->() const
    { return this->operator_arrow(detail::bool_<stateful_value_traits>()); }
 
-   inline const_value_traits_ptr get_value_traits() const
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR const_value_traits_ptr get_value_traits() const
    {  return members_.get_ptr();  }
 
-   tree_iterator end_iterator_from_it() const
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR tree_iterator end_iterator_from_it() const
    {
       return tree_iterator(node_algorithms::get_header(this->pointed_node()), this->get_value_traits());
    }
 
-   tree_iterator<value_traits, false> unconst() const
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR tree_iterator<value_traits, false> unconst() const
    {  return tree_iterator<value_traits, false>(this->pointed_node(), this->get_value_traits());   }
 
    private:
-   inline pointer operator_arrow(detail::false_) const
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR pointer operator_arrow(detail::false_) const
    { return ValueTraits::to_value_ptr(members_.nodeptr_); }
 
-   inline pointer operator_arrow(detail::true_) const
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR pointer operator_arrow(detail::true_) const
    { return this->get_value_traits()->to_value_ptr(members_.nodeptr_); }
 
    iiterator_members<node_ptr, const_value_traits_ptr, stateful_value_traits> members_;
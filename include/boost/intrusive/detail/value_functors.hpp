@@ -18,6 +18,7 @@
 #  pragma once
 #endif
 
+#include <boost/intrusive/detail/workaround.hpp>
 #include <cstddef>
 
 namespace boost {
@@ -27,7 +28,7 @@ namespace intrusive {
 template<class ValueType>
 struct value_less
 {
-   bool operator()(const ValueType &a, const ValueType &b) const
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR bool operator()(const ValueType &a, const ValueType &b) const
       {  return a < b;  }
 };
 
@@ -42,7 +43,7 @@ struct value_less<T*>
 template<class ValueType>
 struct value_equal
 {
-   bool operator()(const ValueType &a, const ValueType &b) const
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR bool operator()(const ValueType &a, const ValueType &b) const
       {  return a == b;  }
 };
 
@@ -117,8 +117,36 @@ template<unsigned> struct static_assert_test {};
 #  define BOOST_INTRUSIVE_NO_DANGLING
 #endif
 
+//Hint to fetch the memory pointed by P into the cache (ignored in constant evaluation).
+//Define BOOST_INTRUSIVE_DISABLE_PREFETCH to disable it.
+#if !defined(BOOST_INTRUSIVE_DISABLE_PREFETCH) && defined(__GNUC__)
+#  define BOOST_INTRUSIVE_PREFETCH(P) \
+      (BOOST_INTRUSIVE_IS_CONSTANT_EVALUATED() ? (void)0 : __builtin_prefetch(static_cast<const void*>(P)))
+#else
+#  define BOOST_INTRUSIVE_PREFETCH(P)
+#endif
+
 #if defined(__cpp_concepts) && (__cpp_concepts >= 202002L)
 #  define BOOST_INTRUSIVE_CONCEPTS_BASED_OVERLOADING
 #endif
 
+//Functions marked with BOOST_INTRUSIVE_CXX20_CONSTEXPR can be used in constant
+//evaluation if the compiler supports C++20 constexpr (trivial default initialization,
+//constexpr destructors and std::is_constant_evaluated).
+//Define BOOST_INTRUSIVE_DISABLE_CXX20_CONSTEXPR to disable it.
+#if !defined(BOOST_INTRUSIVE_DISABLE_CXX20_CONSTEXPR) && defined(__cpp_constexpr) && (__cpp_constexpr >= 201907L)
+#  include <type_traits>
+#  if defined(__cpp_lib_is_constant_evaluated)
+#     define BOOST_INTRUSIVE_HAS_CXX20_CONSTEXPR
+#  endif
+#endif
+
+#if defined(BOOST_INTRUSIVE_HAS_CXX20_CONSTEXPR)
+#  define BOOST_INTRUSIVE_CXX20_CONSTEXPR constexpr
+#  define BOOST_INTRUSIVE_IS_CONSTANT_EVALUATED() (::std::is_constant_evaluated())
+#else
+#  define BOOST_INTRUSIVE_CXX20_CONSTEXPR
+#  define BOOST_INTRUSIVE_IS_CONSTANT_EVALUATED() false
+#endif
+
 #endif   //#ifndef BOOST_INTRUSIVE_DETAIL_WORKAROUND_HPP
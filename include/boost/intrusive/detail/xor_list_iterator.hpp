@@ -0,0 +1,154 @@
+/////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright agent 2026
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/intrusive for documentation.
+//
+/////////////////////////////////////////////////////////////////////////////
+
+#ifndef BOOST_INTRUSIVE_XOR_LIST_ITERATOR_HPP
+#define BOOST_INTRUSIVE_XOR_LIST_ITERATOR_HPP
+
+#ifndef BOOST_CONFIG_HPP
+#  include <boost/config.hpp>
+#endif
+
+#if defined(BOOST_HAS_PRAGMA_ONCE)
+#  pragma once
+#endif
+
+#include <boost/intrusive/detail/workaround.hpp>
+#include <boost/intrusive/detail/std_fwd.hpp>
+#include <boost/intrusive/detail/iiterator.hpp>
+#include <boost/intrusive/detail/mpl.hpp>
+#include <boost/intrusive/xor_list_algorithms.hpp>
+
+namespace boost {
+namespace intrusive {
+
+// xor_list_iterator provides some basic functions for a
+// node oriented bidirectional iterator over a xor-linked list.
+// As a node only stores prev ^ next, the iterator holds the pointed
+// node and its previous node, so it can move in both directions:
+template<class ValueTraits, bool IsConst>
+class xor_list_iterator
+{
+   private:
+   typedef iiterator
+      <ValueTraits, IsConst, std::bidirectional_iterator_tag> types_t;
+
+   static const bool stateful_value_traits =                types_t::stateful_value_traits;
+
+   typedef ValueTraits                                      value_traits;
+   typedef typename types_t::node_traits                    node_traits;
+
+   typedef typename types_t::node                           node;
+   typedef typename types_t::node_ptr                       node_ptr;
+   typedef typename types_t::const_value_traits_ptr         const_value_traits_ptr;
+   typedef xor_list_algorithms<node_traits>                 node_algorithms;
+   class nat;
+   typedef typename
+      detail::if_c< IsConst
+                  , xor_list_iterator<value_traits, false>
+                  , nat>::type                              nonconst_iterator;
+
+   public:
+   typedef typename types_t::iterator_type::difference_type    difference_type;
+   typedef typename types_t::iterator_type::value_type         value_type;
+   typedef typename types_t::iterator_type::pointer            pointer;
+   typedef typename types_t::iterator_type::reference          reference;
+   typedef typename types_t::iterator_type::iterator_category  iterator_category;
+
+   inline xor_list_iterator()
+   {}
+
+   inline xor_list_iterator(node_ptr prevptr, node_ptr nodeptr, const_value_traits_ptr traits_ptr)
+      : prev_(prevptr), members_(nodeptr, traits_ptr)
+   {}
+
+   inline xor_list_iterator(const xor_list_iterator &other)
+      :  prev_(other.previous_node()), members_(other.pointed_node(), other.get_value_traits())
+   {}
+
+   inline xor_list_iterator(const nonconst_iterator &other)
+      :  prev_(other.previous_node()), members_(other.pointed_node(), other.get_value_traits())
+   {}
+
+   inline xor_list_iterator &operator=(const xor_list_iterator &other)
+   {  prev_ = other.prev_;  members_ = other.members_;  return *this;  }
+
+   inline node_ptr pointed_node() const
+   { return members_.nodeptr_; }
+
+   //The node that precedes the pointed node
+   inline node_ptr previous_node() const
+   { return prev_; }
+
+   inline const_value_traits_ptr get_value_traits() const
+   {  return members_.get_ptr(); }
+
+   public:
+   inline xor_list_iterator& operator++()
+   {
+      const node_ptr next = node_algorithms::get_next(prev_, members_.nodeptr_);
+      prev_ = members_.nodeptr_;
+      members_.nodeptr_ = next;
+      return static_cast<xor_list_iterator&> (*this);
+   }
+
+   inline xor_list_iterator operator++(int)
+   {
+      xor_list_iterator result (*this);
+      ++*this;
+      return result;
+   }
+
+   inline xor_list_iterator& operator--()
+   {
+      const node_ptr prev = node_algorithms::get_previous(prev_, members_.nodeptr_);
+      members_.nodeptr_ = prev_;
+      prev_ = prev;
+      return static_cast<xor_list_iterator&> (*this);
+   }
+
+   inline xor_list_iterator operator--(int)
+   {
+      xor_list_iterator result (*this);
+      --*this;
+      return result;
+   }
+
+   inline friend bool operator== (const xor_list_iterator& l, const xor_list_iterator& r)
+   {  return l.pointed_node() == r.pointed_node();   }
+
+   inline friend bool operator!= (const xor_list_iterator& l, const xor_list_iterator& r)
+   {  return !(l == r); }
+
+   inline reference operator*() const
+   {  return *operator->();   }
+
+   inline pointer operator->() const
+   { return this->operator_arrow(detail::bool_<stateful_value_traits>()); }
+
+   inline xor_list_iterator<ValueTraits, false> unconst() const
+   {  return xor_list_iterator<ValueTraits, false>(this->previous_node(), this->pointed_node(), this->get_value_traits());   }
+
+   private:
+   inline pointer operator_arrow(detail::false_) const
+   { return ValueTraits::to_value_ptr(members_.nodeptr_); }
+
+   inline pointer operator_arrow(detail::true_) const
+   { return this->get_value_traits()->to_value_ptr(members_.nodeptr_); }
+
+   node_ptr prev_;
+   iiterator_members<node_ptr, const_value_traits_ptr, stateful_value_traits> members_;
+};
+
+} //namespace intrusive
+} //namespace boost
+
+#endif //BOOST_INTRUSIVE_XOR_LIST_ITERATOR_HPP
@@ -0,0 +1,64 @@
+/////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright agent 2026
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/intrusive for documentation.
+//
+/////////////////////////////////////////////////////////////////////////////
+
+#ifndef BOOST_INTRUSIVE_XOR_LIST_NODE_HPP
+#define BOOST_INTRUSIVE_XOR_LIST_NODE_HPP
+
+#ifndef BOOST_CONFIG_HPP
+#  include <boost/config.hpp>
+#endif
+
+#if defined(BOOST_HAS_PRAGMA_ONCE)
+#  pragma once
+#endif
+
+#include <boost/intrusive/intrusive_fwd.hpp>
+#include <boost/intrusive/detail/workaround.hpp>
+#include <boost/intrusive/detail/mpl.hpp>
+#include <boost/intrusive/pointer_rebind.hpp>
+
+namespace boost {
+namespace intrusive {
+
+// xor_list_node_traits can be used with xor_list_algorithms and supplies
+// a xor_list_node holding a single link field: the address of the
+// previous node xor'ed with the address of the next node.
+//
+// The link can only be computed from addresses, so only raw pointers are supported.
+
+template<class VoidPointer>
+struct xor_list_node
+{
+   typedef typename pointer_rebind<VoidPointer, xor_list_node>::type  node_ptr;
+   uintptr_t link_;
+};
+
+template<class VoidPointer>
+struct xor_list_node_traits
+{
+   typedef xor_list_node<VoidPointer>  node;
+   typedef typename node::node_ptr     node_ptr;
+   typedef typename pointer_rebind<VoidPointer, const node>::type   const_node_ptr;
+
+   BOOST_INTRUSIVE_STATIC_ASSERT((detail::is_same<node_ptr, node*>::value));
+
+   BOOST_INTRUSIVE_FORCEINLINE static uintptr_t get_link(const_node_ptr n)
+   {  return n->link_;  }
+
+   BOOST_INTRUSIVE_FORCEINLINE static void set_link(node_ptr n, uintptr_t link)
+   {  n->link_ = link;  }
+};
+
+} //namespace intrusive
+} //namespace boost
+
+#endif //BOOST_INTRUSIVE_XOR_LIST_NODE_HPP
@@ -0,0 +1,460 @@
+/////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright agent 2026
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/intrusive for documentation.
+//
+/////////////////////////////////////////////////////////////////////////////
+
+#ifndef BOOST_INTRUSIVE_FROZEN_SET_HPP
+#define BOOST_INTRUSIVE_FROZEN_SET_HPP
+
+#include <boost/intrusive/detail/config_begin.hpp>
+#include <boost/intrusive/intrusive_fwd.hpp>
+#include <boost/intrusive/detail/assert.hpp>
+#include <boost/intrusive/detail/mpl.hpp>
+#include <boost/intrusive/detail/workaround.hpp>
+#include <boost/intrusive/detail/iterator.hpp>
+#include <boost/intrusive/pointer_traits.hpp>
+
+#include <boost/intrusive/detail/minimal_pair_header.hpp>
+#include <cstddef>   //std::size_t
+
+#if defined(BOOST_HAS_PRAGMA_ONCE)
+#  pragma once
+#endif
+
+namespace boost {
+namespace intrusive {
+
+/// @cond
+
+namespace detail {
+
+template<class Pointer, class Key, bool CacheKeys>
+struct frozen_set_entry
+{
+   Pointer  value;
+   Key      key;
+};
+
+template<class Pointer, class Key>
+struct frozen_set_entry<Pointer, Key, false>
+{
+   Pointer  value;
+};
+
+}  //namespace detail {
+
+/// @endcond
+
+//! frozen_set is a read-optimized snapshot of a tree based container (bstree, rbtree, set,
+//! avl_multiset...). It stores pointers to the elements of the tree (and, if \c CacheKeys is
+//! true, copies of their keys) in a user provided array using the Eytzinger (breadth-first)
+//! layout: the root is stored in the first position and the children of the element stored
+//! in position \c k (1-based) are stored in positions \c 2k and \c 2k+1.
+//!
+//! Lookups descend that implicit tree without data dependent branches and prefetch
+//! the positions that will be visited a few levels below, so they are much
+//! faster than lookups in the tree when the snapshot is probed many times.
+//! Lookups return iterators of the tree.
+//!
+//! The snapshot does not observe the tree: after the tree is modified and
+//! before the next lookup, the snapshot must be updated calling \c refresh or \c rebuild.
+//!
+//! The template parameter \c Tree is the tree based container type and
+//! \c CacheKeys selects if keys are copied into the snapshot. Caching keys
+//! avoids touching the elements while descending, but requires a copyable \c key_type.
+template<class Tree, bool CacheKeys>
+class frozen_set
+{
+   public:
+   typedef Tree                                                      tree_type;
+   typedef typename tree_type::value_type                            value_type;
+   typedef typename tree_type::key_type                              key_type;
+   typedef typename tree_type::key_of_value                          key_of_value;
+   typedef typename tree_type::key_compare                           key_compare;
+   typedef typename tree_type::pointer                               pointer;
+   typedef typename tree_type::iterator                              iterator;
+   typedef typename tree_type::size_type                             size_type;
+   typedef BOOST_INTRUSIVE_IMPDEF
+      (detail::frozen_set_entry<pointer BOOST_INTRUSIVE_I key_type BOOST_INTRUSIVE_I CacheKeys>) entry_type;
+
+   static const bool cache_keys = CacheKeys;
+
+   /// @cond
+   private:
+   typedef detail::bool_<CacheKeys>    cache_keys_t;
+
+   //Prefetching entries_[k*prefetch_stride - 1] brings to the cache the
+   //descendants of k visited log2(prefetch_stride) levels below.
+   static const std::size_t entries_per_line = 64u/sizeof(entry_type);
+   static const size_type prefetch_stride =
+      entries_per_line >= 16u ? 16u :
+      entries_per_line >=  8u ?  8u :
+      entries_per_line >=  4u ?  4u : 2u;
+   /// @endcond
+
+   public:
+   //! <b>Requires</b>: entries must point to an array of at least capacity elements
+   //!   that must outlive the snapshot.
+   //!
+   //! <b>Effects</b>: Constructs an empty snapshot that will use the passed array.
+   //!   \c rebuild must be called before any lookup.
+   //!
+   //! <b>Complexity</b>: Constant.
+   //!
+   //! <b>Throws</b>: Nothing.
+   frozen_set(entry_type *entries, size_type capacity) BOOST_NOEXCEPT
+      : tree_(), entries_(entries), capacity_(capacity), size_()
+   {}
+
+   //! <b>Requires</b>: entries must point to an array of at least capacity elements
+   //!   that must outlive the snapshot. capacity must not be less than t.size().
+   //!
+   //! <b>Effects</b>: Constructs a snapshot of t that will use the passed array.
+   //!
+   //! <b>Complexity</b>: Linear to t.size().
+   //!
+   //! <b>Throws</b>: If the copy constructor of key_type throws (only if cache_keys is true).
+   frozen_set(tree_type &t, entry_type *entries, size_type capacity)
+      : tree_(), entries_(entries), capacity_(capacity), size_()
+   {  this->rebuild(t);  }
+
+   //! <b>Effects</b>: Returns the number of elements of the tree when the snapshot was last updated.
+   //!
+   //! <b>Complexity</b>: Constant.
+   //!
+   //! <b>Throws</b>: Nothing.
+   size_type size() const BOOST_NOEXCEPT
+   {  return size_;  }
+
+   //! <b>Effects</b>: Returns true if the snapshot holds no elements.
+   //!
+   //! <b>Complexity</b>: Constant.
+   //!
+   //! <b>Throws</b>: Nothing.
+   bool empty() const BOOST_NOEXCEPT
+   {  return !size_;  }
+
+   //! <b>Effects</b>: Returns the number of elements of the array passed in the constructor.
+   //!
+   //! <b>Complexity</b>: Constant.
+   //!
+   //! <b>Throws</b>: Nothing.
+   size_type capacity() const BOOST_NOEXCEPT
+   {  return capacity_;  }
+
+   //! <b>Requires</b>: The snapshot was built from a tree.
+   //!
+   //! <b>Effects</b>: Returns the tree this snapshot was built from.
+   //!
+   //! <b>Complexity</b>: Constant.
+   //!
+   //! <b>Throws</b>: Nothing.
+   tree_type &tree() const BOOST_NOEXCEPT
+   {  return this->priv_tree();  }
+
+   //! <b>Requires</b>: capacity() must not be less than t.size().
+   //!
+   //! <b>Effects</b>: Discards the current contents and takes a new snapshot of t.
+   //!
+   //! <b>Complexity</b>: Linear to t.size().
+   //!
+   //! <b>Throws</b>: If the copy constructor of key_type throws (only if cache_keys is true).
+   //!   Basic guarantee.
+   void rebuild(tree_type &t)
+   {
+      BOOST_INTRUSIVE_INVARIANT_ASSERT(t.size() <= capacity_);
+      tree_ = &t;
+      size_ = 0u;
+      const size_type n = t.size();
+      typename tree_type::iterator it(t.begin());
+      for(size_type k = priv_first_slot(n); k; k = priv_next_slot(k, n), ++it){
+         priv_assign(entries_[k-1u], *it, cache_keys_t());
+      }
+      size_ = n;
+   }
+
+   //! <b>Requires</b>: The snapshot was built from a tree.
+   //!
+   //! <b>Effects</b>: Updates the snapshot after the tree was modified. If the size of the
+   //!   tree has not changed (e.g. elements were replaced by equivalent ones with \c replace_node,
+   //!   or as many elements were inserted as erased) only the positions holding a different element
+   //!   are written, so unchanged parts of the array are left untouched. Otherwise the
+   //!   snapshot is rebuilt.
+   //!
+   //! <b>Returns</b>: The number of written positions.
+   //!
+   //! <b>Complexity</b>: Linear to tree().size().
+   //!
+   //! <b>Throws</b>: If the copy constructor of key_type throws (only if cache_keys is true).
+   //!   Basic guarantee.
+   size_type refresh()
+   {
+      tree_type &t = this->priv_tree();
+      if(t.size() != size_){
+         this->rebuild(t);
+         return size_;
+      }
+      size_type written = 0u;
+      typename tree_type::iterator it(t.begin());
+      for(size_type k = priv_first_slot(size_); k; k = priv_next_slot(k, size_), ++it){
+         entry_type &e = entries_[k-1u];
+         if(&*e.value != &*it){
+            priv_assign(e, *it, cache_keys_t());
+            ++written;
+         }
+      }
+      return written;
+   }
+
+   //! <b>Requires</b>: The snapshot was built from a tree.
+   //!
+   //! <b>Effects</b>: Returns an iterator of the tree to the first element whose
+   //!   key is not less than k or tree().end() if that element does not exist.
+   //!
+   //! <b>Complexity</b>: Logarithmic.
+   //!
+   //! <b>Throws</b>: If the comparison functor throws.
+   iterator lower_bound(const key_type &key) const
+   {  return this->lower_bound(key, this->priv_tree().key_comp());  }
+
+   //! <b>Requires</b>: comp must imply the same element order as
+   //!   key_compare. That is, if comp(key, e) and !comp(e, key),
+   //!   then key_compare()(key, e) and !key_compare()(e, key).
+   //!   The snapshot was built from a tree.
+   //!
+   //! <b>Effects</b>: Returns an iterator of the tree to the first element whose
+   //!   key is not less than k or tree().end() if that element does not exist.
+   //!
+   //! <b>Complexity</b>: Logarithmic.
+   //!
+   //! <b>Throws</b>: If comp throws.
+   template<class KeyType, class KeyTypeKeyCompare>
+   iterator lower_bound(const KeyType &key, KeyTypeKeyCompare comp) const
+   {  return priv_iterator(priv_lower_bound(key, comp));  }
+
+   //! <b>Requires</b>: The snapshot was built from a tree.
+   //!
+   //! <b>Effects</b>: Returns an iterator of the tree to the first element whose
+   //!   key is greater than k or tree().end() if that element does not exist.
+   //!
+   //! <b>Complexity</b>: Logarithmic.
+   //!
+   //! <b>Throws</b>: If the comparison functor throws.
+   iterator upper_bound(const key_type &key) const
+   {  return this->upper_bound(key, this->priv_tree().key_comp());  }
+
+   //! <b>Requires</b>: comp must imply the same element order as
+   //!   key_compare. That is, if comp(key, e) and !comp(e, key),
+   //!   then key_compare()(key, e) and !key_compare()(e, key).
+   //!   The snapshot was built from a tree.
+   //!
+   //! <b>Effects</b>: Returns an iterator of the tree to the first element whose
+   //!   key is greater than k or tree().end() if that element does not exist.
+   //!
+   //! <b>Complexity</b>: Logarithmic.
+   //!
+   //! <b>Throws</b>: If comp throws.
+   template<class KeyType, class KeyTypeKeyCompare>
+   iterator upper_bound(const KeyType &key, KeyTypeKeyCompare comp) const
+   {  return priv_iterator(priv_upper_bound(key, comp));  }
+
+   //! <b>Requires</b>: The snapshot was built from a tree.
+   //!
+   //! <b>Effects</b>: Finds an iterator of the tree to the first element whose key is
+   //!   k or tree().end() if that element does not exist.
+   //!
+   //! <b>Complexity</b>: Logarithmic.
+   //!
+   //! <b>Throws</b>: If the comparison functor throws.
+   iterator find(const key_type &key) const
+   {  return this->find(key, this->priv_tree().key_comp());  }
+
+   //! <b>Requires</b>: comp must imply the same element order as
+   //!   key_compare. That is, if comp(key, e) and !comp(e, key),
+   //!   then key_compare()(key, e) and !key_compare()(e, key).
+   //!   The snapshot was built from a tree.
+   //!
+   //! <b>Effects</b>: Finds an iterator of the tree to the first element whose key is
+   //!   k or tree().end() if that element does not exist.
+   //!
+   //! <b>Complexity</b>: Logarithmic.
+   //!
+   //! <b>Throws</b>: If comp throws.
+   template<class KeyType, class KeyTypeKeyCompare>
+   iterator find(const KeyType &key, KeyTypeKeyCompare comp) const
+   {
+      const size_type k = priv_lower_bound(key, comp);
+      return (k && !priv_key_less(key, entries_[k-1u], comp, cache_keys_t()))
+         ? priv_iterator(k) : this->priv_tree().end();
+   }
+
+   //! <b>Requires</b>: The snapshot was built from a tree.
+   //!
+   //! <b>Effects</b>: Returns true if the tree contains an element whose key is k.
+   //!
+   //! <b>Complexity</b>: Logarithmic.
+   //!
+   //! <b>Throws</b>: If the comparison functor throws.
+   bool contains(const key_type &key) const
+   {  return this->find(key) != this->priv_tree().end();  }
+
+   //! <b>Requires</b>: The snapshot was built from a tree.
+   //!
+   //! <b>Effects</b>: Returns the number of elements of the tree whose key is k.
+   //!
+   //! <b>Complexity</b>: Logarithmic to size() plus linear to the number of elements with key k.
+   //!
+   //! <b>Throws</b>: If the comparison functor throws.
+   size_type count(const key_type &key) const
+   {
+      const std::pair<iterator, iterator> r = this->equal_range(key);
+      return size_type(boost::intrusive::iterator_distance(r.first, r.second));
+   }
+
+   //! <b>Requires</b>: The snapshot was built from a tree.
+   //!
+   //! <b>Effects</b>: Finds a range of the tree containing all elements whose key is k or
+   //!   an empty range that indicates the position where those elements would be
+   //!   if there is no element with key k.
+   //!
+   //! <b>Complexity</b>: Logarithmic.
+   //!
+   //! <b>Throws</b>: If the comparison functor throws.
+   std::pair<iterator, iterator> equal_range(const key_type &key) const
+   {  return this->equal_range(key, this->priv_tree().key_comp());  }
+
+   //! <b>Requires</b>: comp must imply the same element order as
+   //!   key_compare. That is, if comp(key, e) and !comp(e, key),
+   //!   then key_compare()(key, e) and !key_compare()(e, key).
+   //!   The snapshot was built from a tree.
+   //!
+   //! <b>Effects</b>: Finds a range of the tree containing all elements whose key is k or
+   //!   an empty range that indicates the position where those elements would be
+   //!   if there is no element with key k.
+   //!
+   //! <b>Complexity</b>: Logarithmic.
+   //!
+   //! <b>Throws</b>: If comp throws.
+   template<class KeyType, class KeyTypeKeyCompare>
+   std::pair<iterator, iterator> equal_range(const KeyType &key, KeyTypeKeyCompare comp) const
+   {
+      return std::pair<iterator, iterator>
+         (priv_iterator(priv_lower_bound(key, comp)), priv_iterator(priv_upper_bound(key, comp)));
+   }
+
+   /// @cond
+   private:
+   //First in-order position of an implicit tree of n elements, 0 if empty
+   static size_type priv_first_slot(size_type n)
+   {
+      size_type k = n ? 1u : 0u;
+      while(k && 2u*k <= n)
+         k *= 2u;
+      return k;
+   }
+
+   //Next in-order position of an implicit tree of n elements, 0 after the last one
+   static size_type priv_next_slot(size_type k, size_type n)
+   {
+      if(2u*k + 1u <= n){
+         k = 2u*k + 1u;
+         while(2u*k <= n)
+            k *= 2u;
+         return k;
+      }
+      return priv_climb(k);
+   }
+
+   //Climbs while k is a right child and returns the parent of the last left child,
+   //that is, the position whose left subtree is the descent that ended in k.
+   static size_type priv_climb(size_type k)
+   {
+      while(k & 1u)
+         k >>= 1u;
+      return k >> 1u;
+   }
+
+   static void priv_assign(entry_type &e, value_type &v, detail::true_)
+   {
+      e.key = key_of_value()(v);
+      e.value = pointer_traits<pointer>::pointer_to(v);
+   }
+
+   static void priv_assign(entry_type &e, value_type &v, detail::false_)
+   {  e.value = pointer_traits<pointer>::pointer_to(v);  }
+
+   template<class KeyType, class KeyTypeKeyCompare>
+   static bool priv_entry_less(const entry_type &e, const KeyType &key, KeyTypeKeyCompare &comp, detail::true_)
+   {  return comp(e.key, key);  }
+
+   template<class KeyType, class KeyTypeKeyCompare>
+   static bool priv_entry_less(const entry_type &e, const KeyType &key, KeyTypeKeyCompare &comp, detail::false_)
+   {  return comp(key_of_value()(*e.value), key);  }
+
+   template<class KeyType, class KeyTypeKeyCompare>
+   static bool priv_key_less(const KeyType &key, const entry_type &e, KeyTypeKeyCompare &comp, detail::true_)
+   {  return comp(key, e.key);  }
+
+   template<class KeyType, class KeyTypeKeyCompare>
+   static bool priv_key_less(const KeyType &key, const entry_type &e, KeyTypeKeyCompare &comp, detail::false_)
+   {  return comp(key, key_of_value()(*e.value));  }
+
+   void priv_prefetch(size_type k) const
+   {
+      const size_type pf = k*prefetch_stride - 1u;
+      BOOST_INTRUSIVE_PREFETCH(entries_ + (pf < size_ ? pf : size_ - 1u));
+   }
+
+   //The comparison result is the next step of the descent,
+   //so no branch depends on the key of the visited element.
+   template<class KeyType, class KeyTypeKeyCompare>
+   size_type priv_lower_bound(const KeyType &key, KeyTypeKeyCompare comp) const
+   {
+      size_type k = 1u;
+      while(k <= size_){
+         this->priv_prefetch(k);
+         k = 2u*k + size_type(priv_entry_less(entries_[k-1u], key, comp, cache_keys_t()));
+      }
+      return priv_climb(k);
+   }
+
+   template<class KeyType, class KeyTypeKeyCompare>
+   size_type priv_upper_bound(const KeyType &key, KeyTypeKeyCompare comp) const
+   {
+      size_type k = 1u;
+      while(k <= size_){
+         this->priv_prefetch(k);
+         k = 2u*k + size_type(!priv_key_less(key, entries_[k-1u], comp, cache_keys_t()));
+      }
+      return priv_climb(k);
+   }
+
+   tree_type &priv_tree() const
+   {
+      BOOST_INTRUSIVE_INVARIANT_ASSERT(tree_);
+      return *tree_;
+   }
+
+   iterator priv_iterator(size_type k) const
+   {  return k ? this->priv_tree().iterator_to(*entries_[k-1u].value) : this->priv_tree().end();  }
+
+   tree_type   *tree_;
+   entry_type  *entries_;
+   size_type   capacity_;
+   size_type   size_;
+   /// @endcond
+};
+
+} //namespace intrusive
+} //namespace boost
+
+#include <boost/intrusive/detail/config_end.hpp>
+
+#endif //BOOST_INTRUSIVE_FROZEN_SET_HPP
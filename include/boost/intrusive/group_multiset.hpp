@@ -0,0 +1,1488 @@
+/////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright agent 2026
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/intrusive for documentation.
+//
+/////////////////////////////////////////////////////////////////////////////
+#ifndef BOOST_INTRUSIVE_GROUP_MULTISET_HPP
+#define BOOST_INTRUSIVE_GROUP_MULTISET_HPP
+
+#include <boost/intrusive/detail/config_begin.hpp>
+#include <boost/intrusive/intrusive_fwd.hpp>
+
+#include <boost/intrusive/detail/assert.hpp>
+#include <boost/intrusive/group_multiset_hook.hpp>
+#include <boost/intrusive/rbtree_algorithms.hpp>
+#include <boost/intrusive/avltree_algorithms.hpp>
+#include <boost/intrusive/bstree.hpp>
+#include <boost/intrusive/detail/group_tree_iterator.hpp>
+#include <boost/intrusive/detail/ebo_functor_holder.hpp>
+#include <boost/intrusive/detail/mpl.hpp>
+#include <boost/intrusive/pointer_traits.hpp>
+#include <boost/intrusive/detail/is_stateful_value_traits.hpp>
+#include <boost/intrusive/detail/default_header_holder.hpp>
+#include <boost/intrusive/detail/reverse_iterator.hpp>
+#include <boost/intrusive/detail/node_cloner_disposer.hpp>
+#include <boost/intrusive/detail/key_nodeptr_comp.hpp>
+#include <boost/intrusive/detail/simple_disposers.hpp>
+#include <boost/intrusive/detail/size_holder.hpp>
+#include <boost/intrusive/detail/get_value_traits.hpp>
+#include <boost/intrusive/link_mode.hpp>
+#include <boost/intrusive/parent_from_member.hpp>
+#include <boost/move/utility_core.hpp>
+#include <boost/move/adl_move_swap.hpp>
+
+#include <boost/intrusive/detail/minimal_pair_header.hpp>
+#include <cstddef>   //size_t...
+
+#if defined(BOOST_HAS_PRAGMA_ONCE)
+#  pragma once
+#endif
+
+namespace boost {
+namespace intrusive {
+
+/// @cond
+
+struct default_group_multiset_hook_applier
+{  template <class T> struct apply{ typedef typename T::default_group_tree_hook type;  };  };
+
+template<>
+struct is_default_hook_tag<default_group_multiset_hook_applier>
+{  static const bool value = true;  };
+
+struct group_multiset_defaults
+{
+   typedef default_group_multiset_hook_applier proto_value_traits;
+   static const bool constant_time_size = true;
+   typedef std::size_t size_type;
+   typedef void compare;
+   typedef void key_of_value;
+   typedef void header_holder_type;
+};
+
+/// @endcond
+
+//! The class template group_multiset_impl is an intrusive container that mimics the
+//! interface of std::multiset, optimized for workloads with many elements with
+//! equivalent keys.
+//!
+//! Only the first inserted element of each key (the group leader) is linked in a
+//! balanced tree (red-black or AVL, selected with \c AlgoType). The rest of elements
+//! with the same key are linked in a circular list that starts at the leader,
+//! so the tree height depends only on the number of distinct keys and:
+//!  - \c insert is O(log(distinct keys)), appending the element after the
+//!    elements with equivalent keys, as \c multiset::insert does.
+//!  - \c count and \c equal_range are O(log(distinct keys) + k), where k is the number
+//!    of elements with the given key.
+//!  - Erasing an element that is not a leader is constant-time and does not rebalance
+//!    the tree, erasing a leader moves the next element of its group into the tree
+//!    in constant time.
+//!
+//! The hook (see \c group_multiset_base_hook and \c group_multiset_member_hook) adds
+//! two links to the hook of \c multiset. \c auto_unlink hooks are not supported.
+//!
+//! The template parameter \c T is the type to be managed by the container.
+//! The user can specify additional options and if no options are provided
+//! default options are used.
+//!
+//! The container supports the following options:
+//! \c base_hook<>/member_hook<>/value_traits<>,
+//! \c constant_time_size<>, \c size_type<>,
+//! \c compare<> and \c key_of_value<>.
+#if defined(BOOST_INTRUSIVE_DOXYGEN_INVOKED)
+template<class T, class ...Options>
+#else
+template<class ValueTraits, class VoidOrKeyOfValue, class VoidOrKeyComp, class SizeType, bool ConstantTimeSize, algo_types AlgoType, typename HeaderHolder>
+#endif
+class group_multiset_impl
+{
+   /// @cond
+   typedef bst_key_types< typename ValueTraits::pointer
+                        , VoidOrKeyOfValue
+                        , VoidOrKeyComp>                             key_types;
+   /// @endcond
+
+   public:
+   typedef ValueTraits                                               value_traits;
+   typedef typename value_traits::pointer                            pointer;
+   typedef typename value_traits::const_pointer                      const_pointer;
+   typedef typename pointer_traits<pointer>::element_type            value_type;
+   typedef typename key_types::key_type                              key_type;
+   typedef typename key_types::key_of_value                          key_of_value;
+   typedef typename key_types::key_compare                           key_compare;
+   typedef typename key_types::value_compare                         value_compare;
+   typedef typename pointer_traits<pointer>::reference               reference;
+   typedef typename pointer_traits<const_pointer>::reference         const_reference;
+   typedef typename pointer_traits<pointer>::difference_type         difference_type;
+   typedef SizeType                                                  size_type;
+   typedef group_tree_iterator<value_traits, false>                  iterator;
+   typedef group_tree_iterator<value_traits, true>                   const_iterator;
+   typedef boost::intrusive::reverse_iterator<iterator>              reverse_iterator;
+   typedef boost::intrusive::reverse_iterator<const_iterator>        const_reverse_iterator;
+   typedef typename value_traits::node_traits                        node_traits;
+   typedef typename node_traits::node                                node;
+   typedef typename node_traits::node_ptr                            node_ptr;
+   typedef typename node_traits::const_node_ptr                      const_node_ptr;
+   typedef typename get_algo<AlgoType, node_traits>::type            node_algorithms;
+   typedef typename detail::get_header_holder_type
+      < value_traits, HeaderHolder >::type                           header_holder_type;
+
+   static const bool constant_time_size = ConstantTimeSize;
+   static const bool stateful_value_traits = detail::is_stateful_value_traits<value_traits>::value;
+   static const bool has_container_from_iterator =
+        detail::is_same< header_holder_type, detail::default_header_holder< node_traits > >::value;
+
+   /// @cond
+   private:
+   typedef detail::size_holder<constant_time_size, size_type>        size_traits;
+   typedef detail::key_nodeptr_comp
+      <key_compare, value_traits, key_of_value>                      node_comp_t;
+   typedef typename get_algo<GroupTreeAlgorithms, node_traits>::type group_algorithms;
+
+   //noncopyable
+   BOOST_MOVABLE_BUT_NOT_COPYABLE(group_multiset_impl)
+
+   static const bool safemode_or_autounlink = is_safe_autounlink<value_traits::link_mode>::value;
+
+   //Nodes can't be unlinked without the ordering predicate of the container
+   BOOST_INTRUSIVE_STATIC_ASSERT(((int)value_traits::link_mode != (int)auto_unlink));
+   BOOST_INTRUSIVE_STATIC_ASSERT(((int)AlgoType == (int)RbTreeAlgorithms || (int)AlgoType == (int)AvlTreeAlgorithms));
+
+   inline node_ptr header_ptr()
+   { return data_.root_plus_size_.m_header.get_node(); }
+
+   inline const_node_ptr header_ptr() const
+   { return data_.root_plus_size_.m_header.get_node(); }
+
+   struct root_plus_size : public size_traits
+   {
+      header_holder_type m_header;
+   };
+
+   struct data_t
+      //Put the (possibly empty) functor in the first position to get EBO in MSVC
+      : public detail::ebo_functor_holder<value_compare>
+      , public value_traits
+   {
+      typedef typename group_multiset_impl::value_traits value_traits;
+      inline data_t(const key_compare &comp, const value_traits &val_traits)
+         :  detail::ebo_functor_holder<value_compare>(value_compare(comp)), value_traits(val_traits)
+      {}
+
+      root_plus_size root_plus_size_;
+   } data_;
+
+   inline size_traits &priv_size_traits() BOOST_NOEXCEPT
+   {  return data_.root_plus_size_;  }
+
+   inline const size_traits &priv_size_traits() const BOOST_NOEXCEPT
+   {  return data_.root_plus_size_;  }
+
+   inline const value_traits &priv_value_traits() const BOOST_NOEXCEPT
+   {  return data_;  }
+
+   inline value_traits &priv_value_traits() BOOST_NOEXCEPT
+   {  return data_;  }
+
+   inline const value_compare &priv_comp() const BOOST_NOEXCEPT
+   {  return static_cast<const detail::ebo_functor_holder<value_compare>&>(data_).get();  }
+
+   inline value_compare &priv_comp() BOOST_NOEXCEPT
+   {  return static_cast<detail::ebo_functor_holder<value_compare>&>(data_).get();  }
+
+   typedef typename boost::intrusive::value_traits_pointers
+      <ValueTraits>::const_value_traits_ptr const_value_traits_ptr;
+
+   inline const_value_traits_ptr priv_value_traits_ptr() const BOOST_NOEXCEPT
+   {  return pointer_traits<const_value_traits_ptr>::pointer_to(this->priv_value_traits());  }
+
+   template<class KeyTypeKeyCompare>
+   struct key_node_comp_ret
+   {  typedef detail::key_nodeptr_comp<KeyTypeKeyCompare, value_traits, key_of_value> type;  };
+
+   template<class KeyTypeKeyCompare>
+   inline typename key_node_comp_ret<KeyTypeKeyCompare>::type key_node_comp(KeyTypeKeyCompare comp) const
+   {
+      return detail::key_nodeptr_comp<KeyTypeKeyCompare, value_traits, key_of_value>(comp, &this->priv_value_traits());
+   }
+
+   inline node_comp_t priv_node_comp() const
+   {  return this->key_node_comp(this->key_comp());  }
+
+   void priv_init()
+   {
+      this->priv_size_traits().set_size(size_type(0));
+      group_algorithms::init(this->header_ptr());
+      node_algorithms::init_header(this->header_ptr());
+   }
+
+   //Disposes the followers of each leader before the leader itself
+   template<class Disposer>
+   struct group_disposer
+   {
+      group_disposer(Disposer &d, const value_traits *traits)
+         :  disposer_(d), traits_(traits)
+      {}
+
+      void operator()(node_ptr leader)
+      {
+         node_ptr n(node_traits::get_next(leader));
+         while(n != leader){
+            const node_ptr nxt(node_traits::get_next(n));
+            this->priv_dispose(n);
+            n = nxt;
+         }
+         this->priv_dispose(leader);
+      }
+
+      void priv_dispose(node_ptr n)
+      {
+         BOOST_IF_CONSTEXPR(safemode_or_autounlink)
+            group_algorithms::init(n);
+         disposer_(traits_->to_value_ptr(n));
+      }
+
+      Disposer &disposer_;
+      const value_traits * const traits_;
+   };
+
+   static void priv_group_unlink(node_ptr n) BOOST_NOEXCEPT
+   {
+      const node_ptr prev(node_traits::get_previous(n));
+      const node_ptr next(node_traits::get_next(n));
+      node_traits::set_next(prev, next);
+      node_traits::set_previous(next, prev);
+   }
+
+   /// @endcond
+
+   public:
+
+   //! <b>Effects</b>: Constructs an empty container.
+   //!
+   //! <b>Complexity</b>: Constant.
+   //!
+   //! <b>Throws</b>: If value_traits::node_traits::node
+   //!   constructor throws (this does not happen with predefined Boost.Intrusive hooks)
+   //!   or the copy constructor of the key_compare object throws.
+   group_multiset_impl()
+      :  data_(key_compare(), value_traits())
+   {  this->priv_init();  }
+
+   //! <b>Effects</b>: Constructs an empty container with given comparison and traits.
+   //!
+   //! <b>Complexity</b>: Constant.
+   //!
+   //! <b>Throws</b>: If value_traits::node_traits::node
+   //!   constructor throws (this does not happen with predefined Boost.Intrusive hooks)
+   //!   or the copy constructor of the key_compare object throws.
+   explicit group_multiset_impl( const key_compare &cmp, const value_traits &v_traits = value_traits())
+      :  data_(cmp, v_traits)
+   {  this->priv_init();  }
+
+   //! <b>Requires</b>: Dereferencing iterator must yield an lvalue of type value_type.
+   //!   cmp must be a comparison function that induces a strict weak ordering.
+   //!
+   //! <b>Effects</b>: Constructs an empty container and inserts elements from
+   //!   [b, e).
+   //!
+   //! <b>Complexity</b>: N*log(N), where N is the distance between first and last.
+   //!
+   //! <b>Throws</b>: If value_traits::node_traits::node
+   //!   constructor throws (this does not happen with predefined Boost.Intrusive hooks)
+   //!   or the copy constructor/operator() of the key_compare object throws. Basic guarantee.
+   template<class Iterator>
+   group_multiset_impl( Iterator b, Iterator e
+                      , const key_compare &cmp     = key_compare()
+                      , const value_traits &v_traits = value_traits())
+      :  data_(cmp, v_traits)
+   {
+      this->priv_init();
+      this->insert(b, e);
+   }
+
+   //! <b>Effects</b>: Constructs a container moving resources from another container.
+   //!   Internal comparison object and value traits are move constructed and
+   //!   nodes belonging to x (except the node representing the "end") are linked to *this.
+   //!
+   //! <b>Complexity</b>: Constant.
+   //!
+   //! <b>Throws</b>: If value_traits::node_traits::node's
+   //!   move constructor throws (this does not happen with predefined Boost.Intrusive hooks)
+   //!   or the move constructor of the comparison objet throws.
+   group_multiset_impl(BOOST_RV_REF(group_multiset_impl) x)
+      :  data_(x.key_comp(), x.priv_value_traits())
+   {
+      this->priv_init();
+      this->swap(x);
+   }
+
+   //! <b>Effects</b>: Equivalent to swap
+   //!
+   inline group_multiset_impl& operator=(BOOST_RV_REF(group_multiset_impl) x)
+   {  this->swap(x); return *this;  }
+
+   //! <b>Effects</b>: Detaches all elements from this. The objects in the set
+   //!   are not deleted (i.e. no destructors are called), but the nodes according to
+   //!   the value_traits template parameter are reinitialized and thus can be reused.
+   //!
+   //! <b>Complexity</b>: Linear to elements contained in *this.
+   //!
+   //! <b>Throws</b>: Nothing.
+   ~group_multiset_impl()
+   {
+      BOOST_IF_CONSTEXPR(safemode_or_autounlink){
+         this->clear();
+      }
+   }
+
+   //! <b>Effects</b>: Returns an iterator pointing to the beginning of the container.
+   //!
+   //! <b>Complexity</b>: Constant.
+   //!
+   //! <b>Throws</b>: Nothing.
+   inline iterator begin() BOOST_NOEXCEPT
+   {  return iterator(node_algorithms::begin_node(this->header_ptr()), this->priv_value_traits_ptr());   }
+
+   //! <b>Effects</b>: Returns a const_iterator pointing to the beginning of the container.
+   //!
+   //! <b>Complexity</b>: Constant.
+   //!
+   //! <b>Throws</b>: Nothing.
+   inline const_iterator begin() const BOOST_NOEXCEPT
+   {  return this->cbegin();   }
+
+   //! <b>Effects</b>: Returns a const_iterator pointing to the beginning of the container.
+   //!
+   //! <b>Complexity</b>: Constant.
+   //!
+   //! <b>Throws</b>: Nothing.
+   inline const_iterator cbegin() const BOOST_NOEXCEPT
+   {  return const_iterator(node_algorithms::begin_node(this->header_ptr()), this->priv_value_traits_ptr());   }
+
+   //! <b>Effects</b>: Returns an iterator pointing to the end of the container.
+   //!
+   //! <b>Complexity</b>: Constant.
+   //!
+   //! <b>Throws</b>: Nothing.
+   inline iterator end() BOOST_NOEXCEPT
+   {  return iterator(node_algorithms::end_node(this->header_ptr()), this->priv_value_traits_ptr());   }
+
+   //! <b>Effects</b>: Returns a const_iterator pointing to the end of the container.
+   //!
+   //! <b>Complexity</b>: Constant.
+   //!
+   //! <b>Throws</b>: Nothing.
+   inline const_iterator end() const BOOST_NOEXCEPT
+   {  return this->cend();  }
+
+   //! <b>Effects</b>: Returns a const_iterator pointing to the end of the container.
+   //!
+   //! <b>Complexity</b>: Constant.
+   //!
+   //! <b>Throws</b>: Nothing.
+   inline const_iterator cend() const BOOST_NOEXCEPT
+   {  return const_iterator(node_algorithms::end_node(this->header_ptr()), this->priv_value_traits_ptr());   }
+
+   //! <b>Effects</b>: Returns a reverse_iterator pointing to the beginning of the
+   //!    reversed container.
+   //!
+   //! <b>Complexity</b>: Constant.
+   //!
+   //! <b>Throws</b>: Nothing.
+   inline reverse_iterator rbegin() BOOST_NOEXCEPT
+   {  return reverse_iterator(this->end());  }
+
+   //! <b>Effects</b>: Returns a const_reverse_iterator pointing to the beginning
+   //!    of the reversed container.
+   //!
+   //! <b>Complexity</b>: Constant.
+   //!
+   //! <b>Throws</b>: Nothing.
+   inline const_reverse_iterator rbegin() const BOOST_NOEXCEPT
+   {  return const_reverse_iterator(this->end());  }
+
+   //! <b>Effects</b>: Returns a const_reverse_iterator pointing to the beginning
+   //!    of the reversed container.
+   //!
+   //! <b>Complexity</b>: Constant.
+   //!
+   //! <b>Throws</b>: Nothing.
+   inline const_reverse_iterator crbegin() const BOOST_NOEXCEPT
+   {  return const_reverse_iterator(this->end());  }
+
+   //! <b>Effects</b>: Returns a reverse_iterator pointing to the end
+   //!    of the reversed container.
+   //!
+   //! <b>Complexity</b>: Constant.
+   //!
+   //! <b>Throws</b>: Nothing.
+   inline reverse_iterator rend() BOOST_NOEXCEPT
+   {  return reverse_iterator(this->begin());   }
+
+   //! <b>Effects</b>: Returns a const_reverse_iterator pointing to the end
+   //!    of the reversed container.
+   //!
+   //! <b>Complexity</b>: Constant.
+   //!
+   //! <b>Throws</b>: Nothing.
+   inline const_reverse_iterator rend() const BOOST_NOEXCEPT
+   {  return const_reverse_iterator(this->begin());   }
+
+   //! <b>Effects</b>: Returns a const_reverse_iterator pointing to the end
+   //!    of the reversed container.
+   //!
+   //! <b>Complexity</b>: Constant.
+   //!
+   //! <b>Throws</b>: Nothing.
+   inline const_reverse_iterator crend() const BOOST_NOEXCEPT
+   {  return const_reverse_iterator(this->begin());   }
+
+   //! <b>Precondition</b>: end_iterator must be a valid end iterator
+   //!   of the container.
+   //!
+   //! <b>Effects</b>: Returns a reference to the container associated to the end iterator
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   BOOST_INTRUSIVE_NO_DANGLING
+   inline static group_multiset_impl &container_from_end_iterator(iterator end_iterator) BOOST_NOEXCEPT
+   {  return priv_container_from_end_iterator(end_iterator);   }
+
+   //! <b>Precondition</b>: end_iterator must be a valid end const_iterator
+   //!   of the container.
+   //!
+   //! <b>Effects</b>: Returns a const reference to the container associated to the end iterator
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   BOOST_INTRUSIVE_NO_DANGLING
+   inline static const group_multiset_impl &container_from_end_iterator(const_iterator end_iterator) BOOST_NOEXCEPT
+   {  return priv_container_from_end_iterator(end_iterator);   }
+
+   //! <b>Effects</b>: Returns the key_compare object used by the container.
+   //!
+   //! <b>Complexity</b>: Constant.
+   //!
+   //! <b>Throws</b>: If key_compare copy-constructor throws.
+   inline key_compare key_comp() const
+   {  return this->priv_comp().key_comp();   }
+
+   //! <b>Effects</b>: Returns the value_compare object used by the container.
+   //!
+   //! <b>Complexity</b>: Constant.
+   //!
+   //! <b>Throws</b>: If value_compare copy-constructor throws.
+   inline value_compare value_comp() const
+   {  return this->priv_comp();   }
+
+   //! <b>Effects</b>: Returns true if the container is empty.
+   //!
+   //! <b>Complexity</b>: Constant.
+   //!
+   //! <b>Throws</b>: Nothing.
+   inline bool empty() const BOOST_NOEXCEPT
+   {  return !node_traits::get_parent(this->header_ptr());  }
+
+   //! <b>Effects</b>: Returns the number of elements stored in the container.
+   //!
+   //! <b>Complexity</b>: Linear to elements contained in *this
+   //!   if constant-time size option is disabled. Constant time otherwise.
+   //!
+   //! <b>Throws</b>: Nothing.
+   size_type size() const BOOST_NOEXCEPT
+   {
+      BOOST_IF_CONSTEXPR(constant_time_size)
+         return this->priv_size_traits().get_size();
+      else{
+         size_type n = 0;
+         for(const_iterator b(this->cbegin()), e(this->cend()); b != e; ++b)
+            ++n;
+         return n;
+      }
+   }
+
+   //! <b>Effects</b>: Swaps the contents of two containers.
+   //!
+   //! <b>Complexity</b>: Constant.
+   //!
+   //! <b>Throws</b>: If the comparison functor's swap call throws.
+   void swap(group_multiset_impl& other)
+   {
+      //This can throw
+      ::boost::adl_move_swap(this->priv_comp(), other.priv_comp());
+      //These can't throw
+      node_algorithms::swap_tree(this->header_ptr(), other.header_ptr());
+      this->priv_size_traits().swap(other.priv_size_traits());
+   }
+
+   //! <b>Requires</b>: Disposer::operator()(pointer) shouldn't throw.
+   //!   Cloner should yield to nodes equivalent to the original nodes.
+   //!
+   //! <b>Effects</b>: Erases all the elements from *this
+   //!   calling Disposer::operator()(pointer), clones all the
+   //!   elements from src calling Cloner::operator()(const_reference )
+   //!   and inserts them on *this. Copies the predicate from the source container.
+   //!
+   //!   If cloner throws, all cloned elements are unlinked and disposed
+   //!   calling Disposer::operator()(pointer).
+   //!
+   //! <b>Complexity</b>: Linear to erased elements plus N*log(D) for the N inserted
+   //!   elements with D distinct keys.
+   //!
+   //! <b>Throws</b>: If cloner throws or predicate copy assignment throws. Basic guarantee.
+   template <class Cloner, class Disposer>
+   void clone_from(const group_multiset_impl &src, Cloner cloner, Disposer disposer)
+   {
+      this->clear_and_dispose(disposer);
+      if(!src.empty()){
+         this->priv_comp() = src.priv_comp();
+         BOOST_INTRUSIVE_TRY{
+            for(const_iterator b(src.cbegin()), e(src.cend()); b != e; ++b)
+               this->insert(*cloner(*b));
+         }
+         BOOST_INTRUSIVE_CATCH(...){
+            this->clear_and_dispose(disposer);
+            BOOST_INTRUSIVE_RETHROW;
+         }
+         BOOST_INTRUSIVE_CATCH_END
+      }
+   }
+
+   //! <b>Requires</b>: Disposer::operator()(pointer) shouldn't throw.
+   //!   Cloner should yield to nodes equivalent to the original nodes.
+   //!
+   //! <b>Effects</b>: Erases all the elements from *this
+   //!   calling Disposer::operator()(pointer), clones all the
+   //!   elements from src calling Cloner::operator()(reference)
+   //!   and inserts them on *this. Copies the predicate from the source container.
+   //!
+   //!   If cloner throws, all cloned elements are unlinked and disposed
+   //!   calling Disposer::operator()(pointer).
+   //!
+   //! <b>Complexity</b>: Linear to erased elements plus N*log(D) for the N inserted
+   //!   elements with D distinct keys.
+   //!
+   //! <b>Throws</b>: If cloner throws or predicate copy assignment throws. Basic guarantee.
+   //!
+   //! <b>Note</b>: This version can modify the source container, useful to implement
+   //!    move semantics.
+   template <class Cloner, class Disposer>
+   void clone_from(BOOST_RV_REF(group_multiset_impl) src, Cloner cloner, Disposer disposer)
+   {
+      this->clear_and_dispose(disposer);
+      if(!src.empty()){
+         this->priv_comp() = src.priv_comp();
+         BOOST_INTRUSIVE_TRY{
+            for(iterator b(src.begin()), e(src.end()); b != e; ++b)
+               this->insert(*cloner(*b));
+         }
+         BOOST_INTRUSIVE_CATCH(...){
+            this->clear_and_dispose(disposer);
+            BOOST_INTRUSIVE_RETHROW;
+         }
+         BOOST_INTRUSIVE_CATCH_END
+      }
+   }
+
+   //! <b>Requires</b>: value must be an lvalue
+   //!
+   //! <b>Effects</b>: Inserts value into the container after the elements
+   //!   with equivalent keys.
+   //!
+   //! <b>Complexity</b>: Logarithmic to the number of distinct keys.
+   //!
+   //! <b>Throws</b>: If the internal key_compare ordering function throws. Strong guarantee.
+   //!
+   //! <b>Note</b>: Does not affect the validity of iterators and references.
+   //!   No copy-constructors are called.
+   iterator insert(reference value)
+   {
+      node_ptr to_insert(this->priv_value_traits().to_node_ptr(value));
+      BOOST_INTRUSIVE_SAFE_HOOK_DEFAULT_ASSERT(!safemode_or_autounlink || group_algorithms::unique(to_insert));
+      typename node_algorithms::insert_commit_data commit_data;
+      const std::pair<node_ptr, bool> ret = node_algorithms::insert_unique_check
+         (this->header_ptr(), key_of_value()(value), this->priv_node_comp(), commit_data);
+      if(ret.second){
+         //New key: the element leads its own group
+         node_algorithms::insert_unique_commit(this->header_ptr(), to_insert, commit_data);
+         node_traits::set_next(to_insert, to_insert);
+         node_traits::set_previous(to_insert, to_insert);
+      }
+      else{
+         //Equivalent key: link as the last element of the group
+         const node_ptr leader(ret.first);
+         const node_ptr last(node_traits::get_previous(leader));
+         node_traits::set_parent(to_insert, node_ptr());
+         node_traits::set_left(to_insert, node_ptr());
+         node_traits::set_right(to_insert, node_ptr());
+         node_traits::set_next(to_insert, leader);
+         node_traits::set_previous(to_insert, last);
+         node_traits::set_next(last, to_insert);
+         node_traits::set_previous(leader, to_insert);
+      }
+      this->priv_size_traits().increment();
+      return iterator(to_insert, this->priv_value_traits_ptr());
+   }
+
+   //! <b>Requires</b>: value must be an lvalue
+   //!
+   //! <b>Effects</b>: Inserts x into the container. The hint is ignored.
+   //!
+   //! <b>Complexity</b>: Logarithmic to the number of distinct keys.
+   //!
+   //! <b>Throws</b>: If the internal key_compare ordering function throws. Strong guarantee.
+   //!
+   //! <b>Note</b>: Does not affect the validity of iterators and references.
+   //!   No copy-constructors are called.
+   inline iterator insert(const_iterator, reference value)
+   {  return this->insert(value);  }
+
+   //! <b>Requires</b>: Dereferencing iterator must yield an lvalue
+   //!   of type value_type.
+   //!
+   //! <b>Effects</b>: Inserts each element of a range into the container.
+   //!
+   //! <b>Complexity</b>: N log(D), where N is the distance between b and e
+   //!   and D the number of distinct keys.
+   //!
+   //! <b>Throws</b>: If the internal key_compare ordering function throws. Basic guarantee.
+   //!
+   //! <b>Note</b>: Does not affect the validity of iterators and references.
+   //!   No copy-constructors are called.
+   template<class Iterator>
+   void insert(Iterator b, Iterator e)
+   {
+      for (; b != e; ++b)
+         this->insert(*b);
+   }
+
+   //! <b>Effects</b>: Erases the element pointed to by i.
+   //!
+   //! <b>Complexity</b>: Constant if the element is not the only element of its key.
+   //!   Amortized constant time otherwise (rebalancing).
+   //!
+   //! <b>Returns</b>: An iterator to the element after the erased element.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Note</b>: Invalidates the iterators (but not the references)
+   //!    to the erased elements. No destructors are called.
+   iterator erase(const_iterator i) BOOST_NOEXCEPT
+   {
+      const_iterator ret(i);
+      ++ret;
+      node_ptr to_erase(i.pointed_node());
+      BOOST_INTRUSIVE_SAFE_HOOK_DEFAULT_ASSERT(!safemode_or_autounlink || !group_algorithms::unique(to_erase));
+      if(!node_traits::get_parent(to_erase)){
+         //Not a leader, just unlink it from its group
+         priv_group_unlink(to_erase);
+      }
+      else if(node_traits::get_next(to_erase) == to_erase){
+         //The last element of the key, remove it from the tree
+         node_algorithms::erase(this->header_ptr(), to_erase);
+      }
+      else{
+         //The next element of the group becomes the new leader
+         const node_ptr new_leader(node_traits::get_next(to_erase));
+         priv_group_unlink(to_erase);
+         node_algorithms::replace_node(to_erase, this->header_ptr(), new_leader);
+      }
+      this->priv_size_traits().decrement();
+      BOOST_IF_CONSTEXPR(safemode_or_autounlink)
+         group_algorithms::init(to_erase);
+      return ret.unconst();
+   }
+
+   //! <b>Effects</b>: Erases the range pointed to by b end e.
+   //!
+   //! <b>Complexity</b>: Amortized O(N), where N is the number of elements in the range.
+   //!
+   //! <b>Returns</b>: An iterator to the element after the erased elements.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Note</b>: Invalidates the iterators (but not the references)
+   //!    to the erased elements. No destructors are called.
+   iterator erase(const_iterator b, const_iterator e) BOOST_NOEXCEPT
+   {
+      while(b != e)
+         b = this->erase(b);
+      return b.unconst();
+   }
+
+   //! <b>Effects</b>: Erases all the elements with the given key.
+   //!
+   //! <b>Returns</b>: The number of erased elements.
+   //!
+   //! <b>Complexity</b>: O(log(D) + N), where D is the number of distinct keys
+   //!   and N the number of elements with the given key.
+   //!
+   //! <b>Throws</b>: If the internal key_compare ordering function throws.
+   //!
+   //! <b>Note</b>: Invalidates the iterators (but not the references)
+   //!    to the erased elements. No destructors are called.
+   inline size_type erase(const key_type &key)
+   {  return this->erase(key, this->key_comp());   }
+
+   //! <b>Requires</b>: key is a value such that `*this` is partitioned with respect to
+   //!   comp(nk, key) and !comp(key, nk), with comp(nk, key) implying !comp(key, nk),
+   //!   with nk the key_type of a value_type inserted into `*this`.
+   //!
+   //! <b>Effects</b>: Erases all the elements with the given key.
+   //!
+   //! <b>Returns</b>: The number of erased elements.
+   //!
+   //! <b>Complexity</b>: O(log(D) + N), where D is the number of distinct keys
+   //!   and N the number of elements with the given key.
+   //!
+   //! <b>Throws</b>: If comp or the internal key_compare ordering function throws.
+   //!
+   //! <b>Note</b>: Invalidates the iterators (but not the references)
+   //!    to the erased elements. No destructors are called.
+   template<class KeyType, class KeyTypeKeyCompare>
+   BOOST_INTRUSIVE_DOC1ST(size_type
+      , typename detail::disable_if_convertible<KeyTypeKeyCompare BOOST_INTRUSIVE_I const_iterator BOOST_INTRUSIVE_I size_type>::type)
+      erase(const KeyType& key, KeyTypeKeyCompare comp)
+   {  return this->erase_and_dispose(key, comp, detail::null_disposer());  }
+
+   //! <b>Requires</b>: Disposer::operator()(pointer) shouldn't throw.
+   //!
+   //! <b>Effects</b>: Erases the element pointed to by i.
+   //!   Disposer::operator()(pointer) is called for the removed element.
+   //!
+   //! <b>Complexity</b>: Constant if the element is not the only element of its key.
+   //!   Amortized constant time otherwise (rebalancing).
+   //!
+   //! <b>Returns</b>: An iterator to the element after the erased element.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Note</b>: Invalidates the iterators
+   //!    to the erased elements.
+   template<class Disposer>
+   iterator erase_and_dispose(const_iterator i, Disposer disposer) BOOST_NOEXCEPT
+   {
+      node_ptr to_erase(i.pointed_node());
+      iterator ret(this->erase(i));
+      disposer(this->priv_value_traits().to_value_ptr(to_erase));
+      return ret;
+   }
+
+   //! <b>Requires</b>: Disposer::operator()(pointer) shouldn't throw.
+   //!
+   //! <b>Effects</b>: Erases the range pointed to by b end e.
+   //!   Disposer::operator()(pointer) is called for the removed elements.
+   //!
+   //! <b>Complexity</b>: Amortized O(N), where N is the number of elements in the range.
+   //!
+   //! <b>Returns</b>: An iterator to the element after the erased elements.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Note</b>: Invalidates the iterators
+   //!    to the erased elements.
+   template<class Disposer>
+   iterator erase_and_dispose(const_iterator b, const_iterator e, Disposer disposer) BOOST_NOEXCEPT
+   {
+      while(b != e)
+         b = this->erase_and_dispose(b, disposer);
+      return b.unconst();
+   }
+
+   //! <b>Requires</b>: Disposer::operator()(pointer) shouldn't throw.
+   //!
+   //! <b>Effects</b>: Erases all the elements with the given key.
+   //!   Disposer::operator()(pointer) is called for the removed elements.
+   //!
+   //! <b>Returns</b>: The number of erased elements.
+   //!
+   //! <b>Complexity</b>: O(log(D) + N), where D is the number of distinct keys
+   //!   and N the number of elements with the given key.
+   //!
+   //! <b>Throws</b>: If the internal key_compare ordering function throws.
+   //!
+   //! <b>Note</b>: Invalidates the iterators
+   //!    to the erased elements.
+   template<class Disposer>
+   inline size_type erase_and_dispose(const key_type &key, Disposer disposer)
+   {  return this->erase_and_dispose(key, this->key_comp(), disposer);   }
+
+   //! <b>Requires</b>: key is a value such that `*this` is partitioned with respect to
+   //!   comp(nk, key) and !comp(key, nk), with comp(nk, key) implying !comp(key, nk),
+   //!   with nk the key_type of a value_type inserted into `*this`.
+   //!
+   //!   Disposer::operator()(pointer) shouldn't throw.
+   //!
+   //! <b>Effects</b>: Erases all the elements with the given key.
+   //!   Disposer::operator()(pointer) is called for the removed elements.
+   //!
+   //! <b>Returns</b>: The number of erased elements.
+   //!
+   //! <b>Complexity</b>: O(log(D) + N), where D is the number of distinct keys
+   //!   and N the number of elements with the given key.
+   //!
+   //! <b>Throws</b>: If comp or the internal key_compare ordering function throws.
+   //!
+   //! <b>Note</b>: Invalidates the iterators
+   //!    to the erased elements.
+   template<class KeyType, class KeyTypeKeyCompare, class Disposer>
+   BOOST_INTRUSIVE_DOC1ST(size_type
+      , typename detail::disable_if_convertible<KeyTypeKeyCompare BOOST_INTRUSIVE_I const_iterator BOOST_INTRUSIVE_I size_type>::type)
+      erase_and_dispose(const KeyType& key, KeyTypeKeyCompare comp, Disposer disposer)
+   {
+      const node_ptr leader(node_algorithms::find(this->header_ptr(), key, this->key_node_comp(comp)));
+      if(leader == this->header_ptr())
+         return size_type(0);
+      size_type n = 1;
+      for(node_ptr p(node_traits::get_next(leader)); p != leader; p = node_traits::get_next(p))
+         ++n;
+      //Unlink the whole group with a single tree erasure
+      node_algorithms::erase(this->header_ptr(), leader);
+      this->priv_size_traits().decrease(n);
+      group_disposer<Disposer>(disposer, &this->priv_value_traits())(leader);
+      return n;
+   }
+
+   //! <b>Effects</b>: Erases all of the elements.
+   //!
+   //! <b>Complexity</b>: Linear to the number of elements on the container
+   //!   if it's a safe-mode hook. Constant time otherwise.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Note</b>: Invalidates the iterators (but not the references)
+   //!    to the erased elements. No destructors are called.
+   void clear() BOOST_NOEXCEPT
+   {
+      BOOST_IF_CONSTEXPR(safemode_or_autounlink){
+         this->clear_and_dispose(detail::null_disposer());
+      }
+      else{
+         this->priv_init();
+      }
+   }
+
+   //! <b>Requires</b>: Disposer::operator()(pointer) shouldn't throw.
+   //!
+   //! <b>Effects</b>: Erases all of the elements calling disposer(p) for
+   //!   each node to be erased.
+   //!
+   //! <b>Complexity</b>: Linear to the number of elements on the container.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Note</b>: Invalidates the iterators (but not the references)
+   //!    to the erased elements. Calls N times to disposer functor.
+   template<class Disposer>
+   void clear_and_dispose(Disposer disposer) BOOST_NOEXCEPT
+   {
+      node_algorithms::clear_and_dispose(this->header_ptr()
+         , group_disposer<Disposer>(disposer, &this->priv_value_traits()));
+      this->priv_size_traits().set_size(size_type(0));
+   }
+
+   //! <b>Effects</b>: Returns the number of contained elements with the given key
+   //!
+   //! <b>Complexity</b>: O(log(D) + N), where D is the number of distinct keys
+   //!   and N the number of elements with the given key.
+   //!
+   //! <b>Throws</b>: If `key_compare` throws.
+   inline size_type count(const key_type &key) const
+   {  return this->count(key, this->key_comp());  }
+
+   //! <b>Requires</b>: key is a value such that `*this` is partitioned with respect to
+   //!   comp(nk, key) and !comp(key, nk), with comp(nk, key) implying !comp(key, nk),
+   //!   with nk the key_type of a value_type inserted into `*this`.
+   //!
+   //! <b>Effects</b>: Returns the number of contained elements with the given key
+   //!
+   //! <b>Complexity</b>: O(log(D) + N), where D is the number of distinct keys
+   //!   and N the number of elements with the given key.
+   //!
+   //! <b>Throws</b>: If `comp` throws.
+   template<class KeyType, class KeyTypeKeyCompare>
+   size_type count(const KeyType &key, KeyTypeKeyCompare comp) const
+   {
+      const node_ptr leader(node_algorithms::find(this->header_ptr(), key, this->key_node_comp(comp)));
+      if(leader == this->header_ptr())
+         return size_type(0);
+      size_type n = 1;
+      for(node_ptr p(node_traits::get_next(leader)); p != leader; p = node_traits::get_next(p))
+         ++n;
+      return n;
+   }
+
+   //! <b>Effects</b>: Returns true if an element with the given key exists.
+   //!
+   //! <b>Complexity</b>: Logarithmic to the number of distinct keys.
+   //!
+   //! <b>Throws</b>: If `key_compare` throws.
+   inline bool contains(const key_type &key) const
+   {  return this->find(key) != this->cend();  }
+
+   //! <b>Requires</b>: key is a value such that `*this` is partitioned with respect to
+   //!   comp(nk, key) and !comp(key, nk), with comp(nk, key) implying !comp(key, nk),
+   //!   with nk the key_type of a value_type inserted into `*this`.
+   //!
+   //! <b>Effects</b>: Returns true if an element with the given key exists.
+   //!
+   //! <b>Complexity</b>: Logarithmic to the number of distinct keys.
+   //!
+   //! <b>Throws</b>: If `comp` throws.
+   template<class KeyType, class KeyTypeKeyCompare>
+   inline bool contains(const KeyType &key, KeyTypeKeyCompare comp) const
+   {  return this->find(key, comp) != this->cend();  }
+
+   //! <b>Effects</b>: Returns an iterator to the first element whose
+   //!   key is not less than k or end() if that element does not exist.
+   //!
+   //! <b>Complexity</b>: Logarithmic to the number of distinct keys.
+   //!
+   //! <b>Throws</b>: If `key_compare` throws.
+   inline iterator lower_bound(const key_type &key)
+   {  return this->lower_bound(key, this->key_comp());   }
+
+   //! <b>Effects</b>: Returns a const iterator to the first element whose
+   //!   key is not less than k or end() if that element does not exist.
+   //!
+   //! <b>Complexity</b>: Logarithmic to the number of distinct keys.
+   //!
+   //! <b>Throws</b>: If `key_compare` throws.
+   inline const_iterator lower_bound(const key_type &key) const
+   {  return this->lower_bound(key, this->key_comp());   }
+
+   //! <b>Requires</b>: key is a value such that `*this` is partitioned with respect to
+   //!   comp(nk, key), with nk the key_type of a value_type inserted into `*this`.
+   //!
+   //! <b>Effects</b>: Returns an iterator to the first element whose
+   //!   key is not less than k or end() if that element does not exist.
+   //!
+   //! <b>Complexity</b>: Logarithmic to the number of distinct keys.
+   //!
+   //! <b>Throws</b>: If `comp` throws.
+   template<class KeyType, class KeyTypeKeyCompare>
+   iterator lower_bound(const KeyType &key, KeyTypeKeyCompare comp)
+   {
+      return iterator(node_algorithms::lower_bound
+         (this->header_ptr(), key, this->key_node_comp(comp)), this->priv_value_traits_ptr());
+   }
+
+   //! @copydoc ::boost::intrusive::group_multiset_impl::lower_bound(const KeyType&,KeyTypeKeyCompare)
+   template<class KeyType, class KeyTypeKeyCompare>
+   const_iterator lower_bound(const KeyType &key, KeyTypeKeyCompare comp) const
+   {
+      return const_iterator(node_algorithms::lower_bound
+         (this->header_ptr(), key, this->key_node_comp(comp)), this->priv_value_traits_ptr());
+   }
+
+   //! <b>Effects</b>: Returns an iterator to the first element whose
+   //!   key is greater than k or end() if that element does not exist.
+   //!
+   //! <b>Complexity</b>: Logarithmic to the number of distinct keys.
+   //!
+   //! <b>Throws</b>: If `key_compare` throws.
+   inline iterator upper_bound(const key_type &key)
+   {  return this->upper_bound(key, this->key_comp());   }
+
+   //! <b>Effects</b>: Returns a const iterator to the first element whose
+   //!   key is greater than k or end() if that element does not exist.
+   //!
+   //! <b>Complexity</b>: Logarithmic to the number of distinct keys.
+   //!
+   //! <b>Throws</b>: If `key_compare` throws.
+   inline const_iterator upper_bound(const key_type &key) const
+   {  return this->upper_bound(key, this->key_comp());   }
+
+   //! <b>Requires</b>: key is a value such that `*this` is partitioned with respect to
+   //!   !comp(key, nk), with nk the key_type of a value_type inserted into `*this`.
+   //!
+   //! <b>Effects</b>: Returns an iterator to the first element whose
+   //!   key is greater than k according to comp or end() if that element
+   //!   does not exist.
+   //!
+   //! <b>Complexity</b>: Logarithmic to the number of distinct keys.
+   //!
+   //! <b>Throws</b>: If `comp` throws.
+   template<class KeyType, class KeyTypeKeyCompare>
+   iterator upper_bound(const KeyType &key, KeyTypeKeyCompare comp)
+   {
+      return iterator(node_algorithms::upper_bound
+         (this->header_ptr(), key, this->key_node_comp(comp)), this->priv_value_traits_ptr());
+   }
+
+   //! @copydoc ::boost::intrusive::group_multiset_impl::upper_bound(const KeyType&,KeyTypeKeyCompare)
+   template<class KeyType, class KeyTypeKeyCompare>
+   const_iterator upper_bound(const KeyType &key, KeyTypeKeyCompare comp) const
+   {
+      return const_iterator(node_algorithms::upper_bound
+         (this->header_ptr(), key, this->key_node_comp(comp)), this->priv_value_traits_ptr());
+   }
+
+   //! <b>Effects</b>: Finds an iterator to the first element whose key is
+   //!   k or end() if that element does not exist.
+   //!
+   //! <b>Complexity</b>: Logarithmic to the number of distinct keys.
+   //!
+   //! <b>Throws</b>: If `key_compare` throws.
+   inline iterator find(const key_type &key)
+   {  return this->find(key, this->key_comp()); }
+
+   //! <b>Effects</b>: Finds a const_iterator to the first element whose key is
+   //!   k or end() if that element does not exist.
+   //!
+   //! <b>Complexity</b>: Logarithmic to the number of distinct keys.
+   //!
+   //! <b>Throws</b>: If `key_compare` throws.
+   inline const_iterator find(const key_type &key) const
+   {  return this->find(key, this->key_comp()); }
+
+   //! <b>Requires</b>: key is a value such that `*this` is partitioned with respect to
+   //!   comp(nk, key) and !comp(key, nk), with comp(nk, key) implying !comp(key, nk),
+   //!   with nk the key_type of a value_type inserted into `*this`.
+   //!
+   //! <b>Effects</b>: Finds an iterator to the first element whose key is
+   //!   k or end() if that element does not exist.
+   //!
+   //! <b>Complexity</b>: Logarithmic to the number of distinct keys.
+   //!
+   //! <b>Throws</b>: If `comp` throws.
+   template<class KeyType, class KeyTypeKeyCompare>
+   iterator find(const KeyType &key, KeyTypeKeyCompare comp)
+   {
+      return iterator
+         (node_algorithms::find(this->header_ptr(), key, this->key_node_comp(comp)), this->priv_value_traits_ptr());
+   }
+
+   //! @copydoc ::boost::intrusive::group_multiset_impl::find(const KeyType&,KeyTypeKeyCompare)
+   template<class KeyType, class KeyTypeKeyCompare>
+   const_iterator find(const KeyType &key, KeyTypeKeyCompare comp) const
+   {
+      return const_iterator
+         (node_algorithms::find(this->header_ptr(), key, this->key_node_comp(comp)), this->priv_value_traits_ptr());
+   }
+
+   //! <b>Effects</b>: Finds a range containing all elements whose key is k or
+   //!   an empty range that indicates the position where those elements would be
+   //!   if there is no elements with key k.
+   //!
+   //! <b>Complexity</b>: Logarithmic to the number of distinct keys.
+   //!
+   //! <b>Throws</b>: If `key_compare` throws.
+   inline std::pair<iterator,iterator> equal_range(const key_type &key)
+   {  return this->equal_range(key, this->key_comp());   }
+
+   //! <b>Effects</b>: Finds a range containing all elements whose key is k or
+   //!   an empty range that indicates the position where those elements would be
+   //!   if there is no elements with key k.
+   //!
+   //! <b>Complexity</b>: Logarithmic to the number of distinct keys.
+   //!
+   //! <b>Throws</b>: If `key_compare` throws.
+   inline std::pair<const_iterator, const_iterator> equal_range(const key_type &key) const
+   {  return this->equal_range(key, this->key_comp());   }
+
+   //! <b>Requires</b>: key is a value such that `*this` is partitioned with respect to
+   //!   comp(nk, key) and !comp(key, nk), with comp(nk, key) implying !comp(key, nk),
+   //!   with nk the key_type of a value_type inserted into `*this`.
+   //!
+   //! <b>Effects</b>: Finds a range containing all elements whose key is k or
+   //!   an empty range that indicates the position where those elements would be
+   //!   if there is no elements with key k.
+   //!
+   //! <b>Complexity</b>: Logarithmic to the number of distinct keys.
+   //!
+   //! <b>Throws</b>: If `comp` throws.
+   template<class KeyType, class KeyTypeKeyCompare>
+   std::pair<iterator,iterator> equal_range(const KeyType &key, KeyTypeKeyCompare comp)
+   {
+      const std::pair<node_ptr, node_ptr> r(this->priv_equal_range(key, comp));
+      return std::pair<iterator,iterator>
+         (iterator(r.first, this->priv_value_traits_ptr()), iterator(r.second, this->priv_value_traits_ptr()));
+   }
+
+   //! @copydoc ::boost::intrusive::group_multiset_impl::equal_range(const KeyType&,KeyTypeKeyCompare)
+   template<class KeyType, class KeyTypeKeyCompare>
+   std::pair<const_iterator, const_iterator> equal_range(const KeyType &key, KeyTypeKeyCompare comp) const
+   {
+      const std::pair<node_ptr, node_ptr> r(this->priv_equal_range(key, comp));
+      return std::pair<const_iterator, const_iterator>
+         (const_iterator(r.first, this->priv_value_traits_ptr()), const_iterator(r.second, this->priv_value_traits_ptr()));
+   }
+
+   //! <b>Requires</b>: value must be an lvalue and shall be in a group_multiset of
+   //!   appropriate type. Otherwise the behavior is undefined.
+   //!
+   //! <b>Effects</b>: Returns: a valid iterator i belonging to the group_multiset
+   //!   that points to the value
+   //!
+   //! <b>Complexity</b>: Constant.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Note</b>: This static function is available only if the <i>value traits</i>
+   //!   is stateless.
+   static iterator s_iterator_to(reference value) BOOST_NOEXCEPT
+   {
+      BOOST_INTRUSIVE_STATIC_ASSERT((!stateful_value_traits));
+      return iterator (value_traits::to_node_ptr(value), const_value_traits_ptr());
+   }
+
+   //! <b>Requires</b>: value must be an lvalue and shall be in a group_multiset of
+   //!   appropriate type. Otherwise the behavior is undefined.
+   //!
+   //! <b>Effects</b>: Returns: a valid const_iterator i belonging to the
+   //!   group_multiset that points to the value
+   //!
+   //! <b>Complexity</b>: Constant.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Note</b>: This static function is available only if the <i>value traits</i>
+   //!   is stateless.
+   static const_iterator s_iterator_to(const_reference value) BOOST_NOEXCEPT
+   {
+      BOOST_INTRUSIVE_STATIC_ASSERT((!stateful_value_traits));
+      return const_iterator (value_traits::to_node_ptr(*pointer_traits<pointer>::const_cast_from(pointer_traits<const_pointer>::pointer_to(value))), const_value_traits_ptr());
+   }
+
+   //! <b>Requires</b>: value must be an lvalue and shall be in a group_multiset of
+   //!   appropriate type. Otherwise the behavior is undefined.
+   //!
+   //! <b>Effects</b>: Returns: a valid iterator i belonging to the group_multiset
+   //!   that points to the value
+   //!
+   //! <b>Complexity</b>: Constant.
+   //!
+   //! <b>Throws</b>: Nothing.
+   iterator iterator_to(reference value) BOOST_NOEXCEPT
+   {  return iterator (this->priv_value_traits().to_node_ptr(value), this->priv_value_traits_ptr()); }
+
+   //! <b>Requires</b>: value must be an lvalue and shall be in a group_multiset of
+   //!   appropriate type. Otherwise the behavior is undefined.
+   //!
+   //! <b>Effects</b>: Returns: a valid const_iterator i belonging to the
+   //!   group_multiset that points to the value
+   //!
+   //! <b>Complexity</b>: Constant.
+   //!
+   //! <b>Throws</b>: Nothing.
+   const_iterator iterator_to(const_reference value) const BOOST_NOEXCEPT
+   {  return const_iterator (this->priv_value_traits().to_node_ptr(*pointer_traits<pointer>::const_cast_from(pointer_traits<const_pointer>::pointer_to(value))), this->priv_value_traits_ptr()); }
+
+   //! <b>Requires</b>: value shall not be in a container.
+   //!
+   //! <b>Effects</b>: init_node puts the hook of a value in a well-known default
+   //!   state.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant time.
+   //!
+   //! <b>Note</b>: This function puts the hook in the well-known default state
+   //!   used by safe hooks.
+   inline static void init_node(reference value) BOOST_NOEXCEPT
+   { group_algorithms::init(value_traits::to_node_ptr(value)); }
+
+   //! <b>Effects</b>: Asserts the integrity of the container: ordering of the
+   //!   tree, keys and links of the groups and the stored size.
+   //!
+   //! <b>Complexity</b>: Linear time.
+   //!
+   //! <b>Note</b>: The method has no effect when asserts are turned off (e.g., with NDEBUG).
+   //!   Only for debugging purposes.
+   void check() const
+   {
+      const node_comp_t comp(this->priv_node_comp());
+      const node_ptr header(detail::uncast(this->header_ptr()));
+      std::size_t n = 0;
+      node_ptr prev_leader = node_ptr();
+      for(node_ptr leader(node_algorithms::begin_node(header)); leader != header; leader = node_algorithms::next_node(leader)){
+         BOOST_INTRUSIVE_INVARIANT_ASSERT(!prev_leader || comp(prev_leader, leader));
+         BOOST_INTRUSIVE_INVARIANT_ASSERT(node_traits::get_next(node_traits::get_previous(leader)) == leader);
+         ++n;
+         for(node_ptr p(node_traits::get_next(leader)); p != leader; p = node_traits::get_next(p)){
+            BOOST_INTRUSIVE_INVARIANT_ASSERT(!node_traits::get_parent(p));
+            BOOST_INTRUSIVE_INVARIANT_ASSERT(node_traits::get_previous(node_traits::get_next(p)) == p);
+            BOOST_INTRUSIVE_INVARIANT_ASSERT(!comp(leader, p) && !comp(p, leader));
+            ++n;
+         }
+         prev_leader = leader;
+      }
+      BOOST_INTRUSIVE_INVARIANT_ASSERT(!constant_time_size || n == this->size());
+      (void)n;
+   }
+
+   /// @cond
+   private:
+   template<class KeyType, class KeyTypeKeyCompare>
+   std::pair<node_ptr, node_ptr> priv_equal_range(const KeyType &key, KeyTypeKeyCompare comp) const
+   {
+      const node_ptr lb(node_algorithms::lower_bound
+         (this->header_ptr(), key, this->key_node_comp(comp)));
+      const node_ptr header(detail::uncast(this->header_ptr()));
+      //Leaders are unique, so the group ends at the next leader
+      node_ptr ub(lb);
+      if(ub != header && !this->key_node_comp(comp)(key, ub))
+         ub = node_algorithms::next_node(ub);
+      return std::pair<node_ptr, node_ptr>(lb, ub);
+   }
+
+   static group_multiset_impl &priv_container_from_end_iterator(const const_iterator &end_iterator) BOOST_NOEXCEPT
+   {
+      BOOST_INTRUSIVE_STATIC_ASSERT((has_container_from_iterator));
+      node_ptr p = end_iterator.pointed_node();
+      header_holder_type* h = header_holder_type::get_holder(p);
+      root_plus_size* r = detail::parent_from_member
+         < root_plus_size, header_holder_type>(h, &root_plus_size::m_header);
+      data_t *d = detail::parent_from_member<data_t, root_plus_size>
+         ( r, &data_t::root_plus_size_);
+      group_multiset_impl *s  = detail::parent_from_member<group_multiset_impl, data_t>(d, &group_multiset_impl::data_);
+      return *s;
+   }
+   /// @endcond
+};
+
+/// @cond
+
+#if !defined(BOOST_INTRUSIVE_VARIADIC_TEMPLATES)
+template<class T, algo_types AlgoType, class O1, class O2, class O3, class O4, class O5, class O6>
+#else
+template<class T, algo_types AlgoType, class ...Options>
+#endif
+struct make_group_multiset_impl
+{
+   typedef typename pack_options
+      < group_multiset_defaults,
+      #if !defined(BOOST_INTRUSIVE_VARIADIC_TEMPLATES)
+      O1, O2, O3, O4, O5, O6
+      #else
+      Options...
+      #endif
+      >::type packed_options;
+
+   typedef typename detail::get_value_traits
+      <T, typename packed_options::proto_value_traits>::type value_traits;
+
+   typedef group_multiset_impl
+         < value_traits
+         , typename packed_options::key_of_value
+         , typename packed_options::compare
+         , typename packed_options::size_type
+         , packed_options::constant_time_size
+         , AlgoType
+         , typename packed_options::header_holder_type
+         > type;
+};
+
+/// @endcond
+
+//! Helper metafunction to define a \c group_multiset that yields to the same type when the
+//! same options (either explicitly or implicitly) are used.
+#if defined(BOOST_INTRUSIVE_DOXYGEN_INVOKED) || defined(BOOST_INTRUSIVE_VARIADIC_TEMPLATES)
+template<class T, class ...Options>
+#else
+template<class T, class O1 = void, class O2 = void
+                , class O3 = void, class O4 = void
+                , class O5 = void, class O6 = void>
+#endif
+struct make_group_multiset
+{
+   /// @cond
+   typedef typename make_group_multiset_impl
+      < T, RbTreeAlgorithms,
+      #if !defined(BOOST_INTRUSIVE_VARIADIC_TEMPLATES)
+      O1, O2, O3, O4, O5, O6
+      #else
+      Options...
+      #endif
+      >::type implementation_defined;
+   /// @endcond
+   typedef implementation_defined type;
+};
+
+//! Helper metafunction to define a \c avl_group_multiset that yields to the same type when the
+//! same options (either explicitly or implicitly) are used.
+#if defined(BOOST_INTRUSIVE_DOXYGEN_INVOKED) || defined(BOOST_INTRUSIVE_VARIADIC_TEMPLATES)
+template<class T, class ...Options>
+#else
+template<class T, class O1 = void, class O2 = void
+                , class O3 = void, class O4 = void
+                , class O5 = void, class O6 = void>
+#endif
+struct make_avl_group_multiset
+{
+   /// @cond
+   typedef typename make_group_multiset_impl
+      < T, AvlTreeAlgorithms,
+      #if !defined(BOOST_INTRUSIVE_VARIADIC_TEMPLATES)
+      O1, O2, O3, O4, O5, O6
+      #else
+      Options...
+      #endif
+      >::type implementation_defined;
+   /// @endcond
+   typedef implementation_defined type;
+};
+
+#ifndef BOOST_INTRUSIVE_DOXYGEN_INVOKED
+#if !defined(BOOST_INTRUSIVE_VARIADIC_TEMPLATES)
+template<class T, class O1, class O2, class O3, class O4, class O5, class O6>
+#else
+template<class T, class ...Options>
+#endif
+class group_multiset
+   :  public make_group_multiset<T,
+   #if !defined(BOOST_INTRUSIVE_VARIADIC_TEMPLATES)
+   O1, O2, O3, O4, O5, O6
+   #else
+   Options...
+   #endif
+   >::type
+{
+   typedef typename make_group_multiset
+      <T,
+      #if !defined(BOOST_INTRUSIVE_VARIADIC_TEMPLATES)
+      O1, O2, O3, O4, O5, O6
+      #else
+      Options...
+      #endif
+      >::type   Base;
+
+   BOOST_MOVABLE_BUT_NOT_COPYABLE(group_multiset)
+   public:
+   typedef typename Base::key_compare        key_compare;
+   typedef typename Base::value_traits       value_traits;
+   typedef typename Base::iterator           iterator;
+   typedef typename Base::const_iterator     const_iterator;
+
+   //Assert if passed value traits are compatible with the type
+   BOOST_INTRUSIVE_STATIC_ASSERT((detail::is_same<typename value_traits::value_type, T>::value));
+
+   inline group_multiset()
+      :  Base()
+   {}
+
+   inline explicit group_multiset( const key_compare &cmp, const value_traits &v_traits = value_traits())
+      :  Base(cmp, v_traits)
+   {}
+
+   template<class Iterator>
+   inline group_multiset( Iterator b, Iterator e
+      , const key_compare &cmp = key_compare()
+      , const value_traits &v_traits = value_traits())
+      :  Base(b, e, cmp, v_traits)
+   {}
+
+   inline group_multiset(BOOST_RV_REF(group_multiset) x)
+      :  Base(BOOST_MOVE_BASE(Base, x))
+   {}
+
+   inline group_multiset& operator=(BOOST_RV_REF(group_multiset) x)
+   {  return static_cast<group_multiset &>(this->Base::operator=(BOOST_MOVE_BASE(Base, x)));  }
+
+   template <class Cloner, class Disposer>
+   inline void clone_from(const group_multiset &src, Cloner cloner, Disposer disposer)
+   {  Base::clone_from(src, cloner, disposer);  }
+
+   template <class Cloner, class Disposer>
+   inline void clone_from(BOOST_RV_REF(group_multiset) src, Cloner cloner, Disposer disposer)
+   {  Base::clone_from(BOOST_MOVE_BASE(Base, src), cloner, disposer);  }
+
+   BOOST_INTRUSIVE_NO_DANGLING
+   inline static group_multiset &container_from_end_iterator(iterator end_iterator) BOOST_NOEXCEPT
+   {  return static_cast<group_multiset &>(Base::container_from_end_iterator(end_iterator));   }
+
+   BOOST_INTRUSIVE_NO_DANGLING
+   inline static const group_multiset &container_from_end_iterator(const_iterator end_iterator) BOOST_NOEXCEPT
+   {  return static_cast<const group_multiset &>(Base::container_from_end_iterator(end_iterator));   }
+};
+
+#if !defined(BOOST_INTRUSIVE_VARIADIC_TEMPLATES)
+template<class T, class O1, class O2, class O3, class O4, class O5, class O6>
+#else
+template<class T, class ...Options>
+#endif
+class avl_group_multiset
+   :  public make_avl_group_multiset<T,
+   #if !defined(BOOST_INTRUSIVE_VARIADIC_TEMPLATES)
+   O1, O2, O3, O4, O5, O6
+   #else
+   Options...
+   #endif
+   >::type
+{
+   typedef typename make_avl_group_multiset
+      <T,
+      #if !defined(BOOST_INTRUSIVE_VARIADIC_TEMPLATES)
+      O1, O2, O3, O4, O5, O6
+      #else
+      Options...
+      #endif
+      >::type   Base;
+
+   BOOST_MOVABLE_BUT_NOT_COPYABLE(avl_group_multiset)
+   public:
+   typedef typename Base::key_compare        key_compare;
+   typedef typename Base::value_traits       value_traits;
+   typedef typename Base::iterator           iterator;
+   typedef typename Base::const_iterator     const_iterator;
+
+   //Assert if passed value traits are compatible with the type
+   BOOST_INTRUSIVE_STATIC_ASSERT((detail::is_same<typename value_traits::value_type, T>::value));
+
+   inline avl_group_multiset()
+      :  Base()
+   {}
+
+   inline explicit avl_group_multiset( const key_compare &cmp, const value_traits &v_traits = value_traits())
+      :  Base(cmp, v_traits)
+   {}
+
+   template<class Iterator>
+   inline avl_group_multiset( Iterator b, Iterator e
+      , const key_compare &cmp = key_compare()
+      , const value_traits &v_traits = value_traits())
+      :  Base(b, e, cmp, v_traits)
+   {}
+
+   inline avl_group_multiset(BOOST_RV_REF(avl_group_multiset) x)
+      :  Base(BOOST_MOVE_BASE(Base, x))
+   {}
+
+   inline avl_group_multiset& operator=(BOOST_RV_REF(avl_group_multiset) x)
+   {  return static_cast<avl_group_multiset &>(this->Base::operator=(BOOST_MOVE_BASE(Base, x)));  }
+
+   template <class Cloner, class Disposer>
+   inline void clone_from(const avl_group_multiset &src, Cloner cloner, Disposer disposer)
+   {  Base::clone_from(src, cloner, disposer);  }
+
+   template <class Cloner, class Disposer>
+   inline void clone_from(BOOST_RV_REF(avl_group_multiset) src, Cloner cloner, Disposer disposer)
+   {  Base::clone_from(BOOST_MOVE_BASE(Base, src), cloner, disposer);  }
+
+   BOOST_INTRUSIVE_NO_DANGLING
+   inline static avl_group_multiset &container_from_end_iterator(iterator end_iterator) BOOST_NOEXCEPT
+   {  return static_cast<avl_group_multiset &>(Base::container_from_end_iterator(end_iterator));   }
+
+   BOOST_INTRUSIVE_NO_DANGLING
+   inline static const avl_group_multiset &container_from_end_iterator(const_iterator end_iterator) BOOST_NOEXCEPT
+   {  return static_cast<const avl_group_multiset &>(Base::container_from_end_iterator(end_iterator));   }
+};
+
+#endif
+
+} //namespace intrusive
+} //namespace boost
+
+#include <boost/intrusive/detail/config_end.hpp>
+
+#endif //BOOST_INTRUSIVE_GROUP_MULTISET_HPP
@@ -2639,6 +2639,42 @@ class hashtable_impl
    inline void clone_from(const hashtable_impl &src, Cloner cloner, Disposer disposer)
    {  this->priv_clone_from(src, cloner, disposer);   }
 
+   //! <b>Requires</b>: Disposer::operator()(pointer) shouldn't throw
+   //!   Cloner should yield to nodes that compare equal and produce the same
+   //!   hash than the original node. Cloner, Disposer and the equality predicate
+   //!   must be safe to call concurrently and Executor must model the executor
+   //!   concept described in sequential_executor.
+   //!
+   //! <b>Effects</b>: Same as clone_from(src, cloner, disposer). When the bucket array can be
+   //!   copied structurally (incremental hashing is not used and the bucket count of src is
+   //!   a multiple of the bucket count of *this), disjoint ranges of destination buckets are cloned
+   //!   in parallel by up to 16 tasks run through <tt>executor(task1, task2)</tt>. Otherwise
+   //!   elements are cloned by the calling thread.
+   //!
+   //!   If any operation throws, all cloned elements are unlinked and disposed
+   //!   calling Disposer::operator()(pointer).
+   //!
+   //! <b>Complexity</b>: Linear to erased plus inserted elements.
+   //!
+   //! <b>Throws</b>: If cloner, hasher, the executor or hash or equality predicate copying
+   //!   throw. Basic guarantee.
+   template <class Cloner, class Disposer, class Executor>
+   void clone_from(const hashtable_impl &src, Cloner cloner, Disposer disposer, Executor executor)
+   {
+      const size_type src_bucket_count = src.bucket_count();
+      const size_type dst_bucket_count = this->bucket_count();
+      if(incremental || src_bucket_count < dst_bucket_count ||
+         (!power_2_buckets && (src_bucket_count % dst_bucket_count) != 0)){
+         this->priv_clone_from(src, cloner, disposer);
+      }
+      else{
+         this->clear_and_dispose(disposer);
+         if(!constant_time_size || !src.empty()){
+            this->priv_parallel_structural_clone_from(src, cloner, disposer, executor);
+         }
+      }
+   }
+
    //! <b>Requires</b>: Disposer::operator()(pointer) shouldn't throw
    //!   Cloner should yield to nodes that compare equal and produce the same
    //!   hash than the original node.
@@ -3100,6 +3136,79 @@ class hashtable_impl
       return static_cast<size_type>(cnt);
    }
 
+   //! <b>Effects</b>: Erases all the elements for which pred returns true.
+   //!   No destructors are called.
+   //!
+   //! <b>Returns</b>: The number of erased elements.
+   //!
+   //! <b>Complexity</b>: Linear to the number of elements plus the bucket count.
+   //!   Each bucket is traversed once and each run of consecutive erased elements
+   //!   is unlinked at once, without searching the preceding node of each element.
+   //!
+   //! <b>Throws</b>: If pred throws. Basic guarantee.
+   //!
+   //! <b>Note</b>: Invalidates the iterators (but not the references)
+   //!    to the erased elements.
+   template<class Pred>
+   inline size_type erase_if(Pred pred)
+   {  return this->erase_and_dispose_if(pred, detail::null_disposer());   }
+
+   //! <b>Requires</b>: Disposer::operator()(pointer) shouldn't throw.
+   //!
+   //! <b>Effects</b>: Erases all the elements for which pred returns true.
+   //!   Disposer::operator()(pointer) is called for the removed elements.
+   //!
+   //! <b>Returns</b>: The number of erased elements.
+   //!
+   //! <b>Complexity</b>: Linear to the number of elements plus the bucket count.
+   //!   Each bucket is traversed once and each run of consecutive erased elements
+   //!   is unlinked at once, without searching the preceding node of each element.
+   //!
+   //! <b>Throws</b>: If pred throws. Basic guarantee.
+   //!
+   //! <b>Note</b>: Invalidates the iterators
+   //!    to the erased elements.
+   template<class Pred, class Disposer>
+   size_type erase_and_dispose_if(Pred pred, Disposer disposer)
+   {
+      size_type num_erased = 0;
+      BOOST_INTRUSIVE_TRY{
+         for(size_type n = 0, nb = this->bucket_count(); n != nb; ++n){
+            bucket_type &b = this->priv_bucket(n);
+            siterator const end_sit(this->priv_bucket_lend(b));
+            siterator before(this->priv_bucket_lbbegin(b));
+            siterator it(before);
+            ++it;
+            while(it != end_sit){
+               if(!pred(this->priv_value_from_siterator(it))){
+                  before = it;
+                  ++it;
+                  continue;
+               }
+               //Find the end of the run of erased elements and unlink it after "before"
+               do{
+                  ++it;
+               }while(it != end_sit && pred(this->priv_value_from_siterator(it)));
+               size_type const cnt = (size_type)this->priv_erase_from_single_bucket
+                  (b, before, it, this->make_node_disposer(disposer), optimize_multikey_t());
+               this->priv_size_count(size_type(this->priv_size_count()-cnt));
+               num_erased = size_type(num_erased + cnt);
+               if(it != end_sit){
+                  before = it;
+                  ++it;
+               }
+            }
+         }
+      }
+      BOOST_INTRUSIVE_CATCH(...){
+         this->priv_erasure_update_cache();
+         BOOST_INTRUSIVE_RETHROW;
+      }
+      BOOST_INTRUSIVE_CATCH_END
+      this->priv_erasure_update_cache();
+      return num_erased;
+   }
+
    //! <b>Effects</b>: Erases all of the elements.
    //!
    //! <b>Complexity</b>: Linear to the number of elements on the container.
@@ -3142,6 +3251,108 @@ class hashtable_impl
       this->priv_init_cache();
    }
 
+   //! <b>Requires</b>: Disposer::operator()(pointer) shouldn't throw.
+   //!
+   //! <b>Effects</b>: Erases up to max_nodes elements, starting from the first
+   //!   non-empty bucket. Disposer::operator()(pointer) is called for the removed elements.
+   //!   The destruction of a big container can be split in several calls,
+   //!   each one doing bounded work. The container remains usable between calls.
+   //!
+   //! <b>Returns</b>: true if the container is empty after the call.
+   //!
+   //! <b>Complexity</b>: Linear to max_nodes plus the number of empty buckets
+   //!   before the first erased element (constant for the latter if cache_begin<true> is used).
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Note</b>: Invalidates the iterators (but not the references)
+   //!    to the erased elements. No destructors are called.
+   template<class Disposer>
+   bool clear_and_dispose_some(Disposer disposer, size_type max_nodes) BOOST_NOEXCEPT
+   {
+      //Buckets before the cached begin bucket are empty
+      size_type n = (size_type)this->priv_get_cache_bucket_num();
+      const size_type nb = this->bucket_count();
+      for(; n != nb; ++n){
+         bucket_type &b = this->priv_bucket(n);
+         siterator const end_sit(this->priv_bucket_lend(b));
+         siterator const before(this->priv_bucket_lbbegin(b));
+         siterator last(before);
+         ++last;
+         if(last == end_sit)
+            continue;
+         else if(!max_nodes)
+            break;
+         //Unlink the first elements of the bucket at once
+         do{
+            ++last;
+         }while(--max_nodes && last != end_sit);
+         size_type const cnt = (size_type)this->priv_erase_from_single_bucket
+            (b, before, last, this->make_node_disposer(disposer), optimize_multikey_t());
+         this->priv_size_count(size_type(this->priv_size_count()-cnt));
+         if(last != end_sit)
+            break;
+      }
+      this->priv_erasure_update_cache();
+      return n == nb;
+   }
+
+   //! <b>Effects</b>: Splits the container in k consecutive ranges and writes them in order to out
+   //!   as <tt>std::pair<iterator, iterator></tt> objects. Each range holds the elements of
+   //!   a range of about bucket_count()/k buckets, so ranges have roughly equal sizes if the
+   //!   hash function spreads the elements evenly. The ranges cover the container and some of
+   //!   them can be empty. Disjoint ranges can be traversed concurrently, so that the elements can be
+   //!   scanned in parallel.
+   //!
+   //! <b>Returns</b>: The output iterator past the last written range.
+   //!
+   //! <b>Complexity</b>: Linear to k plus the number of empty buckets placed at the start
+   //!   of the bucket ranges.
+   //!
+   //! <b>Throws</b>: If writing to out throws.
+   template<class OutputIterator>
+   OutputIterator partition(size_type k, OutputIterator out)
+   {
+      iterator b(this->begin());
+      for(size_type i = 1u; i <= k; ++i){
+         bucket_ptr p;
+         const siterator s(this->priv_partition_begin(i, k, p));
+         const iterator e(this->build_iterator(s, p));
+         *out = std::pair<iterator, iterator>(b, e);
+         ++out;
+         b = e;
+      }
+      return out;
+   }
+
+   //! <b>Effects</b>: Splits the container in k consecutive ranges and writes them in order to out
+   //!   as <tt>std::pair<const_iterator, const_iterator></tt> objects. Each range holds the elements of
+   //!   a range of about bucket_count()/k buckets, so ranges have roughly equal sizes if the
+   //!   hash function spreads the elements evenly. The ranges cover the container and some of
+   //!   them can be empty. Disjoint ranges can be traversed concurrently, so that the elements can be
+   //!   scanned in parallel.
+   //!
+   //! <b>Returns</b>: The output iterator past the last written range.
+   //!
+   //! <b>Complexity</b>: Linear to k plus the number of empty buckets placed at the start
+   //!   of the bucket ranges.
+   //!
+   //! <b>Throws</b>: If writing to out throws.
+   template<class OutputIterator>
+   OutputIterator partition(size_type k, OutputIterator out) const
+   {
+      const_iterator b(this->cbegin());
+      for(size_type i = 1u; i <= k; ++i){
+         bucket_ptr p;
+         const siterator s(this->priv_partition_begin(i, k, p));
+         const const_iterator e(this->build_const_iterator(s, p));
+         *out = std::pair<const_iterator, const_iterator>(b, e);
+         ++out;
+         b = e;
+      }
+      return out;
+   }
+
    //! <b>Effects</b>: Returns the number of contained elements with the given value
    //!
    //! <b>Complexity</b>: Average case O(1), worst case O(this->size()).
@@ -4026,6 +4237,119 @@ class hashtable_impl
       this->priv_erasure_update_cache();
    }
 
+   //First element of the buckets of the i-th of k partitions, the end position for i == k.
+   //Buckets past the split point of incremental tables are empty so they are not partitioned.
+   siterator priv_partition_begin(size_type i, size_type k, bucket_ptr &p) const
+   {
+      std::size_t bucket_cnt = this->priv_usable_bucket_count();
+      BOOST_IF_CONSTEXPR(incremental){
+         bucket_cnt = this->split_count();
+      }
+      std::size_t n = i == k ? bucket_cnt : (bucket_cnt/k)*i + ((bucket_cnt%k)*i)/k;
+      for(; n < bucket_cnt; ++n){
+         if(!this->priv_bucket_empty(n)){
+            p = this->priv_bucket_ptr(n);
+            return this->priv_bucket_lbegin(*p);
+         }
+      }
+      p = bucket_ptr();
+      return this->priv_end_sit();
+   }
+
+   //Clones the destination buckets [first_, last_), results are stored in the table
+   //so executors are allowed to copy the task.
+   template<class Cloner, class Executor>
+   struct bucket_range_clone_task
+   {
+      bucket_range_clone_task( hashtable_impl &table, const hashtable_impl &src, Cloner cloner
+                             , Executor &executor, size_type first, size_type last, std::size_t tasks)
+         : table_(&table), src_(&src), cloner_(cloner), executor_(&executor)
+         , first_(first), last_(last), tasks_(tasks)
+      {}
+
+      void operator()()
+      {  table_->priv_clone_bucket_range(*src_, cloner_, *executor_, first_, last_, tasks_);  }
+
+      hashtable_impl *table_;
+      const hashtable_impl *src_;
+      Cloner cloner_;
+      Executor *executor_;
+      size_type first_;
+      size_type last_;
+      std::size_t tasks_;
+   };
+
+   template <class Cloner, class Disposer, class Executor>
+   void priv_parallel_structural_clone_from(const hashtable_impl &src, Cloner cloner, Disposer disposer, Executor &executor)
+   {
+      const size_type dst_bucket_count = this->bucket_count();
+      typedef typename internal_type::template typeof_node_disposer<Disposer>::type NodeDisposer;
+      NodeDisposer node_disp(disposer, &this->priv_value_traits());
+      //Tasks can fail after linking nodes in any bucket of their range
+      exception_bucket_disposer<bucket_type, slist_node_algorithms, NodeDisposer, size_type>
+         rollback(this->priv_bucket(0), node_disp, dst_bucket_count);
+      //Each task clones ~1024 elements at least, tables whose size is unknown are always split
+      const std::size_t sz = constant_time_size ? std::size_t(src.priv_size_count()) : std::size_t(-1);
+      std::size_t tasks = 1u;
+      while(tasks != 16u && sz/(tasks*2u) >= 1024u && dst_bucket_count/(tasks*2u) != 0u)
+         tasks *= 2u;
+      this->priv_clone_bucket_range(src, cloner, executor, 0u, dst_bucket_count, tasks);
+      this->priv_hasher() = src.priv_hasher();
+      this->priv_equal()  = src.priv_equal();
+      rollback.release();
+      this->priv_size_count(src.priv_size_count());
+      this->split_count(dst_bucket_count);
+      this->priv_set_cache_bucket_num(0u);
+      this->priv_erasure_update_cache();
+   }
+
+   template <class Cloner, class Executor>
+   void priv_clone_bucket_range
+      ( const hashtable_impl &src, Cloner &cloner, Executor &executor
+      , size_type const first, size_type const last, std::size_t const tasks)
+   {
+      if(tasks > 1u){
+         const size_type middle = size_type(first + (last - first)/2u);
+         bucket_range_clone_task<Cloner, Executor> left_task (*this, src, cloner, executor, first, middle, tasks/2u);
+         bucket_range_clone_task<Cloner, Executor> right_task(*this, src, cloner, executor, middle, last, tasks/2u);
+         executor(left_task, right_task);
+         return;
+      }
+      //Source buckets n, n + dst_bucket_count, n + 2*dst_bucket_count... are cloned
+      //in order in destination bucket n, as in the sequential structural copy
+      const size_type src_bucket_count = src.bucket_count();
+      const size_type dst_bucket_count = this->bucket_count();
+      for(size_type m = 0u; m != src_bucket_count; m = size_type(m + dst_bucket_count)){
+         for(size_type n = first; n != last; ++n){
+            bucket_type &src_b = src.priv_bucket(size_type(m + n));
+            for( siterator b(this->priv_bucket_lbegin(src_b)), e(this->priv_bucket_lend(src_b)); b != e; ++b){
+               this->priv_link_clone_front_in_bucket
+                  (n, this->priv_value_from_siterator(b), this->priv_stored_hash(b, store_hash_t()), cloner);
+            }
+         }
+      }
+   }
+
+   //Like priv_clone_front_in_bucket, but the cached begin bucket and the
+   //size are not updated, so that different buckets can be filled concurrently
+   template<class Cloner>
+   void priv_link_clone_front_in_bucket
+      (size_type const bucket_number, const_reference src_ref, std::size_t const hash_to_store, Cloner &cloner)
+   {
+      bucket_type &cur_bucket = this->priv_bucket(bucket_number);
+      siterator const prev(cur_bucket.get_node_ptr());
+      bool const next_is_in_group = optimize_multikey && !this->priv_bucket_empty(bucket_number) &&
+         this->priv_equal()( key_of_value()(src_ref)
+                           , key_of_value()(this->priv_value_from_siterator(++siterator(prev))));
+      node_ptr n = this->priv_value_to_node_ptr(*cloner(src_ref));
+      node_functions_t::store_hash(n, hash_to_store, store_hash_t());
+      BOOST_INTRUSIVE_SAFE_HOOK_DEFAULT_ASSERT(!safemode_or_autounlink || slist_node_algorithms::unique(n));
+      group_functions_t::insert_in_group
+         ( next_is_in_group ? dcast_bucket_ptr<node>((++siterator(prev)).pointed_node()) : n
+         , n, optimize_multikey_t());
+      slist_node_algorithms::link_after(prev.pointed_node(), n);
+   }
+
    iterator priv_insert_equal_after_find(reference value, size_type bucket_num, std::size_t hash_value, siterator prev, bool const next_is_in_group)
    {
       //Now store hash if needed
@@ -4389,6 +4713,10 @@ class hashtable
    template <class Cloner, class Disposer>
    inline void clone_from(BOOST_RV_REF(hashtable) src, Cloner cloner, Disposer disposer)
    {  Base::clone_from(BOOST_MOVE_BASE(Base, src), cloner, disposer);  }
+
+   template <class Cloner, class Disposer, class Executor>
+   inline void clone_from(const hashtable &src, Cloner cloner, Disposer disposer, Executor executor)
+   {  Base::clone_from(src, cloner, disposer, executor);  }
 };
 
 #endif
@@ -42,7 +42,15 @@
 //!   - boost::intrusive::treap / boost::intrusive::treap_set / boost::intrusive::treap_multiset
 //!   - boost::intrusive::hashtable / boost::intrusive::unordered_set / boost::intrusive::unordered_multiset /
 //!      boost::intrusive::unordered_set_base_hook / boost::intrusive::unordered_set_member_hook /
+//!   - boost::intrusive::compact_set / boost::intrusive::compact_set_base_hook /
+//!      boost::intrusive::compact_set_member_hook
+//!   - boost::intrusive::xor_list / boost::intrusive::xor_list_base_hook / boost::intrusive::xor_list_member_hook
+//!   - boost::intrusive::frozen_set / boost::intrusive::lookup_cache / boost::intrusive::set_intersection_view
+//!   - boost::intrusive::prefetch_iterator / boost::intrusive::sequential_executor
+//!   - boost::intrusive::group_multiset / boost::intrusive::avl_group_multiset /
+//!      boost::intrusive::group_multiset_base_hook / boost::intrusive::group_multiset_member_hook
 //!   - boost::intrusive::any_base_hook / boost::intrusive::any_member_hook
+//!   - boost::intrusive::lockfree_stack / boost::intrusive::mpsc_queue
 //!
 //! It forward declares the following container or hook options:
 //!   - boost::intrusive::constant_time_size / boost::intrusive::size_type / boost::intrusive::compare / boost::intrusive::equal
@@ -55,10 +63,11 @@
 //!
 //! It forward declares the following value traits utilities:
 //!   - boost::intrusive::value_traits / boost::intrusive::derivation_value_traits /
-//!      boost::intrusive::trivial_value_traits
+//!      boost::intrusive::trivial_value_traits / boost::intrusive::side_table_value_traits
 //!
 //! Finally it forward declares the following general purpose utilities:
-//!   - boost::intrusive::pointer_plus_bits / boost::intrusive::priority_compare.
+//!   - boost::intrusive::pointer_plus_bits / boost::intrusive::priority_compare /
+//!      boost::intrusive::arena_ptr.
 
 #if !defined(BOOST_INTRUSIVE_DOXYGEN_INVOKED)
 
@@ -109,6 +118,12 @@ class splaytree_algorithms;
 template<class NodeTraits>
 class treap_algorithms;
 
+template<class NodeTraits>
+class threaded_rbtree_algorithms;
+
+template<class NodeTraits>
+class xor_list_algorithms;
+
 ////////////////////////////
 //       Containers
 ////////////////////////////
@@ -170,6 +185,7 @@ template
    < class O1  = void
    , class O2  = void
    , class O3  = void
+   , class O4  = void
    >
 #else
 template<class ...Options>
@@ -181,6 +197,7 @@ template
    < class O1  = void
    , class O2  = void
    , class O3  = void
+   , class O4  = void
    >
 #else
 template<class ...Options>
@@ -621,6 +638,151 @@ template<class ...Options>
 #endif
 class unordered_set_member_hook;
 
+//compact_set
+#if !defined(BOOST_INTRUSIVE_VARIADIC_TEMPLATES)
+template
+   < class T
+   , class O1  = void
+   , class O2  = void
+   , class O3  = void
+   , class O4  = void
+   , class O5  = void
+   , class O6  = void
+   >
+#else
+template<class T, class ...Options>
+#endif
+class compact_set;
+
+#if !defined(BOOST_INTRUSIVE_VARIADIC_TEMPLATES)
+template
+   < class O1  = void
+   , class O2  = void
+   , class O3  = void
+   >
+#else
+template<class ...Options>
+#endif
+class compact_set_base_hook;
+
+#if !defined(BOOST_INTRUSIVE_VARIADIC_TEMPLATES)
+template
+   < class O1  = void
+   , class O2  = void
+   , class O3  = void
+   >
+#else
+template<class ...Options>
+#endif
+class compact_set_member_hook;
+
+//xor_list
+#if !defined(BOOST_INTRUSIVE_VARIADIC_TEMPLATES)
+template
+   < class T
+   , class O1  = void
+   , class O2  = void
+   , class O3  = void
+   >
+#else
+template<class T, class ...Options>
+#endif
+class xor_list;
+
+#if !defined(BOOST_INTRUSIVE_VARIADIC_TEMPLATES)
+template
+   < class O1  = void
+   , class O2  = void
+   , class O3  = void
+   >
+#else
+template<class ...Options>
+#endif
+class xor_list_base_hook;
+
+#if !defined(BOOST_INTRUSIVE_VARIADIC_TEMPLATES)
+template
+   < class O1  = void
+   , class O2  = void
+   , class O3  = void
+   >
+#else
+template<class ...Options>
+#endif
+class xor_list_member_hook;
+
+//frozen_set
+template<class Tree, bool CacheKeys = false>
+class frozen_set;
+
+//lookup_cache
+template<class Tree, std::size_t Size = 64u, class Hash = void>
+class lookup_cache;
+
+//set_intersection_view
+template<class FirstTree, class SecondTree>
+class set_intersection_view;
+
+//prefetch_iterator
+template<class Iterator, std::size_t Distance = 4u>
+class prefetch_iterator;
+
+//sequential_executor
+struct sequential_executor;
+
+//group_multiset
+#if !defined(BOOST_INTRUSIVE_VARIADIC_TEMPLATES)
+template
+   < class T
+   , class O1  = void
+   , class O2  = void
+   , class O3  = void
+   , class O4  = void
+   , class O5  = void
+   , class O6  = void
+   >
+#else
+template<class T, class ...Options>
+#endif
+class group_multiset;
+
+#if !defined(BOOST_INTRUSIVE_VARIADIC_TEMPLATES)
+template
+   < class T
+   , class O1  = void
+   , class O2  = void
+   , class O3  = void
+   , class O4  = void
+   , class O5  = void
+   , class O6  = void
+   >
+#else
+template<class T, class ...Options>
+#endif
+class avl_group_multiset;
+
+#if !defined(BOOST_INTRUSIVE_VARIADIC_TEMPLATES)
+template
+   < class O1  = void
+   , class O2  = void
+   , class O3  = void
+   >
+#else
+template<class ...Options>
+#endif
+class group_multiset_base_hook;
+
+#if !defined(BOOST_INTRUSIVE_VARIADIC_TEMPLATES)
+template
+   < class O1  = void
+   , class O2  = void
+   , class O3  = void
+   >
+#else
+template<class ...Options>
+#endif
+class group_multiset_member_hook;
+
 #if !defined(BOOST_INTRUSIVE_VARIADIC_TEMPLATES)
 template
    < class O1  = void
@@ -643,6 +805,32 @@ template<class ...Options>
 #endif
 class any_member_hook;
 
+//lockfree_stack
+#if !defined(BOOST_INTRUSIVE_VARIADIC_TEMPLATES)
+template
+   < class T
+   , class O1  = void
+   , class O2  = void
+   , class O3  = void
+   >
+#else
+template<class T, class ...Options>
+#endif
+class lockfree_stack;
+
+//mpsc_queue
+#if !defined(BOOST_INTRUSIVE_VARIADIC_TEMPLATES)
+template
+   < class T
+   , class O1  = void
+   , class O2  = void
+   , class O3  = void
+   >
+#else
+template<class T, class ...Options>
+#endif
+class mpsc_queue;
+
 //Options
 
 template<bool Enabled>
@@ -657,6 +845,21 @@ struct compare;
 template<bool Enabled>
 struct floating_point;
 
+template<bool Enabled>
+struct incremental_rebuild;
+
+template<bool Enabled>
+struct modification_epoch;
+
+template<bool Enabled>
+struct semi_splay;
+
+template<std::size_t Period>
+struct splay_period;
+
+template<std::size_t Depth>
+struct splay_depth_threshold;
+
 template<typename Equal>
 struct equal;
 
@@ -691,6 +894,9 @@ struct link_mode;
 template<bool Enabled> struct
 optimize_size;
 
+template<bool Enabled>
+struct order_labels;
+
 template<bool Enabled>
 struct linear;
 
@@ -740,6 +946,9 @@ struct derivation_value_traits;
 template<class NodeTraits, link_mode_type LinkMode = normal_link>
 struct trivial_value_traits;
 
+template<class T, class Hook>
+struct side_table_value_traits;
+
 //Additional utilities
 
 template<typename VoidPointer, std::size_t Alignment>
@@ -760,6 +969,9 @@ struct pointer_traits;
 template<typename T>
 struct pointer_traits<T *>;
 
+template<class T, class Tag = void>
+class arena_ptr;
+
 }  //namespace intrusive {
 }  //namespace boost {
 
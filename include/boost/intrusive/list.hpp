@@ -19,6 +19,7 @@
 #include <boost/intrusive/detail/assert.hpp>
 #include <boost/intrusive/list_hook.hpp>
 #include <boost/intrusive/circular_list_algorithms.hpp>
+#include <boost/intrusive/order_list_algorithms.hpp>
 #include <boost/intrusive/pointer_traits.hpp>
 #include <boost/intrusive/detail/mpl.hpp>
 #include <boost/intrusive/link_mode.hpp>
@@ -35,6 +36,7 @@
 #include <boost/intrusive/detail/simple_disposers.hpp>
 #include <boost/intrusive/detail/size_holder.hpp>
 #include <boost/intrusive/detail/algorithm.hpp>
+#include <boost/intrusive/detail/key_sort_algorithms.hpp>
 
 #include <boost/move/utility_core.hpp>
 
@@ -57,6 +59,12 @@ template<>
 struct is_default_hook_tag<default_list_hook_applier>
 {  static const bool value = true;  };
 
+namespace detail {
+
+BOOST_INTRUSIVE_INTERNAL_STATIC_BOOL_IS_TRUE(order_labels, order_labels)
+
+}  //namespace detail {
+
 struct list_defaults
 {
    typedef default_list_hook_applier proto_value_traits;
@@ -77,6 +85,10 @@ struct list_defaults
 //! The container supports the following options:
 //! \c base_hook<>/member_hook<>/value_traits<>,
 //! \c constant_time_size<> and \c size_type<>.
+//!
+//! If the hook stores order labels (\c order_labels<true>), the container
+//! maintains them and offers \c precedes(), which compares the position of
+//! two elements in constant time.
 #if defined(BOOST_INTRUSIVE_DOXYGEN_INVOKED)
 template<class T, class ...Options>
 #else
@@ -110,6 +122,7 @@ class list_impl
    static const bool stateful_value_traits = detail::is_stateful_value_traits<value_traits>::value;
    static const bool has_container_from_iterator =
         detail::is_same< header_holder_type, detail::default_header_holder< node_traits > >::value;
+   static const bool order_labels = detail::order_labels_bool_is_true<node_traits>::value;
 
    /// @cond
 
@@ -126,10 +139,10 @@ class list_impl
                         ((int)value_traits::link_mode == (int)auto_unlink)
                       ));
 
-   inline node_ptr get_root_node()
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR node_ptr get_root_node()
    { return data_.root_plus_size_.m_header.get_node(); }
 
-   inline const_node_ptr get_root_node() const
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR const_node_ptr get_root_node() const
    { return data_.root_plus_size_.m_header.get_node(); }
 
    struct root_plus_size : public size_traits
@@ -140,29 +153,29 @@ class list_impl
    struct data_t : public value_traits
    {
       typedef typename list_impl::value_traits value_traits;
-      inline explicit data_t(const value_traits &val_traits)
+      inline BOOST_INTRUSIVE_CXX20_CONSTEXPR explicit data_t(const value_traits &val_traits)
          :  value_traits(val_traits)
       {}
 
       root_plus_size root_plus_size_;
    } data_;
 
-   inline size_traits &priv_size_traits() BOOST_NOEXCEPT
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR size_traits &priv_size_traits() BOOST_NOEXCEPT
    {  return data_.root_plus_size_;  }
 
-   inline const size_traits &priv_size_traits() const BOOST_NOEXCEPT
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR const size_traits &priv_size_traits() const BOOST_NOEXCEPT
    {  return data_.root_plus_size_;  }
 
-   inline const value_traits &priv_value_traits() const BOOST_NOEXCEPT
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR const value_traits &priv_value_traits() const BOOST_NOEXCEPT
    {  return data_;  }
 
-   inline value_traits &priv_value_traits() BOOST_NOEXCEPT
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR value_traits &priv_value_traits() BOOST_NOEXCEPT
    {  return data_;  }
 
    typedef typename boost::intrusive::value_traits_pointers
       <ValueTraits>::const_value_traits_ptr const_value_traits_ptr;
 
-   inline const_value_traits_ptr priv_value_traits_ptr() const BOOST_NOEXCEPT
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR const_value_traits_ptr priv_value_traits_ptr() const BOOST_NOEXCEPT
    {  return pointer_traits<const_value_traits_ptr>::pointer_to(this->priv_value_traits());  }
 
    /// @endcond
@@ -175,7 +188,7 @@ class list_impl
    //!
    //! <b>Throws</b>: If value_traits::node_traits::node
    //!   constructor throws (this does not happen with predefined Boost.Intrusive hooks).
-   list_impl()
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR list_impl()
       :  data_(value_traits())
    {
       this->priv_size_traits().set_size(size_type(0));
@@ -188,7 +201,7 @@ class list_impl
    //!
    //! <b>Throws</b>: If value_traits::node_traits::node
    //!   constructor throws (this does not happen with predefined Boost.Intrusive hooks).
-   explicit list_impl(const value_traits &v_traits)
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR explicit list_impl(const value_traits &v_traits)
       :  data_(v_traits)
    {
       this->priv_size_traits().set_size(size_type(0));
@@ -204,7 +217,7 @@ class list_impl
    //! <b>Throws</b>: If value_traits::node_traits::node
    //!   constructor throws (this does not happen with predefined Boost.Intrusive hooks).
    template<class Iterator>
-   list_impl(Iterator b, Iterator e, const value_traits &v_traits = value_traits())
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR list_impl(Iterator b, Iterator e, const value_traits &v_traits = value_traits())
       :  data_(v_traits)
    {
       //nothrow, no need to rollback to release elements on exception
@@ -223,7 +236,7 @@ class list_impl
    //! <b>Throws</b>: If value_traits::node_traits::node's
    //!   move constructor throws (this does not happen with predefined Boost.Intrusive hooks)
    //!   or the move constructor of value traits throws.
-   list_impl(BOOST_RV_REF(list_impl) x)
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR list_impl(BOOST_RV_REF(list_impl) x)
       : data_(::boost::move(x.priv_value_traits()))
    {
       this->priv_size_traits().set_size(size_type(0));
@@ -234,7 +247,7 @@ class list_impl
 
    //! <b>Effects</b>: Equivalent to swap
    //!
-   list_impl& operator=(BOOST_RV_REF(list_impl) x)
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR list_impl& operator=(BOOST_RV_REF(list_impl) x)
    {  this->swap(x); return *this;  }
 
    //! <b>Effects</b>: If it's not a safe-mode or an auto-unlink value_type
@@ -248,7 +261,7 @@ class list_impl
    //! 
    //! <b>Complexity</b>: Linear to the number of elements in the list, if
    //!   it's a safe-mode or auto-unlink value . Otherwise constant.
-   ~list_impl()
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR ~list_impl()
    #if defined(BOOST_INTRUSIVE_CONCEPTS_BASED_OVERLOADING)
       requires (ValueTraits::link_mode != normal_link)
    #endif
@@ -274,11 +287,12 @@ class list_impl
    //! <b>Complexity</b>: Constant.
    //!
    //! <b>Note</b>: Does not affect the validity of iterators and references.
-   void push_back(reference value) BOOST_NOEXCEPT
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR void push_back(reference value) BOOST_NOEXCEPT
    {
       node_ptr to_insert = priv_value_traits().to_node_ptr(value);
       BOOST_INTRUSIVE_SAFE_HOOK_DEFAULT_ASSERT(!safemode_or_autounlink || node_algorithms::inited(to_insert));
       node_algorithms::link_before(this->get_root_node(), to_insert);
+      this->priv_label(to_insert, this->get_root_node());
       this->priv_size_traits().increment();
    }
 
@@ -292,11 +306,13 @@ class list_impl
    //! <b>Complexity</b>: Constant.
    //!
    //! <b>Note</b>: Does not affect the validity of iterators and references.
-   void push_front(reference value) BOOST_NOEXCEPT
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR void push_front(reference value) BOOST_NOEXCEPT
    {
       node_ptr to_insert = priv_value_traits().to_node_ptr(value);
       BOOST_INTRUSIVE_SAFE_HOOK_DEFAULT_ASSERT(!safemode_or_autounlink || node_algorithms::inited(to_insert));
-      node_algorithms::link_before(node_traits::get_next(this->get_root_node()), to_insert);
+      const node_ptr first = node_traits::get_next(this->get_root_node());
+      node_algorithms::link_before(first, to_insert);
+      this->priv_label(to_insert, first);
       this->priv_size_traits().increment();
    }
 
@@ -308,7 +324,7 @@ class list_impl
    //! <b>Complexity</b>: Constant.
    //!
    //! <b>Note</b>: Invalidates the iterators (but not the references) to the erased element.
-   void pop_back() BOOST_NOEXCEPT
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR void pop_back() BOOST_NOEXCEPT
    {  return this->pop_back_and_dispose(detail::null_disposer());   }
 
    //! <b>Requires</b>: Disposer::operator()(pointer) shouldn't throw.
@@ -323,7 +339,7 @@ class list_impl
    //!
    //! <b>Note</b>: Invalidates the iterators to the erased element.
    template<class Disposer>
-   void pop_back_and_dispose(Disposer disposer) BOOST_NOEXCEPT
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR void pop_back_and_dispose(Disposer disposer) BOOST_NOEXCEPT
    {
       node_ptr to_erase = node_traits::get_previous(this->get_root_node());
       node_algorithms::unlink(to_erase);
@@ -341,7 +357,7 @@ class list_impl
    //! <b>Complexity</b>: Constant.
    //!
    //! <b>Note</b>: Invalidates the iterators (but not the references) to the erased element.
-   void pop_front() BOOST_NOEXCEPT
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR void pop_front() BOOST_NOEXCEPT
    {  return this->pop_front_and_dispose(detail::null_disposer());   }
 
    //! <b>Requires</b>: Disposer::operator()(pointer) shouldn't throw.
@@ -356,7 +372,7 @@ class list_impl
    //!
    //! <b>Note</b>: Invalidates the iterators to the erased element.
    template<class Disposer>
-   void pop_front_and_dispose(Disposer disposer) BOOST_NOEXCEPT
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR void pop_front_and_dispose(Disposer disposer) BOOST_NOEXCEPT
    {
       node_ptr to_erase = node_traits::get_next(this->get_root_node());
       node_algorithms::unlink(to_erase);
@@ -371,7 +387,7 @@ class list_impl
    //! <b>Throws</b>: Nothing.
    //!
    //! <b>Complexity</b>: Constant.
-   inline reference front() BOOST_NOEXCEPT
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR reference front() BOOST_NOEXCEPT
    { return *priv_value_traits().to_value_ptr(node_traits::get_next(this->get_root_node())); }
 
    //! <b>Effects</b>: Returns a const_reference to the first element of the list.
@@ -379,7 +395,7 @@ class list_impl
    //! <b>Throws</b>: Nothing.
    //!
    //! <b>Complexity</b>: Constant.
-   inline const_reference front() const BOOST_NOEXCEPT
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR const_reference front() const BOOST_NOEXCEPT
    { return *priv_value_traits().to_value_ptr(node_traits::get_next(this->get_root_node())); }
 
    //! <b>Effects</b>: Returns a reference to the last element of the list.
@@ -387,7 +403,7 @@ class list_impl
    //! <b>Throws</b>: Nothing.
    //!
    //! <b>Complexity</b>: Constant.
-   inline reference back() BOOST_NOEXCEPT
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR reference back() BOOST_NOEXCEPT
    { return *priv_value_traits().to_value_ptr(node_traits::get_previous(this->get_root_node())); }
 
    //! <b>Effects</b>: Returns a const_reference to the last element of the list.
@@ -395,7 +411,7 @@ class list_impl
    //! <b>Throws</b>: Nothing.
    //!
    //! <b>Complexity</b>: Constant.
-   inline const_reference back() const BOOST_NOEXCEPT
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR const_reference back() const BOOST_NOEXCEPT
    { return *priv_value_traits().to_value_ptr(detail::uncast(node_traits::get_previous(this->get_root_node()))); }
 
    //! <b>Effects</b>: Returns an iterator to the first element contained in the list.
@@ -403,7 +419,7 @@ class list_impl
    //! <b>Throws</b>: Nothing.
    //!
    //! <b>Complexity</b>: Constant.
-   inline iterator begin() BOOST_NOEXCEPT
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR iterator begin() BOOST_NOEXCEPT
    { return iterator(node_traits::get_next(this->get_root_node()), this->priv_value_traits_ptr()); }
 
    //! <b>Effects</b>: Returns a const_iterator to the first element contained in the list.
@@ -411,7 +427,7 @@ class list_impl
    //! <b>Throws</b>: Nothing.
    //!
    //! <b>Complexity</b>: Constant.
-   inline const_iterator begin() const BOOST_NOEXCEPT
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR const_iterator begin() const BOOST_NOEXCEPT
    { return this->cbegin(); }
 
    //! <b>Effects</b>: Returns a const_iterator to the first element contained in the list.
@@ -419,7 +435,7 @@ class list_impl
    //! <b>Throws</b>: Nothing.
    //!
    //! <b>Complexity</b>: Constant.
-   inline const_iterator cbegin() const BOOST_NOEXCEPT
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR const_iterator cbegin() const BOOST_NOEXCEPT
    { return const_iterator(node_traits::get_next(this->get_root_node()), this->priv_value_traits_ptr()); }
 
    //! <b>Effects</b>: Returns an iterator to the end of the list.
@@ -427,7 +443,7 @@ class list_impl
    //! <b>Throws</b>: Nothing.
    //!
    //! <b>Complexity</b>: Constant.
-   inline iterator end() BOOST_NOEXCEPT
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR iterator end() BOOST_NOEXCEPT
    { return iterator(this->get_root_node(), this->priv_value_traits_ptr()); }
 
    //! <b>Effects</b>: Returns a const_iterator to the end of the list.
@@ -435,7 +451,7 @@ class list_impl
    //! <b>Throws</b>: Nothing.
    //!
    //! <b>Complexity</b>: Constant.
-   inline const_iterator end() const BOOST_NOEXCEPT
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR const_iterator end() const BOOST_NOEXCEPT
    { return this->cend(); }
 
    //! <b>Effects</b>: Returns a constant iterator to the end of the list.
@@ -443,7 +459,7 @@ class list_impl
    //! <b>Throws</b>: Nothing.
    //!
    //! <b>Complexity</b>: Constant.
-   inline const_iterator cend() const BOOST_NOEXCEPT
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR const_iterator cend() const BOOST_NOEXCEPT
    { return const_iterator(detail::uncast(this->get_root_node()), this->priv_value_traits_ptr()); }
 
    //! <b>Effects</b>: Returns a reverse_iterator pointing to the beginning
@@ -452,7 +468,7 @@ class list_impl
    //! <b>Throws</b>: Nothing.
    //!
    //! <b>Complexity</b>: Constant.
-   inline reverse_iterator rbegin() BOOST_NOEXCEPT
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR reverse_iterator rbegin() BOOST_NOEXCEPT
    { return reverse_iterator(this->end()); }
 
    //! <b>Effects</b>: Returns a const_reverse_iterator pointing to the beginning
@@ -461,7 +477,7 @@ class list_impl
    //! <b>Throws</b>: Nothing.
    //!
    //! <b>Complexity</b>: Constant.
-   inline const_reverse_iterator rbegin() const BOOST_NOEXCEPT
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR const_reverse_iterator rbegin() const BOOST_NOEXCEPT
    { return this->crbegin(); }
 
    //! <b>Effects</b>: Returns a const_reverse_iterator pointing to the beginning
@@ -470,7 +486,7 @@ class list_impl
    //! <b>Throws</b>: Nothing.
    //!
    //! <b>Complexity</b>: Constant.
-   inline const_reverse_iterator crbegin() const BOOST_NOEXCEPT
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR const_reverse_iterator crbegin() const BOOST_NOEXCEPT
    { return const_reverse_iterator(end()); }
 
    //! <b>Effects</b>: Returns a reverse_iterator pointing to the end
@@ -479,7 +495,7 @@ class list_impl
    //! <b>Throws</b>: Nothing.
    //!
    //! <b>Complexity</b>: Constant.
-   inline reverse_iterator rend() BOOST_NOEXCEPT
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR reverse_iterator rend() BOOST_NOEXCEPT
    { return reverse_iterator(begin()); }
 
    //! <b>Effects</b>: Returns a const_reverse_iterator pointing to the end
@@ -488,7 +504,7 @@ class list_impl
    //! <b>Throws</b>: Nothing.
    //!
    //! <b>Complexity</b>: Constant.
-   inline const_reverse_iterator rend() const BOOST_NOEXCEPT
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR const_reverse_iterator rend() const BOOST_NOEXCEPT
    { return this->crend(); }
 
    //! <b>Effects</b>: Returns a const_reverse_iterator pointing to the end
@@ -497,7 +513,7 @@ class list_impl
    //! <b>Throws</b>: Nothing.
    //!
    //! <b>Complexity</b>: Constant.
-   inline const_reverse_iterator crend() const BOOST_NOEXCEPT
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR const_reverse_iterator crend() const BOOST_NOEXCEPT
    { return const_reverse_iterator(this->begin()); }
 
    //! <b>Precondition</b>: end_iterator must be a valid end iterator
@@ -509,7 +525,7 @@ class list_impl
    //!
    //! <b>Complexity</b>: Constant.
    BOOST_INTRUSIVE_NO_DANGLING
-   inline static list_impl &container_from_end_iterator(iterator end_iterator) BOOST_NOEXCEPT
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR static list_impl &container_from_end_iterator(iterator end_iterator) BOOST_NOEXCEPT
    {  return list_impl::priv_container_from_end_iterator(end_iterator);   }
 
    //! <b>Precondition</b>: end_iterator must be a valid end const_iterator
@@ -521,7 +537,7 @@ class list_impl
    //!
    //! <b>Complexity</b>: Constant.
    BOOST_INTRUSIVE_NO_DANGLING
-   inline static const list_impl &container_from_end_iterator(const_iterator end_iterator) BOOST_NOEXCEPT
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR static const list_impl &container_from_end_iterator(const_iterator end_iterator) BOOST_NOEXCEPT
    {  return list_impl::priv_container_from_end_iterator(end_iterator);   }
 
    //! <b>Effects</b>: Returns the number of the elements contained in the list.
@@ -532,7 +548,7 @@ class list_impl
    //!   if constant-time size option is disabled. Constant time otherwise.
    //!
    //! <b>Note</b>: Does not affect the validity of iterators and references.
-   inline size_type size() const BOOST_NOEXCEPT
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR size_type size() const BOOST_NOEXCEPT
    {
       BOOST_IF_CONSTEXPR(constant_time_size)
          return this->priv_size_traits().get_size();
@@ -547,7 +563,7 @@ class list_impl
    //! <b>Complexity</b>: Constant.
    //!
    //! <b>Note</b>: Does not affect the validity of iterators and references.
-   inline bool empty() const BOOST_NOEXCEPT
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR bool empty() const BOOST_NOEXCEPT
    {  return node_algorithms::unique(this->get_root_node());   }
 
    //! <b>Effects</b>: Swaps the elements of x and *this.
@@ -557,7 +573,7 @@ class list_impl
    //! <b>Complexity</b>: Constant.
    //!
    //! <b>Note</b>: Does not affect the validity of iterators and references.
-   void swap(list_impl& other) BOOST_NOEXCEPT
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR void swap(list_impl& other) BOOST_NOEXCEPT
    {
       node_algorithms::swap_nodes(this->get_root_node(), other.get_root_node());
       this->priv_size_traits().swap(other.priv_size_traits());
@@ -569,11 +585,15 @@ class list_impl
    //!
    //! <b>Throws</b>: Nothing.
    //!
-   //! <b>Complexity</b>: Linear to the number of shifts.
+   //! <b>Complexity</b>: Linear to the number of shifts, plus linear to size()
+   //!   if the hook stores order labels.
    //!
    //! <b>Note</b>: Does not affect the validity of iterators and references.
-   inline void shift_backwards(size_type n = 1) BOOST_NOEXCEPT
-   {  node_algorithms::move_forward(this->get_root_node(), n);  }
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR void shift_backwards(size_type n = 1) BOOST_NOEXCEPT
+   {
+      node_algorithms::move_forward(this->get_root_node(), n);
+      this->priv_relabel();
+   }
 
    //! <b>Effects</b>: Moves forward all the elements, so that the second
    //!   element becomes the first, the third becomes the second...
@@ -581,11 +601,15 @@ class list_impl
    //!
    //! <b>Throws</b>: Nothing.
    //!
-   //! <b>Complexity</b>: Linear to the number of shifts.
+   //! <b>Complexity</b>: Linear to the number of shifts, plus linear to size()
+   //!   if the hook stores order labels.
    //!
    //! <b>Note</b>: Does not affect the validity of iterators and references.
-   inline void shift_forward(size_type n = 1) BOOST_NOEXCEPT
-   {  node_algorithms::move_backwards(this->get_root_node(), n);  }
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR void shift_forward(size_type n = 1) BOOST_NOEXCEPT
+   {
+      node_algorithms::move_backwards(this->get_root_node(), n);
+      this->priv_relabel();
+   }
 
    //! <b>Effects</b>: Erases the element pointed by i of the list.
    //!   No destructors are called.
@@ -599,7 +623,7 @@ class list_impl
    //!
    //! <b>Note</b>: Invalidates the iterators (but not the references) to the
    //!   erased element.
-   inline iterator erase(const_iterator i) BOOST_NOEXCEPT
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR iterator erase(const_iterator i) BOOST_NOEXCEPT
    {  return this->erase_and_dispose(i, detail::null_disposer());  }
 
    //! <b>Requires</b>: b and e must be valid iterators to elements in *this.
@@ -617,7 +641,7 @@ class list_impl
    //!
    //! <b>Note</b>: Invalidates the iterators (but not the references) to the
    //!   erased elements.
-   inline iterator erase(const_iterator b, const_iterator e) BOOST_NOEXCEPT
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR iterator erase(const_iterator b, const_iterator e) BOOST_NOEXCEPT
    {
       BOOST_IF_CONSTEXPR(safemode_or_autounlink || constant_time_size){
          return this->erase_and_dispose(b, e, detail::null_disposer());
@@ -644,7 +668,7 @@ class list_impl
    //!
    //! <b>Note</b>: Invalidates the iterators (but not the references) to the
    //!   erased elements.
-   iterator erase(const_iterator b, const_iterator e, size_type n) BOOST_NOEXCEPT
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR iterator erase(const_iterator b, const_iterator e, size_type n) BOOST_NOEXCEPT
    {
       BOOST_INTRUSIVE_INVARIANT_ASSERT(node_algorithms::distance(b.pointed_node(), e.pointed_node()) == n);
       (void)n;
@@ -675,7 +699,7 @@ class list_impl
    //!
    //! <b>Note</b>: Invalidates the iterators to the erased element.
    template <class Disposer>
-   iterator erase_and_dispose(const_iterator i, Disposer disposer) BOOST_NOEXCEPT
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR iterator erase_and_dispose(const_iterator i, Disposer disposer) BOOST_NOEXCEPT
    {
       node_ptr to_erase(i.pointed_node());
       ++i;
@@ -689,7 +713,7 @@ class list_impl
 
    #if !defined(BOOST_INTRUSIVE_DOXYGEN_INVOKED)
    template<class Disposer>
-   iterator erase_and_dispose(iterator i, Disposer disposer) BOOST_NOEXCEPT
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR iterator erase_and_dispose(iterator i, Disposer disposer) BOOST_NOEXCEPT
    {  return this->erase_and_dispose(const_iterator(i), disposer);   }
    #endif
 
@@ -708,7 +732,7 @@ class list_impl
    //!
    //! <b>Note</b>: Invalidates the iterators to the erased elements.
    template <class Disposer>
-   iterator erase_and_dispose(const_iterator b, const_iterator e, Disposer disposer) BOOST_NOEXCEPT
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR iterator erase_and_dispose(const_iterator b, const_iterator e, Disposer disposer) BOOST_NOEXCEPT
    {
       node_ptr bp(b.pointed_node()), ep(e.pointed_node());
       node_algorithms::unlink(bp, ep);
@@ -732,7 +756,7 @@ class list_impl
    //!   if it's a safe-mode or auto-unlink value_type. Constant time otherwise.
    //!
    //! <b>Note</b>: Invalidates the iterators (but not the references) to the erased elements.
-   void clear() BOOST_NOEXCEPT
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR void clear() BOOST_NOEXCEPT
    {
       BOOST_IF_CONSTEXPR(safemode_or_autounlink){
          this->clear_and_dispose(detail::null_disposer());
@@ -755,7 +779,7 @@ class list_impl
    //!
    //! <b>Note</b>: Invalidates the iterators to the erased elements.
    template <class Disposer>
-   void clear_and_dispose(Disposer disposer) BOOST_NOEXCEPT
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR void clear_and_dispose(Disposer disposer) BOOST_NOEXCEPT
    {
       const_iterator it(this->begin()), itend(this->end());
       while(it != itend){
@@ -769,6 +793,28 @@ class list_impl
       this->priv_size_traits().set_size(0);
    }
 
+   //! <b>Requires</b>: Disposer::operator()(pointer) shouldn't throw.
+   //!
+   //! <b>Effects</b>: Erases up to max_nodes elements from the front of the list.
+   //!   Disposer::operator()(pointer) is called for the removed elements.
+   //!   The destruction of a big container can be split in several calls,
+   //!   each one doing bounded work. The list remains usable between calls.
+   //!
+   //! <b>Returns</b>: true if the container is empty after the call.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Linear to max_nodes.
+   //!
+   //! <b>Note</b>: Invalidates the iterators to the erased elements.
+   template <class Disposer>
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR bool clear_and_dispose_some(Disposer disposer, size_type max_nodes) BOOST_NOEXCEPT
+   {
+      for(; max_nodes && !this->empty(); --max_nodes)
+         this->pop_front_and_dispose(disposer);
+      return this->empty();
+   }
+
    //! <b>Requires</b>: Disposer::operator()(pointer) shouldn't throw.
    //!   Cloner should yield to nodes equivalent to the original nodes.
    //!
@@ -784,7 +830,7 @@ class list_impl
    //!
    //! <b>Throws</b>: If cloner throws. Basic guarantee.
    template <class Cloner, class Disposer>
-   void clone_from(const list_impl &src, Cloner cloner, Disposer disposer)
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR void clone_from(const list_impl &src, Cloner cloner, Disposer disposer)
    {
       this->clear_and_dispose(disposer);
       detail::exception_disposer<list_impl, Disposer>
@@ -811,7 +857,7 @@ class list_impl
    //!
    //! <b>Throws</b>: If cloner throws. Basic guarantee.
    template <class Cloner, class Disposer>
-   void clone_from(BOOST_RV_REF(list_impl) src, Cloner cloner, Disposer disposer)
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR void clone_from(BOOST_RV_REF(list_impl) src, Cloner cloner, Disposer disposer)
    {
       this->clear_and_dispose(disposer);
       detail::exception_disposer<list_impl, Disposer>
@@ -823,6 +869,55 @@ class list_impl
       rollback.release();
    }
 
+   //! <b>Requires</b>: Relocator::operator()(reference) must return a pointer to a new
+   //!   object whose hook is not linked in any container, or a pointer to the passed
+   //!   object if it must stay in place. Disposer::operator()(pointer) shouldn't throw.
+   //!
+   //! <b>Effects</b>: Visits the elements from front to back calling Relocator::operator()(reference)
+   //!   for each one and puts the returned object in the position of the visited one.
+   //!   Disposer::operator()(pointer) is then called for each replaced object.
+   //!
+   //!   As the relocator is called in order, a relocator that obtains new storage
+   //!   sequentially (e.g. from a bump allocator or a fresh arena) lays out
+   //!   the elements in traversal order, so that later traversals access
+   //!   memory sequentially.
+   //!
+   //! <b>Complexity</b>: Linear to the number of elements.
+   //!
+   //! <b>Throws</b>: If relocator throws. Basic guarantee: elements
+   //!   already relocated stay in their new storage.
+   //!
+   //! <b>Note</b>: Invalidates the iterators to replaced elements.
+   template <class Relocator, class Disposer>
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR void relocate(Relocator relocator, Disposer disposer)
+   {
+      const node_ptr root = this->get_root_node();
+      node_ptr p = node_traits::get_next(root);
+      while(p != root){
+         const node_ptr new_node = priv_value_traits().to_node_ptr
+            (*relocator(*priv_value_traits().to_value_ptr(p)));
+         if(new_node != p){
+            BOOST_INTRUSIVE_SAFE_HOOK_DEFAULT_ASSERT(!safemode_or_autounlink || node_algorithms::inited(new_node));
+            node_algorithms::link_before(p, new_node);
+            this->priv_label(new_node, p);
+            const node_ptr next = node_algorithms::unlink(p);
+            BOOST_IF_CONSTEXPR(safemode_or_autounlink)
+               node_algorithms::init(p);
+            disposer(priv_value_traits().to_value_ptr(p));
+            p = next;
+         }
+         else{
+            p = node_traits::get_next(p);
+         }
+      }
+   }
+
+   //! <b>Effects</b>: Same as relocate(relocator, disposer) with a disposer that does nothing:
+   //!   replaced objects are left unlinked, so they can be destroyed afterwards.
+   template <class Relocator>
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR void relocate(Relocator relocator)
+   {  this->relocate(relocator, detail::null_disposer());  }
+
    //! <b>Requires</b>: value must be an lvalue and p must be a valid iterator of *this.
    //!
    //! <b>Effects</b>: Inserts the value before the position pointed by p.
@@ -834,11 +929,12 @@ class list_impl
    //! <b>Complexity</b>: Constant time. No copy constructors are called.
    //!
    //! <b>Note</b>: Does not affect the validity of iterators and references.
-   iterator insert(const_iterator p, reference value) BOOST_NOEXCEPT
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR iterator insert(const_iterator p, reference value) BOOST_NOEXCEPT
    {
       node_ptr to_insert = this->priv_value_traits().to_node_ptr(value);
       BOOST_INTRUSIVE_SAFE_HOOK_DEFAULT_ASSERT(!safemode_or_autounlink || node_algorithms::inited(to_insert));
       node_algorithms::link_before(p.pointed_node(), to_insert);
+      this->priv_label(to_insert, p.pointed_node());
       this->priv_size_traits().increment();
       return iterator(to_insert, this->priv_value_traits_ptr());
    }
@@ -855,7 +951,7 @@ class list_impl
    //!
    //! <b>Note</b>: Does not affect the validity of iterators and references.
    template<class Iterator>
-   void insert(const_iterator p, Iterator b, Iterator e) BOOST_NOEXCEPT
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR void insert(const_iterator p, Iterator b, Iterator e) BOOST_NOEXCEPT
    {
       for (; b != e; ++b)
          this->insert(p, *b);
@@ -877,7 +973,7 @@ class list_impl
    //! <b>Note</b>: Invalidates the iterators (but not the references)
    //!   to the erased elements.
    template<class Iterator>
-   void assign(Iterator b, Iterator e) BOOST_NOEXCEPT
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR void assign(Iterator b, Iterator e) BOOST_NOEXCEPT
    {
       this->clear();
       this->insert(this->cend(), b, e);
@@ -900,7 +996,7 @@ class list_impl
    //! <b>Note</b>: Invalidates the iterators (but not the references)
    //!   to the erased elements.
    template<class Iterator, class Disposer>
-   void dispose_and_assign(Disposer disposer, Iterator b, Iterator e) BOOST_NOEXCEPT
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR void dispose_and_assign(Disposer disposer, Iterator b, Iterator e) BOOST_NOEXCEPT
    {
       this->clear_and_dispose(disposer);
       this->insert(this->cend(), b, e);
@@ -913,15 +1009,17 @@ class list_impl
    //!
    //! <b>Throws</b>: Nothing.
    //!
-   //! <b>Complexity</b>: Constant.
+   //! <b>Complexity</b>: Constant, plus linear to the number of elements transferred
+   //!   if the hook stores order labels.
    //!
    //! <b>Note</b>: Iterators of values obtained from list x now point to elements of
    //!    this list. Iterators of this list and all the references are not invalidated.
-   void splice(const_iterator p, list_impl& x) BOOST_NOEXCEPT
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR void splice(const_iterator p, list_impl& x) BOOST_NOEXCEPT
    {
       if(!x.empty()){
-         node_algorithms::transfer
-            (p.pointed_node(), x.begin().pointed_node(), x.end().pointed_node());
+         const node_ptr first = x.begin().pointed_node();
+         node_algorithms::transfer(p.pointed_node(), first, x.end().pointed_node());
+         this->priv_label(first, p.pointed_node());
          size_traits &thist = this->priv_size_traits();
          size_traits &xt = x.priv_size_traits();
          thist.increase(xt.get_size());
@@ -942,9 +1040,10 @@ class list_impl
    //!
    //! <b>Note</b>: Iterators of values obtained from list x now point to elements of this
    //!   list. Iterators of this list and all the references are not invalidated.
-   void splice(const_iterator p, list_impl&x, const_iterator new_ele) BOOST_NOEXCEPT
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR void splice(const_iterator p, list_impl&x, const_iterator new_ele) BOOST_NOEXCEPT
    {
       node_algorithms::transfer(p.pointed_node(), new_ele.pointed_node());
+      this->priv_label(new_ele.pointed_node(), p.pointed_node());
       x.priv_size_traits().decrement();
       this->priv_size_traits().increment();
    }
@@ -958,11 +1057,12 @@ class list_impl
    //! <b>Throws</b>: Nothing.
    //!
    //! <b>Complexity</b>: Linear to the number of elements transferred
-   //!   if constant-time size option is enabled. Constant-time otherwise.
+   //!   if constant-time size option is enabled or the hook stores order labels.
+   //!   Constant-time otherwise.
    //!
    //! <b>Note</b>: Iterators of values obtained from list x now point to elements of this
    //!   list. Iterators of this list and all the references are not invalidated.
-   void splice(const_iterator p, list_impl&x, const_iterator f, const_iterator e) BOOST_NOEXCEPT
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR void splice(const_iterator p, list_impl&x, const_iterator f, const_iterator e) BOOST_NOEXCEPT
    {
       BOOST_IF_CONSTEXPR(constant_time_size)
          this->splice(p, x, f, e, node_algorithms::distance(f.pointed_node(), e.pointed_node()));
@@ -979,11 +1079,12 @@ class list_impl
    //!
    //! <b>Throws</b>: Nothing.
    //!
-   //! <b>Complexity</b>: Constant.
+   //! <b>Complexity</b>: Constant, plus linear to the number of elements transferred
+   //!   if the hook stores order labels.
    //!
    //! <b>Note</b>: Iterators of values obtained from list x now point to elements of this
    //!   list. Iterators of this list and all the references are not invalidated.
-   void splice(const_iterator p, list_impl&x, const_iterator f, const_iterator e, size_type n) BOOST_NOEXCEPT
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR void splice(const_iterator p, list_impl&x, const_iterator f, const_iterator e, size_type n) BOOST_NOEXCEPT
    {
       if(n){
          BOOST_IF_CONSTEXPR(constant_time_size){
@@ -997,6 +1098,7 @@ class list_impl
          else{
             node_algorithms::transfer(p.pointed_node(), f.pointed_node(), e.pointed_node());
          }
+         this->priv_label(f.pointed_node(), p.pointed_node());
       }
    }
 
@@ -1011,7 +1113,7 @@ class list_impl
    //!
    //! <b>Complexity</b>: The number of comparisons is approximately N log N, where N
    //!   is the list's size.
-   void sort()
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR void sort()
    {  this->sort(value_less<value_type>());  }
 
    //! <b>Requires</b>: p must be a comparison function that induces a strict weak ordering
@@ -1030,27 +1132,78 @@ class list_impl
    //! <b>Complexity</b>: The number of comparisons is approximately N log N, where N
    //!   is the list's size.
    template<class Predicate>
-   void sort(Predicate p)
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR void sort(Predicate p)
    {
-      if(node_traits::get_next(this->get_root_node())
-         != node_traits::get_previous(this->get_root_node())){
-         list_impl carry(this->priv_value_traits());
-         detail::array_initializer<list_impl, 64> counter(this->priv_value_traits());
-         int fill = 0;
-         while(!this->empty()){
-            carry.splice(carry.cbegin(), *this, this->cbegin());
-            int i = 0;
-            while(i < fill && !counter[i].empty()) {
-               counter[i].merge(carry, p);
-               carry.swap(counter[i++]);
-            }
-            carry.swap(counter[i]);
-            if(i == fill)
-               ++fill;
+      //The array of temporary lists used by the bottom-up merge sort can't be
+      //built in constant evaluation, so a top-down merge sort is used instead
+      if(BOOST_INTRUSIVE_IS_CONSTANT_EVALUATED())
+         this->priv_top_down_sort(p, this->size());
+      else
+         this->priv_bottom_up_sort(p);
+   }
+
+   //! <b>Requires</b>: p must be a comparison function that induces a strict weak ordering.
+   //!   p must be safe to call concurrently and Executor must model the executor concept
+   //!   described in sequential_executor.
+   //!
+   //! <b>Effects</b>: Same as sort(p), but the list is split in up to 16 chunks with splice,
+   //!   chunks are sorted by tasks run through <tt>executor(task1, task2)</tt> and sorted
+   //!   chunks are merged pairwise, in the task that forked them. Only lists with more
+   //!   than some thousands of elements are split. The sort is stable and no memory is allocated.
+   //!
+   //! <b>Throws</b>: If the predicate or the executor throw. Basic guarantee.
+   //!
+   //! <b>Notes</b>: Iterators and references are not invalidated.
+   //!
+   //! <b>Complexity</b>: The number of comparisons is approximately N log N, where N
+   //!   is the list's size.
+   template<class Predicate, class Executor>
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR void sort(Predicate p, Executor executor)
+   {
+      const size_type n = this->size();
+      std::size_t levels = 0u;
+      for(size_type sz = n; levels != 4u && (sz >>= 1u) >= 1024u; )
+         ++levels;
+      this->priv_sort(p, executor, levels, n);
+   }
+
+   //! <b>Requires</b>: KeyOfValue::type must be the type of the keys returned by
+   //!   key_of_value(const value_type &) and keys must be comparable with operator<,
+   //!   which must induce a strict weak ordering.
+   //!
+   //! <b>Effects</b>: This function sorts the list *this according to the keys
+   //!   of the elements. The sort is stable, that is, the relative order of
+   //!   elements with equivalent keys is preserved.
+   //!
+   //!   Integral keys are sorted with a radix sort that relinks the elements in a chain
+   //!   per value of each byte, skipping the bytes that are equal in all keys.
+   //!   Other keys, or integral keys that form a few ordered runs, are sorted with a natural
+   //!   merge sort that merges the ordered runs found in the list. No memory is allocated.
+   //!
+   //! <b>Throws</b>: If key_of_value or operator< throws. Basic guarantee: all the elements
+   //!   remain in the list in an unspecified order.
+   //!
+   //! <b>Complexity</b>: For integral keys, linear to the number of elements times the number
+   //!   of bytes in which keys differ. Otherwise, the number of comparisons is approximately
+   //!   N log R, where N is the list's size and R the number of ordered runs.
+   //!
+   //! <b>Note</b>: Iterators and references are not invalidated.
+   template<class KeyOfValue>
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR void sort_by_key(KeyOfValue key_of_value)
+   {
+      const node_ptr root = this->get_root_node();
+      if(node_traits::get_next(root) != node_traits::get_previous(root)){
+         node_ptr last;
+         BOOST_INTRUSIVE_TRY{
+            detail::key_sort_algorithms<node_traits, true>::sort
+               (root, root, detail::key_nodeptr_less<KeyOfValue, value_traits>(key_of_value, this->priv_value_traits()), last);
          }
-         for (int i = 1; i < fill; ++i)
-            counter[i].merge(counter[i-1], p);
-         this->swap(counter[fill-1]);
+         BOOST_INTRUSIVE_CATCH(...){
+            this->priv_relabel();
+            BOOST_INTRUSIVE_RETHROW;
+         }
+         BOOST_INTRUSIVE_CATCH_END
+         this->priv_relabel();
       }
    }
 
@@ -1065,7 +1218,7 @@ class list_impl
    //!   size() + x.size() - 1 comparisons.
    //!
    //! <b>Note</b>: Iterators and references are not invalidated
-   void merge(list_impl& x)
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR void merge(list_impl& x)
    { this->merge(x, value_less<value_type>()); }
 
    //! <b>Requires</b>: p must be a comparison function that induces a strict weak
@@ -1083,7 +1236,7 @@ class list_impl
    //!
    //! <b>Note</b>: Iterators and references are not invalidated.
    template<class Predicate>
-   void merge(list_impl& x, Predicate p)
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR void merge(list_impl& x, Predicate p)
    {
       const_iterator e(this->cend()), ex(x.cend());
       const_iterator b(this->cbegin());
@@ -1114,8 +1267,11 @@ class list_impl
    //! <b>Complexity</b>: This function is linear time.
    //!
    //! <b>Note</b>: Iterators and references are not invalidated
-   void reverse() BOOST_NOEXCEPT
-   {  node_algorithms::reverse(this->get_root_node());   }
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR void reverse() BOOST_NOEXCEPT
+   {
+      node_algorithms::reverse(this->get_root_node());
+      this->priv_relabel();
+   }
 
    //! <b>Effects</b>: Removes all the elements that compare equal to value.
    //!   No destructors are called.
@@ -1126,7 +1282,7 @@ class list_impl
    //!
    //! <b>Note</b>: The relative order of elements that are not removed is unchanged,
    //!   and iterators to elements that are not removed remain valid.
-   size_type remove(const_reference value) BOOST_NOEXCEPT
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR size_type remove(const_reference value) BOOST_NOEXCEPT
    {  return this->remove_if(detail::equal_to_value<const_reference>(value));  }
 
    //! <b>Requires</b>: Disposer::operator()(pointer) shouldn't throw.
@@ -1143,7 +1299,7 @@ class list_impl
    //! <b>Note</b>: The relative order of elements that are not removed is unchanged,
    //!   and iterators to elements that are not removed remain valid.
    template<class Disposer>
-   size_type remove_and_dispose(const_reference value, Disposer disposer) BOOST_NOEXCEPT
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR size_type remove_and_dispose(const_reference value, Disposer disposer) BOOST_NOEXCEPT
    {  return this->remove_and_dispose_if(detail::equal_to_value<const_reference>(value), disposer);  }
 
    //! <b>Effects</b>: Removes all the elements for which a specified
@@ -1158,7 +1314,7 @@ class list_impl
    //! <b>Note</b>: The relative order of elements that are not removed is unchanged,
    //!   and iterators to elements that are not removed remain valid.
    template<class Pred>
-   size_type remove_if(Pred pred)
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR size_type remove_if(Pred pred)
    {
       const node_ptr root_node = this->get_root_node();
       typename node_algorithms::stable_partition_info info;
@@ -1187,7 +1343,7 @@ class list_impl
    //! <b>Note</b>: The relative order of elements that are not removed is unchanged,
    //!   and iterators to elements that are not removed remain valid.
    template<class Pred, class Disposer>
-   size_type remove_and_dispose_if(Pred pred, Disposer disposer)
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR size_type remove_and_dispose_if(Pred pred, Disposer disposer)
    {
       const node_ptr root_node = this->get_root_node();
       typename node_algorithms::stable_partition_info info;
@@ -1212,7 +1368,7 @@ class list_impl
    //!
    //! <b>Note</b>: The relative order of elements that are not removed is unchanged,
    //!   and iterators to elements that are not removed remain valid.
-   size_type unique()
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR size_type unique()
    {  return this->unique_and_dispose(value_equal<value_type>(), detail::null_disposer());  }
 
    //! <b>Effects</b>: Removes adjacent duplicate elements or adjacent
@@ -1228,7 +1384,7 @@ class list_impl
    //! <b>Note</b>: The relative order of elements that are not removed is unchanged,
    //!   and iterators to elements that are not removed remain valid.
    template<class BinaryPredicate>
-   size_type unique(BinaryPredicate pred)
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR size_type unique(BinaryPredicate pred)
    {  return this->unique_and_dispose(pred, detail::null_disposer());  }
 
    //! <b>Requires</b>: Disposer::operator()(pointer) shouldn't throw.
@@ -1246,7 +1402,7 @@ class list_impl
    //! <b>Note</b>: The relative order of elements that are not removed is unchanged,
    //!   and iterators to elements that are not removed remain valid.
    template<class Disposer>
-   size_type unique_and_dispose(Disposer disposer)
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR size_type unique_and_dispose(Disposer disposer)
    {  return this->unique_and_dispose(value_equal<value_type>(), disposer);  }
 
    //! <b>Requires</b>: Disposer::operator()(pointer) shouldn't throw.
@@ -1264,7 +1420,7 @@ class list_impl
    //! <b>Note</b>: The relative order of elements that are not removed is unchanged,
    //!   and iterators to elements that are not removed remain valid.
    template<class BinaryPredicate, class Disposer>
-   size_type unique_and_dispose(BinaryPredicate pred, Disposer disposer)
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR size_type unique_and_dispose(BinaryPredicate pred, Disposer disposer)
    {
       const_iterator itend(this->cend());
       const_iterator cur(this->cbegin());
@@ -1298,7 +1454,7 @@ class list_impl
    //! <b>Note</b>: Iterators and references are not invalidated.
    //!   This static function is available only if the <i>value traits</i>
    //!   is stateless.
-   static iterator s_iterator_to(reference value) BOOST_NOEXCEPT
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR static iterator s_iterator_to(reference value) BOOST_NOEXCEPT
    {
       BOOST_INTRUSIVE_STATIC_ASSERT((!stateful_value_traits));
       BOOST_INTRUSIVE_INVARIANT_ASSERT(!node_algorithms::inited(value_traits::to_node_ptr(value)));
@@ -1316,7 +1472,7 @@ class list_impl
    //! <b>Note</b>: Iterators and references are not invalidated.
    //!   This static function is available only if the <i>value traits</i>
    //!   is stateless.
-   static const_iterator s_iterator_to(const_reference value) BOOST_NOEXCEPT
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR static const_iterator s_iterator_to(const_reference value) BOOST_NOEXCEPT
    {
       BOOST_INTRUSIVE_STATIC_ASSERT((!stateful_value_traits));
       reference r =*detail::uncast(pointer_traits<const_pointer>::pointer_to(value));
@@ -1333,7 +1489,7 @@ class list_impl
    //! <b>Complexity</b>: Constant time.
    //!
    //! <b>Note</b>: Iterators and references are not invalidated.
-   iterator iterator_to(reference value) BOOST_NOEXCEPT
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR iterator iterator_to(reference value) BOOST_NOEXCEPT
    {
       BOOST_INTRUSIVE_INVARIANT_ASSERT(!node_algorithms::inited(this->priv_value_traits().to_node_ptr(value)));
       return iterator(this->priv_value_traits().to_node_ptr(value), this->priv_value_traits_ptr());
@@ -1348,20 +1504,38 @@ class list_impl
    //! <b>Complexity</b>: Constant time.
    //!
    //! <b>Note</b>: Iterators and references are not invalidated.
-   const_iterator iterator_to(const_reference value) const BOOST_NOEXCEPT
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR const_iterator iterator_to(const_reference value) const BOOST_NOEXCEPT
    {
       reference r = *detail::uncast(pointer_traits<const_pointer>::pointer_to(value));
       BOOST_INTRUSIVE_INVARIANT_ASSERT(!node_algorithms::inited(this->priv_value_traits().to_node_ptr(r)));
       return const_iterator(this->priv_value_traits().to_node_ptr(r), this->priv_value_traits_ptr());
    }
 
+   //! <b>Requires</b>: The hook must store order labels (\c order_labels<true>).
+   //!   a and b must be valid iterators of *this.
+   //!
+   //! <b>Returns</b>: true if a is placed before b in the list, that is, if b is
+   //!   reached by incrementing a a non-zero number of times. end() does not precede any iterator
+   //!   and any other iterator precedes end().
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant time.
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR bool precedes(const_iterator a, const_iterator b) const BOOST_NOEXCEPT
+   {
+      BOOST_INTRUSIVE_STATIC_ASSERT((order_labels));
+      const const_node_ptr header_ptr = this->get_root_node();
+      return a.pointed_node() != header_ptr &&
+         (b.pointed_node() == header_ptr || this->priv_precedes(a.pointed_node(), b.pointed_node()));
+   }
+
    //! <b>Effects</b>: Asserts the integrity of the container.
    //!
    //! <b>Complexity</b>: Linear time.
    //!
    //! <b>Note</b>: The method has no effect when asserts are turned off (e.g., with NDEBUG).
    //!   Experimental function, interface might change in future versions.
-   void check() const
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR void check() const
    {
       const_node_ptr header_ptr = get_root_node();
       // header's next and prev are never null
@@ -1383,6 +1557,8 @@ class list_impl
          const_node_ptr next_p = node_traits::get_next(p);
          BOOST_INTRUSIVE_INVARIANT_ASSERT(next_p);
          BOOST_INTRUSIVE_INVARIANT_ASSERT(node_traits::get_previous(next_p) == p);
+         // order labels increase along the list
+         BOOST_INTRUSIVE_INVARIANT_ASSERT(p == header_ptr || next_p == header_ptr || this->priv_precedes(p, next_p));
          p = next_p;
          if (p == header_ptr) break;
          ++node_count;
@@ -1391,7 +1567,7 @@ class list_impl
          BOOST_INTRUSIVE_INVARIANT_ASSERT(this->priv_size_traits().get_size() == node_count);
    }
 
-   friend bool operator==(const list_impl &x, const list_impl &y)
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR friend bool operator==(const list_impl &x, const list_impl &y)
    {
       BOOST_IF_CONSTEXPR(constant_time_size)
       if(x.size() != y.size()){
@@ -1400,29 +1576,157 @@ class list_impl
       return ::boost::intrusive::algo_equal(x.cbegin(), x.cend(), y.cbegin(), y.cend());
    }
 
-   inline friend bool operator!=(const list_impl &x, const list_impl &y)
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR friend bool operator!=(const list_impl &x, const list_impl &y)
    {  return !(x == y); }
 
-   inline friend bool operator<(const list_impl &x, const list_impl &y)
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR friend bool operator<(const list_impl &x, const list_impl &y)
    {  return ::boost::intrusive::algo_lexicographical_compare(x.begin(), x.end(), y.begin(), y.end());  }
 
-   inline friend bool operator>(const list_impl &x, const list_impl &y)
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR friend bool operator>(const list_impl &x, const list_impl &y)
    {  return y < x;  }
 
-   inline friend bool operator<=(const list_impl &x, const list_impl &y)
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR friend bool operator<=(const list_impl &x, const list_impl &y)
    {  return !(y < x);  }
 
-   inline friend bool operator>=(const list_impl &x, const list_impl &y)
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR friend bool operator>=(const list_impl &x, const list_impl &y)
    {  return !(x < y);  }
 
-   inline friend void swap(list_impl &x, list_impl &y) BOOST_NOEXCEPT
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR friend void swap(list_impl &x, list_impl &y) BOOST_NOEXCEPT
    {  x.swap(y);  }
 
    /// @cond
 
    private:
+   //Sorts a list. Executors are allowed to copy the task, so the list is held by pointer.
+   template<class Predicate, class Executor>
+   struct sort_task
+   {
+      sort_task(list_impl &l, Predicate &p, Executor &executor, std::size_t fork_levels, size_type n)
+         : list_(&l), p_(p), executor_(&executor), fork_levels_(fork_levels), n_(n)
+      {}
+
+      void operator()()
+      {  list_->priv_sort(p_, *executor_, fork_levels_, n_);  }
+
+      list_impl *list_;
+      Predicate p_;
+      Executor *executor_;
+      std::size_t fork_levels_;
+      size_type n_;
+   };
+
+   template<class Predicate>
+   void priv_bottom_up_sort(Predicate &p)
+   {
+      if(node_traits::get_next(this->get_root_node())
+         != node_traits::get_previous(this->get_root_node())){
+         list_impl carry(this->priv_value_traits());
+         detail::array_initializer<list_impl, 64> counter(this->priv_value_traits());
+         int fill = 0;
+         BOOST_INTRUSIVE_TRY{
+            while(!this->empty()){
+               carry.splice(carry.cbegin(), *this, this->cbegin());
+               int i = 0;
+               while(i < fill && !counter[i].empty()) {
+                  counter[i].merge(carry, p);
+                  carry.swap(counter[i++]);
+               }
+               carry.swap(counter[i]);
+               if(i == fill)
+                  ++fill;
+            }
+            for (int i = 1; i < fill; ++i)
+               counter[i].merge(counter[i-1], p);
+         }
+         BOOST_INTRUSIVE_CATCH(...){
+            //Elements held by the local lists are linked again in *this
+            this->splice(this->cend(), carry);
+            for (int i = 0; i < fill; ++i)
+               this->splice(this->cend(), counter[i]);
+            BOOST_INTRUSIVE_RETHROW;
+         }
+         BOOST_INTRUSIVE_CATCH_END
+         this->swap(counter[fill-1]);
+      }
+   }
+
+   //Splices the second half of the list to another list,
+   //sorts both halves recursively and merges them
+   template<class Predicate>
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR void priv_top_down_sort(Predicate &p, size_type n)
+   {
+      if(n > 1u){
+         const size_type half = n/2u;
+         const_iterator mid(this->cbegin());
+         for(size_type i = 0; i != half; ++i)
+            ++mid;
+         list_impl other(this->priv_value_traits());
+         other.splice(other.cend(), *this, mid, this->cend(), n - half);
+         this->priv_top_down_sort(p, half);
+         other.priv_top_down_sort(p, n - half);
+         this->merge(other, p);
+      }
+   }
+
+   //Splices the second half of the list to another list, sorts both halves
+   //in different tasks and merges them
+   template<class Predicate, class Executor>
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR void priv_sort(Predicate &p, Executor &executor, std::size_t fork_levels, size_type n)
+   {
+      if(!fork_levels){
+         this->sort(p);
+         return;
+      }
+      const size_type half = n/2u;
+      const_iterator mid(this->cbegin());
+      for(size_type i = 0; i != half; ++i)
+         ++mid;
+      list_impl other(this->priv_value_traits());
+      other.splice(other.cend(), *this, mid, this->cend(), n - half);
+      sort_task<Predicate, Executor> first_task (*this, p, executor, fork_levels - 1u, half);
+      sort_task<Predicate, Executor> second_task(other, p, executor, fork_levels - 1u, n - half);
+      BOOST_INTRUSIVE_TRY{
+         executor(first_task, second_task);
+         this->merge(other, p);
+      }
+      BOOST_INTRUSIVE_CATCH(...){
+         //Elements not merged yet are linked to the local list
+         this->splice(this->cend(), other);
+         BOOST_INTRUSIVE_RETHROW;
+      }
+      BOOST_INTRUSIVE_CATCH_END
+   }
+
+   //Labels [first, e) after linking it in *this, if the hook stores order labels
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR void priv_label(node_ptr first, node_ptr e) BOOST_NOEXCEPT
+   {  this->priv_label(first, e, detail::bool_<order_labels>());  }
+
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR void priv_label(node_ptr, node_ptr, detail::false_) BOOST_NOEXCEPT
+   {}
+
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR void priv_label(node_ptr first, node_ptr e, detail::true_) BOOST_NOEXCEPT
+   {  order_list_algorithms<node_traits>::label_range(this->get_root_node(), first, e);  }
+
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR void priv_relabel() BOOST_NOEXCEPT
+   {  this->priv_relabel(detail::bool_<order_labels>());  }
+
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR void priv_relabel(detail::false_) BOOST_NOEXCEPT
+   {}
+
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR void priv_relabel(detail::true_) BOOST_NOEXCEPT
+   {  order_list_algorithms<node_traits>::relabel(this->get_root_node());  }
+
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR static bool priv_precedes(const_node_ptr a, const_node_ptr b) BOOST_NOEXCEPT
+   {  return priv_precedes(a, b, detail::bool_<order_labels>());  }
+
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR static bool priv_precedes(const_node_ptr, const_node_ptr, detail::false_) BOOST_NOEXCEPT
+   {  return true;  }
+
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR static bool priv_precedes(const_node_ptr a, const_node_ptr b, detail::true_) BOOST_NOEXCEPT
+   {  return order_list_algorithms<node_traits>::precedes(a, b);  }
+
    BOOST_INTRUSIVE_NO_DANGLING
-   static list_impl &priv_container_from_end_iterator(const const_iterator &end_iterator) BOOST_NOEXCEPT
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR static list_impl &priv_container_from_end_iterator(const const_iterator &end_iterator) BOOST_NOEXCEPT
    {
       BOOST_INTRUSIVE_STATIC_ASSERT((has_container_from_iterator));
       node_ptr p = end_iterator.pointed_node();
@@ -1504,40 +1808,40 @@ class list
    typedef typename Base::iterator              iterator;
    typedef typename Base::const_iterator        const_iterator;
 
-   inline list()
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR list()
       :  Base()
    {}
 
-   inline explicit list(const value_traits &v_traits)
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR explicit list(const value_traits &v_traits)
       :  Base(v_traits)
    {}
 
    template<class Iterator>
-   inline list(Iterator b, Iterator e, const value_traits &v_traits = value_traits())
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR list(Iterator b, Iterator e, const value_traits &v_traits = value_traits())
       :  Base(b, e, v_traits)
    {}
 
-   inline list(BOOST_RV_REF(list) x)
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR list(BOOST_RV_REF(list) x)
       :  Base(BOOST_MOVE_BASE(Base, x))
    {}
 
-   inline list& operator=(BOOST_RV_REF(list) x)
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR list& operator=(BOOST_RV_REF(list) x)
    {  return static_cast<list &>(this->Base::operator=(BOOST_MOVE_BASE(Base, x)));  }
 
    template <class Cloner, class Disposer>
-   inline void clone_from(const list &src, Cloner cloner, Disposer disposer)
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR void clone_from(const list &src, Cloner cloner, Disposer disposer)
    {  Base::clone_from(src, cloner, disposer);  }
 
    template <class Cloner, class Disposer>
-   inline void clone_from(BOOST_RV_REF(list) src, Cloner cloner, Disposer disposer)
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR void clone_from(BOOST_RV_REF(list) src, Cloner cloner, Disposer disposer)
    {  Base::clone_from(BOOST_MOVE_BASE(Base, src), cloner, disposer);  }
 
    BOOST_INTRUSIVE_NO_DANGLING
-   inline static list &container_from_end_iterator(iterator end_iterator) BOOST_NOEXCEPT
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR static list &container_from_end_iterator(iterator end_iterator) BOOST_NOEXCEPT
    {  return static_cast<list &>(Base::container_from_end_iterator(end_iterator));   }
 
    BOOST_INTRUSIVE_NO_DANGLING
-   inline static const list &container_from_end_iterator(const_iterator end_iterator) BOOST_NOEXCEPT
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR static const list &container_from_end_iterator(const_iterator end_iterator) BOOST_NOEXCEPT
    {  return static_cast<const list &>(Base::container_from_end_iterator(end_iterator));   }
 };
 
@@ -19,6 +19,7 @@
 
 #include <boost/intrusive/detail/list_node.hpp>
 #include <boost/intrusive/circular_list_algorithms.hpp>
+#include <boost/intrusive/order_list_algorithms.hpp>
 #include <boost/intrusive/options.hpp>
 #include <boost/intrusive/detail/generic_hook.hpp>
 
@@ -35,7 +36,7 @@ namespace intrusive {
 #if defined(BOOST_INTRUSIVE_DOXYGEN_INVOKED) || defined(BOOST_INTRUSIVE_VARIADIC_TEMPLATES)
 template<class ...Options>
 #else
-template<class O1 = void, class O2 = void, class O3 = void>
+template<class O1 = void, class O2 = void, class O3 = void, class O4 = void>
 #endif
 struct make_list_base_hook
 {
@@ -43,15 +44,16 @@ struct make_list_base_hook
    typedef typename pack_options
       < hook_defaults,
       #if !defined(BOOST_INTRUSIVE_VARIADIC_TEMPLATES)
-      O1, O2, O3
+      O1, O2, O3, O4
       #else
       Options...
       #endif
       >::type packed_options;
 
    typedef generic_hook
-   < CircularListAlgorithms
-   , list_node_traits<typename packed_options::void_pointer>
+   < packed_options::order_labels ? OrderListAlgorithms : CircularListAlgorithms
+   , typename get_list_node_traits
+      <typename packed_options::void_pointer, packed_options::order_labels>::type
    , typename packed_options::tag
    , packed_options::link_mode
    , ListBaseHookId
@@ -63,8 +65,8 @@ struct make_list_base_hook
 //! Derive a class from this hook in order to store objects of that class
 //! in an list.
 //!
-//! The hook admits the following options: \c tag<>, \c void_pointer<> and
-//! \c link_mode<>.
+//! The hook admits the following options: \c tag<>, \c void_pointer<>,
+//! \c link_mode<> and \c order_labels<>.
 //!
 //! \c tag<> defines a tag to identify the node.
 //! The same tag value can be used in different classes, but if a class is
@@ -76,15 +78,18 @@ struct make_list_base_hook
 //!
 //! \c void_pointer<> is the pointer type that will be used internally in the hook
 //! and the container configured to use this hook.
+//!
+//! \c order_labels<> will tell the hook to store an order label, so that
+//! \c list::precedes can compare the position of two elements in constant time.
 #if defined(BOOST_INTRUSIVE_DOXYGEN_INVOKED) || defined(BOOST_INTRUSIVE_VARIADIC_TEMPLATES)
 template<class ...Options>
 #else
-template<class O1, class O2, class O3>
+template<class O1, class O2, class O3, class O4>
 #endif
 class list_base_hook
    :  public make_list_base_hook
       #if !defined(BOOST_INTRUSIVE_VARIADIC_TEMPLATES)
-      <O1, O2, O3>
+      <O1, O2, O3, O4>
       #else
       <Options...>
       #endif
@@ -163,7 +168,7 @@ class list_base_hook
 #if defined(BOOST_INTRUSIVE_DOXYGEN_INVOKED) || defined(BOOST_INTRUSIVE_VARIADIC_TEMPLATES)
 template<class ...Options>
 #else
-template<class O1 = void, class O2 = void, class O3 = void>
+template<class O1 = void, class O2 = void, class O3 = void, class O4 = void>
 #endif
 struct make_list_member_hook
 {
@@ -171,15 +176,16 @@ struct make_list_member_hook
    typedef typename pack_options
       < hook_defaults,
       #if !defined(BOOST_INTRUSIVE_VARIADIC_TEMPLATES)
-      O1, O2, O3
+      O1, O2, O3, O4
       #else
       Options...
       #endif
       >::type packed_options;
 
    typedef generic_hook
-   < CircularListAlgorithms
-   , list_node_traits<typename packed_options::void_pointer>
+   < packed_options::order_labels ? OrderListAlgorithms : CircularListAlgorithms
+   , typename get_list_node_traits
+      <typename packed_options::void_pointer, packed_options::order_labels>::type
    , member_tag
    , packed_options::link_mode
    , NoBaseHookId
@@ -191,23 +197,26 @@ struct make_list_member_hook
 //! Store this hook in a class to be inserted
 //! in an list.
 //!
-//! The hook admits the following options: \c void_pointer<> and
-//! \c link_mode<>.
+//! The hook admits the following options: \c void_pointer<>,
+//! \c link_mode<> and \c order_labels<>.
 //!
 //! \c link_mode<> will specify the linking mode of the hook (\c normal_link,
 //! \c auto_unlink or \c safe_link).
 //!
 //! \c void_pointer<> is the pointer type that will be used internally in the hook
 //! and the container configured to use this hook.
+//!
+//! \c order_labels<> will tell the hook to store an order label, so that
+//! \c list::precedes can compare the position of two elements in constant time.
 #if defined(BOOST_INTRUSIVE_DOXYGEN_INVOKED) || defined(BOOST_INTRUSIVE_VARIADIC_TEMPLATES)
 template<class ...Options>
 #else
-template<class O1, class O2, class O3>
+template<class O1, class O2, class O3, class O4>
 #endif
 class list_member_hook
    :  public make_list_member_hook
       #if !defined(BOOST_INTRUSIVE_VARIADIC_TEMPLATES)
-      <O1, O2, O3>
+      <O1, O2, O3, O4>
       #else
       <Options...>
       #endif
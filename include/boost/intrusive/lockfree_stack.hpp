@@ -0,0 +1,396 @@
+/////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright agent 2026
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/intrusive for documentation.
+//
+/////////////////////////////////////////////////////////////////////////////
+
+#ifndef BOOST_INTRUSIVE_LOCKFREE_STACK_HPP
+#define BOOST_INTRUSIVE_LOCKFREE_STACK_HPP
+
+#include <boost/intrusive/detail/config_begin.hpp>
+#include <boost/intrusive/intrusive_fwd.hpp>
+#include <boost/intrusive/detail/assert.hpp>
+#include <boost/intrusive/slist.hpp>
+#include <boost/intrusive/slist_hook.hpp>
+#include <boost/intrusive/linear_slist_algorithms.hpp>
+#include <boost/intrusive/pointer_traits.hpp>
+#include <boost/intrusive/detail/mpl.hpp>
+#include <boost/intrusive/link_mode.hpp>
+#include <boost/intrusive/detail/get_value_traits.hpp>
+#include <boost/intrusive/detail/is_stateful_value_traits.hpp>
+#include <boost/intrusive/detail/atomic_tagged_ptr.hpp>
+#include <boost/intrusive/detail/atomic_slist_link.hpp>
+
+#include <atomic>
+
+#if defined(BOOST_HAS_PRAGMA_ONCE)
+#  pragma once
+#endif
+
+namespace boost {
+namespace intrusive {
+
+/// @cond
+
+struct lockfree_stack_defaults
+{
+   typedef default_slist_hook_applier proto_value_traits;
+};
+
+/// @endcond
+
+//! The class template lockfree_stack is a lock-free LIFO stack (a Treiber stack)
+//! of elements linked through slist hooks. Several threads can push and pop elements
+//! concurrently: elements are linked and unlinked by a compare_exchange on the top of
+//! the stack, whose address is stored with a version tag incremented by every update,
+//! so that an element popped and pushed again between the load and the compare_exchange
+//! of another thread does not corrupt the stack (the ABA problem).
+//!
+//! A pre-linked chain of elements can be pushed and the whole stack can be popped
+//! with a single atomic operation, using ordinary slists to hold the chains.
+//!
+//! A thread popping an element may read the hook of an element that another thread
+//! has just popped, so the memory of popped elements must remain readable while the
+//! stack is used (e.g. elements are recycled through the stack or a pool, as in free lists).
+//! The stack reads and writes hooks with atomic operations, but the hook of a popped
+//! element belongs to its owner again: modifying it with ordinary slist operations
+//! (including those done by \c push_range and \c pop_all) while another thread
+//! might be in \c pop() is a benign but formal data race that race detectors report.
+//!
+//! On x86-64 the tag is stored in the upper 16 bits of the address and the stack
+//! is updated with single-word atomic operations. This requires all the elements
+//! to have addresses below 2^48, which is always true with 4-level paging. With
+//! 5-level paging (LA57) the operating system might map user memory above that
+//! address (Linux only does it if mmap is passed such an address as a hint), so define
+//! \c BOOST_INTRUSIVE_DISABLE_TAGGED_PTR_COMPRESSION if elements might live there:
+//! it's checked by an assertion in debug mode. Without compression, or on other
+//! architectures, the top of the stack is updated with double-width atomic operations,
+//! which might need to link the atomic support library. \c is_lock_free() tells if
+//! the stack is lock-free.
+//!
+//! The template parameter \c T is the type to be managed by the container.
+//! Hooks must be slist hooks using raw pointers (the default) and can't be
+//! auto-unlink hooks.
+//!
+//! The container supports the following options:
+//! \c base_hook<>/member_hook<>/value_traits<>.
+#if defined(BOOST_INTRUSIVE_DOXYGEN_INVOKED)
+template<class T, class ...Options>
+#else
+template<class ValueTraits>
+#endif
+class lockfree_stack_impl
+{
+   //Public typedefs
+   public:
+   typedef ValueTraits                                               value_traits;
+   typedef typename value_traits::pointer                            pointer;
+   typedef typename value_traits::const_pointer                      const_pointer;
+   typedef typename pointer_traits<pointer>::element_type            value_type;
+   typedef typename pointer_traits<pointer>::reference               reference;
+   typedef typename pointer_traits<const_pointer>::reference         const_reference;
+   typedef typename value_traits::node_traits                        node_traits;
+   typedef typename node_traits::node                                node;
+   typedef typename node_traits::node_ptr                            node_ptr;
+   typedef typename node_traits::const_node_ptr                      const_node_ptr;
+   typedef linear_slist_algorithms<node_traits>                      node_algorithms;
+
+   static const bool stateful_value_traits = detail::is_stateful_value_traits<value_traits>::value;
+
+   /// @cond
+   private:
+   //noncopyable, nonmovable
+   lockfree_stack_impl(const lockfree_stack_impl &);
+   lockfree_stack_impl &operator=(const lockfree_stack_impl &);
+
+   static const bool safemode_or_autounlink = is_safe_autounlink<value_traits::link_mode>::value;
+
+   //Linked elements are shared between threads, they can't unlink themselves
+   BOOST_INTRUSIVE_STATIC_ASSERT(((int)value_traits::link_mode != (int)auto_unlink));
+   //Tagged pointers are built from raw pointers and hooks are accessed atomically
+   BOOST_INTRUSIVE_STATIC_ASSERT((detail::is_same<node_traits, detail::atomic_slist_link::node_traits>::value));
+
+   typedef detail::atomic_slist_link         atomic_link;
+   typedef detail::atomic_tagged_ptr<node>   top_type;
+   typedef typename top_type::value_type     tagged_node_ptr;
+
+   //The last element of the stack points to end_ so that linked
+   //elements are distinguished from unlinked ones in safe mode.
+   struct data_t : public value_traits
+   {
+      explicit data_t(const value_traits &val_traits)
+         :  value_traits(val_traits), end_(), top_(&end_)
+      {}
+
+      node     end_;
+      top_type top_;
+   } data_;
+
+   inline node_ptr priv_end() BOOST_NOEXCEPT
+   {  return &data_.end_;  }
+
+   inline const_node_ptr priv_end() const BOOST_NOEXCEPT
+   {  return &data_.end_;  }
+
+   inline const value_traits &priv_value_traits() const BOOST_NOEXCEPT
+   {  return data_;  }
+
+   //Links the chain [first, last] on top of the stack
+   void priv_push(node_ptr first, node_ptr last) BOOST_NOEXCEPT
+   {
+      tagged_node_ptr top(data_.top_.load(std::memory_order_relaxed));
+      do{
+         atomic_link::store_relaxed(last, top.ptr);
+      } while(!data_.top_.compare_exchange_weak
+                  (top, first, std::memory_order_release, std::memory_order_relaxed));
+   }
+
+   //Unlinks all the elements, returning the first one (or priv_end() if there are none)
+   node_ptr priv_pop_all() BOOST_NOEXCEPT
+   {
+      tagged_node_ptr top(data_.top_.load(std::memory_order_acquire));
+      while(top.ptr != this->priv_end() && !data_.top_.compare_exchange_weak
+                  (top, this->priv_end(), std::memory_order_acquire, std::memory_order_acquire)){}
+      return top.ptr;
+   }
+   /// @endcond
+
+   public:
+   //! <b>Effects</b>: constructs an empty stack.
+   //!
+   //! <b>Complexity</b>: Constant
+   //!
+   //! <b>Throws</b>: If value_traits::node_traits::node
+   //!   constructor throws (this does not happen with predefined Boost.Intrusive hooks).
+   lockfree_stack_impl()
+      :  data_(value_traits())
+   {}
+
+   //! <b>Effects</b>: constructs an empty stack.
+   //!
+   //! <b>Complexity</b>: Constant
+   //!
+   //! <b>Throws</b>: If value_traits::node_traits::node
+   //!   constructor throws (this does not happen with predefined Boost.Intrusive hooks).
+   explicit lockfree_stack_impl(const value_traits &v_traits)
+      :  data_(v_traits)
+   {}
+
+   //! <b>Requires</b>: No other thread is using the stack.
+   //!
+   //! <b>Effects</b>: If it's a safe-mode hook, the destructor sets the hooks of the
+   //!   elements still in the stack to the unlinked state. The elements are not destroyed.
+   //!
+   //! <b>Complexity</b>: Linear to the number of elements in the stack
+   //!   if it's a safe-mode hook, constant otherwise.
+   //!
+   //! <b>Throws</b>: Nothing.
+   ~lockfree_stack_impl()
+   {
+      if(safemode_or_autounlink){
+         node_ptr n = this->priv_pop_all();
+         while(n != this->priv_end()){
+            const node_ptr next = node_traits::get_next(n);
+            node_algorithms::init(n);
+            n = next;
+         }
+      }
+   }
+
+   //! <b>Requires</b>: value must be an lvalue not linked in any container using the same hook.
+   //!
+   //! <b>Effects</b>: Inserts the value on top of the stack. Can be called concurrently
+   //!   with any other member function but the destructor.
+   //!
+   //! <b>Complexity</b>: Constant if there is no contention: lock-free.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Note</b>: Does not affect the validity of iterators and references.
+   void push(reference value) BOOST_NOEXCEPT
+   {
+      const node_ptr n = priv_value_traits().to_node_ptr(value);
+      BOOST_INTRUSIVE_SAFE_HOOK_DEFAULT_ASSERT(!safemode_or_autounlink || node_algorithms::inited(n));
+      this->priv_push(n, n);
+   }
+
+   //! <b>Effects</b>: Unlinks the value on top of the stack. Can be called concurrently
+   //!   with any other member function but the destructor.
+   //!
+   //! <b>Returns</b>: A pointer to the unlinked value or a null pointer if the stack was empty.
+   //!
+   //! <b>Complexity</b>: Constant if there is no contention: lock-free.
+   //!
+   //! <b>Throws</b>: Nothing.
+   pointer pop() BOOST_NOEXCEPT
+   {
+      tagged_node_ptr top(data_.top_.load(std::memory_order_acquire));
+      while(top.ptr != this->priv_end()){
+         //The element might have been popped (and even pushed again) by another thread,
+         //its tag makes the exchange fail in that case.
+         const node_ptr next = atomic_link::load_relaxed(top.ptr);
+         if(data_.top_.compare_exchange_weak
+               (top, next, std::memory_order_acquire, std::memory_order_acquire)){
+            if(safemode_or_autounlink)
+               atomic_link::store_relaxed(top.ptr, node_ptr());
+            return priv_value_traits().to_value_ptr(top.ptr);
+         }
+      }
+      return pointer();
+   }
+
+   //! <b>Requires</b>: Slist is an slist using the same value_traits as the stack.
+   //!
+   //! <b>Effects</b>: Unlinks all the elements of s and inserts them on top of the stack
+   //!   with a single atomic operation, so that s.front() is the new top of the stack.
+   //!   Can be called concurrently with any other member function but the destructor.
+   //!
+   //! <b>Complexity</b>: Linear to the number of elements of s, plus a constant
+   //!   if there is no contention: lock-free.
+   //!
+   //! <b>Throws</b>: Nothing.
+   template<class Slist>
+   void push_range(Slist &s) BOOST_NOEXCEPT
+   {
+      BOOST_INTRUSIVE_STATIC_ASSERT((detail::is_same<typename Slist::value_traits, value_traits>::value));
+      node_ptr first = node_ptr(), last = node_ptr();
+      while(!s.empty()){
+         const node_ptr n = priv_value_traits().to_node_ptr(s.front());
+         s.pop_front();
+         if(last)
+            atomic_link::store_relaxed(last, n);
+         else
+            first = n;
+         last = n;
+      }
+      if(last)
+         this->priv_push(first, last);
+   }
+
+   //! <b>Requires</b>: Slist is an slist using the same value_traits as the stack.
+   //!
+   //! <b>Effects</b>: Unlinks all the elements of the stack with a single atomic
+   //!   operation and inserts them at the beginning of s, so that the previous top
+   //!   of the stack is s.front(). Can be called concurrently with any other member
+   //!   function but the destructor.
+   //!
+   //! <b>Complexity</b>: Linear to the number of unlinked elements, plus a constant
+   //!   if there is no contention: lock-free.
+   //!
+   //! <b>Throws</b>: Nothing.
+   template<class Slist>
+   void pop_all(Slist &s) BOOST_NOEXCEPT
+   {
+      BOOST_INTRUSIVE_STATIC_ASSERT((detail::is_same<typename Slist::value_traits, value_traits>::value));
+      const node_ptr first = this->priv_pop_all();
+      if(first != this->priv_end()){
+         node_ptr last = first;
+         typename Slist::size_type n = 1u;
+         for(node_ptr next = atomic_link::load_relaxed(last); next != this->priv_end(); ++n){
+            last = next;
+            next = atomic_link::load_relaxed(last);
+         }
+         //Only the link of the last element is written
+         s.incorporate_after(s.cbefore_begin(), first, last, n);
+      }
+   }
+
+   //! <b>Effects</b>: Returns true if the stack contains no elements. Other threads
+   //!   might have pushed or popped elements when the function returns.
+   //!
+   //! <b>Complexity</b>: Constant.
+   //!
+   //! <b>Throws</b>: Nothing.
+   bool empty() const BOOST_NOEXCEPT
+   {  return data_.top_.load(std::memory_order_relaxed).ptr == this->priv_end();  }
+
+   //! <b>Returns</b>: true if the atomic operations on the stack are lock-free.
+   //!
+   //! <b>Complexity</b>: Constant.
+   //!
+   //! <b>Throws</b>: Nothing.
+   bool is_lock_free() const BOOST_NOEXCEPT
+   {  return data_.top_.is_lock_free();  }
+};
+
+
+//! Helper metafunction to define a \c lockfree_stack that yields to the same type when the
+//! same options (either explicitly or implicitly) are used.
+#if defined(BOOST_INTRUSIVE_DOXYGEN_INVOKED) || defined(BOOST_INTRUSIVE_VARIADIC_TEMPLATES)
+template<class T, class ...Options>
+#else
+template<class T, class O1 = void, class O2 = void, class O3 = void>
+#endif
+struct make_lockfree_stack
+{
+   /// @cond
+   typedef typename pack_options
+      < lockfree_stack_defaults,
+         #if !defined(BOOST_INTRUSIVE_VARIADIC_TEMPLATES)
+         O1, O2, O3
+         #else
+         Options...
+         #endif
+      >::type packed_options;
+
+   typedef typename detail::get_value_traits
+      <T, typename packed_options::proto_value_traits>::type value_traits;
+   typedef lockfree_stack_impl<value_traits> implementation_defined;
+   /// @endcond
+   typedef implementation_defined type;
+};
+
+
+#ifndef BOOST_INTRUSIVE_DOXYGEN_INVOKED
+
+#if !defined(BOOST_INTRUSIVE_VARIADIC_TEMPLATES)
+template<class T, class O1, class O2, class O3>
+#else
+template<class T, class ...Options>
+#endif
+class lockfree_stack
+   :  public make_lockfree_stack<T,
+      #if !defined(BOOST_INTRUSIVE_VARIADIC_TEMPLATES)
+      O1, O2, O3
+      #else
+      Options...
+      #endif
+   >::type
+{
+   typedef typename make_lockfree_stack
+      <T,
+      #if !defined(BOOST_INTRUSIVE_VARIADIC_TEMPLATES)
+      O1, O2, O3
+      #else
+      Options...
+      #endif
+      >::type      Base;
+   //Assert if passed value traits are compatible with the type
+   BOOST_INTRUSIVE_STATIC_ASSERT((detail::is_same<typename Base::value_traits::value_type, T>::value));
+
+   public:
+   typedef typename Base::value_traits          value_traits;
+
+   inline lockfree_stack()
+      :  Base()
+   {}
+
+   inline explicit lockfree_stack(const value_traits &v_traits)
+      :  Base(v_traits)
+   {}
+};
+
+#endif
+
+} //namespace intrusive
+} //namespace boost
+
+#include <boost/intrusive/detail/config_end.hpp>
+
+#endif //BOOST_INTRUSIVE_LOCKFREE_STACK_HPP
@@ -0,0 +1,232 @@
+/////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright agent 2026
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/intrusive for documentation.
+//
+/////////////////////////////////////////////////////////////////////////////
+
+#ifndef BOOST_INTRUSIVE_LOOKUP_CACHE_HPP
+#define BOOST_INTRUSIVE_LOOKUP_CACHE_HPP
+
+#include <boost/intrusive/detail/config_begin.hpp>
+#include <boost/intrusive/intrusive_fwd.hpp>
+#include <boost/intrusive/detail/mpl.hpp>
+#include <boost/intrusive/detail/workaround.hpp>
+#include <boost/intrusive/detail/hash.hpp>
+#include <boost/intrusive/detail/hash_mix.hpp>
+#include <boost/intrusive/link_mode.hpp>
+#include <boost/intrusive/pointer_traits.hpp>
+
+#include <cstddef>   //std::size_t
+
+#if defined(BOOST_HAS_PRAGMA_ONCE)
+#  pragma once
+#endif
+
+namespace boost {
+namespace intrusive {
+
+//! lookup_cache is a small direct-mapped cache placed in front of a tree based
+//! container (bstree, rbtree, set, avl_multiset...). Each slot of the cache, selected
+//! by the hash of a key, remembers the element found by the last lookup of a key
+//! mapped to that slot, so repeated lookups of hot keys take constant time
+//! without restructuring the tree as splay trees do.
+//!
+//! Lookups only modify the cache, never the tree, so several threads can search the same
+//! tree concurrently through their own lookup_cache objects.
+//!
+//! The tree must be defined with the \c modification_epoch<true> option. Each slot stores
+//! the epoch of the tree when the element was found and a slot is only used while the
+//! epoch of the tree is unchanged: after elements are inserted, erased or replaced through
+//! the tree, all the slots are stale and the cache never accesses the elements they point to,
+//! even if those were destroyed. Elements must not be unlinked with the static
+//! \c remove_node function of the tree and auto-unlink hooks are not supported.
+//!
+//! The template parameter \c Tree is the tree based container type, \c Size the
+//! number of slots (a power of two) and \c Hash the hash functor for \c key_type.
+//! If \c Hash is void, boost::hash is used.
+template<class Tree, std::size_t Size, class Hash>
+class lookup_cache
+{
+   public:
+   typedef Tree                                                      tree_type;
+   typedef typename tree_type::value_type                            value_type;
+   typedef typename tree_type::key_type                              key_type;
+   typedef typename tree_type::key_of_value                          key_of_value;
+   typedef typename tree_type::key_compare                           key_compare;
+   typedef typename tree_type::value_traits                          value_traits;
+   typedef typename tree_type::pointer                               pointer;
+   typedef typename tree_type::reference                             reference;
+   typedef typename tree_type::const_reference                       const_reference;
+   typedef typename tree_type::iterator                              iterator;
+   typedef typename tree_type::const_iterator                        const_iterator;
+   typedef typename tree_type::size_type                             size_type;
+   typedef typename detail::if_c
+      < detail::is_same<Hash, void>::value
+      , detail::internal_hash_functor<key_type>
+      , Hash>::type                                                  hasher;
+
+   static const std::size_t cache_size = Size;
+
+   /// @cond
+   private:
+   BOOST_INTRUSIVE_STATIC_ASSERT((Size != 0u && (Size & (Size - 1u)) == 0u));
+   //Auto-unlink hooks unlink elements without modifying the epoch of the tree
+   BOOST_INTRUSIVE_STATIC_ASSERT(((int)value_traits::link_mode != (int)auto_unlink));
+
+   struct slot_type
+   {
+      pointer     value;
+      std::size_t epoch;
+   };
+   /// @endcond
+
+   public:
+   //! <b>Effects</b>: Constructs an empty cache for the lookups in t.
+   //!
+   //! <b>Complexity</b>: Linear to cache_size.
+   //!
+   //! <b>Throws</b>: If the copy constructor of the hasher throws.
+   explicit lookup_cache(tree_type &t, const hasher &h = hasher())
+      : tree_(&t), hash_(h), hits_(), misses_()
+   {  this->invalidate();  }
+
+   //! <b>Effects</b>: Returns the tree whose lookups are cached.
+   //!
+   //! <b>Complexity</b>: Constant.
+   //!
+   //! <b>Throws</b>: Nothing.
+   tree_type &tree() const BOOST_NOEXCEPT
+   {  return *tree_;  }
+
+   //! <b>Effects</b>: Returns the hash functor used by the cache.
+   //!
+   //! <b>Complexity</b>: Constant.
+   //!
+   //! <b>Throws</b>: If the copy constructor of the hasher throws.
+   hasher hash_function() const
+   {  return hash_;  }
+
+   //! <b>Effects</b>: Returns the number of lookups answered by the cache.
+   //!
+   //! <b>Complexity</b>: Constant.
+   //!
+   //! <b>Throws</b>: Nothing.
+   size_type hits() const BOOST_NOEXCEPT
+   {  return hits_;  }
+
+   //! <b>Effects</b>: Returns the number of lookups that searched the tree.
+   //!
+   //! <b>Complexity</b>: Constant.
+   //!
+   //! <b>Throws</b>: Nothing.
+   size_type misses() const BOOST_NOEXCEPT
+   {  return misses_;  }
+
+   //! <b>Effects</b>: Finds an iterator to the first element whose key is
+   //!   k or tree().end() if that element does not exist.
+   //!
+   //! <b>Complexity</b>: Constant if the key is cached and the tree was not
+   //!   modified since it was cached, logarithmic otherwise.
+   //!
+   //! <b>Throws</b>: If the hasher or the comparison functor throws.
+   iterator find(const key_type &key)
+   {
+      slot_type &slot = this->priv_slot(key);
+      if(this->priv_hit(slot, key))
+         return tree_->iterator_to(*slot.value);
+      ++misses_;
+      const iterator r(tree_->find(key));
+      if(r != tree_->end())
+         this->priv_store(slot, *r);
+      return r;
+   }
+
+   //! <b>Effects</b>: Returns an iterator to the first element whose
+   //!   key is not less than k or tree().end() if that element does not exist.
+   //!
+   //! <b>Complexity</b>: Constant if the key is cached and the tree was not
+   //!   modified since it was cached, logarithmic otherwise.
+   //!
+   //! <b>Throws</b>: If the hasher or the comparison functor throws.
+   //!
+   //! <b>Note</b>: Only results whose key is k are cached.
+   iterator lower_bound(const key_type &key)
+   {
+      slot_type &slot = this->priv_slot(key);
+      if(this->priv_hit(slot, key))
+         return tree_->iterator_to(*slot.value);
+      ++misses_;
+      const iterator r(tree_->lower_bound(key));
+      if(r != tree_->end() && !tree_->key_comp()(key, key_of_value()(*r)))
+         this->priv_store(slot, *r);
+      return r;
+   }
+
+   //! <b>Effects</b>: Returns true if the tree contains an element whose key is k.
+   //!
+   //! <b>Complexity</b>: Constant if the key is cached and the tree was not
+   //!   modified since it was cached, logarithmic otherwise.
+   //!
+   //! <b>Throws</b>: If the hasher or the comparison functor throws.
+   bool contains(const key_type &key)
+   {  return this->find(key) != tree_->end();  }
+
+   //! <b>Effects</b>: Forgets all cached elements.
+   //!
+   //! <b>Complexity</b>: Linear to cache_size.
+   //!
+   //! <b>Throws</b>: Nothing.
+   void invalidate() BOOST_NOEXCEPT
+   {
+      for(std::size_t i = 0; i != Size; ++i){
+         slots_[i].value = pointer();
+         slots_[i].epoch = 0u;
+      }
+   }
+
+   /// @cond
+   private:
+   slot_type &priv_slot(const key_type &key)
+   {  return slots_[detail::hash_mix(hash_(key)) & (Size - 1u)];  }
+
+   void priv_store(slot_type &slot, reference v)
+   {
+      slot.value = pointer_traits<pointer>::pointer_to(v);
+      slot.epoch = tree_->epoch();
+   }
+
+   //The cached element is only accessed if the tree was not modified since it was
+   //cached, as it might have been erased and destroyed afterwards.
+   bool priv_hit(const slot_type &slot, const key_type &key)
+   {
+      if(slot.value && slot.epoch == tree_->epoch()){
+         const key_compare comp(tree_->key_comp());
+         const key_type &k = key_of_value()(*slot.value);
+         if(!comp(key, k) && !comp(k, key)){
+            ++hits_;
+            return true;
+         }
+      }
+      return false;
+   }
+
+   tree_type   *tree_;
+   hasher      hash_;
+   size_type   hits_;
+   size_type   misses_;
+   slot_type   slots_[Size];
+   /// @endcond
+};
+
+} //namespace intrusive
+} //namespace boost
+
+#include <boost/intrusive/detail/config_end.hpp>
+
+#endif //BOOST_INTRUSIVE_LOOKUP_CACHE_HPP
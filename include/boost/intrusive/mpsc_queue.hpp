@@ -0,0 +1,389 @@
+/////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright agent 2026
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/intrusive for documentation.
+//
+/////////////////////////////////////////////////////////////////////////////
+
+#ifndef BOOST_INTRUSIVE_MPSC_QUEUE_HPP
+#define BOOST_INTRUSIVE_MPSC_QUEUE_HPP
+
+#include <boost/intrusive/detail/config_begin.hpp>
+#include <boost/intrusive/intrusive_fwd.hpp>
+#include <boost/intrusive/detail/assert.hpp>
+#include <boost/intrusive/slist.hpp>
+#include <boost/intrusive/slist_hook.hpp>
+#include <boost/intrusive/linear_slist_algorithms.hpp>
+#include <boost/intrusive/pointer_traits.hpp>
+#include <boost/intrusive/detail/mpl.hpp>
+#include <boost/intrusive/link_mode.hpp>
+#include <boost/intrusive/detail/get_value_traits.hpp>
+#include <boost/intrusive/detail/is_stateful_value_traits.hpp>
+#include <boost/intrusive/detail/atomic_slist_link.hpp>
+
+#include <atomic>
+
+#if defined(BOOST_HAS_PRAGMA_ONCE)
+#  pragma once
+#endif
+
+namespace boost {
+namespace intrusive {
+
+/// @cond
+
+struct mpsc_queue_defaults
+{
+   typedef default_slist_hook_applier proto_value_traits;
+};
+
+/// @endcond
+
+//! The class template mpsc_queue is a multi-producer single-consumer FIFO queue
+//! of elements linked through slist hooks, based on Dmitry Vyukov's intrusive
+//! MPSC queue. Any number of threads can push elements concurrently and
+//! one thread (the consumer) pops them.
+//!
+//! Pushing is wait-free: it exchanges the last element of the queue with the pushed
+//! one and then links the previous last element to it. Popping does not modify any
+//! memory shared with producers but for a node of the queue when the last element is popped.
+//! A pre-linked chain of elements can be pushed with a single atomic operation,
+//! and the consumer can pop all the elements into an ordinary slist.
+//!
+//! Between the exchange and the linking of a push, elements pushed after it are
+//! not reachable by the consumer: \c pop might return a null pointer, as if the queue was
+//! empty, until the producer links the element. If a producer is suspended in that window,
+//! elements pushed after it are delayed, but no thread waits for it.
+//!
+//! The template parameter \c T is the type to be managed by the container.
+//! Hooks must be slist hooks using raw pointers (the default) and can't be
+//! auto-unlink hooks.
+//!
+//! The container supports the following options:
+//! \c base_hook<>/member_hook<>/value_traits<>.
+#if defined(BOOST_INTRUSIVE_DOXYGEN_INVOKED)
+template<class T, class ...Options>
+#else
+template<class ValueTraits>
+#endif
+class mpsc_queue_impl
+{
+   //Public typedefs
+   public:
+   typedef ValueTraits                                               value_traits;
+   typedef typename value_traits::pointer                            pointer;
+   typedef typename value_traits::const_pointer                      const_pointer;
+   typedef typename pointer_traits<pointer>::element_type            value_type;
+   typedef typename pointer_traits<pointer>::reference               reference;
+   typedef typename pointer_traits<const_pointer>::reference         const_reference;
+   typedef typename value_traits::node_traits                        node_traits;
+   typedef typename node_traits::node                                node;
+   typedef typename node_traits::node_ptr                            node_ptr;
+   typedef typename node_traits::const_node_ptr                      const_node_ptr;
+   typedef linear_slist_algorithms<node_traits>                      node_algorithms;
+
+   static const bool stateful_value_traits = detail::is_stateful_value_traits<value_traits>::value;
+
+   /// @cond
+   private:
+   //noncopyable, nonmovable
+   mpsc_queue_impl(const mpsc_queue_impl &);
+   mpsc_queue_impl &operator=(const mpsc_queue_impl &);
+
+   static const bool safemode_or_autounlink = is_safe_autounlink<value_traits::link_mode>::value;
+
+   //Linked elements are shared between threads, they can't unlink themselves
+   BOOST_INTRUSIVE_STATIC_ASSERT(((int)value_traits::link_mode != (int)auto_unlink));
+   //The last element is exchanged through an atomic raw pointer and hooks are accessed atomically
+   BOOST_INTRUSIVE_STATIC_ASSERT((detail::is_same<node_traits, detail::atomic_slist_link::node_traits>::value));
+
+   typedef detail::atomic_slist_link   atomic_link;
+
+   //Elements are linked from the first (tail_) to the last one (head_).
+   //The last element points to end_ until a producer links its successor, so that linked
+   //elements are distinguished from unlinked ones in safe mode. stub_ is linked
+   //when the consumer pops the last element, so that the queue is never empty.
+   //head_ is written by all producers, so it's placed apart from the consumer's fields.
+   struct data_t : public value_traits
+   {
+      explicit data_t(const value_traits &val_traits)
+         :  value_traits(val_traits), end_(), stub_(), tail_(&stub_), head_(&stub_)
+      {
+         atomic_link::store_relaxed(&stub_, &end_);
+      }
+
+      node     end_;
+      node     stub_;
+      node_ptr tail_;
+      char     pad_[64u];
+      std::atomic<node_ptr> head_;
+   } data_;
+
+   inline node_ptr priv_end() BOOST_NOEXCEPT
+   {  return &data_.end_;  }
+
+   inline node_ptr priv_stub() BOOST_NOEXCEPT
+   {  return &data_.stub_;  }
+
+   inline const value_traits &priv_value_traits() const BOOST_NOEXCEPT
+   {  return data_;  }
+
+   //Links the chain [first, last] at the end of the queue
+   void priv_push(node_ptr first, node_ptr last) BOOST_NOEXCEPT
+   {
+      atomic_link::store_relaxed(last, this->priv_end());
+      const node_ptr prev = data_.head_.exchange(last, std::memory_order_acq_rel);
+      //Publishes the chain to the consumer, which reads the link with an acquire load
+      atomic_link::store_release(prev, first);
+   }
+
+   //Returns the successor of n or a null pointer if it's not linked yet
+   node_ptr priv_next(node_ptr n) BOOST_NOEXCEPT
+   {
+      const node_ptr next = atomic_link::load_acquire(n);
+      return next == this->priv_end() ? node_ptr() : next;
+   }
+
+   node_ptr priv_pop() BOOST_NOEXCEPT
+   {
+      node_ptr tail = data_.tail_;
+      node_ptr next = this->priv_next(tail);
+      if(tail == this->priv_stub()){
+         if(!next)
+            return node_ptr();
+         data_.tail_ = tail = next;
+         next = this->priv_next(tail);
+      }
+      if(!next){
+         //tail might be the last element: push the stub after it so that tail can be unlinked.
+         //Otherwise a producer has not linked the successor of tail yet.
+         if(tail != data_.head_.load(std::memory_order_acquire))
+            return node_ptr();
+         this->priv_push(this->priv_stub(), this->priv_stub());
+         next = this->priv_next(tail);
+         if(!next)
+            return node_ptr();
+      }
+      data_.tail_ = next;
+      if(safemode_or_autounlink)
+         atomic_link::store_relaxed(tail, node_ptr());
+      return tail;
+   }
+   /// @endcond
+
+   public:
+   //! <b>Effects</b>: constructs an empty queue.
+   //!
+   //! <b>Complexity</b>: Constant
+   //!
+   //! <b>Throws</b>: If value_traits::node_traits::node
+   //!   constructor throws (this does not happen with predefined Boost.Intrusive hooks).
+   mpsc_queue_impl()
+      :  data_(value_traits())
+   {}
+
+   //! <b>Effects</b>: constructs an empty queue.
+   //!
+   //! <b>Complexity</b>: Constant
+   //!
+   //! <b>Throws</b>: If value_traits::node_traits::node
+   //!   constructor throws (this does not happen with predefined Boost.Intrusive hooks).
+   explicit mpsc_queue_impl(const value_traits &v_traits)
+      :  data_(v_traits)
+   {}
+
+   //! <b>Requires</b>: No other thread is using the queue.
+   //!
+   //! <b>Effects</b>: If it's a safe-mode hook, the destructor sets the hooks of the
+   //!   elements still in the queue to the unlinked state. The elements are not destroyed.
+   //!
+   //! <b>Complexity</b>: Linear to the number of elements in the queue
+   //!   if it's a safe-mode hook, constant otherwise.
+   //!
+   //! <b>Throws</b>: Nothing.
+   ~mpsc_queue_impl()
+   {
+      if(safemode_or_autounlink){
+         while(this->priv_pop()){}
+      }
+   }
+
+   //! <b>Requires</b>: value must be an lvalue not linked in any container using the same hook.
+   //!
+   //! <b>Effects</b>: Inserts the value at the back of the queue. Can be called
+   //!   concurrently with any other member function but the destructor.
+   //!
+   //! <b>Complexity</b>: Constant: wait-free.
+   //!
+   //! <b>Throws</b>: Nothing.
+   void push(reference value) BOOST_NOEXCEPT
+   {
+      const node_ptr n = priv_value_traits().to_node_ptr(value);
+      BOOST_INTRUSIVE_SAFE_HOOK_DEFAULT_ASSERT(!safemode_or_autounlink || node_algorithms::inited(n));
+      this->priv_push(n, n);
+   }
+
+   //! <b>Requires</b>: Slist is an slist using the same value_traits as the queue.
+   //!
+   //! <b>Effects</b>: Unlinks all the elements of s and inserts them at the back of the
+   //!   queue, in the same order, with a single atomic operation. Can be called
+   //!   concurrently with any other member function but the destructor.
+   //!
+   //! <b>Complexity</b>: Linear to the number of elements of s, plus a constant: wait-free.
+   //!
+   //! <b>Throws</b>: Nothing.
+   template<class Slist>
+   void push_range(Slist &s) BOOST_NOEXCEPT
+   {
+      BOOST_INTRUSIVE_STATIC_ASSERT((detail::is_same<typename Slist::value_traits, value_traits>::value));
+      node_ptr first = node_ptr(), last = node_ptr();
+      while(!s.empty()){
+         const node_ptr n = priv_value_traits().to_node_ptr(s.front());
+         s.pop_front();
+         if(last)
+            atomic_link::store_relaxed(last, n);
+         else
+            first = n;
+         last = n;
+      }
+      if(last)
+         this->priv_push(first, last);
+   }
+
+   //! <b>Requires</b>: Only called by the consumer thread.
+   //!
+   //! <b>Effects</b>: Unlinks the element at the front of the queue.
+   //!
+   //! <b>Returns</b>: A pointer to the unlinked value or a null pointer if the queue was
+   //!   empty or the producer of the front element has not linked it yet.
+   //!
+   //! <b>Complexity</b>: Constant: wait-free.
+   //!
+   //! <b>Throws</b>: Nothing.
+   pointer pop() BOOST_NOEXCEPT
+   {
+      const node_ptr n = this->priv_pop();
+      return n ? priv_value_traits().to_value_ptr(n) : pointer();
+   }
+
+   //! <b>Requires</b>: Slist is an slist using the same value_traits as the queue.
+   //!   Only called by the consumer thread.
+   //!
+   //! <b>Effects</b>: Pops all the reachable elements of the queue and inserts them
+   //!   at the beginning of s, in the same order, so that the previous front of
+   //!   the queue is s.front().
+   //!
+   //! <b>Returns</b>: The number of popped elements.
+   //!
+   //! <b>Complexity</b>: Linear to the number of popped elements.
+   //!
+   //! <b>Throws</b>: Nothing.
+   template<class Slist>
+   std::size_t pop_all(Slist &s) BOOST_NOEXCEPT
+   {
+      BOOST_INTRUSIVE_STATIC_ASSERT((detail::is_same<typename Slist::value_traits, value_traits>::value));
+      std::size_t n = 0u;
+      typename Slist::const_iterator prev(s.cbefore_begin());
+      while(const node_ptr p = this->priv_pop()){
+         prev = s.insert_after(prev, *priv_value_traits().to_value_ptr(p));
+         ++n;
+      }
+      return n;
+   }
+
+   //! <b>Requires</b>: Only called by the consumer thread.
+   //!
+   //! <b>Effects</b>: Returns true if pop() would return a null pointer.
+   //!   Producers might have pushed elements when the function returns.
+   //!
+   //! <b>Complexity</b>: Constant.
+   //!
+   //! <b>Throws</b>: Nothing.
+   bool empty() BOOST_NOEXCEPT
+   {
+      return data_.tail_ == this->priv_stub()
+         ? !this->priv_next(data_.tail_)
+         : (!this->priv_next(data_.tail_) && data_.tail_ != data_.head_.load(std::memory_order_acquire));
+   }
+};
+
+
+//! Helper metafunction to define a \c mpsc_queue that yields to the same type when the
+//! same options (either explicitly or implicitly) are used.
+#if defined(BOOST_INTRUSIVE_DOXYGEN_INVOKED) || defined(BOOST_INTRUSIVE_VARIADIC_TEMPLATES)
+template<class T, class ...Options>
+#else
+template<class T, class O1 = void, class O2 = void, class O3 = void>
+#endif
+struct make_mpsc_queue
+{
+   /// @cond
+   typedef typename pack_options
+      < mpsc_queue_defaults,
+         #if !defined(BOOST_INTRUSIVE_VARIADIC_TEMPLATES)
+         O1, O2, O3
+         #else
+         Options...
+         #endif
+      >::type packed_options;
+
+   typedef typename detail::get_value_traits
+      <T, typename packed_options::proto_value_traits>::type value_traits;
+   typedef mpsc_queue_impl<value_traits> implementation_defined;
+   /// @endcond
+   typedef implementation_defined type;
+};
+
+
+#ifndef BOOST_INTRUSIVE_DOXYGEN_INVOKED
+
+#if !defined(BOOST_INTRUSIVE_VARIADIC_TEMPLATES)
+template<class T, class O1, class O2, class O3>
+#else
+template<class T, class ...Options>
+#endif
+class mpsc_queue
+   :  public make_mpsc_queue<T,
+      #if !defined(BOOST_INTRUSIVE_VARIADIC_TEMPLATES)
+      O1, O2, O3
+      #else
+      Options...
+      #endif
+   >::type
+{
+   typedef typename make_mpsc_queue
+      <T,
+      #if !defined(BOOST_INTRUSIVE_VARIADIC_TEMPLATES)
+      O1, O2, O3
+      #else
+      Options...
+      #endif
+      >::type      Base;
+   //Assert if passed value traits are compatible with the type
+   BOOST_INTRUSIVE_STATIC_ASSERT((detail::is_same<typename Base::value_traits::value_type, T>::value));
+
+   public:
+   typedef typename Base::value_traits          value_traits;
+
+   inline mpsc_queue()
+      :  Base()
+   {}
+
+   inline explicit mpsc_queue(const value_traits &v_traits)
+      :  Base(v_traits)
+   {}
+};
+
+#endif
+
+} //namespace intrusive
+} //namespace boost
+
+#include <boost/intrusive/detail/config_end.hpp>
+
+#endif //BOOST_INTRUSIVE_MPSC_QUEUE_HPP
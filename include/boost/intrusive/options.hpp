@@ -92,6 +92,31 @@ BOOST_INTRUSIVE_OPTION_TYPE(priority_of_value, PrioOfValue, PrioOfValue, priorit
 //!and division operations when rebalancing the tree.
 BOOST_INTRUSIVE_OPTION_CONSTANT(floating_point, bool, Enabled, floating_point)
 
+//!If activated, scapegoat trees can rebuild unbalanced subtrees
+//!incrementally, performing a bounded number of steps on each
+//!insertion and erasure (see sgtree::rebalance_budget). This option
+//!stores the state of the pending rebuild in the container.
+BOOST_INTRUSIVE_OPTION_CONSTANT(incremental_rebuild, bool, Enabled, incremental_rebuild)
+
+//!If activated, tree based containers store a counter incremented by every
+//!operation that inserts, erases or replaces elements (see bstree::epoch),
+//!so that objects caching elements of the container can detect modifications.
+BOOST_INTRUSIVE_OPTION_CONSTANT(modification_epoch, bool, Enabled, modification_epoch)
+
+//!If activated, lookups of splay trees semi-splay the accessed element:
+//!it is moved up about half of its depth instead of to the root,
+//!which performs fewer rotations on each access.
+BOOST_INTRUSIVE_OPTION_CONSTANT(semi_splay, bool, Enabled, semi_splay)
+
+//!Lookups of splay trees splay the accessed element only once every
+//!Period accesses. Values bigger than one store an access counter in
+//!the container.
+BOOST_INTRUSIVE_OPTION_CONSTANT(splay_period, std::size_t, Period, splay_period)
+
+//!Lookups of splay trees splay the accessed element only if its depth
+//!is greater than Depth, so elements near the root are not moved.
+BOOST_INTRUSIVE_OPTION_CONSTANT(splay_depth_threshold, std::size_t, Depth, splay_depth_threshold)
+
 //!This option setter specifies the equality
 //!functor for the value type
 BOOST_INTRUSIVE_OPTION_TYPE(equal, Equal, Equal, equal)
@@ -183,6 +208,11 @@ BOOST_INTRUSIVE_OPTION_CONSTANT(link_mode, link_mode_type, LinkType, link_mode)
 //!should be optimized for size instead of for speed.
 BOOST_INTRUSIVE_OPTION_CONSTANT(optimize_size, bool, Enabled, optimize_size)
 
+//!This option setter specifies if the list hook should store an order label
+//!so that list containers can tell which of two elements comes first in
+//!constant time. Labels are maintained on insertions and splices.
+BOOST_INTRUSIVE_OPTION_CONSTANT(order_labels, bool, Enabled, order_labels)
+
 //!This option setter specifies if the slist container should
 //!use a linear implementation instead of a circular one.
 BOOST_INTRUSIVE_OPTION_CONSTANT(linear, bool, Enabled, linear)
@@ -266,6 +296,7 @@ struct hook_defaults
    static const bool store_hash = false;
    static const bool linear = false;
    static const bool optimize_multikey = false;
+   static const bool order_labels = false;
 };
 
 /// @endcond
@@ -0,0 +1,200 @@
+/////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright agent 2026
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/intrusive for documentation.
+//
+/////////////////////////////////////////////////////////////////////////////
+
+#ifndef BOOST_INTRUSIVE_ORDER_LIST_ALGORITHMS_HPP
+#define BOOST_INTRUSIVE_ORDER_LIST_ALGORITHMS_HPP
+
+#include <boost/intrusive/detail/config_begin.hpp>
+#include <boost/intrusive/intrusive_fwd.hpp>
+#include <boost/intrusive/detail/workaround.hpp>
+#include <boost/intrusive/detail/algo_type.hpp>
+#include <boost/intrusive/detail/assert.hpp>
+#include <boost/intrusive/circular_list_algorithms.hpp>
+#include <cstddef>
+
+#if defined(BOOST_HAS_PRAGMA_ONCE)
+#  pragma once
+#endif
+
+namespace boost {
+namespace intrusive {
+
+//! order_list_algorithms provides the algorithms of circular_list_algorithms
+//! plus the maintenance of order labels: each element of a circular list
+//! stores an integer label and labels strictly increase from the first element
+//! to the last one, so the relative position of two elements of the same list
+//! is known in constant time comparing their labels. The header node's label is not used.
+//!
+//! Labels are maintained as in the order-maintenance structure of Dietz and Sleator,
+//! with the density thresholds of Bender et al.: a linked element takes a label
+//! between the labels of its neighbours if there is a gap, otherwise the smallest
+//! enclosing power of two label range that is not too dense is relabelled evenly.
+//! Labelling an element is amortized logarithmic to the size of the label universe,
+//! which is constant for a given \c std::size_t width.
+//!
+//! order_list_algorithms is configured with a NodeTraits class, which encapsulates
+//! the information about the node to be manipulated. In addition to the interface
+//! required by circular_list_algorithms, NodeTraits must support the
+//! following interface:
+//!
+//! <b>Static functions</b>:
+//!
+//! <tt>static std::size_t get_label(const_node_ptr n);</tt>
+//!
+//! <tt>static void set_label(node_ptr n, std::size_t label);</tt>
+template<class NodeTraits>
+class order_list_algorithms
+   /// @cond
+   : public circular_list_algorithms<NodeTraits>
+   /// @endcond
+{
+   /// @cond
+   typedef circular_list_algorithms<NodeTraits> base_type;
+   /// @endcond
+
+   public:
+   typedef typename NodeTraits::node            node;
+   typedef typename NodeTraits::node_ptr        node_ptr;
+   typedef typename NodeTraits::const_node_ptr  const_node_ptr;
+   typedef NodeTraits                           node_traits;
+
+   //! Labels are in the range [0, label_universe)
+   static const std::size_t label_universe = (std::size_t(-1) >> 1u) + 1u;
+
+   //! <b>Requires</b>: a and b must be elements of the same circular list
+   //!   labelled by this class.
+   //!
+   //! <b>Returns</b>: true if a is placed before b in their list.
+   //!
+   //! <b>Complexity</b>: Constant
+   //!
+   //! <b>Throws</b>: Nothing.
+   BOOST_INTRUSIVE_FORCEINLINE static bool precedes(const_node_ptr a, const_node_ptr b) BOOST_NOEXCEPT
+   {  return NodeTraits::get_label(a) < NodeTraits::get_label(b);  }
+
+   //! <b>Requires</b>: header must be the header of a circular list whose elements
+   //!   are labelled, except the elements of the range [first, e), which have just
+   //!   been linked in that list.
+   //!
+   //! <b>Effects</b>: Labels the elements of [first, e) and, if needed, relabels
+   //!   some of their neighbours so that labels increase along the list.
+   //!
+   //! <b>Complexity</b>: Linear to the number of elements in the range plus
+   //!   amortized logarithmic to label_universe.
+   //!
+   //! <b>Throws</b>: Nothing.
+   static void label_range(node_ptr header, node_ptr first, node_ptr e) BOOST_NOEXCEPT
+   {
+      std::size_t n = 0;
+      node_ptr last = first;
+      for(node_ptr p = first; p != e; p = NodeTraits::get_next(p)){
+         last = p;
+         ++n;
+      }
+      if(!n)
+         return;
+
+      //Spread the range in the gap left by its neighbours if there is room
+      const node_ptr prev = NodeTraits::get_previous(first);
+      const std::size_t lo = prev == header ? 0u : NodeTraits::get_label(prev) + 1u;
+      const std::size_t hi = e == header ? label_universe : NodeTraits::get_label(e);
+      const std::size_t step = (hi - lo)/(n + 1u);
+      if(step){
+         std::size_t label = lo + step - 1u;
+         for(node_ptr p = first; p != e; p = NodeTraits::get_next(p), label += step)
+            NodeTraits::set_label(p, label);
+         return;
+      }
+
+      //Otherwise give the range the label of a neighbour, so that labels don't decrease,
+      //and relabel the smallest enclosing label range that is sparse enough
+      const std::size_t x = prev == header ? NodeTraits::get_label(e) : NodeTraits::get_label(prev);
+      for(node_ptr p = first; p != e; p = NodeTraits::get_next(p))
+         NodeTraits::set_label(p, x);
+      for(std::size_t level = 1u; ; ++level){
+         const std::size_t width = std::size_t(1u) << level;
+         const std::size_t base  = x & ~(width - 1u);
+         for(node_ptr p = NodeTraits::get_previous(first); p != header && NodeTraits::get_label(p) >= base; p = NodeTraits::get_previous(p)){
+            first = p;
+            ++n;
+         }
+         for(node_ptr p = NodeTraits::get_next(last); p != header && NodeTraits::get_label(p) - base < width; p = NodeTraits::get_next(p)){
+            last = p;
+            ++n;
+         }
+         //The allowed density of a range shrinks as it grows
+         if(width == label_universe || n <= (width >> (level/4u))){
+            BOOST_INTRUSIVE_INVARIANT_ASSERT(n <= width);
+            priv_spread(first, NodeTraits::get_next(last), base, width/n);
+            return;
+         }
+      }
+   }
+
+   //! <b>Requires</b>: header must be the header of a circular list.
+   //!
+   //! <b>Effects</b>: Labels all the elements of the list evenly.
+   //!
+   //! <b>Complexity</b>: Linear to the number of elements in the list.
+   //!
+   //! <b>Throws</b>: Nothing.
+   static void relabel(node_ptr header) BOOST_NOEXCEPT
+   {
+      const std::size_t n = base_type::count(header) - 1u;
+      if(n)
+         priv_spread(NodeTraits::get_next(header), header, 0u, label_universe/n);
+   }
+
+   //! <b>Requires</b>: this_node and other_node must be nodes inserted
+   //!  in circular lists or be empty circular lists.
+   //!
+   //! <b>Effects</b>: Swaps the position of the nodes and their labels: this_node
+   //!   is inserted in other_nodes position in the second circular list and the
+   //!   other_node is inserted in this_node's position in the first circular list.
+   //!
+   //! <b>Complexity</b>: Constant
+   //!
+   //! <b>Throws</b>: Nothing.
+   static void swap_nodes(node_ptr this_node, node_ptr other_node) BOOST_NOEXCEPT
+   {
+      base_type::swap_nodes(this_node, other_node);
+      const std::size_t label = NodeTraits::get_label(this_node);
+      NodeTraits::set_label(this_node, NodeTraits::get_label(other_node));
+      NodeTraits::set_label(other_node, label);
+   }
+
+   /// @cond
+   private:
+   static void priv_spread(node_ptr first, node_ptr e, std::size_t label, std::size_t step) BOOST_NOEXCEPT
+   {
+      for(; first != e; first = NodeTraits::get_next(first), label += step)
+         NodeTraits::set_label(first, label);
+   }
+   /// @endcond
+};
+
+/// @cond
+
+template<class NodeTraits>
+struct get_algo<OrderListAlgorithms, NodeTraits>
+{
+   typedef order_list_algorithms<NodeTraits> type;
+};
+
+/// @endcond
+
+} //namespace intrusive
+} //namespace boost
+
+#include <boost/intrusive/detail/config_end.hpp>
+
+#endif //BOOST_INTRUSIVE_ORDER_LIST_ALGORITHMS_HPP
@@ -0,0 +1,201 @@
+/////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright agent 2026
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/intrusive for documentation.
+//
+/////////////////////////////////////////////////////////////////////////////
+
+#ifndef BOOST_INTRUSIVE_PREFETCH_ITERATOR_HPP
+#define BOOST_INTRUSIVE_PREFETCH_ITERATOR_HPP
+
+#include <boost/intrusive/detail/config_begin.hpp>
+#include <boost/intrusive/intrusive_fwd.hpp>
+#include <boost/intrusive/detail/workaround.hpp>
+#include <boost/intrusive/detail/iterator.hpp>
+#include <boost/move/detail/to_raw_pointer.hpp>
+
+#include <cstddef>   //std::size_t
+
+#if defined(BOOST_HAS_PRAGMA_ONCE)
+#  pragma once
+#endif
+
+namespace boost {
+namespace intrusive {
+
+//! prefetch_iterator adapts a node based iterator of a Boost.Intrusive container
+//! (\c list, \c slist, tree based containers...) to issue software prefetches of the
+//! element placed \c Distance positions ahead during increment.
+//!
+//! A second iterator, that runs \c Distance positions ahead of the current
+//! position, prefetches its node and value, so the cache misses of the following
+//! elements overlap with the work done on the current element. Scans of large containers
+//! whose elements are scattered in memory wait less on each <tt>node->next_</tt> load.
+//!
+//! As the lookahead iterator can't be incremented past the end of the range, the
+//! adaptor stores the end iterator and it's a forward iterator even if \c Iterator is
+//! bidirectional. Prefetches are hints: they are disabled if \c BOOST_INTRUSIVE_DISABLE_PREFETCH
+//! is defined or the compiler offers no prefetch intrinsic.
+template<class Iterator, std::size_t Distance>
+class prefetch_iterator
+{
+   BOOST_INTRUSIVE_STATIC_ASSERT((Distance != 0u));
+
+   public:
+   typedef Iterator                                                  base_iterator;
+   typedef std::forward_iterator_tag                                 iterator_category;
+   typedef typename iterator_traits<Iterator>::value_type            value_type;
+   typedef typename iterator_traits<Iterator>::difference_type       difference_type;
+   typedef typename iterator_traits<Iterator>::pointer               pointer;
+   typedef typename iterator_traits<Iterator>::reference             reference;
+
+   static const std::size_t distance = Distance;
+
+   //! <b>Effects</b>: Constructs a singular iterator.
+   //!
+   //! <b>Throws</b>: Nothing.
+   prefetch_iterator()
+      : it_(), ahead_(), end_()
+   {}
+
+   //! <b>Requires</b>: [it, end) is a valid range.
+   //!
+   //! <b>Effects</b>: Constructs an iterator pointing to it that prefetches
+   //!   the elements of [it, end) \c Distance positions ahead.
+   //!
+   //! <b>Complexity</b>: Linear to \c Distance.
+   //!
+   //! <b>Throws</b>: Nothing.
+   prefetch_iterator(Iterator it, Iterator end)
+      : it_(it), ahead_(it), end_(end)
+   {
+      for(std::size_t i = 0; i != Distance && ahead_ != end_; ++i){
+         ++ahead_;
+         this->priv_prefetch();
+      }
+   }
+
+   //! <b>Effects</b>: Returns the adapted iterator.
+   //!
+   //! <b>Throws</b>: Nothing.
+   Iterator base() const
+   {  return it_;  }
+
+   reference operator*() const
+   {  return *it_;  }
+
+   pointer operator->() const
+   {  return it_.operator->();  }
+
+   prefetch_iterator& operator++()
+   {
+      ++it_;
+      if(ahead_ != end_){
+         ++ahead_;
+         this->priv_prefetch();
+      }
+      return *this;
+   }
+
+   prefetch_iterator operator++(int)
+   {
+      prefetch_iterator result (*this);
+      ++*this;
+      return result;
+   }
+
+   friend bool operator== (const prefetch_iterator& l, const prefetch_iterator& r)
+   {  return l.it_ == r.it_;  }
+
+   friend bool operator!= (const prefetch_iterator& l, const prefetch_iterator& r)
+   {  return !(l == r);  }
+
+   /// @cond
+   private:
+   void priv_prefetch() const
+   {
+      if(ahead_ != end_){
+         BOOST_INTRUSIVE_PREFETCH(boost::movelib::to_raw_pointer(ahead_.pointed_node()));
+         BOOST_INTRUSIVE_PREFETCH(boost::movelib::to_raw_pointer(ahead_.operator->()));
+      }
+   }
+
+   Iterator it_;
+   Iterator ahead_;
+   Iterator end_;
+   /// @endcond
+};
+
+//! <b>Effects</b>: Returns a prefetch_iterator pointing to it that prefetches the elements
+//!   of [it, end) \c Distance positions ahead.
+//!
+//! <b>Throws</b>: Nothing.
+template<std::size_t Distance, class Iterator>
+inline prefetch_iterator<Iterator, Distance> make_prefetch_iterator(Iterator it, Iterator end)
+{  return prefetch_iterator<Iterator, Distance>(it, end);  }
+
+//! <b>Effects</b>: Calls f(x) for each element x of [b, e), in order, prefetching the element
+//!   placed \c Distance positions ahead of the current one.
+//!
+//! <b>Returns</b>: f.
+//!
+//! <b>Complexity</b>: Linear to the size of the range.
+//!
+//! <b>Throws</b>: If f throws.
+template<std::size_t Distance, class Iterator, class UnaryFunction>
+UnaryFunction for_each_prefetched(Iterator b, Iterator e, UnaryFunction f)
+{
+   const prefetch_iterator<Iterator, Distance> end(e, e);
+   for(prefetch_iterator<Iterator, Distance> it(b, e); it != end; ++it){
+      f(*it);
+   }
+   return f;
+}
+
+//! <b>Effects</b>: Calls f(x) for each element x of c, in order, prefetching the element
+//!   placed \c Distance positions ahead of the current one.
+//!
+//! <b>Returns</b>: f.
+//!
+//! <b>Complexity</b>: Linear to the size of the container.
+//!
+//! <b>Throws</b>: If f throws.
+template<std::size_t Distance, class Container, class UnaryFunction>
+inline UnaryFunction for_each_prefetched(Container &c, UnaryFunction f)
+{  return (for_each_prefetched<Distance>)(c.begin(), c.end(), f);  }
+
+//! <b>Effects</b>: Calls f(x) for each element x of [b, e), in order, prefetching the elements
+//!   placed 4 positions ahead of the current one.
+//!
+//! <b>Returns</b>: f.
+//!
+//! <b>Complexity</b>: Linear to the size of the range.
+//!
+//! <b>Throws</b>: If f throws.
+template<class Iterator, class UnaryFunction>
+inline UnaryFunction for_each_prefetched(Iterator b, Iterator e, UnaryFunction f)
+{  return (for_each_prefetched<4u>)(b, e, f);  }
+
+//! <b>Effects</b>: Calls f(x) for each element x of c, in order, prefetching the elements
+//!   placed 4 positions ahead of the current one.
+//!
+//! <b>Returns</b>: f.
+//!
+//! <b>Complexity</b>: Linear to the size of the container.
+//!
+//! <b>Throws</b>: If f throws.
+template<class Container, class UnaryFunction>
+inline UnaryFunction for_each_prefetched(Container &c, UnaryFunction f)
+{  return (for_each_prefetched<4u>)(c.begin(), c.end(), f);  }
+
+} //namespace intrusive
+} //namespace boost
+
+#include <boost/intrusive/detail/config_end.hpp>
+
+#endif //BOOST_INTRUSIVE_PREFETCH_ITERATOR_HPP
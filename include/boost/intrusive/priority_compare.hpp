@@ -18,6 +18,11 @@
 #include <boost/intrusive/intrusive_fwd.hpp>
 
 #include <boost/intrusive/detail/minimal_less_equal_header.hpp>
+#include <boost/intrusive/detail/mpl.hpp>
+#include <boost/intrusive/detail/hash_mix.hpp>
+#include <boost/intrusive/detail/hash.hpp>
+
+#include <cstddef>
 
 #if defined(BOOST_HAS_PRAGMA_ONCE)
 #  pragma once
@@ -64,8 +69,57 @@ struct priority_compare<void>
    }
 };
 
+//! A function object to be used with the \c priority_of_value<> option of treaps
+//! that derives a pseudo-random priority from the address of the value mixing its bits.
+//! Treaps using it are randomized treaps with expected logarithmic depth that don't
+//! store priorities and don't call user code to compare them: the priority of a
+//! node is computed from the node pointer.
+//!
+//! The priority of a value only depends on its address, so it does not change while
+//! the value is linked, even if it is moved between treaps.
+struct address_priority
+{
+   typedef std::size_t type;
+
+   template<class T>
+   inline type operator()(const T &value) const
+   {  return detail::hash_mix(reinterpret_cast<std::size_t>(detail::addressof(value)));  }
+};
+
+//! A function object to be used with the \c priority_of_value<> option of treaps
+//! that derives a pseudo-random priority mixing the bits of the hash of the key of the value.
+//! The key is obtained with \c KeyOfValue (the value itself if \c KeyOfValue is void) and
+//! hashed with an unqualified call to \c hash_value or \c boost::hash.
+//!
+//! Unlike \c address_priority, the shape of the treap is fully determined by the stored keys.
+//! Equivalent keys obtain the same priority and each group of equivalent elements
+//! forms a chain, so \c address_priority is a better fit for multisets with many
+//! equivalent elements.
+template<class KeyOfValue = void>
+struct hash_priority
+{
+   typedef std::size_t type;
+
+   template<class T>
+   inline type operator()(const T &value) const
+   {
+      typedef typename KeyOfValue::type key_type;
+      return detail::hash_mix(detail::internal_hash_functor<key_type>()(KeyOfValue()(value)));
+   }
+};
+
 /// @cond
 
+template<>
+struct hash_priority<void>
+{
+   typedef std::size_t type;
+
+   template<class T>
+   inline type operator()(const T &value) const
+   {  return detail::hash_mix(detail::internal_hash_functor<T>()(value));  }
+};
+
 template<class PrioComp, class T>
 struct get_prio_comp
 {
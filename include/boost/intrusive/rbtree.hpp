@@ -121,30 +121,30 @@ class rbtree_impl
    typedef typename implementation_defined::insert_commit_data insert_commit_data;
 
    //! @copydoc ::boost::intrusive::bstree::bstree()
-   rbtree_impl()
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR rbtree_impl()
       :  tree_type()
    {}
 
    //! @copydoc ::boost::intrusive::bstree::bstree(const key_compare &,const value_traits &)
-   explicit rbtree_impl( const key_compare &cmp, const value_traits &v_traits = value_traits())
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR explicit rbtree_impl( const key_compare &cmp, const value_traits &v_traits = value_traits())
       :  tree_type(cmp, v_traits)
    {}
 
    //! @copydoc ::boost::intrusive::bstree::bstree(bool,Iterator,Iterator,const key_compare &,const value_traits &)
    template<class Iterator>
-   rbtree_impl( bool unique, Iterator b, Iterator e
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR rbtree_impl( bool unique, Iterator b, Iterator e
               , const key_compare &cmp     = key_compare()
               , const value_traits &v_traits = value_traits())
       : tree_type(unique, b, e, cmp, v_traits)
    {}
 
    //! @copydoc ::boost::intrusive::bstree::bstree(bstree &&)
-   rbtree_impl(BOOST_RV_REF(rbtree_impl) x)
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR rbtree_impl(BOOST_RV_REF(rbtree_impl) x)
       :  tree_type(BOOST_MOVE_BASE(tree_type, x))
    {}
 
    //! @copydoc ::boost::intrusive::bstree::operator=(bstree &&)
-   rbtree_impl& operator=(BOOST_RV_REF(rbtree_impl) x)
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR rbtree_impl& operator=(BOOST_RV_REF(rbtree_impl) x)
    {  return static_cast<rbtree_impl&>(tree_type::operator=(BOOST_MOVE_BASE(tree_type, x))); }
 
    #ifdef BOOST_INTRUSIVE_DOXYGEN_INVOKED
@@ -227,6 +227,10 @@ class rbtree_impl
    template <class Cloner, class Disposer>
    void clone_from(const rbtree_impl &src, Cloner cloner, Disposer disposer);
 
+   //! @copydoc ::boost::intrusive::bstree::clone_from(const bstree&,Cloner,Disposer,Executor)
+   template <class Cloner, class Disposer, class Executor>
+   void clone_from(const rbtree_impl &src, Cloner cloner, Disposer disposer, Executor executor);
+
    #else //BOOST_INTRUSIVE_DOXYGEN_INVOKED
 
    using tree_type::clone_from;
@@ -235,7 +239,7 @@ class rbtree_impl
 
    //! @copydoc ::boost::intrusive::bstree::clone_from(bstree&&,Cloner,Disposer)
    template <class Cloner, class Disposer>
-   void clone_from(BOOST_RV_REF(rbtree_impl) src, Cloner cloner, Disposer disposer)
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR void clone_from(BOOST_RV_REF(rbtree_impl) src, Cloner cloner, Disposer disposer)
    {  tree_type::clone_from(BOOST_MOVE_BASE(tree_type, src), cloner, disposer);  }
 
    #ifdef BOOST_INTRUSIVE_DOXYGEN_INVOKED
@@ -331,6 +335,18 @@ class rbtree_impl
    template<class Disposer>
    void clear_and_dispose(Disposer disposer) BOOST_NOEXCEPT;
 
+   //! @copydoc ::boost::intrusive::bstree::clear_and_dispose_some
+   template<class Disposer>
+   bool clear_and_dispose_some(Disposer disposer, size_type max_nodes) BOOST_NOEXCEPT;
+
+   //! @copydoc ::boost::intrusive::bstree::partition(size_type,OutputIterator)
+   template<class OutputIterator>
+   OutputIterator partition(size_type k, OutputIterator out);
+
+   //! @copydoc ::boost::intrusive::bstree::partition(size_type,OutputIterator)const
+   template<class OutputIterator>
+   OutputIterator partition(size_type k, OutputIterator out) const;
+
    //! @copydoc ::boost::intrusive::bstree::count(const key_type &)const
    size_type count(const key_type &key) const;
 
@@ -352,6 +368,20 @@ class rbtree_impl
    template<class KeyType, class KeyTypeKeyCompare>
    const_iterator lower_bound(const KeyType& key, KeyTypeKeyCompare comp) const;
 
+   //! @copydoc ::boost::intrusive::bstree::lower_bound_from(const_iterator,const key_type &)
+   iterator lower_bound_from(const_iterator finger, const key_type &key);
+
+   //! @copydoc ::boost::intrusive::bstree::lower_bound_from(const_iterator,const key_type &)const
+   const_iterator lower_bound_from(const_iterator finger, const key_type &key) const;
+
+   //! @copydoc ::boost::intrusive::bstree::lower_bound_from(const_iterator,const KeyType&,KeyTypeKeyCompare)
+   template<class KeyType, class KeyTypeKeyCompare>
+   iterator lower_bound_from(const_iterator finger, const KeyType &key, KeyTypeKeyCompare comp);
+
+   //! @copydoc ::boost::intrusive::bstree::lower_bound_from(const_iterator,const KeyType&,KeyTypeKeyCompare)const
+   template<class KeyType, class KeyTypeKeyCompare>
+   const_iterator lower_bound_from(const_iterator finger, const KeyType &key, KeyTypeKeyCompare comp) const;
+
    //! @copydoc ::boost::intrusive::bstree::upper_bound(const key_type &)
    iterator upper_bound(const key_type &key);
 
@@ -435,6 +465,22 @@ class rbtree_impl
    //! @copydoc ::boost::intrusive::bstree::replace_node
    void replace_node(iterator replace_this, reference with_this) BOOST_NOEXCEPT;
 
+   //! @copydoc ::boost::intrusive::bstree::relocate(Relocator,Disposer)
+   template <class Relocator, class Disposer>
+   void relocate(Relocator relocator, Disposer disposer);
+
+   //! @copydoc ::boost::intrusive::bstree::relocate(Relocator)
+   template <class Relocator>
+   void relocate(Relocator relocator);
+
+   //! @copydoc ::boost::intrusive::bstree::erase_if(Pred)
+   template<class Pred>
+   size_type erase_if(Pred pred);
+
+   //! @copydoc ::boost::intrusive::bstree::erase_and_dispose_if(Pred,Disposer)
+   template<class Pred, class Disposer>
+   size_type erase_and_dispose_if(Pred pred, Disposer disposer);
+
    //! @copydoc ::boost::intrusive::bstree::remove_node
    void remove_node(reference value) BOOST_NOEXCEPT;
 
@@ -493,7 +539,9 @@ struct make_rbtree
          , typename packed_options::compare
          , typename packed_options::size_type
          , packed_options::constant_time_size
-         , typename packed_options::header_holder_type
+         , typename detail::get_epoch_header_holder
+            < packed_options::modification_epoch
+            , typename packed_options::header_holder_type>::type
          > implementation_defined;
    /// @endcond
    typedef implementation_defined type;
@@ -537,50 +585,54 @@ class rbtree
    //Assert if passed value traits are compatible with the type
    BOOST_INTRUSIVE_STATIC_ASSERT((detail::is_same<typename value_traits::value_type, T>::value));
 
-   inline rbtree()
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR rbtree()
       :  Base()
    {}
 
-   inline explicit rbtree( const key_compare &cmp, const value_traits &v_traits = value_traits())
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR explicit rbtree( const key_compare &cmp, const value_traits &v_traits = value_traits())
       :  Base(cmp, v_traits)
    {}
 
    template<class Iterator>
-   inline rbtree( bool unique, Iterator b, Iterator e
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR rbtree( bool unique, Iterator b, Iterator e
          , const key_compare &cmp = key_compare()
          , const value_traits &v_traits = value_traits())
       :  Base(unique, b, e, cmp, v_traits)
    {}
 
-   inline rbtree(BOOST_RV_REF(rbtree) x)
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR rbtree(BOOST_RV_REF(rbtree) x)
       :  Base(BOOST_MOVE_BASE(Base, x))
    {}
 
-   inline rbtree& operator=(BOOST_RV_REF(rbtree) x)
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR rbtree& operator=(BOOST_RV_REF(rbtree) x)
    {  return static_cast<rbtree &>(this->Base::operator=(BOOST_MOVE_BASE(Base, x)));  }
 
    template <class Cloner, class Disposer>
-   inline void clone_from(const rbtree &src, Cloner cloner, Disposer disposer)
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR void clone_from(const rbtree &src, Cloner cloner, Disposer disposer)
    {  Base::clone_from(src, cloner, disposer);  }
 
    template <class Cloner, class Disposer>
-   inline void clone_from(BOOST_RV_REF(rbtree) src, Cloner cloner, Disposer disposer)
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR void clone_from(BOOST_RV_REF(rbtree) src, Cloner cloner, Disposer disposer)
    {  Base::clone_from(BOOST_MOVE_BASE(Base, src), cloner, disposer);  }
 
+   template <class Cloner, class Disposer, class Executor>
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR void clone_from(const rbtree &src, Cloner cloner, Disposer disposer, Executor executor)
+   {  Base::clone_from(src, cloner, disposer, executor);  }
+
    BOOST_INTRUSIVE_NO_DANGLING
-   inline static rbtree &container_from_end_iterator(iterator end_iterator) BOOST_NOEXCEPT
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR static rbtree &container_from_end_iterator(iterator end_iterator) BOOST_NOEXCEPT
    {  return static_cast<rbtree &>(Base::container_from_end_iterator(end_iterator));   }
 
    BOOST_INTRUSIVE_NO_DANGLING
-   inline static const rbtree &container_from_end_iterator(const_iterator end_iterator) BOOST_NOEXCEPT
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR static const rbtree &container_from_end_iterator(const_iterator end_iterator) BOOST_NOEXCEPT
    {  return static_cast<const rbtree &>(Base::container_from_end_iterator(end_iterator));   }
 
    BOOST_INTRUSIVE_NO_DANGLING
-   inline static rbtree &container_from_iterator(iterator it) BOOST_NOEXCEPT
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR static rbtree &container_from_iterator(iterator it) BOOST_NOEXCEPT
    {  return static_cast<rbtree &>(Base::container_from_iterator(it));   }
 
    BOOST_INTRUSIVE_NO_DANGLING
-   inline static const rbtree &container_from_iterator(const_iterator it) BOOST_NOEXCEPT
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR static const rbtree &container_from_iterator(const_iterator it) BOOST_NOEXCEPT
    {  return static_cast<const rbtree &>(Base::container_from_iterator(it));   }
 };
 
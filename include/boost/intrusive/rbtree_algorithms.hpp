@@ -50,11 +50,11 @@ struct rbtree_node_cloner
    typedef typename NodeTraits::node_ptr  node_ptr;
    typedef detail::ebo_functor_holder<F>  base_t;
 
-   explicit rbtree_node_cloner(F f)
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR explicit rbtree_node_cloner(F f)
       :  base_t(f)
    {}
 
-   node_ptr operator()(node_ptr p)
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR node_ptr operator()(node_ptr p)
    {
       node_ptr n = base_t::get()(p);
       NodeTraits::set_color(n, NodeTraits::get_color(p));
@@ -81,7 +81,7 @@ struct rbtree_node_checker
       std::size_t black_count_;
    };
 
-   rbtree_node_checker(const NodePtrCompare& comp, ExtraChecker extra_checker)
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR rbtree_node_checker(const NodePtrCompare& comp, ExtraChecker extra_checker)
       : base_checker_t(comp, extra_checker)
    {}
 
@@ -205,7 +205,7 @@ class rbtree_algorithms
    #endif   //#ifdef BOOST_INTRUSIVE_DOXYGEN_INVOKED
 
    //! @copydoc ::boost::intrusive::bstree_algorithms::swap_nodes(node_ptr,node_ptr)
-   static void swap_nodes(node_ptr node1, node_ptr node2) BOOST_NOEXCEPT
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR static void swap_nodes(node_ptr node1, node_ptr node2) BOOST_NOEXCEPT
    {
       if(node1 == node2)
          return;
@@ -215,7 +215,7 @@ class rbtree_algorithms
    }
 
    //! @copydoc ::boost::intrusive::bstree_algorithms::swap_nodes(node_ptr,node_ptr,node_ptr,node_ptr)
-   static void swap_nodes(node_ptr node1, node_ptr header1, node_ptr node2, node_ptr header2) BOOST_NOEXCEPT
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR static void swap_nodes(node_ptr node1, node_ptr header1, node_ptr node2, node_ptr header2) BOOST_NOEXCEPT
    {
       if(node1 == node2)   return;
 
@@ -227,7 +227,7 @@ class rbtree_algorithms
    }
 
    //! @copydoc ::boost::intrusive::bstree_algorithms::replace_node(node_ptr,node_ptr)
-   static void replace_node(node_ptr node_to_be_replaced, node_ptr new_node) BOOST_NOEXCEPT
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR static void replace_node(node_ptr node_to_be_replaced, node_ptr new_node) BOOST_NOEXCEPT
    {
       if(node_to_be_replaced == new_node)
          return;
@@ -235,14 +235,14 @@ class rbtree_algorithms
    }
 
    //! @copydoc ::boost::intrusive::bstree_algorithms::replace_node(node_ptr,node_ptr,node_ptr)
-   static void replace_node(node_ptr node_to_be_replaced, node_ptr header, node_ptr new_node) BOOST_NOEXCEPT
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR static void replace_node(node_ptr node_to_be_replaced, node_ptr header, node_ptr new_node) BOOST_NOEXCEPT
    {
       bstree_algo::replace_node(node_to_be_replaced, header, new_node);
       NodeTraits::set_color(new_node, NodeTraits::get_color(node_to_be_replaced));
    }
 
    //! @copydoc ::boost::intrusive::bstree_algorithms::unlink(node_ptr)
-   static void unlink(node_ptr n) BOOST_NOEXCEPT
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR static void unlink(node_ptr n) BOOST_NOEXCEPT
    {
       node_ptr x = NodeTraits::get_parent(n);
       if(x){
@@ -273,14 +273,14 @@ class rbtree_algorithms
    #endif   //#ifdef BOOST_INTRUSIVE_DOXYGEN_INVOKED
 
    //! @copydoc ::boost::intrusive::bstree_algorithms::init_header(node_ptr)
-   static void init_header(node_ptr header) BOOST_NOEXCEPT
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR static void init_header(node_ptr header) BOOST_NOEXCEPT
    {
       bstree_algo::init_header(header);
       NodeTraits::set_color(header, NodeTraits::red());
    }
 
    //! @copydoc ::boost::intrusive::bstree_algorithms::erase(node_ptr,node_ptr)
-   static node_ptr erase(node_ptr header, node_ptr z) BOOST_NOEXCEPT
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR static node_ptr erase(node_ptr header, node_ptr z) BOOST_NOEXCEPT
    {
       typename bstree_algo::data_for_rebalance info;
       bstree_algo::erase(header, z, info);
@@ -288,9 +288,37 @@ class rbtree_algorithms
       return z;
    }
 
+   //! <b>Requires</b>: header must be the header of a tree, [b, e) a range of nodes of
+   //!   that tree and "disposer" an object function taking a node_ptr parameter that
+   //!   shouldn't throw.
+   //!
+   //! <b>Effects</b>: Splits the tree before b and before e and joins the nodes placed
+   //!   before b with e and the nodes placed after e, detaching [b, e) from the tree as a
+   //!   subtree. Then calls <tt>void disposer::operator()(node_ptr)</tt> for every
+   //!   node of the detached range.
+   //!
+   //! <b>Returns</b>: The number of erased nodes.
+   //!
+   //! <b>Complexity</b>: Logarithmic to the size of the tree plus linear to the number
+   //!   of erased nodes. The tree is rebalanced by the joins of the split, instead of
+   //!   once per erased node.
+   //!
+   //! <b>Throws</b>: Nothing.
+   template<class Disposer>
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR static std::size_t erase_range_and_dispose(node_ptr header, node_ptr b, node_ptr e, Disposer disposer) BOOST_NOEXCEPT
+   {
+      rbtree_joiner j;
+      return bstree_algo::erase_range_and_dispose(header, b, e, j, disposer);
+   }
+
+   //! @copydoc ::boost::intrusive::bstree_algorithms::erase_if_and_dispose(node_ptr,NodePred,Disposer)
+   template<class NodePred, class Disposer>
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR static std::size_t erase_if_and_dispose(node_ptr header, NodePred pred, Disposer disposer)
+   {  return bstree_algo::erase_if_and_dispose(header, pred, disposer, rbtree_rebuilder());  }
+
    //! @copydoc ::boost::intrusive::bstree_algorithms::transfer_unique
    template<class NodePtrCompare>
-   static bool transfer_unique
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR static bool transfer_unique
       (node_ptr header1, NodePtrCompare comp, node_ptr header2, node_ptr z)
    {
       typename bstree_algo::data_for_rebalance info;
@@ -304,7 +332,7 @@ class rbtree_algorithms
 
    //! @copydoc ::boost::intrusive::bstree_algorithms::transfer_equal
    template<class NodePtrCompare>
-   static void transfer_equal
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR static void transfer_equal
       (node_ptr header1, NodePtrCompare comp, node_ptr header2, node_ptr z)
    {
       typename bstree_algo::data_for_rebalance info;
@@ -315,13 +343,23 @@ class rbtree_algorithms
 
    //! @copydoc ::boost::intrusive::bstree_algorithms::clone(const_node_ptr,node_ptr,Cloner,Disposer)
    template <class Cloner, class Disposer>
-   static void clone
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR static void clone
       (const_node_ptr source_header, node_ptr target_header, Cloner cloner, Disposer disposer)
    {
       rbtree_node_cloner<NodeTraits, Cloner> new_cloner(cloner);
       bstree_algo::clone(source_header, target_header, new_cloner, disposer);
    }
 
+   //! @copydoc ::boost::intrusive::bstree_algorithms::clone(const_node_ptr,node_ptr,Cloner,Disposer,Executor,std::size_t)
+   template <class Cloner, class Disposer, class Executor>
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR static void clone
+      ( const_node_ptr source_header, node_ptr target_header, Cloner cloner, Disposer disposer
+      , Executor executor, std::size_t fork_levels)
+   {
+      rbtree_node_cloner<NodeTraits, Cloner> new_cloner(cloner);
+      bstree_algo::clone(source_header, target_header, new_cloner, disposer, executor, fork_levels);
+   }
+
    #ifdef BOOST_INTRUSIVE_DOXYGEN_INVOKED
    //! @copydoc ::boost::intrusive::bstree_algorithms::clear_and_dispose(const_node_ptr,Disposer)
    template<class Disposer>
@@ -361,7 +399,7 @@ class rbtree_algorithms
 
    //! @copydoc ::boost::intrusive::bstree_algorithms::insert_equal_upper_bound(node_ptr,node_ptr,NodePtrCompare)
    template<class NodePtrCompare>
-   static node_ptr insert_equal_upper_bound
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR static node_ptr insert_equal_upper_bound
       (node_ptr h, node_ptr new_node, NodePtrCompare comp)
    {
       bstree_algo::insert_equal_upper_bound(h, new_node, comp);
@@ -371,7 +409,7 @@ class rbtree_algorithms
 
    //! @copydoc ::boost::intrusive::bstree_algorithms::insert_equal_lower_bound(node_ptr,node_ptr,NodePtrCompare)
    template<class NodePtrCompare>
-   static node_ptr insert_equal_lower_bound
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR static node_ptr insert_equal_lower_bound
       (node_ptr h, node_ptr new_node, NodePtrCompare comp)
    {
       bstree_algo::insert_equal_lower_bound(h, new_node, comp);
@@ -381,7 +419,7 @@ class rbtree_algorithms
 
    //! @copydoc ::boost::intrusive::bstree_algorithms::insert_equal(node_ptr,node_ptr,node_ptr,NodePtrCompare)
    template<class NodePtrCompare>
-   static node_ptr insert_equal
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR static node_ptr insert_equal
       (node_ptr header, node_ptr hint, node_ptr new_node, NodePtrCompare comp)
    {
       bstree_algo::insert_equal(header, hint, new_node, comp);
@@ -390,7 +428,7 @@ class rbtree_algorithms
    }
 
    //! @copydoc ::boost::intrusive::bstree_algorithms::insert_before(node_ptr,node_ptr,node_ptr)
-   static node_ptr insert_before
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR static node_ptr insert_before
       (node_ptr header, node_ptr pos, node_ptr new_node) BOOST_NOEXCEPT
    {
       bstree_algo::insert_before(header, pos, new_node);
@@ -399,14 +437,14 @@ class rbtree_algorithms
    }
 
    //! @copydoc ::boost::intrusive::bstree_algorithms::push_back(node_ptr,node_ptr)
-   static void push_back(node_ptr header, node_ptr new_node) BOOST_NOEXCEPT
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR static void push_back(node_ptr header, node_ptr new_node) BOOST_NOEXCEPT
    {
       bstree_algo::push_back(header, new_node);
       rebalance_after_insertion(header, new_node);
    }
 
    //! @copydoc ::boost::intrusive::bstree_algorithms::push_front(node_ptr,node_ptr)
-   static void push_front(node_ptr header, node_ptr new_node) BOOST_NOEXCEPT
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR static void push_front(node_ptr header, node_ptr new_node) BOOST_NOEXCEPT
    {
       bstree_algo::push_front(header, new_node);
       rebalance_after_insertion(header, new_node);
@@ -427,7 +465,7 @@ class rbtree_algorithms
    #endif   //#ifdef BOOST_INTRUSIVE_DOXYGEN_INVOKED
 
    //! @copydoc ::boost::intrusive::bstree_algorithms::insert_unique_commit(node_ptr,node_ptr,const insert_commit_data&)
-   static void insert_unique_commit
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR static void insert_unique_commit
       (node_ptr header, node_ptr new_value, const insert_commit_data &commit_data) BOOST_NOEXCEPT
    {
       bstree_algo::insert_unique_commit(header, new_value, commit_data);
@@ -435,7 +473,7 @@ class rbtree_algorithms
    }
 
    //! @copydoc ::boost::intrusive::bstree_algorithms::is_header
-   static bool is_header(const_node_ptr p) BOOST_NOEXCEPT
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR static bool is_header(const_node_ptr p) BOOST_NOEXCEPT
    {
       return NodeTraits::get_color(p) == NodeTraits::red() &&
             bstree_algo::is_header(p);
@@ -444,7 +482,7 @@ class rbtree_algorithms
    /// @cond
    private:
 
-   static void rebalance_after_erasure
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR static void rebalance_after_erasure
       ( node_ptr header, node_ptr z, const typename bstree_algo::data_for_rebalance &info) BOOST_NOEXCEPT
    {
       color new_z_color;
@@ -461,7 +499,7 @@ class rbtree_algorithms
       }
    }
 
-   static void rebalance_after_erasure_restore_invariants(node_ptr header, node_ptr x, node_ptr x_parent) BOOST_NOEXCEPT
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR static void rebalance_after_erasure_restore_invariants(node_ptr header, node_ptr x, node_ptr x_parent) BOOST_NOEXCEPT
    {
       while(1){
          if(x_parent == header || (x && NodeTraits::get_color(x) != NodeTraits::black())){
@@ -546,7 +584,8 @@ class rbtree_algorithms
          NodeTraits::set_color(x, NodeTraits::black());
    }
 
-   static void rebalance_after_insertion(node_ptr header, node_ptr p) BOOST_NOEXCEPT
+   //Returns true if the black height of the tree has grown
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR static bool rebalance_after_insertion(node_ptr header, node_ptr p) BOOST_NOEXCEPT
    {
       NodeTraits::set_color(p, NodeTraits::red());
       while(1){
@@ -594,8 +633,105 @@ class rbtree_algorithms
             break;
          }
       }
-      NodeTraits::set_color(NodeTraits::get_parent(header), NodeTraits::black());
+      const node_ptr root(NodeTraits::get_parent(header));
+      const bool grown = NodeTraits::get_color(root) == NodeTraits::red();
+      NodeTraits::set_color(root, NodeTraits::black());
+      return grown;
    }
+
+   //Erases nodes and colors rebuilt trees: as all leaves of a tree built from a vine are placed
+   //in the two deepest levels, nodes of the deepest level are colored red and the rest black
+   struct rbtree_rebuilder
+   {
+      BOOST_INTRUSIVE_CXX20_CONSTEXPR static void erase(node_ptr header, node_ptr z)
+      {  rbtree_algorithms::erase(header, z);  }
+
+      BOOST_INTRUSIVE_CXX20_CONSTEXPR static void rebuilt(node_ptr root, std::size_t size)
+      {
+         color_subtree(root, 0u, std::size_t(detail::floor_log2(size)));
+         NodeTraits::set_color(root, NodeTraits::black());
+      }
+
+      BOOST_INTRUSIVE_CXX20_CONSTEXPR static void color_subtree(node_ptr n, std::size_t depth, std::size_t red_depth)
+      {
+         for(; n; n = NodeTraits::get_right(n), ++depth){
+            NodeTraits::set_color(n, depth == red_depth ? NodeTraits::red() : NodeTraits::black());
+            color_subtree(NodeTraits::get_left(n), depth + 1u, red_depth);
+         }
+      }
+   };
+
+   //Joins red-black subtrees, heights are black heights that include the root of the subtree
+   struct rbtree_joiner
+   {
+      BOOST_INTRUSIVE_CXX20_CONSTEXPR static bool is_black(node_ptr n)
+      {  return NodeTraits::get_color(n) == NodeTraits::black();  }
+
+      BOOST_INTRUSIVE_CXX20_CONSTEXPR static std::size_t height(node_ptr n)
+      {
+         std::size_t h = 0u;
+         for(; n; n = NodeTraits::get_left(n))
+            h += std::size_t(is_black(n));
+         return h;
+      }
+
+      BOOST_INTRUSIVE_CXX20_CONSTEXPR static std::size_t child_height(node_ptr p, std::size_t hp, bool)
+      {  return hp - std::size_t(is_black(p));  }
+
+      BOOST_INTRUSIVE_CXX20_CONSTEXPR static std::size_t parent_height(node_ptr p, std::size_t hc, bool)
+      {  return hc + std::size_t(is_black(p));  }
+
+      BOOST_INTRUSIVE_CXX20_CONSTEXPR static void make_root(node_ptr n)
+      {
+         if(n)
+            NodeTraits::set_color(n, NodeTraits::black());
+      }
+
+      BOOST_INTRUSIVE_CXX20_CONSTEXPR static node_ptr join(node_ptr header, node_ptr l, std::size_t hl, node_ptr x, node_ptr r, std::size_t hr, std::size_t &h)
+      {
+         //Subtrees are joined with black roots
+         if(l && !is_black(l)){
+            NodeTraits::set_color(l, NodeTraits::black());
+            ++hl;
+         }
+         if(r && !is_black(r)){
+            NodeTraits::set_color(r, NodeTraits::black());
+            ++hr;
+         }
+         if(hl == hr){
+            bstree_algo::link_children(x, l, r);
+            NodeTraits::set_color(x, NodeTraits::black());
+            h = hl + 1u;
+            return x;
+         }
+         //Descend through the inner spine of the taller subtree until a black
+         //node with the black height of the shorter subtree is found, link x there
+         //and fix the red violation as in an insertion
+         const bool left_taller = hr < hl;
+         const node_ptr t(left_taller ? l : r);
+         const std::size_t hs = left_taller ? hr : hl;
+         std::size_t hc = left_taller ? hl : hr;
+         node_ptr p = node_ptr(), c(t);
+         while(c && (hc > hs || !is_black(c))){
+            hc -= std::size_t(is_black(c));
+            p = c;
+            c = left_taller ? NodeTraits::get_right(c) : NodeTraits::get_left(c);
+         }
+         if(left_taller){
+            bstree_algo::link_children(x, c, r);
+            NodeTraits::set_right(p, x);
+         }
+         else{
+            bstree_algo::link_children(x, l, c);
+            NodeTraits::set_left(p, x);
+         }
+         NodeTraits::set_parent(x, p);
+         NodeTraits::set_parent(header, t);
+         NodeTraits::set_parent(t, header);
+         h = (left_taller ? hl : hr) + std::size_t(rebalance_after_insertion(header, x));
+         return NodeTraits::get_parent(header);
+      }
+   };
    /// @endcond
 };
 
@@ -0,0 +1,59 @@
+/////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright agent 2026
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/intrusive for documentation.
+//
+/////////////////////////////////////////////////////////////////////////////
+
+#ifndef BOOST_INTRUSIVE_SEQUENTIAL_EXECUTOR_HPP
+#define BOOST_INTRUSIVE_SEQUENTIAL_EXECUTOR_HPP
+
+#include <boost/intrusive/detail/config_begin.hpp>
+#include <boost/intrusive/intrusive_fwd.hpp>
+#include <boost/intrusive/detail/workaround.hpp>
+
+#if defined(BOOST_HAS_PRAGMA_ONCE)
+#  pragma once
+#endif
+
+namespace boost {
+namespace intrusive {
+
+//! Executors are the fork-join policies passed to the parallel overloads of \c clone_from
+//! of tree based containers and unordered associative containers and to the parallel
+//! overload of \c list::sort. Boost.Intrusive
+//! does not create threads: an executor receives two copyable function objects and
+//! must call both, possibly concurrently, with the following semantics:
+//!
+//! <tt>executor(f, g)</tt> calls <tt>f()</tt> and <tt>g()</tt> and returns when both calls
+//! have finished. If one of the calls throws, the executor must wait for the other call to
+//! finish before propagating the exception. The function objects may be copied.
+//!
+//! Tasks can fork further tasks through the same executor, so an executor
+//! based on a thread pool must let waiting tasks run queued ones or have enough threads.
+//!
+//! sequential_executor calls both function objects in the calling thread, in order.
+struct sequential_executor
+{
+   //! <b>Effects</b>: Calls f() and then g().
+   //!
+   //! <b>Throws</b>: If f() or g() throw.
+   template<class F, class G>
+   void operator()(F f, G g) const
+   {
+      f();
+      g();
+   }
+};
+
+} //namespace intrusive
+} //namespace boost
+
+#include <boost/intrusive/detail/config_end.hpp>
+
+#endif //BOOST_INTRUSIVE_SEQUENTIAL_EXECUTOR_HPP
@@ -88,30 +88,30 @@ class set_impl
 
    public:
    //! @copydoc ::boost::intrusive::rbtree::rbtree()
-   set_impl()
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR set_impl()
       :  tree_type()
    {}
 
    //! @copydoc ::boost::intrusive::rbtree::rbtree(const key_compare &,const value_traits &)
-   explicit set_impl( const key_compare &cmp, const value_traits &v_traits = value_traits())
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR explicit set_impl( const key_compare &cmp, const value_traits &v_traits = value_traits())
       :  tree_type(cmp, v_traits)
    {}
 
    //! @copydoc ::boost::intrusive::rbtree::rbtree(bool,Iterator,Iterator,const key_compare &,const value_traits &)
    template<class Iterator>
-   set_impl( Iterator b, Iterator e
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR set_impl( Iterator b, Iterator e
            , const key_compare &cmp = key_compare()
            , const value_traits &v_traits = value_traits())
       : tree_type(true, b, e, cmp, v_traits)
    {}
 
    //! @copydoc ::boost::intrusive::rbtree::rbtree(rbtree &&)
-   set_impl(BOOST_RV_REF(set_impl) x)
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR set_impl(BOOST_RV_REF(set_impl) x)
       :  tree_type(BOOST_MOVE_BASE(tree_type, x))
    {}
 
    //! @copydoc ::boost::intrusive::rbtree::operator=(rbtree &&)
-   set_impl& operator=(BOOST_RV_REF(set_impl) x)
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR set_impl& operator=(BOOST_RV_REF(set_impl) x)
    {  return static_cast<set_impl&>(tree_type::operator=(BOOST_MOVE_BASE(tree_type, x))); }
 
    #ifdef BOOST_INTRUSIVE_DOXYGEN_INVOKED
@@ -194,6 +194,10 @@ class set_impl
    template <class Cloner, class Disposer>
    void clone_from(const set_impl &src, Cloner cloner, Disposer disposer);
 
+   //! @copydoc ::boost::intrusive::rbtree::clone_from(const rbtree&,Cloner,Disposer,Executor)
+   template <class Cloner, class Disposer, class Executor>
+   void clone_from(const set_impl &src, Cloner cloner, Disposer disposer, Executor executor);
+
    #else
 
    using tree_type::clone_from;
@@ -202,15 +206,15 @@ class set_impl
 
    //! @copydoc ::boost::intrusive::rbtree::clone_from(rbtree&&,Cloner,Disposer)
    template <class Cloner, class Disposer>
-   void clone_from(BOOST_RV_REF(set_impl) src, Cloner cloner, Disposer disposer)
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR void clone_from(BOOST_RV_REF(set_impl) src, Cloner cloner, Disposer disposer)
    {  tree_type::clone_from(BOOST_MOVE_BASE(tree_type, src), cloner, disposer);  }
 
    //! @copydoc ::boost::intrusive::rbtree::insert_unique(reference)
-   std::pair<iterator, bool> insert(reference value)
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR std::pair<iterator, bool> insert(reference value)
    {  return tree_type::insert_unique(value);  }
 
    //! @copydoc ::boost::intrusive::rbtree::insert_unique(const_iterator,reference)
-   iterator insert(const_iterator hint, reference value)
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR iterator insert(const_iterator hint, reference value)
    {  return tree_type::insert_unique(hint, value);  }
 
    //! @copydoc ::boost::intrusive::rbtree::insert_unique_check(const key_type&,insert_commit_data&)
@@ -239,11 +243,11 @@ class set_impl
 
    //! @copydoc ::boost::intrusive::rbtree::insert_unique(Iterator,Iterator)
    template<class Iterator>
-   void insert(Iterator b, Iterator e)
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR void insert(Iterator b, Iterator e)
    {  tree_type::insert_unique(b, e);  }
 
    //! @copydoc ::boost::intrusive::rbtree::insert_unique_commit
-   iterator insert_commit(reference value, const insert_commit_data &commit_data) BOOST_NOEXCEPT
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR iterator insert_commit(reference value, const insert_commit_data &commit_data) BOOST_NOEXCEPT
    {  return tree_type::insert_unique_commit(value, commit_data);  }
 
    #ifdef BOOST_INTRUSIVE_DOXYGEN_INVOKED
@@ -292,15 +296,27 @@ class set_impl
    template<class Disposer>
    void clear_and_dispose(Disposer disposer) BOOST_NOEXCEPT;
 
+   //! @copydoc ::boost::intrusive::rbtree::clear_and_dispose_some
+   template<class Disposer>
+   bool clear_and_dispose_some(Disposer disposer, size_type max_nodes) BOOST_NOEXCEPT;
+
+   //! @copydoc ::boost::intrusive::rbtree::partition(size_type,OutputIterator)
+   template<class OutputIterator>
+   OutputIterator partition(size_type k, OutputIterator out);
+
+   //! @copydoc ::boost::intrusive::rbtree::partition(size_type,OutputIterator)const
+   template<class OutputIterator>
+   OutputIterator partition(size_type k, OutputIterator out) const;
+
    #endif   //   #ifdef BOOST_INTRUSIVE_DOXYGEN_INVOKED
 
    //! @copydoc ::boost::intrusive::rbtree::count(const key_type &)const
-   size_type count(const key_type &key) const
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR size_type count(const key_type &key) const
    {  return static_cast<size_type>(this->tree_type::find(key) != this->tree_type::cend()); }
 
    //! @copydoc ::boost::intrusive::rbtree::count(const KeyType&,KeyTypeKeyCompare)const
    template<class KeyType, class KeyTypeKeyCompare>
-   size_type count(const KeyType& key, KeyTypeKeyCompare comp) const
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR size_type count(const KeyType& key, KeyTypeKeyCompare comp) const
    {  return static_cast<size_type>(this->tree_type::find(key, comp) != this->tree_type::cend()); }
 
    #ifdef BOOST_INTRUSIVE_DOXYGEN_INVOKED
@@ -319,6 +335,20 @@ class set_impl
    template<class KeyType, class KeyTypeKeyCompare>
    const_iterator lower_bound(const KeyType& key, KeyTypeKeyCompare comp) const;
 
+   //! @copydoc ::boost::intrusive::rbtree::lower_bound_from(const_iterator,const key_type &)
+   iterator lower_bound_from(const_iterator finger, const key_type &key);
+
+   //! @copydoc ::boost::intrusive::rbtree::lower_bound_from(const_iterator,const key_type &)const
+   const_iterator lower_bound_from(const_iterator finger, const key_type &key) const;
+
+   //! @copydoc ::boost::intrusive::rbtree::lower_bound_from(const_iterator,const KeyType&,KeyTypeKeyCompare)
+   template<class KeyType, class KeyTypeKeyCompare>
+   iterator lower_bound_from(const_iterator finger, const KeyType &key, KeyTypeKeyCompare comp);
+
+   //! @copydoc ::boost::intrusive::rbtree::lower_bound_from(const_iterator,const KeyType&,KeyTypeKeyCompare)const
+   template<class KeyType, class KeyTypeKeyCompare>
+   const_iterator lower_bound_from(const_iterator finger, const KeyType &key, KeyTypeKeyCompare comp) const;
+
    //! @copydoc ::boost::intrusive::rbtree::upper_bound(const key_type &)
    iterator upper_bound(const key_type &key);
 
@@ -350,12 +380,12 @@ class set_impl
    #endif   //   #ifdef BOOST_INTRUSIVE_DOXYGEN_INVOKED
 
    //! @copydoc ::boost::intrusive::rbtree::equal_range(const key_type &)
-   std::pair<iterator,iterator> equal_range(const key_type &key)
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR std::pair<iterator,iterator> equal_range(const key_type &key)
    {  return this->tree_type::lower_bound_range(key); }
 
    //! @copydoc ::boost::intrusive::rbtree::equal_range(const KeyType&,KeyTypeKeyCompare)
    template<class KeyType, class KeyTypeKeyCompare>
-   std::pair<iterator,iterator> equal_range(const KeyType& key, KeyTypeKeyCompare comp)
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR std::pair<iterator,iterator> equal_range(const KeyType& key, KeyTypeKeyCompare comp)
    {  return this->tree_type::equal_range(key, comp); }
 
    //! @copydoc ::boost::intrusive::rbtree::equal_range(const key_type &)const
@@ -410,6 +440,22 @@ class set_impl
    //! @copydoc ::boost::intrusive::rbtree::replace_node
    void replace_node(iterator replace_this, reference with_this) BOOST_NOEXCEPT;
 
+   //! @copydoc ::boost::intrusive::rbtree::relocate(Relocator,Disposer)
+   template <class Relocator, class Disposer>
+   void relocate(Relocator relocator, Disposer disposer);
+
+   //! @copydoc ::boost::intrusive::rbtree::relocate(Relocator)
+   template <class Relocator>
+   void relocate(Relocator relocator);
+
+   //! @copydoc ::boost::intrusive::rbtree::erase_if(Pred)
+   template<class Pred>
+   size_type erase_if(Pred pred);
+
+   //! @copydoc ::boost::intrusive::rbtree::erase_and_dispose_if(Pred,Disposer)
+   template<class Pred, class Disposer>
+   size_type erase_and_dispose_if(Pred pred, Disposer disposer);
+
    //! @copydoc ::boost::intrusive::rbtree::remove_node
    void remove_node(reference value) BOOST_NOEXCEPT;
 
@@ -424,12 +470,12 @@ class set_impl
    #else
 
    template<class Compare2>
-   void merge(set_impl<ValueTraits, VoidOrKeyOfValue, Compare2, SizeType, ConstantTimeSize, HeaderHolder> &source)
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR void merge(set_impl<ValueTraits, VoidOrKeyOfValue, Compare2, SizeType, ConstantTimeSize, HeaderHolder> &source)
    {  return tree_type::merge_unique(source);  }
 
 
    template<class Compare2>
-   void merge(multiset_impl<ValueTraits, VoidOrKeyOfValue, Compare2, SizeType, ConstantTimeSize, HeaderHolder> &source)
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR void merge(multiset_impl<ValueTraits, VoidOrKeyOfValue, Compare2, SizeType, ConstantTimeSize, HeaderHolder> &source)
    {  return tree_type::merge_unique(source);  }
 
    #endif   //#ifdef BOOST_INTRUSIVE_DOXYGEN_INVOKED
@@ -484,7 +530,9 @@ struct make_set
          , typename packed_options::compare
          , typename packed_options::size_type
          , packed_options::constant_time_size
-         , typename packed_options::header_holder_type
+         , typename detail::get_epoch_header_holder
+            < packed_options::modification_epoch
+            , typename packed_options::header_holder_type>::type
          > implementation_defined;
    /// @endcond
    typedef implementation_defined type;
@@ -524,50 +572,54 @@ class set
    //Assert if passed value traits are compatible with the type
    BOOST_INTRUSIVE_STATIC_ASSERT((detail::is_same<typename value_traits::value_type, T>::value));
 
-   inline set()
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR set()
       :  Base()
    {}
 
-   inline explicit set( const key_compare &cmp, const value_traits &v_traits = value_traits())
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR explicit set( const key_compare &cmp, const value_traits &v_traits = value_traits())
       :  Base(cmp, v_traits)
    {}
 
    template<class Iterator>
-   inline set( Iterator b, Iterator e
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR set( Iterator b, Iterator e
       , const key_compare &cmp = key_compare()
       , const value_traits &v_traits = value_traits())
       :  Base(b, e, cmp, v_traits)
    {}
 
-   inline set(BOOST_RV_REF(set) x)
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR set(BOOST_RV_REF(set) x)
       :  Base(BOOST_MOVE_BASE(Base, x))
    {}
 
-   inline set& operator=(BOOST_RV_REF(set) x)
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR set& operator=(BOOST_RV_REF(set) x)
    {  return static_cast<set &>(this->Base::operator=(BOOST_MOVE_BASE(Base, x)));  }
 
    template <class Cloner, class Disposer>
-   inline void clone_from(const set &src, Cloner cloner, Disposer disposer)
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR void clone_from(const set &src, Cloner cloner, Disposer disposer)
    {  Base::clone_from(src, cloner, disposer);  }
 
    template <class Cloner, class Disposer>
-   inline void clone_from(BOOST_RV_REF(set) src, Cloner cloner, Disposer disposer)
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR void clone_from(BOOST_RV_REF(set) src, Cloner cloner, Disposer disposer)
    {  Base::clone_from(BOOST_MOVE_BASE(Base, src), cloner, disposer);  }
 
+   template <class Cloner, class Disposer, class Executor>
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR void clone_from(const set &src, Cloner cloner, Disposer disposer, Executor executor)
+   {  Base::clone_from(src, cloner, disposer, executor);  }
+
    BOOST_INTRUSIVE_NO_DANGLING
-   inline static set &container_from_end_iterator(iterator end_iterator) BOOST_NOEXCEPT
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR static set &container_from_end_iterator(iterator end_iterator) BOOST_NOEXCEPT
    {  return static_cast<set &>(Base::container_from_end_iterator(end_iterator));   }
 
    BOOST_INTRUSIVE_NO_DANGLING
-   inline static const set &container_from_end_iterator(const_iterator end_iterator) BOOST_NOEXCEPT
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR static const set &container_from_end_iterator(const_iterator end_iterator) BOOST_NOEXCEPT
    {  return static_cast<const set &>(Base::container_from_end_iterator(end_iterator));   }
 
    BOOST_INTRUSIVE_NO_DANGLING
-   inline static set &container_from_iterator(iterator it) BOOST_NOEXCEPT
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR static set &container_from_iterator(iterator it) BOOST_NOEXCEPT
    {  return static_cast<set &>(Base::container_from_iterator(it));   }
 
    BOOST_INTRUSIVE_NO_DANGLING
-   inline static const set &container_from_iterator(const_iterator it) BOOST_NOEXCEPT
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR static const set &container_from_iterator(const_iterator it) BOOST_NOEXCEPT
    {  return static_cast<const set &>(Base::container_from_iterator(it));   }
 };
 
@@ -629,30 +681,30 @@ class multiset_impl
 
    public:
    //! @copydoc ::boost::intrusive::rbtree::rbtree()
-   multiset_impl()
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR multiset_impl()
       :  tree_type()
    {}
 
    //! @copydoc ::boost::intrusive::rbtree::rbtree(const key_compare &,const value_traits &)
-   explicit multiset_impl( const key_compare &cmp, const value_traits &v_traits = value_traits())
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR explicit multiset_impl( const key_compare &cmp, const value_traits &v_traits = value_traits())
       :  tree_type(cmp, v_traits)
    {}
 
    //! @copydoc ::boost::intrusive::rbtree::rbtree(bool,Iterator,Iterator,const key_compare &,const value_traits &)
    template<class Iterator>
-   multiset_impl( Iterator b, Iterator e
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR multiset_impl( Iterator b, Iterator e
                 , const key_compare &cmp = key_compare()
                 , const value_traits &v_traits = value_traits())
       : tree_type(false, b, e, cmp, v_traits)
    {}
 
    //! @copydoc ::boost::intrusive::rbtree::rbtree(rbtree &&)
-   multiset_impl(BOOST_RV_REF(multiset_impl) x)
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR multiset_impl(BOOST_RV_REF(multiset_impl) x)
       :  tree_type(BOOST_MOVE_BASE(tree_type, x))
    {}
 
    //! @copydoc ::boost::intrusive::rbtree::operator=(rbtree &&)
-   multiset_impl& operator=(BOOST_RV_REF(multiset_impl) x)
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR multiset_impl& operator=(BOOST_RV_REF(multiset_impl) x)
    {  return static_cast<multiset_impl&>(tree_type::operator=(BOOST_MOVE_BASE(tree_type, x))); }
 
    #ifdef BOOST_INTRUSIVE_DOXYGEN_INVOKED
@@ -735,6 +787,10 @@ class multiset_impl
    template <class Cloner, class Disposer>
    void clone_from(const multiset_impl &src, Cloner cloner, Disposer disposer);
 
+   //! @copydoc ::boost::intrusive::rbtree::clone_from(const rbtree&,Cloner,Disposer,Executor)
+   template <class Cloner, class Disposer, class Executor>
+   void clone_from(const multiset_impl &src, Cloner cloner, Disposer disposer, Executor executor);
+
    #else
 
    using tree_type::clone_from;
@@ -743,20 +799,20 @@ class multiset_impl
 
    //! @copydoc ::boost::intrusive::rbtree::clone_from(rbtree&&,Cloner,Disposer)
    template <class Cloner, class Disposer>
-   void clone_from(BOOST_RV_REF(multiset_impl) src, Cloner cloner, Disposer disposer)
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR void clone_from(BOOST_RV_REF(multiset_impl) src, Cloner cloner, Disposer disposer)
    {  tree_type::clone_from(BOOST_MOVE_BASE(tree_type, src), cloner, disposer);  }
 
    //! @copydoc ::boost::intrusive::rbtree::insert_equal(reference)
-   iterator insert(reference value)
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR iterator insert(reference value)
    {  return tree_type::insert_equal(value);  }
 
    //! @copydoc ::boost::intrusive::rbtree::insert_equal(const_iterator,reference)
-   iterator insert(const_iterator hint, reference value)
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR iterator insert(const_iterator hint, reference value)
    {  return tree_type::insert_equal(hint, value);  }
 
    //! @copydoc ::boost::intrusive::rbtree::insert_equal(Iterator,Iterator)
    template<class Iterator>
-   void insert(Iterator b, Iterator e)
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR void insert(Iterator b, Iterator e)
    {  tree_type::insert_equal(b, e);  }
 
    #ifdef BOOST_INTRUSIVE_DOXYGEN_INVOKED
@@ -805,6 +861,18 @@ class multiset_impl
    template<class Disposer>
    void clear_and_dispose(Disposer disposer) BOOST_NOEXCEPT;
 
+   //! @copydoc ::boost::intrusive::rbtree::clear_and_dispose_some
+   template<class Disposer>
+   bool clear_and_dispose_some(Disposer disposer, size_type max_nodes) BOOST_NOEXCEPT;
+
+   //! @copydoc ::boost::intrusive::rbtree::partition(size_type,OutputIterator)
+   template<class OutputIterator>
+   OutputIterator partition(size_type k, OutputIterator out);
+
+   //! @copydoc ::boost::intrusive::rbtree::partition(size_type,OutputIterator)const
+   template<class OutputIterator>
+   OutputIterator partition(size_type k, OutputIterator out) const;
+
    //! @copydoc ::boost::intrusive::rbtree::count(const key_type &)const
    size_type count(const key_type &key) const;
 
@@ -826,6 +894,20 @@ class multiset_impl
    template<class KeyType, class KeyTypeKeyCompare>
    const_iterator lower_bound(const KeyType& key, KeyTypeKeyCompare comp) const;
 
+   //! @copydoc ::boost::intrusive::rbtree::lower_bound_from(const_iterator,const key_type &)
+   iterator lower_bound_from(const_iterator finger, const key_type &key);
+
+   //! @copydoc ::boost::intrusive::rbtree::lower_bound_from(const_iterator,const key_type &)const
+   const_iterator lower_bound_from(const_iterator finger, const key_type &key) const;
+
+   //! @copydoc ::boost::intrusive::rbtree::lower_bound_from(const_iterator,const KeyType&,KeyTypeKeyCompare)
+   template<class KeyType, class KeyTypeKeyCompare>
+   iterator lower_bound_from(const_iterator finger, const KeyType &key, KeyTypeKeyCompare comp);
+
+   //! @copydoc ::boost::intrusive::rbtree::lower_bound_from(const_iterator,const KeyType&,KeyTypeKeyCompare)const
+   template<class KeyType, class KeyTypeKeyCompare>
+   const_iterator lower_bound_from(const_iterator finger, const KeyType &key, KeyTypeKeyCompare comp) const;
+
    //! @copydoc ::boost::intrusive::rbtree::upper_bound(const key_type &)
    iterator upper_bound(const key_type &key);
 
@@ -909,6 +991,22 @@ class multiset_impl
    //! @copydoc ::boost::intrusive::rbtree::replace_node
    void replace_node(iterator replace_this, reference with_this) BOOST_NOEXCEPT;
 
+   //! @copydoc ::boost::intrusive::rbtree::relocate(Relocator,Disposer)
+   template <class Relocator, class Disposer>
+   void relocate(Relocator relocator, Disposer disposer);
+
+   //! @copydoc ::boost::intrusive::rbtree::relocate(Relocator)
+   template <class Relocator>
+   void relocate(Relocator relocator);
+
+   //! @copydoc ::boost::intrusive::rbtree::erase_if(Pred)
+   template<class Pred>
+   size_type erase_if(Pred pred);
+
+   //! @copydoc ::boost::intrusive::rbtree::erase_and_dispose_if(Pred,Disposer)
+   template<class Pred, class Disposer>
+   size_type erase_and_dispose_if(Pred pred, Disposer disposer);
+
    //! @copydoc ::boost::intrusive::rbtree::remove_node
    void remove_node(reference value) BOOST_NOEXCEPT;
 
@@ -923,11 +1021,11 @@ class multiset_impl
    #else
 
    template<class Compare2>
-   void merge(multiset_impl<ValueTraits, VoidOrKeyOfValue, Compare2, SizeType, ConstantTimeSize, HeaderHolder> &source)
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR void merge(multiset_impl<ValueTraits, VoidOrKeyOfValue, Compare2, SizeType, ConstantTimeSize, HeaderHolder> &source)
    {  return tree_type::merge_equal(source);  }
 
    template<class Compare2>
-   void merge(set_impl<ValueTraits, VoidOrKeyOfValue, Compare2, SizeType, ConstantTimeSize, HeaderHolder> &source)
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR void merge(set_impl<ValueTraits, VoidOrKeyOfValue, Compare2, SizeType, ConstantTimeSize, HeaderHolder> &source)
    {  return tree_type::merge_equal(source);  }
 
    #endif   //#ifdef BOOST_INTRUSIVE_DOXYGEN_INVOKED
@@ -982,7 +1080,9 @@ struct make_multiset
          , typename packed_options::compare
          , typename packed_options::size_type
          , packed_options::constant_time_size
-         , typename packed_options::header_holder_type
+         , typename detail::get_epoch_header_holder
+            < packed_options::modification_epoch
+            , typename packed_options::header_holder_type>::type
          > implementation_defined;
    /// @endcond
    typedef implementation_defined type;
@@ -1023,50 +1123,54 @@ class multiset
    //Assert if passed value traits are compatible with the type
    BOOST_INTRUSIVE_STATIC_ASSERT((detail::is_same<typename value_traits::value_type, T>::value));
 
-   inline multiset()
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR multiset()
       :  Base()
    {}
 
-   inline explicit multiset( const key_compare &cmp, const value_traits &v_traits = value_traits())
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR explicit multiset( const key_compare &cmp, const value_traits &v_traits = value_traits())
       :  Base(cmp, v_traits)
    {}
 
    template<class Iterator>
-   inline multiset( Iterator b, Iterator e
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR multiset( Iterator b, Iterator e
            , const key_compare &cmp = key_compare()
            , const value_traits &v_traits = value_traits())
       :  Base(b, e, cmp, v_traits)
    {}
 
-   inline multiset(BOOST_RV_REF(multiset) x)
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR multiset(BOOST_RV_REF(multiset) x)
       :  Base(BOOST_MOVE_BASE(Base, x))
    {}
 
-   inline multiset& operator=(BOOST_RV_REF(multiset) x)
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR multiset& operator=(BOOST_RV_REF(multiset) x)
    {  return static_cast<multiset &>(this->Base::operator=(BOOST_MOVE_BASE(Base, x)));  }
 
    template <class Cloner, class Disposer>
-   inline void clone_from(const multiset &src, Cloner cloner, Disposer disposer)
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR void clone_from(const multiset &src, Cloner cloner, Disposer disposer)
    {  Base::clone_from(src, cloner, disposer);  }
 
    template <class Cloner, class Disposer>
-   inline void clone_from(BOOST_RV_REF(multiset) src, Cloner cloner, Disposer disposer)
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR void clone_from(BOOST_RV_REF(multiset) src, Cloner cloner, Disposer disposer)
    {  Base::clone_from(BOOST_MOVE_BASE(Base, src), cloner, disposer);  }
 
+   template <class Cloner, class Disposer, class Executor>
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR void clone_from(const multiset &src, Cloner cloner, Disposer disposer, Executor executor)
+   {  Base::clone_from(src, cloner, disposer, executor);  }
+
    BOOST_INTRUSIVE_NO_DANGLING
-   inline static multiset &container_from_end_iterator(iterator end_iterator) BOOST_NOEXCEPT
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR static multiset &container_from_end_iterator(iterator end_iterator) BOOST_NOEXCEPT
    {  return static_cast<multiset &>(Base::container_from_end_iterator(end_iterator));   }
 
    BOOST_INTRUSIVE_NO_DANGLING
-   inline static const multiset &container_from_end_iterator(const_iterator end_iterator) BOOST_NOEXCEPT
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR static const multiset &container_from_end_iterator(const_iterator end_iterator) BOOST_NOEXCEPT
    {  return static_cast<const multiset &>(Base::container_from_end_iterator(end_iterator));   }
 
    BOOST_INTRUSIVE_NO_DANGLING
-   inline static multiset &container_from_iterator(iterator it) BOOST_NOEXCEPT
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR static multiset &container_from_iterator(iterator it) BOOST_NOEXCEPT
    {  return static_cast<multiset &>(Base::container_from_iterator(it));   }
 
    BOOST_INTRUSIVE_NO_DANGLING
-   inline static const multiset &container_from_iterator(const_iterator it) BOOST_NOEXCEPT
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR static const multiset &container_from_iterator(const_iterator it) BOOST_NOEXCEPT
    {  return static_cast<const multiset &>(Base::container_from_iterator(it));   }
 };
 
@@ -0,0 +1,241 @@
+/////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright agent 2026
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/intrusive for documentation.
+//
+/////////////////////////////////////////////////////////////////////////////
+
+#ifndef BOOST_INTRUSIVE_SET_INTERSECTION_VIEW_HPP
+#define BOOST_INTRUSIVE_SET_INTERSECTION_VIEW_HPP
+
+#include <boost/intrusive/detail/config_begin.hpp>
+#include <boost/intrusive/intrusive_fwd.hpp>
+#include <boost/intrusive/detail/mpl.hpp>
+#include <boost/intrusive/detail/iterator.hpp>
+
+#include <cstddef>   //std::size_t, std::ptrdiff_t
+
+#if defined(BOOST_HAS_PRAGMA_ONCE)
+#  pragma once
+#endif
+
+namespace boost {
+namespace intrusive {
+
+/// @cond
+
+namespace detail {
+
+template<class Tree>
+struct tree_view_iterator
+{
+   typedef typename if_c
+      < is_const<Tree>::value
+      , typename Tree::const_iterator
+      , typename Tree::iterator>::type type;
+};
+
+}  //namespace detail {
+
+/// @endcond
+
+//! set_intersection_view is a read-only forward range over the intersection of two
+//! tree based containers (bstree, rbtree, set, avl_multiset...) that share the same
+//! ordering. It visits the elements of the first tree whose key is also found in the second
+//! tree, following the semantics of std::set_intersection for multi-key containers.
+//!
+//! Instead of stepping both sequences one element at a time, the view gallops: the sequence
+//! that is behind searches the key of the other one with \c lower_bound_from, that starts the
+//! search from the current element climbing towards the root only as much as needed.
+//! Intersecting a tree of k elements with a tree of n elements visits O(k log(n/k)) nodes
+//! in balanced trees instead of O(n + k).
+//!
+//! \c FirstTree and \c SecondTree can be const-qualified. The keys of both trees
+//! are compared with the \c key_compare of \c FirstTree.
+//!
+//! Modifying any tree invalidates the iterators of the view.
+template<class FirstTree, class SecondTree>
+class set_intersection_view
+{
+   public:
+   typedef FirstTree                                                 first_tree_type;
+   typedef SecondTree                                                second_tree_type;
+   typedef typename detail::tree_view_iterator<FirstTree>::type      first_iterator;
+   typedef typename detail::tree_view_iterator<SecondTree>::type     second_iterator;
+   typedef typename first_tree_type::key_compare                     key_compare;
+   typedef typename first_tree_type::size_type                       size_type;
+
+   class iterator
+   {
+      public:
+      typedef std::forward_iterator_tag                                          iterator_category;
+      typedef typename iterator_traits<first_iterator>::value_type               value_type;
+      typedef typename iterator_traits<first_iterator>::difference_type          difference_type;
+      typedef typename iterator_traits<first_iterator>::pointer                  pointer;
+      typedef typename iterator_traits<first_iterator>::reference                reference;
+
+      iterator()
+         : view_(), first_(), second_()
+      {}
+
+      reference operator*() const
+      {  return *first_;  }
+
+      pointer operator->() const
+      {  return first_.operator->();  }
+
+      //! Returns the iterator to the element of the first tree
+      first_iterator first() const
+      {  return first_;  }
+
+      //! Returns the iterator to the matching element of the second tree
+      second_iterator second() const
+      {  return second_;  }
+
+      iterator& operator++()
+      {
+         ++first_;
+         ++second_;
+         view_->priv_settle(first_, second_);
+         return *this;
+      }
+
+      iterator operator++(int)
+      {
+         iterator result (*this);
+         ++*this;
+         return result;
+      }
+
+      friend bool operator== (const iterator& l, const iterator& r)
+      {  return l.first_ == r.first_;  }
+
+      friend bool operator!= (const iterator& l, const iterator& r)
+      {  return !(l == r);  }
+
+      /// @cond
+      private:
+      friend class set_intersection_view;
+
+      iterator(const set_intersection_view *view, first_iterator f, second_iterator s)
+         : view_(view), first_(f), second_(s)
+      {}
+
+      const set_intersection_view *view_;
+      first_iterator    first_;
+      second_iterator   second_;
+      /// @endcond
+   };
+
+   typedef iterator const_iterator;
+
+   //! <b>Effects</b>: Constructs a view of the intersection of first and second.
+   //!
+   //! <b>Complexity</b>: Constant.
+   //!
+   //! <b>Throws</b>: Nothing.
+   set_intersection_view(first_tree_type &first, second_tree_type &second) BOOST_NOEXCEPT
+      : first_(&first), second_(&second)
+   {}
+
+   //! <b>Effects</b>: Returns the first tree.
+   //!
+   //! <b>Complexity</b>: Constant.
+   //!
+   //! <b>Throws</b>: Nothing.
+   first_tree_type &first() const BOOST_NOEXCEPT
+   {  return *first_;  }
+
+   //! <b>Effects</b>: Returns the second tree.
+   //!
+   //! <b>Complexity</b>: Constant.
+   //!
+   //! <b>Throws</b>: Nothing.
+   second_tree_type &second() const BOOST_NOEXCEPT
+   {  return *second_;  }
+
+   //! <b>Effects</b>: Returns an iterator to the first element of the intersection.
+   //!
+   //! <b>Complexity</b>: Logarithmic to the distance to the first common key.
+   //!
+   //! <b>Throws</b>: If the comparison functor throws.
+   iterator begin() const
+   {
+      first_iterator f(first_->begin());
+      second_iterator s(second_->begin());
+      this->priv_settle(f, s);
+      return iterator(this, f, s);
+   }
+
+   //! <b>Effects</b>: Returns an iterator to the end of the intersection.
+   //!
+   //! <b>Complexity</b>: Constant.
+   //!
+   //! <b>Throws</b>: Nothing.
+   iterator end() const
+   {  return iterator(this, first_->end(), second_->end());  }
+
+   /// @cond
+   private:
+   //Advances f and s to the next pair of elements with equivalent keys or to the end
+   void priv_settle(first_iterator &f, second_iterator &s) const
+   {
+      typedef typename first_tree_type::key_of_value   first_key_of_value;
+      typedef typename second_tree_type::key_of_value  second_key_of_value;
+      const key_compare comp(first_->key_comp());
+      const first_iterator fend(first_->end());
+      const second_iterator send(second_->end());
+      while(f != fend && s != send){
+         if(comp(first_key_of_value()(*f), second_key_of_value()(*s))){
+            f = first_->lower_bound_from(f, second_key_of_value()(*s), comp);
+         }
+         else if(comp(second_key_of_value()(*s), first_key_of_value()(*f))){
+            s = second_->lower_bound_from(s, first_key_of_value()(*f), comp);
+         }
+         else{
+            return;
+         }
+      }
+      f = fend;
+      s = send;
+   }
+
+   first_tree_type   *first_;
+   second_tree_type  *second_;
+   /// @endcond
+};
+
+//! <b>Effects</b>: Calls f(x, y) for each pair of elements x of first and y of second
+//!   with equivalent keys, pairing elements as std::set_intersection does for multi-key
+//!   containers. Elements are visited in ascending order. Keys are compared with the
+//!   \c key_compare of \c first.
+//!
+//! <b>Returns</b>: The number of visited pairs.
+//!
+//! <b>Complexity</b>: O(k log(n/k)) comparisons in balanced trees, where k and n
+//!   are the sizes of the smaller and larger trees.
+//!
+//! <b>Throws</b>: If the comparison functor or f throw.
+template<class FirstTree, class SecondTree, class BinaryFunction>
+typename FirstTree::size_type merge_join(FirstTree &first, SecondTree &second, BinaryFunction f)
+{
+   typedef set_intersection_view<FirstTree, SecondTree> view_t;
+   const view_t v(first, second);
+   typename FirstTree::size_type n = 0;
+   for(typename view_t::iterator it(v.begin()), itend(v.end()); it != itend; ++it, ++n){
+      f(*it.first(), *it.second());
+   }
+   return n;
+}
+
+} //namespace intrusive
+} //namespace boost
+
+#include <boost/intrusive/detail/config_end.hpp>
+
+#endif //BOOST_INTRUSIVE_SET_INTERSECTION_VIEW_HPP
@@ -197,12 +197,65 @@ struct alpha_holder<false, SizeType>
    SizeType max_tree_size_;
 };
 
+template<bool Activate, class RebuildData, class SizeType>
+struct rebuild_holder
+{
+   rebuild_holder()
+      : pending_rebuild_(), rebuild_budget_()
+   {}
+
+   //Insertions and erasures leave the rebuild to rebalance_step only if a budget was set
+   RebuildData *get_incremental()
+   {  return rebuild_budget_ ? &pending_rebuild_ : 0;  }
+
+   bool rebuild_pending() const
+   {  return pending_rebuild_.pending();  }
+
+   SizeType get_rebuild_budget() const
+   {  return rebuild_budget_;  }
+
+   void set_rebuild_budget(SizeType budget)
+   {  rebuild_budget_ = budget;  }
+
+   void reset_rebuild()
+   {  pending_rebuild_ = RebuildData();  }
+
+   protected:
+   RebuildData pending_rebuild_;
+   SizeType rebuild_budget_;
+};
+
+template<class RebuildData, class SizeType>
+struct rebuild_holder<false, RebuildData, SizeType>
+{
+   //This specialization rebuilds unbalanced subtrees when
+   //they are detected and stores no additional data.
+   //Downside: the rebuild budget CAN't be changed.
+   RebuildData *get_incremental()
+   {  return 0;  }
+
+   bool rebuild_pending() const
+   {  return false;  }
+
+   SizeType get_rebuild_budget() const
+   {  return 0;  }
+
+   void set_rebuild_budget(SizeType)
+   {  //The budget CAN't be changed.
+      BOOST_INTRUSIVE_INVARIANT_ASSERT(0);
+   }
+
+   void reset_rebuild()
+   {}
+};
+
 }  //namespace detail{
 
 struct sgtree_defaults
    : bstree_defaults
 {
    static const bool floating_point = true;
+   static const bool incremental_rebuild = false;
 };
 
 /// @endcond
@@ -218,17 +271,20 @@ struct sgtree_defaults
 //!
 //! The container supports the following options:
 //! \c base_hook<>/member_hook<>/value_traits<>,
-//! \c floating_point<>, \c size_type<> and
+//! \c floating_point<>, \c incremental_rebuild<>, \c size_type<> and
 //! \c compare<>.
 #if defined(BOOST_INTRUSIVE_DOXYGEN_INVOKED)
 template<class T, class ...Options>
 #else
-template<class ValueTraits, class VoidOrKeyOfValue, class VoidOrKeyComp, class SizeType, bool FloatingPoint, typename HeaderHolder>
+template<class ValueTraits, class VoidOrKeyOfValue, class VoidOrKeyComp, class SizeType, bool FloatingPoint, bool IncrementalRebuild, typename HeaderHolder>
 #endif
 class sgtree_impl
    /// @cond
    :  public bstree_impl<ValueTraits, VoidOrKeyOfValue, VoidOrKeyComp, SizeType, true, SgTreeAlgorithms, HeaderHolder>
    ,  public detail::alpha_holder<FloatingPoint, SizeType>
+   ,  public detail::rebuild_holder
+         < IncrementalRebuild
+         , typename sgtree_algorithms<typename ValueTraits::node_traits>::rebuild_data, SizeType>
    /// @endcond
 {
    public:
@@ -263,6 +319,7 @@ class sgtree_impl
 
    static const bool constant_time_size      = implementation_defined::constant_time_size;
    static const bool floating_point          = FloatingPoint;
+   static const bool incremental_rebuild     = IncrementalRebuild;
    static const bool stateful_value_traits   = implementation_defined::stateful_value_traits;
 
    /// @cond
@@ -270,6 +327,9 @@ class sgtree_impl
 
    //noncopyable
    typedef detail::alpha_holder<FloatingPoint, SizeType>    alpha_traits;
+   typedef typename node_algorithms::rebuild_data           rebuild_data;
+   typedef detail::rebuild_holder
+      <IncrementalRebuild, rebuild_data, SizeType>          rebuild_traits;
    typedef typename alpha_traits::h_alpha_t                 h_alpha_t;
    typedef typename alpha_traits::multiply_by_alpha_t       multiply_by_alpha_t;
 
@@ -312,12 +372,21 @@ class sgtree_impl
    //! @copydoc ::boost::intrusive::bstree::bstree(bstree &&)
    sgtree_impl(BOOST_RV_REF(sgtree_impl) x)
       :  tree_type(BOOST_MOVE_BASE(tree_type, x)), alpha_traits(x.get_alpha_traits())
-   {  ::boost::adl_move_swap(this->get_alpha_traits(), x.get_alpha_traits());   }
+      ,  rebuild_traits(x.get_rebuild_traits())
+   {
+      ::boost::adl_move_swap(this->get_alpha_traits(), x.get_alpha_traits());
+      //The header of x might be the subtree being rebuilt: start again if needed
+      this->reset_rebuild();
+      x.reset_rebuild();
+   }
 
    //! @copydoc ::boost::intrusive::bstree::operator=(bstree &&)
    sgtree_impl& operator=(BOOST_RV_REF(sgtree_impl) x)
    {
       this->get_alpha_traits() = x.get_alpha_traits();
+      this->get_rebuild_traits() = x.get_rebuild_traits();
+      this->reset_rebuild();
+      x.reset_rebuild();
       return static_cast<sgtree_impl&>(tree_type::operator=(BOOST_MOVE_BASE(tree_type, x)));
    }
 
@@ -336,6 +405,30 @@ class sgtree_impl
    multiply_by_alpha_t get_alpha_by_max_size_func() const
    {  return this->get_alpha_traits().get_multiply_by_alpha_t(); }
 
+   const rebuild_traits &get_rebuild_traits() const
+   {  return *this;  }
+
+   rebuild_traits &get_rebuild_traits()
+   {  return *this;  }
+
+   rebuild_data *priv_incremental()
+   {  return this->get_rebuild_traits().get_incremental();  }
+
+   void priv_rebalance_step(size_type budget)
+   {
+      rebuild_data *const incremental = this->priv_incremental();
+      if(incremental && incremental->pending()){
+         std::size_t max_tree_size = (std::size_t)this->max_tree_size_;
+         node_algorithms::rebalance_step
+            ( this->tree_type::header_ptr(), *incremental, (std::size_t)budget
+            , (std::size_t)this->size(), this->get_h_alpha_func(), max_tree_size);
+         this->max_tree_size_ = (size_type)max_tree_size;
+      }
+   }
+
+   void priv_finish_rebuild()
+   {  this->priv_rebalance_step(size_type(-1));  }
+
    /// @endcond
 
    public:
@@ -421,24 +514,43 @@ class sgtree_impl
       //This can throw
       this->tree_type::swap(static_cast<tree_type&>(other));
       ::boost::adl_move_swap(this->get_alpha_traits(), other.get_alpha_traits());
+      //Pending rebuilds might refer to the headers: start again if needed
+      ::boost::adl_move_swap(this->get_rebuild_traits(), other.get_rebuild_traits());
+      this->reset_rebuild();
+      other.reset_rebuild();
    }
 
    //! @copydoc ::boost::intrusive::bstree::clone_from(const bstree&,Cloner,Disposer)
-   //! Additional notes: it also copies the alpha factor from the source container.
+   //! Additional notes: it also copies the alpha factor and the rebalance budget from the source container.
    template <class Cloner, class Disposer>
    void clone_from(const sgtree_impl &src, Cloner cloner, Disposer disposer)
    {
       tree_type::clone_from(src, cloner, disposer);
       this->get_alpha_traits() = src.get_alpha_traits();
+      this->get_rebuild_traits() = src.get_rebuild_traits();
+      this->reset_rebuild();
+   }
+
+   //! @copydoc ::boost::intrusive::bstree::clone_from(const bstree&,Cloner,Disposer,Executor)
+   //! Additional notes: it also copies the alpha factor and the rebalance budget from the source container.
+   template <class Cloner, class Disposer, class Executor>
+   void clone_from(const sgtree_impl &src, Cloner cloner, Disposer disposer, Executor executor)
+   {
+      tree_type::clone_from(src, cloner, disposer, executor);
+      this->get_alpha_traits() = src.get_alpha_traits();
+      this->get_rebuild_traits() = src.get_rebuild_traits();
+      this->reset_rebuild();
    }
 
    //! @copydoc ::boost::intrusive::bstree::clone_from(bstree&&,Cloner,Disposer)
-   //! Additional notes: it also copies the alpha factor from the source container.
+   //! Additional notes: it also copies the alpha factor and the rebalance budget from the source container.
    template <class Cloner, class Disposer>
    void clone_from(BOOST_RV_REF(sgtree_impl) src, Cloner cloner, Disposer disposer)
    {
       tree_type::clone_from(BOOST_MOVE_BASE(tree_type, src), cloner, disposer);
       this->get_alpha_traits() = ::boost::move(src.get_alpha_traits());
+      this->get_rebuild_traits() = src.get_rebuild_traits();
+      this->reset_rebuild();
    }
 
    //! @copydoc ::boost::intrusive::bstree::insert_equal(reference)
@@ -449,9 +561,11 @@ class sgtree_impl
       std::size_t max_tree_size = (std::size_t)this->max_tree_size_;
       node_ptr p = node_algorithms::insert_equal_upper_bound
          (this->tree_type::header_ptr(), to_insert, this->key_node_comp(this->key_comp())
-         , (size_type)this->size(), this->get_h_alpha_func(), max_tree_size);
+         , (size_type)this->size(), this->get_h_alpha_func(), max_tree_size, this->priv_incremental());
       this->tree_type::sz_traits().increment();
+      this->tree_type::increment_epoch();
       this->max_tree_size_ = (size_type)max_tree_size;
+      this->priv_rebalance_step(this->get_rebuild_traits().get_rebuild_budget());
       return iterator(p, this->priv_value_traits_ptr());
    }
 
@@ -463,9 +577,11 @@ class sgtree_impl
       std::size_t max_tree_size = (std::size_t)this->max_tree_size_;
       node_ptr p = node_algorithms::insert_equal
          ( this->tree_type::header_ptr(), hint.pointed_node(), to_insert, this->key_node_comp(this->key_comp())
-         , (std::size_t)this->size(), this->get_h_alpha_func(), max_tree_size);
+         , (std::size_t)this->size(), this->get_h_alpha_func(), max_tree_size, this->priv_incremental());
       this->tree_type::sz_traits().increment();
+      this->tree_type::increment_epoch();
       this->max_tree_size_ = (size_type)max_tree_size;
+      this->priv_rebalance_step(this->get_rebuild_traits().get_rebuild_budget());
       return iterator(p, this->priv_value_traits_ptr());
    }
 
@@ -545,9 +661,11 @@ class sgtree_impl
       std::size_t max_tree_size = (std::size_t)this->max_tree_size_;
       node_algorithms::insert_unique_commit
          ( this->tree_type::header_ptr(), to_insert, commit_data
-         , (std::size_t)this->size(), this->get_h_alpha_func(), max_tree_size);
+         , (std::size_t)this->size(), this->get_h_alpha_func(), max_tree_size, this->priv_incremental());
       this->tree_type::sz_traits().increment();
+      this->tree_type::increment_epoch();
       this->max_tree_size_ = (size_type)max_tree_size;
+      this->priv_rebalance_step(this->get_rebuild_traits().get_rebuild_budget());
       return iterator(to_insert, this->priv_value_traits_ptr());
    }
 
@@ -574,9 +692,11 @@ class sgtree_impl
       std::size_t max_tree_size = (std::size_t)this->max_tree_size_;
       node_ptr p = node_algorithms::insert_before
          ( this->tree_type::header_ptr(), pos.pointed_node(), to_insert
-         , (size_type)this->size(), this->get_h_alpha_func(), max_tree_size);
+         , (size_type)this->size(), this->get_h_alpha_func(), max_tree_size, this->priv_incremental());
       this->tree_type::sz_traits().increment();
+      this->tree_type::increment_epoch();
       this->max_tree_size_ = (size_type)max_tree_size;
+      this->priv_rebalance_step(this->get_rebuild_traits().get_rebuild_budget());
       return iterator(p, this->priv_value_traits_ptr());
    }
 
@@ -588,9 +708,11 @@ class sgtree_impl
       std::size_t max_tree_size = (std::size_t)this->max_tree_size_;
       node_algorithms::push_back
          ( this->tree_type::header_ptr(), to_insert
-         , (size_type)this->size(), this->get_h_alpha_func(), max_tree_size);
+         , (size_type)this->size(), this->get_h_alpha_func(), max_tree_size, this->priv_incremental());
       this->tree_type::sz_traits().increment();
+      this->tree_type::increment_epoch();
       this->max_tree_size_ = (size_type)max_tree_size;
+      this->priv_rebalance_step(this->get_rebuild_traits().get_rebuild_budget());
    }
 
    //! @copydoc ::boost::intrusive::bstree::push_front
@@ -601,9 +723,11 @@ class sgtree_impl
       std::size_t max_tree_size = (std::size_t)this->max_tree_size_;
       node_algorithms::push_front
          ( this->tree_type::header_ptr(), to_insert
-         , (size_type)this->size(), this->get_h_alpha_func(), max_tree_size);
+         , (size_type)this->size(), this->get_h_alpha_func(), max_tree_size, this->priv_incremental());
       this->tree_type::sz_traits().increment();
+      this->tree_type::increment_epoch();
       this->max_tree_size_ = (size_type)max_tree_size;
+      this->priv_rebalance_step(this->get_rebuild_traits().get_rebuild_budget());
    }
 
 
@@ -617,9 +741,11 @@ class sgtree_impl
       std::size_t max_tree_size = this->max_tree_size_;
       node_algorithms::erase
          ( this->tree_type::header_ptr(), to_erase, (std::size_t)this->size()
-         , max_tree_size, this->get_alpha_by_max_size_func());
+         , max_tree_size, this->get_alpha_by_max_size_func(), this->priv_incremental());
       this->max_tree_size_ = (size_type)max_tree_size;
       this->tree_type::sz_traits().decrement();
+      this->tree_type::increment_epoch();
+      this->priv_rebalance_step(this->get_rebuild_traits().get_rebuild_budget());
       BOOST_IF_CONSTEXPR(safemode_or_autounlink)
          node_algorithms::init(to_erase);
       return ret.unconst();
@@ -688,11 +814,44 @@ class sgtree_impl
       return n;
    }
 
+   //! @copydoc ::boost::intrusive::bstree::erase_if(Pred)
+   template<class Pred>
+   size_type erase_if(Pred pred)
+   {  return this->erase_and_dispose_if(pred, detail::null_disposer());   }
+
+   //! @copydoc ::boost::intrusive::bstree::erase_and_dispose_if(Pred,Disposer)
+   template<class Pred, class Disposer>
+   size_type erase_and_dispose_if(Pred pred, Disposer disposer)
+   {
+      std::size_t max_tree_size = (std::size_t)this->max_tree_size_;
+      size_type n = 0;
+      BOOST_INTRUSIVE_TRY{
+         n = (size_type)node_algorithms::erase_if_and_dispose
+            ( this->tree_type::header_ptr()
+            , detail::key_nodeptr_comp<Pred, value_traits>(pred, &this->get_value_traits())
+            , detail::node_disposer<Disposer, value_traits, SgTreeAlgorithms>(disposer, &this->get_value_traits())
+            , (std::size_t)this->size(), max_tree_size, this->get_alpha_by_max_size_func()
+            , this->priv_incremental());
+      }
+      BOOST_INTRUSIVE_CATCH(...){
+         this->tree_type::sz_traits().set_size(size_type(node_algorithms::size(this->tree_type::header_ptr())));
+         this->tree_type::increment_epoch();
+         BOOST_INTRUSIVE_RETHROW;
+      }
+      BOOST_INTRUSIVE_CATCH_END
+      this->max_tree_size_ = (size_type)max_tree_size;
+      this->tree_type::sz_traits().decrease(n);
+      this->tree_type::increment_epoch();
+      this->priv_rebalance_step(this->get_rebuild_traits().get_rebuild_budget());
+      return n;
+   }
+
    //! @copydoc ::boost::intrusive::bstree::clear
    void clear() BOOST_NOEXCEPT
    {
       tree_type::clear();
       this->max_tree_size_ = 0;
+      this->reset_rebuild();
    }
 
    //! @copydoc ::boost::intrusive::bstree::clear_and_dispose
@@ -701,17 +860,40 @@ class sgtree_impl
    {
       tree_type::clear_and_dispose(disposer);
       this->max_tree_size_ = 0;
+      this->reset_rebuild();
+   }
+
+   //! @copydoc ::boost::intrusive::bstree::clear_and_dispose_some
+   template<class Disposer>
+   bool clear_and_dispose_some(Disposer disposer, size_type max_nodes) BOOST_NOEXCEPT
+   {
+      this->reset_rebuild();
+      if(!tree_type::clear_and_dispose_some(disposer, max_nodes))
+         return false;
+      this->max_tree_size_ = 0;
+      return true;
    }
 
    #if defined(BOOST_INTRUSIVE_DOXYGEN_INVOKED)
+   //! @copydoc ::boost::intrusive::bstree::partition(size_type,OutputIterator)
+   template<class OutputIterator>
+   OutputIterator partition(size_type k, OutputIterator out);
+
+   //! @copydoc ::boost::intrusive::bstree::partition(size_type,OutputIterator)const
+   template<class OutputIterator>
+   OutputIterator partition(size_type k, OutputIterator out) const;
+
    //! @copydoc ::boost::intrusive::bstree::merge_unique
    template<class T, class ...Options2> void merge_unique(sgtree<T, Options2...> &);
    #else
    template<class Compare2>
    void merge_unique(sgtree_impl
-      <ValueTraits, VoidOrKeyOfValue, Compare2, SizeType, FloatingPoint, HeaderHolder> &source)
+      <ValueTraits, VoidOrKeyOfValue, Compare2, SizeType, FloatingPoint, IncrementalRebuild, HeaderHolder> &source)
    #endif
    {
+      //Elements are transferred one by one, rebuilding subtrees when detected
+      this->priv_finish_rebuild();
+      source.rebalance_step(size_type(-1));
       node_ptr it   (node_algorithms::begin_node(source.header_ptr()))
              , itend(node_algorithms::end_node  (source.header_ptr()));
 
@@ -730,6 +912,8 @@ class sgtree_impl
             this->sz_traits().increment();
             source.get_max_tree_size() = (size_type)max_tree2_size;
             source.sz_traits().decrement();
+            source.increment_epoch();
+            this->increment_epoch();
          }
       }
    }
@@ -740,9 +924,11 @@ class sgtree_impl
    #else
    template<class Compare2>
    void merge_equal(sgtree_impl
-      <ValueTraits, VoidOrKeyOfValue, Compare2, SizeType, FloatingPoint, HeaderHolder> &source)
+      <ValueTraits, VoidOrKeyOfValue, Compare2, SizeType, FloatingPoint, IncrementalRebuild, HeaderHolder> &source)
    #endif
    {
+      this->priv_finish_rebuild();
+      source.rebalance_step(size_type(-1));
       node_ptr it   (node_algorithms::begin_node(source.header_ptr()))
              , itend(node_algorithms::end_node  (source.header_ptr()));
 
@@ -760,6 +946,8 @@ class sgtree_impl
          this->sz_traits().increment();
          source.get_max_tree_size() = (size_type)max_tree2_size;
          source.sz_traits().decrement();
+         source.increment_epoch();
+         this->increment_epoch();
       }
    }
 
@@ -785,6 +973,20 @@ class sgtree_impl
    template<class KeyType, class KeyTypeKeyCompare>
    const_iterator lower_bound(const KeyType& key, KeyTypeKeyCompare comp) const;
 
+   //! @copydoc ::boost::intrusive::bstree::lower_bound_from(const_iterator,const key_type &)
+   iterator lower_bound_from(const_iterator finger, const key_type &key);
+
+   //! @copydoc ::boost::intrusive::bstree::lower_bound_from(const_iterator,const key_type &)const
+   const_iterator lower_bound_from(const_iterator finger, const key_type &key) const;
+
+   //! @copydoc ::boost::intrusive::bstree::lower_bound_from(const_iterator,const KeyType&,KeyTypeKeyCompare)
+   template<class KeyType, class KeyTypeKeyCompare>
+   iterator lower_bound_from(const_iterator finger, const KeyType &key, KeyTypeKeyCompare comp);
+
+   //! @copydoc ::boost::intrusive::bstree::lower_bound_from(const_iterator,const KeyType&,KeyTypeKeyCompare)const
+   template<class KeyType, class KeyTypeKeyCompare>
+   const_iterator lower_bound_from(const_iterator finger, const KeyType &key, KeyTypeKeyCompare comp) const;
+
    //! @copydoc ::boost::intrusive::bstree::upper_bound(const key_type &)
    iterator upper_bound(const key_type &key);
 
@@ -862,21 +1064,9 @@ class sgtree_impl
    //! @copydoc ::boost::intrusive::bstree::init_node(reference)
    static void init_node(reference value) BOOST_NOEXCEPT;
 
-   //! @copydoc ::boost::intrusive::bstree::unlink_leftmost_without_rebalance
-   pointer unlink_leftmost_without_rebalance() BOOST_NOEXCEPT;
-
-   //! @copydoc ::boost::intrusive::bstree::replace_node
-   void replace_node(iterator replace_this, reference with_this) BOOST_NOEXCEPT;
-
    //! @copydoc ::boost::intrusive::bstree::remove_node
    void remove_node(reference value) BOOST_NOEXCEPT;
 
-   //! @copydoc ::boost::intrusive::bstree::rebalance
-   void rebalance() BOOST_NOEXCEPT;
-
-   //! @copydoc ::boost::intrusive::bstree::rebalance_subtree
-   iterator rebalance_subtree(iterator root) BOOST_NOEXCEPT;
-
    friend bool operator< (const sgtree_impl &x, const sgtree_impl &y);
 
    friend bool operator==(const sgtree_impl &x, const sgtree_impl &y);
@@ -893,6 +1083,112 @@ class sgtree_impl
 
    #endif   //#ifdef BOOST_INTRUSIVE_DOXYGEN_INVOKED
 
+   //! @copydoc ::boost::intrusive::bstree::unlink_leftmost_without_rebalance
+   pointer unlink_leftmost_without_rebalance() BOOST_NOEXCEPT
+   {
+      this->reset_rebuild();
+      return tree_type::unlink_leftmost_without_rebalance();
+   }
+
+   //! @copydoc ::boost::intrusive::bstree::replace_node
+   void replace_node(iterator replace_this, reference with_this) BOOST_NOEXCEPT
+   {
+      const node_ptr replaced(replace_this.pointed_node());
+      tree_type::replace_node(replace_this, with_this);
+      if(rebuild_data *const incremental = this->priv_incremental())
+         incremental->replace_node(replaced, this->get_value_traits().to_node_ptr(with_this));
+   }
+
+   //! @copydoc ::boost::intrusive::bstree::relocate(Relocator,Disposer)
+   template <class Relocator, class Disposer>
+   void relocate(Relocator relocator, Disposer disposer)
+   {
+      this->priv_finish_rebuild();
+      tree_type::relocate(relocator, disposer);
+   }
+
+   //! @copydoc ::boost::intrusive::bstree::relocate(Relocator)
+   template <class Relocator>
+   void relocate(Relocator relocator)
+   {  this->relocate(relocator, detail::null_disposer());  }
+
+   //! @copydoc ::boost::intrusive::bstree::rebalance
+   void rebalance() BOOST_NOEXCEPT
+   {
+      this->reset_rebuild();
+      tree_type::rebalance();
+   }
+
+   //! @copydoc ::boost::intrusive::bstree::rebalance_subtree
+   iterator rebalance_subtree(iterator root) BOOST_NOEXCEPT
+   {
+      this->reset_rebuild();
+      return tree_type::rebalance_subtree(root);
+   }
+
+   //! <b>Returns</b>: The maximum number of rebuild steps performed by each insertion
+   //!   or erasure. Zero (the default) means that unbalanced subtrees are rebuilt as
+   //!   soon as they are detected.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   size_type rebalance_budget() const BOOST_NOEXCEPT
+   {  return this->get_rebuild_traits().get_rebuild_budget();  }
+
+   //! <b>Requires</b>: The incremental_rebuild<true> option must be activated.
+   //!
+   //! <b>Effects</b>: Establishes the maximum number of rebuild steps performed by each
+   //!   insertion or erasure. If new_budget is not zero, insertions and erasures
+   //!   that unbalance the tree don't rebuild the scapegoat subtree: the search of the
+   //!   scapegoat, the flattening of the subtree and its compression are performed
+   //!   in steps (a node visit or a rotation) by subsequent insertions and erasures or
+   //!   by rebalance_step. Each operation performs at most new_budget steps, which bounds
+   //!   its worst-case latency, and the tree can be searched and modified between steps.
+   //!   While a rebuild is pending the tree might be deeper than the scapegoat bound, and
+   //!   budgets lower than the amortized cost of the rebuilds (logarithmic to the size
+   //!   of the tree) might not keep up with adversarial insertion sequences.
+   //!   If new_budget is zero, the pending rebuild is completed.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant if new_budget is not zero. Otherwise linear to the
+   //!   size of the subtree being rebuilt.
+   //!
+   //! <b>Note</b>: remove_node can't notify the container, so it can't be used
+   //!   while a rebuild is pending.
+   void rebalance_budget(size_type new_budget) BOOST_NOEXCEPT
+   {
+      //The budget CAN't be changed unless incremental rebuilds are activated
+      BOOST_INTRUSIVE_STATIC_ASSERT((incremental_rebuild));
+      if(!new_budget)
+         this->priv_finish_rebuild();
+      this->get_rebuild_traits().set_rebuild_budget(new_budget);
+   }
+
+   //! <b>Effects</b>: Performs up to "budget" steps of the pending incremental rebuild,
+   //!   for example, when the application is idle.
+   //!
+   //! <b>Returns</b>: true if a rebuild is still pending.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Linear to budget. Each step might need to find the
+   //!   next node of the subtree, logarithmic to the size of the subtree.
+   bool rebalance_step(size_type budget) BOOST_NOEXCEPT
+   {
+      this->priv_rebalance_step(budget);
+      return this->get_rebuild_traits().rebuild_pending();
+   }
+
+   //! <b>Returns</b>: true if an incremental rebuild is pending.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   bool rebalance_pending() const BOOST_NOEXCEPT
+   {  return this->get_rebuild_traits().rebuild_pending();  }
+
    //! <b>Returns</b>: The balance factor (alpha) used in this tree
    //!
    //! <b>Throws</b>: Nothing.
@@ -930,17 +1226,28 @@ class sgtree_impl
    template<class Disposer>
    iterator private_erase(const_iterator b, const_iterator e, size_type &n, Disposer disposer) BOOST_NOEXCEPT
    {
-      for(n = 0; b != e; ++n)
-        this->erase_and_dispose(b++, disposer);
-      return b.unconst();
+      for(n = 0; b != e; ++n){
+         if(n == tree_type::range_erase_split_threshold){
+            std::size_t max_tree_size = this->max_tree_size_;
+            const size_type erased = (size_type)node_algorithms::erase_range_and_dispose
+               ( this->tree_type::header_ptr(), b.pointed_node(), e.pointed_node(), (std::size_t)this->size()
+               , max_tree_size, this->get_alpha_by_max_size_func()
+               , detail::node_disposer<Disposer, value_traits, SgTreeAlgorithms>(disposer, &this->get_value_traits())
+               , this->priv_incremental());
+            this->max_tree_size_ = (size_type)max_tree_size;
+            this->tree_type::sz_traits().decrease(erased);
+            this->tree_type::increment_epoch();
+            this->priv_rebalance_step(this->get_rebuild_traits().get_rebuild_budget());
+            n += erased;
+            break;
+         }
+         this->erase_and_dispose(b++, disposer);
+      }
+      return e.unconst();
    }
 
    iterator private_erase(const_iterator b, const_iterator e, size_type &n) BOOST_NOEXCEPT
-   {
-      for(n = 0; b != e; ++n)
-        this->erase(b++);
-      return b.unconst();
-   }
+   {  return this->private_erase(b, e, n, detail::null_disposer());  }
    /// @endcond
 };
 
@@ -975,7 +1282,10 @@ struct make_sgtree
          , typename packed_options::compare
          , typename packed_options::size_type
          , packed_options::floating_point
-         , typename packed_options::header_holder_type
+         , packed_options::incremental_rebuild
+         , typename detail::get_epoch_header_holder
+            < packed_options::modification_epoch
+            , typename packed_options::header_holder_type>::type
          > implementation_defined;
    /// @endcond
    typedef implementation_defined type;
@@ -1049,6 +1359,10 @@ class sgtree
    inline void clone_from(BOOST_RV_REF(sgtree) src, Cloner cloner, Disposer disposer)
    {  Base::clone_from(BOOST_MOVE_BASE(Base, src), cloner, disposer);  }
 
+   template <class Cloner, class Disposer, class Executor>
+   inline void clone_from(const sgtree &src, Cloner cloner, Disposer disposer, Executor executor)
+   {  Base::clone_from(src, cloner, disposer, executor);  }
+
    BOOST_INTRUSIVE_NO_DANGLING
    inline static sgtree &container_from_end_iterator(iterator end_iterator) BOOST_NOEXCEPT
    {  return static_cast<sgtree &>(Base::container_from_end_iterator(end_iterator));   }
@@ -73,6 +73,8 @@ class sgtree_algorithms
 
    typedef bstree_algorithms<NodeTraits>  bstree_algo;
 
+   enum { rebuild_idle, rebuild_search, rebuild_flatten, rebuild_compress };
+
    /// @endcond
 
    public:
@@ -84,6 +86,40 @@ class sgtree_algorithms
       std::size_t depth;
    };
 
+   //! This type stores the progress of an incremental rebuild (see rebalance_step).
+   //! A default constructed object means that no rebuild is pending.
+   struct rebuild_data
+   {
+      rebuild_data()
+         : node(), cursor(), depth(), ancestor(), count(), vine(), phase(), left()
+      {}
+
+      //! <b>Returns</b>: true if a rebuild is in progress.
+      bool pending() const
+      {  return phase != 0u;  }
+
+      //! <b>Effects</b>: Updates the rebuild after node_to_be_replaced has been
+      //!   replaced with new_node in the tree.
+      void replace_node(node_ptr node_to_be_replaced, node_ptr new_node)
+      {
+         if(node == node_to_be_replaced)
+            node = new_node;
+         if(cursor == node_to_be_replaced)
+            cursor = new_node;
+      }
+
+      /// @cond
+      node_ptr node;          //Scapegoat candidate while searching, parent of the rebuilt subtree later
+      node_ptr cursor;        //Node being counted, flattened or compressed
+      std::size_t depth;      //Depth of the inserted node that unbalanced the tree
+      std::size_t ancestor;   //Distance from the inserted node to the scapegoat candidate
+      std::size_t count;      //Size of the candidate, vine length or rotations left in a pass
+      std::size_t vine;       //Spine nodes of the following compression passes
+      unsigned char phase;
+      bool left;              //Counting the sibling forwards / the subtree is a left child
+      /// @endcond
+   };
+
    #ifdef BOOST_INTRUSIVE_DOXYGEN_INVOKED
    //! @copydoc ::boost::intrusive::bstree_algorithms::get_header(const_node_ptr)
    static node_ptr get_header(const_node_ptr n) BOOST_NOEXCEPT;
@@ -136,24 +172,87 @@ class sgtree_algorithms
 
    //! @copydoc ::boost::intrusive::bstree_algorithms::erase(node_ptr,node_ptr)
    template<class AlphaByMaxSize>
-   static node_ptr erase(node_ptr header, node_ptr z, std::size_t tree_size, std::size_t &max_tree_size, AlphaByMaxSize alpha_by_maxsize)
+   static node_ptr erase(node_ptr header, node_ptr z, std::size_t tree_size, std::size_t &max_tree_size
+                        , AlphaByMaxSize alpha_by_maxsize, rebuild_data *incremental = 0)
    {
+      if(incremental)
+         rebuild_erasure(*incremental, z);
       bstree_algo::erase(header, z);
       --tree_size;
-      if (tree_size > 0 &&
-          tree_size < static_cast<std::size_t>(alpha_by_maxsize(max_tree_size))){
-         bstree_algo::rebalance(header);
-         max_tree_size = tree_size;
-      }
+      rebalance_after_erasure(header, tree_size, max_tree_size, alpha_by_maxsize, incremental);
       return z;
    }
 
+   //! <b>Requires</b>: header must be the header of a tree of tree_size nodes, [b, e) a range
+   //!   of nodes of that tree and "disposer" an object function taking a node_ptr parameter
+   //!   that shouldn't throw.
+   //!
+   //! <b>Effects</b>: Splits the tree before b and before e and joins the nodes placed
+   //!   before b with e and the nodes placed after e, detaching [b, e) from the tree as a
+   //!   subtree. Then calls <tt>void disposer::operator()(node_ptr)</tt> for every
+   //!   node of the detached range. As in erase, the tree is rebuilt if the remaining
+   //!   size is lower than the allowed by max_tree_size.
+   //!
+   //! <b>Returns</b>: The number of erased nodes.
+   //!
+   //! <b>Complexity</b>: Linear to the height of the tree plus the number of erased nodes,
+   //!   linear to the remaining size if the tree is rebuilt.
+   //!
+   //! <b>Throws</b>: Nothing.
+   template<class AlphaByMaxSize, class Disposer>
+   static std::size_t erase_range_and_dispose
+      ( node_ptr header, node_ptr b, node_ptr e, std::size_t tree_size
+      , std::size_t &max_tree_size, AlphaByMaxSize alpha_by_maxsize, Disposer disposer
+      , rebuild_data *incremental = 0)
+   {
+      //The tree is restructured, a pending rebuild is restarted if needed
+      if(incremental)
+         *incremental = rebuild_data();
+      const std::size_t n = bstree_algo::erase_range_and_dispose(header, b, e, disposer);
+      tree_size -= n;
+      rebalance_after_erasure(header, tree_size, max_tree_size, alpha_by_maxsize, incremental);
+      return n;
+   }
+
+   //! <b>Requires</b>: header must be the header of a tree of tree_size nodes, "pred" an
+   //!   object function taking a node_ptr parameter and "disposer" an object function taking
+   //!   a node_ptr parameter that shouldn't throw.
+   //!
+   //! <b>Effects</b>: Erases the nodes for which pred returns true as
+   //!   bstree_algorithms::erase_if_and_dispose does. As in erase, the tree is rebuilt if
+   //!   the remaining size is lower than the allowed by max_tree_size.
+   //!
+   //! <b>Returns</b>: The number of erased nodes.
+   //!
+   //! <b>Complexity</b>: Linear.
+   //!
+   //! <b>Throws</b>: If "pred" throws. Basic guarantee.
+   template<class NodePred, class Disposer, class AlphaByMaxSize>
+   static std::size_t erase_if_and_dispose
+      ( node_ptr header, NodePred pred, Disposer disposer, std::size_t tree_size
+      , std::size_t &max_tree_size, AlphaByMaxSize alpha_by_maxsize, rebuild_data *incremental = 0)
+   {
+      //The tree is restructured, a pending rebuild is restarted if needed
+      if(incremental)
+         *incremental = rebuild_data();
+      const std::size_t n = bstree_algo::erase_if_and_dispose(header, pred, disposer);
+      tree_size -= n;
+      rebalance_after_erasure(header, tree_size, max_tree_size, alpha_by_maxsize, incremental);
+      return n;
+   }
+
    #ifdef BOOST_INTRUSIVE_DOXYGEN_INVOKED
    //! @copydoc ::boost::intrusive::bstree_algorithms::clone(const_node_ptr,node_ptr,Cloner,Disposer)
    template <class Cloner, class Disposer>
    static void clone
       (const_node_ptr source_header, node_ptr target_header, Cloner cloner, Disposer disposer);
 
+   //! @copydoc ::boost::intrusive::bstree_algorithms::clone(const_node_ptr,node_ptr,Cloner,Disposer,Executor,std::size_t)
+   template <class Cloner, class Disposer, class Executor>
+   static void clone
+      ( const_node_ptr source_header, node_ptr target_header, Cloner cloner, Disposer disposer
+      , Executor executor, std::size_t fork_levels);
+
    //! @copydoc ::boost::intrusive::bstree_algorithms::clear_and_dispose(node_ptr,Disposer)
    template<class Disposer>
    static void clear_and_dispose(node_ptr header, Disposer disposer) BOOST_NOEXCEPT;
@@ -194,11 +293,11 @@ class sgtree_algorithms
    template<class NodePtrCompare, class H_Alpha>
    static node_ptr insert_equal_upper_bound
       (node_ptr h, node_ptr new_node, NodePtrCompare comp
-      ,std::size_t tree_size, H_Alpha h_alpha, std::size_t &max_tree_size)
+      ,std::size_t tree_size, H_Alpha h_alpha, std::size_t &max_tree_size, rebuild_data *incremental = 0)
    {
       std::size_t depth;
       bstree_algo::insert_equal_upper_bound(h, new_node, comp, &depth);
-      rebalance_after_insertion(new_node, depth, tree_size+1, h_alpha, max_tree_size);
+      rebalance_after_insertion(new_node, depth, tree_size+1, h_alpha, max_tree_size, incremental);
       return new_node;
    }
 
@@ -206,11 +305,11 @@ class sgtree_algorithms
    template<class NodePtrCompare, class H_Alpha>
    static node_ptr insert_equal_lower_bound
       (node_ptr h, node_ptr new_node, NodePtrCompare comp
-      ,std::size_t tree_size, H_Alpha h_alpha, std::size_t &max_tree_size)
+      ,std::size_t tree_size, H_Alpha h_alpha, std::size_t &max_tree_size, rebuild_data *incremental = 0)
    {
       std::size_t depth;
       bstree_algo::insert_equal_lower_bound(h, new_node, comp, &depth);
-      rebalance_after_insertion(new_node, depth, tree_size+1, h_alpha, max_tree_size);
+      rebalance_after_insertion(new_node, depth, tree_size+1, h_alpha, max_tree_size, incremental);
       return new_node;
    }
 
@@ -218,11 +317,11 @@ class sgtree_algorithms
    template<class NodePtrCompare, class H_Alpha>
    static node_ptr insert_equal
       (node_ptr header, node_ptr hint, node_ptr new_node, NodePtrCompare comp
-      ,std::size_t tree_size, H_Alpha h_alpha, std::size_t &max_tree_size)
+      ,std::size_t tree_size, H_Alpha h_alpha, std::size_t &max_tree_size, rebuild_data *incremental = 0)
    {
       std::size_t depth;
       bstree_algo::insert_equal(header, hint, new_node, comp, &depth);
-      rebalance_after_insertion(new_node, depth, tree_size+1, h_alpha, max_tree_size);
+      rebalance_after_insertion(new_node, depth, tree_size+1, h_alpha, max_tree_size, incremental);
       return new_node;
    }
 
@@ -230,32 +329,32 @@ class sgtree_algorithms
    template<class H_Alpha>
    static node_ptr insert_before
       (node_ptr header, node_ptr pos, node_ptr new_node
-      ,std::size_t tree_size, H_Alpha h_alpha, std::size_t &max_tree_size)
+      ,std::size_t tree_size, H_Alpha h_alpha, std::size_t &max_tree_size, rebuild_data *incremental = 0)
    {
       std::size_t depth;
       bstree_algo::insert_before(header, pos, new_node, &depth);
-      rebalance_after_insertion(new_node, depth, tree_size+1, h_alpha, max_tree_size);
+      rebalance_after_insertion(new_node, depth, tree_size+1, h_alpha, max_tree_size, incremental);
       return new_node;
    }
 
    //! @copydoc ::boost::intrusive::bstree_algorithms::push_back(node_ptr,node_ptr)
    template<class H_Alpha>
    static void push_back(node_ptr header, node_ptr new_node
-         ,std::size_t tree_size, H_Alpha h_alpha, std::size_t &max_tree_size) BOOST_NOEXCEPT
+         ,std::size_t tree_size, H_Alpha h_alpha, std::size_t &max_tree_size, rebuild_data *incremental = 0) BOOST_NOEXCEPT
    {
       std::size_t depth;
       bstree_algo::push_back(header, new_node, &depth);
-      rebalance_after_insertion(new_node, depth, tree_size+1, h_alpha, max_tree_size);
+      rebalance_after_insertion(new_node, depth, tree_size+1, h_alpha, max_tree_size, incremental);
    }
 
    //! @copydoc ::boost::intrusive::bstree_algorithms::push_front(node_ptr,node_ptr)
    template<class H_Alpha>
    static void push_front(node_ptr header, node_ptr new_node
-         ,std::size_t tree_size, H_Alpha h_alpha, std::size_t &max_tree_size) BOOST_NOEXCEPT
+         ,std::size_t tree_size, H_Alpha h_alpha, std::size_t &max_tree_size, rebuild_data *incremental = 0) BOOST_NOEXCEPT
    {
       std::size_t depth;
       bstree_algo::push_front(header, new_node, &depth);
-      rebalance_after_insertion(new_node, depth, tree_size+1, h_alpha, max_tree_size);
+      rebalance_after_insertion(new_node, depth, tree_size+1, h_alpha, max_tree_size, incremental);
    }
 
    //! @copydoc ::boost::intrusive::bstree_algorithms::insert_unique_check(const_node_ptr,const KeyType&,KeyNodePtrCompare,insert_commit_data&)
@@ -289,8 +388,8 @@ class sgtree_algorithms
    template<class H_Alpha>
    inline static void insert_unique_commit
       (node_ptr header, node_ptr new_value, const insert_commit_data &commit_data
-      ,std::size_t tree_size, H_Alpha h_alpha, std::size_t &max_tree_size)
-   {  return insert_commit(header, new_value, commit_data, tree_size, h_alpha, max_tree_size);  }
+      ,std::size_t tree_size, H_Alpha h_alpha, std::size_t &max_tree_size, rebuild_data *incremental = 0)
+   {  return insert_commit(header, new_value, commit_data, tree_size, h_alpha, max_tree_size, incremental);  }
 
    //! @copydoc ::boost::intrusive::bstree_algorithms::transfer_unique
    template<class NodePtrCompare, class H_Alpha, class AlphaByMaxSize>
@@ -332,9 +431,197 @@ class sgtree_algorithms
    static node_ptr rebalance_subtree(node_ptr old_root) BOOST_NOEXCEPT
    #endif   //#ifdef BOOST_INTRUSIVE_DOXYGEN_INVOKED
 
+   //! <b>Requires</b>: header must be the header of a tree of tree_size nodes. "data" must be
+   //!   the rebuild data passed to the insertion and erasure functions of that tree,
+   //!   h_alpha and max_tree_size the arguments passed to those functions.
+   //!
+   //! <b>Effects</b>: Performs up to "budget" steps of the pending rebuild. Insertion and erasure
+   //!   functions receiving a non-null rebuild_data pointer don't rebuild the unbalanced subtree,
+   //!   but store in it the search of the scapegoat. The search, the flattening of the
+   //!   scapegoat into a vine and its compression into a balanced subtree are then performed
+   //!   by rebalance_step, one node visit or rotation per step. The tree is a valid
+   //!   search tree after each step, so it can be searched and modified between steps.
+   //!
+   //! <b>Returns</b>: true if the rebuild is still pending.
+   //!
+   //! <b>Complexity</b>: Linear to budget (each step might need to find the next node
+   //!   of the scapegoat, logarithmic to the size of the subtree).
+   //!
+   //! <b>Throws</b>: Nothing.
+   template<class H_Alpha>
+   static bool rebalance_step
+      ( node_ptr header, rebuild_data &data, std::size_t budget
+      , std::size_t tree_size, H_Alpha h_alpha, std::size_t &max_tree_size) BOOST_NOEXCEPT
+   {
+      for(; budget && data.pending(); --budget){
+         if(data.phase == rebuild_search)
+            rebuild_search_step(header, data, tree_size, h_alpha, max_tree_size);
+         else if(data.phase == rebuild_flatten)
+            rebuild_flatten_step(header, data);
+         else
+            rebuild_compress_step(header, data);
+      }
+      return data.pending();
+   }
+
    /// @cond
    private:
 
+   template<class AlphaByMaxSize>
+   static void rebalance_after_erasure
+      (node_ptr header, std::size_t tree_size, std::size_t &max_tree_size
+      , AlphaByMaxSize alpha_by_maxsize, rebuild_data *incremental) BOOST_NOEXCEPT
+   {
+      if(!tree_size){
+         if(incremental)
+            *incremental = rebuild_data();
+      }
+      else if(tree_size < static_cast<std::size_t>(alpha_by_maxsize(max_tree_size))){
+         if(!incremental){
+            bstree_algo::rebalance(header);
+         }
+         //Rebuild the whole tree, unless it's already being rebuilt
+         else if(!incremental->pending() || incremental->phase == rebuild_search ||
+                 incremental->node != header){
+            rebuild_start_flatten(header, *incremental, NodeTraits::get_parent(header), tree_size);
+         }
+         max_tree_size = tree_size;
+      }
+   }
+
+   static void rebuild_erasure(rebuild_data &d, node_ptr z) BOOST_NOEXCEPT
+   {
+      if(d.pending()){
+         //If z has two children, its successor takes its place
+         node_ptr moved(z);
+         const node_ptr z_right(NodeTraits::get_right(z));
+         if(z_right && NodeTraits::get_left(z))
+            moved = bstree_algo::minimum(z_right);
+         //Nodes referenced by the rebuild can't be erased or moved: the
+         //rebuild is abandoned and following insertions will start a new one.
+         const node_ptr watched
+            (d.phase == rebuild_search ? NodeTraits::get_parent(d.node) : node_ptr());
+         if(z == d.node || z == d.cursor || z == watched ||
+            moved == d.node || moved == d.cursor || moved == watched){
+            d = rebuild_data();
+         }
+      }
+   }
+
+   //Returns the root of the subtree being rebuilt
+   static node_ptr rebuild_subtree_root(node_ptr header, const rebuild_data &d) BOOST_NOEXCEPT
+   {
+      return d.node == header ? NodeTraits::get_parent(header)
+         : d.left ? NodeTraits::get_left(d.node) : NodeTraits::get_right(d.node);
+   }
+
+   //Starts flattening the subtree of "size" nodes rooted at "root". Nodes inserted after
+   //the size was obtained are not rebuilt, so that the rebuild can't fall behind insertions.
+   static void rebuild_start_flatten(node_ptr header, rebuild_data &d, node_ptr root, std::size_t size) BOOST_NOEXCEPT
+   {
+      const node_ptr root_parent(NodeTraits::get_parent(root));
+      d.node = root_parent;
+      d.left = root_parent != header && NodeTraits::get_left(root_parent) == root;
+      d.cursor = root;
+      d.count = 0u;
+      d.vine = size;
+      d.phase = rebuild_flatten;
+   }
+
+   //Counts one node of the sibling of the scapegoat candidate or
+   //climbs to the parent of the candidate.
+   template<class H_Alpha>
+   static void rebuild_search_step
+      (node_ptr header, rebuild_data &d, std::size_t tree_size, H_Alpha h_alpha, std::size_t &max_tree_size) BOOST_NOEXCEPT
+   {
+      const node_ptr p(NodeTraits::get_parent(d.node));
+      if(!d.cursor){
+         if(d.ancestor == d.depth || p == header){
+            //The whole tree must be rebuilt
+            max_tree_size = tree_size;
+            rebuild_start_flatten(header, d, NodeTraits::get_parent(header), tree_size);
+            return;
+         }
+         const node_ptr p_left(NodeTraits::get_left(p));
+         const node_ptr sibling(p_left == d.node ? NodeTraits::get_right(p) : p_left);
+         if(sibling){
+            //Visit the sibling in order, so that the last visited node is followed by p
+            d.left = sibling == p_left;
+            d.cursor = d.left ? bstree_algo::minimum(sibling) : bstree_algo::maximum(sibling);
+            return;
+         }
+      }
+      else{
+         ++d.count;
+         const node_ptr n(d.left ? bstree_algo::next_node(d.cursor) : bstree_algo::prev_node(d.cursor));
+         if(n != p){
+            if(n == header)
+               d = rebuild_data();
+            else
+               d.cursor = n;
+            return;
+         }
+         d.cursor = node_ptr();
+      }
+      //Obtain parent's size (previous size + parent + sibling tree)
+      ++d.count;
+      d.node = p;
+      if(d.ancestor > h_alpha(d.count))   //is 'p' scapegoat?
+         rebuild_start_flatten(header, d, p, d.count);
+      else
+         ++d.ancestor;
+   }
+
+   //Rotates right the node of the subtree or advances to the next node of the vine
+   static void rebuild_flatten_step(node_ptr header, rebuild_data &d) BOOST_NOEXCEPT
+   {
+      const node_ptr n(d.cursor);
+      if(!n || d.count == d.vine){
+         //The subtree is a vine of d.count nodes (maybe followed by new nodes):
+         //compress it as in vine_to_subtree
+         const std::size_t one_szt = 1u;
+         const std::size_t leaf_nodes = d.count + one_szt - std::size_t(one_szt << detail::floor_log2(d.count + one_szt));
+         d.vine = d.count - leaf_nodes;
+         d.count = leaf_nodes;
+         d.cursor = rebuild_subtree_root(header, d);
+         d.phase = rebuild_compress;
+      }
+      else if(const node_ptr n_left = NodeTraits::get_left(n)){
+         bstree_algo::rotate_right(n, n_left, NodeTraits::get_parent(n), header);
+         d.cursor = n_left;
+      }
+      else{
+         ++d.count;
+         d.cursor = NodeTraits::get_right(n);
+      }
+   }
+
+   //Performs one rotation of a compression pass or starts the next pass
+   static void rebuild_compress_step(node_ptr header, rebuild_data &d) BOOST_NOEXCEPT
+   {
+      if(!d.count){
+         if(d.vine > 1u){
+            d.vine /= 2u;
+            d.count = d.vine;
+            d.cursor = rebuild_subtree_root(header, d);
+         }
+         else{
+            d = rebuild_data();
+         }
+         return;
+      }
+      const node_ptr a(d.cursor);
+      const node_ptr b(a ? NodeTraits::get_right(a) : node_ptr());
+      if(!b){
+         //The vine was modified by insertions or erasures, end the pass
+         d.count = 0u;
+         return;
+      }
+      bstree_algo::rotate_left(a, b, NodeTraits::get_parent(a), header);
+      d.cursor = NodeTraits::get_right(b);
+      --d.count;
+   }
+
    template<class KeyType, class KeyNodePtrCompare>
    static void insert_equal_upper_bound_check
       (node_ptr header,  const KeyType &key
@@ -348,16 +635,16 @@ class sgtree_algorithms
    template<class H_Alpha>
    static void insert_commit
       (node_ptr header, node_ptr new_value, const insert_commit_data &commit_data
-      ,std::size_t tree_size, H_Alpha h_alpha, std::size_t &max_tree_size) BOOST_NOEXCEPT
+      ,std::size_t tree_size, H_Alpha h_alpha, std::size_t &max_tree_size, rebuild_data *incremental = 0) BOOST_NOEXCEPT
    {
       bstree_algo::insert_unique_commit(header, new_value, commit_data);
-      rebalance_after_insertion(new_value, commit_data.depth, tree_size+1, h_alpha, max_tree_size);
+      rebalance_after_insertion(new_value, commit_data.depth, tree_size+1, h_alpha, max_tree_size, incremental);
    }
 
    template<class H_Alpha>
    static void rebalance_after_insertion
       (node_ptr x, std::size_t depth
-      , std::size_t tree_size, H_Alpha h_alpha, std::size_t &max_tree_size) BOOST_NOEXCEPT
+      , std::size_t tree_size, H_Alpha h_alpha, std::size_t &max_tree_size, rebuild_data *incremental) BOOST_NOEXCEPT
    {
       if(tree_size > max_tree_size)
          max_tree_size = tree_size;
@@ -368,6 +655,21 @@ class sgtree_algorithms
          //but since "depth" is the depth of the ancestor of x, i == depth
          depth > h_alpha(tree_size)){
 
+         if(incremental){
+            //The scapegoat is searched and rebuilt by rebalance_step. If a rebuild
+            //is already pending, it is completed first: the depth of the tree will be
+            //checked again by the following insertions.
+            if(!incremental->pending()){
+               incremental->node = x;
+               incremental->cursor = node_ptr();
+               incremental->depth = depth;
+               incremental->ancestor = 1u;
+               incremental->count = 1u;
+               incremental->phase = rebuild_search;
+            }
+            return;
+         }
+
          //Find the first non height-balanced node
          //as described in the section 4.2 of the paper.
          //This method is the alternative method described
@@ -0,0 +1,127 @@
+/////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright agent 2026
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/intrusive for documentation.
+//
+/////////////////////////////////////////////////////////////////////////////
+
+#ifndef BOOST_INTRUSIVE_SIDE_TABLE_VALUE_TRAITS_HPP
+#define BOOST_INTRUSIVE_SIDE_TABLE_VALUE_TRAITS_HPP
+
+#include <boost/intrusive/detail/config_begin.hpp>
+#include <boost/intrusive/intrusive_fwd.hpp>
+#include <boost/intrusive/detail/workaround.hpp>
+#include <boost/intrusive/detail/assert.hpp>
+#include <boost/intrusive/link_mode.hpp>
+#include <boost/intrusive/pointer_traits.hpp>
+#include <boost/move/detail/to_raw_pointer.hpp>
+#include <cstddef>
+
+#if defined(BOOST_HAS_PRAGMA_ONCE)
+#  pragma once
+#endif
+
+namespace boost {
+namespace intrusive {
+
+//! side_table_value_traits is a stateful value traits class that stores the hooks
+//! of the values in a side table instead of the values themselves: values are identified
+//! by their index (id) in an array of values and the hook of <tt>values[id]</tt>
+//! is <tt>hooks[id]</tt>, an element of an array of hooks.
+//!
+//! This keeps the links of several containers densely stored apart from the payload
+//! of the values, which is not polluted by hooks. Hook can be any member hook of
+//! [*Boost.Intrusive] (list, slist, set, avl_set, bs_set, unordered_set...) so the node
+//! traits of all the node algorithms are available. Hooks configured with
+//! <tt>void_pointer< arena_ptr<void> ></tt> store 32 bit links.
+//!
+//! Containers using these value traits must be constructed with a side_table_value_traits
+//! object and values inserted in a container must be elements of its array of values.
+template<class T, class Hook>
+struct side_table_value_traits
+{
+   typedef Hook                                                hook_type;
+   typedef typename hook_type::hooktags::node_traits           node_traits;
+   typedef typename node_traits::node                          node;
+   typedef typename node_traits::node_ptr                      node_ptr;
+   typedef typename node_traits::const_node_ptr                const_node_ptr;
+   typedef T                                                   value_type;
+   typedef typename pointer_traits<node_ptr>::
+      template rebind_pointer<T>::type                         pointer;
+   typedef typename pointer_traits<node_ptr>::
+      template rebind_pointer<const T>::type                   const_pointer;
+   typedef T &                                                 reference;
+   typedef const T &                                           const_reference;
+
+   static const link_mode_type link_mode = hook_type::hooktags::link_mode;
+
+   //! <b>Requires</b>: values and hooks point to the first element of arrays
+   //!   with the same number of elements.
+   //!
+   //! <b>Effects</b>: Constructs value traits that associate values[id] with hooks[id].
+   //!
+   //! <b>Throws</b>: Nothing.
+   side_table_value_traits(T *values, Hook *hooks) BOOST_NOEXCEPT
+      :  values_(values), hooks_(hooks)
+   {}
+
+   //! <b>Requires</b>: value must be an element of the array of values.
+   //!
+   //! <b>Returns</b>: The index of value in the array of values.
+   //!
+   //! <b>Throws</b>: Nothing.
+   BOOST_INTRUSIVE_FORCEINLINE std::size_t id(const_reference value) const BOOST_NOEXCEPT
+   {
+      BOOST_INTRUSIVE_INVARIANT_ASSERT(&value >= values_);
+      return std::size_t(&value - values_);
+   }
+
+   //! <b>Returns</b>: The hook of the value whose index is id.
+   //!
+   //! <b>Throws</b>: Nothing.
+   BOOST_INTRUSIVE_FORCEINLINE hook_type &hook(std::size_t id) const BOOST_NOEXCEPT
+   {  return hooks_[id];  }
+
+   //! <b>Returns</b>: The value whose index is id.
+   //!
+   //! <b>Throws</b>: Nothing.
+   BOOST_INTRUSIVE_FORCEINLINE reference value(std::size_t id) const BOOST_NOEXCEPT
+   {  return values_[id];  }
+
+   BOOST_INTRUSIVE_FORCEINLINE node_ptr to_node_ptr(reference value) const BOOST_NOEXCEPT
+   {  return pointer_traits<node_ptr>::pointer_to(static_cast<node&>(hooks_[this->id(value)]));  }
+
+   BOOST_INTRUSIVE_FORCEINLINE const_node_ptr to_node_ptr(const_reference value) const BOOST_NOEXCEPT
+   {  return pointer_traits<const_node_ptr>::pointer_to(static_cast<const node&>(hooks_[this->id(value)]));  }
+
+   BOOST_INTRUSIVE_FORCEINLINE pointer to_value_ptr(node_ptr n) const BOOST_NOEXCEPT
+   {  return pointer_traits<pointer>::pointer_to(values_[this->priv_id(n)]);  }
+
+   BOOST_INTRUSIVE_FORCEINLINE const_pointer to_value_ptr(const_node_ptr n) const BOOST_NOEXCEPT
+   {  return pointer_traits<const_pointer>::pointer_to(values_[this->priv_id(n)]);  }
+
+   /// @cond
+   private:
+   BOOST_INTRUSIVE_FORCEINLINE std::size_t priv_id(const_node_ptr n) const BOOST_NOEXCEPT
+   {
+      const Hook *h = static_cast<const Hook*>(boost::movelib::to_raw_pointer(n));
+      BOOST_INTRUSIVE_INVARIANT_ASSERT(h >= hooks_);
+      return std::size_t(h - hooks_);
+   }
+
+   T    *values_;
+   Hook *hooks_;
+   /// @endcond
+};
+
+} //namespace intrusive
+} //namespace boost
+
+#include <boost/intrusive/detail/config_end.hpp>
+
+#endif //BOOST_INTRUSIVE_SIDE_TABLE_VALUE_TRAITS_HPP
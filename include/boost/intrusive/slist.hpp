@@ -37,6 +37,7 @@
 #include <boost/intrusive/detail/simple_disposers.hpp>
 #include <boost/intrusive/detail/size_holder.hpp>
 #include <boost/intrusive/detail/algorithm.hpp>
+#include <boost/intrusive/detail/key_sort_algorithms.hpp>
 #include <boost/intrusive/detail/value_functors.hpp>
 #include <boost/intrusive/detail/node_cloner_disposer.hpp>
 
@@ -171,50 +172,50 @@ class slist_impl
    //A list with cached last node is incompatible with auto-unlink hooks!
    BOOST_INTRUSIVE_STATIC_ASSERT(!(cache_last && ((int)value_traits::link_mode == (int)auto_unlink)));
 
-   inline node_ptr get_end_node()
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR node_ptr get_end_node()
    {  return node_algorithms::end_node(this->get_root_node());  }
 
-   inline const_node_ptr get_end_node() const
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR const_node_ptr get_end_node() const
    {  return node_algorithms::end_node(this->get_root_node());  }
 
-   inline node_ptr get_root_node()
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR node_ptr get_root_node()
    { return data_.root_plus_size_.header_holder_.get_node(); }
 
-   inline const_node_ptr get_root_node() const
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR const_node_ptr get_root_node() const
    { return data_.root_plus_size_.header_holder_.get_node(); }
 
-   inline node_ptr get_last_node()
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR node_ptr get_last_node()
    {  return this->get_last_node(detail::bool_<cache_last>());  }
 
-   inline const_node_ptr get_last_node() const
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR const_node_ptr get_last_node() const
    {  return this->get_last_node(detail::bool_<cache_last>());  }
 
-   inline void set_last_node(node_ptr n)
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR void set_last_node(node_ptr n)
    {  return this->set_last_node(n, detail::bool_<cache_last>());  }
 
-   inline static node_ptr get_last_node(detail::bool_<false>)
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR static node_ptr get_last_node(detail::bool_<false>)
    {
       //This function shall not be used if cache_last is not true
       BOOST_INTRUSIVE_INVARIANT_ASSERT(cache_last);
       return node_ptr();
    }
 
-   inline static void set_last_node(node_ptr , detail::bool_<false>)
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR static void set_last_node(node_ptr , detail::bool_<false>)
    {
       //This function shall not be used if cache_last is not true
       BOOST_INTRUSIVE_INVARIANT_ASSERT(cache_last);
    }
 
-   inline node_ptr get_last_node(detail::bool_<true>)
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR node_ptr get_last_node(detail::bool_<true>)
    {  return node_ptr(data_.root_plus_size_.last_);  }
 
-   inline const_node_ptr get_last_node(detail::bool_<true>) const
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR const_node_ptr get_last_node(detail::bool_<true>) const
    {  return const_node_ptr(data_.root_plus_size_.last_);  }
 
-   inline void set_last_node(node_ptr n, detail::bool_<true>)
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR void set_last_node(node_ptr n, detail::bool_<true>)
    {  data_.root_plus_size_.last_ = n;  }
 
-   void set_default_constructed_state()
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR void set_default_constructed_state()
    {
       node_algorithms::init_header(this->get_root_node());
       this->priv_size_traits().set_size(size_type(0));
@@ -233,29 +234,29 @@ class slist_impl
       :  public value_traits
    {
       typedef typename slist_impl::value_traits value_traits;
-      explicit data_t(const value_traits &val_traits)
+      BOOST_INTRUSIVE_CXX20_CONSTEXPR explicit data_t(const value_traits &val_traits)
          :  value_traits(val_traits)
       {}
 
       root_plus_size root_plus_size_;
    } data_;
 
-   inline size_traits &priv_size_traits()
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR size_traits &priv_size_traits()
    {  return data_.root_plus_size_;  }
 
-   inline const size_traits &priv_size_traits() const
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR const size_traits &priv_size_traits() const
    {  return data_.root_plus_size_;  }
 
-   inline const value_traits &priv_value_traits() const
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR const value_traits &priv_value_traits() const
    {  return data_;  }
 
-   inline value_traits &priv_value_traits()
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR value_traits &priv_value_traits()
    {  return data_;  }
 
    typedef typename boost::intrusive::value_traits_pointers
       <ValueTraits>::const_value_traits_ptr const_value_traits_ptr;
 
-   inline const_value_traits_ptr priv_value_traits_ptr() const
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR const_value_traits_ptr priv_value_traits_ptr() const
    {  return pointer_traits<const_value_traits_ptr>::pointer_to(this->priv_value_traits());  }
 
    /// @endcond
@@ -279,7 +280,7 @@ class slist_impl
    //!   list. Iterators of this list and all the references are not invalidated.
    //!
    //! <b>Warning</b>: Experimental function, don't use it!
-   slist_impl( node_ptr f, node_ptr before_l
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR slist_impl( node_ptr f, node_ptr before_l
              , size_type n, const value_traits &v_traits = value_traits())
       :  data_(v_traits)
    {
@@ -304,7 +305,7 @@ class slist_impl
    //!
    //! <b>Throws</b>: If value_traits::node_traits::node
    //!   constructor throws (this does not happen with predefined Boost.Intrusive hooks).
-   slist_impl()
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR slist_impl()
       :  data_(value_traits())
    {  this->set_default_constructed_state(); }
 
@@ -314,7 +315,7 @@ class slist_impl
    //!
    //! <b>Throws</b>: If value_traits::node_traits::node
    //!   constructor throws (this does not happen with predefined Boost.Intrusive hooks).
-   explicit slist_impl(const value_traits &v_traits)
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR explicit slist_impl(const value_traits &v_traits)
       :  data_(v_traits)
    {  this->set_default_constructed_state(); }
 
@@ -327,7 +328,7 @@ class slist_impl
    //! <b>Throws</b>: If value_traits::node_traits::node
    //!   constructor throws (this does not happen with predefined Boost.Intrusive hooks).
    template<class Iterator>
-   slist_impl(Iterator b, Iterator e, const value_traits &v_traits = value_traits())
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR slist_impl(Iterator b, Iterator e, const value_traits &v_traits = value_traits())
       :  data_(v_traits)
    {
       this->set_default_constructed_state();
@@ -344,7 +345,7 @@ class slist_impl
    //! <b>Throws</b>: If value_traits::node_traits::node's
    //!   move constructor throws (this does not happen with predefined Boost.Intrusive hooks)
    //!   or the move constructor of value traits throws.
-   slist_impl(BOOST_RV_REF(slist_impl) x)
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR slist_impl(BOOST_RV_REF(slist_impl) x)
       : data_(::boost::move(x.priv_value_traits()))
    {
       this->set_default_constructed_state();
@@ -354,7 +355,7 @@ class slist_impl
 
    //! <b>Effects</b>: Equivalent to swap
    //!
-   slist_impl& operator=(BOOST_RV_REF(slist_impl) x)
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR slist_impl& operator=(BOOST_RV_REF(slist_impl) x)
    {  this->swap(x); return *this;  }
 
    //! <b>Effects</b>: If it's a safe-mode
@@ -366,7 +367,7 @@ class slist_impl
    //!
    //! <b>Complexity</b>: Linear to the number of elements in the list, if
    //!   it's a safe-mode or auto-unlink value. Otherwise constant.
-   ~slist_impl()
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR ~slist_impl()
    #if defined(BOOST_INTRUSIVE_CONCEPTS_BASED_OVERLOADING)
       requires (ValueTraits::link_mode != normal_link)
    #endif
@@ -390,7 +391,7 @@ class slist_impl
    //!   if it's a safe-mode or auto-unlink value_type. Constant time otherwise.
    //!
    //! <b>Note</b>: Invalidates the iterators (but not the references) to the erased elements.
-   void clear() BOOST_NOEXCEPT
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR void clear() BOOST_NOEXCEPT
    {
       BOOST_IF_CONSTEXPR(safemode_or_autounlink){
          this->clear_and_dispose(detail::null_disposer());
@@ -411,7 +412,7 @@ class slist_impl
    //!
    //! <b>Note</b>: Invalidates the iterators to the erased elements.
    template <class Disposer>
-   void clear_and_dispose(Disposer disposer) BOOST_NOEXCEPT
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR void clear_and_dispose(Disposer disposer) BOOST_NOEXCEPT
    {
       node_algorithms::detach_and_dispose
          ( this->get_root_node()
@@ -420,6 +421,28 @@ class slist_impl
       this->set_default_constructed_state();
    }
 
+   //! <b>Requires</b>: Disposer::operator()(pointer) shouldn't throw.
+   //!
+   //! <b>Effects</b>: Erases up to max_nodes elements from the front of the list.
+   //!   Disposer::operator()(pointer) is called for the removed elements.
+   //!   The destruction of a big container can be split in several calls,
+   //!   each one doing bounded work. The list remains usable between calls.
+   //!
+   //! <b>Returns</b>: true if the container is empty after the call.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Linear to max_nodes.
+   //!
+   //! <b>Note</b>: Invalidates the iterators to the erased elements.
+   template <class Disposer>
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR bool clear_and_dispose_some(Disposer disposer, size_type max_nodes) BOOST_NOEXCEPT
+   {
+      for(; max_nodes && !this->empty(); --max_nodes)
+         this->pop_front_and_dispose(disposer);
+      return this->empty();
+   }
+
    //! <b>Requires</b>: value must be an lvalue.
    //!
    //! <b>Effects</b>: Inserts the value in the front of the list.
@@ -430,7 +453,7 @@ class slist_impl
    //! <b>Complexity</b>: Constant.
    //!
    //! <b>Note</b>: Does not affect the validity of iterators and references.
-   void push_front(reference value) BOOST_NOEXCEPT
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR void push_front(reference value) BOOST_NOEXCEPT
    {
       node_ptr to_insert = priv_value_traits().to_node_ptr(value);
       BOOST_INTRUSIVE_SAFE_HOOK_DEFAULT_ASSERT(!safemode_or_autounlink || node_algorithms::inited(to_insert));
@@ -454,7 +477,7 @@ class slist_impl
    //!
    //! <b>Note</b>: Does not affect the validity of iterators and references.
    //!   This function is only available is cache_last<> is true.
-   void push_back(reference value) BOOST_NOEXCEPT
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR void push_back(reference value) BOOST_NOEXCEPT
    {
       BOOST_INTRUSIVE_STATIC_ASSERT((cache_last));
       node_ptr n = priv_value_traits().to_node_ptr(value);
@@ -474,7 +497,7 @@ class slist_impl
    //! <b>Complexity</b>: Constant.
    //!
    //! <b>Note</b>: Invalidates the iterators (but not the references) to the erased element.
-   void pop_front() BOOST_NOEXCEPT
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR void pop_front() BOOST_NOEXCEPT
    {  return this->pop_front_and_dispose(detail::null_disposer());   }
 
    //! <b>Requires</b>: Disposer::operator()(pointer) shouldn't throw.
@@ -488,7 +511,7 @@ class slist_impl
    //!
    //! <b>Note</b>: Invalidates the iterators to the erased element.
    template<class Disposer>
-   void pop_front_and_dispose(Disposer disposer) BOOST_NOEXCEPT
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR void pop_front_and_dispose(Disposer disposer) BOOST_NOEXCEPT
    {
       node_ptr to_erase = node_traits::get_next(this->get_root_node());
       node_algorithms::unlink_after(this->get_root_node());
@@ -508,7 +531,7 @@ class slist_impl
    //! <b>Throws</b>: Nothing.
    //!
    //! <b>Complexity</b>: Constant.
-   inline reference front() BOOST_NOEXCEPT
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR reference front() BOOST_NOEXCEPT
    { return *this->priv_value_traits().to_value_ptr(node_traits::get_next(this->get_root_node())); }
 
    //! <b>Effects</b>: Returns a const_reference to the first element of the list.
@@ -516,7 +539,7 @@ class slist_impl
    //! <b>Throws</b>: Nothing.
    //!
    //! <b>Complexity</b>: Constant.
-   inline const_reference front() const BOOST_NOEXCEPT
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR const_reference front() const BOOST_NOEXCEPT
    { return *this->priv_value_traits().to_value_ptr(detail::uncast(node_traits::get_next(this->get_root_node()))); }
 
    //! <b>Effects</b>: Returns a reference to the last element of the list.
@@ -527,7 +550,7 @@ class slist_impl
    //!
    //! <b>Note</b>: Does not affect the validity of iterators and references.
    //!   This function is only available is cache_last<> is true.
-   reference back() BOOST_NOEXCEPT
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR reference back() BOOST_NOEXCEPT
    {
       BOOST_INTRUSIVE_STATIC_ASSERT((cache_last));
       return *this->priv_value_traits().to_value_ptr(this->get_last_node());
@@ -541,7 +564,7 @@ class slist_impl
    //!
    //! <b>Note</b>: Does not affect the validity of iterators and references.
    //!   This function is only available is cache_last<> is true.
-   inline const_reference back() const BOOST_NOEXCEPT
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR const_reference back() const BOOST_NOEXCEPT
    {
       BOOST_INTRUSIVE_STATIC_ASSERT((cache_last));
       return *this->priv_value_traits().to_value_ptr(this->get_last_node());
@@ -552,7 +575,7 @@ class slist_impl
    //! <b>Throws</b>: Nothing.
    //!
    //! <b>Complexity</b>: Constant.
-   inline iterator begin() BOOST_NOEXCEPT
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR iterator begin() BOOST_NOEXCEPT
    { return iterator (node_traits::get_next(this->get_root_node()), this->priv_value_traits_ptr()); }
 
    //! <b>Effects</b>: Returns a const_iterator to the first element contained in the list.
@@ -560,7 +583,7 @@ class slist_impl
    //! <b>Throws</b>: Nothing.
    //!
    //! <b>Complexity</b>: Constant.
-   inline const_iterator begin() const BOOST_NOEXCEPT
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR const_iterator begin() const BOOST_NOEXCEPT
    { return const_iterator (node_traits::get_next(this->get_root_node()), this->priv_value_traits_ptr()); }
 
    //! <b>Effects</b>: Returns a const_iterator to the first element contained in the list.
@@ -568,7 +591,7 @@ class slist_impl
    //! <b>Throws</b>: Nothing.
    //!
    //! <b>Complexity</b>: Constant.
-   inline const_iterator cbegin() const BOOST_NOEXCEPT
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR const_iterator cbegin() const BOOST_NOEXCEPT
    { return const_iterator(node_traits::get_next(this->get_root_node()), this->priv_value_traits_ptr()); }
 
    //! <b>Effects</b>: Returns an iterator to the end of the list.
@@ -576,7 +599,7 @@ class slist_impl
    //! <b>Throws</b>: Nothing.
    //!
    //! <b>Complexity</b>: Constant.
-   inline iterator end() BOOST_NOEXCEPT
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR iterator end() BOOST_NOEXCEPT
    { return iterator(this->get_end_node(), this->priv_value_traits_ptr()); }
 
    //! <b>Effects</b>: Returns a const_iterator to the end of the list.
@@ -584,7 +607,7 @@ class slist_impl
    //! <b>Throws</b>: Nothing.
    //!
    //! <b>Complexity</b>: Constant.
-   inline const_iterator end() const BOOST_NOEXCEPT
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR const_iterator end() const BOOST_NOEXCEPT
    { return const_iterator(detail::uncast(this->get_end_node()), this->priv_value_traits_ptr()); }
 
    //! <b>Effects</b>: Returns a const_iterator to the end of the list.
@@ -592,7 +615,7 @@ class slist_impl
    //! <b>Throws</b>: Nothing.
    //!
    //! <b>Complexity</b>: Constant.
-   inline const_iterator cend() const BOOST_NOEXCEPT
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR const_iterator cend() const BOOST_NOEXCEPT
    { return this->end(); }
 
    //! <b>Effects</b>: Returns an iterator that points to a position
@@ -601,7 +624,7 @@ class slist_impl
    //! <b>Throws</b>: Nothing.
    //!
    //! <b>Complexity</b>: Constant.
-   inline iterator before_begin() BOOST_NOEXCEPT
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR iterator before_begin() BOOST_NOEXCEPT
    { return iterator(this->get_root_node(), this->priv_value_traits_ptr()); }
 
    //! <b>Effects</b>: Returns an iterator that points to a position
@@ -610,7 +633,7 @@ class slist_impl
    //! <b>Throws</b>: Nothing.
    //!
    //! <b>Complexity</b>: Constant.
-   inline const_iterator before_begin() const BOOST_NOEXCEPT
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR const_iterator before_begin() const BOOST_NOEXCEPT
    { return const_iterator(detail::uncast(this->get_root_node()), this->priv_value_traits_ptr()); }
 
    //! <b>Effects</b>: Returns an iterator that points to a position
@@ -619,7 +642,7 @@ class slist_impl
    //! <b>Throws</b>: Nothing.
    //!
    //! <b>Complexity</b>: Constant.
-   inline const_iterator cbefore_begin() const BOOST_NOEXCEPT
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR const_iterator cbefore_begin() const BOOST_NOEXCEPT
    { return this->before_begin(); }
 
    //! <b>Effects</b>: Returns an iterator to the last element contained in the list.
@@ -629,7 +652,7 @@ class slist_impl
    //! <b>Complexity</b>: Constant.
    //!
    //! <b>Note</b>: This function is present only if cached_last<> option is true.
-   inline iterator last() BOOST_NOEXCEPT
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR iterator last() BOOST_NOEXCEPT
    {
       //This function shall not be used if cache_last is not true
       BOOST_INTRUSIVE_INVARIANT_ASSERT(cache_last);
@@ -643,7 +666,7 @@ class slist_impl
    //! <b>Complexity</b>: Constant.
    //!
    //! <b>Note</b>: This function is present only if cached_last<> option is true.
-   inline const_iterator last() const BOOST_NOEXCEPT
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR const_iterator last() const BOOST_NOEXCEPT
    {
       //This function shall not be used if cache_last is not true
       BOOST_INTRUSIVE_INVARIANT_ASSERT(cache_last);
@@ -657,7 +680,7 @@ class slist_impl
    //! <b>Complexity</b>: Constant.
    //!
    //! <b>Note</b>: This function is present only if cached_last<> option is true.
-   inline const_iterator clast() const BOOST_NOEXCEPT
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR const_iterator clast() const BOOST_NOEXCEPT
    { return const_iterator(this->get_last_node(), this->priv_value_traits_ptr()); }
 
    //! <b>Precondition</b>: end_iterator must be a valid end iterator
@@ -669,7 +692,7 @@ class slist_impl
    //!
    //! <b>Complexity</b>: Constant.
    BOOST_INTRUSIVE_NO_DANGLING
-   inline static slist_impl &container_from_end_iterator(iterator end_iterator) BOOST_NOEXCEPT
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR static slist_impl &container_from_end_iterator(iterator end_iterator) BOOST_NOEXCEPT
    {  return slist_impl::priv_container_from_end_iterator(end_iterator);   }
 
    //! <b>Precondition</b>: end_iterator must be a valid end const_iterator
@@ -681,7 +704,7 @@ class slist_impl
    //!
    //! <b>Complexity</b>: Constant.
    BOOST_INTRUSIVE_NO_DANGLING
-   inline static const slist_impl &container_from_end_iterator(const_iterator end_iterator) BOOST_NOEXCEPT
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR static const slist_impl &container_from_end_iterator(const_iterator end_iterator) BOOST_NOEXCEPT
    {  return slist_impl::priv_container_from_end_iterator(end_iterator);   }
 
    //! <b>Effects</b>: Returns the number of the elements contained in the list.
@@ -692,7 +715,7 @@ class slist_impl
    //!   if constant_time_size is false. Constant time otherwise.
    //!
    //! <b>Note</b>: Does not affect the validity of iterators and references.
-   inline size_type size() const BOOST_NOEXCEPT
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR size_type size() const BOOST_NOEXCEPT
    {
       BOOST_IF_CONSTEXPR(constant_time_size)
          return this->priv_size_traits().get_size();
@@ -707,7 +730,7 @@ class slist_impl
    //! <b>Complexity</b>: Constant.
    //!
    //! <b>Note</b>: Does not affect the validity of iterators and references.
-   inline bool empty() const BOOST_NOEXCEPT
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR bool empty() const BOOST_NOEXCEPT
    {  return node_algorithms::is_empty(this->get_root_node()); }
 
    //! <b>Effects</b>: Swaps the elements of x and *this.
@@ -718,7 +741,7 @@ class slist_impl
    //!  Constant-time if linear<> and/or cache_last<> options are used.
    //!
    //! <b>Note</b>: Does not affect the validity of iterators and references.
-   void swap(slist_impl& other)
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR void swap(slist_impl& other)
    {
       BOOST_IF_CONSTEXPR(cache_last){
          priv_swap_cache_last(this, &other);
@@ -738,7 +761,7 @@ class slist_impl
    //! <b>Complexity</b>: Linear to the number of elements plus the number shifts.
    //!
    //! <b>Note</b>: Iterators Does not affect the validity of iterators and references.
-   void shift_backwards(size_type n = 1) BOOST_NOEXCEPT
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR void shift_backwards(size_type n = 1) BOOST_NOEXCEPT
    {  this->priv_shift_backwards(n, detail::bool_<linear>());  }
 
    //! <b>Effects</b>: Moves forward all the elements, so that the second
@@ -750,7 +773,7 @@ class slist_impl
    //! <b>Complexity</b>: Linear to the number of elements plus the number shifts.
    //!
    //! <b>Note</b>: Does not affect the validity of iterators and references.
-   void shift_forward(size_type n = 1) BOOST_NOEXCEPT
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR void shift_forward(size_type n = 1) BOOST_NOEXCEPT
    {  this->priv_shift_forward(n, detail::bool_<linear>()); }
 
    //! <b>Requires</b>: Disposer::operator()(pointer) shouldn't throw.
@@ -768,7 +791,7 @@ class slist_impl
    //!
    //! <b>Throws</b>: If cloner throws.
    template <class Cloner, class Disposer>
-   void clone_from(const slist_impl &src, Cloner cloner, Disposer disposer)
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR void clone_from(const slist_impl &src, Cloner cloner, Disposer disposer)
    {
       this->clear_and_dispose(disposer);
       detail::exception_disposer<slist_impl, Disposer>
@@ -796,7 +819,7 @@ class slist_impl
    //!
    //! <b>Throws</b>: If cloner throws.
    template <class Cloner, class Disposer>
-   void clone_from(BOOST_RV_REF(slist_impl) src, Cloner cloner, Disposer disposer)
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR void clone_from(BOOST_RV_REF(slist_impl) src, Cloner cloner, Disposer disposer)
    {
       this->clear_and_dispose(disposer);
       detail::exception_disposer<slist_impl, Disposer>
@@ -822,7 +845,7 @@ class slist_impl
    //! <b>Complexity</b>: Constant.
    //!
    //! <b>Note</b>: Does not affect the validity of iterators and references.
-   iterator insert_after(const_iterator prev_p, reference value) BOOST_NOEXCEPT
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR iterator insert_after(const_iterator prev_p, reference value) BOOST_NOEXCEPT
    {
       node_ptr n = priv_value_traits().to_node_ptr(value);
       BOOST_INTRUSIVE_SAFE_HOOK_DEFAULT_ASSERT(!safemode_or_autounlink || node_algorithms::inited(n));
@@ -850,7 +873,7 @@ class slist_impl
    //!
    //! <b>Note</b>: Does not affect the validity of iterators and references.
    template<class Iterator>
-   void insert_after(const_iterator prev_p, Iterator f, Iterator l) BOOST_NOEXCEPT
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR void insert_after(const_iterator prev_p, Iterator f, Iterator l) BOOST_NOEXCEPT
    {
       //Insert first nodes avoiding cache and size checks
       size_type count = 0;
@@ -883,7 +906,7 @@ class slist_impl
    //!  Constant-time if cache_last<> is true and p == end().
    //!
    //! <b>Note</b>: Does not affect the validity of iterators and references.
-   iterator insert(const_iterator p, reference value) BOOST_NOEXCEPT
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR iterator insert(const_iterator p, reference value) BOOST_NOEXCEPT
    {  return this->insert_after(this->previous(p), value);  }
 
    //! <b>Requires</b>: Dereferencing iterator must yield
@@ -901,7 +924,7 @@ class slist_impl
    //!
    //! <b>Note</b>: Does not affect the validity of iterators and references.
    template<class Iterator>
-   void insert(const_iterator p, Iterator b, Iterator e) BOOST_NOEXCEPT
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR void insert(const_iterator p, Iterator b, Iterator e) BOOST_NOEXCEPT
    {  return this->insert_after(this->previous(p), b, e);  }
 
    //! <b>Effects</b>: Erases the element after the element pointed by prev of
@@ -916,7 +939,7 @@ class slist_impl
    //!
    //! <b>Note</b>: Invalidates the iterators (but not the references) to the
    //!   erased element.
-   iterator erase_after(const_iterator prev) BOOST_NOEXCEPT
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR iterator erase_after(const_iterator prev) BOOST_NOEXCEPT
    {  return this->erase_after_and_dispose(prev, detail::null_disposer());  }
 
    //! <b>Effects</b>: Erases the range (before_f, l) from
@@ -932,7 +955,7 @@ class slist_impl
    //!
    //! <b>Note</b>: Invalidates the iterators (but not the references) to the
    //!   erased element.
-   iterator erase_after(const_iterator before_f, const_iterator l) BOOST_NOEXCEPT
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR iterator erase_after(const_iterator before_f, const_iterator l) BOOST_NOEXCEPT
    {
       BOOST_IF_CONSTEXPR(safemode_or_autounlink || constant_time_size){
          return this->erase_after_and_dispose(before_f, l, detail::null_disposer());
@@ -964,7 +987,7 @@ class slist_impl
    //!
    //! <b>Note</b>: Invalidates the iterators (but not the references) to the
    //!   erased element.
-   iterator erase_after(const_iterator before_f, const_iterator l, size_type n) BOOST_NOEXCEPT
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR iterator erase_after(const_iterator before_f, const_iterator l, size_type n) BOOST_NOEXCEPT
    {
       BOOST_INTRUSIVE_INVARIANT_ASSERT(node_algorithms::distance((++const_iterator(before_f)).pointed_node(), l.pointed_node()) == n);
       (void)n;
@@ -999,7 +1022,7 @@ class slist_impl
    //!
    //! <b>Note</b>: Invalidates the iterators (but not the references) to the
    //!   erased element.
-   iterator erase(const_iterator i) BOOST_NOEXCEPT
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR iterator erase(const_iterator i) BOOST_NOEXCEPT
    {  return this->erase_after(this->previous(i));  }
 
    //! <b>Requires</b>: f and l must be valid iterator to elements in *this.
@@ -1016,7 +1039,7 @@ class slist_impl
    //!
    //! <b>Note</b>: Invalidates the iterators (but not the references) to the
    //!   erased elements.
-   iterator erase(const_iterator f, const_iterator l) BOOST_NOEXCEPT
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR iterator erase(const_iterator f, const_iterator l) BOOST_NOEXCEPT
    {  return this->erase_after(this->previous(f), l);  }
 
    //! <b>Effects</b>: Erases the range [f, l) from
@@ -1033,7 +1056,7 @@ class slist_impl
    //!
    //! <b>Note</b>: Invalidates the iterators (but not the references) to the
    //!   erased element.
-   iterator erase(const_iterator f, const_iterator l, size_type n) BOOST_NOEXCEPT
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR iterator erase(const_iterator f, const_iterator l, size_type n) BOOST_NOEXCEPT
    {  return this->erase_after(this->previous(f), l, n);  }
 
    //! <b>Requires</b>: Disposer::operator()(pointer) shouldn't throw.
@@ -1051,7 +1074,7 @@ class slist_impl
    //!
    //! <b>Note</b>: Invalidates the iterators to the erased element.
    template<class Disposer>
-   iterator erase_after_and_dispose(const_iterator prev, Disposer disposer) BOOST_NOEXCEPT
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR iterator erase_after_and_dispose(const_iterator prev, Disposer disposer) BOOST_NOEXCEPT
    {
       const_iterator it(prev);
       ++it;
@@ -1073,7 +1096,7 @@ class slist_impl
 
    /// @cond
 
-   static iterator s_insert_after(const_iterator const prev_p, reference value) BOOST_NOEXCEPT
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR static iterator s_insert_after(const_iterator const prev_p, reference value) BOOST_NOEXCEPT
    {
       BOOST_INTRUSIVE_STATIC_ASSERT(((!cache_last)&&(!constant_time_size)&&(!stateful_value_traits)));
       node_ptr const n = value_traits::to_node_ptr(value);
@@ -1083,7 +1106,7 @@ class slist_impl
    }
 
    template<class Disposer>
-   static iterator s_erase_after_and_dispose(const_iterator prev, Disposer disposer) BOOST_NOEXCEPT
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR static iterator s_erase_after_and_dispose(const_iterator prev, Disposer disposer) BOOST_NOEXCEPT
    {
       BOOST_INTRUSIVE_STATIC_ASSERT(((!cache_last)&&(!constant_time_size)&&(!stateful_value_traits)));
       const_iterator it(prev);
@@ -1099,7 +1122,7 @@ class slist_impl
    }
 
    template<class Disposer>
-   static iterator s_erase_after_and_dispose(const_iterator before_f, const_iterator l, Disposer disposer) BOOST_NOEXCEPT
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR static iterator s_erase_after_and_dispose(const_iterator before_f, const_iterator l, Disposer disposer) BOOST_NOEXCEPT
    {
       BOOST_INTRUSIVE_STATIC_ASSERT(((!cache_last)&&(!constant_time_size)&&(!stateful_value_traits)));
       node_ptr bfp(before_f.pointed_node()), lp(l.pointed_node());
@@ -1115,7 +1138,7 @@ class slist_impl
       return l.unconst();
    }
 
-   static iterator s_erase_after(const_iterator prev) BOOST_NOEXCEPT
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR static iterator s_erase_after(const_iterator prev) BOOST_NOEXCEPT
    {  return s_erase_after_and_dispose(prev, detail::null_disposer());  }
 
    /// @endcond
@@ -1135,7 +1158,7 @@ class slist_impl
    //!
    //! <b>Note</b>: Invalidates the iterators to the erased element.
    template<class Disposer>
-   iterator erase_after_and_dispose(const_iterator before_f, const_iterator l, Disposer disposer) BOOST_NOEXCEPT
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR iterator erase_after_and_dispose(const_iterator before_f, const_iterator l, Disposer disposer) BOOST_NOEXCEPT
    {
       node_ptr bfp(before_f.pointed_node()), lp(l.pointed_node());
       node_ptr fp(node_traits::get_next(bfp));
@@ -1172,12 +1195,12 @@ class slist_impl
    //! <b>Note</b>: Invalidates the iterators (but not the references) to the
    //!   erased element.
    template<class Disposer>
-   iterator erase_and_dispose(const_iterator i, Disposer disposer) BOOST_NOEXCEPT
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR iterator erase_and_dispose(const_iterator i, Disposer disposer) BOOST_NOEXCEPT
    {  return this->erase_after_and_dispose(this->previous(i), disposer);  }
 
    #if !defined(BOOST_INTRUSIVE_DOXYGEN_INVOKED)
    template<class Disposer>
-   iterator erase_and_dispose(iterator i, Disposer disposer) BOOST_NOEXCEPT
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR iterator erase_and_dispose(iterator i, Disposer disposer) BOOST_NOEXCEPT
    {  return this->erase_and_dispose(const_iterator(i), disposer);   }
    #endif
 
@@ -1199,7 +1222,7 @@ class slist_impl
    //! <b>Note</b>: Invalidates the iterators (but not the references) to the
    //!   erased elements.
    template<class Disposer>
-   iterator erase_and_dispose(const_iterator f, const_iterator l, Disposer disposer) BOOST_NOEXCEPT
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR iterator erase_and_dispose(const_iterator f, const_iterator l, Disposer disposer) BOOST_NOEXCEPT
    {  return this->erase_after_and_dispose(this->previous(f), l, disposer);  }
 
    //! <b>Requires</b>: Dereferencing iterator must yield
@@ -1218,7 +1241,7 @@ class slist_impl
    //! <b>Note</b>: Invalidates the iterators (but not the references)
    //!   to the erased elements.
    template<class Iterator>
-   void assign(Iterator b, Iterator e)
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR void assign(Iterator b, Iterator e)
    {
       this->clear();
       this->insert_after(this->cbefore_begin(), b, e);
@@ -1241,7 +1264,7 @@ class slist_impl
    //! <b>Note</b>: Invalidates the iterators (but not the references)
    //!   to the erased elements.
    template<class Iterator, class Disposer>
-   void dispose_and_assign(Disposer disposer, Iterator b, Iterator e)
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR void dispose_and_assign(Disposer disposer, Iterator b, Iterator e)
    {
       this->clear_and_dispose(disposer);
       this->insert_after(this->cbefore_begin(), b, e, disposer);
@@ -1268,7 +1291,7 @@ class slist_impl
    //!   assigned to the last spliced element or prev if x is empty.
    //!   This iterator can be used as new "prev" iterator for a new splice_after call.
    //!   that will splice new values after the previously spliced values.
-   void splice_after(const_iterator prev, slist_impl &x, const_iterator *l = 0) BOOST_NOEXCEPT
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR void splice_after(const_iterator prev, slist_impl &x, const_iterator *l = 0) BOOST_NOEXCEPT
    {
       if(x.empty()){
          if(l) *l = prev;
@@ -1307,7 +1330,7 @@ class slist_impl
    //!
    //! <b>Note</b>: Iterators of values obtained from list x now point to elements of this
    //! list. Iterators of this list and all the references are not invalidated.
-   void splice_after(const_iterator prev_pos, slist_impl &x, const_iterator prev_ele) BOOST_NOEXCEPT
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR void splice_after(const_iterator prev_pos, slist_impl &x, const_iterator prev_ele) BOOST_NOEXCEPT
    {
       const_iterator elem = prev_ele;
       this->splice_after(prev_pos, x, prev_ele, ++elem, 1);
@@ -1328,7 +1351,7 @@ class slist_impl
    //!
    //! <b>Note</b>: Iterators of values obtained from list x now point to elements of this
    //!   list. Iterators of this list and all the references are not invalidated.
-   void splice_after(const_iterator prev_pos, slist_impl &x, const_iterator before_f, const_iterator before_l) BOOST_NOEXCEPT
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR void splice_after(const_iterator prev_pos, slist_impl &x, const_iterator before_f, const_iterator before_l) BOOST_NOEXCEPT
    {
       BOOST_IF_CONSTEXPR(constant_time_size)
          this->splice_after(prev_pos, x, before_f, before_l, node_algorithms::distance(before_f.pointed_node(), before_l.pointed_node()));
@@ -1351,7 +1374,7 @@ class slist_impl
    //!
    //! <b>Note</b>: Iterators of values obtained from list x now point to elements of this
    //!   list. Iterators of this list and all the references are not invalidated.
-   void splice_after(const_iterator prev_pos, slist_impl &x, const_iterator before_f, const_iterator before_l, size_type n) BOOST_NOEXCEPT
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR void splice_after(const_iterator prev_pos, slist_impl &x, const_iterator before_f, const_iterator before_l, size_type n) BOOST_NOEXCEPT
    {
       BOOST_INTRUSIVE_INVARIANT_ASSERT(node_algorithms::distance(before_f.pointed_node(), before_l.pointed_node()) == n);
       (void)n;
@@ -1384,7 +1407,7 @@ class slist_impl
    //!   assigned to the last spliced element or prev if x is empty.
    //!   This iterator can be used as new "prev" iterator for a new splice_after call.
    //!   that will splice new values after the previously spliced values.
-   void splice(const_iterator it, slist_impl &x, const_iterator *l = 0) BOOST_NOEXCEPT
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR void splice(const_iterator it, slist_impl &x, const_iterator *l = 0) BOOST_NOEXCEPT
    {  this->splice_after(this->previous(it), x, l);   }
 
    //! <b>Requires</b>: it p must be a valid iterator of *this.
@@ -1401,7 +1424,7 @@ class slist_impl
    //!
    //! <b>Note</b>: Iterators of values obtained from list x now point to elements of this
    //! list. Iterators of this list and all the references are not invalidated.
-   void splice(const_iterator pos, slist_impl &x, const_iterator elem) BOOST_NOEXCEPT
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR void splice(const_iterator pos, slist_impl &x, const_iterator elem) BOOST_NOEXCEPT
    {  return this->splice_after(this->previous(pos), x, x.previous(elem));  }
 
    //! <b>Requires</b>: pos must be a dereferenceable iterator in *this
@@ -1421,7 +1444,7 @@ class slist_impl
    //!
    //! <b>Note</b>: Iterators of values obtained from list x now point to elements of this
    //!   list. Iterators of this list and all the references are not invalidated.
-   void splice(const_iterator pos, slist_impl &x, const_iterator f, const_iterator l) BOOST_NOEXCEPT
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR void splice(const_iterator pos, slist_impl &x, const_iterator f, const_iterator l) BOOST_NOEXCEPT
    {  return this->splice_after(this->previous(pos), x, x.previous(f), x.previous(l));  }
 
    //! <b>Requires</b>: pos must be a dereferenceable iterator in *this
@@ -1440,7 +1463,7 @@ class slist_impl
    //!
    //! <b>Note</b>: Iterators of values obtained from list x now point to elements of this
    //!   list. Iterators of this list and all the references are not invalidated.
-   void splice(const_iterator pos, slist_impl &x, const_iterator f, const_iterator l, size_type n) BOOST_NOEXCEPT
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR void splice(const_iterator pos, slist_impl &x, const_iterator f, const_iterator l, size_type n) BOOST_NOEXCEPT
    {  return this->splice_after(this->previous(pos), x, x.previous(f), x.previous(l), n);  }
 
    //! <b>Effects</b>: This function sorts the list *this according to operator<.
@@ -1455,50 +1478,58 @@ class slist_impl
    //!
    //! <b>Note</b>: Iterators and references are not invalidated
    template<class Predicate>
-   void sort(Predicate p)
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR void sort(Predicate p)
    {
-      if (node_traits::get_next(node_traits::get_next(this->get_root_node()))
-         != this->get_root_node()) {
-
-         slist_impl carry(this->priv_value_traits());
-         detail::array_initializer<slist_impl, 64> counter(this->priv_value_traits());
-         int fill = 0;
-         const_iterator last_inserted;
-         while(!this->empty()){
-            last_inserted = this->cbegin();
-            carry.splice_after(carry.cbefore_begin(), *this, this->cbefore_begin());
-            int i = 0;
-            while(i < fill && !counter[i].empty()) {
-               carry.swap(counter[i]);
-               carry.merge(counter[i++], p, &last_inserted);
-            }
-            BOOST_INTRUSIVE_INVARIANT_ASSERT(counter[i].empty());
-            const_iterator last_element(carry.previous(last_inserted, carry.end()));
+      //The array of temporary lists used by the bottom-up merge sort can't be
+      //built in constant evaluation, so a top-down merge sort is used instead
+      if(BOOST_INTRUSIVE_IS_CONSTANT_EVALUATED())
+         this->priv_top_down_sort(p, this->size());
+      else
+         this->priv_bottom_up_sort(p);
+   }
 
-            BOOST_IF_CONSTEXPR(constant_time_size){
-               counter[i].splice_after( counter[i].cbefore_begin(), carry
-                                    , carry.cbefore_begin(), last_element
-                                    , carry.size());
-            }
-            else{
-               counter[i].splice_after( counter[i].cbefore_begin(), carry
-                                    , carry.cbefore_begin(), last_element);
-            }
-            if(i == fill)
-               ++fill;
+   //! <b>Requires</b>: KeyOfValue::type must be the type of the keys returned by
+   //!   key_of_value(const value_type &) and keys must be comparable with operator<,
+   //!   which must induce a strict weak ordering.
+   //!
+   //! <b>Effects</b>: This function sorts the list *this according to the keys
+   //!   of the elements. The sort is stable, that is, the relative order of
+   //!   elements with equivalent keys is preserved.
+   //!
+   //!   Integral keys are sorted with a radix sort that relinks the elements in a chain
+   //!   per value of each byte, skipping the bytes that are equal in all keys.
+   //!   Other keys, or integral keys that form a few ordered runs, are sorted with a natural
+   //!   merge sort that merges the ordered runs found in the list. No memory is allocated.
+   //!
+   //! <b>Throws</b>: If key_of_value or operator< throws. Basic guarantee: all the elements
+   //!   remain in the list in an unspecified order.
+   //!
+   //! <b>Complexity</b>: For integral keys, linear to the number of elements times the number
+   //!   of bytes in which keys differ. Otherwise, the number of comparisons is approximately
+   //!   N log R, where N is the list's size and R the number of ordered runs.
+   //!
+   //! <b>Note</b>: Iterators and references are not invalidated.
+   template<class KeyOfValue>
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR void sort_by_key(KeyOfValue key_of_value)
+   {
+      const node_ptr root = this->get_root_node();
+      const node_ptr first = node_traits::get_next(root);
+      if(first != this->get_end_node() && node_traits::get_next(first) != this->get_end_node()){
+         node_ptr last;
+         BOOST_INTRUSIVE_TRY{
+            detail::key_sort_algorithms<node_traits, false>::sort
+               ( root, this->get_end_node()
+               , detail::key_nodeptr_less<KeyOfValue, value_traits>(key_of_value, this->priv_value_traits()), last);
          }
-
-         for (int i = 1; i < fill; ++i)
-            counter[i].merge(counter[i-1], p, &last_inserted);
-         --fill;
-         const_iterator last_element(counter[fill].previous(last_inserted, counter[fill].end()));
-         BOOST_IF_CONSTEXPR(constant_time_size){
-            this->splice_after( cbefore_begin(), counter[fill], counter[fill].cbefore_begin()
-                              , last_element, counter[fill].size());
+         BOOST_INTRUSIVE_CATCH(...){
+            BOOST_IF_CONSTEXPR(cache_last){
+               this->set_last_node(last);
+            }
+            BOOST_INTRUSIVE_RETHROW;
          }
-         else{
-            this->splice_after( cbefore_begin(), counter[fill], counter[fill].cbefore_begin()
-                              , last_element);
+         BOOST_INTRUSIVE_CATCH_END
+         BOOST_IF_CONSTEXPR(cache_last){
+            this->set_last_node(last);
          }
       }
    }
@@ -1519,7 +1550,7 @@ class slist_impl
    //!   size() + x.size() - 1 comparisons.
    //!
    //! <b>Note</b>: Iterators and references are not invalidated.
-   void sort()
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR void sort()
    { this->sort(value_less<value_type>()); }
 
    //! <b>Requires</b>: p must be a comparison function that induces a strict weak
@@ -1542,7 +1573,7 @@ class slist_impl
    //! <b>Additional note</b>: If optional "l" argument is passed, it is assigned
    //! to an iterator to the last transferred value or end() is x is empty.
    template<class Predicate>
-   void merge(slist_impl& x, Predicate p, const_iterator *l = 0)
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR void merge(slist_impl& x, Predicate p, const_iterator *l = 0)
    {
       const_iterator e(this->cend()), ex(x.cend()), bb(this->cbefore_begin()),
                      bb_next;
@@ -1579,7 +1610,7 @@ class slist_impl
    //!   size() + x.size() - 1 comparisons.
    //!
    //! <b>Note</b>: Iterators and references are not invalidated
-   void merge(slist_impl& x)
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR void merge(slist_impl& x)
    {  this->merge(x, value_less<value_type>());  }
 
    //! <b>Effects</b>: Reverses the order of elements in the list.
@@ -1589,7 +1620,7 @@ class slist_impl
    //! <b>Complexity</b>: This function is linear to the contained elements.
    //!
    //! <b>Note</b>: Iterators and references are not invalidated
-   void reverse() BOOST_NOEXCEPT
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR void reverse() BOOST_NOEXCEPT
    {
       BOOST_IF_CONSTEXPR(cache_last)
       if(!this->empty()){
@@ -1608,7 +1639,7 @@ class slist_impl
    //! <b>Note</b>: The relative order of elements that are not removed is unchanged,
    //!   and iterators to elements that are not removed remain valid. This function is
    //!   linear time: it performs exactly size() comparisons for equality.
-   size_type remove(const_reference value) BOOST_NOEXCEPT
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR size_type remove(const_reference value) BOOST_NOEXCEPT
    {  return this->remove_if(detail::equal_to_value<const_reference>(value));  }
 
    //! <b>Requires</b>: Disposer::operator()(pointer) shouldn't throw.
@@ -1623,7 +1654,7 @@ class slist_impl
    //! <b>Note</b>: The relative order of elements that are not removed is unchanged,
    //!   and iterators to elements that are not removed remain valid.
    template<class Disposer>
-   size_type remove_and_dispose(const_reference value, Disposer disposer) BOOST_NOEXCEPT
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR size_type remove_and_dispose(const_reference value, Disposer disposer) BOOST_NOEXCEPT
    {  return this->remove_and_dispose_if(detail::equal_to_value<const_reference>(value), disposer);  }
 
    //! <b>Effects</b>: Removes all the elements for which a specified
@@ -1636,7 +1667,7 @@ class slist_impl
    //! <b>Note</b>: The relative order of elements that are not removed is unchanged,
    //!   and iterators to elements that are not removed remain valid.
    template<class Pred>
-   size_type remove_if(Pred pred)
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR size_type remove_if(Pred pred)
    {
       const node_ptr bbeg = this->get_root_node();
       typename node_algorithms::stable_partition_info info;
@@ -1666,7 +1697,7 @@ class slist_impl
    //! <b>Note</b>: The relative order of elements that are not removed is unchanged,
    //!   and iterators to elements that are not removed remain valid.
    template<class Pred, class Disposer>
-   size_type remove_and_dispose_if(Pred pred, Disposer disposer)
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR size_type remove_and_dispose_if(Pred pred, Disposer disposer)
    {
       const node_ptr bbeg = this->get_root_node();
       typename node_algorithms::stable_partition_info info;
@@ -1694,7 +1725,7 @@ class slist_impl
    //!
    //! <b>Note</b>: The relative order of elements that are not removed is unchanged,
    //!   and iterators to elements that are not removed remain valid.
-   size_type unique()
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR size_type unique()
    {  return this->unique_and_dispose(value_equal<value_type>(), detail::null_disposer());  }
 
    //! <b>Effects</b>: Removes adjacent duplicate elements or adjacent
@@ -1710,7 +1741,7 @@ class slist_impl
    //! <b>Note</b>: The relative order of elements that are not removed is unchanged,
    //!   and iterators to elements that are not removed remain valid.
    template<class BinaryPredicate>
-   size_type unique(BinaryPredicate pred)
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR size_type unique(BinaryPredicate pred)
    {  return this->unique_and_dispose(pred, detail::null_disposer());  }
 
    //! <b>Requires</b>: Disposer::operator()(pointer) shouldn't throw.
@@ -1728,7 +1759,7 @@ class slist_impl
    //! <b>Note</b>: The relative order of elements that are not removed is unchanged,
    //!   and iterators to elements that are not removed remain valid.
    template<class Disposer>
-   size_type unique_and_dispose(Disposer disposer)
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR size_type unique_and_dispose(Disposer disposer)
    {  return this->unique_and_dispose(value_equal<value_type>(), disposer);  }
 
    //! <b>Requires</b>: Disposer::operator()(pointer) shouldn't throw.
@@ -1744,7 +1775,7 @@ class slist_impl
    //! <b>Note</b>: The relative order of elements that are not removed is unchanged,
    //!   and iterators to elements that are not removed remain valid.
    template<class BinaryPredicate, class Disposer>
-   size_type unique_and_dispose(BinaryPredicate pred, Disposer disposer)
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR size_type unique_and_dispose(BinaryPredicate pred, Disposer disposer)
    {
       const_iterator end_n(this->cend());
       const_iterator bcur(this->cbegin());
@@ -1781,7 +1812,7 @@ class slist_impl
    //! <b>Note</b>: Iterators and references are not invalidated.
    //!   This static function is available only if the <i>value traits</i>
    //!   is stateless.
-   static iterator s_iterator_to(reference value) BOOST_NOEXCEPT
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR static iterator s_iterator_to(reference value) BOOST_NOEXCEPT
    {
       BOOST_INTRUSIVE_STATIC_ASSERT((!stateful_value_traits));
       return iterator (value_traits::to_node_ptr(value), const_value_traits_ptr());
@@ -1798,7 +1829,7 @@ class slist_impl
    //! <b>Note</b>: Iterators and references are not invalidated.
    //!   This static function is available only if the <i>value traits</i>
    //!   is stateless.
-   static const_iterator s_iterator_to(const_reference value) BOOST_NOEXCEPT
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR static const_iterator s_iterator_to(const_reference value) BOOST_NOEXCEPT
    {
       BOOST_INTRUSIVE_STATIC_ASSERT((!stateful_value_traits));
       reference r =*detail::uncast(pointer_traits<const_pointer>::pointer_to(value));
@@ -1814,7 +1845,7 @@ class slist_impl
    //! <b>Complexity</b>: Constant time.
    //!
    //! <b>Note</b>: Iterators and references are not invalidated.
-   iterator iterator_to(reference value) BOOST_NOEXCEPT
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR iterator iterator_to(reference value) BOOST_NOEXCEPT
    {
       BOOST_INTRUSIVE_INVARIANT_ASSERT(linear || !node_algorithms::inited(this->priv_value_traits().to_node_ptr(value)));
       return iterator (this->priv_value_traits().to_node_ptr(value), this->priv_value_traits_ptr());
@@ -1829,7 +1860,7 @@ class slist_impl
    //! <b>Complexity</b>: Constant time.
    //!
    //! <b>Note</b>: Iterators and references are not invalidated.
-   const_iterator iterator_to(const_reference value) const BOOST_NOEXCEPT
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR const_iterator iterator_to(const_reference value) const BOOST_NOEXCEPT
    {
       reference r =*detail::uncast(pointer_traits<const_pointer>::pointer_to(value));
       BOOST_INTRUSIVE_INVARIANT_ASSERT (linear || !node_algorithms::inited(this->priv_value_traits().to_node_ptr(r)));
@@ -1844,7 +1875,7 @@ class slist_impl
    //!
    //! <b>Complexity</b>: Linear to the number of elements before i.
    //!   Constant if cache_last<> is true and i == end().
-   iterator previous(iterator i) BOOST_NOEXCEPT
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR iterator previous(iterator i) BOOST_NOEXCEPT
    {  return this->previous(this->cbefore_begin(), i); }
 
    //! <b>Returns</b>: The const_iterator to the element before i in the list.
@@ -1855,7 +1886,7 @@ class slist_impl
    //!
    //! <b>Complexity</b>: Linear to the number of elements before i.
    //!   Constant if cache_last<> is true and i == end().
-   const_iterator previous(const_iterator i) const BOOST_NOEXCEPT
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR const_iterator previous(const_iterator i) const BOOST_NOEXCEPT
    {  return this->previous(this->cbefore_begin(), i); }
 
    //! <b>Returns</b>: The iterator to the element before i in the list,
@@ -1867,7 +1898,7 @@ class slist_impl
    //!
    //! <b>Complexity</b>: Linear to the number of elements before i.
    //!   Constant if cache_last<> is true and i == end().
-   iterator previous(const_iterator prev_from, iterator i) BOOST_NOEXCEPT
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR iterator previous(const_iterator prev_from, iterator i) BOOST_NOEXCEPT
    {  return this->previous(prev_from, const_iterator(i)).unconst(); }
 
    //! <b>Returns</b>: The const_iterator to the element before i in the list,
@@ -1879,7 +1910,7 @@ class slist_impl
    //!
    //! <b>Complexity</b>: Linear to the number of elements before i.
    //!   Constant if cache_last<> is true and i == end().
-   const_iterator previous(const_iterator prev_from, const_iterator i) const BOOST_NOEXCEPT
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR const_iterator previous(const_iterator prev_from, const_iterator i) const BOOST_NOEXCEPT
    {
       if(cache_last && (i.pointed_node() == this->get_end_node())){
          return const_iterator(detail::uncast(this->get_last_node()), this->priv_value_traits_ptr());
@@ -1907,7 +1938,7 @@ class slist_impl
    //!   point to elements of this list. Iterators of this list and all the references are not invalidated.
    //!
    //! <b>Warning</b>: Experimental function, don't use it!
-   void incorporate_after(const_iterator prev_pos, node_ptr f, node_ptr before_l) BOOST_NOEXCEPT
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR void incorporate_after(const_iterator prev_pos, node_ptr f, node_ptr before_l) BOOST_NOEXCEPT
    {
       BOOST_IF_CONSTEXPR(constant_time_size)
          this->incorporate_after(prev_pos, f, before_l, node_algorithms::distance(f.pointed_node(), before_l.pointed_node())+1);
@@ -1931,7 +1962,7 @@ class slist_impl
    //!   point to elements of this list. Iterators of this list and all the references are not invalidated.
    //!
    //! <b>Warning</b>: Experimental function, don't use it!
-   void incorporate_after(const_iterator prev_pos, node_ptr f, node_ptr before_l, size_type n) BOOST_NOEXCEPT
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR void incorporate_after(const_iterator prev_pos, node_ptr f, node_ptr before_l, size_type n) BOOST_NOEXCEPT
    {
       if(n){
          BOOST_INTRUSIVE_INVARIANT_ASSERT(n > 0);
@@ -1955,12 +1986,12 @@ class slist_impl
    //!
    //! <b>Note</b>: The method has no effect when asserts are turned off (e.g., with NDEBUG).
    //!   Experimental function, interface might change in future versions.
-   void check() const
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR void check() const
    {
       const_node_ptr header_ptr = get_root_node();
-      // header's next is never null
-      BOOST_INTRUSIVE_INVARIANT_ASSERT(node_traits::get_next(header_ptr));
-      if (node_traits::get_next(header_ptr) == header_ptr)
+      // header's next is never null, unless the list is linear and empty
+      BOOST_INTRUSIVE_INVARIANT_ASSERT(linear || node_traits::get_next(header_ptr));
+      if (node_traits::get_next(header_ptr) == this->get_end_node())
       {
          BOOST_INTRUSIVE_INVARIANT_ASSERT(!constant_time_size || this->priv_size_traits().get_size() == 0);
          return;
@@ -1990,7 +2021,7 @@ class slist_impl
    }
 
 
-   friend bool operator==(const slist_impl &x, const slist_impl &y)
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR friend bool operator==(const slist_impl &x, const slist_impl &y)
    {
       BOOST_IF_CONSTEXPR(constant_time_size)
       if(x.size() != y.size()){
@@ -1999,26 +2030,96 @@ class slist_impl
       return ::boost::intrusive::algo_equal(x.cbegin(), x.cend(), y.cbegin(), y.cend());
    }
 
-   friend bool operator!=(const slist_impl &x, const slist_impl &y)
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR friend bool operator!=(const slist_impl &x, const slist_impl &y)
    {  return !(x == y); }
 
-   friend bool operator<(const slist_impl &x, const slist_impl &y)
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR friend bool operator<(const slist_impl &x, const slist_impl &y)
    {  return ::boost::intrusive::algo_lexicographical_compare(x.begin(), x.end(), y.begin(), y.end());  }
 
-   friend bool operator>(const slist_impl &x, const slist_impl &y)
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR friend bool operator>(const slist_impl &x, const slist_impl &y)
    {  return y < x;  }
 
-   friend bool operator<=(const slist_impl &x, const slist_impl &y)
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR friend bool operator<=(const slist_impl &x, const slist_impl &y)
    {  return !(y < x);  }
 
-   friend bool operator>=(const slist_impl &x, const slist_impl &y)
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR friend bool operator>=(const slist_impl &x, const slist_impl &y)
    {  return !(x < y);  }
 
-   friend void swap(slist_impl &x, slist_impl &y)
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR friend void swap(slist_impl &x, slist_impl &y)
    {  x.swap(y);  }
 
    private:
-   void priv_splice_after(node_ptr prev_pos_n, slist_impl &x, node_ptr before_f_n, node_ptr before_l_n)
+   template<class Predicate>
+   void priv_bottom_up_sort(Predicate &p)
+   {
+      if (node_traits::get_next(node_traits::get_next(this->get_root_node()))
+         != this->get_root_node()) {
+
+         slist_impl carry(this->priv_value_traits());
+         detail::array_initializer<slist_impl, 64> counter(this->priv_value_traits());
+         int fill = 0;
+         const_iterator last_inserted;
+         while(!this->empty()){
+            last_inserted = this->cbegin();
+            carry.splice_after(carry.cbefore_begin(), *this, this->cbefore_begin());
+            int i = 0;
+            while(i < fill && !counter[i].empty()) {
+               carry.swap(counter[i]);
+               carry.merge(counter[i++], p, &last_inserted);
+            }
+            BOOST_INTRUSIVE_INVARIANT_ASSERT(counter[i].empty());
+            const_iterator last_element(carry.previous(last_inserted, carry.end()));
+
+            BOOST_IF_CONSTEXPR(constant_time_size){
+               counter[i].splice_after( counter[i].cbefore_begin(), carry
+                                    , carry.cbefore_begin(), last_element
+                                    , carry.size());
+            }
+            else{
+               counter[i].splice_after( counter[i].cbefore_begin(), carry
+                                    , carry.cbefore_begin(), last_element);
+            }
+            if(i == fill)
+               ++fill;
+         }
+
+         for (int i = 1; i < fill; ++i)
+            counter[i].merge(counter[i-1], p, &last_inserted);
+         --fill;
+         const_iterator last_element(counter[fill].previous(last_inserted, counter[fill].end()));
+         BOOST_IF_CONSTEXPR(constant_time_size){
+            this->splice_after( cbefore_begin(), counter[fill], counter[fill].cbefore_begin()
+                              , last_element, counter[fill].size());
+         }
+         else{
+            this->splice_after( cbefore_begin(), counter[fill], counter[fill].cbefore_begin()
+                              , last_element);
+         }
+      }
+   }
+
+   //Splices the second half of the list to another list,
+   //sorts both halves recursively and merges them
+   template<class Predicate>
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR void priv_top_down_sort(Predicate &p, size_type n)
+   {
+      if(n > 1u){
+         const size_type half = n/2u;
+         const_iterator before_mid(this->cbefore_begin());
+         for(size_type i = 0; i != half; ++i)
+            ++before_mid;
+         const_iterator last(before_mid);
+         for(size_type i = half; i != n; ++i)
+            ++last;
+         slist_impl other(this->priv_value_traits());
+         other.splice_after(other.cbefore_begin(), *this, before_mid, last, n - half);
+         this->priv_top_down_sort(p, half);
+         other.priv_top_down_sort(p, n - half);
+         this->merge(other, p);
+      }
+   }
+
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR void priv_splice_after(node_ptr prev_pos_n, slist_impl &x, node_ptr before_f_n, node_ptr before_l_n)
    {
       BOOST_IF_CONSTEXPR(cache_last)
       if(before_f_n != before_l_n){
@@ -2032,7 +2133,7 @@ class slist_impl
       node_algorithms::transfer_after(prev_pos_n, before_f_n, before_l_n);
    }
 
-   void priv_incorporate_after(node_ptr prev_pos_n, node_ptr first_n, node_ptr before_l_n)
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR void priv_incorporate_after(node_ptr prev_pos_n, node_ptr first_n, node_ptr before_l_n)
    {
       BOOST_IF_CONSTEXPR(cache_last){
          if(prev_pos_n == this->get_last_node()){
@@ -2042,17 +2143,17 @@ class slist_impl
       node_algorithms::incorporate_after(prev_pos_n, first_n, before_l_n);
    }
 
-   void priv_reverse(detail::bool_<false>)
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR void priv_reverse(detail::bool_<false>)
    {  node_algorithms::reverse(this->get_root_node());   }
 
-   void priv_reverse(detail::bool_<true>)
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR void priv_reverse(detail::bool_<true>)
    {
       node_ptr new_first = node_algorithms::reverse
          (node_traits::get_next(this->get_root_node()));
       node_traits::set_next(this->get_root_node(), new_first);
    }
 
-   void priv_shift_backwards(size_type n, detail::bool_<false>)
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR void priv_shift_backwards(size_type n, detail::bool_<false>)
    {
       node_ptr l = node_algorithms::move_forward(this->get_root_node(), (std::size_t)n);
       (void)l;
@@ -2063,7 +2164,7 @@ class slist_impl
       }
    }
 
-   void priv_shift_backwards(size_type n, detail::bool_<true>)
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR void priv_shift_backwards(size_type n, detail::bool_<true>)
    {
       typename node_algorithms::node_pair ret(
          node_algorithms::move_first_n_forward
@@ -2076,7 +2177,7 @@ class slist_impl
       }
    }
 
-   void priv_shift_forward(size_type n, detail::bool_<false>)
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR void priv_shift_forward(size_type n, detail::bool_<false>)
    {
       node_ptr l = node_algorithms::move_backwards(this->get_root_node(), (std::size_t)n);
       (void)l;
@@ -2087,7 +2188,7 @@ class slist_impl
       }
    }
 
-   void priv_shift_forward(size_type n, detail::bool_<true>)
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR void priv_shift_forward(size_type n, detail::bool_<true>)
    {
       typename node_algorithms::node_pair ret(
          node_algorithms::move_first_n_backwards
@@ -2100,7 +2201,7 @@ class slist_impl
       }
    }
 
-   static void priv_swap_cache_last(slist_impl *this_impl, slist_impl *other_impl)
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR static void priv_swap_cache_last(slist_impl *this_impl, slist_impl *other_impl)
    {
       bool other_was_empty = false;
       if(this_impl->empty()){
@@ -2138,15 +2239,15 @@ class slist_impl
    }
 
    //circular version
-   static void priv_swap_lists(node_ptr this_node, node_ptr other_node, detail::bool_<false>)
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR static void priv_swap_lists(node_ptr this_node, node_ptr other_node, detail::bool_<false>)
    {  node_algorithms::swap_nodes(this_node, other_node); }
 
    //linear version
-   static void priv_swap_lists(node_ptr this_node, node_ptr other_node, detail::bool_<true>)
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR static void priv_swap_lists(node_ptr this_node, node_ptr other_node, detail::bool_<true>)
    {  node_algorithms::swap_trailing_nodes(this_node, other_node); }
 
    BOOST_INTRUSIVE_NO_DANGLING
-   static slist_impl &priv_container_from_end_iterator(const const_iterator &end_iterator)
+   BOOST_INTRUSIVE_CXX20_CONSTEXPR static slist_impl &priv_container_from_end_iterator(const const_iterator &end_iterator)
    {
       //Obtaining the container from the end iterator is not possible with linear
       //singly linked lists (because "end" is represented by the null pointer)
@@ -2233,47 +2334,47 @@ class slist
    typedef typename Base::size_type          size_type;
    typedef typename Base::node_ptr           node_ptr;
 
-   inline slist()
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR slist()
       :  Base()
    {}
 
-   inline explicit slist(const value_traits &v_traits)
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR explicit slist(const value_traits &v_traits)
       :  Base(v_traits)
    {}
 
    struct incorporate_t{};
 
-   inline slist( node_ptr f, node_ptr before_l
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR slist( node_ptr f, node_ptr before_l
              , size_type n, const value_traits &v_traits = value_traits())
       :  Base(f, before_l, n, v_traits)
    {}
 
    template<class Iterator>
-   inline slist(Iterator b, Iterator e, const value_traits &v_traits = value_traits())
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR slist(Iterator b, Iterator e, const value_traits &v_traits = value_traits())
       :  Base(b, e, v_traits)
    {}
 
-   inline slist(BOOST_RV_REF(slist) x)
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR slist(BOOST_RV_REF(slist) x)
       :  Base(BOOST_MOVE_BASE(Base, x))
    {}
 
-   inline slist& operator=(BOOST_RV_REF(slist) x)
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR slist& operator=(BOOST_RV_REF(slist) x)
    {  return static_cast<slist &>(this->Base::operator=(BOOST_MOVE_BASE(Base, x)));  }
 
    template <class Cloner, class Disposer>
-   inline void clone_from(const slist &src, Cloner cloner, Disposer disposer)
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR void clone_from(const slist &src, Cloner cloner, Disposer disposer)
    {  Base::clone_from(src, cloner, disposer);  }
 
    template <class Cloner, class Disposer>
-   inline void clone_from(BOOST_RV_REF(slist) src, Cloner cloner, Disposer disposer)
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR void clone_from(BOOST_RV_REF(slist) src, Cloner cloner, Disposer disposer)
    {  Base::clone_from(BOOST_MOVE_BASE(Base, src), cloner, disposer);  }
 
    BOOST_INTRUSIVE_NO_DANGLING
-   inline static slist &container_from_end_iterator(iterator end_iterator) BOOST_NOEXCEPT
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR static slist &container_from_end_iterator(iterator end_iterator) BOOST_NOEXCEPT
    {  return static_cast<slist &>(Base::container_from_end_iterator(end_iterator));   }
 
    BOOST_INTRUSIVE_NO_DANGLING
-   inline static const slist &container_from_end_iterator(const_iterator end_iterator) BOOST_NOEXCEPT
+   inline BOOST_INTRUSIVE_CXX20_CONSTEXPR static const slist &container_from_end_iterator(const_iterator end_iterator) BOOST_NOEXCEPT
    {  return static_cast<const slist &>(Base::container_from_end_iterator(end_iterator));   }
 };
 
@@ -38,9 +38,61 @@ namespace intrusive {
 
 /// @cond
 
+namespace detail {
+
+//Counts lookups to splay once every Period accesses
+template<std::size_t Period>
+struct splay_period_holder
+{
+   splay_period_holder()
+      : splay_accesses_()
+   {}
+
+   bool splay_access()
+   {
+      if(++splay_accesses_ < Period)
+         return false;
+      splay_accesses_ = 0;
+      return true;
+   }
+
+   private:
+   std::size_t splay_accesses_;
+};
+
+template<>
+struct splay_period_holder<0u>
+{
+   //Every access is splayed and no counter is stored
+   bool splay_access()
+   {  return true;  }
+};
+
+template<>
+struct splay_period_holder<1u>
+   : splay_period_holder<0u>
+{};
+
+template<bool SemiSplay, std::size_t Period, std::size_t DepthThreshold>
+struct splay_policy
+   : splay_period_holder<Period>
+{
+   static const bool semi_splay = SemiSplay;
+   static const std::size_t splay_period = Period;
+   static const std::size_t splay_depth_threshold = DepthThreshold;
+   //The default policy splays top-down on every lookup
+   static const bool top_down = !SemiSplay && Period <= 1u && !DepthThreshold;
+};
+
+}  //namespace detail {
+
 struct splaytree_defaults
    : bstree_defaults
-{};
+{
+   static const bool semi_splay = false;
+   static const std::size_t splay_period = 1u;
+   static const std::size_t splay_depth_threshold = 0u;
+};
 
 /// @endcond
 
@@ -55,16 +107,22 @@ struct splaytree_defaults
 //!
 //! The container supports the following options:
 //! \c base_hook<>/member_hook<>/value_traits<>,
-//! \c constant_time_size<>, \c size_type<> and
+//! \c constant_time_size<>, \c size_type<>,
+//! \c semi_splay<>, \c splay_period<>, \c splay_depth_threshold<> and
 //! \c compare<>.
+//!
+//! By default non-const lookups splay the found element top-down. The splay options
+//! reduce the writes performed by lookups: the accessed element is searched without
+//! modifying the tree and then splayed bottom-up only if the policy requires it.
 #if defined(BOOST_INTRUSIVE_DOXYGEN_INVOKED)
 template<class T, class ...Options>
 #else
-template<class ValueTraits, class VoidOrKeyOfValue, class VoidOrKeyComp, class SizeType, bool ConstantTimeSize, typename HeaderHolder>
+template<class ValueTraits, class VoidOrKeyOfValue, class VoidOrKeyComp, class SizeType, bool ConstantTimeSize, class SplayPolicy, typename HeaderHolder>
 #endif
 class splaytree_impl
    /// @cond
    :  public bstree_impl<ValueTraits, VoidOrKeyOfValue, VoidOrKeyComp, SizeType, ConstantTimeSize, SplayTreeAlgorithms, HeaderHolder>
+   ,  public SplayPolicy
    /// @endcond
 {
    public:
@@ -98,6 +156,9 @@ class splaytree_impl
    typedef typename implementation_defined::node_algorithms          node_algorithms;
 
    static const bool constant_time_size = implementation_defined::constant_time_size;
+   static const bool semi_splay = SplayPolicy::semi_splay;
+   static const std::size_t splay_period = SplayPolicy::splay_period;
+   static const std::size_t splay_depth_threshold = SplayPolicy::splay_depth_threshold;
    /// @cond
    private:
 
@@ -223,6 +284,10 @@ class splaytree_impl
    template <class Cloner, class Disposer>
    void clone_from(const splaytree_impl &src, Cloner cloner, Disposer disposer);
 
+   //! @copydoc ::boost::intrusive::bstree::clone_from(const bstree&,Cloner,Disposer,Executor)
+   template <class Cloner, class Disposer, class Executor>
+   void clone_from(const splaytree_impl &src, Cloner cloner, Disposer disposer, Executor executor);
+
    #else //BOOST_INTRUSIVE_DOXYGEN_INVOKED
 
    using tree_type::clone_from;
@@ -323,6 +388,18 @@ class splaytree_impl
    template<class Disposer>
    void clear_and_dispose(Disposer disposer) BOOST_NOEXCEPT;
 
+   //! @copydoc ::boost::intrusive::bstree::clear_and_dispose_some
+   template<class Disposer>
+   bool clear_and_dispose_some(Disposer disposer, size_type max_nodes) BOOST_NOEXCEPT;
+
+   //! @copydoc ::boost::intrusive::bstree::partition(size_type,OutputIterator)
+   template<class OutputIterator>
+   OutputIterator partition(size_type k, OutputIterator out);
+
+   //! @copydoc ::boost::intrusive::bstree::partition(size_type,OutputIterator)const
+   template<class OutputIterator>
+   OutputIterator partition(size_type k, OutputIterator out) const;
+
    //! @copydoc ::boost::intrusive::bstree::count(const key_type &)const
    //! Additional note: non-const function, splaying is performed.
    size_type count(const key_type &key);
@@ -360,6 +437,20 @@ class splaytree_impl
    template<class KeyType, class KeyTypeKeyCompare>
    const_iterator lower_bound(const KeyType &key, KeyTypeKeyCompare comp) const;
 
+   //! @copydoc ::boost::intrusive::bstree::lower_bound_from(const_iterator,const key_type &)
+   iterator lower_bound_from(const_iterator finger, const key_type &key);
+
+   //! @copydoc ::boost::intrusive::bstree::lower_bound_from(const_iterator,const key_type &)const
+   const_iterator lower_bound_from(const_iterator finger, const key_type &key) const;
+
+   //! @copydoc ::boost::intrusive::bstree::lower_bound_from(const_iterator,const KeyType&,KeyTypeKeyCompare)
+   template<class KeyType, class KeyTypeKeyCompare>
+   iterator lower_bound_from(const_iterator finger, const KeyType &key, KeyTypeKeyCompare comp);
+
+   //! @copydoc ::boost::intrusive::bstree::lower_bound_from(const_iterator,const KeyType&,KeyTypeKeyCompare)const
+   template<class KeyType, class KeyTypeKeyCompare>
+   const_iterator lower_bound_from(const_iterator finger, const KeyType &key, KeyTypeKeyCompare comp) const;
+
    //! @copydoc ::boost::intrusive::bstree::upper_bound(const key_type &)
    //! Additional note: non-const function, splaying is performed for the first
    //! element of the equal range of "value"
@@ -459,6 +550,22 @@ class splaytree_impl
    //! @copydoc ::boost::intrusive::bstree::replace_node
    void replace_node(iterator replace_this, reference with_this) BOOST_NOEXCEPT;
 
+   //! @copydoc ::boost::intrusive::bstree::relocate(Relocator,Disposer)
+   template <class Relocator, class Disposer>
+   void relocate(Relocator relocator, Disposer disposer);
+
+   //! @copydoc ::boost::intrusive::bstree::relocate(Relocator)
+   template <class Relocator>
+   void relocate(Relocator relocator);
+
+   //! @copydoc ::boost::intrusive::bstree::erase_if(Pred)
+   template<class Pred>
+   size_type erase_if(Pred pred);
+
+   //! @copydoc ::boost::intrusive::bstree::erase_and_dispose_if(Pred,Disposer)
+   template<class Pred, class Disposer>
+   size_type erase_and_dispose_if(Pred pred, Disposer disposer);
+
    //! @copydoc ::boost::intrusive::bstree::remove_node
    void remove_node(reference value) BOOST_NOEXCEPT;
 
@@ -470,8 +577,147 @@ class splaytree_impl
    template<class T, class ...Options2>
    void merge_equal(splaytree<T, Options2...> &);
 
+   #else //#ifdef BOOST_INTRUSIVE_DOXYGEN_INVOKED
+
+   //Non-const lookups apply the splay policy
+   using tree_type::count;
+   using tree_type::lower_bound;
+   using tree_type::upper_bound;
+   using tree_type::find;
+   using tree_type::equal_range;
+   using tree_type::lower_bound_range;
+   using tree_type::bounded_range;
+
+   size_type count(const key_type &key)
+   {  return this->count(key, this->key_comp());   }
+
+   template<class KeyType, class KeyTypeKeyCompare>
+   size_type count(const KeyType &key, KeyTypeKeyCompare comp)
+   {
+      std::pair<iterator, iterator> ret = this->equal_range(key, comp);
+      size_type n = 0;
+      for(; ret.first != ret.second; ++ret.first){ ++n; }
+      return n;
+   }
+
+   iterator lower_bound(const key_type &key)
+   {  return this->lower_bound(key, this->key_comp());   }
+
+   template<class KeyType, class KeyTypeKeyCompare>
+   iterator lower_bound(const KeyType &key, KeyTypeKeyCompare comp)
+   {
+      BOOST_IF_CONSTEXPR(SplayPolicy::top_down){
+         return tree_type::lower_bound(key, comp);
+      }
+      else{
+         return this->priv_access(this->priv_ctree().lower_bound(key, comp));
+      }
+   }
+
+   iterator upper_bound(const key_type &key)
+   {  return this->upper_bound(key, this->key_comp());   }
+
+   template<class KeyType, class KeyTypeKeyCompare>
+   iterator upper_bound(const KeyType &key, KeyTypeKeyCompare comp)
+   {
+      BOOST_IF_CONSTEXPR(SplayPolicy::top_down){
+         return tree_type::upper_bound(key, comp);
+      }
+      else{
+         return this->priv_access(this->priv_ctree().upper_bound(key, comp));
+      }
+   }
+
+   iterator find(const key_type &key)
+   {  return this->find(key, this->key_comp());   }
+
+   template<class KeyType, class KeyTypeKeyCompare>
+   iterator find(const KeyType &key, KeyTypeKeyCompare comp)
+   {
+      BOOST_IF_CONSTEXPR(SplayPolicy::top_down){
+         return tree_type::find(key, comp);
+      }
+      else{
+         return this->priv_access(this->priv_ctree().find(key, comp));
+      }
+   }
+
+   std::pair<iterator,iterator> equal_range(const key_type &key)
+   {  return this->equal_range(key, this->key_comp());   }
+
+   template<class KeyType, class KeyTypeKeyCompare>
+   std::pair<iterator,iterator> equal_range(const KeyType &key, KeyTypeKeyCompare comp)
+   {
+      BOOST_IF_CONSTEXPR(SplayPolicy::top_down){
+         return tree_type::equal_range(key, comp);
+      }
+      else{
+         return this->priv_access(this->priv_ctree().equal_range(key, comp));
+      }
+   }
+
+   std::pair<iterator,iterator> lower_bound_range(const key_type &key)
+   {  return this->lower_bound_range(key, this->key_comp());   }
+
+   template<class KeyType, class KeyTypeKeyCompare>
+   std::pair<iterator,iterator> lower_bound_range(const KeyType &key, KeyTypeKeyCompare comp)
+   {
+      BOOST_IF_CONSTEXPR(SplayPolicy::top_down){
+         return tree_type::lower_bound_range(key, comp);
+      }
+      else{
+         return this->priv_access(this->priv_ctree().lower_bound_range(key, comp));
+      }
+   }
+
+   std::pair<iterator,iterator> bounded_range
+      (const key_type &lower_key, const key_type &upper_key, bool left_closed, bool right_closed)
+   {  return this->bounded_range(lower_key, upper_key, this->key_comp(), left_closed, right_closed);   }
+
+   template<class KeyType, class KeyTypeKeyCompare>
+   std::pair<iterator,iterator> bounded_range
+      (const KeyType &lower_key, const KeyType &upper_key, KeyTypeKeyCompare comp, bool left_closed, bool right_closed)
+   {
+      BOOST_IF_CONSTEXPR(SplayPolicy::top_down){
+         return tree_type::bounded_range(lower_key, upper_key, comp, left_closed, right_closed);
+      }
+      else{
+         return this->priv_access
+            (this->priv_ctree().bounded_range(lower_key, upper_key, comp, left_closed, right_closed));
+      }
+   }
+
    #endif   //#ifdef BOOST_INTRUSIVE_DOXYGEN_INVOKED
 
+   //! <b>Effects</b>: Finds an iterator to the first element whose key is
+   //!   equivalent to key or end() if that element does not exist.
+   //!
+   //! <b>Complexity</b>: Logarithmic.
+   //!
+   //! <b>Throws</b>: If `key_compare` throws.
+   //!
+   //! <b>Note</b>: Unlike find, the tree is not modified, so several threads can call
+   //!   find_no_splay concurrently as long as no other function modifies the container.
+   iterator find_no_splay(const key_type &key)
+   {  return this->find_no_splay(key, this->key_comp());   }
+
+   //! <b>Requires</b>: key is a value such that `*this` is partitioned with respect to
+   //!   comp(nk, key) and !comp(key, nk), with comp(nk, key) implying !comp(key, nk),
+   //!   and nk the key_type of a value_type inserted into `*this`.
+   //!
+   //! <b>Effects</b>: Finds an iterator to the first element whose key is
+   //!   equivalent to key or end() if that element does not exist.
+   //!
+   //! <b>Complexity</b>: Logarithmic.
+   //!
+   //! <b>Throws</b>: If `comp` throws.
+   //!
+   //! <b>Note</b>: Unlike find, the tree is not modified, so several threads can call
+   //!   find_no_splay concurrently as long as no other function modifies the container.
+   template<class KeyType, class KeyTypeKeyCompare>
+   iterator find_no_splay(const KeyType &key, KeyTypeKeyCompare comp)
+   {  return this->priv_ctree().find(key, comp).unconst();   }
+
    //! <b>Requires</b>: i must be a valid iterator of *this.
    //!
    //! <b>Effects</b>: Rearranges the container so that the element pointed by i
@@ -536,6 +782,36 @@ class splaytree_impl
    friend void swap(splaytree_impl &x, splaytree_impl &y);
 
    #endif   //#ifdef BOOST_INTRUSIVE_DOXYGEN_INVOKED
+
+   /// @cond
+   private:
+
+   const tree_type &priv_ctree() const
+   {  return *this;  }
+
+   //Splays the accessed element bottom-up if the policy requires it. The element
+   //was found without modifying the tree, so skipped accesses perform no writes
+   //except the access counter of splay_period.
+   iterator priv_access(const_iterator it)
+   {
+      const node_ptr n(it.pointed_node());
+      const node_ptr header(tree_type::header_ptr());
+      if( n != header
+         && (!splay_depth_threshold || node_algorithms::depth(n) > splay_depth_threshold)
+         && this->SplayPolicy::splay_access() ){
+         BOOST_IF_CONSTEXPR(semi_splay){
+            node_algorithms::semi_splay_up(n, header);
+         }
+         else{
+            node_algorithms::splay_up(n, header);
+         }
+      }
+      return it.unconst();
+   }
+
+   std::pair<iterator, iterator> priv_access(const std::pair<const_iterator, const_iterator> &r)
+   {  return std::pair<iterator, iterator>(this->priv_access(r.first), r.second.unconst());  }
+   /// @endcond
 };
 
 //! Helper metafunction to define a \c splaytree that yields to the same type when the
@@ -568,7 +844,13 @@ struct make_splaytree
          , typename packed_options::compare
          , typename packed_options::size_type
          , packed_options::constant_time_size
-         , typename packed_options::header_holder_type
+         , detail::splay_policy
+            < packed_options::semi_splay
+            , packed_options::splay_period
+            , packed_options::splay_depth_threshold>
+         , typename detail::get_epoch_header_holder
+            < packed_options::modification_epoch
+            , typename packed_options::header_holder_type>::type
          > implementation_defined;
    /// @endcond
    typedef implementation_defined type;
@@ -642,6 +924,10 @@ class splaytree
    inline void clone_from(BOOST_RV_REF(splaytree) src, Cloner cloner, Disposer disposer)
    {  Base::clone_from(BOOST_MOVE_BASE(Base, src), cloner, disposer);  }
 
+   template <class Cloner, class Disposer, class Executor>
+   inline void clone_from(const splaytree &src, Cloner cloner, Disposer disposer, Executor executor)
+   {  Base::clone_from(src, cloner, disposer, executor);  }
+
    BOOST_INTRUSIVE_NO_DANGLING
    inline static splaytree &container_from_end_iterator(iterator end_iterator) BOOST_NOEXCEPT
    {  return static_cast<splaytree &>(Base::container_from_end_iterator(end_iterator));   }
@@ -284,6 +284,12 @@ class splaytree_algorithms
    static void clone
       (const_node_ptr source_header, node_ptr target_header, Cloner cloner, Disposer disposer);
 
+   //! @copydoc ::boost::intrusive::bstree_algorithms::clone(const_node_ptr,node_ptr,Cloner,Disposer,Executor,std::size_t)
+   template <class Cloner, class Disposer, class Executor>
+   static void clone
+      ( const_node_ptr source_header, node_ptr target_header, Cloner cloner, Disposer disposer
+      , Executor executor, std::size_t fork_levels);
+
    //! @copydoc ::boost::intrusive::bstree_algorithms::clear_and_dispose(node_ptr,Disposer)
    template<class Disposer>
    static void clear_and_dispose(node_ptr header, Disposer disposer) BOOST_NOEXCEPT;
@@ -524,6 +530,47 @@ class splaytree_algorithms
    static void splay_up(node_ptr n, node_ptr header) BOOST_NOEXCEPT
    {  priv_splay_up<true>(n, header); }
 
+   //! <b>Requires</b>: n must be a node of the tree whose header is "header".
+   //!
+   //! <b>Effects</b>: Semi-splays n: each zig-zig step rotates the parent of the current
+   //!   node and continues from that parent, so n climbs about half of its depth
+   //!   and the access path is shortened with fewer rotations than a full splay.
+   //!   If n is the header, the rightmost node is semi-splayed.
+   //!
+   //! <b>Complexity</b>: Amortized logarithmic.
+   //!
+   //! <b>Throws</b>: Nothing.
+   static void semi_splay_up(node_ptr n, node_ptr header) BOOST_NOEXCEPT
+   {
+      if(n == header)
+         n = NodeTraits::get_right(header);
+      if(n == header)
+         return;
+
+      for( ;; ){
+         node_ptr const p(NodeTraits::get_parent(n));
+         if(p == header)
+            break;
+         node_ptr const g(NodeTraits::get_parent(p));
+         if(g == header){
+            // zig
+            rotate(n);
+            break;
+         }
+         else if ((NodeTraits::get_left(p) == n && NodeTraits::get_left(g) == p)    ||
+                  (NodeTraits::get_right(p) == n && NodeTraits::get_right(g) == p)  ){
+            // zig-zig: only the parent climbs, continue from it
+            rotate(p);
+            n = p;
+         }
+         else {
+            // zig-zag
+            rotate(n);
+            rotate(n);
+         }
+      }
+   }
+
    // top-down splay | complexity : logarithmic    | exception : strong, note A
    template<class KeyType, class KeyNodePtrCompare>
    static node_ptr splay_down(node_ptr header, const KeyType &key, KeyNodePtrCompare comp, bool *pfound = 0)
@@ -0,0 +1,896 @@
+/////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright agent 2026.
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/intrusive for documentation.
+//
+/////////////////////////////////////////////////////////////////////////////
+//
+// The insertion and erasure algorithms are based on the threaded red-black
+// tree ("trb") algorithms from Ben Pfaff's GNU libavl, adapted to work with
+// a header node and generic node traits.
+
+#ifndef BOOST_INTRUSIVE_THREADED_RBTREE_ALGORITHMS_HPP
+#define BOOST_INTRUSIVE_THREADED_RBTREE_ALGORITHMS_HPP
+
+#include <boost/intrusive/detail/config_begin.hpp>
+#include <boost/intrusive/intrusive_fwd.hpp>
+
+#include <cstddef>
+#include <climits>
+
+#include <boost/intrusive/detail/assert.hpp>
+#include <boost/intrusive/detail/algo_type.hpp>
+#include <boost/intrusive/detail/minimal_pair_header.hpp>
+#include <boost/intrusive/pointer_traits.hpp>
+
+#if defined(BOOST_HAS_PRAGMA_ONCE)
+#  pragma once
+#endif
+
+namespace boost {
+namespace intrusive {
+
+//! threaded_rbtree_algorithms provides basic algorithms to manipulate
+//! nodes forming a red-black tree whose nodes store only two links.
+//!
+//! There are no parent links: a link that does not point to a child points to
+//! the in-order predecessor (left link) or successor (right link) of the node.
+//! Such a link is called a "thread" and a flag per link distinguishes threads from
+//! child links. Threads make in-order traversal possible without parent links or
+//! explicit stacks, so iterators are plain node pointers and remain valid as long
+//! as the pointed node is not erased.
+//!
+//! Insertion and erasure record the path from the root in a small local stack
+//! (bounded by the maximum height of a red-black tree) and rebalance bottom-up
+//! walking that stack. Erasure locates the path using the ordering predicate, so
+//! keys must be unique and erase functions take the node comparison function.
+//!
+//! The header node's left link points to the root (or is a thread to the header if
+//! the tree is empty). The leftmost node's left thread and the rightmost node's
+//! right thread point to the header. The header's right link is a thread to itself.
+//!
+//! threaded_rbtree_algorithms is configured with a NodeTraits class, which encapsulates the
+//! information about the node to be manipulated. NodeTraits must support the
+//! following interface:
+//!
+//! <b>Typedefs</b>:
+//!
+//! <tt>node</tt>: The type of the node that forms the binary search tree
+//!
+//! <tt>node_ptr</tt>: A pointer to a node
+//!
+//! <tt>const_node_ptr</tt>: A pointer to a const node
+//!
+//! <tt>color</tt>: The type that can store the color of a node
+//!
+//! <b>Static functions</b>:
+//!
+//! <tt>static node_ptr get_left(const_node_ptr n);</tt>
+//!
+//! <tt>static void set_left(node_ptr n, node_ptr left);</tt>
+//!
+//! <tt>static node_ptr get_right(const_node_ptr n);</tt>
+//!
+//! <tt>static void set_right(node_ptr n, node_ptr right);</tt>
+//!
+//! <tt>static bool get_left_thread(const_node_ptr n);</tt>
+//!
+//! <tt>static void set_left_thread(node_ptr n, bool is_thread);</tt>
+//!
+//! <tt>static bool get_right_thread(const_node_ptr n);</tt>
+//!
+//! <tt>static void set_right_thread(node_ptr n, bool is_thread);</tt>
+//!
+//! <tt>static color get_color(const_node_ptr n);</tt>
+//!
+//! <tt>static void set_color(node_ptr n, color c);</tt>
+//!
+//! <tt>static color black();</tt>
+//!
+//! <tt>static color red();</tt>
+template<class NodeTraits>
+class threaded_rbtree_algorithms
+{
+   public:
+   typedef NodeTraits                           node_traits;
+   typedef typename NodeTraits::node            node;
+   typedef typename NodeTraits::node_ptr        node_ptr;
+   typedef typename NodeTraits::const_node_ptr  const_node_ptr;
+   typedef typename NodeTraits::color           color;
+
+   /// @cond
+   private:
+
+   //A red-black tree of n nodes has height <= 2*log2(n+1). Add the header
+   //and the node found when searching for a successor.
+   static const std::size_t max_path_length = 2u*sizeof(std::size_t)*CHAR_BIT + 2u;
+
+   struct path_t
+   {
+      node_ptr node[max_path_length];
+      bool     dir [max_path_length];
+   };
+
+   inline static node_ptr uncast(const_node_ptr ptr) BOOST_NOEXCEPT
+   {  return pointer_traits<node_ptr>::const_cast_from(ptr);  }
+
+   //dir == false -> left, dir == true -> right
+   inline static node_ptr get_link(const_node_ptr n, bool dir) BOOST_NOEXCEPT
+   {  return dir ? NodeTraits::get_right(n) : NodeTraits::get_left(n);  }
+
+   inline static void set_link(node_ptr n, bool dir, node_ptr l) BOOST_NOEXCEPT
+   {
+      if(dir) NodeTraits::set_right(n, l);
+      else    NodeTraits::set_left(n, l);
+   }
+
+   inline static bool is_thread(const_node_ptr n, bool dir) BOOST_NOEXCEPT
+   {  return dir ? NodeTraits::get_right_thread(n) : NodeTraits::get_left_thread(n);  }
+
+   inline static void set_thread(node_ptr n, bool dir, bool t) BOOST_NOEXCEPT
+   {
+      if(dir) NodeTraits::set_right_thread(n, t);
+      else    NodeTraits::set_left_thread(n, t);
+   }
+
+   inline static bool is_red_child(const_node_ptr n, bool dir) BOOST_NOEXCEPT
+   {  return !is_thread(n, dir) && NodeTraits::get_color(get_link(n, dir)) == NodeTraits::red();  }
+
+   template<class Disposer>
+   struct dispose_subtree_disposer
+   {
+      inline dispose_subtree_disposer(Disposer &disp, node_ptr header)
+         : disposer_(&disp), header_(header)
+      {}
+
+      inline void release()
+      {  disposer_ = 0;  }
+
+      inline ~dispose_subtree_disposer()
+      {
+         if(disposer_){
+            node_ptr const r = get_root(header_);
+            if(r)
+               dispose_subtree(r, *disposer_);
+            init_header(header_);
+         }
+      }
+      Disposer *disposer_;
+      const node_ptr header_;
+   };
+
+   /// @endcond
+
+   public:
+   //! <b>Requires</b>: 'header' is the header node of a tree.
+   //!
+   //! <b>Effects</b>: Returns the root of the tree or a null pointer if the tree is empty.
+   //!
+   //! <b>Complexity</b>: Constant time.
+   //!
+   //! <b>Throws</b>: Nothing.
+   inline static node_ptr get_root(const_node_ptr header) BOOST_NOEXCEPT
+   {  return NodeTraits::get_left_thread(header) ? node_ptr() : NodeTraits::get_left(header);  }
+
+   //! <b>Requires</b>: 'header' is the header node of a tree.
+   //!
+   //! <b>Effects</b>: Returns the first node of the tree, the header if the tree is empty.
+   //!
+   //! <b>Complexity</b>: Logarithmic time.
+   //!
+   //! <b>Throws</b>: Nothing.
+   inline static node_ptr begin_node(const_node_ptr header) BOOST_NOEXCEPT
+   {  return NodeTraits::get_left_thread(header) ? uncast(header) : minimum(NodeTraits::get_left(header));  }
+
+   //! <b>Requires</b>: 'header' is the header node of a tree.
+   //!
+   //! <b>Effects</b>: Returns the header of the tree.
+   //!
+   //! <b>Complexity</b>: Constant time.
+   //!
+   //! <b>Throws</b>: Nothing.
+   inline static node_ptr end_node(const_node_ptr header) BOOST_NOEXCEPT
+   {  return uncast(header);  }
+
+   //! <b>Requires</b>: 'n' is a node of a tree but not the header.
+   //!
+   //! <b>Effects</b>: Returns the minimum node of the subtree starting at n.
+   //!
+   //! <b>Complexity</b>: Logarithmic to the size of the subtree.
+   //!
+   //! <b>Throws</b>: Nothing.
+   static node_ptr minimum(node_ptr n) BOOST_NOEXCEPT
+   {
+      while(!NodeTraits::get_left_thread(n)){
+         n = NodeTraits::get_left(n);
+      }
+      return n;
+   }
+
+   //! <b>Requires</b>: 'n' is a node of a tree but not the header.
+   //!
+   //! <b>Effects</b>: Returns the maximum node of the subtree starting at n.
+   //!
+   //! <b>Complexity</b>: Logarithmic to the size of the subtree.
+   //!
+   //! <b>Throws</b>: Nothing.
+   static node_ptr maximum(node_ptr n) BOOST_NOEXCEPT
+   {
+      while(!NodeTraits::get_right_thread(n)){
+         n = NodeTraits::get_right(n);
+      }
+      return n;
+   }
+
+   //! <b>Requires</b>: 'n' is a node from the tree except the header.
+   //!
+   //! <b>Effects</b>: Returns the next node of the tree.
+   //!
+   //! <b>Complexity</b>: Amortized constant time.
+   //!
+   //! <b>Throws</b>: Nothing.
+   static node_ptr next_node(node_ptr n) BOOST_NOEXCEPT
+   {
+      const bool thread = NodeTraits::get_right_thread(n);
+      n = NodeTraits::get_right(n);
+      return thread ? n : minimum(n);
+   }
+
+   //! <b>Requires</b>: 'n' is a node from the tree except the leftmost node.
+   //!
+   //! <b>Effects</b>: Returns the previous node of the tree.
+   //!
+   //! <b>Complexity</b>: Amortized constant time.
+   //!
+   //! <b>Throws</b>: Nothing.
+   static node_ptr prev_node(node_ptr n) BOOST_NOEXCEPT
+   {
+      const bool thread = NodeTraits::get_left_thread(n);
+      n = NodeTraits::get_left(n);
+      return thread ? n : maximum(n);
+   }
+
+   //! <b>Requires</b>: 'n' must not be part of any tree.
+   //!
+   //! <b>Effects</b>: After the function unique(node) == true.
+   //!
+   //! <b>Complexity</b>: Constant.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Nodes</b>: If node is inserted in a tree, this function corrupts the tree.
+   static void init(node_ptr n) BOOST_NOEXCEPT
+   {
+      NodeTraits::set_left(n, node_ptr());
+      NodeTraits::set_right(n, node_ptr());
+      NodeTraits::set_left_thread(n, false);
+      NodeTraits::set_right_thread(n, false);
+   }
+
+   //! <b>Effects</b>: Returns true if node is in the same state as if called init(node)
+   //!
+   //! <b>Complexity</b>: Constant.
+   //!
+   //! <b>Throws</b>: Nothing.
+   inline static bool inited(const_node_ptr n) BOOST_NOEXCEPT
+   {  return !NodeTraits::get_left(n) && !NodeTraits::get_right(n);  }
+
+   //! <b>Requires</b>: 'n' is a node that was initialized with init() or
+   //!   a node of a tree (linked nodes never store null links).
+   //!
+   //! <b>Effects</b>: Returns true if 'n' is not linked to any tree.
+   //!
+   //! <b>Complexity</b>: Constant.
+   //!
+   //! <b>Throws</b>: Nothing.
+   inline static bool unique(const_node_ptr n) BOOST_NOEXCEPT
+   {  return inited(n);  }
+
+   //! <b>Requires</b>: header must not be part of any tree.
+   //!
+   //! <b>Effects</b>: Initializes the header to represent an empty tree.
+   //!   unique(header) == false.
+   //!
+   //! <b>Complexity</b>: Constant.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Nodes</b>: If header is inserted in a tree, this function corrupts the tree.
+   static void init_header(node_ptr header) BOOST_NOEXCEPT
+   {
+      NodeTraits::set_left(header, header);
+      NodeTraits::set_right(header, header);
+      NodeTraits::set_left_thread(header, true);
+      NodeTraits::set_right_thread(header, true);
+      NodeTraits::set_color(header, NodeTraits::red());
+   }
+
+   //! <b>Requires</b>: 'header' is the header node of a tree.
+   //!
+   //! <b>Effects</b>: Returns the number of nodes of the tree.
+   //!
+   //! <b>Complexity</b>: Linear time.
+   //!
+   //! <b>Throws</b>: Nothing.
+   static std::size_t size(const_node_ptr header) BOOST_NOEXCEPT
+   {
+      node_ptr beg(begin_node(header));
+      node_ptr end(end_node(header));
+      std::size_t i = 0;
+      for(;beg != end; beg = next_node(beg)) ++i;
+      return i;
+   }
+
+   //! <b>Requires</b>: header1 and header2 must be the header nodes
+   //!  of two trees.
+   //!
+   //! <b>Effects</b>: Swaps two trees. After the function header1 will contain
+   //!   links to the second tree and header2 will have links to the first tree.
+   //!
+   //! <b>Complexity</b>: Logarithmic, as the threads of the leftmost and rightmost
+   //!   nodes must be updated.
+   //!
+   //! <b>Throws</b>: Nothing.
+   static void swap_tree(node_ptr header1, node_ptr header2) BOOST_NOEXCEPT
+   {
+      if(header1 == header2)
+         return;
+      node_ptr const root1(get_root(header1));
+      node_ptr const root2(get_root(header2));
+      priv_set_root(header1, root2);
+      priv_set_root(header2, root1);
+   }
+
+   //! <b>Requires</b>: "disposer" must be an object function
+   //!   taking a node_ptr parameter and shouldn't throw.
+   //!
+   //! <b>Effects</b>: Empties the target tree calling
+   //!   <tt>void disposer::operator()(node_ptr)</tt> for every node of the tree
+   //!    except the header.
+   //!
+   //! <b>Complexity</b>: Linear to the number of element of the source tree plus the.
+   //!   number of elements of tree target tree when calling this function.
+   //!
+   //! <b>Throws</b>: Nothing.
+   template<class Disposer>
+   static void clear_and_dispose(node_ptr header, Disposer disposer) BOOST_NOEXCEPT
+   {
+      node_ptr n = begin_node(header);
+      while(n != header){
+         //next_node only visits nodes that are still to be disposed
+         node_ptr const nxt = next_node(n);
+         disposer(n);
+         n = nxt;
+      }
+      init_header(header);
+   }
+
+   //! <b>Requires</b>: "cloner" must be a function
+   //!   object taking a node_ptr and returning a new cloned node of it. "disposer" must
+   //!   take a node_ptr and shouldn't throw.
+   //!
+   //! <b>Effects</b>: First empties target tree calling
+   //!   <tt>void disposer::operator()(node_ptr)</tt> for every node of the tree
+   //!    except the header.
+   //!
+   //!   Then, duplicates the entire tree pointed by "source_header" cloning each
+   //!   source node with <tt>node_ptr Cloner::operator()(node_ptr)</tt> to obtain
+   //!   the nodes of the target tree. If "cloner" throws, the cloned target nodes
+   //!   are disposed using <tt>void disposer(node_ptr )</tt>.
+   //!
+   //! <b>Complexity</b>: Linear to the number of element of the source tree plus the
+   //!   number of elements of tree target tree when calling this function.
+   //!
+   //! <b>Throws</b>: If cloner functor throws. If this happens target nodes are disposed.
+   template <class Cloner, class Disposer>
+   static void clone
+      (const_node_ptr source_header, node_ptr target_header, Cloner cloner, Disposer disposer)
+   {
+      if(!unique(target_header)){
+         clear_and_dispose(target_header, disposer);
+      }
+
+      const_node_ptr const source_root = get_root(source_header);
+      if(source_root){
+         dispose_subtree_disposer<Disposer> rollback(disposer, target_header);
+         node_ptr const target_root = cloner(uncast(source_root));
+         NodeTraits::set_color(target_root, NodeTraits::get_color(source_root));
+         NodeTraits::set_left(target_header, target_root);
+         NodeTraits::set_left_thread(target_header, false);
+         clone_subtree(source_root, target_root, target_header, target_header, cloner);
+         rollback.release();
+      }
+   }
+
+   //! <b>Requires</b>: "header" must be the header node of a tree.
+   //!   KeyNodePtrCompare is a function object that induces a strict weak
+   //!   ordering compatible with the strict weak ordering used to create the
+   //!   the tree. KeyNodePtrCompare can compare KeyType with tree's node_ptrs.
+   //!
+   //! <b>Effects</b>: Returns a node_ptr to the first element that is
+   //!   not less than "key" according to "comp" or "header" if that element does
+   //!   not exist.
+   //!
+   //! <b>Complexity</b>: Logarithmic.
+   //!
+   //! <b>Throws</b>: If "comp" throws.
+   template<class KeyType, class KeyNodePtrCompare>
+   static node_ptr lower_bound
+      (const_node_ptr header, const KeyType &key, KeyNodePtrCompare comp)
+   {
+      node_ptr y = uncast(header);
+      if(!NodeTraits::get_left_thread(header)){
+         node_ptr x = NodeTraits::get_left(header);
+         while(1){
+            if(comp(x, key)){
+               if(NodeTraits::get_right_thread(x)) break;
+               x = NodeTraits::get_right(x);
+            }
+            else{
+               y = x;
+               if(NodeTraits::get_left_thread(x)) break;
+               x = NodeTraits::get_left(x);
+            }
+         }
+      }
+      return y;
+   }
+
+   //! <b>Requires</b>: "header" must be the header node of a tree.
+   //!   KeyNodePtrCompare is a function object that induces a strict weak
+   //!   ordering compatible with the strict weak ordering used to create the
+   //!   the tree. KeyNodePtrCompare can compare KeyType with tree's node_ptrs.
+   //!
+   //! <b>Effects</b>: Returns a node_ptr to the first element that is greater
+   //!   than "key" according to "comp" or "header" if that element does not exist.
+   //!
+   //! <b>Complexity</b>: Logarithmic.
+   //!
+   //! <b>Throws</b>: If "comp" throws.
+   template<class KeyType, class KeyNodePtrCompare>
+   static node_ptr upper_bound
+      (const_node_ptr header, const KeyType &key, KeyNodePtrCompare comp)
+   {
+      node_ptr y = uncast(header);
+      if(!NodeTraits::get_left_thread(header)){
+         node_ptr x = NodeTraits::get_left(header);
+         while(1){
+            if(comp(key, x)){
+               y = x;
+               if(NodeTraits::get_left_thread(x)) break;
+               x = NodeTraits::get_left(x);
+            }
+            else{
+               if(NodeTraits::get_right_thread(x)) break;
+               x = NodeTraits::get_right(x);
+            }
+         }
+      }
+      return y;
+   }
+
+   //! <b>Requires</b>: "header" must be the header node of a tree.
+   //!   KeyNodePtrCompare is a function object that induces a strict weak
+   //!   ordering compatible with the strict weak ordering used to create the
+   //!   the tree. KeyNodePtrCompare can compare KeyType with tree's node_ptrs.
+   //!
+   //! <b>Effects</b>: Returns a node_ptr to the element that is equivalent to
+   //!   "key" according to "comp" or "header" if that element does not exist.
+   //!
+   //! <b>Complexity</b>: Logarithmic.
+   //!
+   //! <b>Throws</b>: If "comp" throws.
+   template<class KeyType, class KeyNodePtrCompare>
+   static node_ptr find
+      (const_node_ptr header, const KeyType &key, KeyNodePtrCompare comp)
+   {
+      node_ptr const y = lower_bound(header, key, comp);
+      return (y == header || comp(key, y)) ? uncast(header) : y;
+   }
+
+   //! <b>Requires</b>: "header" must be the header node of a tree.
+   //!   NodePtrCompare is a function object that induces a strict weak
+   //!   ordering compatible with the strict weak ordering used to create the
+   //!   the tree. NodePtrCompare compares two node_ptrs.
+   //!
+   //! <b>Effects</b>: Inserts new_node into the tree if no node equivalent
+   //!   to new_node is already present. Returns a pair with the equivalent node
+   //!   (or new_node if it was inserted) and a boolean that is true if the
+   //!   insertion took place.
+   //!
+   //! <b>Complexity</b>: Logarithmic.
+   //!
+   //! <b>Throws</b>: If "comp" throws.
+   template<class NodePtrCompare>
+   static std::pair<node_ptr, bool> insert_unique
+      (node_ptr header, node_ptr new_node, NodePtrCompare comp)
+   {
+      path_t path;
+      std::size_t k = 1u;
+      path.node[0] = header;
+      path.dir[0] = false;
+      node_ptr p = header;
+      bool dir = false;
+      if(!NodeTraits::get_left_thread(header)){
+         p = NodeTraits::get_left(header);
+         while(1){
+            if(comp(new_node, p))
+               dir = false;
+            else if(comp(p, new_node))
+               dir = true;
+            else
+               return std::pair<node_ptr, bool>(p, false);
+            path.node[k] = p;
+            path.dir[k++] = dir;
+            if(is_thread(p, dir))
+               break;
+            p = get_link(p, dir);
+         }
+      }
+
+      //Link new_node as a leaf, inheriting the thread of its parent
+      set_link(new_node, dir, get_link(p, dir));
+      set_thread(new_node, dir, true);
+      set_link(new_node, !dir, p);
+      set_thread(new_node, !dir, true);
+      set_link(p, dir, new_node);
+      set_thread(p, dir, false);
+      NodeTraits::set_color(new_node, NodeTraits::red());
+      rebalance_after_insertion(path, k);
+      return std::pair<node_ptr, bool>(new_node, true);
+   }
+
+   //! <b>Requires</b>: "header" must be the header node of a tree and "z" a node
+   //!   of that tree. NodePtrCompare is a function object that induces a strict weak
+   //!   ordering compatible with the strict weak ordering used to create the
+   //!   the tree, and no other node of the tree is equivalent to "z".
+   //!
+   //! <b>Effects</b>: Erases node "z" from the tree.
+   //!
+   //! <b>Complexity</b>: Logarithmic.
+   //!
+   //! <b>Throws</b>: If "comp" throws.
+   template<class NodePtrCompare>
+   static void erase(node_ptr header, node_ptr z, NodePtrCompare comp)
+   {
+      path_t path;
+      std::size_t k = 1u;
+      path.node[0] = header;
+      path.dir[0] = false;
+      node_ptr p = NodeTraits::get_left(header);
+      while(p != z){
+         BOOST_INTRUSIVE_INVARIANT_ASSERT(k < max_path_length);
+         const bool dir = comp(p, z);
+         path.node[k] = p;
+         path.dir[k++] = dir;
+         p = get_link(p, dir);
+      }
+
+      if(NodeTraits::get_right_thread(p)){
+         if(!NodeTraits::get_left_thread(p)){
+            //Only a left child: the predecessor now threads to p's successor
+            node_ptr const t = maximum(NodeTraits::get_left(p));
+            NodeTraits::set_right(t, NodeTraits::get_right(p));
+            set_link(path.node[k-1], path.dir[k-1], NodeTraits::get_left(p));
+         }
+         else{
+            //Leaf: the parent inherits p's thread
+            set_link(path.node[k-1], path.dir[k-1], get_link(p, path.dir[k-1]));
+            set_thread(path.node[k-1], path.dir[k-1], true);
+         }
+      }
+      else{
+         node_ptr r = NodeTraits::get_right(p);
+         if(NodeTraits::get_left_thread(r)){
+            //The right child is the successor: it replaces p
+            NodeTraits::set_left(r, NodeTraits::get_left(p));
+            NodeTraits::set_left_thread(r, NodeTraits::get_left_thread(p));
+            if(!NodeTraits::get_left_thread(r)){
+               NodeTraits::set_right(maximum(NodeTraits::get_left(r)), r);
+            }
+            set_link(path.node[k-1], path.dir[k-1], r);
+            const color c = NodeTraits::get_color(r);
+            NodeTraits::set_color(r, NodeTraits::get_color(p));
+            NodeTraits::set_color(p, c);
+            path.dir[k] = true;
+            path.node[k++] = r;
+         }
+         else{
+            //The successor s is the leftmost node of the right subtree
+            node_ptr s;
+            const std::size_t j = k++;
+            while(1){
+               BOOST_INTRUSIVE_INVARIANT_ASSERT(k < max_path_length);
+               path.dir[k] = false;
+               path.node[k++] = r;
+               s = NodeTraits::get_left(r);
+               if(NodeTraits::get_left_thread(s))
+                  break;
+               r = s;
+            }
+            path.dir[j] = true;
+            path.node[j] = s;
+            if(!NodeTraits::get_right_thread(s)){
+               NodeTraits::set_left(r, NodeTraits::get_right(s));
+            }
+            else{
+               NodeTraits::set_left(r, s);
+               NodeTraits::set_left_thread(r, true);
+            }
+            NodeTraits::set_left(s, NodeTraits::get_left(p));
+            if(!NodeTraits::get_left_thread(p)){
+               NodeTraits::set_right(maximum(NodeTraits::get_left(p)), s);
+               NodeTraits::set_left_thread(s, false);
+            }
+            NodeTraits::set_right(s, NodeTraits::get_right(p));
+            NodeTraits::set_right_thread(s, false);
+            const color c = NodeTraits::get_color(s);
+            NodeTraits::set_color(s, NodeTraits::get_color(p));
+            NodeTraits::set_color(p, c);
+            set_link(path.node[j-1], path.dir[j-1], s);
+         }
+      }
+
+      if(NodeTraits::get_color(p) == NodeTraits::black()){
+         rebalance_after_erasure(path, k);
+      }
+   }
+
+   //! <b>Requires</b>: "header" must be the header node of a tree.
+   //!   NodePtrCompare is a function object that induces the strict weak
+   //!   ordering used to create the tree.
+   //!
+   //! <b>Effects</b>: Checks that the ordering, the threads and the red-black
+   //!   invariants hold for the tree and returns the number of nodes.
+   //!
+   //! <b>Complexity</b>: Linear.
+   //!
+   //! <b>Throws</b>: If "comp" throws.
+   template<class NodePtrCompare>
+   static std::size_t check(const_node_ptr header, NodePtrCompare comp)
+   {
+      BOOST_INTRUSIVE_INVARIANT_ASSERT(NodeTraits::get_right_thread(header));
+      BOOST_INTRUSIVE_INVARIANT_ASSERT(NodeTraits::get_right(header) == header);
+      const_node_ptr const r = get_root(header);
+      if(!r){
+         BOOST_INTRUSIVE_INVARIANT_ASSERT(NodeTraits::get_left(header) == header);
+         return 0u;
+      }
+      BOOST_INTRUSIVE_INVARIANT_ASSERT(NodeTraits::get_color(r) == NodeTraits::black());
+      std::size_t count = 0u;
+      check_subtree(r, header, header, header, comp, count);
+      return count;
+   }
+
+   /// @cond
+   private:
+
+   static void priv_set_root(node_ptr header, node_ptr root) BOOST_NOEXCEPT
+   {
+      if(root){
+         NodeTraits::set_left(header, root);
+         NodeTraits::set_left_thread(header, false);
+         NodeTraits::set_left(minimum(root), header);
+         NodeTraits::set_right(maximum(root), header);
+      }
+      else{
+         NodeTraits::set_left(header, header);
+         NodeTraits::set_left_thread(header, true);
+      }
+   }
+
+   template<class Disposer>
+   static void dispose_subtree(node_ptr x, Disposer &disposer) BOOST_NOEXCEPT
+   {
+      //Recursion depth is bounded by the height of the tree
+      while(1){
+         if(!NodeTraits::get_left_thread(x)){
+            dispose_subtree(NodeTraits::get_left(x), disposer);
+         }
+         const bool last = NodeTraits::get_right_thread(x);
+         node_ptr const right = NodeTraits::get_right(x);
+         disposer(x);
+         if(last)
+            break;
+         x = right;
+      }
+   }
+
+   //Clones the children of source (target is the already cloned source).
+   //"lo" and "hi" are the thread targets for the leftmost and rightmost
+   //nodes of the subtree. Threads are set before recursing so that the
+   //target subtree is always a well-formed tree that can be disposed.
+   template <class Cloner>
+   static void clone_subtree
+      (const_node_ptr source, node_ptr target, node_ptr lo, node_ptr hi, Cloner &cloner)
+   {
+      while(1){
+         NodeTraits::set_left(target, lo);
+         NodeTraits::set_left_thread(target, true);
+         NodeTraits::set_right(target, hi);
+         NodeTraits::set_right_thread(target, true);
+         if(!NodeTraits::get_left_thread(source)){
+            const_node_ptr const src_left = NodeTraits::get_left(source);
+            node_ptr const left = cloner(uncast(src_left));
+            NodeTraits::set_color(left, NodeTraits::get_color(src_left));
+            NodeTraits::set_left(target, left);
+            NodeTraits::set_left_thread(target, false);
+            clone_subtree(src_left, left, lo, target, cloner);
+         }
+         if(NodeTraits::get_right_thread(source))
+            break;
+         const_node_ptr const src_right = NodeTraits::get_right(source);
+         node_ptr const right = cloner(uncast(src_right));
+         NodeTraits::set_color(right, NodeTraits::get_color(src_right));
+         NodeTraits::set_right(target, right);
+         NodeTraits::set_right_thread(target, false);
+         lo = target;
+         source = src_right;
+         target = right;
+      }
+   }
+
+   static void rebalance_after_insertion(path_t &path, std::size_t k) BOOST_NOEXCEPT
+   {
+      while(k >= 3u && NodeTraits::get_color(path.node[k-1]) == NodeTraits::red()){
+         node_ptr const g = path.node[k-2];
+         const bool d = path.dir[k-2];
+         if(is_red_child(g, !d)){
+            //Red uncle: recolor and continue two levels up
+            NodeTraits::set_color(path.node[k-1], NodeTraits::black());
+            NodeTraits::set_color(get_link(g, !d), NodeTraits::black());
+            NodeTraits::set_color(g, NodeTraits::red());
+            k -= 2u;
+         }
+         else{
+            node_ptr y;
+            if(path.dir[k-1] == d){
+               y = path.node[k-1];
+            }
+            else{
+               //Zig-zag: rotate the parent first
+               node_ptr const x = path.node[k-1];
+               y = get_link(x, !d);
+               set_link(x, !d, get_link(y, d));
+               set_link(y, d, x);
+               set_link(g, d, y);
+               if(is_thread(y, d)){
+                  set_thread(y, d, false);
+                  set_thread(x, !d, true);
+                  set_link(x, !d, y);
+               }
+            }
+            NodeTraits::set_color(g, NodeTraits::red());
+            NodeTraits::set_color(y, NodeTraits::black());
+            set_link(g, d, get_link(y, !d));
+            set_link(y, !d, g);
+            set_link(path.node[k-3], path.dir[k-3], y);
+            if(is_thread(y, !d)){
+               set_thread(y, !d, false);
+               set_thread(g, d, true);
+               set_link(g, d, y);
+            }
+            break;
+         }
+      }
+      NodeTraits::set_color(NodeTraits::get_left(path.node[0]), NodeTraits::black());
+   }
+
+   static void rebalance_after_erasure(path_t &path, std::size_t k) BOOST_NOEXCEPT
+   {
+      for(; k > 1u; --k){
+         node_ptr q = path.node[k-1];
+         const bool d = path.dir[k-1];
+         if(is_red_child(q, d)){
+            NodeTraits::set_color(get_link(q, d), NodeTraits::black());
+            break;
+         }
+
+         node_ptr w = get_link(q, !d);
+         if(NodeTraits::get_color(w) == NodeTraits::red()){
+            //Red sibling: rotate it above q so that the sibling becomes black
+            NodeTraits::set_color(w, NodeTraits::black());
+            NodeTraits::set_color(q, NodeTraits::red());
+            set_link(q, !d, get_link(w, d));
+            set_link(w, d, q);
+            set_link(path.node[k-2], path.dir[k-2], w);
+            path.node[k] = q;
+            path.dir[k] = d;
+            path.node[k-1] = w;
+            ++k;
+            w = get_link(q, !d);
+         }
+
+         if(!is_red_child(w, false) && !is_red_child(w, true)){
+            NodeTraits::set_color(w, NodeTraits::red());
+         }
+         else{
+            if(!is_red_child(w, !d)){
+               node_ptr const y = get_link(w, d);
+               NodeTraits::set_color(y, NodeTraits::black());
+               NodeTraits::set_color(w, NodeTraits::red());
+               set_link(w, d, get_link(y, !d));
+               set_link(y, !d, w);
+               if(is_thread(y, !d)){
+                  set_thread(y, !d, false);
+                  set_thread(w, d, true);
+                  set_link(w, d, y);
+               }
+               set_link(q, !d, y);
+               w = y;
+            }
+            NodeTraits::set_color(w, NodeTraits::get_color(q));
+            NodeTraits::set_color(q, NodeTraits::black());
+            NodeTraits::set_color(get_link(w, !d), NodeTraits::black());
+            set_link(q, !d, get_link(w, d));
+            set_link(w, d, q);
+            if(is_thread(w, d)){
+               set_thread(w, d, false);
+               set_thread(q, !d, true);
+               set_link(q, !d, w);
+            }
+            set_link(path.node[k-2], path.dir[k-2], w);
+            break;
+         }
+      }
+      node_ptr const r = get_root(path.node[0]);
+      if(r){
+         NodeTraits::set_color(r, NodeTraits::black());
+      }
+   }
+
+   template<class NodePtrCompare>
+   static std::size_t check_subtree
+      ( const_node_ptr n, const_node_ptr lo, const_node_ptr hi, const_node_ptr header
+      , NodePtrCompare &comp, std::size_t &count)
+   {
+      ++count;
+      //lo and hi are the nearest ancestors bounding the subtree
+      BOOST_INTRUSIVE_INVARIANT_ASSERT(lo == header || comp(lo, n));
+      BOOST_INTRUSIVE_INVARIANT_ASSERT(hi == header || comp(n, hi));
+      std::size_t left_height = 0u, right_height = 0u;
+      const bool red = NodeTraits::get_color(n) == NodeTraits::red();
+      if(NodeTraits::get_left_thread(n)){
+         BOOST_INTRUSIVE_INVARIANT_ASSERT(NodeTraits::get_left(n) == lo);
+      }
+      else{
+         const_node_ptr const l = NodeTraits::get_left(n);
+         BOOST_INTRUSIVE_INVARIANT_ASSERT(!red || NodeTraits::get_color(l) == NodeTraits::black());
+         left_height = check_subtree(l, lo, n, header, comp, count);
+      }
+      if(NodeTraits::get_right_thread(n)){
+         BOOST_INTRUSIVE_INVARIANT_ASSERT(NodeTraits::get_right(n) == hi);
+      }
+      else{
+         const_node_ptr const r = NodeTraits::get_right(n);
+         BOOST_INTRUSIVE_INVARIANT_ASSERT(!red || NodeTraits::get_color(r) == NodeTraits::black());
+         right_height = check_subtree(r, n, hi, header, comp, count);
+      }
+      BOOST_INTRUSIVE_INVARIANT_ASSERT(left_height == right_height);
+      (void)right_height;
+      return left_height + std::size_t(!red);
+   }
+   /// @endcond
+};
+
+/// @cond
+
+template<class NodeTraits>
+struct get_algo<ThreadedRbTreeAlgorithms, NodeTraits>
+{
+   typedef threaded_rbtree_algorithms<NodeTraits> type;
+};
+
+/// @endcond
+
+} //namespace intrusive
+} //namespace boost
+
+#include <boost/intrusive/detail/config_end.hpp>
+
+#endif //BOOST_INTRUSIVE_THREADED_RBTREE_ALGORITHMS_HPP
@@ -397,6 +397,15 @@ class treap_impl
       this->priv_pcomp() = src.priv_pcomp();
    }
 
+   //! @copydoc ::boost::intrusive::bstree::clone_from(const bstree&,Cloner,Disposer,Executor)
+   //! Additional notes: it also copies the priority predicate from the source container.
+   template <class Cloner, class Disposer, class Executor>
+   void clone_from(const treap_impl &src, Cloner cloner, Disposer disposer, Executor executor)
+   {
+      tree_type::clone_from(src, cloner, disposer, executor);
+      this->priv_pcomp() = src.priv_pcomp();
+   }
+
    //! <b>Requires</b>: Disposer::operator()(pointer) shouldn't throw.
    //!   Cloner should yield to nodes equivalent to the original nodes.
    //!
@@ -441,6 +450,7 @@ class treap_impl
             , this->prio_node_prio_comp(this->priv_pcomp()))
          , this->priv_value_traits_ptr());
       this->tree_type::sz_traits().increment();
+      this->tree_type::increment_epoch();
       return ret;
    }
 
@@ -471,6 +481,7 @@ class treap_impl
             , this->prio_node_prio_comp(this->priv_pcomp()))
          , this->priv_value_traits_ptr());
       this->tree_type::sz_traits().increment();
+      this->tree_type::increment_epoch();
       return ret;
    }
 
@@ -760,6 +771,7 @@ class treap_impl
       BOOST_INTRUSIVE_SAFE_HOOK_DEFAULT_ASSERT(!safemode_or_autounlink || node_algorithms::unique(to_insert));
       node_algorithms::insert_unique_commit(this->tree_type::header_ptr(), to_insert, commit_data);
       this->tree_type::sz_traits().increment();
+      this->tree_type::increment_epoch();
       return iterator(to_insert, this->priv_value_traits_ptr());
    }
 
@@ -790,6 +802,7 @@ class treap_impl
             )
          , this->priv_value_traits_ptr());
       this->tree_type::sz_traits().increment();
+      this->tree_type::increment_epoch();
       return ret;
    }
 
@@ -814,6 +827,7 @@ class treap_impl
       node_algorithms::push_back
          (this->tree_type::header_ptr(), to_insert, this->prio_node_prio_comp(this->priv_pcomp()));
       this->tree_type::sz_traits().increment();
+      this->tree_type::increment_epoch();
    }
 
    //! <b>Requires</b>: value must be an lvalue, and it must be no greater
@@ -837,6 +851,7 @@ class treap_impl
       node_algorithms::push_front
          (this->tree_type::header_ptr(), to_insert, this->prio_node_prio_comp(this->priv_pcomp()));
       this->tree_type::sz_traits().increment();
+      this->tree_type::increment_epoch();
    }
 
    //! <b>Effects</b>: Erases the element pointed to by i.
@@ -856,6 +871,7 @@ class treap_impl
       node_algorithms::erase
          (this->tree_type::header_ptr(), to_erase, this->prio_node_prio_comp(this->priv_pcomp()));
       this->tree_type::sz_traits().decrement();
+      this->tree_type::increment_epoch();
       BOOST_IF_CONSTEXPR(safemode_or_autounlink)
          node_algorithms::init(to_erase);
       return ret.unconst();
@@ -1000,6 +1016,61 @@ class treap_impl
       return n;
    }
 
+   //! <b>Effects</b>: Erases all the elements for which pred returns true.
+   //!   No destructors are called.
+   //!
+   //! <b>Returns</b>: The number of erased elements.
+   //!
+   //! <b>Complexity</b>: Linear to the number of elements plus the rotations
+   //!   needed to erase each element. A treap is not rebuilt after the erasure,
+   //!   as its shape is fixed by the priorities of the elements.
+   //!
+   //! <b>Throws</b>: If pred throws, basic guarantee. If the priority_compare function
+   //!   throws then weak guarantee and heap invariants are broken.
+   //!
+   //! <b>Note</b>: Invalidates the iterators (but not the references)
+   //!    to the erased elements.
+   template<class Pred>
+   size_type erase_if(Pred pred)
+   {  return this->erase_and_dispose_if(pred, detail::null_disposer());   }
+
+   //! <b>Requires</b>: Disposer::operator()(pointer) shouldn't throw.
+   //!
+   //! <b>Effects</b>: Erases all the elements for which pred returns true.
+   //!   Disposer::operator()(pointer) is called for the removed elements.
+   //!
+   //! <b>Returns</b>: The number of erased elements.
+   //!
+   //! <b>Complexity</b>: Linear to the number of elements plus the rotations
+   //!   needed to erase each element.
+   //!
+   //! <b>Throws</b>: If pred throws, basic guarantee. If the priority_compare function
+   //!   throws then weak guarantee and heap invariants are broken.
+   //!
+   //! <b>Note</b>: Invalidates the iterators
+   //!    to the erased elements.
+   template<class Pred, class Disposer>
+   size_type erase_and_dispose_if(Pred pred, Disposer disposer)
+   {
+      size_type n = 0;
+      BOOST_INTRUSIVE_TRY{
+         n = (size_type)node_algorithms::erase_if_and_dispose
+            ( this->tree_type::header_ptr()
+            , detail::key_nodeptr_comp<Pred, value_traits>(pred, &this->get_value_traits())
+            , this->prio_node_prio_comp(this->priv_pcomp())
+            , detail::node_disposer<Disposer, value_traits, TreapAlgorithms>(disposer, &this->get_value_traits()));
+      }
+      BOOST_INTRUSIVE_CATCH(...){
+         this->tree_type::sz_traits().set_size(size_type(node_algorithms::size(this->tree_type::header_ptr())));
+         this->tree_type::increment_epoch();
+         BOOST_INTRUSIVE_RETHROW;
+      }
+      BOOST_INTRUSIVE_CATCH_END
+      this->tree_type::sz_traits().decrease(n);
+      this->tree_type::increment_epoch();
+      return n;
+   }
+
    //! <b>Effects</b>: Erases all of the elements.
    //!
    //! <b>Complexity</b>: Linear to the number of elements on the container.
@@ -1028,8 +1099,23 @@ class treap_impl
          , detail::node_disposer<Disposer, value_traits, TreapAlgorithms>(disposer, &this->get_value_traits()));
       node_algorithms::init_header(this->tree_type::header_ptr());
       this->tree_type::sz_traits().set_size(0);
+      this->tree_type::increment_epoch();
    }
 
+   #if defined(BOOST_INTRUSIVE_DOXYGEN_INVOKED)
+   //! @copydoc ::boost::intrusive::bstree::clear_and_dispose_some
+   template<class Disposer>
+   bool clear_and_dispose_some(Disposer disposer, size_type max_nodes) BOOST_NOEXCEPT;
+
+   //! @copydoc ::boost::intrusive::bstree::partition(size_type,OutputIterator)
+   template<class OutputIterator>
+   OutputIterator partition(size_type k, OutputIterator out);
+
+   //! @copydoc ::boost::intrusive::bstree::partition(size_type,OutputIterator)const
+   template<class OutputIterator>
+   OutputIterator partition(size_type k, OutputIterator out) const;
+   #endif
+
    #if defined(BOOST_INTRUSIVE_DOXYGEN_INVOKED)
    //! @copydoc ::boost::intrusive::bstree::merge_unique
    template<class T, class ...Options2> void merge_unique(sgtree<T, Options2...> &);
@@ -1052,6 +1138,8 @@ class treap_impl
                , this->prio_node_prio_comp(this->priv_pcomp()), source.header_ptr(), p) ){
             this->sz_traits().increment();
             source.sz_traits().decrement();
+            source.increment_epoch();
+            this->increment_epoch();
          }
       }
    }
@@ -1077,6 +1165,8 @@ class treap_impl
             , this->prio_node_prio_comp(this->priv_pcomp()), source.header_ptr(), p);
          this->sz_traits().increment();
          source.sz_traits().decrement();
+         source.increment_epoch();
+         this->increment_epoch();
       }
    }
 
@@ -1116,6 +1206,20 @@ class treap_impl
    template<class KeyType, class KeyTypeKeyCompare>
    const_iterator lower_bound(const KeyType& key, KeyTypeKeyCompare comp) const;
 
+   //! @copydoc ::boost::intrusive::bstree::lower_bound_from(const_iterator,const key_type &)
+   iterator lower_bound_from(const_iterator finger, const key_type &key);
+
+   //! @copydoc ::boost::intrusive::bstree::lower_bound_from(const_iterator,const key_type &)const
+   const_iterator lower_bound_from(const_iterator finger, const key_type &key) const;
+
+   //! @copydoc ::boost::intrusive::bstree::lower_bound_from(const_iterator,const KeyType&,KeyTypeKeyCompare)
+   template<class KeyType, class KeyTypeKeyCompare>
+   iterator lower_bound_from(const_iterator finger, const KeyType &key, KeyTypeKeyCompare comp);
+
+   //! @copydoc ::boost::intrusive::bstree::lower_bound_from(const_iterator,const KeyType&,KeyTypeKeyCompare)const
+   template<class KeyType, class KeyTypeKeyCompare>
+   const_iterator lower_bound_from(const_iterator finger, const KeyType &key, KeyTypeKeyCompare comp) const;
+
    //! @copydoc ::boost::intrusive::bstree::upper_bound(const key_type &)
    iterator upper_bound(const key_type &key);
 
@@ -1199,6 +1303,14 @@ class treap_impl
    //! @copydoc ::boost::intrusive::bstree::replace_node
    void replace_node(iterator replace_this, reference with_this) BOOST_NOEXCEPT;
 
+   //! @copydoc ::boost::intrusive::bstree::relocate(Relocator,Disposer)
+   template <class Relocator, class Disposer>
+   void relocate(Relocator relocator, Disposer disposer);
+
+   //! @copydoc ::boost::intrusive::bstree::relocate(Relocator)
+   template <class Relocator>
+   void relocate(Relocator relocator);
+
    //! @copydoc ::boost::intrusive::bstree::remove_node
    void remove_node(reference value) BOOST_NOEXCEPT;
 
@@ -1223,17 +1335,24 @@ class treap_impl
    template<class Disposer>
    iterator private_erase(const_iterator b, const_iterator e, size_type &n, Disposer disposer)
    {
-      for(n = 0; b != e; ++n)
-        this->erase_and_dispose(b++, disposer);
-      return b.unconst();
+      for(n = 0; b != e; ++n){
+         if(n == tree_type::range_erase_split_threshold){
+            const size_type erased = (size_type)node_algorithms::erase_range_and_dispose
+               ( this->tree_type::header_ptr(), b.pointed_node(), e.pointed_node()
+               , this->prio_node_prio_comp(this->priv_pcomp())
+               , detail::node_disposer<Disposer, value_traits, TreapAlgorithms>(disposer, &this->get_value_traits()));
+            this->tree_type::sz_traits().decrease(erased);
+            this->tree_type::increment_epoch();
+            n += erased;
+            break;
+         }
+         this->erase_and_dispose(b++, disposer);
+      }
+      return e.unconst();
    }
 
    iterator private_erase(const_iterator b, const_iterator e, size_type &n)
-   {
-      for(n = 0; b != e; ++n)
-        this->erase(b++);
-      return b.unconst();
-   }
+   {  return this->private_erase(b, e, n, detail::null_disposer());  }
    /// @endcond
 };
 
@@ -1270,7 +1389,9 @@ struct make_treap
          , typename packed_options::priority
          , typename packed_options::size_type
          , packed_options::constant_time_size
-         , typename packed_options::header_holder_type
+         , typename detail::get_epoch_header_holder
+            < packed_options::modification_epoch
+            , typename packed_options::header_holder_type>::type
          > implementation_defined;
    /// @endcond
    typedef implementation_defined type;
@@ -1347,6 +1468,10 @@ class treap
    inline void clone_from(BOOST_RV_REF(treap) src, Cloner cloner, Disposer disposer)
    {  Base::clone_from(BOOST_MOVE_BASE(Base, src), cloner, disposer);  }
 
+   template <class Cloner, class Disposer, class Executor>
+   inline void clone_from(const treap &src, Cloner cloner, Disposer disposer, Executor executor)
+   {  Base::clone_from(src, cloner, disposer, executor);  }
+
    BOOST_INTRUSIVE_NO_DANGLING
    inline static treap &container_from_end_iterator(iterator end_iterator) BOOST_NOEXCEPT
    {  return static_cast<treap &>(Base::container_from_end_iterator(end_iterator));   }
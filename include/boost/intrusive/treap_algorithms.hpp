@@ -251,12 +251,73 @@ class treap_algorithms
       return z;
    }
 
+   //! <b>Requires</b>: header must be the header of a tree, [b, e) a range of nodes of
+   //!   that tree and "disposer" an object function taking a node_ptr parameter that
+   //!   shouldn't throw. "pcomp" is the priority comparison function of the tree.
+   //!
+   //! <b>Effects</b>: Splits the tree before b and before e and joins the nodes placed
+   //!   before b with e and the nodes placed after e, detaching [b, e) from the tree as a
+   //!   subtree. Then calls <tt>void disposer::operator()(node_ptr)</tt> for every
+   //!   node of the detached range.
+   //!
+   //! <b>Returns</b>: The number of erased nodes.
+   //!
+   //! <b>Complexity</b>: Logarithmic to the size of the tree plus linear to the number
+   //!   of erased nodes: splits keep the priority order and only e is rotated down
+   //!   to its place when the remaining parts are joined.
+   //!
+   //! <b>Throws</b>: If "pcomp" throws.
+   template<class NodePtrPriorityCompare, class Disposer>
+   static std::size_t erase_range_and_dispose
+      (node_ptr header, node_ptr b, node_ptr e, NodePtrPriorityCompare pcomp, Disposer disposer)
+   {
+      treap_joiner<NodePtrPriorityCompare> j(pcomp);
+      return bstree_algo::erase_range_and_dispose(header, b, e, j, disposer);
+   }
+
+   //! <b>Requires</b>: header must be the header of a tree, "pred" an object function
+   //!   taking a node_ptr parameter and "disposer" an object function taking a node_ptr
+   //!   parameter that shouldn't throw. "pcomp" is the priority comparison function of the tree.
+   //!
+   //! <b>Effects</b>: Erases the nodes for which pred returns true, in order, calling
+   //!   <tt>void disposer::operator()(node_ptr)</tt> for them. Nodes are erased one by one,
+   //!   as the shape of a treap is determined by the priorities of its nodes and
+   //!   it can't be rebuilt balanced.
+   //!
+   //! <b>Returns</b>: The number of erased nodes.
+   //!
+   //! <b>Complexity</b>: Linear to the size of the tree plus the rotations of each erasure.
+   //!
+   //! <b>Throws</b>: If "pred" or "pcomp" throw. Basic guarantee.
+   template<class NodePred, class NodePtrPriorityCompare, class Disposer>
+   static std::size_t erase_if_and_dispose
+      (node_ptr header, NodePred pred, NodePtrPriorityCompare pcomp, Disposer disposer)
+   {
+      std::size_t erased = 0u;
+      for(node_ptr n = bstree_algo::begin_node(header); n != header; ){
+         const node_ptr next(bstree_algo::next_node(n));
+         if(pred(n)){
+            erase(header, n, pcomp);
+            disposer(n);
+            ++erased;
+         }
+         n = next;
+      }
+      return erased;
+   }
+
    #ifdef BOOST_INTRUSIVE_DOXYGEN_INVOKED
    //! @copydoc ::boost::intrusive::bstree_algorithms::clone(const_node_ptr,node_ptr,Cloner,Disposer)
    template <class Cloner, class Disposer>
    static void clone
       (const_node_ptr source_header, node_ptr target_header, Cloner cloner, Disposer disposer);
 
+   //! @copydoc ::boost::intrusive::bstree_algorithms::clone(const_node_ptr,node_ptr,Cloner,Disposer,Executor,std::size_t)
+   template <class Cloner, class Disposer, class Executor>
+   static void clone
+      ( const_node_ptr source_header, node_ptr target_header, Cloner cloner, Disposer disposer
+      , Executor executor, std::size_t fork_levels);
+
    //! @copydoc ::boost::intrusive::bstree_algorithms::clear_and_dispose(node_ptr,Disposer)
    template<class Disposer>
    static void clear_and_dispose(node_ptr header, Disposer disposer) BOOST_NOEXCEPT;
@@ -611,6 +672,38 @@ class treap_algorithms
    /// @cond
    private:
 
+   //Joins treap subtrees: x is linked as the root and rotated down
+   //until both children have a lower priority
+   template<class NodePtrPriorityCompare>
+   struct treap_joiner
+      : bstree_algo::subtree_joiner
+   {
+      explicit treap_joiner(NodePtrPriorityCompare pcomp)
+         : pcomp_(pcomp)
+      {}
+
+      node_ptr join(node_ptr header, node_ptr l, std::size_t, node_ptr x, node_ptr r, std::size_t, std::size_t &h)
+      {
+         h = 0u;
+         bstree_algo::link_children(x, l, r);
+         NodeTraits::set_parent(header, x);
+         NodeTraits::set_parent(x, header);
+         while(1){
+            const node_ptr x_left (NodeTraits::get_left(x));
+            const node_ptr x_right(NodeTraits::get_right(x));
+            if(x_left && pcomp_(x_left, x) && !(x_right && pcomp_(x_right, x_left)))
+               bstree_algo::rotate_right(x, x_left, NodeTraits::get_parent(x), header);
+            else if(x_right && pcomp_(x_right, x))
+               bstree_algo::rotate_left(x, x_right, NodeTraits::get_parent(x), header);
+            else
+               break;
+         }
+         return NodeTraits::get_parent(header);
+      }
+
+      NodePtrPriorityCompare pcomp_;
+   };
+
    template<class NodePtrPriorityCompare>
    static void rebalance_for_erasure(node_ptr header, node_ptr z, NodePtrPriorityCompare pcomp)
    {
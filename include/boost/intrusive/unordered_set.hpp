@@ -188,6 +188,10 @@ class unordered_set_impl
    template <class Cloner, class Disposer>
    void clone_from(const unordered_set_impl &src, Cloner cloner, Disposer disposer);
 
+   //! @copydoc ::boost::intrusive::hashtable::clone_from(const hashtable&,Cloner,Disposer,Executor)
+   template <class Cloner, class Disposer, class Executor>
+   void clone_from(const unordered_set_impl &src, Cloner cloner, Disposer disposer, Executor executor);
+
    #else
 
    using table_type::clone_from;
@@ -259,6 +263,14 @@ class unordered_set_impl
    template<class KeyType, class KeyHasher, class KeyEqual, class Disposer>
    size_type erase_and_dispose(const KeyType& key, KeyHasher hash_func, KeyEqual equal_func, Disposer disposer);
 
+   //! @copydoc ::boost::intrusive::hashtable::erase_if(Pred)
+   template<class Pred>
+   size_type erase_if(Pred pred);
+
+   //! @copydoc ::boost::intrusive::hashtable::erase_and_dispose_if(Pred,Disposer)
+   template<class Pred, class Disposer>
+   size_type erase_and_dispose_if(Pred pred, Disposer disposer);
+
    //! @copydoc ::boost::intrusive::hashtable::clear
    void clear() BOOST_NOEXCEPT;
 
@@ -266,6 +278,18 @@ class unordered_set_impl
    template<class Disposer>
    void clear_and_dispose(Disposer disposer) BOOST_NOEXCEPT;
 
+   //! @copydoc ::boost::intrusive::hashtable::clear_and_dispose_some
+   template<class Disposer>
+   bool clear_and_dispose_some(Disposer disposer, size_type max_nodes) BOOST_NOEXCEPT;
+
+   //! @copydoc ::boost::intrusive::hashtable::partition(size_type,OutputIterator)
+   template<class OutputIterator>
+   OutputIterator partition(size_type k, OutputIterator out);
+
+   //! @copydoc ::boost::intrusive::hashtable::partition(size_type,OutputIterator)const
+   template<class OutputIterator>
+   OutputIterator partition(size_type k, OutputIterator out) const;
+
    //! @copydoc ::boost::intrusive::hashtable::count(const key_type &)const
    size_type count(const key_type &key) const;
 
@@ -539,6 +563,10 @@ class unordered_set
    template <class Cloner, class Disposer>
    inline void clone_from(BOOST_RV_REF(unordered_set) src, Cloner cloner, Disposer disposer)
    {  this->Base::clone_from(BOOST_MOVE_BASE(Base, src), cloner, disposer);  }
+
+   template <class Cloner, class Disposer, class Executor>
+   inline void clone_from(const unordered_set &src, Cloner cloner, Disposer disposer, Executor executor)
+   {  this->Base::clone_from(src, cloner, disposer, executor);  }
 };
 
 #endif
@@ -698,6 +726,10 @@ class unordered_multiset_impl
    template <class Cloner, class Disposer>
    void clone_from(const unordered_multiset_impl &src, Cloner cloner, Disposer disposer);
 
+   //! @copydoc ::boost::intrusive::hashtable::clone_from(const hashtable&,Cloner,Disposer,Executor)
+   template <class Cloner, class Disposer, class Executor>
+   void clone_from(const unordered_multiset_impl &src, Cloner cloner, Disposer disposer, Executor executor);
+
    #else
 
    using table_type::clone_from;
@@ -751,6 +783,14 @@ class unordered_multiset_impl
    template<class KeyType, class KeyHasher, class KeyEqual, class Disposer>
    size_type erase_and_dispose(const KeyType& key, KeyHasher hash_func, KeyEqual equal_func, Disposer disposer);
 
+   //! @copydoc ::boost::intrusive::hashtable::erase_if(Pred)
+   template<class Pred>
+   size_type erase_if(Pred pred);
+
+   //! @copydoc ::boost::intrusive::hashtable::erase_and_dispose_if(Pred,Disposer)
+   template<class Pred, class Disposer>
+   size_type erase_and_dispose_if(Pred pred, Disposer disposer);
+
    //! @copydoc ::boost::intrusive::hashtable::clear
    void clear() BOOST_NOEXCEPT;
 
@@ -758,6 +798,18 @@ class unordered_multiset_impl
    template<class Disposer>
    void clear_and_dispose(Disposer disposer) BOOST_NOEXCEPT;
 
+   //! @copydoc ::boost::intrusive::hashtable::clear_and_dispose_some
+   template<class Disposer>
+   bool clear_and_dispose_some(Disposer disposer, size_type max_nodes) BOOST_NOEXCEPT;
+
+   //! @copydoc ::boost::intrusive::hashtable::partition(size_type,OutputIterator)
+   template<class OutputIterator>
+   OutputIterator partition(size_type k, OutputIterator out);
+
+   //! @copydoc ::boost::intrusive::hashtable::partition(size_type,OutputIterator)const
+   template<class OutputIterator>
+   OutputIterator partition(size_type k, OutputIterator out) const;
+
    //! @copydoc ::boost::intrusive::hashtable::count(const key_type &)const
    size_type count(const key_type &key) const;
 
@@ -994,6 +1046,10 @@ class unordered_multiset
    template <class Cloner, class Disposer>
    inline void clone_from(BOOST_RV_REF(unordered_multiset) src, Cloner cloner, Disposer disposer)
    {  this->Base::clone_from(BOOST_MOVE_BASE(Base, src), cloner, disposer);  }
+
+   template <class Cloner, class Disposer, class Executor>
+   inline void clone_from(const unordered_multiset &src, Cloner cloner, Disposer disposer, Executor executor)
+   {  this->Base::clone_from(src, cloner, disposer, executor);  }
 };
 
 #endif
@@ -0,0 +1,983 @@
+/////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright agent 2026
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/intrusive for documentation.
+//
+/////////////////////////////////////////////////////////////////////////////
+
+#ifndef BOOST_INTRUSIVE_XOR_LIST_HPP
+#define BOOST_INTRUSIVE_XOR_LIST_HPP
+
+#include <boost/intrusive/detail/config_begin.hpp>
+#include <boost/intrusive/intrusive_fwd.hpp>
+#include <boost/intrusive/detail/assert.hpp>
+#include <boost/intrusive/xor_list_hook.hpp>
+#include <boost/intrusive/xor_list_algorithms.hpp>
+#include <boost/intrusive/pointer_traits.hpp>
+#include <boost/intrusive/detail/mpl.hpp>
+#include <boost/intrusive/link_mode.hpp>
+#include <boost/intrusive/detail/get_value_traits.hpp>
+#include <boost/intrusive/detail/is_stateful_value_traits.hpp>
+#include <boost/intrusive/detail/reverse_iterator.hpp>
+#include <boost/intrusive/detail/uncast.hpp>
+#include <boost/intrusive/detail/xor_list_iterator.hpp>
+#include <boost/intrusive/detail/exception_disposer.hpp>
+#include <boost/intrusive/detail/simple_disposers.hpp>
+#include <boost/intrusive/detail/size_holder.hpp>
+#include <boost/intrusive/detail/parent_from_member.hpp>
+
+#include <boost/move/utility_core.hpp>
+
+#include <cstddef>   //std::size_t, etc.
+
+#if defined(BOOST_HAS_PRAGMA_ONCE)
+#  pragma once
+#endif
+
+namespace boost {
+namespace intrusive {
+
+/// @cond
+
+struct default_xor_list_hook_applier
+{  template <class T> struct apply{ typedef typename T::default_xor_list_hook type;  };  };
+
+template<>
+struct is_default_hook_tag<default_xor_list_hook_applier>
+{  static const bool value = true;  };
+
+struct xor_list_defaults
+{
+   typedef default_xor_list_hook_applier proto_value_traits;
+   static const bool constant_time_size = true;
+   typedef std::size_t size_type;
+};
+
+/// @endcond
+
+//! The class template xor_list is an intrusive doubly linked list whose hooks store
+//! a single link field: the address of the previous element xor'ed with the address
+//! of the next element. Hooks are half the size of list hooks, while the container
+//! still offers insertion and removal at both ends and bidirectional iteration.
+//!
+//! As an element alone is not enough to reach its neighbours, iterators hold
+//! two pointers (the pointed element and its predecessor) and there is no \c iterator_to.
+//! Inserting or erasing an element invalidates the iterators to its neighbours.
+//! On the other hand, splicing a whole list, reversing and swapping are constant-time operations.
+//!
+//! The template parameter \c T is the type to be managed by the container.
+//! The user can specify additional options and if no options are provided
+//! default options are used.
+//!
+//! The container supports the following options:
+//! \c base_hook<>/member_hook<>/value_traits<>,
+//! \c constant_time_size<> and \c size_type<>.
+#if defined(BOOST_INTRUSIVE_DOXYGEN_INVOKED)
+template<class T, class ...Options>
+#else
+template <class ValueTraits, class SizeType, bool ConstantTimeSize>
+#endif
+class xor_list_impl
+{
+   //Public typedefs
+   public:
+   typedef ValueTraits                                               value_traits;
+   typedef typename value_traits::pointer                            pointer;
+   typedef typename value_traits::const_pointer                      const_pointer;
+   typedef typename pointer_traits<pointer>::element_type            value_type;
+   typedef typename pointer_traits<pointer>::reference               reference;
+   typedef typename pointer_traits<const_pointer>::reference         const_reference;
+   typedef typename pointer_traits<pointer>::difference_type         difference_type;
+   typedef SizeType                                                  size_type;
+   typedef xor_list_iterator<value_traits, false>                    iterator;
+   typedef xor_list_iterator<value_traits, true>                     const_iterator;
+   typedef boost::intrusive::reverse_iterator<iterator>              reverse_iterator;
+   typedef boost::intrusive::reverse_iterator<const_iterator>        const_reverse_iterator;
+   typedef typename value_traits::node_traits                        node_traits;
+   typedef typename node_traits::node                                node;
+   typedef typename node_traits::node_ptr                            node_ptr;
+   typedef typename node_traits::const_node_ptr                      const_node_ptr;
+   typedef xor_list_algorithms<node_traits>                          node_algorithms;
+
+   static const bool constant_time_size = ConstantTimeSize;
+   static const bool stateful_value_traits = detail::is_stateful_value_traits<value_traits>::value;
+
+   /// @cond
+
+   private:
+   typedef detail::size_holder<constant_time_size, size_type>          size_traits;
+
+   //noncopyable
+   BOOST_MOVABLE_BUT_NOT_COPYABLE(xor_list_impl)
+
+   static const bool safemode_or_autounlink = is_safe_autounlink<value_traits::link_mode>::value;
+
+   //An element can't unlink itself as its neighbours are unknown
+   BOOST_INTRUSIVE_STATIC_ASSERT(((int)value_traits::link_mode != (int)auto_unlink));
+
+   inline node_ptr get_front_node()
+   { return pointer_traits<node_ptr>::pointer_to(data_.root_plus_size_.m_front); }
+
+   inline const_node_ptr get_front_node() const
+   { return pointer_traits<const_node_ptr>::pointer_to(data_.root_plus_size_.m_front); }
+
+   inline node_ptr get_back_node()
+   { return pointer_traits<node_ptr>::pointer_to(data_.root_plus_size_.m_back); }
+
+   inline const_node_ptr get_back_node() const
+   { return pointer_traits<const_node_ptr>::pointer_to(data_.root_plus_size_.m_back); }
+
+   struct root_plus_size : public size_traits
+   {
+      node m_front;
+      node m_back;
+   };
+
+   struct data_t : public value_traits
+   {
+      typedef typename xor_list_impl::value_traits value_traits;
+      inline explicit data_t(const value_traits &val_traits)
+         :  value_traits(val_traits)
+      {}
+
+      root_plus_size root_plus_size_;
+   } data_;
+
+   inline size_traits &priv_size_traits() BOOST_NOEXCEPT
+   {  return data_.root_plus_size_;  }
+
+   inline const size_traits &priv_size_traits() const BOOST_NOEXCEPT
+   {  return data_.root_plus_size_;  }
+
+   inline const value_traits &priv_value_traits() const BOOST_NOEXCEPT
+   {  return data_;  }
+
+   inline value_traits &priv_value_traits() BOOST_NOEXCEPT
+   {  return data_;  }
+
+   typedef typename boost::intrusive::value_traits_pointers
+      <ValueTraits>::const_value_traits_ptr const_value_traits_ptr;
+
+   inline const_value_traits_ptr priv_value_traits_ptr() const BOOST_NOEXCEPT
+   {  return pointer_traits<const_value_traits_ptr>::pointer_to(this->priv_value_traits());  }
+
+   inline void priv_init_header() BOOST_NOEXCEPT
+   {
+      this->priv_size_traits().set_size(size_type(0));
+      node_algorithms::init_header(this->get_front_node(), this->get_back_node());
+   }
+
+   /// @endcond
+
+   public:
+
+   //! <b>Effects</b>: constructs an empty list.
+   //!
+   //! <b>Complexity</b>: Constant
+   //!
+   //! <b>Throws</b>: Nothing.
+   xor_list_impl()
+      :  data_(value_traits())
+   {  this->priv_init_header();  }
+
+   //! <b>Effects</b>: constructs an empty list.
+   //!
+   //! <b>Complexity</b>: Constant
+   //!
+   //! <b>Throws</b>: Nothing.
+   explicit xor_list_impl(const value_traits &v_traits)
+      :  data_(v_traits)
+   {  this->priv_init_header();  }
+
+   //! <b>Requires</b>: Dereferencing iterator must yield an lvalue of type value_type.
+   //!
+   //! <b>Effects</b>: Constructs a list equal to the range [first,last).
+   //!
+   //! <b>Complexity</b>: Linear in distance(b, e). No copy constructors are called.
+   //!
+   //! <b>Throws</b>: Nothing.
+   template<class Iterator>
+   xor_list_impl(Iterator b, Iterator e, const value_traits &v_traits = value_traits())
+      :  data_(v_traits)
+   {
+      this->priv_init_header();
+      for(; b != e; ++b){
+         this->push_back(*b);
+      }
+   }
+
+   //! <b>Effects</b>: Constructs a container moving resources from another container.
+   //!   Internal value traits are move constructed and
+   //!   nodes belonging to x (except the sentinels) are linked to *this.
+   //!
+   //! <b>Complexity</b>: Constant.
+   //!
+   //! <b>Throws</b>: If the move constructor of value traits throws.
+   xor_list_impl(BOOST_RV_REF(xor_list_impl) x)
+      : data_(::boost::move(x.priv_value_traits()))
+   {
+      this->priv_init_header();
+      this->swap(x);
+   }
+
+   //! <b>Effects</b>: Equivalent to swap
+   //!
+   xor_list_impl& operator=(BOOST_RV_REF(xor_list_impl) x)
+   {  this->swap(x); return *this;  }
+
+   //! <b>Effects</b>: If it's not a safe-mode value_type the destructor does nothing
+   //!   (ie. no code is generated). Otherwise it detaches all elements from this.
+   //!   In this case the objects in the list are not deleted (i.e. no destructors
+   //!   are called), but the hooks according to the ValueTraits template parameter
+   //!   are set to their default value.
+   //!
+   //! <b>Complexity</b>: Linear to the number of elements in the list, if
+   //!   it's a safe-mode value. Otherwise constant.
+   //!
+   //! <b>Throws</b>: Nothing.
+   ~xor_list_impl()
+   {
+      BOOST_IF_CONSTEXPR(safemode_or_autounlink){
+         this->clear();
+      }
+   }
+
+   //! <b>Requires</b>: value must be an lvalue.
+   //!
+   //! <b>Effects</b>: Inserts the value in the back of the list.
+   //!   No copy constructors are called.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   //!
+   //! <b>Note</b>: Invalidates the end iterator.
+   void push_back(reference value) BOOST_NOEXCEPT
+   {
+      node_ptr to_insert = priv_value_traits().to_node_ptr(value);
+      BOOST_INTRUSIVE_SAFE_HOOK_DEFAULT_ASSERT(!safemode_or_autounlink || node_algorithms::inited(to_insert));
+      const node_ptr back = this->get_back_node();
+      node_algorithms::link_between
+         (node_algorithms::last(this->get_front_node(), back), to_insert, back);
+      this->priv_size_traits().increment();
+   }
+
+   //! <b>Requires</b>: value must be an lvalue.
+   //!
+   //! <b>Effects</b>: Inserts the value in the front of the list.
+   //!   No copy constructors are called.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   //!
+   //! <b>Note</b>: Invalidates the iterator to the first element.
+   void push_front(reference value) BOOST_NOEXCEPT
+   {
+      node_ptr to_insert = priv_value_traits().to_node_ptr(value);
+      BOOST_INTRUSIVE_SAFE_HOOK_DEFAULT_ASSERT(!safemode_or_autounlink || node_algorithms::inited(to_insert));
+      const node_ptr front = this->get_front_node();
+      node_algorithms::link_between
+         (front, to_insert, node_algorithms::first(front, this->get_back_node()));
+      this->priv_size_traits().increment();
+   }
+
+   //! <b>Effects</b>: Erases the last element of the list.
+   //!   No destructors are called.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   //!
+   //! <b>Note</b>: Invalidates the iterators to the erased element and the end iterator.
+   void pop_back() BOOST_NOEXCEPT
+   {  return this->pop_back_and_dispose(detail::null_disposer());   }
+
+   //! <b>Requires</b>: Disposer::operator()(pointer) shouldn't throw.
+   //!
+   //! <b>Effects</b>: Erases the last element of the list.
+   //!   No destructors are called.
+   //!   Disposer::operator()(pointer) is called for the removed element.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   //!
+   //! <b>Note</b>: Invalidates the iterators to the erased element and the end iterator.
+   template<class Disposer>
+   void pop_back_and_dispose(Disposer disposer) BOOST_NOEXCEPT
+   {
+      const node_ptr back = this->get_back_node();
+      const node_ptr to_erase = node_algorithms::last(this->get_front_node(), back);
+      node_algorithms::unlink(node_algorithms::get_previous(to_erase, back), to_erase, back);
+      this->priv_size_traits().decrement();
+      BOOST_IF_CONSTEXPR(safemode_or_autounlink)
+         node_algorithms::init(to_erase);
+      disposer(priv_value_traits().to_value_ptr(to_erase));
+   }
+
+   //! <b>Effects</b>: Erases the first element of the list.
+   //!   No destructors are called.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   //!
+   //! <b>Note</b>: Invalidates the iterators to the erased element and the next one.
+   void pop_front() BOOST_NOEXCEPT
+   {  return this->pop_front_and_dispose(detail::null_disposer());   }
+
+   //! <b>Requires</b>: Disposer::operator()(pointer) shouldn't throw.
+   //!
+   //! <b>Effects</b>: Erases the first element of the list.
+   //!   No destructors are called.
+   //!   Disposer::operator()(pointer) is called for the removed element.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   //!
+   //! <b>Note</b>: Invalidates the iterators to the erased element and the next one.
+   template<class Disposer>
+   void pop_front_and_dispose(Disposer disposer) BOOST_NOEXCEPT
+   {
+      const node_ptr front = this->get_front_node();
+      const node_ptr to_erase = node_algorithms::first(front, this->get_back_node());
+      node_algorithms::unlink(front, to_erase, node_algorithms::get_next(front, to_erase));
+      this->priv_size_traits().decrement();
+      BOOST_IF_CONSTEXPR(safemode_or_autounlink)
+         node_algorithms::init(to_erase);
+      disposer(priv_value_traits().to_value_ptr(to_erase));
+   }
+
+   //! <b>Effects</b>: Returns a reference to the first element of the list.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   inline reference front() BOOST_NOEXCEPT
+   {  return *priv_value_traits().to_value_ptr(node_algorithms::first(this->get_front_node(), this->get_back_node()));  }
+
+   //! <b>Effects</b>: Returns a const_reference to the first element of the list.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   inline const_reference front() const BOOST_NOEXCEPT
+   {  return *priv_value_traits().to_value_ptr(node_algorithms::first(this->get_front_node(), this->get_back_node()));  }
+
+   //! <b>Effects</b>: Returns a reference to the last element of the list.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   inline reference back() BOOST_NOEXCEPT
+   {  return *priv_value_traits().to_value_ptr(node_algorithms::last(this->get_front_node(), this->get_back_node()));  }
+
+   //! <b>Effects</b>: Returns a const_reference to the last element of the list.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   inline const_reference back() const BOOST_NOEXCEPT
+   {  return *priv_value_traits().to_value_ptr(node_algorithms::last(this->get_front_node(), this->get_back_node()));  }
+
+   //! <b>Effects</b>: Returns an iterator to the first element contained in the list.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   inline iterator begin() BOOST_NOEXCEPT
+   {
+      const node_ptr front = this->get_front_node();
+      return iterator(front, node_algorithms::first(front, this->get_back_node()), this->priv_value_traits_ptr());
+   }
+
+   //! <b>Effects</b>: Returns a const_iterator to the first element contained in the list.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   inline const_iterator begin() const BOOST_NOEXCEPT
+   {  return this->cbegin();   }
+
+   //! <b>Effects</b>: Returns a const_iterator to the first element contained in the list.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   inline const_iterator cbegin() const BOOST_NOEXCEPT
+   {
+      const node_ptr front = detail::uncast(this->get_front_node());
+      return const_iterator(front, node_algorithms::first(front, this->get_back_node()), this->priv_value_traits_ptr());
+   }
+
+   //! <b>Effects</b>: Returns an iterator to the end of the list.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   inline iterator end() BOOST_NOEXCEPT
+   {
+      const node_ptr back = this->get_back_node();
+      return iterator(node_algorithms::last(this->get_front_node(), back), back, this->priv_value_traits_ptr());
+   }
+
+   //! <b>Effects</b>: Returns a const_iterator to the end of the list.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   inline const_iterator end() const BOOST_NOEXCEPT
+   {  return this->cend();  }
+
+   //! <b>Effects</b>: Returns a constant iterator to the end of the list.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   inline const_iterator cend() const BOOST_NOEXCEPT
+   {
+      const node_ptr back = detail::uncast(this->get_back_node());
+      return const_iterator(node_algorithms::last(this->get_front_node(), back), back, this->priv_value_traits_ptr());
+   }
+
+   //! <b>Effects</b>: Returns a reverse_iterator pointing to the beginning
+   //! of the reversed list.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   inline reverse_iterator rbegin() BOOST_NOEXCEPT
+   {  return reverse_iterator(this->end());  }
+
+   //! <b>Effects</b>: Returns a const_reverse_iterator pointing to the beginning
+   //! of the reversed list.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   inline const_reverse_iterator rbegin() const BOOST_NOEXCEPT
+   {  return this->crbegin();  }
+
+   //! <b>Effects</b>: Returns a const_reverse_iterator pointing to the beginning
+   //! of the reversed list.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   inline const_reverse_iterator crbegin() const BOOST_NOEXCEPT
+   {  return const_reverse_iterator(this->cend());  }
+
+   //! <b>Effects</b>: Returns a reverse_iterator pointing to the end
+   //! of the reversed list.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   inline reverse_iterator rend() BOOST_NOEXCEPT
+   {  return reverse_iterator(this->begin());  }
+
+   //! <b>Effects</b>: Returns a const_reverse_iterator pointing to the end
+   //! of the reversed list.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   inline const_reverse_iterator rend() const BOOST_NOEXCEPT
+   {  return this->crend();  }
+
+   //! <b>Effects</b>: Returns a const_reverse_iterator pointing to the end
+   //! of the reversed list.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   inline const_reverse_iterator crend() const BOOST_NOEXCEPT
+   {  return const_reverse_iterator(this->cbegin());  }
+
+   //! <b>Precondition</b>: end_iterator must be a valid end iterator
+   //!   of xor_list.
+   //!
+   //! <b>Effects</b>: Returns a reference to the xor_list associated to the end iterator
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   BOOST_INTRUSIVE_NO_DANGLING
+   inline static xor_list_impl &container_from_end_iterator(iterator end_iterator) BOOST_NOEXCEPT
+   {  return xor_list_impl::priv_container_from_end_iterator(end_iterator);   }
+
+   //! <b>Precondition</b>: end_iterator must be a valid end const_iterator
+   //!   of xor_list.
+   //!
+   //! <b>Effects</b>: Returns a const reference to the xor_list associated to the end iterator
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   BOOST_INTRUSIVE_NO_DANGLING
+   inline static const xor_list_impl &container_from_end_iterator(const_iterator end_iterator) BOOST_NOEXCEPT
+   {  return xor_list_impl::priv_container_from_end_iterator(end_iterator);   }
+
+   //! <b>Effects</b>: Returns the number of the elements contained in the list.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Linear to the number of elements contained in the list.
+   //!   if constant-time size option is disabled. Constant time otherwise.
+   inline size_type size() const BOOST_NOEXCEPT
+   {
+      BOOST_IF_CONSTEXPR(constant_time_size)
+         return this->priv_size_traits().get_size();
+      else
+         return size_type(node_algorithms::count(this->get_front_node(), this->get_back_node()));
+   }
+
+   //! <b>Effects</b>: Returns true if the list contains no elements.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   inline bool empty() const BOOST_NOEXCEPT
+   {  return node_algorithms::is_empty(this->get_front_node());   }
+
+   //! <b>Effects</b>: Swaps the elements of x and *this.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   //!
+   //! <b>Note</b>: Invalidates the iterators to the first element and the end
+   //!   iterators of both lists.
+   void swap(xor_list_impl& other) BOOST_NOEXCEPT
+   {
+      node_algorithms::swap_lists
+         (this->get_front_node(), this->get_back_node(), other.get_front_node(), other.get_back_node());
+      this->priv_size_traits().swap(other.priv_size_traits());
+   }
+
+   //! <b>Effects</b>: Reverses the order of elements in the list.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   //!
+   //! <b>Note</b>: Invalidates all the iterators.
+   inline void reverse() BOOST_NOEXCEPT
+   {  node_algorithms::reverse(this->get_front_node(), this->get_back_node());   }
+
+   //! <b>Requires</b>: value must be an lvalue and p must be a valid iterator of *this.
+   //!
+   //! <b>Effects</b>: Inserts the value before the position pointed by p.
+   //!
+   //! <b>Returns</b>: An iterator to the inserted element.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant time. No copy constructors are called.
+   //!
+   //! <b>Note</b>: Invalidates p and the iterator to the element that precedes p.
+   iterator insert(const_iterator p, reference value) BOOST_NOEXCEPT
+   {
+      node_ptr to_insert = this->priv_value_traits().to_node_ptr(value);
+      BOOST_INTRUSIVE_SAFE_HOOK_DEFAULT_ASSERT(!safemode_or_autounlink || node_algorithms::inited(to_insert));
+      const node_ptr prev = p.previous_node();
+      node_algorithms::link_between(prev, to_insert, p.pointed_node());
+      this->priv_size_traits().increment();
+      return iterator(prev, to_insert, this->priv_value_traits_ptr());
+   }
+
+   //! <b>Effects</b>: Erases the element pointed by i of the list.
+   //!   No destructors are called.
+   //!
+   //! <b>Returns</b>: the first element remaining beyond the removed element,
+   //!   or end() if no such element exists.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   //!
+   //! <b>Note</b>: Invalidates i and the iterators to the neighbours of the erased element.
+   inline iterator erase(const_iterator i) BOOST_NOEXCEPT
+   {  return this->erase_and_dispose(i, detail::null_disposer());  }
+
+   //! <b>Requires</b>: b and e must be valid iterators to elements in *this.
+   //!
+   //! <b>Effects</b>: Erases the element range pointed by b and e
+   //! No destructors are called.
+   //!
+   //! <b>Returns</b>: the first element remaining beyond the removed elements,
+   //!   or end() if no such element exists.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Linear to the number of erased elements if it's a safe-mode
+   //!   or constant-time size is activated. Constant time otherwise.
+   //!
+   //! <b>Note</b>: Invalidates b, e and the iterators to the erased elements.
+   iterator erase(const_iterator b, const_iterator e) BOOST_NOEXCEPT
+   {
+      BOOST_IF_CONSTEXPR(safemode_or_autounlink || constant_time_size){
+         return this->erase_and_dispose(b, e, detail::null_disposer());
+      }
+      else{
+         return this->priv_unlink_range(b, e);
+      }
+   }
+
+   //! <b>Requires</b>: b and e must be valid iterators to elements in *this.
+   //!   n must be distance(b, e).
+   //!
+   //! <b>Effects</b>: Erases the element range pointed by b and e
+   //! No destructors are called.
+   //!
+   //! <b>Returns</b>: the first element remaining beyond the removed elements,
+   //!   or end() if no such element exists.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Linear to the number of erased elements if it's a safe-mode
+   //!   value. Constant time otherwise.
+   //!
+   //! <b>Note</b>: Invalidates b, e and the iterators to the erased elements.
+   iterator erase(const_iterator b, const_iterator e, size_type n) BOOST_NOEXCEPT
+   {
+      BOOST_IF_CONSTEXPR(safemode_or_autounlink){
+         return this->erase_and_dispose(b, e, detail::null_disposer());
+      }
+      else{
+         this->priv_size_traits().decrease(n);
+         return this->priv_unlink_range(b, e);
+      }
+   }
+
+   //! <b>Requires</b>: Disposer::operator()(pointer) shouldn't throw.
+   //!
+   //! <b>Effects</b>: Erases the element pointed by i of the list.
+   //!   No destructors are called.
+   //!   Disposer::operator()(pointer) is called for the removed element.
+   //!
+   //! <b>Returns</b>: the first element remaining beyond the removed element,
+   //!   or end() if no such element exists.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   //!
+   //! <b>Note</b>: Invalidates i and the iterators to the neighbours of the erased element.
+   template <class Disposer>
+   iterator erase_and_dispose(const_iterator i, Disposer disposer) BOOST_NOEXCEPT
+   {
+      const node_ptr prev = i.previous_node();
+      const node_ptr to_erase = i.pointed_node();
+      const node_ptr next = node_algorithms::get_next(prev, to_erase);
+      node_algorithms::unlink(prev, to_erase, next);
+      this->priv_size_traits().decrement();
+      BOOST_IF_CONSTEXPR(safemode_or_autounlink)
+         node_algorithms::init(to_erase);
+      disposer(this->priv_value_traits().to_value_ptr(to_erase));
+      return iterator(prev, next, this->priv_value_traits_ptr());
+   }
+
+   //! <b>Requires</b>: Disposer::operator()(pointer) shouldn't throw.
+   //!
+   //! <b>Effects</b>: Erases the element range pointed by b and e
+   //!   No destructors are called.
+   //!   Disposer::operator()(pointer) is called for the removed elements.
+   //!
+   //! <b>Returns</b>: the first element remaining beyond the removed elements,
+   //!   or end() if no such element exists.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Linear to the number of elements erased.
+   //!
+   //! <b>Note</b>: Invalidates b, e and the iterators to the erased elements.
+   template <class Disposer>
+   iterator erase_and_dispose(const_iterator b, const_iterator e, Disposer disposer) BOOST_NOEXCEPT
+   {
+      const node_ptr prev = b.previous_node();
+      const node_ptr next = e.pointed_node();
+      if(b != e){
+         //Links of the erased nodes are not touched by the range unlink
+         node_algorithms::unlink(prev, b.pointed_node(), e.previous_node(), next);
+         node_ptr p = prev, n = b.pointed_node();
+         while(n != next){
+            const node_ptr nxt = node_algorithms::get_next(p, n);
+            p = n;
+            BOOST_IF_CONSTEXPR(safemode_or_autounlink)
+               node_algorithms::init(n);
+            disposer(this->priv_value_traits().to_value_ptr(n));
+            this->priv_size_traits().decrement();
+            n = nxt;
+         }
+      }
+      return iterator(prev, next, this->priv_value_traits_ptr());
+   }
+
+   //! <b>Effects</b>: Erases all the elements of the container.
+   //!   No destructors are called.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Linear to the number of elements of the list.
+   //!   if it's a safe-mode value_type. Constant time otherwise.
+   //!
+   //! <b>Note</b>: Invalidates the iterators (but not the references) to the erased elements.
+   void clear() BOOST_NOEXCEPT
+   {
+      BOOST_IF_CONSTEXPR(safemode_or_autounlink){
+         this->clear_and_dispose(detail::null_disposer());
+      }
+      else{
+         this->priv_init_header();
+      }
+   }
+
+   //! <b>Requires</b>: Disposer::operator()(pointer) shouldn't throw.
+   //!
+   //! <b>Effects</b>: Erases all the elements of the container.
+   //!   No destructors are called.
+   //!   Disposer::operator()(pointer) is called for the removed elements.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Linear to the number of elements of the list.
+   //!
+   //! <b>Note</b>: Invalidates the iterators to the erased elements.
+   template <class Disposer>
+   void clear_and_dispose(Disposer disposer) BOOST_NOEXCEPT
+   {
+      const node_ptr back = this->get_back_node();
+      node_ptr p = this->get_front_node();
+      node_ptr n = node_algorithms::first(p, back);
+      while(n != back){
+         const node_ptr nxt = node_algorithms::get_next(p, n);
+         p = n;
+         BOOST_IF_CONSTEXPR(safemode_or_autounlink)
+            node_algorithms::init(n);
+         disposer(this->priv_value_traits().to_value_ptr(n));
+         n = nxt;
+      }
+      this->priv_init_header();
+   }
+
+   //! <b>Requires</b>: Disposer::operator()(pointer) shouldn't throw.
+   //!   Cloner should yield to nodes equivalent to the original nodes.
+   //!
+   //! <b>Effects</b>: Erases all the elements from *this
+   //!   calling Disposer::operator()(pointer), clones all the
+   //!   elements from src calling Cloner::operator()(const_reference )
+   //!   and inserts them on *this.
+   //!
+   //!   If cloner throws, all cloned elements are unlinked and disposed
+   //!   calling Disposer::operator()(pointer).
+   //!
+   //! <b>Complexity</b>: Linear to erased plus inserted elements.
+   //!
+   //! <b>Throws</b>: If cloner throws. Basic guarantee.
+   template <class Cloner, class Disposer>
+   void clone_from(const xor_list_impl &src, Cloner cloner, Disposer disposer)
+   {
+      this->clear_and_dispose(disposer);
+      detail::exception_disposer<xor_list_impl, Disposer>
+         rollback(*this, disposer);
+      const_iterator b(src.begin()), e(src.end());
+      for(; b != e; ++b){
+         this->push_back(*cloner(*b));
+      }
+      rollback.release();
+   }
+
+   //! <b>Requires</b>: Disposer::operator()(pointer) shouldn't throw.
+   //!   Cloner should yield to nodes equivalent to the original nodes.
+   //!
+   //! <b>Effects</b>: Erases all the elements from *this
+   //!   calling Disposer::operator()(pointer), clones all the
+   //!   elements from src calling Cloner::operator()(reference)
+   //!   and inserts them on *this.
+   //!
+   //!   If cloner throws, all cloned elements are unlinked and disposed
+   //!   calling Disposer::operator()(pointer).
+   //!
+   //! <b>Complexity</b>: Linear to erased plus inserted elements.
+   //!
+   //! <b>Throws</b>: If cloner throws. Basic guarantee.
+   template <class Cloner, class Disposer>
+   void clone_from(BOOST_RV_REF(xor_list_impl) src, Cloner cloner, Disposer disposer)
+   {
+      this->clear_and_dispose(disposer);
+      detail::exception_disposer<xor_list_impl, Disposer>
+         rollback(*this, disposer);
+      iterator b(src.begin()), e(src.end());
+      for(; b != e; ++b){
+         this->push_back(*cloner(*b));
+      }
+      rollback.release();
+   }
+
+   //! <b>Requires</b>: p must be a valid iterator of *this.
+   //!
+   //! <b>Effects</b>: Transfers all the elements of list x to this list, before the
+   //!   the element pointed by p. No destructors or copy constructors are called.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant time, even if constant-time size is activated.
+   //!
+   //! <b>Note</b>: Invalidates p, the iterator to the element that precedes p
+   //!   and all the iterators of x.
+   void splice(const_iterator p, xor_list_impl& x) BOOST_NOEXCEPT
+   {
+      node_algorithms::transfer
+         (p.previous_node(), p.pointed_node(), x.get_front_node(), x.get_back_node());
+      this->priv_size_traits().increase(x.priv_size_traits().get_size());
+      x.priv_size_traits().set_size(size_type(0));
+   }
+
+   inline friend void swap(xor_list_impl &x, xor_list_impl &y) BOOST_NOEXCEPT
+   {  x.swap(y);  }
+
+   /// @cond
+
+   private:
+   iterator priv_unlink_range(const_iterator b, const_iterator e) BOOST_NOEXCEPT
+   {
+      const node_ptr prev = b.previous_node();
+      const node_ptr next = e.pointed_node();
+      if(b != e){
+         node_algorithms::unlink(prev, b.pointed_node(), e.previous_node(), next);
+      }
+      return iterator(prev, next, this->priv_value_traits_ptr());
+   }
+
+   BOOST_INTRUSIVE_NO_DANGLING
+   static xor_list_impl &priv_container_from_end_iterator(const const_iterator &end_iterator) BOOST_NOEXCEPT
+   {
+      root_plus_size *r = detail::parent_from_member<root_plus_size, node>
+         (end_iterator.pointed_node(), &root_plus_size::m_back);
+      data_t *d = detail::parent_from_member<data_t, root_plus_size>
+         ( r, &data_t::root_plus_size_);
+      xor_list_impl *s  = detail::parent_from_member<xor_list_impl, data_t>(d, &xor_list_impl::data_);
+      return *s;
+   }
+   /// @endcond
+};
+
+
+//! Helper metafunction to define a \c xor_list that yields to the same type when the
+//! same options (either explicitly or implicitly) are used.
+#if defined(BOOST_INTRUSIVE_DOXYGEN_INVOKED) || defined(BOOST_INTRUSIVE_VARIADIC_TEMPLATES)
+template<class T, class ...Options>
+#else
+template<class T, class O1 = void, class O2 = void, class O3 = void>
+#endif
+struct make_xor_list
+{
+   /// @cond
+   typedef typename pack_options
+      < xor_list_defaults,
+         #if !defined(BOOST_INTRUSIVE_VARIADIC_TEMPLATES)
+         O1, O2, O3
+         #else
+         Options...
+         #endif
+      >::type packed_options;
+
+   typedef typename detail::get_value_traits
+      <T, typename packed_options::proto_value_traits>::type value_traits;
+   typedef xor_list_impl
+      <
+         value_traits,
+         typename packed_options::size_type,
+         packed_options::constant_time_size
+      > implementation_defined;
+   /// @endcond
+   typedef implementation_defined type;
+};
+
+
+#ifndef BOOST_INTRUSIVE_DOXYGEN_INVOKED
+
+#if !defined(BOOST_INTRUSIVE_VARIADIC_TEMPLATES)
+template<class T, class O1, class O2, class O3>
+#else
+template<class T, class ...Options>
+#endif
+class xor_list
+   :  public make_xor_list<T,
+      #if !defined(BOOST_INTRUSIVE_VARIADIC_TEMPLATES)
+      O1, O2, O3
+      #else
+      Options...
+      #endif
+   >::type
+{
+   typedef typename make_xor_list
+      <T,
+      #if !defined(BOOST_INTRUSIVE_VARIADIC_TEMPLATES)
+      O1, O2, O3
+      #else
+      Options...
+      #endif
+      >::type      Base;
+   //Assert if passed value traits are compatible with the type
+   BOOST_INTRUSIVE_STATIC_ASSERT((detail::is_same<typename Base::value_traits::value_type, T>::value));
+   BOOST_MOVABLE_BUT_NOT_COPYABLE(xor_list)
+
+   public:
+   typedef typename Base::value_traits          value_traits;
+   typedef typename Base::iterator              iterator;
+   typedef typename Base::const_iterator        const_iterator;
+
+   inline xor_list()
+      :  Base()
+   {}
+
+   inline explicit xor_list(const value_traits &v_traits)
+      :  Base(v_traits)
+   {}
+
+   template<class Iterator>
+   inline xor_list(Iterator b, Iterator e, const value_traits &v_traits = value_traits())
+      :  Base(b, e, v_traits)
+   {}
+
+   inline xor_list(BOOST_RV_REF(xor_list) x)
+      :  Base(BOOST_MOVE_BASE(Base, x))
+   {}
+
+   inline xor_list& operator=(BOOST_RV_REF(xor_list) x)
+   {  return static_cast<xor_list &>(this->Base::operator=(BOOST_MOVE_BASE(Base, x)));  }
+
+   template <class Cloner, class Disposer>
+   inline void clone_from(const xor_list &src, Cloner cloner, Disposer disposer)
+   {  Base::clone_from(src, cloner, disposer);  }
+
+   template <class Cloner, class Disposer>
+   inline void clone_from(BOOST_RV_REF(xor_list) src, Cloner cloner, Disposer disposer)
+   {  Base::clone_from(BOOST_MOVE_BASE(Base, src), cloner, disposer);  }
+
+   BOOST_INTRUSIVE_NO_DANGLING
+   inline static xor_list &container_from_end_iterator(iterator end_iterator) BOOST_NOEXCEPT
+   {  return static_cast<xor_list &>(Base::container_from_end_iterator(end_iterator));   }
+
+   BOOST_INTRUSIVE_NO_DANGLING
+   inline static const xor_list &container_from_end_iterator(const_iterator end_iterator) BOOST_NOEXCEPT
+   {  return static_cast<const xor_list &>(Base::container_from_end_iterator(end_iterator));   }
+};
+
+#endif
+
+} //namespace intrusive
+} //namespace boost
+
+#include <boost/intrusive/detail/config_end.hpp>
+
+#endif //BOOST_INTRUSIVE_XOR_LIST_HPP
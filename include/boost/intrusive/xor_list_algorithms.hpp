@@ -0,0 +1,331 @@
+/////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright agent 2026
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/intrusive for documentation.
+//
+/////////////////////////////////////////////////////////////////////////////
+
+#ifndef BOOST_INTRUSIVE_XOR_LIST_ALGORITHMS_HPP
+#define BOOST_INTRUSIVE_XOR_LIST_ALGORITHMS_HPP
+
+#include <boost/intrusive/detail/config_begin.hpp>
+#include <boost/intrusive/intrusive_fwd.hpp>
+#include <boost/intrusive/detail/workaround.hpp>
+#include <boost/intrusive/detail/algo_type.hpp>
+#include <cstddef>
+
+#if defined(BOOST_HAS_PRAGMA_ONCE)
+#  pragma once
+#endif
+
+namespace boost {
+namespace intrusive {
+
+//! xor_list_algorithms provides basic algorithms to manipulate nodes
+//! forming a circular xor-linked list. Each node stores a single link field
+//! holding the address of its previous node xor'ed with the address of its next node,
+//! so a node can only be reached when one of its neighbours is known.
+//!
+//! A list is formed by two sentinel nodes, \c front and \c back, and the ring
+//! <tt>front, first element, ..., last element, back</tt>. As both sentinels are known,
+//! the list can be traversed from either end. An empty list is formed by both sentinels
+//! linked to each other, so their link fields are zero. As a linked element always has two
+//! different neighbours, a zero link field identifies a non-used element.
+//!
+//! xor_list_algorithms is configured with a NodeTraits class, which encapsulates the
+//! information about the node to be manipulated. NodeTraits must support the
+//! following interface:
+//!
+//! <b>Typedefs</b>:
+//!
+//! <tt>node</tt>: The type of the node that forms the list
+//!
+//! <tt>node_ptr</tt>: A raw pointer to a node
+//!
+//! <tt>const_node_ptr</tt>: A raw pointer to a const node
+//!
+//! <b>Static functions</b>:
+//!
+//! <tt>static uintptr_t get_link(const_node_ptr n);</tt>
+//!
+//! <tt>static void set_link(node_ptr n, uintptr_t link);</tt>
+template<class NodeTraits>
+class xor_list_algorithms
+{
+   public:
+   typedef typename NodeTraits::node            node;
+   typedef typename NodeTraits::node_ptr        node_ptr;
+   typedef typename NodeTraits::const_node_ptr  const_node_ptr;
+   typedef NodeTraits                           node_traits;
+
+   /// @cond
+   private:
+   BOOST_INTRUSIVE_FORCEINLINE static uintptr_t addr(const_node_ptr n) BOOST_NOEXCEPT
+   {  return reinterpret_cast<uintptr_t>(n);  }
+
+   BOOST_INTRUSIVE_FORCEINLINE static void xor_link(node_ptr n, uintptr_t x) BOOST_NOEXCEPT
+   {  NodeTraits::set_link(n, NodeTraits::get_link(n) ^ x);  }
+
+   //Moves the chain [first, last], currently linked between old_front and old_back,
+   //so that it is linked between new_front and new_back. Sentinels are not updated.
+   static void rebase(node_ptr first, node_ptr last, const_node_ptr old_front, const_node_ptr old_back
+                     , const_node_ptr new_front, const_node_ptr new_back) BOOST_NOEXCEPT
+   {
+      //If first == last both updates are applied to the same node, as expected
+      xor_link(first, addr(old_front) ^ addr(new_front));
+      xor_link(last, addr(old_back) ^ addr(new_back));
+   }
+   /// @endcond
+
+   public:
+   //! <b>Effects</b>: Constructs an non-used list element, so that
+   //! inited(this_node) == true
+   //!
+   //! <b>Complexity</b>: Constant
+   //!
+   //! <b>Throws</b>: Nothing.
+   BOOST_INTRUSIVE_FORCEINLINE static void init(node_ptr this_node) BOOST_NOEXCEPT
+   {  NodeTraits::set_link(this_node, 0u);  }
+
+   //! <b>Effects</b>: Returns true is "this_node" is in a non-used state
+   //! as if it was initialized by the "init" function.
+   //!
+   //! <b>Complexity</b>: Constant
+   //!
+   //! <b>Throws</b>: Nothing.
+   BOOST_INTRUSIVE_FORCEINLINE static bool inited(const_node_ptr this_node) BOOST_NOEXCEPT
+   {  return !NodeTraits::get_link(this_node);  }
+
+   //! <b>Effects</b>: Returns true if "this_node" is not linked to any other node.
+   //!
+   //! <b>Complexity</b>: Constant
+   //!
+   //! <b>Throws</b>: Nothing.
+   BOOST_INTRUSIVE_FORCEINLINE static bool unique(const_node_ptr this_node) BOOST_NOEXCEPT
+   {  return !NodeTraits::get_link(this_node);  }
+
+   //! <b>Effects</b>: Constructs an empty list formed by the sentinels front and back.
+   //!
+   //! <b>Complexity</b>: Constant
+   //!
+   //! <b>Throws</b>: Nothing.
+   BOOST_INTRUSIVE_FORCEINLINE static void init_header(node_ptr front, node_ptr back) BOOST_NOEXCEPT
+   {
+      //Each sentinel is both the previous and the next node of the other one
+      NodeTraits::set_link(front, 0u);
+      NodeTraits::set_link(back, 0u);
+   }
+
+   //! <b>Requires</b>: front is the front sentinel of a list.
+   //!
+   //! <b>Effects</b>: Returns true if the list has no elements.
+   //!
+   //! <b>Complexity</b>: Constant
+   //!
+   //! <b>Throws</b>: Nothing.
+   BOOST_INTRUSIVE_FORCEINLINE static bool is_empty(const_node_ptr front) BOOST_NOEXCEPT
+   {  return !NodeTraits::get_link(front);  }
+
+   //! <b>Requires</b>: prev and this_node are adjacent nodes of a list.
+   //!
+   //! <b>Effects</b>: Returns the node that follows this_node.
+   //!
+   //! <b>Complexity</b>: Constant
+   //!
+   //! <b>Throws</b>: Nothing.
+   BOOST_INTRUSIVE_FORCEINLINE static node_ptr get_next(const_node_ptr prev, const_node_ptr this_node) BOOST_NOEXCEPT
+   {  return reinterpret_cast<node_ptr>(NodeTraits::get_link(this_node) ^ addr(prev));  }
+
+   //! <b>Requires</b>: this_node and next are adjacent nodes of a list.
+   //!
+   //! <b>Effects</b>: Returns the node that precedes this_node.
+   //!
+   //! <b>Complexity</b>: Constant
+   //!
+   //! <b>Throws</b>: Nothing.
+   BOOST_INTRUSIVE_FORCEINLINE static node_ptr get_previous(const_node_ptr this_node, const_node_ptr next) BOOST_NOEXCEPT
+   {  return reinterpret_cast<node_ptr>(NodeTraits::get_link(this_node) ^ addr(next));  }
+
+   //! <b>Requires</b>: front and back are the sentinels of a list.
+   //!
+   //! <b>Effects</b>: Returns the first element, or back if the list is empty.
+   //!
+   //! <b>Complexity</b>: Constant
+   //!
+   //! <b>Throws</b>: Nothing.
+   BOOST_INTRUSIVE_FORCEINLINE static node_ptr first(const_node_ptr front, const_node_ptr back) BOOST_NOEXCEPT
+   {  return get_next(back, front);  }
+
+   //! <b>Requires</b>: front and back are the sentinels of a list.
+   //!
+   //! <b>Effects</b>: Returns the last element, or front if the list is empty.
+   //!
+   //! <b>Complexity</b>: Constant
+   //!
+   //! <b>Throws</b>: Nothing.
+   BOOST_INTRUSIVE_FORCEINLINE static node_ptr last(const_node_ptr front, const_node_ptr back) BOOST_NOEXCEPT
+   {  return get_previous(back, front);  }
+
+   //! <b>Requires</b>: prev and next are adjacent nodes of a list (prev precedes next)
+   //!   and this_node is not linked.
+   //!
+   //! <b>Effects</b>: Links this_node between prev and next.
+   //!
+   //! <b>Complexity</b>: Constant
+   //!
+   //! <b>Throws</b>: Nothing.
+   static void link_between(node_ptr prev, node_ptr this_node, node_ptr next) BOOST_NOEXCEPT
+   {
+      const uintptr_t n = addr(this_node);
+      NodeTraits::set_link(this_node, addr(prev) ^ addr(next));
+      xor_link(prev, addr(next) ^ n);
+      xor_link(next, addr(prev) ^ n);
+   }
+
+   //! <b>Requires</b>: prev, this_node and next are adjacent nodes of a list.
+   //!
+   //! <b>Effects</b>: Unlinks this_node from the list. this_node's link field
+   //!   is left unchanged.
+   //!
+   //! <b>Complexity</b>: Constant
+   //!
+   //! <b>Throws</b>: Nothing.
+   static void unlink(node_ptr prev, node_ptr this_node, node_ptr next) BOOST_NOEXCEPT
+   {
+      const uintptr_t n = addr(this_node);
+      xor_link(prev, addr(next) ^ n);
+      xor_link(next, addr(prev) ^ n);
+   }
+
+   //! <b>Requires</b>: prev precedes first, last precedes next and [first, last]
+   //!   is a non-empty range of the same list.
+   //!
+   //! <b>Effects</b>: Unlinks the range [first, last] from the list linking prev and next.
+   //!   Link fields of unlinked nodes are left unchanged.
+   //!
+   //! <b>Complexity</b>: Constant
+   //!
+   //! <b>Throws</b>: Nothing.
+   static void unlink(node_ptr prev, node_ptr first, node_ptr last, node_ptr next) BOOST_NOEXCEPT
+   {
+      xor_link(prev, addr(first) ^ addr(next));
+      xor_link(next, addr(last) ^ addr(prev));
+   }
+
+   //! <b>Requires</b>: prev and next are adjacent nodes of a list (prev precedes next).
+   //!   other_front and other_back are the sentinels of another list.
+   //!
+   //! <b>Effects</b>: Moves all the elements of the other list between prev and next.
+   //!   The other list becomes empty.
+   //!
+   //! <b>Complexity</b>: Constant
+   //!
+   //! <b>Throws</b>: Nothing.
+   static void transfer(node_ptr prev, node_ptr next, node_ptr other_front, node_ptr other_back) BOOST_NOEXCEPT
+   {
+      if(!is_empty(other_front)){
+         const node_ptr f = first(other_front, other_back);
+         const node_ptr l = last(other_front, other_back);
+         rebase(f, l, other_front, other_back, prev, next);
+         xor_link(prev, addr(next) ^ addr(f));
+         xor_link(next, addr(prev) ^ addr(l));
+         init_header(other_front, other_back);
+      }
+   }
+
+   //! <b>Requires</b>: front and back are the sentinels of a list.
+   //!
+   //! <b>Effects</b>: Reverses the order of the elements.
+   //!
+   //! <b>Complexity</b>: Constant
+   //!
+   //! <b>Throws</b>: Nothing.
+   static void reverse(node_ptr front, node_ptr back) BOOST_NOEXCEPT
+   {
+      if(!is_empty(front)){
+         //The chain is symmetrical: swapping the sentinels that surround it reverses it
+         const node_ptr f = first(front, back);
+         const node_ptr l = last(front, back);
+         rebase(f, l, front, back, back, front);
+         NodeTraits::set_link(front, addr(back) ^ addr(l));
+         NodeTraits::set_link(back, addr(f) ^ addr(front));
+      }
+   }
+
+   //! <b>Requires</b>: (front1, back1) and (front2, back2) are the sentinels of two lists.
+   //!
+   //! <b>Effects</b>: Swaps the elements of both lists.
+   //!
+   //! <b>Complexity</b>: Constant
+   //!
+   //! <b>Throws</b>: Nothing.
+   static void swap_lists(node_ptr front1, node_ptr back1, node_ptr front2, node_ptr back2) BOOST_NOEXCEPT
+   {
+      const bool empty1 = is_empty(front1);
+      const bool empty2 = is_empty(front2);
+      node_ptr f1 = node_ptr(), l1 = node_ptr(), f2 = node_ptr(), l2 = node_ptr();
+      if(!empty1){
+         f1 = first(front1, back1);
+         l1 = last(front1, back1);
+      }
+      if(!empty2){
+         f2 = first(front2, back2);
+         l2 = last(front2, back2);
+      }
+      init_header(front1, back1);
+      init_header(front2, back2);
+      if(!empty1){
+         rebase(f1, l1, front1, back1, front2, back2);
+         NodeTraits::set_link(front2, addr(back2) ^ addr(f1));
+         NodeTraits::set_link(back2, addr(l1) ^ addr(front2));
+      }
+      if(!empty2){
+         rebase(f2, l2, front2, back2, front1, back1);
+         NodeTraits::set_link(front1, addr(back1) ^ addr(f2));
+         NodeTraits::set_link(back1, addr(l2) ^ addr(front1));
+      }
+   }
+
+   //! <b>Requires</b>: front and back are the sentinels of a list.
+   //!
+   //! <b>Effects</b>: Returns the number of elements of the list.
+   //!
+   //! <b>Complexity</b>: Linear
+   //!
+   //! <b>Throws</b>: Nothing.
+   static std::size_t count(const_node_ptr front, const_node_ptr back) BOOST_NOEXCEPT
+   {
+      std::size_t result = 0;
+      const_node_ptr prev = front;
+      const_node_ptr p = first(front, back);
+      while(p != back){
+         const_node_ptr next = get_next(prev, p);
+         prev = p;
+         p = next;
+         ++result;
+      }
+      return result;
+   }
+};
+
+/// @cond
+
+template<class NodeTraits>
+struct get_algo<XorListAlgorithms, NodeTraits>
+{
+   typedef xor_list_algorithms<NodeTraits> type;
+};
+
+/// @endcond
+
+} //namespace intrusive
+} //namespace boost
+
+#include <boost/intrusive/detail/config_end.hpp>
+
+#endif //BOOST_INTRUSIVE_XOR_LIST_ALGORITHMS_HPP
@@ -0,0 +1,211 @@
+/////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright agent 2026
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/intrusive for documentation.
+//
+/////////////////////////////////////////////////////////////////////////////
+
+//Includes for tests
+#include <boost/intrusive/detail/config_begin.hpp>
+#include <boost/config.hpp>
+#include <iostream>
+#include <cstdlib>
+#include <new>
+#include <boost/intrusive/arena_ptr.hpp>
+#include <boost/intrusive/list.hpp>
+#include <boost/intrusive/slist.hpp>
+#include <boost/intrusive/set.hpp>
+#include <boost/intrusive/avl_set.hpp>
+#include <boost/intrusive/unordered_set.hpp>
+#include <boost/intrusive/pointer_traits.hpp>
+#include <boost/date_time/posix_time/posix_time.hpp>
+
+using namespace boost::posix_time;
+using namespace boost::intrusive;
+
+#ifdef NDEBUG
+const std::size_t NumElem = 1000000;
+#else
+const std::size_t NumElem = 10000;
+#endif
+const std::size_t NumRepeat = 4;
+
+//Values and containers are placed in the same arena for both pointer types,
+//so that the only difference is the size of the hooks.
+template<class VoidPointer>
+struct perf_value
+   :  public list_base_hook< void_pointer<VoidPointer>, link_mode<normal_link> >
+   ,  public slist_base_hook< void_pointer<VoidPointer>, link_mode<normal_link> >
+   ,  public set_base_hook< void_pointer<VoidPointer>, link_mode<normal_link>, optimize_size<true> >
+   ,  public avl_set_base_hook< void_pointer<VoidPointer>, link_mode<normal_link>, optimize_size<true> >
+   ,  public unordered_set_base_hook< void_pointer<VoidPointer>, link_mode<normal_link> >
+{
+   std::size_t i_;
+   friend bool operator <(const perf_value &l, const perf_value &r)  {  return l.i_ < r.i_;  }
+   friend bool operator ==(const perf_value &l, const perf_value &r) {  return l.i_ == r.i_;  }
+   friend std::size_t hash_value(const perf_value &v)                {  return v.i_;  }
+};
+
+class perf_arena
+{
+   public:
+   explicit perf_arena(std::size_t size)
+      :  m_buf(static_cast<char*>(std::malloc(size))), m_size(size), m_used()
+   {  if(!m_buf) std::abort();  }
+
+   ~perf_arena()
+   {  std::free(m_buf);  }
+
+   char *base() const
+   {  return m_buf;  }
+
+   void *allocate(std::size_t size)
+   {
+      const std::size_t a = sizeof(boost::intrusive::detail::max_align);
+      m_used = (m_used + a - 1u) & ~(a - 1u);
+      if(m_size - m_used < size) std::abort();
+      void *p = m_buf + m_used;
+      m_used += size;
+      return p;
+   }
+
+   private:
+   char *m_buf;
+   std::size_t m_size, m_used;
+};
+
+template<class Value>
+Value *make_values(perf_arena &arena)
+{
+   Value *values = static_cast<Value*>(arena.allocate(sizeof(Value)*NumElem));
+   //Pseudo-random permutation of [0, NumElem)
+   for(std::size_t i = 0; i != NumElem; ++i){
+      ::new(&values[i]) Value();
+      values[i].i_ = (i*7919u) % NumElem;
+   }
+   return values;
+}
+
+template<class Container, class Value>
+void test_sequence(Container &c, Value *values, const char *name)
+{
+   ptime tini, tend;
+   std::size_t sum = 0;
+   tini = microsec_clock::universal_time();
+   for(std::size_t repeat = 0; repeat != NumRepeat; ++repeat){
+      c.clear();
+      for(std::size_t i = 0; i != NumElem; ++i){
+         c.push_front(values[i]);
+      }
+   }
+   tend = microsec_clock::universal_time();
+   std::cout << "    " << name << " push_front ns/iter: " << double((tend-tini).total_nanoseconds())/double(NumElem*NumRepeat) << std::endl;
+   tini = microsec_clock::universal_time();
+   for(std::size_t repeat = 0; repeat != NumRepeat; ++repeat){
+      for(typename Container::const_iterator it = c.cbegin(), itend = c.cend(); it != itend; ++it){
+         sum += it->i_;
+      }
+   }
+   tend = microsec_clock::universal_time();
+   std::cout << "    " << name << " traversal ns/iter: " << double((tend-tini).total_nanoseconds())/double(NumElem*NumRepeat) << std::endl;
+   if(sum != NumRepeat*(NumElem*(NumElem-1u)/2u)){
+      std::cout << "    ERROR: traversal not consistent" << std::endl;
+   }
+   c.clear();
+}
+
+template<class Container, class Value>
+void test_associative(Container &c, Value *values, const char *name)
+{
+   ptime tini, tend;
+   tini = microsec_clock::universal_time();
+   for(std::size_t repeat = 0; repeat != NumRepeat; ++repeat){
+      c.clear();
+      for(std::size_t i = 0; i != NumElem; ++i){
+         c.insert(values[i]);
+      }
+   }
+   tend = microsec_clock::universal_time();
+   std::cout << "    " << name << " insert ns/iter: " << double((tend-tini).total_nanoseconds())/double(NumElem*NumRepeat) << std::endl;
+   Value v;
+   std::size_t found = 0;
+   tini = microsec_clock::universal_time();
+   for(std::size_t repeat = 0; repeat != NumRepeat; ++repeat){
+      for(std::size_t i = 0; i != NumElem; ++i){
+         v.i_ = i;
+         found += static_cast<std::size_t>(c.end() != c.find(v));
+      }
+   }
+   tend = microsec_clock::universal_time();
+   std::cout << "    " << name << " search ns/iter: " << double((tend-tini).total_nanoseconds())/double(NumElem*NumRepeat) << std::endl;
+   if(found != NumElem*NumRepeat){
+      std::cout << "    ERROR: all not found (" << found << ") vs. (" << NumElem*NumRepeat << ")" << std::endl;
+   }
+   c.clear();
+}
+
+template<class Container, class Value>
+void test_sequence_in_arena(perf_arena &arena, Value *values, const char *name)
+{
+   Container *c = ::new(arena.allocate(sizeof(Container))) Container();
+   test_sequence(*c, values, name);
+   c->~Container();
+}
+
+template<class Container, class Value>
+void test_associative_in_arena(perf_arena &arena, Value *values, const char *name)
+{
+   Container *c = ::new(arena.allocate(sizeof(Container))) Container();
+   test_associative(*c, values, name);
+   c->~Container();
+}
+
+template<class VoidPointer>
+void test_pointer(perf_arena &arena, const char *pointer_name)
+{
+   typedef perf_value<VoidPointer> value_type;
+   std::cout << "Pointer " << pointer_name << " (value size: " << sizeof(value_type) << " bytes)" << std::endl;
+   value_type *values = make_values<value_type>(arena);
+
+   test_sequence_in_arena< list< value_type, constant_time_size<false> > >(arena, values, "List");
+   test_sequence_in_arena< slist< value_type, constant_time_size<false> > >(arena, values, "Slist");
+   test_associative_in_arena< set< value_type, constant_time_size<false> > >(arena, values, "Set");
+   test_associative_in_arena< avl_set< value_type, constant_time_size<false> > >(arena, values, "AvlSet");
+
+   typedef unordered_set< value_type, power_2_buckets<true> > unordered_set_t;
+   typedef typename unordered_set_t::bucket_type   bucket_type;
+   typedef typename unordered_set_t::bucket_ptr    bucket_ptr;
+   typedef typename unordered_set_t::bucket_traits bucket_traits;
+   std::size_t bucket_count = 1u;
+   while(bucket_count < NumElem) bucket_count <<= 1u;
+   bucket_type *buckets = static_cast<bucket_type*>(arena.allocate(sizeof(bucket_type)*bucket_count));
+   for(std::size_t i = 0; i != bucket_count; ++i){
+      ::new(&buckets[i]) bucket_type();
+   }
+   unordered_set_t *us = ::new(arena.allocate(sizeof(unordered_set_t))) unordered_set_t
+      (bucket_traits(pointer_traits<bucket_ptr>::pointer_to(buckets[0]), bucket_count));
+   test_associative(*us, values, "UnorderedSet");
+   us->~unordered_set_t();
+}
+
+int main()
+{
+   const std::size_t arena_size = NumElem*(sizeof(perf_value<void*>) + 2u*sizeof(void*)) + (1u << 16u);
+   {
+      perf_arena arena(arena_size);
+      test_pointer<void*>(arena, "void*");
+   }
+   {
+      perf_arena arena(arena_size);
+      arena_ptr<void>::set_arena_base(arena.base());
+      test_pointer< arena_ptr<void> >(arena, "arena_ptr<void>");
+   }
+   return 0;
+}
+
+#include <boost/intrusive/detail/config_end.hpp>
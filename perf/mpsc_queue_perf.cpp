@@ -0,0 +1,182 @@
+/////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright agent 2026
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/intrusive for documentation.
+//
+/////////////////////////////////////////////////////////////////////////////
+
+//Includes for tests
+#include <boost/intrusive/detail/config_begin.hpp>
+#include <boost/config.hpp>
+#include <iostream>
+
+#if !defined(BOOST_NO_CXX11_HDR_ATOMIC) && !defined(BOOST_NO_CXX11_HDR_THREAD) && !defined(BOOST_NO_CXX11_LAMBDAS)
+
+#include <vector>
+#include <thread>
+#include <atomic>
+#include <boost/intrusive/mpsc_queue.hpp>
+#include <boost/intrusive/slist.hpp>
+#include <boost/date_time/posix_time/posix_time.hpp>
+
+using namespace boost::posix_time;
+using namespace boost::intrusive;
+
+#ifdef NDEBUG
+const std::size_t NumMessages = 1u << 21u;
+#else
+const std::size_t NumMessages = 1u << 14u;
+#endif
+
+//Messages sent by several producers to the mailbox of an actor
+struct message
+   :  public slist_base_hook< link_mode<normal_link> >
+{
+   std::size_t i_;
+};
+
+typedef slist<message, cache_last<true>, linear<true> > message_slist;
+
+//The mailbox the queue replaces: an slist protected by a spinlock
+class locked_mailbox
+{
+   public:
+   locked_mailbox()
+      :  m_lock(false), m_list()
+   {}
+
+   void push(message &m)
+   {
+      this->lock();
+      m_list.push_back(m);
+      m_lock.store(false, std::memory_order_release);
+   }
+
+   std::size_t pop_all(message_slist &s)
+   {
+      this->lock();
+      s.splice_after(s.before_begin(), m_list);
+      m_lock.store(false, std::memory_order_release);
+      return s.size();
+   }
+
+   private:
+   void lock()
+   {
+      while(m_lock.exchange(true, std::memory_order_acquire))
+         std::this_thread::yield();
+   }
+
+   std::atomic<bool> m_lock;
+   message_slist m_list;
+};
+
+class queue_mailbox
+{
+   public:
+   void push(message &m)
+   {  m_queue.push(m);  }
+
+   std::size_t pop_all(message_slist &s)
+   {  return m_queue.pop_all(s);  }
+
+   private:
+   mpsc_queue<message, base_hook< slist_base_hook< link_mode<normal_link> > > > m_queue;
+};
+
+//The consumer pops messages one by one instead of draining the queue
+class queue_pop_mailbox
+{
+   public:
+   void push(message &m)
+   {  m_queue.push(m);  }
+
+   std::size_t pop_all(message_slist &s)
+   {
+      std::size_t n = 0;
+      while(message *m = m_queue.pop()){
+         s.push_back(*m);
+         ++n;
+      }
+      return n;
+   }
+
+   private:
+   mpsc_queue<message, base_hook< slist_base_hook< link_mode<normal_link> > > > m_queue;
+};
+
+template<class Mailbox>
+void test_mailbox(std::vector<message> &messages, std::size_t num_producers, const char *name)
+{
+   Mailbox mailbox;
+   std::atomic<bool> go(false);
+   std::vector<std::thread> producers;
+   const std::size_t per_producer = NumMessages/num_producers;
+   for(std::size_t t = 0; t != num_producers; ++t){
+      producers.push_back(std::thread([&mailbox, &messages, &go, t, per_producer]{
+         while(!go.load(std::memory_order_acquire))
+            std::this_thread::yield();
+         for(std::size_t i = t*per_producer, e = i + per_producer; i != e; ++i)
+            mailbox.push(messages[i]);
+      }));
+   }
+
+   ptime tini, tend;
+   std::size_t received = 0, sum = 0;
+   message_slist s;
+   tini = microsec_clock::universal_time();
+   go.store(true, std::memory_order_release);
+   while(received != per_producer*num_producers){
+      if(!mailbox.pop_all(s)){
+         std::this_thread::yield();
+         continue;
+      }
+      while(!s.empty()){
+         sum += s.front().i_;
+         s.pop_front();
+         ++received;
+      }
+   }
+   tend = microsec_clock::universal_time();
+   for(std::size_t t = 0; t != num_producers; ++t)
+      producers[t].join();
+
+   std::cout << "    " << name << " ns/message: "
+             << double((tend-tini).total_nanoseconds())/double(received) << std::endl;
+   const std::size_t n = per_producer*num_producers;
+   if(sum != n*(n-1u)/2u){
+      std::cout << "    ERROR: messages not consistent" << std::endl;
+   }
+}
+
+int main()
+{
+   std::vector<message> messages(NumMessages);
+   for(std::size_t i = 0; i != NumMessages; ++i)
+      messages[i].i_ = i;
+
+   for(std::size_t p = 1u; p <= 64u; p *= 2u){
+      std::cout << "Producers: " << p << std::endl;
+      test_mailbox<locked_mailbox>(messages, p, "Spinlocked slist");
+      test_mailbox<queue_mailbox>(messages, p, "mpsc_queue pop_all");
+      test_mailbox<queue_pop_mailbox>(messages, p, "mpsc_queue pop");
+   }
+   return 0;
+}
+
+#else
+
+int main()
+{
+   std::cout << "Threads not supported" << std::endl;
+   return 0;
+}
+
+#endif
+
+#include <boost/intrusive/detail/config_end.hpp>
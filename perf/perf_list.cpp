@@ -16,7 +16,9 @@
 #include <list>
 #include <functional>
 #include <iostream>
+#include <cstdlib>
 #include <boost/intrusive/list.hpp>
+#include <boost/intrusive/prefetch_iterator.hpp>
 #include <boost/date_time/posix_time/posix_time.hpp>
 
 using namespace boost::posix_time;
@@ -497,6 +499,61 @@ void test_disperse_std_ptrlist_write_access()
 }
 //]
 
+////////////////////////////////////////////////////////////////////////
+//
+//                            SCATTERED SCAN
+//
+////////////////////////////////////////////////////////////////////////
+
+//Elements of large scans, linked in random order so that
+//each node is a cache miss
+const int NumScanElements = 2000000;
+
+struct increment_value
+{
+   template<class T>
+   void operator()(T &t) const
+   {  ++t.i_;  }
+};
+
+template <bool BigSize, std::size_t Distance>
+void test_intrusive_list_scattered_scan()
+{
+   typedef typename get_ilist<BigSize, normal_link>::type ilist;
+
+   //Link the elements in random order
+   std::vector<typename ilist::value_type> objects(NumScanElements);
+   std::vector<int> order(NumScanElements);
+   for(int i = 0; i < NumScanElements; ++i){
+      objects[i].i_ = i;
+      order[i] = i;
+   }
+   for(int i = NumScanElements - 1; i > 0; --i){
+      const int j = std::rand() % (i + 1);
+      const int tmp = order[i]; order[i] = order[j]; order[j] = tmp;
+   }
+   ilist l;
+   for(int i = 0; i < NumScanElements; ++i)
+      l.push_back(objects[order[i]]);
+
+   ptime tini = microsec_clock::universal_time();
+   for(int i = 0; i < NumIter; ++i){
+      if(Distance == 0u){
+         typename ilist::iterator it(l.begin()), end(l.end());
+         for(; it != end; ++it){
+            ++(it->i_);
+         }
+      }
+      else{
+         for_each_prefetched<Distance ? Distance : 1u>(l, increment_value());
+      }
+   }
+   ptime tend = microsec_clock::universal_time();
+   std::cout << "prefetch distance: " << Distance << ", usecs/iteration: "
+             << (tend-tini).total_microseconds()/NumIter << std::endl;
+   l.clear();
+}
+
 ////////////////////////////////////////////////////////////////////////
 //
 //                            ALL TESTS
@@ -536,6 +593,11 @@ void do_all_tests()
    test_std_list_write_access<BigSize>();
    test_compact_std_ptrlist_write_access<BigSize>();
    test_disperse_std_ptrlist_write_access<BigSize>();
+   //scattered scan
+   std::cout << "\n\nTesting scattered scan with BigSize:" << BigSize << std::endl;
+   test_intrusive_list_scattered_scan<BigSize, 0>();
+   test_intrusive_list_scattered_scan<BigSize, 4>();
+   test_intrusive_list_scattered_scan<BigSize, 16>();
 }
 
 int main()
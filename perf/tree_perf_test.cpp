@@ -18,6 +18,7 @@
 #include <boost/intrusive/set.hpp>
 #include <boost/intrusive/sg_set.hpp>
 #include <boost/intrusive/avl_set.hpp>
+#include <boost/intrusive/frozen_set.hpp>
 #include <boost/date_time/posix_time/posix_time.hpp>
 #include <cstdlib>
 
@@ -135,6 +136,183 @@ void test_insertion(Container &c, const char *ContainerName, InsertionType inser
 }
 
 
+//Extracts the integer key of test objects
+struct key_of_test_class
+{
+   typedef std::size_t type;
+
+   template<class T>
+   const std::size_t &operator()(const T &t) const
+   {  return t.i_;  }
+};
+
+//Same ordering as std::less<std::size_t>, but not detected as a cheap
+//comparison, so tree descents use the general algorithm
+struct opaque_less
+{
+   bool operator()(std::size_t l, std::size_t r) const
+   {  return l < r;  }
+};
+
+template<class Container>
+void fill_search_keys( Container &c, std::vector<typename Container::value_type> &values
+                     , std::vector<std::size_t> &keys)
+{
+   values.resize(NumElem);
+   fill_vector(values, Random);
+   c.insert(values.begin(), values.end());
+   //Search keys in random order so that descents take unpredictable paths
+   keys.resize(NumElem);
+   for(std::size_t i = 0, max = keys.size(); i != max; ++i){
+      keys[i] = values[i].i_;
+   }
+   std::random_shuffle(keys.begin(), keys.end());
+}
+
+template<class Lookup>
+void time_lower_bound(const Lookup &l, const std::vector<std::size_t> &keys)
+{
+   ptime tini, tend;
+   tini = microsec_clock::universal_time();
+   for( std::size_t repeat = 0, repeat_max = NumRepeat
+      ; repeat != repeat_max
+      ; ++repeat){
+      std::size_t found = 0;
+      for( std::size_t i = 0, max = keys.size()
+         ; i != max
+         ; ++i){
+            found += static_cast<std::size_t>(l.lower_bound(keys[i])->i_ == keys[i]);
+      }
+      if(found != NumElem){
+         std::cout << "    ERROR: all not found (" << found << ") vs. (" << NumElem << ")" << std::endl;
+      }
+   }
+   tend = microsec_clock::universal_time();
+   std::cout << "    Lower bound ns/iter: " << double((tend-tini).total_nanoseconds())/double(NumElem*NumRepeat) << std::endl;
+}
+
+template<class Container>
+void test_key_search(Container &c, const char *ContainerName)
+{
+   std::cout << "Container " << ContainerName << std::endl;
+   std::vector<std::size_t> keys;
+   std::vector<typename Container::value_type> values;
+   fill_search_keys(c, values, keys);
+   time_lower_bound(c, keys);
+   c.clear();
+}
+
+template<class Container, bool CacheKeys>
+void test_frozen_search(Container &c, const char *ContainerName)
+{
+   std::cout << "Container " << ContainerName << std::endl;
+   typedef frozen_set<Container, CacheKeys> frozen_t;
+   std::vector<std::size_t> keys;
+   std::vector<typename Container::value_type> values;
+   fill_search_keys(c, values, keys);
+   std::vector<typename frozen_t::entry_type> entries(c.size());
+   frozen_t f(c, entries.data(), entries.size());
+   time_lower_bound(f, keys);
+   c.clear();
+}
+
+void test_branchless_search()
+{
+   {
+      typedef set_base_hook< link_mode<normal_link> > SetHook;
+      typedef set< itest_class<false, SetHook>, key_of_value<key_of_test_class>, compare<opaque_less> > Set;
+      Set c;
+      test_key_search(c, "Set(opaque comparison)");
+   }
+   {
+      typedef set_base_hook< link_mode<normal_link> > SetHook;
+      typedef set< itest_class<false, SetHook>, key_of_value<key_of_test_class> > Set;
+      Set c;
+      test_key_search(c, "Set(branch-free std::less)");
+   }
+   {
+      typedef avl_set_base_hook< link_mode<normal_link> > AvlSetHook;
+      typedef avl_set< itest_class<false, AvlSetHook>, key_of_value<key_of_test_class>, compare<opaque_less> > AvlSet;
+      AvlSet c;
+      test_key_search(c, "AvlSet(opaque comparison)");
+   }
+   {
+      typedef avl_set_base_hook< link_mode<normal_link> > AvlSetHook;
+      typedef avl_set< itest_class<false, AvlSetHook>, key_of_value<key_of_test_class> > AvlSet;
+      AvlSet c;
+      test_key_search(c, "AvlSet(branch-free std::less)");
+   }
+   {
+      typedef set_base_hook< link_mode<normal_link> > SetHook;
+      typedef set< itest_class<false, SetHook>, key_of_value<key_of_test_class> > Set;
+      Set c;
+      test_frozen_search<Set, false>(c, "frozen_set<Set>");
+      test_frozen_search<Set, true>(c, "frozen_set<Set>(cached keys)");
+   }
+}
+
+//Erases ranges of RangeSize consecutive elements starting at random keys,
+//node by node and with a single range erasure
+template<class Container>
+void test_range_erasure(Container &c, const char *ContainerName)
+{
+   const std::size_t RangeSize = 1000;
+   std::cout << "Container " << ContainerName << std::endl;
+   std::vector<typename Container::value_type> values(NumElem);
+   fill_vector(values, Random);
+   std::vector<std::size_t> keys(NumElem/RangeSize/2);
+   for(std::size_t i = 0; i != keys.size(); ++i)
+      keys[i] = std::size_t(std::rand()) % NumElem;
+
+   for(std::size_t by_range = 0; by_range != 2; ++by_range){
+      c.insert(values.begin(), values.end());
+      std::size_t erased = 0;
+      ptime tini = microsec_clock::universal_time();
+      for(std::size_t i = 0; i != keys.size(); ++i){
+         typename Container::value_type key;
+         key.i_ = keys[i];
+         typename Container::iterator b(c.lower_bound(key)), e(b);
+         std::size_t n = 0;
+         for(; n != RangeSize && e != c.end(); ++n)
+            ++e;
+         if(by_range){
+            c.erase(b, e);
+         }
+         else{
+            while(b != e)
+               c.erase(b++);
+         }
+         erased += n;
+      }
+      ptime tend = microsec_clock::universal_time();
+      std::cout << (by_range ? "    Range erase" : "    Node by node erase")
+                << " ns/elem: " << double((tend-tini).total_nanoseconds())/double(erased) << std::endl;
+      c.clear();
+   }
+}
+
+void test_range_erase()
+{
+   {
+      typedef set_base_hook< link_mode<normal_link> > SetHook;
+      typedef set< itest_class<true, SetHook> > Set;
+      Set c;
+      test_range_erasure(c, "Set");
+   }
+   {
+      typedef avl_set_base_hook< link_mode<normal_link> > AvlSetHook;
+      typedef avl_set< itest_class<true, AvlSetHook> > AvlSet;
+      AvlSet c;
+      test_range_erasure(c, "AvlSet");
+   }
+   {
+      typedef bs_set_base_hook< link_mode<normal_link> > BsSetHook;
+      typedef sg_set< itest_class<true, BsSetHook> > SgSet;
+      SgSet c;
+      test_range_erasure(c, "SgSet(alpha 0.7)");
+   }
+}
+
 void test_insert_search(InsertionType insertion_type)
 {
    {
@@ -208,6 +386,14 @@ int main()
    std::cout << "----------------\n\n";
    test_insert_search(Random);
    std::cout << "----------------\n\n";
+   std::cout << "RANDOM KEY LOWER BOUND\n";
+   std::cout << "----------------\n\n";
+   test_branchless_search();
+   std::cout << "----------------\n\n";
+   std::cout << "RANGE ERASURE\n";
+   std::cout << "----------------\n\n";
+   test_range_erase();
+   std::cout << "----------------\n\n";
    return 0;
 }
 
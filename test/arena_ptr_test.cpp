@@ -0,0 +1,228 @@
+/////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright agent 2026
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/intrusive for documentation.
+//
+/////////////////////////////////////////////////////////////////////////////
+#include <boost/intrusive/arena_ptr.hpp>
+#include <boost/intrusive/list.hpp>
+#include <boost/intrusive/slist.hpp>
+#include <boost/intrusive/set.hpp>
+#include <boost/intrusive/avl_set.hpp>
+#include <boost/intrusive/unordered_set.hpp>
+#include <boost/intrusive/pointer_traits.hpp>
+#include <boost/container_hash/hash.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <new>
+
+using namespace boost::intrusive;
+
+typedef arena_ptr<void> void_ptr;
+typedef void_pointer<void_ptr> void_ptr_opt;
+
+//All the objects addressed by arena pointers (values and also containers, as they
+//hold header nodes, and bucket arrays) must live in the arena.
+union arena_storage
+{
+   detail::max_align align_;
+   char buf_[1u << 20u];
+};
+
+static arena_storage arena;
+static std::size_t arena_used;
+
+void *arena_allocate(std::size_t size)
+{
+   const std::size_t a = void_ptr::null_gap;
+   arena_used = (arena_used + a - 1u) & ~(a - 1u);
+   BOOST_TEST(arena_used + size <= sizeof(arena.buf_));
+   void *p = &arena.buf_[arena_used];
+   arena_used += size;
+   return p;
+}
+
+template<class T>
+T *arena_new()
+{  return ::new(arena_allocate(sizeof(T))) T();  }
+
+class arena_value
+   : public list_base_hook<void_ptr_opt>
+   , public slist_base_hook<void_ptr_opt>
+   , public set_base_hook<void_ptr_opt, optimize_size<true> >
+   , public avl_set_base_hook<void_ptr_opt, optimize_size<true> >
+   , public unordered_set_base_hook<void_ptr_opt>
+{
+   public:
+   int value_;
+
+   arena_value() : value_() {}
+
+   friend bool operator<(const arena_value &a, const arena_value &b)
+   {  return a.value_ < b.value_;  }
+
+   friend bool operator==(const arena_value &a, const arena_value &b)
+   {  return a.value_ == b.value_;  }
+
+   friend std::size_t hash_value(const arena_value &v)
+   {  return boost::hash<int>()(v.value_);  }
+};
+
+typedef list<arena_value>           list_t;
+typedef slist<arena_value>          slist_t;
+typedef set<arena_value>            set_t;
+typedef avl_set<arena_value>        avl_set_t;
+typedef unordered_set<arena_value>  unordered_set_t;
+
+void test_pointer()
+{
+   typedef arena_ptr<int>        int_ptr;
+   typedef arena_ptr<const int>  cint_ptr;
+
+   BOOST_TEST_EQ(sizeof(void_ptr), 4u);
+   BOOST_TEST_EQ(void_ptr::arena_base(), static_cast<void*>(&arena));
+   BOOST_TEST(!void_ptr());
+
+   int *ints = arena_new<int>();
+   arena_new<int>();
+   int_ptr p(ints);
+   BOOST_TEST(p.get() == ints);
+   BOOST_TEST(p.get_offset() != 0u);
+   BOOST_TEST(int_ptr(0).get() == 0);
+
+   //Conversions and castings
+   void_ptr vp(p);
+   BOOST_TEST(vp.get() == static_cast<void*>(ints));
+   BOOST_TEST(pointer_traits<int_ptr>::static_cast_from(vp) == p);
+   cint_ptr cp(p);
+   BOOST_TEST(pointer_traits<int_ptr>::const_cast_from(cp) == p);
+   BOOST_TEST(pointer_traits<int_ptr>::pointer_to(*ints) == p);
+
+   //Arithmetic and ordering
+   int_ptr p1 = p + 1;
+   BOOST_TEST(p1.get() == ints + 1);
+   BOOST_TEST_EQ(p1 - p, 1);
+   BOOST_TEST(p < p1);
+   BOOST_TEST(++int_ptr(p) == p1);
+   BOOST_TEST(--int_ptr(p1) == p);
+
+   //Embedded bits
+   typedef pointer_plus_bits<int_ptr, 2> ppb;
+   BOOST_TEST((max_pointer_plus_bits<void_ptr, 4u>::value == 2u));
+   int_ptr n(p);
+   ppb::set_bits(n, 3u);
+   BOOST_TEST_EQ(ppb::get_bits(n), 3u);
+   BOOST_TEST(ppb::get_pointer(n) == p);
+   ppb::set_pointer(n, int_ptr());
+   BOOST_TEST_EQ(ppb::get_bits(n), 3u);
+   BOOST_TEST(!ppb::get_pointer(n));
+}
+
+void test_hook_sizes()
+{
+   //Hooks are half the size of the raw pointer ones
+   BOOST_TEST_EQ(sizeof(list_base_hook<void_ptr_opt>), 2u*sizeof(boost::uint32_t));
+   BOOST_TEST_EQ(sizeof(slist_base_hook<void_ptr_opt>), sizeof(boost::uint32_t));
+   BOOST_TEST_EQ((sizeof(set_base_hook<void_ptr_opt, optimize_size<true> >)), 3u*sizeof(boost::uint32_t));
+   BOOST_TEST_EQ((sizeof(avl_set_base_hook<void_ptr_opt, optimize_size<true> >)), 3u*sizeof(boost::uint32_t));
+   BOOST_TEST_EQ(sizeof(unordered_set_base_hook<void_ptr_opt>), sizeof(boost::uint32_t));
+}
+
+template<class Container>
+void test_sequence(Container &c, arena_value **values, int n)
+{
+   for(int i = 0; i != n; ++i){
+      c.push_front(*values[i]);
+   }
+   BOOST_TEST_EQ(c.size(), std::size_t(n));
+   typename Container::iterator it = c.begin();
+   for(int i = n; i != 0; --i, ++it){
+      BOOST_TEST(&*it == values[i-1]);
+   }
+   BOOST_TEST(it == c.end());
+   BOOST_TEST(c.iterator_to(*values[n/2]) != c.end());
+   BOOST_TEST(&*c.iterator_to(*values[n/2]) == values[n/2]);
+   c.pop_front();
+   BOOST_TEST_EQ(c.size(), std::size_t(n - 1));
+   c.clear();
+   BOOST_TEST(c.empty());
+}
+
+template<class Container>
+void test_associative(Container &c, arena_value **values, int n)
+{
+   for(int i = 0; i != n; ++i){
+      BOOST_TEST(c.insert(*values[i]).second);
+   }
+   BOOST_TEST_EQ(c.size(), std::size_t(n));
+   for(int i = 0; i != n; ++i){
+      typename Container::iterator it = c.find(*values[i]);
+      BOOST_TEST(it != c.end() && &*it == values[i]);
+      BOOST_TEST(c.iterator_to(*values[i]) == it);
+   }
+   for(int i = 0; i < n; i += 2){
+      BOOST_TEST_EQ(c.erase(*values[i]), 1u);
+   }
+   BOOST_TEST_EQ(c.size(), std::size_t(n/2));
+   for(int i = 0; i != n; ++i){
+      BOOST_TEST_EQ(c.count(*values[i]), std::size_t(i % 2));
+   }
+   c.clear();
+   BOOST_TEST(c.empty());
+}
+
+template<class Container>
+void test_ordered(Container &c, arena_value **values, int n)
+{
+   test_associative(c, values, n);
+   for(int i = 0; i != n; ++i){
+      c.insert(*values[i]);
+   }
+   int expected = 0;
+   for(typename Container::iterator it = c.begin(); it != c.end(); ++it, ++expected){
+      BOOST_TEST_EQ(it->value_, expected);
+   }
+   BOOST_TEST_EQ(expected, n);
+   c.clear();
+}
+
+void test_containers()
+{
+   const int N = 200;
+   arena_value *values[N];
+   for(int i = 0; i != N; ++i){
+      values[i] = arena_new<arena_value>();
+      values[i]->value_ = (i*7) % N;
+   }
+
+   test_sequence(*arena_new<list_t>(), values, N);
+   test_sequence(*arena_new<slist_t>(), values, N);
+   test_ordered(*arena_new<set_t>(), values, N);
+   test_ordered(*arena_new<avl_set_t>(), values, N);
+
+   typedef unordered_set_t::bucket_type   bucket_type;
+   typedef unordered_set_t::bucket_ptr    bucket_ptr;
+   typedef unordered_set_t::bucket_traits bucket_traits;
+   const std::size_t bucket_count = 64u;
+   bucket_type *buckets = static_cast<bucket_type*>(arena_allocate(sizeof(bucket_type)*bucket_count));
+   for(std::size_t i = 0; i != bucket_count; ++i){
+      ::new(&buckets[i]) bucket_type();
+   }
+   unordered_set_t *us = ::new(arena_allocate(sizeof(unordered_set_t))) unordered_set_t
+      (bucket_traits(pointer_traits<bucket_ptr>::pointer_to(buckets[0]), bucket_count));
+   test_associative(*us, values, N);
+   us->~unordered_set_t();
+}
+
+int main()
+{
+   void_ptr::set_arena_base(&arena);
+   test_pointer();
+   test_hook_sizes();
+   test_containers();
+   return boost::report_errors();
+}
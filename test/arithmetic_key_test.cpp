@@ -0,0 +1,145 @@
+/////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright agent 2026
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/intrusive for documentation.
+//
+/////////////////////////////////////////////////////////////////////////////
+#include <boost/intrusive/set.hpp>
+#include <boost/intrusive/avl_set.hpp>
+#include <boost/intrusive/sg_set.hpp>
+#include <boost/intrusive/splay_set.hpp>
+#include <boost/intrusive/treap_set.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <algorithm>
+#include <functional>
+#include <vector>
+
+using namespace boost::intrusive;
+
+//Lookups in trees with arithmetic keys compared with std::less
+//use a branch-free descent. Results must match the general descent.
+
+template<class Key>
+struct arith_value
+   : public set_base_hook<>
+   , public avl_set_base_hook<>
+   , public bs_set_base_hook<>
+{
+   Key key_;
+   explicit arith_value(Key k = Key()) : key_(k) {}
+};
+
+template<class Key>
+struct key_of_arith_value
+{
+   typedef Key type;
+
+   const Key &operator()(const arith_value<Key> &v) const
+   {  return v.key_;  }
+};
+
+template<class Key>
+struct priority_of_arith_value
+{
+   typedef Key type;
+
+   Key operator()(const arith_value<Key> &v) const
+   {  return Key(v.key_ * 7);  }
+};
+
+template<class Key>
+struct other_less
+{
+   bool operator()(const Key &a, const Key &b) const
+   {  return a < b;  }
+};
+
+template<class Tree>
+void test_lookups(Tree &t, const std::vector<typename Tree::key_type> &sorted_keys)
+{
+   typedef typename Tree::key_type  key_type;
+   typedef typename Tree::iterator  iterator;
+   typedef typename std::vector<key_type>::const_iterator vit;
+   //Probe existing keys and keys in the gaps
+   const key_type lo = sorted_keys.front() - key_type(2);
+   const key_type hi = sorted_keys.back() + key_type(2);
+   for(key_type k = lo; k <= hi; k = k + key_type(1)){
+      const vit vlb = std::lower_bound(sorted_keys.begin(), sorted_keys.end(), k);
+      const vit vub = std::upper_bound(sorted_keys.begin(), sorted_keys.end(), k);
+      const iterator lb = t.lower_bound(k);
+      const iterator ub = t.upper_bound(k);
+      BOOST_TEST(vlb == sorted_keys.end() ? lb == t.end() : (lb != t.end() && lb->key_ == *vlb));
+      BOOST_TEST(vub == sorted_keys.end() ? ub == t.end() : (ub != t.end() && ub->key_ == *vub));
+      BOOST_TEST_EQ(t.count(k), std::size_t(vub - vlb));
+      std::pair<iterator, iterator> er = t.equal_range(k);
+      BOOST_TEST(er.first == lb && er.second == ub);
+      BOOST_TEST((t.find(k) != t.end()) == (vlb != vub));
+      std::pair<iterator, iterator> br = t.bounded_range(k, k + key_type(3), true, false);
+      BOOST_TEST(br.first == lb);
+      BOOST_TEST(br.second == t.lower_bound(k + key_type(3)));
+   }
+}
+
+template<class Tree>
+void test_tree(bool multi)
+{
+   typedef typename Tree::key_type key_type;
+   typedef typename Tree::value_type value_type;
+   std::vector<value_type> values;
+   std::vector<key_type> keys;
+   const int N = 101;
+   for(int i = 0; i != N; ++i){
+      //Even keys, repeated three times for multi-containers
+      const key_type k = key_type((i*37) % N * 2 + 10);
+      values.push_back(value_type(k));
+      if(multi){
+         values.push_back(value_type(k));
+         values.push_back(value_type(k));
+      }
+   }
+   Tree t(values.begin(), values.end());
+   for(typename Tree::iterator it = t.begin(); it != t.end(); ++it){
+      BOOST_TEST(keys.empty() || !(it->key_ < keys.back()));
+      keys.push_back(it->key_);
+   }
+   BOOST_TEST_EQ(keys.size(), values.size());
+   test_lookups(t, keys);
+   t.clear();
+}
+
+template<class Key>
+void test_key()
+{
+   typedef arith_value<Key> value_t;
+   typedef key_of_value< key_of_arith_value<Key> > kov;
+   typedef base_hook< bs_set_base_hook<> > bs_hook;
+
+   //std::less selects the branch-free descent, other comparators don't
+   typedef multiset<value_t, kov> fast_multiset_t;
+   typedef multiset<value_t, kov, compare< other_less<Key> > > slow_multiset_t;
+   BOOST_TEST((detail::is_branchless_nodeptr_comp< detail::key_nodeptr_comp
+      < std::less<Key>, typename fast_multiset_t::value_traits, key_of_arith_value<Key> > >::value));
+   BOOST_TEST((!detail::is_branchless_nodeptr_comp< detail::key_nodeptr_comp
+      < other_less<Key>, typename slow_multiset_t::value_traits, key_of_arith_value<Key> > >::value));
+
+   test_tree< set<value_t, kov> >(false);
+   test_tree< fast_multiset_t >(true);
+   test_tree< slow_multiset_t >(true);
+   test_tree< avl_multiset<value_t, kov> >(true);
+   test_tree< sg_multiset<value_t, kov, bs_hook> >(true);
+   test_tree< splay_multiset<value_t, kov, bs_hook> >(true);
+   test_tree< treap_multiset<value_t, kov, bs_hook, priority_of_value< priority_of_arith_value<Key> > > >(true);
+}
+
+int main()
+{
+   test_key<int>();
+   test_key<unsigned long>();
+   test_key<double>();
+   return boost::report_errors();
+}
@@ -0,0 +1,220 @@
+/////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright agent 2026
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/intrusive for documentation.
+//
+/////////////////////////////////////////////////////////////////////////////
+#include <boost/intrusive/set.hpp>
+#include <boost/intrusive/avl_set.hpp>
+#include <boost/intrusive/sg_set.hpp>
+#include <boost/intrusive/treap_set.hpp>
+#include <boost/intrusive/splay_set.hpp>
+#include <boost/intrusive/bs_set.hpp>
+#include <boost/intrusive/list.hpp>
+#include <boost/intrusive/slist.hpp>
+#include <boost/intrusive/unordered_set.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include "smart_ptr.hpp"
+#include <cstdlib>
+#include <cstddef>
+#include <vector>
+
+using namespace boost::intrusive;
+
+template<class Hook>
+struct teardown_value
+   : public Hook
+{
+   int value_;
+   int disposed_;
+
+   explicit teardown_value(int v = 0)
+      : value_(v), disposed_(0)
+   {}
+
+   friend bool operator <(const teardown_value &a, const teardown_value &b)
+   {  return a.value_ < b.value_;  }
+
+   friend bool operator ==(const teardown_value &a, const teardown_value &b)
+   {  return a.value_ == b.value_;  }
+
+   friend std::size_t hash_value(const teardown_value &v)
+   {  return std::size_t(v.value_);  }
+
+   friend bool priority_order(const teardown_value &a, const teardown_value &b)
+   {  return (unsigned(a.value_)*2654435761u) < (unsigned(b.value_)*2654435761u);  }
+};
+
+struct count_disposer
+{
+   explicit count_disposer(std::size_t *count)
+      : count_(count)
+   {}
+
+   template<class P>
+   void operator()(P p)
+   {  ++p->disposed_; ++*count_;  }
+
+   std::size_t *count_;
+};
+
+struct tree_inserter
+{
+   template<class C, class V>
+   static void insert(C &c, V &v)
+   {  c.insert(v);  }
+
+   //A partially cleared tree can only be passed to more destruction calls
+   template<class C>
+   static void check_partial(const C &, std::size_t)
+   {}
+};
+
+struct sequence_inserter
+{
+   template<class C, class V>
+   static void insert(C &c, V &v)
+   {  c.push_front(v);  }
+
+   template<class C>
+   static void check_partial(const C &c, std::size_t size)
+   {  c.check();  BOOST_TEST_EQ(c.size(), size);  }
+};
+
+struct hash_inserter
+{
+   template<class C, class V>
+   static void insert(C &c, V &v)
+   {  c.insert(v);  }
+
+   template<class C>
+   static void check_partial(const C &c, std::size_t size)
+   {  c.check();  BOOST_TEST_EQ(c.size(), size);  }
+};
+
+template<class Inserter, class Container>
+void test_clear_some(Container &c, std::size_t size, std::size_t budget, int dup)
+{
+   typedef typename Container::value_type value_type;
+   std::vector<value_type> values;
+   values.reserve(size);
+   for(std::size_t i = 0; i != size; ++i)
+      values.push_back(value_type(int(i)/dup));
+   for(std::size_t i = 0; i != size; ++i)
+      Inserter::insert(c, values[(i*7919u) % size]);
+   BOOST_TEST_EQ(c.size(), size);
+
+   std::size_t disposed = 0, calls = 0;
+   bool empty = false;
+   while(!empty){
+      const std::size_t before = disposed;
+      empty = c.clear_and_dispose_some(count_disposer(&disposed), budget);
+      ++calls;
+      BOOST_TEST(disposed - before <= budget);
+      //Disposes exactly the budget until the container is empty
+      BOOST_TEST(empty || disposed - before == budget);
+      BOOST_TEST_EQ(empty, disposed == size);
+      if(!empty)
+         Inserter::check_partial(c, size - disposed);
+   }
+   BOOST_TEST_EQ(disposed, size);
+   BOOST_TEST_EQ(calls, size ? (size + budget - 1)/budget : 1u);
+   BOOST_TEST(c.empty());
+   for(std::size_t i = 0; i != size; ++i){
+      BOOST_TEST_EQ(values[i].disposed_, 1);
+      BOOST_TEST(!values[i].is_linked());
+   }
+   //An empty container and a zero budget
+   BOOST_TEST(c.clear_and_dispose_some(count_disposer(&disposed), 0u));
+   if(size){
+      Inserter::insert(c, values[0]);
+      BOOST_TEST(!c.clear_and_dispose_some(count_disposer(&disposed), 0u));
+      BOOST_TEST_EQ(c.size(), 1u);
+   }
+   //The container is usable again
+   c.check();
+   c.clear();
+}
+
+template<class Inserter, class Container>
+void test_container(Container &c, int dup)
+{
+   const std::size_t sizes[] = { 0, 1, 2, 10, 100, 1000 };
+   const std::size_t budgets[] = { 1, 3, 64, 1000, 100000 };
+   for(std::size_t i = 0; i != sizeof(sizes)/sizeof(sizes[0]); ++i){
+      for(std::size_t j = 0; j != sizeof(budgets)/sizeof(budgets[0]); ++j){
+         test_clear_some<Inserter>(c, sizes[i], budgets[j], dup);
+      }
+   }
+}
+
+template<class Tree>
+void test_tree(int dup)
+{
+   Tree t;
+   test_container<tree_inserter>(t, dup);
+}
+
+template<class Sequence>
+void test_sequence()
+{
+   Sequence s;
+   test_container<sequence_inserter>(s, 1);
+}
+
+template<class Unordered>
+void test_unordered(int dup)
+{
+   typedef typename Unordered::bucket_type    bucket_type;
+   typedef typename Unordered::bucket_traits  bucket_traits;
+   typedef typename Unordered::bucket_ptr     bucket_ptr;
+   std::vector<bucket_type> buckets(127);
+   Unordered u(bucket_traits(pointer_traits<bucket_ptr>::pointer_to(buckets[0]), buckets.size()));
+   test_container<hash_inserter>(u, dup);
+}
+
+template<class VoidPointer>
+void test_all()
+{
+   typedef teardown_value< set_base_hook< void_pointer<VoidPointer> > >     rb_value;
+   typedef teardown_value< avl_set_base_hook< void_pointer<VoidPointer> > > avl_value;
+   typedef teardown_value< bs_set_base_hook< void_pointer<VoidPointer> > >  bs_value;
+   typedef teardown_value< list_base_hook< void_pointer<VoidPointer> > >    list_value;
+   typedef teardown_value< slist_base_hook< void_pointer<VoidPointer> > >   slist_value;
+   typedef teardown_value< unordered_set_base_hook< void_pointer<VoidPointer> > > hash_value;
+   typedef teardown_value< unordered_set_base_hook< void_pointer<VoidPointer>
+                                                  , optimize_multikey<true>
+                                                  , store_hash<true> > >    multikey_value;
+
+   test_tree< set<rb_value> >(1);
+   test_tree< multiset<rb_value, constant_time_size<false> > >(4);
+   test_tree< avl_multiset<avl_value> >(4);
+   test_tree< sg_set<bs_value> >(1);
+   test_tree< sg_multiset<bs_value, incremental_rebuild<true> > >(4);
+   test_tree< treap_multiset<bs_value> >(4);
+   test_tree< splay_multiset<bs_value> >(4);
+   test_tree< bs_multiset<bs_value> >(4);
+
+   test_sequence< list<list_value> >();
+   test_sequence< list<list_value, constant_time_size<false> > >();
+   test_sequence< slist<slist_value> >();
+   test_sequence< slist<slist_value, cache_last<true> > >();
+   test_sequence< slist<slist_value, constant_time_size<false> > >();
+
+   test_unordered< unordered_set<hash_value> >(1);
+   test_unordered< unordered_set<hash_value, cache_begin<true>, constant_time_size<false> > >(1);
+   test_unordered< unordered_multiset<multikey_value> >(4);
+   test_unordered< unordered_multiset<multikey_value, cache_begin<true> > >(4);
+}
+
+int main()
+{
+   test_all<void*>();
+   test_all<boost::intrusive::smart_ptr<void> >();
+   return boost::report_errors();
+}
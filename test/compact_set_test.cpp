@@ -0,0 +1,243 @@
+/////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright agent 2026
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/intrusive for documentation.
+//
+/////////////////////////////////////////////////////////////////////////////
+#include <boost/intrusive/compact_set.hpp>
+#include <boost/intrusive/set_hook.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include "smart_ptr.hpp"
+#include <cstdlib>
+#include <set>
+#include <vector>
+
+using namespace boost::intrusive;
+
+template<class VoidPointer, link_mode_type LinkMode>
+struct compact_value
+   : public compact_set_base_hook< void_pointer<VoidPointer>, link_mode<LinkMode> >
+{
+   compact_set_member_hook< void_pointer<VoidPointer>, link_mode<LinkMode> > node_;
+   int value_;
+
+   explicit compact_value(int v = 0)
+      : value_(v)
+   {}
+
+   friend bool operator <(const compact_value &a, const compact_value &b)
+   {  return a.value_ < b.value_;  }
+
+   friend bool operator ==(const compact_value &a, const compact_value &b)
+   {  return a.value_ == b.value_;  }
+};
+
+struct int_key
+{
+   typedef int type;
+
+   template<class V>
+   const int &operator()(const V &v) const
+   {  return v.value_;  }
+};
+
+struct delete_disposer
+{
+   template<class P>
+   void operator()(P p)
+   {  delete &*p;  }
+};
+
+struct new_cloner
+{
+   template<class V>
+   V *operator()(const V &v)
+   {  return new V(v);  }
+};
+
+template<class Set>
+void test_against_std_set(std::vector<typename Set::value_type> &values)
+{
+   typedef typename Set::iterator iterator;
+   typedef typename Set::const_iterator const_iterator;
+   const std::size_t n = values.size();
+   Set s;
+   std::set<int> ref;
+
+   //Random insertions including duplicates (distinct objects with the same key)
+   typename Set::value_type duplicate;
+   for(std::size_t i = 0; i != n; ++i){
+      std::size_t pos = std::size_t(std::rand()) % n;
+      const bool inserted = ref.insert(values[pos].value_).second;
+      duplicate.value_ = values[pos].value_;
+      std::pair<iterator, bool> r = s.insert(inserted ? values[pos] : duplicate);
+      BOOST_TEST(r.second == inserted);
+      BOOST_TEST(&*r.first == &values[pos]);
+   }
+   s.check();
+   BOOST_TEST_EQ(s.size(), ref.size());
+
+   //Forward and backward traversal
+   {
+      std::set<int>::const_iterator rit = ref.begin();
+      for(const_iterator it = s.cbegin(), itend = s.cend(); it != itend; ++it, ++rit){
+         BOOST_TEST_EQ(it->value_, *rit);
+      }
+      std::set<int>::const_reverse_iterator rrit = ref.rbegin();
+      for(typename Set::const_reverse_iterator it = s.crbegin(), itend = s.crend(); it != itend; ++it, ++rrit){
+         BOOST_TEST_EQ(it->value_, *rrit);
+      }
+   }
+
+   //Lookups
+   for(int k = -1; k <= int(n); ++k){
+      const typename Set::value_type key(k);
+      const_iterator lb = s.lower_bound(key);
+      const_iterator ub = s.upper_bound(key);
+      std::set<int>::const_iterator rlb = ref.lower_bound(k);
+      std::set<int>::const_iterator rub = ref.upper_bound(k);
+      BOOST_TEST(lb == s.cend() ? rlb == ref.end() : lb->value_ == *rlb);
+      BOOST_TEST(ub == s.cend() ? rub == ref.end() : ub->value_ == *rub);
+      BOOST_TEST_EQ(s.count(key), ref.count(k));
+      BOOST_TEST_EQ(s.contains(key), ref.count(k) != 0);
+      std::pair<const_iterator, const_iterator> er = s.equal_range(key);
+      BOOST_TEST(er.first == lb);
+      BOOST_TEST(er.second == ub);
+   }
+
+   //Iterators are stable: erasing through iterator_to
+   for(std::size_t i = 0; i != n; ++i){
+      std::size_t pos = std::size_t(std::rand()) % n;
+      const int v = values[pos].value_;
+      iterator it = s.find(values[pos]);
+      if(it != s.end()){
+         BOOST_TEST(s.iterator_to(*it) == it);
+         iterator nxt = s.erase(it);
+         std::set<int>::iterator rit = ref.find(v);
+         ref.erase(rit++);
+         BOOST_TEST(nxt == s.end() ? rit == ref.end() : nxt->value_ == *rit);
+      }
+      else{
+         BOOST_TEST(ref.count(v) == 0u);
+      }
+      if(!(i % 64u)){
+         s.check();
+      }
+   }
+   s.check();
+   BOOST_TEST_EQ(s.size(), ref.size());
+
+   //Erase by key
+   for(int k = 0; k != int(n); ++k){
+      BOOST_TEST_EQ(s.erase(typename Set::value_type(k)), ref.erase(k));
+   }
+   s.check();
+   BOOST_TEST(s.empty());
+}
+
+template<class VoidPointer, link_mode_type LinkMode>
+void test_compact_set()
+{
+   typedef compact_value<VoidPointer, LinkMode> value_type;
+   typedef compact_set<value_type>                                         base_set;
+   typedef compact_set
+      < value_type
+      , member_hook< value_type
+                   , compact_set_member_hook< void_pointer<VoidPointer>, link_mode<LinkMode> >
+                   , &value_type::node_>
+      , constant_time_size<false> >                                        member_set;
+
+   std::vector<value_type> values;
+   for(int i = 0; i != 500; ++i){
+      values.push_back(value_type(i));
+   }
+   test_against_std_set<base_set>(values);
+   test_against_std_set<member_set>(values);
+
+   //Sorted and reverse-sorted insertions
+   {
+      base_set s(values.begin(), values.end());
+      s.check();
+      BOOST_TEST_EQ(s.size(), values.size());
+      s.clear();
+      for(std::size_t i = values.size(); i != 0; --i){
+         s.insert(s.end(), values[i-1u]);
+      }
+      s.check();
+      BOOST_TEST_EQ(s.begin()->value_, 0);
+      BOOST_TEST_EQ((--s.end())->value_, int(values.size()) - 1);
+
+      //Swap, move and container_from_end_iterator
+      base_set s2;
+      s2.swap(s);
+      s.check();
+      s2.check();
+      BOOST_TEST(s.empty());
+      BOOST_TEST_EQ(s2.size(), values.size());
+      BOOST_TEST(&base_set::container_from_end_iterator(s2.end()) == &s2);
+      base_set s3(::boost::move(s2));
+      s3.check();
+      BOOST_TEST(s2.empty());
+      BOOST_TEST_EQ(s3.size(), values.size());
+
+      //Range erasure
+      typename base_set::iterator b = s3.find(value_type(100)), e = s3.find(value_type(400));
+      BOOST_TEST(s3.erase(b, e)->value_ == 400);
+      s3.check();
+      BOOST_TEST_EQ(s3.size(), values.size() - 300u);
+
+      //Cloning
+      base_set s4;
+      s4.clone_from(s3, new_cloner(), delete_disposer());
+      s4.check();
+      BOOST_TEST_EQ(s4.size(), s3.size());
+      typename base_set::iterator it3 = s3.begin();
+      for(typename base_set::iterator it4 = s4.begin(); it4 != s4.end(); ++it4, ++it3){
+         BOOST_TEST(*it4 == *it3);
+         BOOST_TEST(&*it4 != &*it3);
+      }
+      s4.erase_and_dispose(s4.begin(), delete_disposer());
+      s4.erase_and_dispose(value_type(450), delete_disposer());
+      s4.check();
+      BOOST_TEST_EQ(s4.size(), s3.size() - 2u);
+      s4.clear_and_dispose(delete_disposer());
+      BOOST_TEST(s4.empty());
+      s3.clear();
+   }
+}
+
+void test_key_of_value()
+{
+   typedef compact_value<void*, safe_link> value_type;
+   typedef compact_set<value_type, key_of_value<int_key> > set_type;
+   value_type values[] = { value_type(3), value_type(1), value_type(2) };
+   set_type s(&values[0], &values[0] + 3);
+   s.check();
+   BOOST_TEST(s.find(2) != s.end());
+   BOOST_TEST(s.find(4) == s.end());
+   BOOST_TEST_EQ(s.begin()->value_, 1);
+   BOOST_TEST_EQ(s.erase(1), 1u);
+   BOOST_TEST_EQ(s.erase(1), 0u);
+   s.check();
+   BOOST_TEST(values[1].is_linked() == false);
+   s.clear();
+}
+
+int main()
+{
+   //Raw pointers embed the thread flags and the color in the links
+   BOOST_TEST_EQ(sizeof(compact_set_base_hook<>), 2u*sizeof(void*));
+   BOOST_TEST_EQ(sizeof(compact_set_member_hook<>), 2u*sizeof(void*));
+   BOOST_TEST(sizeof(compact_set_base_hook<>) < sizeof(set_base_hook<>));
+
+   test_compact_set<void*, safe_link>();
+   test_compact_set<void*, normal_link>();
+   test_compact_set<smart_ptr<void>, safe_link>();
+   test_key_of_value();
+   return boost::report_errors();
+}
@@ -0,0 +1,205 @@
+/////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright agent 2026
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/intrusive for documentation.
+//
+/////////////////////////////////////////////////////////////////////////////
+#include <boost/intrusive/list.hpp>
+#include <boost/intrusive/slist.hpp>
+#include <boost/intrusive/set.hpp>
+#include <boost/core/lightweight_test.hpp>
+
+#if defined(BOOST_INTRUSIVE_HAS_CXX20_CONSTEXPR)
+
+using namespace boost::intrusive;
+
+struct handler
+   : public list_base_hook<>
+   , public slist_base_hook<>
+   , public set_base_hook<>
+{
+   int id_;
+   int prio_;
+
+   constexpr explicit handler(int id = 0, int prio = 0)
+      : id_(id), prio_(prio)
+   {}
+
+   friend constexpr bool operator <(const handler &a, const handler &b)
+   {  return a.id_ < b.id_;  }
+
+   friend constexpr bool operator ==(const handler &a, const handler &b)
+   {  return a.id_ == b.id_;  }
+};
+
+struct prio_less
+{
+   constexpr bool operator()(const handler &a, const handler &b) const
+   {  return a.prio_ < b.prio_;  }
+};
+
+struct id_key
+{
+   typedef int type;
+
+   constexpr const int &operator()(const handler &h) const
+   {  return h.id_;  }
+};
+
+typedef list<handler>                           list_t;
+typedef slist<handler>                          slist_t;
+typedef slist<handler, linear<true>, cache_last<true> > linear_slist_t;
+typedef set<handler>                            set_t;
+typedef multiset<handler>                       multiset_t;
+typedef set<handler, key_of_value<id_key> >     key_set_t;
+
+constexpr int ids[]   = { 7, 3, 9, 1, 5, 8, 2, 6, 4, 0 };
+constexpr int prios[] = { 1, 0, 1, 0, 1, 0, 1, 0, 1, 0 };
+constexpr int N = sizeof(ids)/sizeof(ids[0]);
+
+template<class Sequence>
+constexpr bool test_sequence()
+{
+   handler h[N];
+   for(int i = 0; i != N; ++i)
+      h[i] = handler(ids[i], prios[i]);
+   Sequence s;
+   for(int i = 0; i != N; ++i)
+      s.push_front(h[i]);
+   if(s.size() != std::size_t(N) || &s.front() != &h[N-1])
+      return false;
+   s.sort();
+   int expected = 0;
+   for(typename Sequence::const_iterator it(s.cbegin()); it != s.cend(); ++it){
+      if(it->id_ != expected++)
+         return false;
+   }
+   //Stable sort by priority
+   s.sort(prio_less());
+   if(s.front().id_ != 0 || s.front().prio_ != 0)
+      return false;
+   s.reverse();
+   if(s.front().id_ != 9)
+      return false;
+   s.erase(s.iterator_to(h[0]));
+   s.pop_front();
+   if(s.size() != std::size_t(N - 2))
+      return false;
+   s.clear();
+   return s.empty();
+}
+
+template<class Set>
+constexpr bool test_set()
+{
+   handler h[N];
+   for(int i = 0; i != N; ++i)
+      h[i] = handler(ids[i], prios[i]);
+   Set s;
+   for(int i = 0; i != N; ++i)
+      s.insert(h[i]);
+   if(s.size() != std::size_t(N))
+      return false;
+   int expected = 0;
+   for(typename Set::const_iterator it(s.cbegin()); it != s.cend(); ++it){
+      if(it->id_ != expected++)
+         return false;
+   }
+   if(s.find(h[3]) == s.end() || &*s.lower_bound(h[3]) != &h[3])
+      return false;
+   s.erase(h[3]);
+   if(s.find(h[3]) != s.end() || s.size() != std::size_t(N - 1))
+      return false;
+   s.clear();
+   return s.empty();
+}
+
+constexpr bool test_key_set()
+{
+   handler h[N];
+   for(int i = 0; i != N; ++i)
+      h[i] = handler(ids[i], prios[i]);
+   key_set_t s;
+   for(int i = 0; i != N; ++i)
+      s.insert(h[i]);
+   const bool ok = s.find(7) != s.end() && s.find(7)->id_ == 7 && s.count(11) == 0;
+   s.clear();
+   return ok;
+}
+
+static_assert(test_sequence<list_t>(), "list");
+static_assert(test_sequence<slist_t>(), "slist");
+static_assert(test_sequence<linear_slist_t>(), "linear slist");
+static_assert(test_set<set_t>(), "set");
+static_assert(test_set<multiset_t>(), "multiset");
+static_assert(test_key_set(), "set with key_of_value");
+
+//A registry built at compile time. Containers must be declared after
+//the values, so they are destroyed first.
+struct registry
+{
+   handler handlers_[N];
+   list_t  by_prio_;
+   set_t   by_id_;
+
+   //Some compilers (e.g. GCC 12) reject reading a constexpr variable whose nodes
+   //pointed to a temporary container during its construction, so by_prio_ is
+   //built without sort(), which merges temporary lists.
+   constexpr registry()
+      : handlers_(), by_prio_(), by_id_()
+   {
+      for(int i = 0; i != N; ++i){
+         handlers_[i] = handler(ids[i], prios[i]);
+         by_id_.insert(handlers_[i]);
+      }
+      for(int prio = 0; prio != 2; ++prio){
+         for(int i = 0; i != N; ++i){
+            if(handlers_[i].prio_ == prio)
+               by_prio_.push_back(handlers_[i]);
+         }
+      }
+   }
+};
+
+constexpr registry reg;
+static_assert(reg.by_id_.begin()->id_ == 0, "registry");
+static_assert(reg.by_prio_.begin()->id_ == 3, "registry");
+
+void test_registry()
+{
+   int expected = 0;
+   for(set_t::const_iterator it(reg.by_id_.begin()); it != reg.by_id_.end(); ++it)
+      BOOST_TEST_EQ(it->id_, expected++);
+   BOOST_TEST_EQ(expected, N);
+   int prio = 0;
+   for(list_t::const_iterator it(reg.by_prio_.begin()); it != reg.by_prio_.end(); ++it){
+      BOOST_TEST(prio <= it->prio_);
+      prio = it->prio_;
+   }
+
+   //The same functions can be used at runtime
+   BOOST_TEST(test_sequence<list_t>());
+   BOOST_TEST(test_sequence<slist_t>());
+   BOOST_TEST(test_sequence<linear_slist_t>());
+   BOOST_TEST(test_set<set_t>());
+   BOOST_TEST(test_set<multiset_t>());
+   BOOST_TEST(test_key_set());
+}
+
+#else
+
+void test_registry()
+{}
+
+#endif
+
+int main()
+{
+   test_registry();
+   return boost::report_errors();
+}
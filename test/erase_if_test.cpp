@@ -0,0 +1,260 @@
+/////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright agent 2026
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/intrusive for documentation.
+//
+/////////////////////////////////////////////////////////////////////////////
+#include <boost/intrusive/set.hpp>
+#include <boost/intrusive/avl_set.hpp>
+#include <boost/intrusive/sg_set.hpp>
+#include <boost/intrusive/treap_set.hpp>
+#include <boost/intrusive/splay_set.hpp>
+#include <boost/intrusive/bs_set.hpp>
+#include <boost/intrusive/unordered_set.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include "smart_ptr.hpp"
+#include <cstdlib>
+#include <cstddef>
+#include <vector>
+#include <algorithm>
+
+using namespace boost::intrusive;
+
+template<class Hook>
+struct erase_value
+   : public Hook
+{
+   int value_;
+   bool disposed_;
+
+   explicit erase_value(int v = 0)
+      : value_(v), disposed_(false)
+   {}
+
+   friend bool operator <(const erase_value &a, const erase_value &b)
+   {  return a.value_ < b.value_;  }
+
+   friend bool operator ==(const erase_value &a, const erase_value &b)
+   {  return a.value_ == b.value_;  }
+
+   friend std::size_t hash_value(const erase_value &v)
+   {  return std::size_t(v.value_);  }
+
+   friend bool priority_order(const erase_value &a, const erase_value &b)
+   {  return (unsigned(a.value_)*2654435761u) < (unsigned(b.value_)*2654435761u);  }
+};
+
+//Erases the elements whose value modulo "mod_" is lower than "erase_below_"
+struct mod_pred
+{
+   mod_pred(int mod, int erase_below)
+      : mod_(mod), erase_below_(erase_below)
+   {}
+
+   template<class V>
+   bool operator()(const V &v) const
+   {  return (v.value_ % mod_) < erase_below_;  }
+
+   int mod_;
+   int erase_below_;
+};
+
+struct throwing_pred
+{
+   struct exception {};
+
+   explicit throwing_pred(int *countdown)
+      : countdown_(countdown)
+   {}
+
+   template<class V>
+   bool operator()(const V &v) const
+   {
+      if(--*countdown_ == 0)
+         throw exception();
+      return (v.value_ % 3) != 0;
+   }
+
+   int *countdown_;
+};
+
+struct mark_disposer
+{
+   template<class P>
+   void operator()(P p)
+   {  BOOST_TEST(!p->disposed_); p->disposed_ = true;  }
+};
+
+template<class Container>
+std::size_t count_linked(const std::vector<typename Container::value_type> &values)
+{
+   std::size_t n = 0;
+   for(std::size_t i = 0; i != values.size(); ++i)
+      n += values[i].is_linked();
+   return n;
+}
+
+template<class Container>
+bool check_contents(const Container &c, const std::vector<typename Container::value_type> &values, mod_pred p)
+{
+   c.check();
+   std::size_t expected = 0;
+   for(std::size_t i = 0; i != values.size(); ++i){
+      const bool kept = !p(values[i]);
+      expected += kept;
+      if(kept != values[i].is_linked())
+         return false;
+      if(kept && c.find(values[i]) == c.end())
+         return false;
+   }
+   return c.size() == expected && std::size_t(std::distance(c.begin(), c.end())) == expected;
+}
+
+template<class Container>
+void fill(Container &c, std::vector<typename Container::value_type> &values, std::size_t size, int dup)
+{
+   typedef typename Container::value_type value_type;
+   values.clear();
+   values.reserve(size);
+   for(std::size_t i = 0; i != size; ++i)
+      values.push_back(value_type(int(i)/dup));
+   std::vector<std::size_t> order;
+   for(std::size_t i = 0; i != size; ++i)
+      order.push_back(i);
+   for(std::size_t i = size; i > 1; --i)
+      std::swap(order[i-1], order[std::size_t(std::rand()) % i]);
+   for(std::size_t i = 0; i != size; ++i)
+      c.insert(values[order[i]]);
+}
+
+template<class Container>
+void test_erase_if(Container &c, std::vector<typename Container::value_type> &values, int dup)
+{
+   //Few erased elements (erased one by one) and most of them erased (rebuilt for trees)
+   const int erase_below[] = { 0, 1, 5, 9, 10 };
+   const std::size_t size = 1000;
+   for(std::size_t i = 0; i != sizeof(erase_below)/sizeof(erase_below[0]); ++i){
+      for(int dispose = 0; dispose != 2; ++dispose){
+         fill(c, values, size, dup);
+         const mod_pred p(10, erase_below[i]);
+         std::size_t expected = 0;
+         for(std::size_t j = 0; j != size; ++j)
+            expected += p(values[j]);
+         std::size_t n;
+         if(dispose){
+            n = c.erase_and_dispose_if(p, mark_disposer());
+            for(std::size_t j = 0; j != size; ++j)
+               BOOST_TEST(values[j].disposed_ == p(values[j]));
+         }
+         else{
+            n = c.erase_if(p);
+         }
+         BOOST_TEST_EQ(n, expected);
+         BOOST_TEST(check_contents(c, values, p));
+         //The container is still usable
+         for(std::size_t j = 0; j != size; ++j){
+            if(!values[j].is_linked()){
+               values[j].disposed_ = false;
+               c.insert(values[j]);
+            }
+         }
+         BOOST_TEST_EQ(c.size(), size);
+         c.check();
+         BOOST_TEST_EQ(c.erase_if(mod_pred(1, 1)), size);
+         BOOST_TEST(c.empty());
+      }
+   }
+   //Empty container and small sizes
+   for(std::size_t sz = 0; sz != 40; ++sz){
+      fill(c, values, sz, dup);
+      const mod_pred p(3, 2);
+      c.erase_if(p);
+      BOOST_TEST(check_contents(c, values, p));
+      c.clear();
+   }
+}
+
+template<class Container>
+void test_throwing_pred(Container &c, std::vector<typename Container::value_type> &values)
+{
+   const int countdowns[] = { 1, 10, 400, 900 };
+   for(std::size_t i = 0; i != sizeof(countdowns)/sizeof(countdowns[0]); ++i){
+      fill(c, values, 1000, 1);
+      int countdown = countdowns[i];
+      bool thrown = false;
+      try{
+         c.erase_if(throwing_pred(&countdown));
+      }
+      catch(throwing_pred::exception &){
+         thrown = true;
+      }
+      BOOST_TEST(thrown);
+      //Basic guarantee: a valid container, size and linked elements agree
+      c.check();
+      BOOST_TEST_EQ(c.size(), count_linked<Container>(values));
+      BOOST_TEST_EQ(std::size_t(std::distance(c.begin(), c.end())), c.size());
+      c.clear();
+   }
+}
+
+template<class Tree>
+void test_tree(int dup)
+{
+   Tree t;
+   std::vector<typename Tree::value_type> values;
+   test_erase_if(t, values, dup);
+   test_throwing_pred(t, values);
+}
+
+template<class Unordered>
+void test_unordered(int dup)
+{
+   typedef typename Unordered::bucket_type    bucket_type;
+   typedef typename Unordered::bucket_traits  bucket_traits;
+   typedef typename Unordered::bucket_ptr     bucket_ptr;
+   std::vector<bucket_type> buckets(127);
+   Unordered u(bucket_traits(pointer_traits<bucket_ptr>::pointer_to(buckets[0]), buckets.size()));
+   std::vector<typename Unordered::value_type> values;
+   test_erase_if(u, values, dup);
+   test_throwing_pred(u, values);
+}
+
+template<class VoidPointer>
+void test_all()
+{
+   typedef erase_value< set_base_hook< void_pointer<VoidPointer> > >     rb_value;
+   typedef erase_value< avl_set_base_hook< void_pointer<VoidPointer> > > avl_value;
+   typedef erase_value< bs_set_base_hook< void_pointer<VoidPointer> > >  bs_value;
+   typedef erase_value< unordered_set_base_hook< void_pointer<VoidPointer> > > hash_value;
+   typedef erase_value< unordered_set_base_hook< void_pointer<VoidPointer>
+                                               , optimize_multikey<true>
+                                               , store_hash<true> > >    multikey_value;
+
+   test_tree< set<rb_value> >(1);
+   test_tree< multiset<rb_value> >(4);
+   test_tree< multiset<rb_value, constant_time_size<false> > >(4);
+   test_tree< avl_multiset<avl_value> >(4);
+   test_tree< sg_multiset<bs_value> >(4);
+   test_tree< sg_set<bs_value, floating_point<false> > >(1);
+   test_tree< treap_multiset<bs_value> >(4);
+   test_tree< splay_multiset<bs_value> >(4);
+   test_tree< bs_multiset<bs_value> >(4);
+
+   test_unordered< unordered_set<hash_value> >(1);
+   test_unordered< unordered_set<hash_value, cache_begin<true>, constant_time_size<false> > >(1);
+   test_unordered< unordered_multiset<hash_value> >(4);
+   test_unordered< unordered_multiset<multikey_value, cache_begin<true> > >(4);
+   test_unordered< unordered_multiset<multikey_value, constant_time_size<false> > >(4);
+}
+
+int main()
+{
+   test_all<void*>();
+   test_all<boost::intrusive::smart_ptr<void> >();
+   return boost::report_errors();
+}
@@ -0,0 +1,156 @@
+/////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright agent 2026
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/intrusive for documentation.
+//
+/////////////////////////////////////////////////////////////////////////////
+#include <boost/intrusive/frozen_set.hpp>
+#include <boost/intrusive/set.hpp>
+#include <boost/intrusive/avl_set.hpp>
+#include <boost/intrusive/sg_set.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <cstddef>
+#include <vector>
+
+using namespace boost::intrusive;
+
+struct frozen_value
+   : public set_base_hook<>
+   , public avl_set_base_hook<>
+   , public bs_set_base_hook<>
+{
+   int key_;
+   explicit frozen_value(int k = 0) : key_(k) {}
+};
+
+struct key_of_frozen_value
+{
+   typedef int type;
+
+   const int &operator()(const frozen_value &v) const
+   {  return v.key_;  }
+};
+
+//Heterogeneous comparison with a long
+struct long_int_less
+{
+   bool operator()(long a, int b) const {  return a < long(b);  }
+   bool operator()(int a, long b) const {  return long(a) < b;  }
+};
+
+typedef key_of_value<key_of_frozen_value> kov;
+
+//All lookups in the snapshot must return the same iterators as the tree
+template<class Frozen>
+void check_lookups(const Frozen &f)
+{
+   typedef typename Frozen::tree_type  tree_type;
+   typedef typename Frozen::iterator   iterator;
+   tree_type &t = f.tree();
+   BOOST_TEST_EQ(f.size(), t.size());
+   const int lo = t.empty() ? 0 : t.begin()->key_ - 2;
+   const int hi = t.empty() ? 0 : (--t.end())->key_ + 2;
+   for(int k = lo; k <= hi; ++k){
+      BOOST_TEST(f.lower_bound(k) == t.lower_bound(k));
+      BOOST_TEST(f.upper_bound(k) == t.upper_bound(k));
+      BOOST_TEST(f.find(k) == t.find(k));
+      BOOST_TEST_EQ(f.count(k), t.count(k));
+      BOOST_TEST_EQ(f.contains(k), t.find(k) != t.end());
+      BOOST_TEST(f.equal_range(k) == t.equal_range(k));
+      BOOST_TEST(f.lower_bound(long(k), long_int_less()) == t.lower_bound(k));
+      BOOST_TEST(f.upper_bound(long(k), long_int_less()) == t.upper_bound(k));
+      BOOST_TEST(f.find(long(k), long_int_less()) == t.find(k));
+      const std::pair<iterator, iterator> er = f.equal_range(long(k), long_int_less());
+      BOOST_TEST(er == t.equal_range(k));
+   }
+}
+
+template<class Tree, bool CacheKeys>
+void test_tree(bool multi)
+{
+   typedef frozen_set<Tree, CacheKeys>          frozen_t;
+   typedef typename frozen_t::entry_type        entry_type;
+
+   //Every shape of the implicit tree, from empty to several full levels
+   for(std::size_t n = 0; n != 70u; ++n){
+      std::vector<frozen_value> values;
+      values.reserve(n);
+      for(std::size_t i = 0; i != n; ++i){
+         const int k = multi ? int(i/3u)*2 : int((i*37u) % n)*2;
+         values.push_back(frozen_value(k));
+      }
+      Tree t(values.begin(), values.end());
+      std::vector<entry_type> entries(n);
+      frozen_t f(t, entries.data(), entries.size());
+      BOOST_TEST_EQ(f.capacity(), n);
+      BOOST_TEST_EQ(f.empty(), n == 0u);
+      check_lookups(f);
+
+      //Nothing changed, nothing is written
+      BOOST_TEST_EQ(f.refresh(), 0u);
+      check_lookups(f);
+      t.clear();
+   }
+
+   //Replacing elements keeps the size and only rewrites the replaced positions
+   {
+      const std::size_t n = 100u;
+      std::vector<frozen_value> values, replacements;
+      for(std::size_t i = 0; i != n; ++i){
+         values.push_back(frozen_value(int(i)*2));
+         replacements.push_back(frozen_value(int(i)*2));
+      }
+      Tree t(values.begin(), values.end());
+      std::vector<entry_type> entries(2u*n);
+      frozen_t f(entries.data(), entries.size());
+      BOOST_TEST(f.empty());
+      f.rebuild(t);
+      check_lookups(f);
+      std::size_t replaced = 0;
+      for(std::size_t i = 0; i < n; i += 7u, ++replaced){
+         t.replace_node(t.iterator_to(values[i]), replacements[i]);
+      }
+      BOOST_TEST_EQ(f.refresh(), replaced);
+      check_lookups(f);
+      for(std::size_t i = 0; i < n; i += 7u){
+         BOOST_TEST(&*f.find(int(i)*2) == &replacements[i]);
+      }
+
+      //Changing the size rebuilds the snapshot
+      for(std::size_t i = 1; i < n; i += 3u){
+         t.erase(t.find(int(i)*2));
+      }
+      BOOST_TEST_EQ(f.refresh(), t.size());
+      check_lookups(f);
+      t.insert(t.end(), values[1]);
+      t.insert(t.end(), values[4]);
+      BOOST_TEST_EQ(f.refresh(), t.size());
+      check_lookups(f);
+      t.clear();
+      BOOST_TEST_EQ(f.refresh(), 0u);
+      BOOST_TEST(f.empty());
+      BOOST_TEST(f.find(0) == t.end());
+   }
+}
+
+template<bool CacheKeys>
+void test_all()
+{
+   typedef base_hook< bs_set_base_hook<> > bs_hook;
+   test_tree< set<frozen_value, kov>, CacheKeys >(false);
+   test_tree< multiset<frozen_value, kov>, CacheKeys >(true);
+   test_tree< avl_multiset<frozen_value, kov>, CacheKeys >(true);
+   test_tree< sg_set<frozen_value, kov, bs_hook>, CacheKeys >(false);
+}
+
+int main()
+{
+   test_all<false>();
+   test_all<true>();
+   return boost::report_errors();
+}
@@ -0,0 +1,268 @@
+/////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright agent 2026
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/intrusive for documentation.
+//
+/////////////////////////////////////////////////////////////////////////////
+#include <boost/intrusive/group_multiset.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include "smart_ptr.hpp"
+#include <cstdlib>
+#include <map>
+#include <vector>
+
+using namespace boost::intrusive;
+
+template<class VoidPointer, link_mode_type LinkMode>
+struct group_value
+   : public group_multiset_base_hook< void_pointer<VoidPointer>, link_mode<LinkMode> >
+{
+   group_multiset_member_hook< void_pointer<VoidPointer>, link_mode<LinkMode> > node_;
+   int value_;
+
+   explicit group_value(int v = 0)
+      : value_(v)
+   {}
+
+   friend bool operator <(const group_value &a, const group_value &b)
+   {  return a.value_ < b.value_;  }
+};
+
+struct int_key
+{
+   typedef int type;
+
+   template<class V>
+   const int &operator()(const V &v) const
+   {  return v.value_;  }
+};
+
+struct delete_disposer
+{
+   template<class P>
+   void operator()(P p)
+   {  delete &*p;  }
+};
+
+struct new_cloner
+{
+   template<class V>
+   V *operator()(const V &v)
+   {  return new V(v);  }
+};
+
+struct counting_disposer
+{
+   explicit counting_disposer(std::size_t &n) : n_(n) {}
+
+   template<class P>
+   void operator()(P)
+   {  ++n_;  }
+
+   std::size_t &n_;
+};
+
+//std::multimap keeps elements with equivalent keys in insertion order, like group_multiset
+template<class Set>
+bool equal_to_ref(const Set &s, const std::multimap<int, const typename Set::value_type*> &ref)
+{
+   typedef typename std::multimap<int, const typename Set::value_type*>::const_iterator ref_iterator;
+   s.check();
+   if(s.size() != ref.size())
+      return false;
+   typename Set::const_iterator it(s.begin());
+   for(ref_iterator rit = ref.begin(); rit != ref.end(); ++rit, ++it){
+      if(&*it != rit->second)
+         return false;
+   }
+   //Reverse traversal
+   typename Set::const_reverse_iterator rit(s.rbegin());
+   for(typename std::multimap<int, const typename Set::value_type*>::const_reverse_iterator
+         it2 = ref.rbegin(); it2 != ref.rend(); ++it2, ++rit){
+      if(&*rit != it2->second)
+         return false;
+   }
+   return rit == s.rend();
+}
+
+template<class Set>
+void test_against_std_multimap(std::vector<typename Set::value_type> &values, int distinct)
+{
+   typedef typename Set::value_type value_type;
+   typedef typename Set::iterator iterator;
+   typedef std::multimap<int, const value_type*> ref_t;
+   const std::size_t n = values.size();
+   Set s;
+   ref_t ref;
+   std::vector<bool> linked(n, true);
+
+   //Insert all elements
+   for(std::size_t i = 0; i != n; ++i){
+      iterator it = s.insert(values[i]);
+      BOOST_TEST(&*it == &values[i]);
+      ref.insert(typename ref_t::value_type(values[i].value_, &values[i]));
+   }
+   BOOST_TEST(equal_to_ref(s, ref));
+
+   //Lookups
+   for(int k = -1; k <= distinct; ++k){
+      BOOST_TEST_EQ(s.count(k), ref.count(k));
+      BOOST_TEST_EQ(s.contains(k), ref.count(k) != 0);
+      std::pair<iterator, iterator> r = s.equal_range(k);
+      std::pair<typename ref_t::iterator, typename ref_t::iterator> rr = ref.equal_range(k);
+      for(; r.first != r.second && rr.first != rr.second; ++r.first, ++rr.first)
+         BOOST_TEST(&*r.first == rr.first->second);
+      BOOST_TEST(r.first == r.second && rr.first == rr.second);
+      BOOST_TEST((s.lower_bound(k) == s.end()) == (ref.lower_bound(k) == ref.end()));
+      if(s.lower_bound(k) != s.end())
+         BOOST_TEST(&*s.lower_bound(k) == ref.lower_bound(k)->second);
+      BOOST_TEST((s.upper_bound(k) == s.end()) == (ref.upper_bound(k) == ref.end()));
+      if(s.upper_bound(k) != s.end())
+         BOOST_TEST(&*s.upper_bound(k) == ref.upper_bound(k)->second);
+      BOOST_TEST((s.find(k) == s.end()) == (ref.find(k) == ref.end()));
+      if(s.find(k) != s.end())
+         BOOST_TEST(&*s.find(k) == ref.find(k)->second);
+   }
+
+   //Random erasures by iterator, removing leaders and followers
+   for(std::size_t i = 0; i != n/2; ++i){
+      const std::size_t pos = std::size_t(std::rand()) % n;
+      if(!linked[pos])
+         continue;
+      linked[pos] = false;
+      iterator next = s.erase(s.iterator_to(values[pos]));
+      typename ref_t::iterator rit = ref.lower_bound(values[pos].value_);
+      while(rit->second != &values[pos])
+         ++rit;
+      ref.erase(rit++);
+      BOOST_TEST((next == s.end()) == (rit == ref.end()));
+      if(next != s.end())
+         BOOST_TEST(&*next == rit->second);
+   }
+   BOOST_TEST(equal_to_ref(s, ref));
+
+   //Reinsert erased elements, they go after existing elements of their key
+   for(std::size_t i = 0; i != n; ++i){
+      if(!linked[i]){
+         s.insert(s.end(), values[i]);
+         ref.insert(typename ref_t::value_type(values[i].value_, &values[i]));
+      }
+   }
+   BOOST_TEST(equal_to_ref(s, ref));
+
+   //Erase complete keys
+   for(int k = 0; k < distinct; k += 3){
+      BOOST_TEST_EQ(s.erase(k), ref.erase(k));
+   }
+   BOOST_TEST(equal_to_ref(s, ref));
+   std::size_t disposed = 0;
+   const std::size_t c = ref.erase(1);
+   BOOST_TEST_EQ(s.erase_and_dispose(1, counting_disposer(disposed)), c);
+   BOOST_TEST_EQ(disposed, c);
+   BOOST_TEST(equal_to_ref(s, ref));
+
+   //Range erasure
+   s.erase(s.lower_bound(distinct/2), s.end());
+   ref.erase(ref.lower_bound(distinct/2), ref.end());
+   BOOST_TEST(equal_to_ref(s, ref));
+
+   //Clear
+   disposed = 0;
+   const std::size_t remaining = s.size();
+   s.clear_and_dispose(counting_disposer(disposed));
+   BOOST_TEST_EQ(disposed, remaining);
+   BOOST_TEST(s.empty());
+   BOOST_TEST(s.begin() == s.end());
+}
+
+template<class Set>
+void test_clone_swap_move(std::vector<typename Set::value_type> &values)
+{
+   Set s(values.begin(), values.end());
+   Set c;
+   c.clone_from(s, new_cloner(), delete_disposer());
+   c.check();
+   BOOST_TEST_EQ(c.size(), s.size());
+   typename Set::const_iterator sit(s.begin());
+   for(typename Set::const_iterator cit(c.begin()); cit != c.end(); ++cit, ++sit){
+      BOOST_TEST(&*cit != &*sit);
+      BOOST_TEST_EQ(cit->value_, sit->value_);
+   }
+
+   //Swap and move keep the groups and the end iterator of each container
+   Set other;
+   other.swap(c);
+   BOOST_TEST(c.empty());
+   BOOST_TEST_EQ(other.size(), s.size());
+   BOOST_TEST(&Set::container_from_end_iterator(other.end()) == &other);
+   Set moved(::boost::move(other));
+   moved.check();
+   BOOST_TEST(other.empty());
+   BOOST_TEST_EQ(moved.size(), s.size());
+   moved.clear_and_dispose(delete_disposer());
+   s.clear();
+}
+
+//Safe-mode hooks are unlinked when leaders and followers are erased
+void test_safe_link()
+{
+   typedef group_value<void*, safe_link> value_type;
+   typedef group_multiset<value_type, key_of_value<int_key> > set_t;
+   value_type values[] = { value_type(1), value_type(2), value_type(1), value_type(1) };
+   set_t s(values, values + 4);
+   for(std::size_t i = 0; i != 4; ++i)
+      BOOST_TEST(values[i].is_linked());
+   //Erase the leader of key 1, the next element of the group takes its place
+   s.erase(s.iterator_to(values[0]));
+   BOOST_TEST(!values[0].is_linked());
+   BOOST_TEST(&*s.begin() == &values[2]);
+   //Erase a follower
+   s.erase(s.iterator_to(values[3]));
+   BOOST_TEST(!values[3].is_linked());
+   BOOST_TEST_EQ(s.count(1), 1u);
+   s.check();
+   s.clear();
+   for(std::size_t i = 0; i != 4; ++i)
+      BOOST_TEST(!values[i].is_linked());
+}
+
+template<class VoidPointer, link_mode_type LinkMode>
+void test_group_multiset()
+{
+   typedef group_value<VoidPointer, LinkMode> value_type;
+   typedef group_multiset<value_type, key_of_value<int_key> > base_set_t;
+   typedef avl_group_multiset<value_type, key_of_value<int_key> > avl_base_set_t;
+   typedef member_hook< value_type
+                      , group_multiset_member_hook< void_pointer<VoidPointer>, link_mode<LinkMode> >
+                      , &value_type::node_> member_option;
+   typedef group_multiset<value_type, member_option, key_of_value<int_key>, constant_time_size<false> > member_set_t;
+   typedef avl_group_multiset<value_type, member_option, key_of_value<int_key> > avl_member_set_t;
+
+   //Few distinct keys with long groups and many distinct keys with short groups
+   const int distinct[] = { 1, 7, 100, 1000 };
+   for(std::size_t d = 0; d != sizeof(distinct)/sizeof(distinct[0]); ++d){
+      std::vector<value_type> values;
+      for(int i = 0; i != 1000; ++i)
+         values.push_back(value_type(std::rand() % distinct[d]));
+      test_against_std_multimap<base_set_t>(values, distinct[d]);
+      test_against_std_multimap<avl_base_set_t>(values, distinct[d]);
+      test_against_std_multimap<member_set_t>(values, distinct[d]);
+      test_against_std_multimap<avl_member_set_t>(values, distinct[d]);
+      test_clone_swap_move<base_set_t>(values);
+      test_clone_swap_move<avl_member_set_t>(values);
+   }
+}
+
+int main()
+{
+   test_group_multiset<void*, safe_link>();
+   test_group_multiset<boost::intrusive::smart_ptr<void>, safe_link>();
+   test_group_multiset<void*, normal_link>();
+   test_safe_link();
+   return boost::report_errors();
+}
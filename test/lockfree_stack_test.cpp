@@ -0,0 +1,235 @@
+/////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright agent 2026
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/intrusive for documentation.
+//
+/////////////////////////////////////////////////////////////////////////////
+#include <boost/config.hpp>
+#include <boost/core/lightweight_test.hpp>
+
+#if !defined(BOOST_NO_CXX11_HDR_ATOMIC) && !defined(BOOST_NO_CXX11_HDR_THREAD) && !defined(BOOST_NO_CXX11_LAMBDAS)
+
+#include <boost/intrusive/lockfree_stack.hpp>
+#include <boost/intrusive/slist.hpp>
+#include <cstddef>
+#include <vector>
+#include <thread>
+
+using namespace boost::intrusive;
+
+typedef slist_member_hook< link_mode<normal_link> > normal_member_hook_t;
+
+struct stack_value
+   : public slist_base_hook<>
+{
+   int id_;
+   normal_member_hook_t hook_;
+   std::size_t count_;
+
+   explicit stack_value(int id = 0)
+      : id_(id), count_(0u)
+   {}
+};
+
+typedef lockfree_stack<stack_value>                            base_stack_t;
+typedef slist<stack_value>                                     base_slist_t;
+typedef slist<stack_value, linear<true>, cache_last<true> >    base_linear_slist_t;
+typedef member_hook<stack_value, normal_member_hook_t, &stack_value::hook_> member_option_t;
+typedef lockfree_stack<stack_value, member_option_t>           member_stack_t;
+typedef slist<stack_value, member_option_t>                    member_slist_t;
+
+const std::size_t NumElements = 100;
+
+template<class Stack, class Slist>
+void test_sequential(std::vector<stack_value> &values)
+{
+   Stack st;
+   BOOST_TEST(st.empty());
+   BOOST_TEST(!st.pop());
+   for(std::size_t i = 0; i != NumElements; ++i)
+      st.push(values[i]);
+   BOOST_TEST(!st.empty());
+
+   //LIFO order
+   for(std::size_t i = NumElements; i != 0; --i){
+      stack_value *p = st.pop();
+      BOOST_TEST(p == &values[i-1u]);
+   }
+   BOOST_TEST(st.empty());
+   BOOST_TEST(!st.pop());
+
+   //A chain is pushed with its first element on top
+   {
+      Slist s;
+      for(std::size_t i = 0; i != NumElements/2u; ++i)
+         s.push_front(values[i]);
+      st.push(values[NumElements-1u]);
+      st.push_range(s);
+      BOOST_TEST(s.empty());
+      BOOST_TEST(st.pop() == &values[NumElements/2u - 1u]);
+      st.pop_all(s);
+      BOOST_TEST(st.empty());
+      BOOST_TEST_EQ(s.size(), NumElements/2u);
+      BOOST_TEST(&s.front() == &values[NumElements/2u - 2u]);
+      std::size_t i = NumElements/2u - 1u;
+      for(typename Slist::iterator it(s.begin()); i != 0; ++it)
+         BOOST_TEST(&*it == &values[--i]);
+      BOOST_TEST(&*s.previous(s.end()) == &values[NumElements-1u]);
+
+      //Popped elements are inserted before the existing ones
+      st.push(values[NumElements-2u]);
+      st.pop_all(s);
+      BOOST_TEST(&s.front() == &values[NumElements-2u]);
+      st.pop_all(s);
+      BOOST_TEST_EQ(s.size(), NumElements/2u + 1u);
+      s.clear();
+   }
+
+   //Pushing an empty chain does nothing
+   {
+      Slist s;
+      st.push_range(s);
+      BOOST_TEST(st.empty());
+      st.pop_all(s);
+      BOOST_TEST(s.empty());
+   }
+
+   //Elements left in the stack are unlinked when it's destroyed
+   {
+      Stack st2;
+      st2.push(values[0]);
+      st2.push(values[1]);
+   }
+}
+
+void test_safe_mode(std::vector<stack_value> &values)
+{
+   {
+      base_stack_t st;
+      st.push(values[0]);
+      st.push(values[1]);
+      BOOST_TEST(values[0].is_linked());
+      BOOST_TEST(!st.pop()->is_linked());
+      BOOST_TEST(values[0].is_linked());
+   }
+   BOOST_TEST(!values[0].is_linked());
+   {
+      base_stack_t st;
+      base_linear_slist_t s;
+      s.push_back(values[0]);
+      s.push_back(values[1]);
+      st.push_range(s);
+      BOOST_TEST(values[0].is_linked());
+      st.pop_all(s);
+      BOOST_TEST(&s.back() == &values[1]);
+      s.push_back(values[2]);
+      BOOST_TEST(&s.back() == &values[2]);
+      BOOST_TEST_EQ(s.size(), 3u);
+      s.clear();
+      BOOST_TEST(!values[1].is_linked());
+   }
+}
+
+//Several threads pop elements from a shared stack and push them again. Then
+//some threads pop and push chains while others push the elements they hold.
+//Every element must be in the stack at the end.
+//
+//Popped elements are kept out of hooks while other threads pop elements one by one,
+//as a pop() might still read the hook of an element just popped by another thread.
+template<class Stack, class Slist>
+void test_concurrent(std::vector<stack_value> &values)
+{
+   const std::size_t NumThreads = 4u;
+   const std::size_t Iterations = 20000u;
+   Stack st;
+   for(std::size_t i = 0; i != NumElements; ++i){
+      values[i].count_ = 0u;
+      st.push(values[i]);
+   }
+
+   std::vector<std::thread> threads;
+   for(std::size_t t = 0; t != NumThreads; ++t){
+      threads.push_back(std::thread([&st]{
+         std::vector<stack_value*> popped;
+         for(std::size_t i = 0; i != Iterations; ++i){
+            for(std::size_t n = 0; n != 4u; ++n){
+               stack_value *p = st.pop();
+               if(p){
+                  ++p->count_;
+                  popped.push_back(p);
+               }
+            }
+            while(!popped.empty()){
+               st.push(*popped.back());
+               popped.pop_back();
+            }
+         }
+      }));
+   }
+   for(std::size_t t = 0; t != NumThreads; ++t)
+      threads[t].join();
+   threads.clear();
+
+   std::vector<stack_value*> held;
+   for(std::size_t i = 0; i != NumElements/2u; ++i)
+      held.push_back(st.pop());
+   for(std::size_t t = 0; t != NumThreads; ++t){
+      threads.push_back(std::thread([&st, &held, t]{
+         if(t & 1u){
+            Slist s;
+            for(std::size_t i = 0; i != Iterations; ++i){
+               st.pop_all(s);
+               st.push_range(s);
+            }
+         }
+         else{
+            for(std::size_t i = t/2u; i < held.size(); i += NumThreads/2u)
+               st.push(*held[i]);
+         }
+      }));
+   }
+   for(std::size_t t = 0; t != NumThreads; ++t)
+      threads[t].join();
+
+   std::vector<std::size_t> seen(NumElements);
+   std::size_t n = 0;
+   while(stack_value *p = st.pop()){
+      ++n;
+      BOOST_TEST(p >= &values[0] && p < &values[0] + NumElements);
+      ++seen[std::size_t(p - &values[0])];
+   }
+   BOOST_TEST_EQ(n, NumElements);
+   for(std::size_t i = 0; i != NumElements; ++i)
+      BOOST_TEST_EQ(seen[i], 1u);
+}
+
+int main()
+{
+   std::vector<stack_value> values;
+   for(std::size_t i = 0; i != NumElements; ++i)
+      values.push_back(stack_value(int(i)));
+   test_sequential<base_stack_t, base_slist_t>(values);
+   test_sequential<base_stack_t, base_linear_slist_t>(values);
+   test_sequential<member_stack_t, member_slist_t>(values);
+   test_safe_mode(values);
+   test_concurrent<base_stack_t, base_slist_t>(values);
+   test_concurrent<member_stack_t, member_slist_t>(values);
+   #if defined(BOOST_INTRUSIVE_TAGGED_PTR_COMPRESSION)
+   BOOST_TEST(base_stack_t().is_lock_free());
+   #endif
+   return boost::report_errors();
+}
+
+#else
+
+int main()
+{
+   return boost::report_errors();
+}
+
+#endif
@@ -0,0 +1,162 @@
+/////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright agent 2026
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/intrusive for documentation.
+//
+/////////////////////////////////////////////////////////////////////////////
+#include <boost/intrusive/lookup_cache.hpp>
+#include <boost/intrusive/set.hpp>
+#include <boost/intrusive/avl_set.hpp>
+#include <boost/intrusive/sg_set.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <cstddef>
+#include <vector>
+
+using namespace boost::intrusive;
+
+struct cached_value
+   : public set_base_hook<>
+   , public avl_set_base_hook<>
+   , public bs_set_base_hook<>
+{
+   int key_;
+   explicit cached_value(int k = 0) : key_(k) {}
+};
+
+struct key_of_cached_value
+{
+   typedef int type;
+
+   const int &operator()(const cached_value &v) const
+   {  return v.key_;  }
+};
+
+//All keys collide in the same slot
+struct constant_hash
+{
+   std::size_t operator()(int) const
+   {  return 0u;  }
+};
+
+//The disposed elements keep their key, so only the epoch of the tree
+//tells the cache that they are no longer in the tree
+struct count_disposer
+{
+   explicit count_disposer(std::size_t &c) : count_(c) {}
+   void operator()(cached_value *)
+   {  ++count_;  }
+   std::size_t &count_;
+};
+
+typedef key_of_value<key_of_cached_value> kov;
+
+template<class Cache>
+void check_lookups(Cache &c, int lo, int hi)
+{
+   typename Cache::tree_type &t = c.tree();
+   for(int k = lo; k <= hi; ++k){
+      BOOST_TEST(c.find(k) == t.find(k));
+      BOOST_TEST(c.lower_bound(k) == t.lower_bound(k));
+      BOOST_TEST_EQ(c.contains(k), t.find(k) != t.end());
+   }
+}
+
+template<class Tree, std::size_t Size, class Hash>
+void test_cache(bool multi)
+{
+   typedef lookup_cache<Tree, Size, Hash> cache_t;
+   const std::size_t N = 200u;
+   std::vector<cached_value> values;
+   for(std::size_t i = 0; i != N; ++i){
+      //Odd keys, each one repeated twice in multi-key containers
+      values.push_back(cached_value(int(multi ? i/2u : i)*2 + 1));
+   }
+   Tree t(values.begin(), values.end());
+   cache_t c(t);
+   BOOST_TEST(&c.tree() == &t);
+   const int max_key = (--t.end())->key_;
+   check_lookups(c, -1, max_key + 1);
+   check_lookups(c, -1, max_key + 1);
+
+   //Hot keys hit the cache once they are found
+   const std::size_t misses = c.misses(), hits = c.hits();
+   BOOST_TEST(c.find(5) == t.find(5));
+   BOOST_TEST(c.find(5) == t.find(5));
+   BOOST_TEST(c.lower_bound(5) == t.find(5));
+   BOOST_TEST_EQ(c.hits() + c.misses(), hits + misses + 3u);
+   BOOST_TEST(c.hits() >= hits + 2u);
+   //Absent keys are never cached
+   const std::size_t hits_before_absent = c.hits();
+   BOOST_TEST(c.find(4) == t.end());
+   BOOST_TEST(c.find(4) == t.end());
+   BOOST_TEST(c.lower_bound(4) == t.find(5));
+   BOOST_TEST_EQ(c.hits(), hits_before_absent);
+
+   //Lookups don't modify the tree
+   const std::size_t epoch = t.epoch();
+   check_lookups(c, -1, max_key + 1);
+   BOOST_TEST_EQ(t.epoch(), epoch);
+
+   //Elements erased through the tree are never returned nor accessed
+   BOOST_TEST(c.find(7) == t.find(7));
+   const cached_value *erased = &*t.find(7);
+   t.erase(t.find(7));
+   BOOST_TEST(t.epoch() != epoch);
+   BOOST_TEST(c.find(7) == t.find(7));
+   BOOST_TEST(c.find(7) == t.end() || &*c.find(7) != erased);
+   c.find(9);
+   std::size_t disposed = 0;
+   BOOST_TEST_EQ(t.erase_and_dispose(9, count_disposer(disposed)), multi ? 2u : 1u);
+   BOOST_TEST_EQ(disposed, multi ? 2u : 1u);
+   BOOST_TEST(c.find(9) == t.end());
+   BOOST_TEST(c.lower_bound(9) == t.find(11));
+   check_lookups(c, -1, max_key + 1);
+
+   //Replaced elements are not returned
+   cached_value replacement(13);
+   c.find(13);
+   t.replace_node(t.find(13), replacement);
+   BOOST_TEST(&*c.find(13) == &replacement);
+   check_lookups(c, -1, max_key + 1);
+
+   //Elements inserted before their equivalent elements are returned
+   cached_value first(15);
+   c.find(15);
+   t.insert(t.find(15), first);
+   BOOST_TEST(&*c.find(15) == &*t.find(15));
+   BOOST_TEST(multi == (&*c.find(15) == &first));
+   check_lookups(c, -1, max_key + 1);
+
+   //Only the first lookup after invalidating all the elements misses
+   c.invalidate();
+   const std::size_t misses_before = c.misses();
+   check_lookups(c, 17, 17);
+   BOOST_TEST_EQ(c.misses(), misses_before + 1u);
+   t.clear();
+   BOOST_TEST(c.find(17) == t.end());
+}
+
+template<class Tree>
+void test_tree(bool multi)
+{
+   test_cache<Tree, 64u, void>(multi);
+   test_cache<Tree, 1u, void>(multi);
+   test_cache<Tree, 16u, constant_hash>(multi);
+}
+
+int main()
+{
+   typedef modification_epoch<true> epoch_on;
+   typedef base_hook< bs_set_base_hook<> > bs_hook;
+   test_tree< set<cached_value, kov, epoch_on> >(false);
+   test_tree< multiset<cached_value, kov, epoch_on> >(true);
+   test_tree< avl_set<cached_value, kov, epoch_on> >(false);
+   test_tree< avl_multiset<cached_value, kov, epoch_on> >(true);
+   test_tree< sg_multiset<cached_value, kov, bs_hook, epoch_on> >(true);
+   return boost::report_errors();
+}
@@ -0,0 +1,232 @@
+/////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright agent 2026
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/intrusive for documentation.
+//
+/////////////////////////////////////////////////////////////////////////////
+#include <boost/config.hpp>
+#include <boost/core/lightweight_test.hpp>
+
+#if !defined(BOOST_NO_CXX11_HDR_ATOMIC) && !defined(BOOST_NO_CXX11_HDR_THREAD) && !defined(BOOST_NO_CXX11_LAMBDAS)
+
+#include <boost/intrusive/mpsc_queue.hpp>
+#include <boost/intrusive/slist.hpp>
+#include <cstddef>
+#include <vector>
+#include <thread>
+
+using namespace boost::intrusive;
+
+typedef slist_member_hook< link_mode<normal_link> > normal_member_hook_t;
+
+struct message
+   : public slist_base_hook<>
+{
+   std::size_t producer_;
+   std::size_t seq_;
+   normal_member_hook_t hook_;
+
+   explicit message(std::size_t seq = 0)
+      : producer_(0u), seq_(seq)
+   {}
+};
+
+typedef mpsc_queue<message>                                    base_queue_t;
+typedef slist<message>                                         base_slist_t;
+typedef slist<message, linear<true>, cache_last<true> >        base_linear_slist_t;
+typedef member_hook<message, normal_member_hook_t, &message::hook_> member_option_t;
+typedef mpsc_queue<message, member_option_t>                   member_queue_t;
+typedef slist<message, member_option_t>                        member_slist_t;
+
+const std::size_t NumElements = 100;
+
+template<class Queue, class Slist>
+void test_sequential(std::vector<message> &values)
+{
+   Queue q;
+   BOOST_TEST(q.empty());
+   BOOST_TEST(!q.pop());
+
+   //FIFO order, also when the queue is emptied between pushes
+   for(std::size_t i = 0; i != NumElements; ++i)
+      q.push(values[i]);
+   BOOST_TEST(!q.empty());
+   for(std::size_t i = 0; i != NumElements; ++i){
+      BOOST_TEST(q.pop() == &values[i]);
+      q.push(values[i]);
+   }
+   for(std::size_t i = 0; i != NumElements; ++i){
+      BOOST_TEST(!q.empty());
+      BOOST_TEST(q.pop() == &values[i]);
+   }
+   BOOST_TEST(q.empty());
+   BOOST_TEST(!q.pop());
+   q.push(values[0]);
+   BOOST_TEST(!q.empty());
+   BOOST_TEST(q.pop() == &values[0]);
+   BOOST_TEST(q.empty());
+
+   //A chain is pushed in order
+   {
+      Slist s;
+      for(std::size_t i = 0; i != NumElements/2u; ++i)
+         s.push_front(values[i]);
+      q.push(values[NumElements-1u]);
+      q.push_range(s);
+      BOOST_TEST(s.empty());
+      BOOST_TEST(q.pop() == &values[NumElements-1u]);
+      BOOST_TEST(q.pop() == &values[NumElements/2u - 1u]);
+      BOOST_TEST_EQ(q.pop_all(s), NumElements/2u - 1u);
+      BOOST_TEST(q.empty());
+      BOOST_TEST_EQ(s.size(), NumElements/2u - 1u);
+      std::size_t i = NumElements/2u - 1u;
+      for(typename Slist::iterator it(s.begin()); it != s.end(); ++it)
+         BOOST_TEST(&*it == &values[--i]);
+      BOOST_TEST_EQ(i, 0u);
+
+      //Popped elements are inserted before the existing ones
+      q.push(values[NumElements-2u]);
+      q.push(values[NumElements-1u]);
+      BOOST_TEST_EQ(q.pop_all(s), 2u);
+      BOOST_TEST(&s.front() == &values[NumElements-2u]);
+      BOOST_TEST(&*++s.begin() == &values[NumElements-1u]);
+      BOOST_TEST_EQ(q.pop_all(s), 0u);
+      BOOST_TEST_EQ(s.size(), NumElements/2u + 1u);
+      s.clear();
+   }
+
+   //Pushing an empty chain does nothing
+   {
+      Slist s;
+      q.push_range(s);
+      BOOST_TEST(q.empty());
+      BOOST_TEST_EQ(q.pop_all(s), 0u);
+      BOOST_TEST(s.empty());
+   }
+
+   //Elements left in the queue are unlinked when it's destroyed
+   {
+      Queue q2;
+      q2.push(values[0]);
+      q2.push(values[1]);
+   }
+}
+
+void test_safe_mode(std::vector<message> &values)
+{
+   {
+      base_queue_t q;
+      q.push(values[0]);
+      BOOST_TEST(values[0].is_linked());
+      q.push(values[1]);
+      BOOST_TEST(values[0].is_linked());
+      BOOST_TEST(values[1].is_linked());
+      BOOST_TEST(!q.pop()->is_linked());
+      BOOST_TEST(values[1].is_linked());
+   }
+   BOOST_TEST(!values[1].is_linked());
+   {
+      base_queue_t q;
+      base_linear_slist_t s;
+      s.push_back(values[0]);
+      s.push_back(values[1]);
+      q.push_range(s);
+      BOOST_TEST(values[0].is_linked());
+      BOOST_TEST(values[1].is_linked());
+      q.pop_all(s);
+      BOOST_TEST(&s.back() == &values[1]);
+      s.push_back(values[2]);
+      BOOST_TEST(&s.back() == &values[2]);
+      BOOST_TEST_EQ(s.size(), 3u);
+      s.clear();
+      BOOST_TEST(!values[1].is_linked());
+   }
+}
+
+//Several producers push their messages, one by one or in chains, while the
+//consumer pops them. Messages of each producer must be received in order.
+template<class Queue, class Slist>
+void test_concurrent()
+{
+   const std::size_t NumProducers = 4u;
+   const std::size_t NumMessages = 20000u;
+   std::vector<message> messages(NumProducers*NumMessages);
+   Queue q;
+
+   std::vector<std::thread> producers;
+   for(std::size_t t = 0; t != NumProducers; ++t){
+      producers.push_back(std::thread([&q, &messages, t]{
+         Slist s;
+         typename Slist::iterator last(s.before_begin());
+         for(std::size_t i = 0; i != NumMessages; ++i){
+            message &m = messages[t*NumMessages + i];
+            m.producer_ = t;
+            m.seq_ = i;
+            if(t & 1u){
+               last = s.insert_after(last, m);
+               if((i % 16u) == 15u || i == NumMessages - 1u){
+                  q.push_range(s);
+                  last = s.before_begin();
+               }
+            }
+            else{
+               q.push(m);
+            }
+         }
+      }));
+   }
+
+   std::vector<std::size_t> next_seq(NumProducers);
+   std::size_t received = 0;
+   Slist s;
+   while(received != NumProducers*NumMessages){
+      message *m = q.pop();
+      if(!m){
+         received += q.pop_all(s);
+         while(!s.empty()){
+            message &r = s.front();
+            s.pop_front();
+            BOOST_TEST_EQ(r.seq_, next_seq[r.producer_]++);
+         }
+         std::this_thread::yield();
+      }
+      else{
+         ++received;
+         BOOST_TEST_EQ(m->seq_, next_seq[m->producer_]++);
+      }
+   }
+   for(std::size_t t = 0; t != NumProducers; ++t){
+      producers[t].join();
+      BOOST_TEST_EQ(next_seq[t], NumMessages);
+   }
+   BOOST_TEST(q.empty());
+   BOOST_TEST(!q.pop());
+}
+
+int main()
+{
+   std::vector<message> values;
+   for(std::size_t i = 0; i != NumElements; ++i)
+      values.push_back(message(i));
+   test_sequential<base_queue_t, base_slist_t>(values);
+   test_sequential<base_queue_t, base_linear_slist_t>(values);
+   test_sequential<member_queue_t, member_slist_t>(values);
+   test_safe_mode(values);
+   test_concurrent<base_queue_t, base_slist_t>();
+   test_concurrent<member_queue_t, member_slist_t>();
+   return boost::report_errors();
+}
+
+#else
+
+int main()
+{
+   return boost::report_errors();
+}
+
+#endif
@@ -0,0 +1,253 @@
+/////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright agent 2026
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/intrusive for documentation.
+//
+/////////////////////////////////////////////////////////////////////////////
+#include <boost/intrusive/list.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include "smart_ptr.hpp"
+#include <cstddef>
+#include <vector>
+
+using namespace boost::intrusive;
+
+template<class VoidPointer>
+struct ord_value
+   : public list_base_hook< void_pointer<VoidPointer>, order_labels<true> >
+{
+   typedef list_member_hook< void_pointer<VoidPointer>, order_labels<true> > member_hook_t;
+
+   int value_;
+   member_hook_t hook_;
+
+   explicit ord_value(int v = 0)
+      : value_(v)
+   {}
+
+   friend bool operator <(const ord_value &a, const ord_value &b)
+   {  return a.value_ < b.value_;  }
+
+   friend bool operator ==(const ord_value &a, const ord_value &b)
+   {  return a.value_ == b.value_;  }
+};
+
+struct swap_base_hooks
+{
+   template<class V>
+   void operator()(V &a, V &b) const
+   {  a.swap_nodes(b);  }
+};
+
+struct swap_member_hooks
+{
+   template<class V>
+   void operator()(V &a, V &b) const
+   {  a.hook_.swap_nodes(b.hook_);  }
+};
+
+struct is_odd
+{
+   template<class V>
+   bool operator()(const V &v) const
+   {  return (v.value_ & 1) != 0;  }
+};
+
+template<class Value>
+struct next_slot
+{
+   Value *slot_;
+
+   explicit next_slot(Value *slot)
+      : slot_(slot)
+   {}
+
+   Value *operator()(Value &v)
+   {
+      slot_->value_ = v.value_;
+      return slot_++;
+   }
+};
+
+//Compares precedes() with the positions obtained traversing the list
+template<class List>
+void check_order(const List &l)
+{
+   typedef typename List::const_iterator const_iterator;
+   l.check();
+   std::vector<const_iterator> its;
+   for(const_iterator it(l.begin()); it != l.end(); ++it)
+      its.push_back(it);
+   its.push_back(l.end());
+   const std::size_t n = its.size();
+   const std::size_t stride = n < 64u ? 1u : n/31u;
+   for(std::size_t i = 0; i != n; ++i){
+      BOOST_TEST(!l.precedes(its[i], its[i]));
+      if(i + 1u != n){
+         BOOST_TEST(l.precedes(its[i], its[i + 1u]));
+         BOOST_TEST(!l.precedes(its[i + 1u], its[i]));
+      }
+      for(std::size_t j = i % stride; j < n; j += stride){
+         BOOST_TEST_EQ(l.precedes(its[i], its[j]), i < j);
+      }
+   }
+}
+
+template<class List, class SwapHooks>
+void test_order(std::vector<typename List::value_type> &values)
+{
+   typedef typename List::value_type value_type;
+   typedef typename List::iterator   iterator;
+   const std::size_t size = values.size();
+   List l;
+   check_order(l);
+   BOOST_TEST(!l.precedes(l.end(), l.end()));
+
+   //Alternating appends and prepends
+   for(std::size_t i = 0; i != size/4u; ++i){
+      if(i & 1u) l.push_back(values[i]);
+      else       l.push_front(values[i]);
+   }
+   check_order(l);
+
+   //Repeated insertions before the same element exhaust the gap between labels
+   iterator pos(l.begin());
+   ++pos;
+   for(std::size_t i = size/4u; i != size/2u; ++i)
+      l.insert(pos, values[i]);
+   check_order(l);
+
+   //Repeated insertions after the last inserted element
+   pos = l.begin();
+   for(std::size_t i = size/2u; i != 3u*size/4u; ++i)
+      pos = ++l.insert(pos, values[i]);
+   check_order(l);
+
+   //Insertions at scattered positions
+   {
+      std::size_t step = 0;
+      pos = l.begin();
+      for(std::size_t i = 3u*size/4u; i != size; ++i){
+         for(step = (step*7u + 3u) % 11u; step && pos != l.end(); --step)
+            ++pos;
+         if(pos == l.end())
+            pos = l.begin();
+         l.insert(pos, values[i]);
+      }
+   }
+   check_order(l);
+   BOOST_TEST_EQ(l.size(), size);
+
+   //Splices between lists
+   {
+      List other;
+      iterator b(l.begin()), e(l.begin());
+      std::advance(b, 3);
+      std::advance(e, 3 + size/3u);
+      other.splice(other.end(), l, b, e);
+      check_order(l);
+      check_order(other);
+      iterator p(l.begin());
+      std::advance(p, 5);
+      l.splice(p, other, other.begin());
+      check_order(l);
+      check_order(other);
+      b = other.begin();
+      std::advance(b, size/6u);
+      l.splice(l.begin(), other, b, other.end());
+      check_order(l);
+      check_order(other);
+      p = l.end();
+      --p;
+      l.splice(p, other);
+      check_order(l);
+      BOOST_TEST(other.empty());
+      BOOST_TEST_EQ(l.size(), size);
+   }
+
+   //Splices inside the list
+   {
+      iterator b(l.begin()), e(l.end()), p(l.begin());
+      std::advance(b, size/2u);
+      std::advance(p, 7);
+      l.splice(p, l, b, e);
+      check_order(l);
+      l.splice(l.end(), l, l.begin());
+      check_order(l);
+   }
+
+   //Reordering operations
+   l.reverse();
+   check_order(l);
+   l.shift_forward(3);
+   check_order(l);
+   l.shift_backwards(5);
+   check_order(l);
+   l.sort();
+   check_order(l);
+   {
+      List other;
+      for(int i = 0; i != 10; ++i){
+         value_type &v = *l.begin();
+         l.erase(l.begin());
+         other.push_back(v);
+      }
+      l.merge(other);
+      check_order(l);
+   }
+
+   //Hook swapping exchanges the positions and the labels
+   {
+      value_type &a = l.front(), &b = l.back();
+      SwapHooks()(a, b);
+      check_order(l);
+      BOOST_TEST(&l.front() == &b);
+      BOOST_TEST(&l.back()  == &a);
+   }
+
+   //Removals keep the order of the remaining elements
+   l.remove_if(is_odd());
+   check_order(l);
+
+   //Relocated elements take the position of the original ones
+   {
+      std::vector<value_type> slots(l.size());
+      l.relocate(next_slot<value_type>(&slots[0]));
+      check_order(l);
+      BOOST_TEST(&l.front() == &slots[0]);
+      l.clear();
+   }
+}
+
+template<class VoidPointer>
+void test_all()
+{
+   typedef ord_value<VoidPointer> value_t;
+   typedef list<value_t>          base_list_t;
+   typedef list< value_t, member_hook<value_t, typename value_t::member_hook_t, &value_t::hook_>
+               , constant_time_size<false> > member_list_t;
+
+   std::vector<value_t> values;
+   for(int i = 0; i != 2000; ++i)
+      values.push_back(value_t(i));
+   test_order<base_list_t, swap_base_hooks>(values);
+   test_order<member_list_t, swap_member_hooks>(values);
+
+   //Labels are only stored if requested
+   BOOST_TEST(base_list_t::order_labels);
+   BOOST_TEST(member_list_t::order_labels);
+   BOOST_TEST_EQ(sizeof(typename value_t::member_hook_t)
+                , sizeof(list_member_hook< void_pointer<VoidPointer> >) + sizeof(std::size_t));
+}
+
+int main()
+{
+   test_all<void*>();
+   test_all<boost::intrusive::smart_ptr<void> >();
+   return boost::report_errors();
+}
@@ -0,0 +1,333 @@
+/////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright agent 2026
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/intrusive for documentation.
+//
+/////////////////////////////////////////////////////////////////////////////
+#include <boost/intrusive/set.hpp>
+#include <boost/intrusive/avl_set.hpp>
+#include <boost/intrusive/sg_set.hpp>
+#include <boost/intrusive/treap_set.hpp>
+#include <boost/intrusive/splay_set.hpp>
+#include <boost/intrusive/bs_set.hpp>
+#include <boost/intrusive/unordered_set.hpp>
+#include <boost/intrusive/sequential_executor.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <boost/config.hpp>
+#include "smart_ptr.hpp"
+#include <cstdlib>
+#include <cstddef>
+#include <vector>
+
+#if !defined(BOOST_NO_CXX11_HDR_THREAD) && !defined(BOOST_NO_CXX11_HDR_ATOMIC) && !defined(BOOST_NO_CXX11_LAMBDAS)
+#  define BOOST_INTRUSIVE_TEST_THREADS
+#  include <thread>
+#  include <atomic>
+#  include <exception>
+#endif
+
+using namespace boost::intrusive;
+
+#if defined(BOOST_INTRUSIVE_TEST_THREADS)
+typedef std::atomic<long> counter_t;
+#else
+typedef long counter_t;
+#endif
+
+counter_t live_clones(0);
+
+template<class Hook>
+struct clone_value
+   : public Hook
+{
+   int value_;
+
+   explicit clone_value(int v = 0)
+      : value_(v)
+   {}
+
+   clone_value(const clone_value &other)
+      : Hook(), value_(other.value_)
+   {}
+
+   friend bool operator <(const clone_value &a, const clone_value &b)
+   {  return a.value_ < b.value_;  }
+
+   friend bool operator ==(const clone_value &a, const clone_value &b)
+   {  return a.value_ == b.value_;  }
+
+   friend std::size_t hash_value(const clone_value &v)
+   {  return std::size_t(v.value_);  }
+
+   friend bool priority_order(const clone_value &a, const clone_value &b)
+   {  return (unsigned(a.value_)*2654435761u) < (unsigned(b.value_)*2654435761u);  }
+};
+
+struct throw_on_clone {};
+
+//Throws when the clone number "throw_at_" is requested (the calls
+//are counted only with deterministic executors)
+struct new_cloner
+{
+   explicit new_cloner(long *count = 0, long throw_at = -1)
+      : count_(count), throw_at_(throw_at)
+   {}
+
+   template<class V>
+   V *operator()(const V &v) const
+   {
+      if(count_ && (*count_)++ == throw_at_)
+         throw throw_on_clone();
+      ++live_clones;
+      return new V(v);
+   }
+
+   long *count_;
+   long throw_at_;
+};
+
+struct delete_disposer
+{
+   template<class P>
+   void operator()(P p) const
+   {  --live_clones; delete &*p;  }
+};
+
+//Runs tasks in the calling thread counting forks. If "reverse_" is true
+//runs the second task first to check tasks don't depend on their order.
+struct counting_executor
+{
+   counting_executor(std::size_t *forks, bool reverse)
+      : forks_(forks), reverse_(reverse)
+   {}
+
+   template<class F, class G>
+   void operator()(F f, G g) const
+   {
+      ++*forks_;
+      if(reverse_){
+         g();
+         f();
+      }
+      else{
+         f();
+         g();
+      }
+   }
+
+   std::size_t *forks_;
+   bool reverse_;
+};
+
+#if defined(BOOST_INTRUSIVE_TEST_THREADS)
+
+//Runs the first task in a new thread
+struct thread_executor
+{
+   template<class F, class G>
+   void operator()(F f, G g) const
+   {
+      std::exception_ptr error;
+      std::thread t([&f, &error]{
+         try{ f(); }
+         catch(...){ error = std::current_exception(); }
+      });
+      try{
+         g();
+      }
+      catch(...){
+         t.join();
+         throw;
+      }
+      t.join();
+      if(error)
+         std::rethrow_exception(error);
+   }
+};
+
+#endif
+
+template<class Container>
+void fill(Container &c, std::vector<typename Container::value_type> &values, std::size_t size, int dup)
+{
+   typedef typename Container::value_type value_type;
+   values.clear();
+   values.reserve(size);
+   for(std::size_t i = 0; i != size; ++i)
+      values.push_back(value_type(int(i)/dup));
+   for(std::size_t i = 0; i != size; ++i)
+      c.insert(values[(i*7919u) % size]);
+}
+
+template<class Tree>
+bool same_trees(const Tree &a, const Tree &b)
+{
+   typedef typename Tree::node_traits node_traits;
+   a.check();
+   b.check();
+   if(a.size() != b.size())
+      return false;
+   for(typename Tree::const_iterator ia(a.begin()), ib(b.begin()); ia != a.end(); ++ia, ++ib){
+      if(!(*ia == *ib) || &*ia == &*ib)
+         return false;
+      //Same shape: the parents of the nodes hold the same values
+      const typename Tree::const_node_ptr pa(node_traits::get_parent(ia.pointed_node()));
+      const typename Tree::const_node_ptr pb(node_traits::get_parent(ib.pointed_node()));
+      const bool root_a = pa == a.end().pointed_node();
+      const bool root_b = pb == b.end().pointed_node();
+      if(root_a != root_b)
+         return false;
+      if(!root_a && !(*Tree::value_traits::to_value_ptr(pa) == *Tree::value_traits::to_value_ptr(pb)))
+         return false;
+   }
+   return true;
+}
+
+template<class Unordered>
+bool same_tables(const Unordered &a, const Unordered &b)
+{
+   a.check();
+   b.check();
+   if(a.size() != b.size() || a.bucket_count() != b.bucket_count())
+      return false;
+   for(typename Unordered::size_type n = 0; n != a.bucket_count(); ++n){
+      typename Unordered::const_local_iterator ia(a.begin(n)), ib(b.begin(n));
+      for(; ia != a.end(n) && ib != b.end(n); ++ia, ++ib){
+         if(!(*ia == *ib) || &*ia == &*ib)
+            return false;
+      }
+      if(ia != a.end(n) || ib != b.end(n))
+         return false;
+   }
+   return true;
+}
+
+struct tree_traits
+{
+   template<class Tree>
+   static bool same(const Tree &a, const Tree &b)
+   {  return same_trees(a, b);  }
+};
+
+struct unordered_traits
+{
+   template<class Unordered>
+   static bool same(const Unordered &a, const Unordered &b)
+   {  return same_tables(a, b);  }
+};
+
+//Expected forks for a size: none, only for big containers, or unknown
+enum fork_mode { no_forks, big_forks, any_forks };
+
+template<class Traits, class Container>
+void test_clone(Container &src, Container &dst, Container &ref, int dup, fork_mode mode)
+{
+   typedef typename Container::value_type value_type;
+   const std::size_t sizes[] = { 0, 1, 100, 5000, 40000 };
+   for(std::size_t i = 0; i != sizeof(sizes)/sizeof(sizes[0]); ++i){
+      std::vector<value_type> values;
+      fill(src, values, sizes[i], dup);
+      ref.clone_from(src, new_cloner(), delete_disposer());
+      for(int reverse = 0; reverse != 2; ++reverse){
+         std::size_t forks = 0;
+         dst.clone_from(src, new_cloner(), delete_disposer(), counting_executor(&forks, reverse != 0));
+         BOOST_TEST(Traits::same(ref, dst));
+         if(mode == big_forks)
+            BOOST_TEST_EQ(forks != 0u, sizes[i] >= 2048u);
+         else if(mode == no_forks)
+            BOOST_TEST_EQ(forks, 0u);
+         BOOST_TEST(forks <= 15u);
+      }
+      dst.clone_from(src, new_cloner(), delete_disposer(), sequential_executor());
+      BOOST_TEST(Traits::same(ref, dst));
+      #if defined(BOOST_INTRUSIVE_TEST_THREADS)
+      dst.clone_from(src, new_cloner(), delete_disposer(), thread_executor());
+      BOOST_TEST(Traits::same(ref, dst));
+      #endif
+
+      //A failed clone disposes all cloned elements
+      if(sizes[i]){
+         const long throw_at[] = { 0, long(sizes[i]/3), long(sizes[i] - 1) };
+         for(std::size_t j = 0; j != sizeof(throw_at)/sizeof(throw_at[0]); ++j){
+            const long live_before = live_clones - long(dst.size());
+            long count = 0;
+            std::size_t forks = 0;
+            bool thrown = false;
+            try{
+               dst.clone_from(src, new_cloner(&count, throw_at[j]), delete_disposer(), counting_executor(&forks, j % 2 != 0));
+            }
+            catch(throw_on_clone &){
+               thrown = true;
+            }
+            BOOST_TEST(thrown);
+            BOOST_TEST(dst.empty());
+            dst.check();
+            BOOST_TEST_EQ(long(live_clones), live_before);
+         }
+      }
+      dst.clear_and_dispose(delete_disposer());
+      ref.clear_and_dispose(delete_disposer());
+      src.clear();
+   }
+   BOOST_TEST_EQ(long(live_clones), 0);
+}
+
+template<class Tree>
+void test_tree(int dup, fork_mode mode = big_forks)
+{
+   Tree src, dst, ref;
+   test_clone<tree_traits>(src, dst, ref, dup, mode);
+}
+
+template<class Unordered>
+void test_unordered(int dup, std::size_t src_buckets, std::size_t dst_buckets, fork_mode mode)
+{
+   typedef typename Unordered::bucket_type    bucket_type;
+   typedef typename Unordered::bucket_traits  bucket_traits;
+   typedef typename Unordered::bucket_ptr     bucket_ptr;
+   std::vector<bucket_type> src_b(src_buckets), dst_b(dst_buckets), ref_b(dst_buckets);
+   Unordered src(bucket_traits(pointer_traits<bucket_ptr>::pointer_to(src_b[0]), src_b.size()));
+   Unordered dst(bucket_traits(pointer_traits<bucket_ptr>::pointer_to(dst_b[0]), dst_b.size()));
+   Unordered ref(bucket_traits(pointer_traits<bucket_ptr>::pointer_to(ref_b[0]), ref_b.size()));
+   test_clone<unordered_traits>(src, dst, ref, dup, mode);
+}
+
+template<class VoidPointer>
+void test_all()
+{
+   typedef clone_value< set_base_hook< void_pointer<VoidPointer> > >     rb_value;
+   typedef clone_value< avl_set_base_hook< void_pointer<VoidPointer> > > avl_value;
+   typedef clone_value< bs_set_base_hook< void_pointer<VoidPointer> > >  bs_value;
+   typedef clone_value< unordered_set_base_hook< void_pointer<VoidPointer> > > hash_value;
+   typedef clone_value< unordered_set_base_hook< void_pointer<VoidPointer>
+                                               , optimize_multikey<true>
+                                               , store_hash<true> > >    multikey_value;
+
+   test_tree< set<rb_value> >(1);
+   test_tree< multiset<rb_value, constant_time_size<false> > >(4, any_forks);
+   test_tree< avl_multiset<avl_value> >(4);
+   test_tree< sg_set<bs_value> >(1);
+   test_tree< treap_multiset<bs_value> >(4);
+   test_tree< splay_multiset<bs_value> >(4);
+   test_tree< bs_multiset<bs_value> >(4);
+
+   test_unordered< unordered_set<hash_value> >(1, 1031, 1031, big_forks);
+   test_unordered< unordered_multiset<hash_value> >(4, 1024, 256, big_forks);
+   test_unordered< unordered_multiset<multikey_value, cache_begin<true>, power_2_buckets<true> > >(4, 2048, 512, big_forks);
+   test_unordered< unordered_set<hash_value, constant_time_size<false> > >(1, 67, 67, any_forks);
+   //Fallback to the sequential clone
+   test_unordered< unordered_set<hash_value> >(1, 256, 1024, no_forks);
+   test_unordered< unordered_set<hash_value, incremental<true>, power_2_buckets<true> > >(1, 512, 512, no_forks);
+}
+
+int main()
+{
+   test_all<void*>();
+   test_all<boost::intrusive::smart_ptr<void> >();
+   return boost::report_errors();
+}
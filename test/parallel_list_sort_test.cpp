@@ -0,0 +1,240 @@
+/////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright agent 2026
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/intrusive for documentation.
+//
+/////////////////////////////////////////////////////////////////////////////
+#include <boost/intrusive/list.hpp>
+#include <boost/intrusive/sequential_executor.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <boost/config.hpp>
+#include "smart_ptr.hpp"
+#include <cstddef>
+#include <vector>
+#include <algorithm>
+
+#if !defined(BOOST_NO_CXX11_HDR_THREAD) && !defined(BOOST_NO_CXX11_LAMBDAS)
+#  define BOOST_INTRUSIVE_TEST_THREADS
+#  include <thread>
+#  include <exception>
+#endif
+
+using namespace boost::intrusive;
+
+template<class VoidPointer>
+struct sort_value
+   : public list_base_hook< void_pointer<VoidPointer> >
+{
+   typedef list_member_hook< void_pointer<VoidPointer>, order_labels<true> > member_hook_t;
+
+   int key_;
+   member_hook_t hook_;
+
+   explicit sort_value(int key = 0)
+      : key_(key)
+   {}
+};
+
+struct key_less
+{
+   template<class V>
+   bool operator()(const V &a, const V &b) const
+   {  return a.key_ < b.key_;  }
+};
+
+struct key_ptr_less
+{
+   template<class V>
+   bool operator()(const V *a, const V *b) const
+   {  return a->key_ < b->key_;  }
+};
+
+struct throw_on_compare {};
+
+//Throws after "count" comparisons (only used with deterministic executors)
+struct throwing_less
+{
+   explicit throwing_less(long *count)
+      : count_(count)
+   {}
+
+   template<class V>
+   bool operator()(const V &a, const V &b) const
+   {
+      if(!(*count_)--)
+         throw throw_on_compare();
+      return a.key_ < b.key_;
+   }
+
+   long *count_;
+};
+
+struct counting_executor
+{
+   counting_executor(std::size_t *forks, bool reverse)
+      : forks_(forks), reverse_(reverse)
+   {}
+
+   template<class F, class G>
+   void operator()(F f, G g) const
+   {
+      ++*forks_;
+      if(reverse_){
+         g();
+         f();
+      }
+      else{
+         f();
+         g();
+      }
+   }
+
+   std::size_t *forks_;
+   bool reverse_;
+};
+
+#if defined(BOOST_INTRUSIVE_TEST_THREADS)
+
+//Runs the first task in a new thread
+struct thread_executor
+{
+   template<class F, class G>
+   void operator()(F f, G g) const
+   {
+      std::exception_ptr error;
+      std::thread t([&f, &error]{
+         try{ f(); }
+         catch(...){ error = std::current_exception(); }
+      });
+      try{
+         g();
+      }
+      catch(...){
+         t.join();
+         throw;
+      }
+      t.join();
+      if(error)
+         std::rethrow_exception(error);
+   }
+};
+
+#endif
+
+template<class List>
+void fill(List &l, std::vector<typename List::value_type> &values, std::size_t n, int distinct)
+{
+   l.clear();
+   for(std::size_t i = 0; i != n; ++i){
+      values[i].key_ = int((i*2654435761u) % unsigned(distinct));
+      l.push_back(values[i]);
+   }
+}
+
+//The result must be the one of a stable sort
+template<class List>
+bool is_stable_sorted(const List &l, std::vector<typename List::value_type> &values, std::size_t n)
+{
+   typedef typename List::value_type value_type;
+   std::vector<value_type*> expected;
+   for(std::size_t i = 0; i != n; ++i)
+      expected.push_back(&values[i]);
+   std::stable_sort(expected.begin(), expected.end(), key_ptr_less());
+   l.check();
+   if(l.size() != n)
+      return false;
+   std::size_t i = 0;
+   for(typename List::const_iterator it(l.begin()); it != l.end(); ++it, ++i){
+      if(&*it != expected[i])
+         return false;
+   }
+   return true;
+}
+
+template<class List>
+void test_sort(std::vector<typename List::value_type> &values)
+{
+   const std::size_t sizes[] = { 0, 1, 2, 1000, 2048, 5000, 40000 };
+   const std::size_t forks[] = { 0, 0, 0, 0,    1,    3,    15    };
+   for(std::size_t s = 0; s != sizeof(sizes)/sizeof(sizes[0]); ++s){
+      const std::size_t n = sizes[s];
+      List l;
+
+      fill(l, values, n, 100);
+      l.sort(key_less(), sequential_executor());
+      BOOST_TEST(is_stable_sorted(l, values, n));
+
+      //Tasks may run in any order
+      for(int r = 0; r != 2; ++r){
+         std::size_t f = 0;
+         fill(l, values, n, 7);
+         l.sort(key_less(), counting_executor(&f, r != 0));
+         BOOST_TEST(is_stable_sorted(l, values, n));
+         BOOST_TEST_EQ(f, forks[s]);
+      }
+
+      //Sorted and reversed lists
+      fill(l, values, n, 1000003);
+      l.sort(key_less(), sequential_executor());
+      l.sort(key_less(), sequential_executor());
+      BOOST_TEST(is_stable_sorted(l, values, n));
+      l.reverse();
+      l.sort(key_less(), sequential_executor());
+      BOOST_TEST(is_stable_sorted(l, values, n));
+
+      #if defined(BOOST_INTRUSIVE_TEST_THREADS)
+      fill(l, values, n, 1000003);
+      l.sort(key_less(), thread_executor());
+      BOOST_TEST(is_stable_sorted(l, values, n));
+      fill(l, values, n, 3);
+      l.sort(key_less(), thread_executor());
+      BOOST_TEST(is_stable_sorted(l, values, n));
+      #endif
+
+      //A throwing predicate leaves a valid list
+      if(n){
+         for(long at = 0; at < long(n*4u); at = at*3 + 1){
+            fill(l, values, n, 100);
+            long count = at;
+            std::size_t f = 0;
+            bool thrown = false;
+            try{
+               l.sort(throwing_less(&count), counting_executor(&f, false));
+            }
+            catch(throw_on_compare &){
+               thrown = true;
+            }
+            l.check();
+            BOOST_TEST_EQ(l.size(), n);
+            if(!thrown)
+               BOOST_TEST(is_stable_sorted(l, values, n));
+         }
+      }
+      l.clear();
+   }
+}
+
+template<class VoidPointer>
+void test_all()
+{
+   typedef sort_value<VoidPointer> value_t;
+   typedef list<value_t>           base_list_t;
+   typedef list< value_t, member_hook<value_t, typename value_t::member_hook_t, &value_t::hook_>
+               , constant_time_size<false> > member_list_t;
+
+   std::vector<value_t> values(40000);
+   test_sort<base_list_t>(values);
+   test_sort<member_list_t>(values);
+}
+
+int main()
+{
+   test_all<void*>();
+   test_all<boost::intrusive::smart_ptr<void> >();
+   return boost::report_errors();
+}
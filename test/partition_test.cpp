@@ -0,0 +1,167 @@
+/////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright agent 2026
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/intrusive for documentation.
+//
+/////////////////////////////////////////////////////////////////////////////
+#include <boost/intrusive/set.hpp>
+#include <boost/intrusive/avl_set.hpp>
+#include <boost/intrusive/sg_set.hpp>
+#include <boost/intrusive/treap_set.hpp>
+#include <boost/intrusive/splay_set.hpp>
+#include <boost/intrusive/bs_set.hpp>
+#include <boost/intrusive/unordered_set.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include "smart_ptr.hpp"
+#include <cstdlib>
+#include <cstddef>
+#include <vector>
+#include <iterator>
+#include <utility>
+
+using namespace boost::intrusive;
+
+template<class Hook>
+struct part_value
+   : public Hook
+{
+   int value_;
+   int visits_;
+
+   explicit part_value(int v = 0)
+      : value_(v), visits_(0)
+   {}
+
+   friend bool operator <(const part_value &a, const part_value &b)
+   {  return a.value_ < b.value_;  }
+
+   friend bool operator ==(const part_value &a, const part_value &b)
+   {  return a.value_ == b.value_;  }
+
+   friend std::size_t hash_value(const part_value &v)
+   {  return std::size_t(v.value_);  }
+
+   friend bool priority_order(const part_value &a, const part_value &b)
+   {  return (unsigned(a.value_)*2654435761u) < (unsigned(b.value_)*2654435761u);  }
+};
+
+//Checks that the ranges are consecutive, cover the container and visit each element
+//once. Returns the size of the biggest range.
+template<class Container, class Iterator>
+std::size_t check_ranges
+   (Container &c, const std::vector< std::pair<Iterator, Iterator> > &ranges, std::size_t k)
+{
+   BOOST_TEST_EQ(ranges.size(), k);
+   std::size_t total = 0, biggest = 0;
+   for(std::size_t i = 0; i != ranges.size(); ++i){
+      if(i == 0)
+         BOOST_TEST(ranges[i].first == Iterator(c.begin()));
+      else
+         BOOST_TEST(ranges[i].first == ranges[i-1].second);
+      std::size_t n = 0;
+      for(Iterator it(ranges[i].first); it != ranges[i].second; ++it, ++n)
+         ++const_cast<int&>(it->visits_);
+      total += n;
+      if(n > biggest)
+         biggest = n;
+   }
+   if(!ranges.empty())
+      BOOST_TEST(ranges.back().second == Iterator(c.end()));
+   BOOST_TEST_EQ(total, k ? c.size() : 0u);
+   for(typename Container::iterator it(c.begin()); it != c.end(); ++it){
+      BOOST_TEST_EQ(it->visits_, k ? 1 : 0);
+      it->visits_ = 0;
+   }
+   return biggest;
+}
+
+//"max_ratio" bounds the size of the biggest range relative to size()/k for
+//big containers and a few partitions, zero if partitions are not balanced
+template<class Container>
+void test_partition(Container &c, int dup, unsigned max_ratio)
+{
+   typedef typename Container::value_type     value_type;
+   typedef typename Container::iterator       iterator;
+   typedef typename Container::const_iterator const_iterator;
+   const std::size_t sizes[] = { 0, 1, 10, 1000, 20000 };
+   const std::size_t ks[] = { 0, 1, 2, 3, 7, 16, 100 };
+   for(std::size_t i = 0; i != sizeof(sizes)/sizeof(sizes[0]); ++i){
+      std::vector<value_type> values;
+      values.reserve(sizes[i]);
+      for(std::size_t j = 0; j != sizes[i]; ++j)
+         values.push_back(value_type(int(j)/dup));
+      for(std::size_t j = 0; j != sizes[i]; ++j)
+         c.insert(values[(j*7919u) % sizes[i]]);
+      for(std::size_t j = 0; j != sizeof(ks)/sizeof(ks[0]); ++j){
+         const std::size_t k = ks[j];
+         std::vector< std::pair<iterator, iterator> > ranges;
+         c.partition(k, std::back_inserter(ranges));
+         const std::size_t biggest = check_ranges(c, ranges, k);
+         if(max_ratio && k && k <= 16u && sizes[i] >= 10000u)
+            BOOST_TEST(biggest*k <= max_ratio*sizes[i]);
+
+         std::vector< std::pair<const_iterator, const_iterator> > cranges;
+         const Container &cc = c;
+         cc.partition(k, std::back_inserter(cranges));
+         check_ranges(c, cranges, k);
+         for(std::size_t r = 0; r != k; ++r){
+            BOOST_TEST(cranges[r].first  == const_iterator(ranges[r].first));
+            BOOST_TEST(cranges[r].second == const_iterator(ranges[r].second));
+         }
+      }
+      c.clear();
+   }
+}
+
+template<class Tree>
+void test_tree(int dup, unsigned max_ratio)
+{
+   Tree t;
+   test_partition(t, dup, max_ratio);
+}
+
+template<class Unordered>
+void test_unordered(int dup, unsigned max_ratio)
+{
+   typedef typename Unordered::bucket_type    bucket_type;
+   typedef typename Unordered::bucket_traits  bucket_traits;
+   typedef typename Unordered::bucket_ptr     bucket_ptr;
+   std::vector<bucket_type> buckets(1024);
+   Unordered u(bucket_traits(pointer_traits<bucket_ptr>::pointer_to(buckets[0]), buckets.size()));
+   test_partition(u, dup, max_ratio);
+}
+
+template<class VoidPointer>
+void test_all()
+{
+   typedef part_value< set_base_hook< void_pointer<VoidPointer> > >     rb_value;
+   typedef part_value< avl_set_base_hook< void_pointer<VoidPointer> > > avl_value;
+   typedef part_value< bs_set_base_hook< void_pointer<VoidPointer> > >  bs_value;
+   typedef part_value< unordered_set_base_hook< void_pointer<VoidPointer> > > hash_value;
+
+   //Balanced trees
+   test_tree< set<rb_value> >(1, 3);
+   test_tree< multiset<rb_value, constant_time_size<false> > >(4, 3);
+   test_tree< avl_multiset<avl_value> >(4, 3);
+   test_tree< sg_set<bs_value> >(1, 4);
+   //Randomized or unbalanced trees
+   test_tree< treap_multiset<bs_value> >(4, 0);
+   test_tree< splay_multiset<bs_value> >(4, 0);
+   test_tree< bs_multiset<bs_value> >(4, 0);
+
+   test_unordered< unordered_set<hash_value> >(1, 2);
+   test_unordered< unordered_multiset<hash_value, cache_begin<true> > >(4, 2);
+   test_unordered< unordered_set<hash_value, incremental<true>, power_2_buckets<true> > >(1, 2);
+}
+
+int main()
+{
+   test_all<void*>();
+   test_all<boost::intrusive::smart_ptr<void> >();
+   return boost::report_errors();
+}
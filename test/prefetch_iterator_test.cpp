@@ -0,0 +1,157 @@
+/////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright agent 2026
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/intrusive for documentation.
+//
+/////////////////////////////////////////////////////////////////////////////
+#include <boost/intrusive/prefetch_iterator.hpp>
+#include <boost/intrusive/list.hpp>
+#include <boost/intrusive/slist.hpp>
+#include <boost/intrusive/set.hpp>
+#include <boost/intrusive/avl_set.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include "smart_ptr.hpp"
+#include <vector>
+
+using namespace boost::intrusive;
+
+template<class VoidPointer>
+struct scan_value
+   : public list_base_hook< void_pointer<VoidPointer> >
+   , public slist_base_hook< void_pointer<VoidPointer> >
+   , public set_base_hook< void_pointer<VoidPointer> >
+   , public avl_set_base_hook< void_pointer<VoidPointer> >
+{
+   int value_;
+
+   explicit scan_value(int v = 0)
+      : value_(v)
+   {}
+
+   friend bool operator <(const scan_value &a, const scan_value &b)
+   {  return a.value_ < b.value_;  }
+};
+
+struct collect
+{
+   explicit collect(std::vector<int> &v) : v_(&v) {}
+
+   template<class V>
+   void operator()(const V &x)
+   {  v_->push_back(x.value_);  }
+
+   std::vector<int> *v_;
+};
+
+struct increment
+{
+   template<class V>
+   void operator()(V &x)
+   {  ++x.value_;  }
+};
+
+template<class Container>
+std::vector<int> plain_scan(const Container &c)
+{
+   std::vector<int> v;
+   for(typename Container::const_iterator it = c.begin(); it != c.end(); ++it)
+      v.push_back(it->value_);
+   return v;
+}
+
+template<std::size_t Distance, class Container>
+void test_distance(Container &c)
+{
+   const std::vector<int> expected(plain_scan(c));
+
+   //Iterator adaptor
+   {
+      typedef prefetch_iterator<typename Container::iterator, Distance> piterator;
+      std::vector<int> got;
+      const piterator end(c.end(), c.end());
+      for(piterator it(c.begin(), c.end()); it != end; ++it){
+         BOOST_TEST(&*it == &*it.base());
+         BOOST_TEST(&it->value_ == &it.base()->value_);
+         got.push_back(it->value_);
+      }
+      BOOST_TEST(got == expected);
+   }
+   {
+      std::vector<int> got;
+      typename Container::const_iterator b(c.begin()), e(c.end());
+      for(prefetch_iterator<typename Container::const_iterator, Distance> it(make_prefetch_iterator<Distance>(b, e))
+         ; it.base() != e; it++){
+         got.push_back(it->value_);
+      }
+      BOOST_TEST(got == expected);
+   }
+   //Algorithms
+   {
+      std::vector<int> got;
+      for_each_prefetched<Distance>(c, collect(got));
+      BOOST_TEST(got == expected);
+      got.clear();
+      const Container &cc = c;
+      for_each_prefetched<Distance>(cc.begin(), cc.end(), collect(got));
+      BOOST_TEST(got == expected);
+   }
+}
+
+template<class Container>
+void test_container(Container &c)
+{
+   test_distance<1>(c);
+   test_distance<4>(c);
+   test_distance<64>(c);
+
+   //Default distance and mutable access
+   const std::vector<int> before(plain_scan(c));
+   for_each_prefetched(c, increment());
+   std::vector<int> after;
+   for_each_prefetched(c.begin(), c.end(), collect(after));
+   BOOST_TEST_EQ(after.size(), before.size());
+   for(std::size_t i = 0; i != after.size(); ++i)
+      BOOST_TEST_EQ(after[i], before[i] + 1);
+   for_each_prefetched(c, increment());
+}
+
+template<class VoidPointer>
+void test_prefetch_iterator()
+{
+   typedef scan_value<VoidPointer> value_type;
+   typedef list<value_type>        list_t;
+   typedef slist<value_type>       slist_t;
+   typedef multiset<value_type>    multiset_t;
+   typedef avl_multiset<value_type> avl_multiset_t;
+
+   const std::size_t sizes[] = { 0, 1, 3, 100 };
+   for(std::size_t s = 0; s != sizeof(sizes)/sizeof(sizes[0]); ++s){
+      std::vector<value_type> values;
+      for(std::size_t i = 0; i != sizes[s]; ++i)
+         values.push_back(value_type(int((i*7u) % 13u)));
+      list_t l(values.begin(), values.end());
+      slist_t sl(values.begin(), values.end());
+      multiset_t ms(values.begin(), values.end());
+      avl_multiset_t ams(values.begin(), values.end());
+      test_container(l);
+      test_container(sl);
+      test_container(ms);
+      test_container(ams);
+      l.clear();
+      sl.clear();
+      ms.clear();
+      ams.clear();
+   }
+}
+
+int main()
+{
+   test_prefetch_iterator<void*>();
+   test_prefetch_iterator<boost::intrusive::smart_ptr<void> >();
+   return boost::report_errors();
+}
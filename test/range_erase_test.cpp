@@ -0,0 +1,171 @@
+/////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright agent 2026
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/intrusive for documentation.
+//
+/////////////////////////////////////////////////////////////////////////////
+#include <boost/intrusive/set.hpp>
+#include <boost/intrusive/avl_set.hpp>
+#include <boost/intrusive/sg_set.hpp>
+#include <boost/intrusive/treap_set.hpp>
+#include <boost/intrusive/splay_set.hpp>
+#include <boost/intrusive/bs_set.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include "smart_ptr.hpp"
+#include <cstdlib>
+#include <vector>
+#include <algorithm>
+
+using namespace boost::intrusive;
+
+template<class Hook>
+struct range_value
+   : public Hook
+{
+   int value_;
+   bool disposed_;
+
+   explicit range_value(int v = 0)
+      : value_(v), disposed_(false)
+   {}
+
+   friend bool operator <(const range_value &a, const range_value &b)
+   {  return a.value_ < b.value_;  }
+
+   friend bool priority_order(const range_value &a, const range_value &b)
+   {  return (unsigned(a.value_)*2654435761u) < (unsigned(b.value_)*2654435761u);  }
+};
+
+struct ptr_less
+{
+   template<class T>
+   bool operator()(const T *a, const T *b) const
+   {  return *a < *b;  }
+};
+
+struct mark_disposer
+{
+   template<class P>
+   void operator()(P p)
+   {  BOOST_TEST(!p->disposed_); p->disposed_ = true;  }
+};
+
+template<class Set>
+bool equal_to_ref(const Set &s, const std::vector<const typename Set::value_type*> &ref)
+{
+   s.check();
+   if(s.size() != ref.size())
+      return false;
+   typename Set::const_iterator it(s.begin());
+   for(std::size_t i = 0; i != ref.size(); ++i, ++it){
+      if(&*it != ref[i])
+         return false;
+   }
+   typename Set::const_reverse_iterator rit(s.rbegin());
+   for(std::size_t i = ref.size(); i != 0; --i, ++rit){
+      if(&*rit != ref[i-1])
+         return false;
+   }
+   return it == s.end() && rit == s.rend();
+}
+
+template<class Set>
+void test_range_erase(std::size_t size)
+{
+   typedef typename Set::value_type value_type;
+   typedef typename Set::iterator iterator;
+   typedef std::vector<const value_type*> ref_t;
+
+   for(std::size_t round = 0; round != 8; ++round){
+      std::vector<value_type> values;
+      for(std::size_t i = 0; i != size; ++i)
+         values.push_back(value_type(int(i)));
+      Set s;
+      //Insert in random order so that the tree has different shapes
+      std::vector<std::size_t> order;
+      for(std::size_t i = 0; i != size; ++i)
+         order.push_back(i);
+      for(std::size_t i = size; i > 1; --i){
+         const std::size_t j = std::size_t(std::rand()) % i;
+         const std::size_t tmp = order[i-1];
+         order[i-1] = order[j];
+         order[j] = tmp;
+      }
+      for(std::size_t i = 0; i != size; ++i)
+         s.insert(values[order[i]]);
+      ref_t ref;
+      for(std::size_t i = 0; i != size; ++i)
+         ref.push_back(&values[i]);
+      BOOST_TEST(equal_to_ref(s, ref));
+
+      //Erase random ranges, short and long ones, until the container is empty
+      while(!ref.empty()){
+         std::size_t first = std::size_t(std::rand()) % (ref.size() + 1);
+         std::size_t last  = first + std::size_t(std::rand()) % (ref.size() + 1 - first);
+         if(std::rand() % 4 == 0)
+            first = 0;
+         else if(std::rand() % 4 == 0)
+            last = ref.size();
+         iterator b(s.begin()), e(s.begin());
+         for(std::size_t i = 0; i != first; ++i)
+            ++b;
+         for(std::size_t i = 0; i != last; ++i)
+            ++e;
+         iterator ret;
+         if(round % 2){
+            ret = s.erase_and_dispose(b, e, mark_disposer());
+            for(std::size_t i = first; i != last; ++i)
+               BOOST_TEST(ref[i]->disposed_);
+         }
+         else{
+            ret = s.erase(b, e);
+         }
+         BOOST_TEST(ret == e);
+         ref.erase(ref.begin() + std::ptrdiff_t(first), ref.begin() + std::ptrdiff_t(last));
+         BOOST_TEST(equal_to_ref(s, ref));
+         //The container is still usable after the erasure
+         if(first != last && std::rand() % 2){
+            value_type &v = values[std::size_t(std::rand()) % size];
+            if(!v.is_linked()){
+               v.disposed_ = false;
+               s.insert(v);
+               ref.insert(std::upper_bound(ref.begin(), ref.end(), &v, ptr_less()), &v);
+               BOOST_TEST(equal_to_ref(s, ref));
+            }
+         }
+      }
+      BOOST_TEST(s.empty());
+      for(std::size_t i = 0; i != size; ++i)
+         BOOST_TEST(!values[i].is_linked());
+   }
+}
+
+template<class VoidPointer>
+void test_all()
+{
+   typedef range_value< set_base_hook< void_pointer<VoidPointer> > >     rb_value;
+   typedef range_value< avl_set_base_hook< void_pointer<VoidPointer> > > avl_value;
+   typedef range_value< bs_set_base_hook< void_pointer<VoidPointer> > >  bs_value;
+   const std::size_t sizes[] = { 0, 1, 5, 9, 17, 100, 1000 };
+   for(std::size_t i = 0; i != sizeof(sizes)/sizeof(sizes[0]); ++i){
+      test_range_erase< multiset<rb_value> >(sizes[i]);
+      test_range_erase< set<rb_value, constant_time_size<false> > >(sizes[i]);
+      test_range_erase< avl_multiset<avl_value> >(sizes[i]);
+      test_range_erase< sg_multiset<bs_value> >(sizes[i]);
+      test_range_erase< treap_multiset<bs_value> >(sizes[i]);
+      test_range_erase< splay_multiset<bs_value> >(sizes[i]);
+      test_range_erase< bs_multiset<bs_value> >(sizes[i]);
+   }
+}
+
+int main()
+{
+   test_all<void*>();
+   test_all<boost::intrusive::smart_ptr<void> >();
+   return boost::report_errors();
+}
@@ -0,0 +1,194 @@
+/////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright agent 2026
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/intrusive for documentation.
+//
+/////////////////////////////////////////////////////////////////////////////
+#include <boost/intrusive/set.hpp>
+#include <boost/intrusive/avl_set.hpp>
+#include <boost/intrusive/sg_set.hpp>
+#include <boost/intrusive/splay_set.hpp>
+#include <boost/intrusive/treap_set.hpp>
+#include <boost/intrusive/list.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <cstddef>
+#include <vector>
+
+using namespace boost::intrusive;
+
+template<link_mode_type LinkMode>
+struct reloc_value
+   : public set_base_hook< link_mode<LinkMode> >
+   , public avl_set_base_hook< link_mode<LinkMode> >
+   , public bs_set_base_hook< link_mode<LinkMode> >
+   , public list_base_hook< link_mode<LinkMode> >
+{
+   int value_;
+
+   explicit reloc_value(int v = 0)
+      : value_(v)
+   {}
+
+   friend bool operator <(const reloc_value &a, const reloc_value &b)
+   {  return a.value_ < b.value_;  }
+
+   friend bool priority_order(const reloc_value &a, const reloc_value &b)
+   {  return (a.value_*7919) % 1000 < (b.value_*7919) % 1000;  }
+};
+
+//Copies values into a preallocated buffer in the visiting order,
+//leaving every third element in place.
+template<class Value>
+class arena_relocator
+{
+   public:
+   explicit arena_relocator(std::vector<Value> &arena)
+      : arena_(arena)
+   {}
+
+   Value *operator()(Value &v)
+   {
+      if(v.value_ % 3 == 0)
+         return &v;
+      BOOST_TEST(arena_.size() < arena_.capacity());
+      arena_.push_back(v);
+      return &arena_.back();
+   }
+
+   private:
+   std::vector<Value> &arena_;
+};
+
+struct count_disposer
+{
+   explicit count_disposer(std::size_t &c) : count_(c) {}
+   template<class P>
+   void operator()(P)
+   {  ++count_;  }
+   std::size_t &count_;
+};
+
+template<class Value>
+struct reloc_storage
+{
+   explicit reloc_storage(std::size_t n)
+      : values_(), arena_()
+   {
+      arena_.reserve(n);
+      values_.reserve(n);
+      for(std::size_t i = 0; i != n; ++i)
+         values_.push_back(Value(int((i*7919u) % n)));
+   }
+
+   std::vector<Value> values_;
+   std::vector<Value> arena_;
+};
+
+//Counts the values that are still linked in a container of type Container
+template<class Container>
+std::size_t count_linked(const std::vector<typename Container::value_type> &values)
+{
+   typedef typename Container::value_traits     value_traits;
+   typedef typename Container::node_algorithms  node_algorithms;
+   std::size_t linked = 0;
+   for(std::size_t i = 0; i != values.size(); ++i)
+      linked += std::size_t(!node_algorithms::inited(value_traits::to_node_ptr(values[i])));
+   return linked;
+}
+
+template<class Container>
+void check_relocated(Container &c, reloc_storage<typename Container::value_type> &s)
+{
+   typedef typename Container::value_type value_type;
+   //Relocated elements were placed in traversal order
+   const value_type *last = 0;
+   int i = 0;
+   for(typename Container::iterator it = c.begin(); it != c.end(); ++it, ++i){
+      BOOST_TEST_EQ(it->value_, i);
+      const bool in_arena = &*it >= s.arena_.data() && &*it < s.arena_.data() + s.arena_.size();
+      BOOST_TEST_EQ(in_arena, (i % 3 != 0));
+      if(in_arena){
+         BOOST_TEST(!last || last < &*it);
+         last = &*it;
+      }
+   }
+   BOOST_TEST_EQ(std::size_t(i), s.values_.size());
+   BOOST_TEST_EQ(c.size(), s.values_.size());
+}
+
+template<class Set>
+void test_tree(bool safe)
+{
+   typedef typename Set::value_type value_type;
+   const std::size_t N = 300u;
+   reloc_storage<value_type> s(N);
+   Set c(s.values_.begin(), s.values_.end());
+   std::size_t disposed = 0;
+   c.relocate(arena_relocator<value_type>(s.arena_), count_disposer(disposed));
+   BOOST_TEST_EQ(disposed, s.arena_.size());
+   check_relocated(c, s);
+   c.check();
+
+   //The relocated tree is fully functional
+   for(std::size_t i = 0; i != N; ++i){
+      typename Set::iterator it = c.find(value_type(int(i)));
+      BOOST_TEST(it != c.end() && it->value_ == int(i));
+   }
+   if(safe){
+      BOOST_TEST_EQ(count_linked<Set>(s.values_), N - s.arena_.size());
+   }
+   for(std::size_t i = 0; i < N; i += 2u){
+      c.erase(value_type(int(i)));
+   }
+   c.check();
+   BOOST_TEST_EQ(c.size(), N/2u);
+   c.clear();
+}
+
+template<class List>
+void test_list(bool safe)
+{
+   typedef typename List::value_type value_type;
+   const std::size_t N = 300u;
+   reloc_storage<value_type> s(N);
+   List c;
+   c.insert(c.end(), s.values_.begin(), s.values_.end());
+   //Sort by value so that the expected traversal order is 0, 1, 2...
+   c.sort();
+   c.relocate(arena_relocator<value_type>(s.arena_));
+   check_relocated(c, s);
+   int i = int(N);
+   for(typename List::reverse_iterator it = c.rbegin(); it != c.rend(); ++it){
+      BOOST_TEST_EQ(it->value_, --i);
+   }
+   if(safe){
+      BOOST_TEST_EQ(count_linked<List>(s.values_), N - s.arena_.size());
+   }
+   c.clear();
+}
+
+template<link_mode_type LinkMode>
+void test_all()
+{
+   typedef reloc_value<LinkMode> value_t;
+   const bool safe = LinkMode == safe_link;
+   test_tree< set<value_t> >(safe);
+   test_tree< multiset<value_t> >(safe);
+   test_tree< avl_set<value_t> >(safe);
+   test_tree< sg_set<value_t, base_hook< bs_set_base_hook< link_mode<LinkMode> > > > >(safe);
+   test_tree< splay_set<value_t, base_hook< bs_set_base_hook< link_mode<LinkMode> > > > >(safe);
+   test_tree< treap_set<value_t, base_hook< bs_set_base_hook< link_mode<LinkMode> > > > >(safe);
+   test_list< list<value_t> >(safe);
+}
+
+int main()
+{
+   test_all<safe_link>();
+   test_all<normal_link>();
+   return boost::report_errors();
+}
@@ -0,0 +1,172 @@
+/////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright agent 2026
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/intrusive for documentation.
+//
+/////////////////////////////////////////////////////////////////////////////
+#include <boost/intrusive/set_intersection_view.hpp>
+#include <boost/intrusive/set.hpp>
+#include <boost/intrusive/avl_set.hpp>
+#include <boost/intrusive/sg_set.hpp>
+#include <boost/intrusive/splay_set.hpp>
+#include <boost/intrusive/treap_set.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <vector>
+
+using namespace boost::intrusive;
+
+struct join_value
+   : public set_base_hook<>
+   , public avl_set_base_hook<>
+   , public bs_set_base_hook<>
+{
+   int key_;
+   explicit join_value(int k = 0) : key_(k) {}
+
+   friend bool priority_order(const join_value &a, const join_value &b)
+   {  return unsigned(a.key_)*2654435761u < unsigned(b.key_)*2654435761u;  }
+};
+
+struct key_of_join_value
+{
+   typedef int type;
+
+   const int &operator()(const join_value &v) const
+   {  return v.key_;  }
+};
+
+std::size_t comparisons = 0;
+
+struct counting_less
+{
+   bool operator()(int a, int b) const
+   {  ++comparisons; return a < b;  }
+};
+
+typedef key_of_value<key_of_join_value> kov;
+typedef compare<counting_less>          cmp;
+
+template<class Tree>
+void test_lower_bound_from(Tree &t)
+{
+   //For every finger, all keys greater than the elements before the finger
+   for(typename Tree::iterator f = t.begin(); f != t.end(); ++f){
+      typename Tree::iterator prev(f);
+      const int lo = f == t.begin() ? f->key_ - 2 : (--prev)->key_ + 1;
+      const int hi = (--t.end())->key_ + 2;
+      for(int k = lo; k <= hi; ++k){
+         BOOST_TEST(t.lower_bound_from(f, k) == t.lower_bound(k));
+         BOOST_TEST(static_cast<const Tree&>(t).lower_bound_from(f, k) == t.lower_bound(k));
+      }
+   }
+   BOOST_TEST(t.lower_bound_from(t.end(), 0) == t.end());
+}
+
+struct pair_checker
+{
+   explicit pair_checker(std::vector<int> &v) : v_(v) {}
+   void operator()(const join_value &x, const join_value &y)
+   {
+      BOOST_TEST_EQ(x.key_, y.key_);
+      v_.push_back(x.key_);
+   }
+   std::vector<int> &v_;
+};
+
+struct null_join
+{
+   void operator()(const join_value &, const join_value &)
+   {}
+};
+
+template<class FirstTree, class SecondTree>
+void check_intersection(FirstTree &a, SecondTree &b)
+{
+   std::vector<int> ka, kb, expected, got, got_second;
+   for(typename FirstTree::const_iterator it = a.begin(); it != a.end(); ++it)  ka.push_back(it->key_);
+   for(typename SecondTree::const_iterator it = b.begin(); it != b.end(); ++it) kb.push_back(it->key_);
+   std::set_intersection(ka.begin(), ka.end(), kb.begin(), kb.end(), std::back_inserter(expected));
+
+   typedef set_intersection_view<FirstTree, SecondTree> view_t;
+   const view_t v(a, b);
+   for(typename view_t::iterator it = v.begin(); it != v.end(); ++it){
+      got.push_back(it->key_);
+      got_second.push_back(it.second()->key_);
+      BOOST_TEST(&*it == &*it.first());
+   }
+   BOOST_TEST(got == expected);
+   BOOST_TEST(got_second == expected);
+
+   //merge_join visits the same pairs
+   std::vector<int> joined;
+   BOOST_TEST_EQ(merge_join(a, b, pair_checker(joined)), expected.size());
+   BOOST_TEST(joined == expected);
+}
+
+template<class Tree>
+void test_tree(bool multi)
+{
+   std::vector<join_value> small_values, large_values;
+   for(int i = 0; i != 40; ++i){
+      small_values.push_back(join_value((i*7919) % 400));
+      if(multi && i % 3 == 0)
+         small_values.push_back(join_value((i*7919) % 400));
+   }
+   for(int i = 0; i != 1000; ++i){
+      large_values.push_back(join_value(i % 500));
+   }
+   Tree small_tree(small_values.begin(), small_values.end());
+   Tree large_tree(large_values.begin(), large_values.end());
+   Tree empty_tree;
+
+   test_lower_bound_from(small_tree);
+   test_lower_bound_from(empty_tree);
+
+   check_intersection(small_tree, large_tree);
+   check_intersection(large_tree, small_tree);
+   check_intersection(small_tree, small_tree);
+   check_intersection(small_tree, empty_tree);
+   check_intersection(empty_tree, large_tree);
+   const Tree &csmall = small_tree;
+   check_intersection(csmall, large_tree);
+   small_tree.clear();
+   large_tree.clear();
+}
+
+//Intersecting a small tree with a large one does not visit the large one linearly
+void test_galloping()
+{
+   typedef set<join_value, kov, cmp> set_t;
+   std::vector<join_value> small_values, large_values;
+   const int N = 100000;
+   for(int i = 0; i != 10; ++i)  small_values.push_back(join_value(i*(N/10) + 1));
+   for(int i = 0; i != N; ++i)   large_values.push_back(join_value(i));
+   set_t small_set(small_values.begin(), small_values.end());
+   set_t large_set(large_values.begin(), large_values.end());
+   comparisons = 0;
+   BOOST_TEST_EQ(merge_join(small_set, large_set, null_join()), 10u);
+   BOOST_TEST(comparisons < std::size_t(N/100));
+   small_set.clear();
+   large_set.clear();
+}
+
+int main()
+{
+   typedef base_hook< bs_set_base_hook<> > bs_hook;
+   test_tree< set<join_value, kov, cmp> >(false);
+   test_tree< multiset<join_value, kov, cmp> >(true);
+   test_tree< avl_multiset<join_value, kov, cmp> >(true);
+   test_tree< sg_multiset<join_value, kov, cmp, bs_hook> >(true);
+   test_tree< splay_multiset<join_value, kov, cmp, bs_hook> >(true);
+   test_tree< treap_multiset<join_value, kov, cmp, bs_hook> >(true);
+   test_galloping();
+   return boost::report_errors();
+}
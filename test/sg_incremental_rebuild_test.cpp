@@ -0,0 +1,288 @@
+/////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright agent 2026
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/intrusive for documentation.
+//
+/////////////////////////////////////////////////////////////////////////////
+#include <boost/intrusive/sg_set.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include "smart_ptr.hpp"
+#include <cstdlib>
+#include <cstddef>
+#include <vector>
+
+using namespace boost::intrusive;
+
+template<class VoidPointer>
+struct sg_value
+   : public bs_set_base_hook< void_pointer<VoidPointer> >
+{
+   int value_;
+
+   explicit sg_value(int v = 0)
+      : value_(v)
+   {}
+
+   friend bool operator <(const sg_value &a, const sg_value &b)
+   {  return a.value_ < b.value_;  }
+
+   friend bool operator ==(const sg_value &a, const sg_value &b)
+   {  return a.value_ == b.value_;  }
+};
+
+template<class Tree>
+std::size_t tree_height(Tree &t)
+{
+   typedef typename Tree::node_traits node_traits;
+   typedef typename Tree::node_ptr    node_ptr;
+   std::size_t height = 0;
+   if(!t.empty()){
+      const node_ptr root(t.root().pointed_node());
+      for(typename Tree::iterator it(t.begin()); it != t.end(); ++it){
+         std::size_t depth = 1;
+         for(node_ptr n(it.pointed_node()); n != root; n = node_traits::get_parent(n))
+            ++depth;
+         if(depth > height)
+            height = depth;
+      }
+   }
+   return height;
+}
+
+template<class Tree>
+bool all_found(const Tree &t, const std::vector<typename Tree::value_type> &values)
+{
+   t.check();
+   std::size_t linked = 0;
+   for(std::size_t i = 0; i != values.size(); ++i){
+      if(values[i].is_linked()){
+         ++linked;
+         if(t.find(values[i]) == t.end())
+            return false;
+      }
+   }
+   return linked == t.size();
+}
+
+template<class Tree>
+void finish(Tree &t)
+{
+   while(t.rebalance_step(1u))
+      t.check();
+   BOOST_TEST(!t.rebalance_pending());
+}
+
+//Random insertions and erasures, checking the tree after each operation
+template<class Tree>
+void test_random(std::size_t budget)
+{
+   typedef typename Tree::value_type value_type;
+   const std::size_t size = 500;
+   std::vector<value_type> values;
+   for(std::size_t i = 0; i != size; ++i)
+      values.push_back(value_type(int(i % 200)));
+
+   Tree t;
+   t.rebalance_budget(budget);
+   BOOST_TEST_EQ(t.rebalance_budget(), budget);
+   for(std::size_t op = 0; op != 4000; ++op){
+      value_type &v = values[std::size_t(std::rand()) % size];
+      if(!v.is_linked()){
+         if(std::rand() % 3)
+            t.insert(v);
+         else
+            t.insert(t.upper_bound(v), v);
+      }
+      else{
+         t.erase(t.iterator_to(v));
+      }
+      t.check();
+      if(op % 64 == 0)
+         BOOST_TEST(all_found(t, values));
+   }
+   BOOST_TEST(all_found(t, values));
+   finish(t);
+   BOOST_TEST(all_found(t, values));
+   t.clear();
+}
+
+//Ascending insertions (the worst case for a scapegoat tree) interleaved with lookups
+template<class Tree>
+void test_ascending(std::size_t budget)
+{
+   typedef typename Tree::value_type value_type;
+   const std::size_t size = 2000;
+   std::vector<value_type> values;
+   for(std::size_t i = 0; i != size; ++i)
+      values.push_back(value_type(int(i)));
+
+   Tree t;
+   t.rebalance_budget(budget);
+   bool pending = false;
+   for(std::size_t i = 0; i != size; ++i){
+      if(i % 2)
+         t.push_back(values[i]);
+      else
+         t.insert(values[i]);
+      pending = pending || t.rebalance_pending();
+      BOOST_TEST(t.find(values[i/2]) != t.end());
+      BOOST_TEST(t.find(values[i]) != t.end());
+   }
+   BOOST_TEST(pending);
+   BOOST_TEST(all_found(t, values));
+   //Budgets above the amortized cost of the rebuilds (logarithmic
+   //in the size of the tree) don't fall behind the insertions
+   if(budget >= 64u)
+      BOOST_TEST(tree_height(t) < 64u);
+   finish(t);
+   BOOST_TEST(all_found(t, values));
+
+   //Erasing most of the elements rebuilds the whole tree incrementally
+   for(std::size_t i = 0; i != size; ++i){
+      if(i % 8)
+         t.erase(t.iterator_to(values[i]));
+   }
+   BOOST_TEST(all_found(t, values));
+   finish(t);
+   BOOST_TEST(tree_height(t) < 16u);
+   t.clear();
+}
+
+struct is_odd
+{
+   template<class V>
+   bool operator()(const V &v) const
+   {  return (v.value_ % 2) != 0;  }
+};
+
+//Ascending insertions with the minimum budget leave a pending rebuild
+template<class Tree>
+void fill_pending(Tree &t, std::vector<typename Tree::value_type> &values)
+{
+   t.rebalance_budget(1u);
+   for(std::size_t i = 0; i != values.size(); ++i)
+      t.push_back(values[i]);
+   BOOST_TEST(t.rebalance_pending());
+}
+
+//Operations that restructure the tree while a rebuild is pending
+template<class Tree>
+void test_pending_operations()
+{
+   typedef typename Tree::value_type value_type;
+   const std::size_t size = 300;
+   std::vector<value_type> values, values2, replacements;
+   for(std::size_t i = 0; i != size; ++i){
+      values.push_back(value_type(int(i)));
+      values2.push_back(value_type(int(i)));
+      replacements.push_back(value_type(int(i)));
+   }
+
+   {  //swap, move, clear
+      Tree a, b;
+      fill_pending(a, values);
+      b.rebalance_budget(7u);
+      b.swap(a);
+      BOOST_TEST_EQ(a.rebalance_budget(), 7u);
+      BOOST_TEST_EQ(b.rebalance_budget(), 1u);
+      BOOST_TEST(!b.rebalance_pending());
+      BOOST_TEST(all_found(b, values));
+      b.erase(b.begin());
+      b.insert(values[0]);
+      BOOST_TEST(all_found(b, values));
+      Tree c(::boost::move(b));
+      BOOST_TEST(b.empty());
+      BOOST_TEST(all_found(c, values));
+      c.erase(c.iterator_to(values[size/2]));
+      BOOST_TEST(all_found(c, values));
+      c.clear();
+      BOOST_TEST(!c.rebalance_pending());
+   }
+   {  //replace_node of the elements while the rebuild is pending
+      Tree t;
+      fill_pending(t, values);
+      for(std::size_t i = 0; i != size; ++i){
+         t.replace_node(t.iterator_to(values[i]), replacements[i]);
+         t.rebalance_step(1u);
+         t.check();
+      }
+      BOOST_TEST(all_found(t, replacements));
+      finish(t);
+      BOOST_TEST(all_found(t, replacements));
+      t.clear();
+   }
+   {  //Range erasure, erase_if and erasure of the nodes used by the rebuild
+      Tree t;
+      fill_pending(t, values);
+      t.erase(t.iterator_to(values[size/4]), t.iterator_to(values[size/2]));
+      BOOST_TEST(all_found(t, values));
+      t.erase_if(is_odd());
+      BOOST_TEST(all_found(t, values));
+      while(!t.empty()){
+         t.erase(t.root());
+         t.check();
+      }
+      BOOST_TEST(!t.rebalance_pending());
+   }
+   {  //Merge and one-shot mode
+      Tree a, b;
+      fill_pending(a, values);
+      fill_pending(b, values2);
+      a.merge_equal(b);
+      BOOST_TEST(b.empty());
+      BOOST_TEST_EQ(a.size(), 2*size);
+      a.check();
+      a.rebalance_budget(0u);
+      BOOST_TEST(!a.rebalance_pending());
+      a.check();
+      a.clear();
+   }
+}
+
+template<class VoidPointer>
+void test_all()
+{
+   typedef sg_value<VoidPointer> value_type;
+   typedef sg_multiset<value_type, incremental_rebuild<true> > multiset_t;
+   typedef sg_multiset<value_type, floating_point<false>, incremental_rebuild<true> > fixed_alpha_multiset_t;
+   typedef sg_multiset<value_type, constant_time_size<false>, incremental_rebuild<true> > non_constant_size_multiset_t;
+
+   const std::size_t budgets[] = { 1u, 4u, 64u };
+   for(std::size_t i = 0; i != sizeof(budgets)/sizeof(budgets[0]); ++i){
+      test_random<multiset_t>(budgets[i]);
+      test_random<fixed_alpha_multiset_t>(budgets[i]);
+      test_random<non_constant_size_multiset_t>(budgets[i]);
+      test_ascending<multiset_t>(budgets[i]);
+      test_ascending<fixed_alpha_multiset_t>(budgets[i]);
+   }
+   test_pending_operations<multiset_t>();
+
+   //Without the option unbalanced subtrees are rebuilt when detected
+   {
+      typedef sg_multiset<value_type> one_shot_multiset_t;
+      std::vector<value_type> values;
+      for(std::size_t i = 0; i != 100u; ++i)
+         values.push_back(value_type(int(i)));
+      one_shot_multiset_t t;
+      for(std::size_t i = 0; i != values.size(); ++i){
+         t.push_back(values[i]);
+         BOOST_TEST(!t.rebalance_pending());
+      }
+      BOOST_TEST_EQ(t.rebalance_budget(), 0u);
+      BOOST_TEST(!t.rebalance_step(10u));
+      BOOST_TEST(all_found(t, values));
+      t.clear();
+   }
+}
+
+int main()
+{
+   test_all<void*>();
+   test_all<boost::intrusive::smart_ptr<void> >();
+   return boost::report_errors();
+}
@@ -0,0 +1,281 @@
+/////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright agent 2026
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/intrusive for documentation.
+//
+/////////////////////////////////////////////////////////////////////////////
+#include <boost/intrusive/side_table_value_traits.hpp>
+#include <boost/intrusive/list.hpp>
+#include <boost/intrusive/slist.hpp>
+#include <boost/intrusive/set.hpp>
+#include <boost/intrusive/avl_set.hpp>
+#include <boost/intrusive/bs_set.hpp>
+#include <boost/intrusive/sg_set.hpp>
+#include <boost/intrusive/splay_set.hpp>
+#include <boost/intrusive/treap_set.hpp>
+#include <boost/intrusive/unordered_set.hpp>
+#include <boost/intrusive/arena_ptr.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include "smart_ptr.hpp"
+#include <cstddef>
+#include <new>
+#include <vector>
+
+using namespace boost::intrusive;
+
+//Values don't store hooks
+struct payload
+{
+   int key_;
+   int data_[7];
+
+   explicit payload(int key = 0)
+      : key_(key)
+   {}
+
+   friend bool operator <(const payload &a, const payload &b)
+   {  return a.key_ < b.key_;  }
+
+   friend bool operator ==(const payload &a, const payload &b)
+   {  return a.key_ == b.key_;  }
+
+   friend std::size_t hash_value(const payload &v)
+   {  return std::size_t(v.key_);  }
+
+   friend bool priority_order(const payload &a, const payload &b)
+   {  return (unsigned(a.key_)*2654435761u) < (unsigned(b.key_)*2654435761u);  }
+};
+
+struct is_odd_key
+{
+   bool operator()(const payload &v) const
+   {  return (v.key_ & 1) != 0;  }
+};
+
+const std::size_t NumElements = 500;
+
+template<class Container>
+void test_iterator_to(Container &c, std::vector<payload> &values)
+{
+   for(std::size_t i = 0; i != NumElements; ++i){
+      BOOST_TEST(&*c.iterator_to(values[i]) == &values[i]);
+      const Container &cc = c;
+      BOOST_TEST(&*cc.iterator_to(values[i]) == &values[i]);
+   }
+}
+
+template<class Traits, class Sequence>
+void test_sequence(Traits traits, std::vector<payload> &values)
+{
+   Sequence s(traits);
+   for(std::size_t i = 0; i != NumElements; ++i)
+      s.push_front(values[i]);
+   BOOST_TEST_EQ(s.size(), NumElements);
+   test_iterator_to(s, values);
+   std::size_t id = NumElements;
+   for(typename Sequence::iterator it(s.begin()); it != s.end(); ++it)
+      BOOST_TEST_EQ(traits.id(*it), --id);
+   s.sort();
+   BOOST_TEST(&s.front() == &values[0]);
+   s.remove_if(is_odd_key());
+   BOOST_TEST_EQ(s.size(), NumElements/2u);
+   s.check();
+   s.clear();
+}
+
+template<class Set>
+void test_set(Set &s, std::vector<payload> &values)
+{
+   for(std::size_t i = 0; i != NumElements; ++i)
+      BOOST_TEST(s.insert(values[(i*7u) % NumElements]).second);
+   BOOST_TEST_EQ(s.size(), NumElements);
+   test_iterator_to(s, values);
+   std::size_t id = 0;
+   for(typename Set::iterator it(s.begin()); it != s.end(); ++it, ++id)
+      BOOST_TEST(&*it == &values[id]);
+   for(std::size_t i = 0; i < NumElements; i += 2u)
+      s.erase(s.iterator_to(values[i]));
+   BOOST_TEST_EQ(s.size(), NumElements/2u);
+   BOOST_TEST(s.find(payload(1)) != s.end());
+   BOOST_TEST(s.find(payload(2)) == s.end());
+   s.check();
+   s.clear();
+}
+
+template<class Traits, class USet>
+void test_unordered(Traits traits, std::vector<payload> &values)
+{
+   std::vector<typename USet::bucket_type> buckets(NumElements);
+   USet s(typename USet::bucket_traits(pointer_traits<typename USet::bucket_ptr>::pointer_to(buckets[0]), buckets.size())
+         , typename USet::hasher(), typename USet::key_equal(), traits);
+   for(std::size_t i = 0; i != NumElements; ++i)
+      BOOST_TEST(s.insert(values[i]).second);
+   BOOST_TEST_EQ(s.size(), NumElements);
+   test_iterator_to(s, values);
+   for(std::size_t i = 0; i != NumElements; ++i){
+      typename USet::iterator it(s.find(payload(int(i))));
+      BOOST_TEST(it != s.end() && &*it == &values[i]);
+   }
+   for(std::size_t i = 0; i < NumElements; i += 2u)
+      s.erase(s.iterator_to(values[i]));
+   BOOST_TEST_EQ(s.size(), NumElements/2u);
+   s.check();
+   s.clear();
+}
+
+template<class VoidPointer>
+void test_all()
+{
+   typedef list_member_hook< void_pointer<VoidPointer> >          list_hook_t;
+   typedef slist_member_hook< void_pointer<VoidPointer> >         slist_hook_t;
+   typedef set_member_hook< void_pointer<VoidPointer> >           set_hook_t;
+   typedef avl_set_member_hook< void_pointer<VoidPointer> >       avl_hook_t;
+   typedef bs_set_member_hook< void_pointer<VoidPointer> >        bs_hook_t;
+   typedef unordered_set_member_hook
+      < void_pointer<VoidPointer>, store_hash<true> >             uset_hook_t;
+
+   typedef side_table_value_traits<payload, list_hook_t>    list_traits_t;
+   typedef side_table_value_traits<payload, slist_hook_t>   slist_traits_t;
+   typedef side_table_value_traits<payload, set_hook_t>     set_traits_t;
+   typedef side_table_value_traits<payload, avl_hook_t>     avl_traits_t;
+   typedef side_table_value_traits<payload, bs_hook_t>      bs_traits_t;
+   typedef side_table_value_traits<payload, uset_hook_t>    uset_traits_t;
+
+   std::vector<payload> values;
+   for(std::size_t i = 0; i != NumElements; ++i)
+      values.push_back(payload(int(i)));
+
+   //Each container uses its own side table of hooks
+   std::vector<list_hook_t>   list_hooks(NumElements);
+   std::vector<slist_hook_t>  slist_hooks(NumElements);
+   std::vector<set_hook_t>    set_hooks(NumElements);
+   std::vector<avl_hook_t>    avl_hooks(NumElements);
+   std::vector<bs_hook_t>     bs_hooks(NumElements);
+   std::vector<uset_hook_t>   uset_hooks(NumElements);
+
+   const list_traits_t  list_traits (&values[0], &list_hooks[0]);
+   const slist_traits_t slist_traits(&values[0], &slist_hooks[0]);
+   const set_traits_t   set_traits  (&values[0], &set_hooks[0]);
+   const avl_traits_t   avl_traits  (&values[0], &avl_hooks[0]);
+   const bs_traits_t    bs_traits   (&values[0], &bs_hooks[0]);
+   const uset_traits_t  uset_traits (&values[0], &uset_hooks[0]);
+
+   BOOST_TEST_EQ(list_traits.id(values[7]), 7u);
+   BOOST_TEST(&list_traits.hook(7) == &list_hooks[7]);
+   BOOST_TEST(&list_traits.value(7) == &values[7]);
+
+   test_sequence<list_traits_t,  list <payload, value_traits<list_traits_t> > >(list_traits, values);
+   test_sequence<slist_traits_t, slist<payload, value_traits<slist_traits_t> > >(slist_traits, values);
+   {
+      set<payload, value_traits<set_traits_t> > s(std::less<payload>(), set_traits);
+      test_set(s, values);
+   }
+   {
+      avl_set<payload, value_traits<avl_traits_t> > s(std::less<payload>(), avl_traits);
+      test_set(s, values);
+   }
+   {
+      bs_set<payload, value_traits<bs_traits_t> > s(std::less<payload>(), bs_traits);
+      test_set(s, values);
+   }
+   {
+      sg_set<payload, value_traits<bs_traits_t> > s(std::less<payload>(), bs_traits);
+      test_set(s, values);
+   }
+   {
+      splay_set<payload, value_traits<bs_traits_t> > s(std::less<payload>(), bs_traits);
+      test_set(s, values);
+   }
+   {
+      treap_set<payload, value_traits<bs_traits_t> > s(std::less<payload>(), priority_compare<payload>(), bs_traits);
+      test_set(s, values);
+   }
+   test_unordered<uset_traits_t, unordered_set<payload, value_traits<uset_traits_t> > >(uset_traits, values);
+
+   //A value can be linked in several containers at the same time
+   {
+      list <payload, value_traits<list_traits_t> > l(list_traits);
+      set  <payload, value_traits<set_traits_t> >  s(std::less<payload>(), set_traits);
+      for(std::size_t i = 0; i != NumElements; ++i){
+         l.push_back(values[i]);
+         s.insert(values[NumElements - 1u - i]);
+      }
+      BOOST_TEST(&*l.begin() == &*s.begin());
+      BOOST_TEST(list_hooks[3].is_linked());
+      BOOST_TEST(set_hooks[3].is_linked());
+      l.clear();
+      s.clear();
+      BOOST_TEST(!list_hooks[3].is_linked());
+   }
+}
+
+//Hooks storing 32 bit links. All the objects addressed by arena pointers
+//(values, hooks and containers, as they hold header nodes) are placed in the arena.
+typedef arena_ptr<void>                                     arena_void_ptr;
+typedef list_member_hook< void_pointer<arena_void_ptr> >    arena_list_hook_t;
+typedef set_member_hook< void_pointer<arena_void_ptr> >     arena_set_hook_t;
+typedef side_table_value_traits<payload, arena_list_hook_t> arena_list_traits_t;
+typedef side_table_value_traits<payload, arena_set_hook_t>  arena_set_traits_t;
+typedef list<payload, value_traits<arena_list_traits_t> >   arena_list_t;
+typedef set<payload, value_traits<arena_set_traits_t> >     arena_set_t;
+
+struct arena_storage
+{
+   payload           values_[NumElements];
+   arena_list_hook_t list_hooks_[NumElements];
+   arena_set_hook_t  set_hooks_[NumElements];
+   union
+   {
+      detail::max_align align_;
+      char list_[sizeof(arena_list_t)];
+      char set_[sizeof(arena_set_t)];
+   } list_storage_, set_storage_;
+};
+
+union arena_buffer
+{
+   detail::max_align align_;
+   char buf_[sizeof(arena_storage)];
+};
+
+static arena_buffer arena;
+
+void test_arena()
+{
+   arena_void_ptr::set_arena_base(&arena);
+   arena_storage *a = ::new(&arena) arena_storage;
+   BOOST_TEST(sizeof(arena_list_hook_t) == 2u*sizeof(boost::uint32_t));
+
+   const arena_list_traits_t list_traits(a->values_, a->list_hooks_);
+   const arena_set_traits_t  set_traits (a->values_, a->set_hooks_);
+   arena_list_t &l = *::new(&a->list_storage_) arena_list_t(list_traits);
+   arena_set_t  &s = *::new(&a->set_storage_) arena_set_t(std::less<payload>(), set_traits);
+   for(std::size_t i = 0; i != NumElements; ++i){
+      a->values_[i].key_ = int(NumElements - 1u - i);
+      l.push_back(a->values_[i]);
+      s.insert(a->values_[i]);
+   }
+   BOOST_TEST(&l.back() == &*s.begin());
+   BOOST_TEST(&*l.iterator_to(a->values_[5]) == &a->values_[5]);
+   BOOST_TEST(&*s.iterator_to(a->values_[5]) == &a->values_[5]);
+   l.check();
+   s.check();
+   l.clear();
+   s.clear();
+   l.~arena_list_t();
+   s.~arena_set_t();
+   a->~arena_storage();
+}
+
+int main()
+{
+   test_all<void*>();
+   test_all<boost::intrusive::smart_ptr<void> >();
+   test_arena();
+   return boost::report_errors();
+}
@@ -0,0 +1,247 @@
+/////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright agent 2026
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/intrusive for documentation.
+//
+/////////////////////////////////////////////////////////////////////////////
+#include <boost/intrusive/list.hpp>
+#include <boost/intrusive/slist.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include "smart_ptr.hpp"
+#include <cstddef>
+#include <string>
+#include <vector>
+#include <algorithm>
+
+using namespace boost::intrusive;
+
+template<class VoidPointer>
+struct sort_value
+   : public list_base_hook< void_pointer<VoidPointer> >
+   , public slist_base_hook< void_pointer<VoidPointer> >
+{
+   typedef list_member_hook< void_pointer<VoidPointer>, order_labels<true> > labeled_hook_t;
+
+   labeled_hook_t labeled_hook_;
+   long long key_;
+   std::string str_;
+   std::size_t order_;
+
+   sort_value()
+      : key_(0), str_(), order_(0)
+   {}
+};
+
+template<class Key>
+struct int_key
+{
+   typedef Key type;
+
+   template<class V>
+   Key operator()(const V &v) const
+   {  return Key(v.key_);  }
+};
+
+struct str_key
+{
+   typedef std::string type;
+
+   template<class V>
+   const std::string &operator()(const V &v) const
+   {  return v.str_;  }
+};
+
+struct throw_on_key {};
+
+//Throws after "throw_countdown" key extractions
+long throw_countdown = -1;
+
+template<class KeyOfValue>
+struct throwing_key
+{
+   typedef typename KeyOfValue::type type;
+
+   template<class V>
+   type operator()(const V &v) const
+   {
+      if(!throw_countdown--)
+         throw throw_on_key();
+      return KeyOfValue()(v);
+   }
+};
+
+template<class KeyOfValue>
+struct key_order_less
+{
+   template<class V>
+   bool operator()(const V *a, const V *b) const
+   {  return KeyOfValue()(*a) < KeyOfValue()(*b);  }
+};
+
+//Key generators
+long long random_key(std::size_t i, std::size_t)
+{  return (long long)((i*2654435761u) % 1000003u) - 500000;  }
+
+long long few_keys(std::size_t i, std::size_t)
+{  return (long long)((i*7919u) % 5u);  }
+
+long long sorted_key(std::size_t i, std::size_t)
+{  return (long long)i;  }
+
+long long reversed_key(std::size_t i, std::size_t n)
+{  return (long long)(n - i);  }
+
+long long nearly_sorted_key(std::size_t i, std::size_t)
+{  return (long long)(i % 4u ? i : i/2u);  }
+
+long long sorted_runs_key(std::size_t i, std::size_t n)
+{  return (long long)(i % (n/3u + 1u));  }
+
+long long wide_key(std::size_t i, std::size_t)
+{  return (long long)(i*0x9E3779B97F4A7C15ull);  }
+
+typedef long long (*key_generator)(std::size_t, std::size_t);
+
+template<class List, class KeyOfValue>
+void test_sort(std::vector<typename List::value_type> &values, key_generator gen)
+{
+   typedef typename List::value_type value_type;
+   const std::size_t sizes[] = { 0, 1, 2, 3, 17, 1000 };
+   for(std::size_t s = 0; s != sizeof(sizes)/sizeof(sizes[0]); ++s){
+      const std::size_t n = sizes[s];
+      std::vector<value_type*> expected;
+      List l;
+      for(std::size_t i = 0; i != n; ++i){
+         value_type &v = values[i];
+         v.key_ = gen(i, n);
+         v.str_ = std::string(std::size_t(v.key_ & 7), 'a') + char('a' + char(v.key_ & 3));
+         v.order_ = i;
+         expected.push_back(&v);
+      }
+      for(std::size_t i = n; i != 0; --i)
+         l.push_front(values[i - 1u]);
+      std::stable_sort(expected.begin(), expected.end(), key_order_less<KeyOfValue>());
+      l.sort_by_key(KeyOfValue());
+      BOOST_TEST_EQ(l.size(), n);
+      std::size_t i = 0;
+      for(typename List::iterator it(l.begin()); it != l.end(); ++it, ++i){
+         BOOST_TEST(i < n && &*it == expected[i]);
+      }
+      BOOST_TEST_EQ(i, n);
+      l.check();
+      l.clear();
+   }
+}
+
+//If key extraction throws, all the elements remain in a valid list
+template<class List, class KeyOfValue>
+void test_sort_throw(std::vector<typename List::value_type> &values, key_generator gen)
+{
+   const std::size_t n = 1000u;
+   for(long at = 0; at < long(n*40u); at = at*3 + 1){
+      List l;
+      for(std::size_t i = 0; i != n; ++i){
+         values[i].key_ = gen(i, n);
+         values[i].str_ = std::string(std::size_t(values[i].key_ & 7), 'a');
+         values[i].order_ = i;
+      }
+      for(std::size_t i = n; i != 0; --i)
+         l.push_front(values[i - 1u]);
+      throw_countdown = at;
+      bool thrown = false;
+      try{
+         l.sort_by_key(throwing_key<KeyOfValue>());
+      }
+      catch(throw_on_key &){
+         thrown = true;
+      }
+      throw_countdown = -1;
+      l.check();
+      BOOST_TEST_EQ(l.size(), n);
+      std::vector<bool> seen(n);
+      std::size_t count = 0;
+      for(typename List::iterator it(l.begin()); it != l.end() && count != n; ++it, ++count)
+         seen[it->order_] = true;
+      BOOST_TEST_EQ(count, n);
+      BOOST_TEST(std::find(seen.begin(), seen.end(), false) == seen.end());
+      if(!thrown){
+         l.sort_by_key(KeyOfValue());
+         BOOST_TEST(!l.empty());
+      }
+      l.clear();
+   }
+}
+
+template<class List>
+void test_list_throw(std::vector<typename List::value_type> &values)
+{
+   //Radix sort, natural merge sort with integral keys and with other keys
+   test_sort_throw<List, int_key<long long> >(values, random_key);
+   test_sort_throw<List, int_key<long long> >(values, sorted_runs_key);
+   test_sort_throw<List, str_key>(values, random_key);
+}
+
+template<class List>
+void test_list(std::vector<typename List::value_type> &values)
+{
+   const key_generator gens[] = { random_key, few_keys, sorted_key, reversed_key
+                                , nearly_sorted_key, sorted_runs_key, wide_key };
+   for(std::size_t g = 0; g != sizeof(gens)/sizeof(gens[0]); ++g){
+      test_sort<List, int_key<long long> >(values, gens[g]);
+      test_sort<List, int_key<int> >(values, gens[g]);
+      test_sort<List, int_key<unsigned> >(values, gens[g]);
+      test_sort<List, int_key<signed char> >(values, gens[g]);
+      test_sort<List, int_key<unsigned short> >(values, gens[g]);
+      test_sort<List, int_key<bool> >(values, gens[g]);
+      test_sort<List, str_key>(values, gens[g]);
+   }
+}
+
+template<class VoidPointer>
+void test_all()
+{
+   typedef sort_value<VoidPointer> value_t;
+   typedef list_base_hook< void_pointer<VoidPointer> >   list_hook_t;
+   typedef slist_base_hook< void_pointer<VoidPointer> >  slist_hook_t;
+   std::vector<value_t> values(1000);
+
+   test_list< list<value_t, base_hook<list_hook_t> > >(values);
+   test_list< list<value_t, base_hook<list_hook_t>, constant_time_size<false> > >(values);
+   test_list< slist<value_t, base_hook<slist_hook_t> > >(values);
+   test_list< slist<value_t, base_hook<slist_hook_t>, linear<true> > >(values);
+   test_list< slist<value_t, base_hook<slist_hook_t>, cache_last<true> > >(values);
+   test_list< slist<value_t, base_hook<slist_hook_t>, linear<true>, cache_last<true> > >(values);
+
+   test_list_throw< list<value_t, base_hook<list_hook_t>, constant_time_size<false> > >(values);
+   test_list_throw< list<value_t, member_hook< value_t, typename value_t::labeled_hook_t
+                                             , &value_t::labeled_hook_> > >(values);
+   test_list_throw< slist<value_t, base_hook<slist_hook_t>, constant_time_size<false> > >(values);
+   test_list_throw< slist<value_t, base_hook<slist_hook_t>, linear<true>, cache_last<true> > >(values);
+
+   //The cached last node is updated
+   {
+      typedef slist<value_t, base_hook<slist_hook_t>, cache_last<true> > slist_t;
+      slist_t l;
+      for(std::size_t i = 0; i != 10u; ++i){
+         values[i].key_ = (long long)(9u - i);
+         l.push_back(values[i]);
+      }
+      l.sort_by_key(int_key<int>());
+      BOOST_TEST(&l.back() == &values[0]);
+      l.push_back(values[10]);
+      BOOST_TEST(&l.back() == &values[10]);
+      l.clear();
+   }
+}
+
+int main()
+{
+   test_all<void*>();
+   test_all<boost::intrusive::smart_ptr<void> >();
+   return boost::report_errors();
+}
@@ -0,0 +1,238 @@
+/////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright agent 2026
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/intrusive for documentation.
+//
+/////////////////////////////////////////////////////////////////////////////
+#include <boost/intrusive/splay_set.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include "smart_ptr.hpp"
+#include <cstddef>
+#include <vector>
+
+using namespace boost::intrusive;
+
+template<class Hook>
+struct splay_value
+   : public Hook
+{
+   int value_;
+
+   explicit splay_value(int v = 0)
+      : value_(v)
+   {}
+
+   friend bool operator <(const splay_value &a, const splay_value &b)
+   {  return a.value_ < b.value_;  }
+
+   friend bool operator ==(const splay_value &a, const splay_value &b)
+   {  return a.value_ == b.value_;  }
+};
+
+template<class Tree>
+std::size_t depth_of(const Tree &t, typename Tree::const_iterator it)
+{  (void)t; return Tree::node_algorithms::depth(it.pointed_node());  }
+
+template<class Tree>
+const typename Tree::value_type *root_of(const Tree &t)
+{
+   typedef typename Tree::node_traits node_traits;
+   return &*Tree::value_traits::to_value_ptr(node_traits::get_parent(t.end().pointed_node()));
+}
+
+//Returns the in-order values and the parent of each node, to detect changes in the shape
+template<class Tree>
+std::vector<const void*> shape_of(const Tree &t)
+{
+   typedef typename Tree::node_traits node_traits;
+   std::vector<const void*> shape;
+   for(typename Tree::const_iterator it(t.begin()); it != t.end(); ++it){
+      shape.push_back(&*it);
+      shape.push_back(&*node_traits::get_parent(it.pointed_node()));
+   }
+   return shape;
+}
+
+//Inserts values so that the tree degenerates into a list
+//and the first element is at depth size-1
+template<class Tree>
+void fill_degenerated(Tree &t, std::vector<typename Tree::value_type> &values, int size)
+{
+   typedef typename Tree::value_type value_type;
+   values.clear();
+   values.reserve(std::size_t(size));
+   for(int i = 0; i != size; ++i)
+      values.push_back(value_type(i));
+   for(int i = 0; i != size; ++i)
+      t.push_back(values[std::size_t(i)]);
+   BOOST_TEST_EQ(depth_of(t, t.begin()), std::size_t(size - 1));
+}
+
+//Lookups find the right elements and keep the tree valid with any policy
+template<class Tree>
+void test_lookups()
+{
+   typedef typename Tree::value_type value_type;
+   typedef typename Tree::iterator iterator;
+   std::vector<value_type> values;
+   Tree t;
+   for(int i = 0; i != 200; ++i)
+      values.push_back(value_type(i/2));
+   for(std::size_t i = 0; i != values.size(); ++i)
+      t.insert(values[(i*73u) % values.size()]);
+
+   for(int round = 0; round != 3; ++round){
+      for(int i = -1; i != 101; ++i){
+         const value_type key(i);
+         iterator it = t.find(key);
+         BOOST_TEST(i < 0 || i >= 100 ? it == t.end() : it->value_ == i);
+         it = t.lower_bound(key);
+         BOOST_TEST(it == t.end() ? i >= 100 : it->value_ == (i < 0 ? 0 : i));
+         it = t.upper_bound(key);
+         BOOST_TEST(it == t.end() ? i >= 99 : it->value_ == (i < 0 ? 0 : i + 1));
+         std::pair<iterator, iterator> r = t.equal_range(key);
+         BOOST_TEST_EQ(std::size_t(std::distance(r.first, r.second)), (i < 0 || i >= 100) ? 0u : 2u);
+         BOOST_TEST_EQ(t.count(key), (i < 0 || i >= 100) ? 0u : 2u);
+         r = t.bounded_range(key, value_type(i + 3), true, false);
+         BOOST_TEST(r.first == t.lower_bound(key));
+         BOOST_TEST(r.second == t.lower_bound(value_type(i + 3)));
+         it = t.find_no_splay(key);
+         BOOST_TEST(i < 0 || i >= 100 ? it == t.end() : it->value_ == i);
+         t.check();
+      }
+   }
+   BOOST_TEST_EQ(t.size(), values.size());
+   t.clear();
+}
+
+template<class Tree>
+void test_find_no_splay()
+{
+   std::vector<typename Tree::value_type> values;
+   Tree t;
+   fill_degenerated(t, values, 50);
+   const std::vector<const void*> shape(shape_of(t));
+   for(int i = 0; i != 50; ++i)
+      BOOST_TEST(&*t.find_no_splay(values[std::size_t(i)]) == &values[std::size_t(i)]);
+   BOOST_TEST(t.find_no_splay(typename Tree::value_type(50)) == t.end());
+   BOOST_TEST(shape_of(t) == shape);
+   t.clear();
+}
+
+template<class Tree>
+void test_full_splay()
+{
+   std::vector<typename Tree::value_type> values;
+   Tree t;
+   fill_degenerated(t, values, 50);
+   BOOST_TEST(root_of(t) != &values[0]);
+   t.find(values[0]);
+   BOOST_TEST(root_of(t) == &values[0]);
+   t.check();
+   t.clear();
+}
+
+template<class Tree>
+void test_semi_splay()
+{
+   std::vector<typename Tree::value_type> values;
+   Tree t;
+   fill_degenerated(t, values, 64);
+   //Each access roughly halves the depth of the element
+   std::size_t depth = depth_of(t, t.begin());
+   while(depth){
+      BOOST_TEST(t.find(values[0]) == t.begin());
+      t.check();
+      const std::size_t new_depth = depth_of(t, t.begin());
+      BOOST_TEST(new_depth < depth);
+      BOOST_TEST(new_depth + 1u >= depth/2u);
+      depth = new_depth;
+   }
+   BOOST_TEST(root_of(t) == &values[0]);
+   t.clear();
+}
+
+template<class Tree>
+void test_period(std::size_t period)
+{
+   std::vector<typename Tree::value_type> values;
+   Tree t;
+   fill_degenerated(t, values, 50);
+   for(std::size_t i = 1; i != period; ++i){
+      const std::vector<const void*> shape(shape_of(t));
+      t.find(values[0]);
+      BOOST_TEST(shape_of(t) == shape);
+   }
+   t.find(values[0]);
+   BOOST_TEST(root_of(t) == &values[0]);
+   //Failed lookups are not counted
+   const std::vector<const void*> shape(shape_of(t));
+   for(std::size_t i = 0; i != period; ++i)
+      t.find(typename Tree::value_type(50));
+   BOOST_TEST(shape_of(t) == shape);
+   t.check();
+   t.clear();
+}
+
+template<class Tree>
+void test_depth_threshold(std::size_t threshold)
+{
+   std::vector<typename Tree::value_type> values;
+   Tree t;
+   fill_degenerated(t, values, 50);
+   //The last elements are near the root and are not splayed
+   for(int i = 49; i != 49 - int(threshold) - 1; --i){
+      const std::vector<const void*> shape(shape_of(t));
+      BOOST_TEST_EQ(depth_of(t, t.iterator_to(values[std::size_t(i)])), std::size_t(49 - i));
+      t.find(values[std::size_t(i)]);
+      BOOST_TEST(shape_of(t) == shape);
+   }
+   t.find(values[0]);
+   BOOST_TEST(root_of(t) == &values[0]);
+   t.check();
+   t.clear();
+}
+
+template<class VoidPointer>
+void test_all()
+{
+   typedef splay_value< bs_set_base_hook< void_pointer<VoidPointer> > > value_t;
+   typedef splay_multiset<value_t>                                    def_t;
+   typedef splay_multiset<value_t, semi_splay<true> >                 semi_t;
+   typedef splay_multiset<value_t, splay_period<3> >                  period_t;
+   typedef splay_multiset<value_t, splay_depth_threshold<4> >         depth_t;
+   typedef splay_multiset<value_t, semi_splay<true>, splay_period<2>
+                         , splay_depth_threshold<2> >                 mixed_t;
+
+   test_lookups<def_t>();
+   test_lookups<semi_t>();
+   test_lookups<period_t>();
+   test_lookups<depth_t>();
+   test_lookups<mixed_t>();
+
+   test_find_no_splay<def_t>();
+   test_find_no_splay<mixed_t>();
+
+   test_full_splay<def_t>();
+   test_full_splay<depth_t>();
+   test_semi_splay<semi_t>();
+   test_period<period_t>(3u);
+   test_depth_threshold<depth_t>(4u);
+
+   //Policies only add an access counter
+   BOOST_TEST(sizeof(def_t) == sizeof(semi_t));
+   BOOST_TEST(sizeof(def_t) == sizeof(depth_t));
+   BOOST_TEST(sizeof(def_t) <  sizeof(period_t));
+}
+
+int main()
+{
+   test_all<void*>();
+   test_all<boost::intrusive::smart_ptr<void> >();
+   return boost::report_errors();
+}
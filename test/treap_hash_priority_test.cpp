@@ -0,0 +1,136 @@
+/////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright agent 2026
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/intrusive for documentation.
+//
+/////////////////////////////////////////////////////////////////////////////
+#include <boost/intrusive/treap_set.hpp>
+#include <boost/intrusive/priority_compare.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include "smart_ptr.hpp"
+#include <cstddef>
+#include <vector>
+
+using namespace boost::intrusive;
+
+template<class Hook>
+struct prio_value
+   : public Hook
+{
+   int value_;
+
+   explicit prio_value(int v = 0)
+      : value_(v)
+   {}
+
+   friend bool operator <(const prio_value &a, const prio_value &b)
+   {  return a.value_ < b.value_;  }
+
+   friend bool operator ==(const prio_value &a, const prio_value &b)
+   {  return a.value_ == b.value_;  }
+
+   friend std::size_t hash_value(const prio_value &v)
+   {  return std::size_t(v.value_);  }
+};
+
+struct int_key
+{
+   typedef int type;
+
+   template<class V>
+   const int &operator()(const V &v) const
+   {  return v.value_;  }
+};
+
+template<class Tree>
+std::size_t max_depth(const Tree &t)
+{
+   std::size_t depth = 0;
+   for(typename Tree::const_iterator it(t.begin()); it != t.end(); ++it){
+      const std::size_t d = Tree::node_algorithms::depth(it.pointed_node());
+      if(d > depth)
+         depth = d;
+   }
+   return depth;
+}
+
+std::size_t log2_ceil(std::size_t n)
+{
+   std::size_t l = 0;
+   while((std::size_t(1u) << l) < n)
+      ++l;
+   return l;
+}
+
+//Sorted insertions degenerate an unbalanced tree, randomized
+//priorities must keep the depth logarithmic
+template<class Tree>
+void test_depth(int dup)
+{
+   typedef typename Tree::value_type value_type;
+   const std::size_t size = 20000;
+   std::vector<value_type> values;
+   values.reserve(size);
+   for(std::size_t i = 0; i != size; ++i)
+      values.push_back(value_type(int(i)/dup));
+   Tree t;
+   for(std::size_t i = 0; i != size; ++i)
+      t.insert(values[i]);
+   t.check();
+   BOOST_TEST_EQ(t.size(), size);
+   BOOST_TEST(max_depth(t) <= 4u*log2_ceil(size));
+
+   //Half of the elements erased, the rest reinserted in reverse order
+   for(std::size_t i = 0; i < size; i += 2)
+      t.erase(t.iterator_to(values[i]));
+   t.check();
+   for(std::size_t i = size; i > 0; i -= 2)
+      t.insert(values[i - 2]);
+   t.check();
+   BOOST_TEST_EQ(t.size(), size);
+   BOOST_TEST(max_depth(t) <= 4u*log2_ceil(size));
+   for(std::size_t i = 0; i != size; ++i)
+      BOOST_TEST(t.find(typename Tree::key_of_value()(values[i])) != t.end());
+   t.clear();
+}
+
+template<class VoidPointer>
+void test_all()
+{
+   typedef prio_value< bs_set_base_hook< void_pointer<VoidPointer> > > value_t;
+   typedef treap_set<value_t, priority_of_value<address_priority> >     addr_set_t;
+   typedef treap_multiset<value_t, priority_of_value<address_priority> > addr_mset_t;
+   typedef treap_set<value_t, priority_of_value<hash_priority<> > >     hash_set_t;
+   typedef treap_multiset<value_t, priority_of_value<hash_priority<> > > hash_mset_t;
+   typedef treap_set<value_t, key_of_value<int_key>
+                    , priority_of_value<hash_priority<int_key> > >       key_set_t;
+
+   test_depth<addr_set_t>(1);
+   test_depth<addr_mset_t>(4);
+   test_depth<hash_set_t>(1);
+   //Equivalent keys have the same priority and form chains
+   test_depth<hash_mset_t>(1);
+   test_depth<key_set_t>(1);
+
+   //Priorities of equal keys are equal and the priority of
+   //a value does not change when it is moved
+   {
+      value_t a(3), b(3);
+      BOOST_TEST_EQ(hash_priority<>()(a), hash_priority<>()(b));
+      BOOST_TEST_EQ(hash_priority<int_key>()(a), hash_priority<int_key>()(b));
+      BOOST_TEST_EQ(address_priority()(a), address_priority()(a));
+      BOOST_TEST(address_priority()(a) != address_priority()(b));
+   }
+}
+
+int main()
+{
+   test_all<void*>();
+   test_all<boost::intrusive::smart_ptr<void> >();
+   return boost::report_errors();
+}
@@ -0,0 +1,286 @@
+/////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright agent 2026
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/intrusive for documentation.
+//
+/////////////////////////////////////////////////////////////////////////////
+#include <boost/intrusive/xor_list.hpp>
+#include <boost/intrusive/list_hook.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <cstdlib>
+#include <list>
+#include <vector>
+
+using namespace boost::intrusive;
+
+template<link_mode_type LinkMode>
+struct xor_value
+   : public xor_list_base_hook< link_mode<LinkMode> >
+{
+   xor_list_member_hook< link_mode<LinkMode> > node_;
+   int value_;
+
+   explicit xor_value(int v = 0)
+      : value_(v)
+   {}
+};
+
+struct delete_disposer
+{
+   template<class P>
+   void operator()(P p)
+   {  delete &*p;  }
+};
+
+struct new_cloner
+{
+   template<class V>
+   V *operator()(const V &v)
+   {  return new V(v.value_);  }
+};
+
+struct count_disposer
+{
+   explicit count_disposer(std::size_t &c) : count_(c) {}
+   template<class P>
+   void operator()(P)
+   {  ++count_;  }
+   std::size_t &count_;
+};
+
+template<class XorList>
+bool check_equal(const XorList &c, const std::list<int> &ref)
+{
+   if(c.size() != ref.size() || c.empty() != ref.empty())
+      return false;
+   //Forward
+   typename XorList::const_iterator it = c.begin();
+   for(std::list<int>::const_iterator rit = ref.begin(); rit != ref.end(); ++rit, ++it){
+      if(it == c.end() || it->value_ != *rit)
+         return false;
+   }
+   if(it != c.end())
+      return false;
+   //Backward
+   typename XorList::const_reverse_iterator cit = c.rbegin();
+   for(std::list<int>::const_reverse_iterator rit = ref.rbegin(); rit != ref.rend(); ++rit, ++cit){
+      if(cit == c.rend() || cit->value_ != *rit)
+         return false;
+   }
+   return cit == c.rend();
+}
+
+template<class Value, class XorList>
+void test_xor_list()
+{
+   const int N = 200;
+   std::vector<Value> values;
+   values.reserve(N);
+   for(int i = 0; i != N; ++i)
+      values.push_back(Value(i));
+
+   {  //Both ends against std::list
+      XorList c;
+      std::list<int> ref;
+      BOOST_TEST(c.empty());
+      BOOST_TEST(c.begin() == c.end());
+      BOOST_TEST(c.rbegin() == c.rend());
+      for(int i = 0; i != N; ++i){
+         if(i % 3){
+            c.push_back(values[std::size_t(i)]);
+            ref.push_back(i);
+         }
+         else{
+            c.push_front(values[std::size_t(i)]);
+            ref.push_front(i);
+         }
+      }
+      BOOST_TEST(check_equal(c, ref));
+      BOOST_TEST_EQ(c.front().value_, ref.front());
+      BOOST_TEST_EQ(c.back().value_, ref.back());
+      for(int i = 0; i != N/4; ++i){
+         c.pop_front();
+         ref.pop_front();
+         c.pop_back();
+         ref.pop_back();
+      }
+      BOOST_TEST(check_equal(c, ref));
+
+      //Iterators can step back and forth
+      typename XorList::iterator it = c.begin();
+      ++it; ++it; --it;
+      BOOST_TEST_EQ(it->value_, *++ref.begin());
+      it = c.end();
+      --it;
+      BOOST_TEST_EQ(it->value_, ref.back());
+
+      //insert and erase in the middle
+      it = c.begin();
+      std::list<int>::iterator rit = ref.begin();
+      for(int i = 0; i != 10; ++i, ++it, ++rit){}
+      it = c.erase(it);
+      rit = ref.erase(rit);
+      BOOST_TEST_EQ(it->value_, *rit);
+      //Elements popped from both ends are reused
+      it = c.insert(it, values[N-2]);
+      rit = ref.insert(rit, N-2);
+      BOOST_TEST_EQ(it->value_, N-2);
+      BOOST_TEST(check_equal(c, ref));
+      c.insert(c.end(), values[N-1]);
+      ref.insert(ref.end(), N-1);
+      c.insert(c.begin(), values[N-3]);
+      ref.insert(ref.begin(), N-3);
+      BOOST_TEST(check_equal(c, ref));
+
+      //Range erase
+      typename XorList::iterator b = c.begin(), e;
+      std::list<int>::iterator rb = ref.begin(), re;
+      ++b; ++b; ++rb; ++rb;
+      e = b; re = rb;
+      for(int i = 0; i != 20; ++i, ++e, ++re){}
+      it = c.erase(b, e);
+      rit = ref.erase(rb, re);
+      BOOST_TEST_EQ(it->value_, *rit);
+      BOOST_TEST(check_equal(c, ref));
+      it = c.erase(c.begin(), c.begin());
+      BOOST_TEST(it == c.begin());
+      BOOST_TEST(check_equal(c, ref));
+
+      //Reverse
+      c.reverse();
+      ref.reverse();
+      BOOST_TEST(check_equal(c, ref));
+      c.clear();
+      BOOST_TEST(c.empty());
+      BOOST_TEST_EQ(c.size(), 0u);
+   }
+   {  //Splice, swap and move
+      XorList a, b;
+      std::list<int> ra, rb;
+      for(int i = 0; i != N/2; ++i){
+         a.push_back(values[std::size_t(i)]);
+         ra.push_back(i);
+      }
+      for(int i = N/2; i != N; ++i){
+         b.push_back(values[std::size_t(i)]);
+         rb.push_back(i);
+      }
+      typename XorList::iterator pos = a.begin();
+      std::list<int>::iterator rpos = ra.begin();
+      for(int i = 0; i != 5; ++i, ++pos, ++rpos){}
+      a.splice(pos, b);
+      ra.splice(rpos, rb);
+      BOOST_TEST(b.empty());
+      BOOST_TEST(check_equal(a, ra));
+      BOOST_TEST(check_equal(b, rb));
+      b.splice(b.end(), a);
+      rb.splice(rb.end(), ra);
+      BOOST_TEST(check_equal(a, ra));
+      BOOST_TEST(check_equal(b, rb));
+
+      //Move the first element of b to a and swap
+      b.erase(b.begin());
+      rb.erase(rb.begin());
+      a.push_back(values[0]);
+      ra.push_back(0);
+      a.swap(b);
+      ra.swap(rb);
+      BOOST_TEST(check_equal(a, ra));
+      BOOST_TEST(check_equal(b, rb));
+      a.swap(b);
+      ra.swap(rb);
+      a.splice(a.begin(), b);
+      ra.splice(ra.begin(), rb);
+      BOOST_TEST(check_equal(a, ra));
+
+      //Swap with an empty list
+      a.swap(b);
+      ra.swap(rb);
+      BOOST_TEST(check_equal(a, ra));
+      BOOST_TEST(check_equal(b, rb));
+
+      XorList m(boost::move(b));
+      BOOST_TEST(b.empty());
+      BOOST_TEST(check_equal(m, rb));
+      BOOST_TEST(&XorList::container_from_end_iterator(m.end()) == &m);
+      BOOST_TEST(&XorList::container_from_end_iterator(m.cend()) == &m);
+      a = boost::move(m);
+      BOOST_TEST(check_equal(a, rb));
+      a.clear();
+   }
+   {  //Range constructor, clone_from and disposers
+      XorList a(values.begin(), values.end());
+      BOOST_TEST_EQ(a.size(), std::size_t(N));
+      XorList b;
+      b.clone_from(a, new_cloner(), delete_disposer());
+      BOOST_TEST_EQ(b.size(), std::size_t(N));
+      typename XorList::const_iterator ai = a.cbegin(), bi = b.cbegin();
+      for(; ai != a.cend(); ++ai, ++bi){
+         BOOST_TEST(&*ai != &*bi);
+         BOOST_TEST_EQ(ai->value_, bi->value_);
+      }
+      b.pop_back_and_dispose(delete_disposer());
+      b.pop_front_and_dispose(delete_disposer());
+      b.erase_and_dispose(b.begin(), delete_disposer());
+      typename XorList::iterator e = b.begin();
+      for(int i = 0; i != 10; ++i, ++e){}
+      b.erase_and_dispose(b.begin(), e, delete_disposer());
+      BOOST_TEST_EQ(b.size(), std::size_t(N - 13));
+      b.clear_and_dispose(delete_disposer());
+      BOOST_TEST(b.empty());
+
+      std::size_t disposed = 0;
+      a.clear_and_dispose(count_disposer(disposed));
+      BOOST_TEST_EQ(disposed, std::size_t(N));
+   }
+}
+
+void test_hook_size()
+{
+   //A single link field
+   BOOST_TEST_EQ(sizeof(xor_list_base_hook<>), sizeof(void*));
+   BOOST_TEST_EQ(sizeof(xor_list_member_hook<>), sizeof(void*));
+   BOOST_TEST(sizeof(xor_list_base_hook<>) < sizeof(list_base_hook<>));
+}
+
+void test_safe_mode()
+{
+   typedef xor_value<safe_link> value_t;
+   value_t v1(1), v2(2), v3(3);
+   BOOST_TEST(!v1.is_linked());
+   {
+      xor_list<value_t> c;
+      c.push_back(v1);
+      c.push_back(v2);
+      c.push_back(v3);
+      BOOST_TEST(v1.is_linked() && v2.is_linked() && v3.is_linked());
+      c.erase(++c.begin());
+      BOOST_TEST(!v2.is_linked());
+      c.pop_front();
+      BOOST_TEST(!v1.is_linked());
+   }
+   //Destructor unlinks the remaining elements
+   BOOST_TEST(!v3.is_linked());
+}
+
+int main()
+{
+   typedef xor_value<safe_link>     safe_value;
+   typedef xor_value<normal_link>   normal_value;
+   typedef member_hook< safe_value, xor_list_member_hook< link_mode<safe_link> >, &safe_value::node_ > safe_member;
+   typedef member_hook< normal_value, xor_list_member_hook< link_mode<normal_link> >, &normal_value::node_ > normal_member;
+
+   test_hook_size();
+   test_xor_list< safe_value, xor_list<safe_value> >();
+   test_xor_list< safe_value, xor_list<safe_value, safe_member> >();
+   test_xor_list< normal_value, xor_list<normal_value> >();
+   test_xor_list< normal_value, xor_list<normal_value, normal_member, constant_time_size<false> > >();
+   test_xor_list< normal_value, xor_list<normal_value, constant_time_size<true>, size_type<unsigned short> > >();
+   test_safe_mode();
+   return boost::report_errors();
+}